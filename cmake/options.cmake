@@ -32,8 +32,10 @@ option(RETDEC_ENABLE_LLVM_SUPPORT "" OFF)
 option(RETDEC_ENABLE_LLVMIR_EMUL "" OFF)
 option(RETDEC_ENABLE_LLVMIR2HLL "" OFF)
 option(RETDEC_ENABLE_LOADER "" OFF)
+option(RETDEC_ENABLE_LTICOMPILERTOOL "" OFF)
 option(RETDEC_ENABLE_MACHO_EXTRACTOR "" OFF)
 option(RETDEC_ENABLE_MACHO_EXTRACTORTOOL "" OFF)
+option(RETDEC_ENABLE_ORDCOMPILERTOOL "" OFF)
 option(RETDEC_ENABLE_PAT2YARA "" OFF)
 option(RETDEC_ENABLE_PATTERNGEN "" OFF)
 option(RETDEC_ENABLE_PDBPARSER "" OFF)
@@ -88,8 +90,10 @@ foreach(t ${RETDEC_ENABLE})
 	set_if_equal(${t} "llvmir-emul" RETDEC_ENABLE_LLVMIR_EMUL)
 	set_if_equal(${t} "llvmir2hll" RETDEC_ENABLE_LLVMIR2HLL)
 	set_if_equal(${t} "loader" RETDEC_ENABLE_LOADER)
+	set_if_equal(${t} "lticompilertool" RETDEC_ENABLE_LTICOMPILERTOOL)
 	set_if_equal(${t} "extractor" RETDEC_ENABLE_MACHO_EXTRACTOR)
 	set_if_equal(${t} "extractortool" RETDEC_ENABLE_MACHO_EXTRACTORTOOL)
+	set_if_equal(${t} "ordcompilertool" RETDEC_ENABLE_ORDCOMPILERTOOL)
 	set_if_equal(${t} "pat2yara" RETDEC_ENABLE_PAT2YARA)
 	set_if_equal(${t} "patterngen" RETDEC_ENABLE_PATTERNGEN)
 	set_if_equal(${t} "pdbparser" RETDEC_ENABLE_PDBPARSER)
@@ -131,8 +135,10 @@ if (RETDEC_ENABLE_AR_EXTRACTOR
 	OR RETDEC_ENABLE_LLVMIR_EMUL
 	OR RETDEC_ENABLE_LLVMIR2HLL
 	OR RETDEC_ENABLE_LOADER
+	OR RETDEC_ENABLE_LTICOMPILERTOOL
 	OR RETDEC_ENABLE_MACHO_EXTRACTOR
 	OR RETDEC_ENABLE_MACHO_EXTRACTORTOOL
+	OR RETDEC_ENABLE_ORDCOMPILERTOOL
 	OR RETDEC_ENABLE_PAT2YARA
 	OR RETDEC_ENABLE_PATTERNGEN
 	OR RETDEC_ENABLE_PDBPARSER
@@ -242,6 +248,16 @@ set_if_at_least_one_set(RETDEC_ENABLE_BIN2LLVMIR
 		RETDEC_ENABLE_ALL
 		RETDEC_ENABLE_RETDEC)
 
+# Compiles library type information used by bin2llvmir at installation.
+set_if_at_least_one_set(RETDEC_ENABLE_LTICOMPILERTOOL
+		RETDEC_ENABLE_ALL
+		RETDEC_ENABLE_BIN2LLVMIR)
+
+# Compiles ordinal databases used by bin2llvmir at installation.
+set_if_at_least_one_set(RETDEC_ENABLE_ORDCOMPILERTOOL
+		RETDEC_ENABLE_ALL
+		RETDEC_ENABLE_BIN2LLVMIR)
+
 set_if_at_least_one_set(RETDEC_ENABLE_LLVMIR2HLL
 		RETDEC_ENABLE_ALL
 		RETDEC_ENABLE_RETDEC)
@@ -288,7 +304,8 @@ set_if_at_least_one_set(RETDEC_ENABLE_DEMANGLER
 set_if_at_least_one_set(RETDEC_ENABLE_CTYPESPARSER
 		RETDEC_ENABLE_ALL
 		RETDEC_ENABLE_BIN2LLVMIR
-		RETDEC_ENABLE_DEMANGLER)
+		RETDEC_ENABLE_DEMANGLER
+		RETDEC_ENABLE_LTICOMPILERTOOL)
 
 set_if_at_least_one_set(RETDEC_ENABLE_CTYPES
 		RETDEC_ENABLE_ALL
@@ -368,13 +385,16 @@ set_if_at_least_one_set(RETDEC_ENABLE_UTILS
 		RETDEC_ENABLE_LLVM_SUPPORT
 		RETDEC_ENABLE_LLVMIR2HLL
 		RETDEC_ENABLE_LOADER
+		RETDEC_ENABLE_LTICOMPILERTOOL
 		RETDEC_ENABLE_MACHO_EXTRACTOR
 		RETDEC_ENABLE_MACHO_EXTRACTORTOOL
+		RETDEC_ENABLE_ORDCOMPILERTOOL
 		RETDEC_ENABLE_CPDETECT
 		RETDEC_ENABLE_PATTERNGEN
 		RETDEC_ENABLE_RTTI_FINDER
 		RETDEC_ENABLE_STACOFIN
-		RETDEC_ENABLE_UNPACKERTOOL)
+		RETDEC_ENABLE_UNPACKERTOOL
+		RETDEC_ENABLE_YARACPP)
 
 set_if_at_least_one_set(RETDEC_ENABLE_YARACPP
 		RETDEC_ENABLE_ALL
@@ -392,6 +412,9 @@ set_if_all_set(RETDEC_ENABLE_CAPSTONE2LLVMIR_TESTS
 set_if_all_set(RETDEC_ENABLE_CONFIG_TESTS
 		RETDEC_TESTS
 		RETDEC_ENABLE_CONFIG)
+set_if_all_set(RETDEC_ENABLE_CPDETECT_TESTS
+		RETDEC_TESTS
+		RETDEC_ENABLE_CPDETECT)
 set_if_all_set(RETDEC_ENABLE_CTYPES_TESTS
 		RETDEC_TESTS
 		RETDEC_ENABLE_CTYPES)
@@ -446,6 +469,7 @@ set_if_at_least_one_set(RETDEC_ENABLE_GOOGLETEST
 		RETDEC_ENABLE_CAPSTONE2LLVMIR_TESTS
 		RETDEC_ENABLE_COMMON_TESTS
 		RETDEC_ENABLE_CONFIG_TESTS
+		RETDEC_ENABLE_CPDETECT_TESTS
 		RETDEC_ENABLE_CTYPES_TESTS
 		RETDEC_ENABLE_CTYPESPARSER_TESTS
 		RETDEC_ENABLE_DEMANGLER_TESTS
@@ -3,9 +3,10 @@
 * @brief Reaching definitions analysis (RDA) builds UD and DU chains.
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 *
-* Right now, this works on an entire module. But we could insert an another layer
-* that represents functions. Then it would be possible to associate BBs with
-* functions that own them and recompute RDA only for the selected function.
+* Functions are analyzed independently of each other. In every function,
+* definitions are numbered so that sets of definitions are bit vectors, and
+* the sets are propagated by a worklist of basic blocks whose predecessors
+* changed.
 */
 
 #ifndef RETDEC_BIN2LLVMIR_ANALYSES_REACHING_DEFINITIONS_H
@@ -33,8 +34,6 @@ class ReachingDefinitionsAnalysis;
 
 using Changed = bool;
 
-using BBEntrySet = std::unordered_set<BasicBlockEntry*>;
-
 using DefSet = std::unordered_set<Definition*>;
 using UseSet = std::unordered_set<Use*>;
 
@@ -90,9 +89,6 @@ class BasicBlockEntry
 				std::ostream& out,
 				const BasicBlockEntry& bbe);
 
-		void initializeKillDefSets();
-		Changed initDefsOut();
-
 		const DefSet& defsFromUse(const llvm::Instruction* I) const;
 		const UseSet& usesFromDef(const llvm::Instruction* I) const;
 		const Definition* getDef(const llvm::Instruction* I) const;
@@ -104,14 +100,8 @@ class BasicBlockEntry
 		DefVector defs;
 		UseVector uses;
 
-		BBEntrySet prevBBs;
-
-		// defsIn is union of prevBBs' defsOuts
-		DefSet defsOut;
-		DefSet genDefs;
-		std::unordered_set<llvm::Value*> killDefs;
-
-		bool changed = false;
+		/// Entries of predecessors, each one only once.
+		std::vector<BasicBlockEntry*> prevBBs;
 
 	private:
 		unsigned id;
@@ -123,7 +113,8 @@ class ReachingDefinitionsAnalysis
 		bool runOnModule(
 				llvm::Module& M,
 				Abi* abi = nullptr,
-				bool trackFlagRegs = false);
+				bool trackFlagRegs = false,
+				unsigned jobs = 1);
 		bool runOnFunction(
 				llvm::Function& F,
 				Abi* abi = nullptr,
@@ -152,18 +143,18 @@ class ReachingDefinitionsAnalysis
 				llvm::Instruction* I);
 
 	private:
-		void run();
+		void run(unsigned jobs = 1);
 		const BasicBlockEntry& getBasicBlockEntry(const llvm::Instruction* I) const;
 		void initializeBasicBlocks(llvm::Module& M);
 		void initializeBasicBlocks(llvm::Function& F);
-		void initializeBasicBlocksPrev();
-		void initializeKillGenSets();
-		void propagate();
-		void initializeDefsAndUses();
-		void clearInternal();
+		static void analyzeFunction(std::vector<BasicBlockEntry>& bbs);
 
 	private:
-		std::map<const llvm::Function*, std::map<const llvm::BasicBlock*, BasicBlockEntry>> bbMap;
+		/// Entries of basic blocks of analyzed functions, in the order of
+		/// basic blocks in the functions.
+		std::vector<std::vector<BasicBlockEntry>> fncBbs;
+		/// Entries of all basic blocks in @c fncBbs.
+		std::unordered_map<const llvm::BasicBlock*, BasicBlockEntry*> bbMap;
 		bool _trackFlagRegs = false;
 		const llvm::GlobalVariable* _specialGlobal = nullptr;
 		bool _run = false;
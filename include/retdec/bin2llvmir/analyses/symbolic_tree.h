@@ -11,10 +11,16 @@
 #ifndef RETDEC_BIN2LLVMIR_ANALYSES_SYMBOLIC_TREE_H
 #define RETDEC_BIN2LLVMIR_ANALYSES_SYMBOLIC_TREE_H
 
+#include <map>
+#include <memory>
 #include <set>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/STLExtras.h>
+#include <llvm/ADT/SmallVector.h>
 #include <llvm/IR/Function.h>
 #include <llvm/IR/Instruction.h>
 #include <llvm/IR/Instructions.h>
@@ -26,12 +32,136 @@
 namespace retdec {
 namespace bin2llvmir {
 
+class SymbolicTree;
+
+/**
+ * Expansions of values shared by symbolic trees.
+ *
+ * Expanded nodes are interned by their value, their user and the number of
+ * levels remaining to the maximal node level. Each such node is expanded only
+ * once, no matter how many times it occurs in a tree, or in all the trees
+ * constructed with the same cache. Trees are materialized from the interned
+ * nodes and simplification of a tree that was not modified since its
+ * construction reuses the simplifications of its interned subtrees.
+ *
+ * The cache is valid only for one SymbolicTree configuration, one RDA and one
+ * construction method. It is cleared when a tree is constructed with different
+ * ones. Nodes containing values that are deleted or replaced by
+ * llvm::Value::replaceAllUsesWith() are invalidated automatically. All other
+ * changes of an instruction (e.g. llvm::User::replaceUsesOfWith()) must be
+ * reported by invalidate(). Use clear() when RDA is recomputed or, with
+ * on-demand RDA and linear construction, when control flow or stores change.
+ *
+ * The cache saves the expansion of nodes (mainly the lookups of reaching
+ * definitions), not the trees themselves. Each construction returns its own
+ * copy of the tree, because users modify the trees in place. The cost of
+ * a construction is therefore still proportional to the size of the tree,
+ * in which a shared subexpression occurs as many times as it is used (at most
+ * @c maxNodeLevel levels deep).
+ *
+ * Only ConstantsAnalysis uses the cache. Other users construct trees while
+ * they change the IR they are constructed from, so the cache would have to
+ * be cleared before almost every construction:
+ * - the decoder (e.g. jump targets of switches) uses on-demand RDA while new
+ *   blocks and stores are being decoded,
+ * - StackAnalysis replaces stack loads and stores between constructions and
+ *   its trees depend on its own value map,
+ * - CondBranchOpt uses its own configuration and rewrites the branches it
+ *   constructs the trees for.
+ */
+class SymbolicTreeCache
+{
+	public:
+		SymbolicTreeCache();
+		~SymbolicTreeCache();
+		SymbolicTreeCache(const SymbolicTreeCache&) = delete;
+		SymbolicTreeCache& operator=(const SymbolicTreeCache&) = delete;
+
+		void invalidate(llvm::Value* v);
+		void clear();
+		std::size_t size() const;
+
+	private:
+		struct Node;
+		class ValueHandle;
+
+		struct Key
+		{
+			llvm::Value* value = nullptr;
+			llvm::Value* user = nullptr;
+			unsigned levels = 0;
+
+			bool operator==(const Key& o) const;
+		};
+		struct KeyHash
+		{
+			std::size_t operator()(const Key& k) const;
+		};
+
+		/**
+		 * Everything the expansion and simplification of nodes depends on.
+		 */
+		struct Context
+		{
+			ReachingDefinitionsAnalysis* rda = nullptr;
+			bool linear = false;
+			/// Version of the SymbolicTree configuration.
+			unsigned configuration = 0;
+
+			bool operator==(const Context& o) const;
+			bool operator!=(const Context& o) const;
+		};
+
+	private:
+		static Context currentContext(
+				ReachingDefinitionsAnalysis* rda,
+				bool linear);
+
+		SymbolicTree construct(
+				ReachingDefinitionsAnalysis* rda,
+				llvm::Value* v,
+				unsigned maxNodeLevel,
+				bool linear);
+
+		const std::shared_ptr<Node>& getNode(
+				llvm::Value* v,
+				llvm::Value* u,
+				unsigned levels);
+		void expandNode(Node* node);
+		void addOperand(Node* node, Node* op);
+		void aliasNode(Node* node, Node* target);
+		llvm::ArrayRef<llvm::Value*> getLoadDefs(llvm::LoadInst* l);
+		void trackValue(llvm::Value* v);
+
+		void materialize(const Node* node, SymbolicTree& tree) const;
+		const SymbolicTree& getSimplified(Node* node);
+		static bool simplify(SymbolicTree& tree);
+
+	private:
+		/// Interned nodes.
+		std::unordered_map<Key, std::shared_ptr<Node>, KeyHash> _nodes;
+		/// Nodes of each value.
+		std::unordered_map<llvm::Value*, std::vector<Node*>> _valueNodes;
+		/// Memoized definitions reaching loads.
+		std::unordered_map<
+				llvm::LoadInst*,
+				llvm::SmallVector<llvm::Value*, 2>> _loadDefs;
+		/// Handles reporting changes of values in the nodes.
+		std::unordered_map<llvm::Value*, std::unique_ptr<ValueHandle>> _handles;
+		/// Context the nodes were created in.
+		Context _context;
+
+	friend class SymbolicTree;
+};
+
 /**
  * Tracking values through load/store operations using reaching definition
  * analysis.
  *
  * For optimization reasons, some data members of this structure are static,
- * i.e. common for all instances.
+ * i.e. common for all instances. They are thread-local, so that decompilations
+ * running in different threads do not share them -- ABI and config set by
+ * the provider initialization are valid only in the thread that set them.
  * The typical usage of this class is: creation -> simplification -> pattern
  * detection -> action based on pattern -> throwing away the current instance
  * before creating and processing the new one.
@@ -54,6 +184,16 @@ class SymbolicTree
 				llvm::Value* v,
 				unsigned maxNodeLevel = 10
 		);
+		/**
+		 * The same as the basic SymbolicTree construction method, but nodes
+		 * are shared with other trees constructed with the given cache.
+		 */
+		static SymbolicTree PrecomputedRda(
+				SymbolicTreeCache& cache,
+				ReachingDefinitionsAnalysis& rda,
+				llvm::Value* v,
+				unsigned maxNodeLevel = 10
+		);
 		/**
 		 * The same as the basic SymbolicTree construction method, but an
 		 * additional value to value mapping is used for node expansion.
@@ -79,6 +219,15 @@ class SymbolicTree
 				llvm::Value* v,
 				unsigned maxNodeLevel = 10
 		);
+		/**
+		 * The same as the on demand SymbolicTree construction method, but
+		 * nodes are shared with other trees constructed with the given cache.
+		 */
+		static SymbolicTree OnDemandRda(
+				SymbolicTreeCache& cache,
+				llvm::Value* v,
+				unsigned maxNodeLevel = 10
+		);
 		/**
 		 * A lightweight construction method where no RDA is used.
 		 * Tree is successfully constructed only if it can be fully expanded
@@ -88,6 +237,15 @@ class SymbolicTree
 				llvm::Value* v,
 				unsigned maxNodeLevel = 10
 		);
+		/**
+		 * The same as the linear SymbolicTree construction method, but nodes
+		 * are shared with other trees constructed with the given cache.
+		 */
+		static SymbolicTree Linear(
+				SymbolicTreeCache& cache,
+				llvm::Value* v,
+				unsigned maxNodeLevel = 10
+		);
 
 	// Copy/move ctors, operators, etc.
 	//
@@ -147,14 +305,16 @@ class SymbolicTree
 		static void setNaryLimit(unsigned n);
 
 	private:
-		static Abi* _abi;
-		static Config* _config;
-		static bool _val2valUsed;
-		static bool _trackThroughAllocaLoads;
-		static bool _trackThroughGeneralRegisterLoads;
-		static bool _trackOnlyFlagRegisters;
-		static bool _simplifyAtCreation;
-		static unsigned _naryLimit;
+		static thread_local Abi* _abi;
+		static thread_local Config* _config;
+		static thread_local bool _val2valUsed;
+		static thread_local bool _trackThroughAllocaLoads;
+		static thread_local bool _trackThroughGeneralRegisterLoads;
+		static thread_local bool _trackOnlyFlagRegisters;
+		static thread_local bool _simplifyAtCreation;
+		static thread_local unsigned _naryLimit;
+		/// Changed with every change of the configuration.
+		static thread_local unsigned _configuration;
 
 	// Private methods.
 	//
@@ -164,8 +324,21 @@ class SymbolicTree
 				std::map<llvm::Value*, llvm::Value*>* val2val,
 				unsigned maxNodeLevel,
 				bool linear);
+		static void expandValue(
+				llvm::Value* value,
+				llvm::function_ref<
+						llvm::ArrayRef<llvm::Value*>(llvm::LoadInst*)> loadDefs,
+				llvm::function_ref<void(llvm::Value*, llvm::Value*)> addOp,
+				llvm::function_ref<void(llvm::Value*, llvm::Value*)> replace,
+				bool linear);
+		static void findLoadDefs(
+				llvm::LoadInst* l,
+				ReachingDefinitionsAnalysis* RDA,
+				bool linear,
+				llvm::SmallVectorImpl<llvm::Value*>& defs);
 
 		void _simplifyNode();
+		void _simplifyTopNode();
 		void fixLevel(unsigned level = 0);
 
 		void _getPreOrder(std::vector<SymbolicTree*>& res) const;
@@ -175,8 +348,8 @@ class SymbolicTree
 	//
 	public:
 		/**
-		 * This is a private constructor, do not use it. It is made public only
-		 * so it can be used in std::vector<>::emplace_back().
+		 * These are private constructors, do not use them. They are made
+		 * public only so they can be used in std::vector<>::emplace_back().
 		 */
 		SymbolicTree(
 				ReachingDefinitionsAnalysis* rda,
@@ -186,11 +359,16 @@ class SymbolicTree
 				unsigned maxNodeLevel,
 				std::map<llvm::Value*, llvm::Value*>* v2v,
 				bool linear);
+		SymbolicTree(llvm::Value* v, llvm::Value* u, unsigned nodeLevel);
 
 	// Private data.
 	//
 	private:
 		unsigned _level = 1;
+		/// Interned node this tree was materialized from, if it still exists.
+		std::weak_ptr<SymbolicTreeCache::Node> _node;
+
+	friend class SymbolicTreeCache;
 };
 
 } // namespace bin2llvmir
@@ -17,6 +17,7 @@
 
 #include "retdec/common/address.h"
 #include "retdec/bin2llvmir/analyses/reaching_definitions.h"
+#include "retdec/bin2llvmir/analyses/symbolic_tree.h"
 #include "retdec/bin2llvmir/providers/abi/abi.h"
 #include "retdec/bin2llvmir/providers/config.h"
 #include "retdec/bin2llvmir/providers/debugformat.h"
@@ -42,6 +43,7 @@ class ConstantsAnalysis : public llvm::ModulePass
 		bool run();
 		void checkForGlobalInInstruction(
 				ReachingDefinitionsAnalysis& RDA,
+				SymbolicTreeCache& trees,
 				llvm::Instruction* inst,
 				llvm::Value* val,
 				bool storeValue = false);
@@ -29,11 +29,13 @@
 #include "retdec/bin2llvmir/providers/names.h"
 #include "retdec/bin2llvmir/optimizations/decoder/decoder_debug.h"
 #include "retdec/bin2llvmir/optimizations/decoder/decoder_ranges.h"
+#include "retdec/bin2llvmir/optimizations/decoder/disassembly_cache.h"
 #include "retdec/bin2llvmir/optimizations/decoder/jump_targets.h"
 #include "retdec/bin2llvmir/utils/ir_modifier.h"
 #include "retdec/bin2llvmir/utils/symbolic_tree_match.h"
 #include "retdec/capstone2llvmir/capstone2llvmir.h"
 #include "retdec/stacofin/stacofin.h"
+#include "retdec/utils/cancellation.h"
 
 namespace retdec {
 namespace bin2llvmir {
@@ -53,6 +55,8 @@ class Decoder : public llvm::ModulePass
 				NameContainer* n,
 				Abi* a);
 
+		void setCancellationFlag(const utils::CancellationFlag* cancel);
+
 	private:
 		using ByteData = typename std::pair<const std::uint8_t*, std::size_t>;
 
@@ -64,7 +68,7 @@ class Decoder : public llvm::ModulePass
 	//
 	private:
 		void initTranslator();
-		void initDryRunCsInstruction();
+		void initDisassemblyCache();
 		void initEnvironment();
 		void initEnvironmentAsm2LlvmMapping();
 		void initEnvironmentPseudoFunctions();
@@ -220,12 +224,7 @@ class Decoder : public llvm::ModulePass
 	// MIPS specific.
 	//
 	private:
-		bool disasm_mips(
-				csh ce,
-				cs_mode m,
-				ByteData& bytes,
-				uint64_t& a,
-				cs_insn* i);
+		cs_insn* disasm_mips(cs_mode m, ByteData& bytes, uint64_t& a);
 		std::size_t decodeJumpTargetDryRun_mips(
 				const JumpTarget& jt,
 				ByteData bytes,
@@ -294,11 +293,13 @@ class Decoder : public llvm::ModulePass
 		FileImage* _image = nullptr;
 		DebugFormat* _debug = nullptr;
 		NameContainer* _names = nullptr;
-		Llvm2CapstoneInsnMap* _llvm2capstone = nullptr;
+		AsmInstructionTable* _asmInstructions = nullptr;
 		Abi* _abi = nullptr;
+		/// Flag signalling that the decompilation should be stopped.
+		const utils::CancellationFlag* _cancel = nullptr;
 
 		std::unique_ptr<capstone2llvmir::Capstone2LlvmIrTranslator> _c2l;
-		cs_insn* _dryCsInsn = nullptr;
+		DisassemblyCache _disasm;
 
 		llvm::IRBuilder<>* _irb;
 
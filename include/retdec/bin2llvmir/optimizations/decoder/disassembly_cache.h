@@ -0,0 +1,96 @@
+/**
+* @file include/retdec/bin2llvmir/optimizations/decoder/disassembly_cache.h
+* @brief Cache of instructions disassembled by the decoder.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_BIN2LLVMIR_OPTIMIZATIONS_DECODER_DISASSEMBLY_CACHE_H
+#define RETDEC_BIN2LLVMIR_OPTIMIZATIONS_DECODER_DISASSEMBLY_CACHE_H
+
+#include <cstdint>
+#include <iostream>
+#include <map>
+
+#include "retdec/common/address.h"
+#include "retdec/capstone2llvmir/capstone2llvmir.h"
+
+namespace retdec {
+namespace bin2llvmir {
+
+/**
+ * Instructions disassembled by the decoder, identified by their addresses and
+ * Capstone modes.
+ *
+ * Dry runs disassemble ahead of the translation, ARM dry runs do so in both
+ * ARM and THUMB modes, and jump targets in the middle of already disassembled
+ * code disassemble it again. All of them share instructions in this cache,
+ * so each address is disassembled at most once in each mode.
+ *
+ * All the instructions are owned by the cache. Once the decoder translates
+ * or rejects a range of bytes, it does not disassemble them again, and it
+ * releases their instructions. Instructions are ordered by their addresses,
+ * so that all the instructions in a range are found at once.
+ */
+class DisassemblyCache
+{
+	public:
+		DisassemblyCache() = default;
+		DisassemblyCache(const DisassemblyCache&) = delete;
+		DisassemblyCache& operator=(const DisassemblyCache&) = delete;
+		~DisassemblyCache();
+
+		void setTranslator(capstone2llvmir::Capstone2LlvmIrTranslator* c2l);
+
+		cs_insn* disassemble(
+				const std::uint8_t*& bytes,
+				std::size_t& size,
+				std::uint64_t& address,
+				cs_mode mode);
+
+		void release(common::Address start, common::Address end);
+		void clear();
+
+	friend std::ostream& operator<<(
+			std::ostream& os,
+			const DisassemblyCache& cache);
+
+	private:
+		struct Key
+		{
+			std::uint64_t address = 0;
+			unsigned mode = 0;
+
+			bool operator<(const Key& o) const
+			{
+				return address < o.address
+						|| (address == o.address && mode < o.mode);
+			}
+		};
+		struct Entry
+		{
+			/// Disassembled instruction, or @c nullptr if there is none.
+			cs_insn* insn = nullptr;
+			/// The biggest number of bytes with which the disassembly failed.
+			/// It fails with all smaller numbers as well.
+			std::size_t failedSize = 0;
+		};
+
+	private:
+		Entry& getEntry(
+				const std::uint8_t* bytes,
+				std::size_t size,
+				std::uint64_t address,
+				cs_mode mode);
+
+	private:
+		capstone2llvmir::Capstone2LlvmIrTranslator* _c2l = nullptr;
+		std::map<Key, Entry> _entries;
+
+		std::size_t _hits = 0;
+		std::size_t _misses = 0;
+};
+
+} // namespace bin2llvmir
+} // namespace retdec
+
+#endif
@@ -56,6 +56,7 @@ class JumpTarget
 	public:
 		JumpTarget();
 		JumpTarget(
+				Config* c,
 				retdec::common::Address a,
 				eType t,
 				cs_mode m,
@@ -75,6 +76,8 @@ class JumpTarget
 	friend std::ostream& operator<<(std::ostream &out, const JumpTarget& jt);
 
 	private:
+		/// Config of the module this jump target belongs to.
+		Config* _config = nullptr;
 		// This address will be tried to be decoded.
 		retdec::common::Address _address;
 		///
@@ -85,9 +88,6 @@ class JumpTarget
 		retdec::common::Address _fromAddress;
 		/// Disassembler mode that should be used for this jump target.
 		mutable cs_mode _mode = CS_MODE_BIG_ENDIAN;
-
-	public:
-		static Config* config;
 };
 
 /**
@@ -118,7 +118,7 @@ class JumpTargets
 		std::set<JumpTarget> _data;
 
 	public:
-		static Config* config;
+		Config* config = nullptr;
 };
 
 } // namespace bin2llvmir
@@ -7,6 +7,8 @@
 #ifndef RETDEC_BIN2LLVMIR_OPTIMIZATIONS_PROVIDER_INIT_PROVIDER_INIT_H
 #define RETDEC_BIN2LLVMIR_OPTIMIZATIONS_PROVIDER_INIT_PROVIDER_INIT_H
 
+#include <memory>
+
 #include <llvm/IR/Module.h>
 #include <llvm/Pass.h>
 
@@ -17,6 +19,11 @@ namespace config {
 class Config;
 
 } // namespace config
+namespace cpdetect {
+
+class InputAnalysis;
+
+} // namespace cpdetect
 namespace bin2llvmir {
 
 class ProviderInitialization : public llvm::ModulePass
@@ -28,9 +35,13 @@ class ProviderInitialization : public llvm::ModulePass
 		virtual bool doFinalization(llvm::Module& m) override;
 
 		void setConfig(retdec::config::Config* c);
+		void setInputAnalysis(
+				const std::shared_ptr<cpdetect::InputAnalysis>& input);
 
 	private:
 		retdec::config::Config* _config = nullptr;
+		/// Already parsed and analyzed input file, may be null.
+		std::shared_ptr<cpdetect::InputAnalysis> _input;
 };
 
 } // namespace bin2llvmir
@@ -10,9 +10,11 @@
 #include <functional>
 #include <list>
 #include <map>
+#include <queue>
 #include <set>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include <llvm/IR/Function.h>
 #include <llvm/IR/Module.h>
@@ -29,6 +31,7 @@ class TypeEntry;
 class EquationEntry;
 class EqSet;
 class EqSetContainer;
+class IrModifier;
 
 /**
  * Priority of data type sources.
@@ -48,6 +51,7 @@ class ValueEntry
 {
 	public:
 		ValueEntry(llvm::Value* v = nullptr, eSourcePriority p = eSourcePriority::PRIORITY_NONE);
+		static eSourcePriority getSourcePriority(Config* config, llvm::Value* v);
 		llvm::Type* getTypeForPropagation() const;
 		bool operator==(const ValueEntry& o) const;
 		bool operator<(const ValueEntry& o) const;
@@ -133,23 +137,26 @@ class EqSet
 {
 	public:
 		EqSet(std::size_t id);
-		void insert(Config* config, llvm::Value* v, eSourcePriority p = eSourcePriority::PRIORITY_NONE);
 		void insert(llvm::Type* t, eSourcePriority p = eSourcePriority::PRIORITY_NONE);
-		void propagate(llvm::Module* module);
 		void apply(
-				llvm::Module* module,
+				IrModifier& irModif,
 				Config* config,
 				FileImage* objf,
 				std::unordered_set<llvm::Instruction*>& instToErase);
 
+		static void mergeMasterType(
+				llvm::Module* module,
+				TypeEntry& master,
+				const TypeEntry& t);
+
 		friend std::ostream& operator<<(std::ostream& out, const EqSet& eq);
 
 	private:
-		llvm::Type* getHigherPriorityType(
+		static llvm::Type* getHigherPriorityType(
 				llvm::Module* module,
 				llvm::Type* t1,
 				llvm::Type* t2);
-		llvm::Type* getHigherPriorityTypePrivate(
+		static llvm::Type* getHigherPriorityTypePrivate(
 				llvm::Module* module,
 				llvm::Type* t1,
 				llvm::Type* t2,
@@ -161,8 +168,8 @@ class EqSet
 
 		/// Type of an entire equivalence set.
 		TypeEntry masterType;
-		/// Values in the set.
-		ValueEntrySet valSet;
+		/// Values in the set, each of them only once.
+		std::vector<ValueEntry> valSet;
 		/// This allows to add certain types to set without having a value for them.
 		TypeEntrySet typeSet;
 		/// This allows to propagate type to another equivalence set, which may not
@@ -177,7 +184,6 @@ class EqSetContainer
 {
 	public:
 		EqSet& createEmptySet();
-		void propagate(llvm::Module* module);
 		void apply(
 				llvm::Module* module,
 				Config* config,
@@ -190,7 +196,48 @@ class EqSetContainer
 		std::list<EqSet> eqSets;
 };
 
-using ValueMap = std::unordered_map<llvm::Value*, EqSet*>;
+/**
+ * Disjoint sets of values which have to have the same type (union-find with
+ * path compression and union by size).
+ *
+ * Values are numbered densely in the order they are added. Master type of
+ * every set is kept up to date in its root, types of united sets are merged
+ * when they are united. Equivalence sets are created from the disjoint sets
+ * only when all of them are complete.
+ */
+class EqSetUnionFind
+{
+	public:
+		static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+		void clear();
+
+		std::size_t getId(llvm::Value* v) const;
+		std::size_t insert(llvm::Value* v, eSourcePriority p, llvm::Module* module);
+		void insert(std::size_t id, const TypeEntry& t, llvm::Module* module);
+		std::size_t find(std::size_t id);
+		std::size_t unite(std::size_t id1, std::size_t id2, llvm::Module* module);
+
+		void createEqSets(EqSetContainer& eqs);
+		EqSet* getEqSet(llvm::Value* v);
+
+	private:
+		/// Dense IDs of values.
+		std::unordered_map<llvm::Value*, std::size_t> ids;
+		/// Values indexed by their IDs.
+		std::vector<ValueEntry> values;
+		/// Parent of each value in its disjoint set, roots are their own parents.
+		std::vector<std::size_t> parents;
+		/// Number of values in sets, valid only for roots.
+		std::vector<std::size_t> sizes;
+		/// Master types of sets, valid only for roots.
+		std::vector<TypeEntry> masterTypes;
+		/// Types added to sets, with IDs of values from these sets.
+		std::vector<std::pair<std::size_t, TypeEntry>> types;
+		/// Equivalence sets created from sets, indexed by IDs of roots.
+		std::vector<EqSet*> rootEqSets;
+};
+
 using ValuePair = std::pair<llvm::Value*, llvm::Value*>;
 using ValuePairList = std::list<ValuePair>;
 
@@ -210,13 +257,13 @@ class SimpleTypesAnalysis : public llvm::ModulePass
 		void buildEqSets(llvm::Module& M);
 		void buildEquations();
 		void processRoot(llvm::Value* root);
-		void processValue(std::queue<llvm::Value*>& toProcess, EqSet& eqSet);
-		void processUse(llvm::Value* c, llvm::Value* x, std::queue<llvm::Value*>& toProcess, EqSet& eqSet);
+		void processValue(llvm::Value* current, std::queue<llvm::Value*>& toProcess, std::size_t eqClass);
+		void processUse(llvm::Value* c, llvm::Value* x, std::queue<llvm::Value*>& toProcess, std::size_t eqClass);
 		void eraseObsoleteInstructions();
 		void setGlobalConstants();
 
 	private:
-		ValueMap processedObjs;
+		EqSetUnionFind eqClasses;
 		EqSetContainer eqSets;
 		ValuePairList val2PtrVal;
 
@@ -61,7 +61,9 @@ class ValueProtect : public llvm::ModulePass
 		llvm::Module* _module = nullptr;
 		Config* _config = nullptr;
 		Abi* _abi = nullptr;
-		static std::map<llvm::Type*, llvm::Function*> _type2fnc;
+		/// Functions created for types, kept in the module's context between
+		/// the protecting and the unprotecting run.
+		std::map<llvm::Type*, llvm::Function*>* _type2fnc = nullptr;
 };
 
 } // namespace bin2llvmir
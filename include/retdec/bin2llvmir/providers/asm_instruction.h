@@ -16,14 +16,13 @@
 #include <llvm/IR/Instructions.h>
 #include <llvm/IR/Module.h>
 
+#include "retdec/bin2llvmir/providers/asm_instruction_table.h"
 #include "retdec/bin2llvmir/utils/llvm.h"
 #include "retdec/common/address.h"
 
 namespace retdec {
 namespace bin2llvmir {
 
-using Llvm2CapstoneInsnMap = typename std::map<llvm::StoreInst*, cs_insn*>;
-
 /**
  * Assembly instruction representation.
  *
@@ -84,6 +83,7 @@ class AsmInstruction
 		bool isValid() const;
 		bool isInvalid() const;
 		cs_insn* getCapstoneInsn() const;
+		cs_insn* getTemporaryCapstoneInsn() const;
 
 		std::string getDsm() const;
 		retdec::common::Address getAddress() const;
@@ -152,8 +152,7 @@ class AsmInstruction
 		}
 
 	public:
-		static Llvm2CapstoneInsnMap& getLlvmToCapstoneInsnMap(
-				const llvm::Module* m);
+		static AsmInstructionTable& getInstructionTable(const llvm::Module* m);
 		static llvm::GlobalVariable* getLlvmToAsmGlobalVariable(
 				const llvm::Module* m);
 		static void setLlvmToAsmGlobalVariable(
@@ -175,24 +174,16 @@ class AsmInstruction
 				llvm::Function* f);
 		static bool isLlvmToAsmInstruction(const llvm::Value* inst);
 		static void clear();
+		static void clear(const llvm::Module* m);
 
 	private:
 		const llvm::GlobalVariable* getLlvmToAsmGlobalVariablePrivate(
 				llvm::Module* m) const;
 		bool isLlvmToAsmInstructionPrivate(llvm::Value* inst) const;
-
-	private:
-		using ModuleGlobalPair = std::pair<
-				const llvm::Module*,
-				llvm::GlobalVariable*>;
-		using ModuleInstructionMap = std::pair<
-				const llvm::Module*,
-				std::map<llvm::StoreInst*, cs_insn*>>;
+		AsmInstructionTable* getInstructionTablePrivate() const;
 
 	private:
 		llvm::StoreInst* _llvmToAsmInstr = nullptr;
-		static std::vector<ModuleGlobalPair> _module2global;
-		static std::vector<ModuleInstructionMap> _module2instMap;
 
 	public:
 		template<
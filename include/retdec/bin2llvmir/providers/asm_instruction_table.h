@@ -0,0 +1,93 @@
+/**
+ * @file include/retdec/bin2llvmir/providers/asm_instruction_table.h
+ * @brief Compact storage of decoded assembly instructions.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_BIN2LLVMIR_PROVIDERS_ASM_INSTRUCTION_TABLE_H
+#define RETDEC_BIN2LLVMIR_PROVIDERS_ASM_INSTRUCTION_TABLE_H
+
+#include <cstdint>
+#include <unordered_map>
+
+#include <capstone/capstone.h>
+
+#include "retdec/common/address.h"
+
+namespace retdec {
+namespace bin2llvmir {
+
+/**
+ * Assembly instructions of one module indexed by their addresses.
+ *
+ * Only small fixed-size records are kept for all the decoded instructions.
+ * Capstone instructions with all their details are disassembled again from
+ * the bytes in the input image when somebody asks for them.
+ *
+ * Instructions whose disassembly depends on the preceding instructions
+ * (THUMB instructions in IT blocks) cannot be disassembled again on their
+ * own. Copies of them are kept since they are added.
+ */
+class AsmInstructionTable
+{
+	public:
+		struct Record
+		{
+			/// Bytes of the instruction in the input image.
+			const std::uint8_t* bytes = nullptr;
+			/// Capstone mode (basic and extra) the instruction was decoded in.
+			cs_mode mode = CS_MODE_LITTLE_ENDIAN;
+			/// Byte size of the instruction.
+			std::uint32_t size = 0;
+		};
+
+	public:
+		AsmInstructionTable() = default;
+		AsmInstructionTable(const AsmInstructionTable&) = delete;
+		AsmInstructionTable& operator=(const AsmInstructionTable&) = delete;
+		~AsmInstructionTable();
+
+		void setArchitecture(cs_arch arch);
+
+		void add(
+				common::Address addr,
+				const std::uint8_t* bytes,
+				std::size_t size,
+				cs_mode mode,
+				const cs_insn* insn = nullptr);
+		const Record* get(common::Address addr) const;
+		std::size_t size() const;
+
+		cs_insn* getCapstoneInsn(common::Address addr);
+		/// The returned instruction may be a scratch buffer shared by all the
+		/// callers of the table, see the definition.
+		cs_insn* getTemporaryCapstoneInsn(common::Address addr);
+
+		void clear();
+
+	private:
+		bool openHandle(cs_mode mode);
+		bool dependsOnContext(const cs_insn* insn, cs_mode mode) const;
+		cs_insn* copy(const cs_insn* insn, cs_mode mode);
+		bool disassemble(
+				common::Address addr,
+				const Record& r,
+				cs_insn*& insn);
+
+	private:
+		cs_arch _arch = CS_ARCH_ALL;
+		/// Capstone engine, opened when it is needed for the first time.
+		csh _handle = 0;
+		cs_mode _handleMode = CS_MODE_LITTLE_ENDIAN;
+
+		std::unordered_map<std::uint64_t, Record> _records;
+		/// Instructions returned by getCapstoneInsn().
+		std::unordered_map<std::uint64_t, cs_insn*> _insns;
+		/// Instruction returned by getTemporaryCapstoneInsn().
+		cs_insn* _temporary = nullptr;
+};
+
+} // namespace bin2llvmir
+} // namespace retdec
+
+#endif
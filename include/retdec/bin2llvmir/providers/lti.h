@@ -9,6 +9,7 @@
 
 #include <llvm/IR/Module.h>
 
+#include "retdec/ctypesparser/binary_ctypes_database.h"
 #include "retdec/ctypesparser/json_ctypes_parser.h"
 #include "retdec/bin2llvmir/providers/config.h"
 #include "retdec/bin2llvmir/providers/fileimage.h"
@@ -51,6 +52,8 @@ class Lti
 		retdec::loader::Image* _image = nullptr;
 		std::unique_ptr<retdec::ctypes::Module> _ltiModule;
 		ctypesparser::JSONCTypesParser _ltiParser;
+		/// Precompiled LTI files, functions are taken from them on demand.
+		std::vector<std::unique_ptr<ctypesparser::BinaryCTypesDatabase>> _ltiDatabases;
 };
 
 class LtiProvider
@@ -64,9 +67,6 @@ class LtiProvider
 		static Lti* getLti(llvm::Module* m);
 		static bool getLti(llvm::Module* m, Lti*& lti);
 		static void clear();
-
-	private:
-		static std::map<llvm::Module*, Lti> _module2lti;
 };
 
 } // namespace bin2llvmir
@@ -9,6 +9,7 @@
 
 #include <map>
 #include <set>
+#include <string_view>
 
 #include "retdec/bin2llvmir/providers/config.h"
 #include "retdec/bin2llvmir/providers/debugformat.h"
@@ -16,6 +17,7 @@
 #include "retdec/bin2llvmir/providers/fileimage.h"
 #include "retdec/bin2llvmir/providers/lti.h"
 #include "retdec/common/address.h"
+#include "retdec/utils/ordinal_database.h"
 
 namespace retdec {
 namespace bin2llvmir {
@@ -175,11 +177,15 @@ class NameContainer
 		void initFromDebug();
 		void initFromImage();
 
-		std::string getNameFromImportLibAndOrd(
+		std::string_view getNameFromImportLibAndOrd(
 				const std::string& libName,
 				int ord);
+		std::string getOrdinalsArchitecture() const;
 		bool loadImportOrds(const std::string& libName);
 
+		static const retdec::utils::OrdinalDatabase& getOrdinalDatabase(
+				const std::string& path);
+
 	private:
 		/// <ordinal number, function name>
 		using ImportOrdMap = std::map<int, std::string>;
@@ -191,7 +197,11 @@ class NameContainer
 		Lti* _lti = nullptr;
 
 		std::map<retdec::common::Address, Names> _data;
+		/// Packed ordinals of all libraries, shared by the whole process and
+		/// looked up on the first use.
+		const retdec::utils::OrdinalDatabase* _ordDatabase = nullptr;
 		/// <library name without suffix ".dll", map with ordinals>
+		/// Used only when there is no packed database.
 		std::map<std::string, ImportOrdMap> _dllOrds;
 };
 
@@ -211,9 +221,6 @@ class NamesProvider
 		static NameContainer* getNames(llvm::Module* m);
 		static bool getNames(llvm::Module* m, NameContainer*& names);
 		static void clear();
-
-	private:
-		static std::map<llvm::Module*, NameContainer> _module2names;
 };
 
 } // namespace bin2llvmir
@@ -0,0 +1,110 @@
+/**
+ * @file include/retdec/bin2llvmir/providers/provider_context.h
+ * @brief Per-module storage of all the objects managed by providers.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_BIN2LLVMIR_PROVIDERS_PROVIDER_CONTEXT_H
+#define RETDEC_BIN2LLVMIR_PROVIDERS_PROVIDER_CONTEXT_H
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <shared_mutex>
+
+#include <llvm/IR/GlobalVariable.h>
+#include <llvm/IR/Instructions.h>
+#include <llvm/IR/Module.h>
+
+namespace retdec {
+namespace bin2llvmir {
+
+class Abi;
+class AsmInstructionTable;
+class Config;
+class DebugFormat;
+class Demangler;
+class FileImage;
+class Lti;
+class NameContainer;
+
+/**
+ * All the data that used to be shared by the whole bin2llvmirl through static
+ * provider members. There is one context per LLVM module, i.e. per one
+ * decompilation. Providers are only thin facades that look up the context
+ * associated with the module they were given.
+ *
+ * The registry of contexts is thread-safe, so several decompilations (each
+ * working with its own module) can run in one process at the same time.
+ * The context itself is not synchronized -- it is expected to be used only
+ * by the thread that is processing the associated module.
+ */
+class ProviderContext
+{
+	public:
+		ProviderContext() = default;
+		ProviderContext(const ProviderContext&) = delete;
+		ProviderContext& operator=(const ProviderContext&) = delete;
+		~ProviderContext();
+
+		static ProviderContext* getContext(const llvm::Module* m);
+		static ProviderContext& createContext(const llvm::Module* m);
+		static void removeContext(const llvm::Module* m);
+		static void forEachContext(
+				const std::function<void(ProviderContext&)>& f);
+		static void clear();
+
+	// Provided objects.
+	// The order matters: objects are destroyed in the reverse order and
+	// later objects may hold pointers to the earlier ones.
+	//
+	public:
+		std::unique_ptr<Config> config;
+		std::unique_ptr<FileImage> fileImage;
+		std::unique_ptr<Demangler> demangler;
+		std::unique_ptr<DebugFormat> debugFormat;
+		std::unique_ptr<Abi> abi;
+		std::unique_ptr<Lti> lti;
+		std::unique_ptr<NameContainer> names;
+
+		/// Global variable used in LLVM to ASM mapping instructions.
+		llvm::GlobalVariable* llvmToAsmGlobal = nullptr;
+		/// Instructions of LLVM to ASM instructions, indexed by addresses.
+		std::unique_ptr<AsmInstructionTable> asmInstructions;
+
+	// State of passes which run several times on the same module and do
+	// something different in each run.
+	//
+	public:
+		/// Functions created by ValueProtect, indexed by their return types.
+		std::map<llvm::Type*, llvm::Function*> valueProtectFunctions;
+		/// Number of SimpleTypesAnalysis runs on the module.
+		std::size_t simpleTypesRuns = 0;
+		/// Number of dumps of the module written by dumpModuleToFile().
+		std::size_t moduleDumps = 0;
+
+	private:
+		/// Cache of the last successful lookup done by the current thread.
+		struct LookupCache
+		{
+			const llvm::Module* module = nullptr;
+			ProviderContext* context = nullptr;
+			std::size_t generation = 0;
+		};
+
+	private:
+		/// Mapping of modules to contexts associated with them.
+		static std::map<const llvm::Module*, std::unique_ptr<ProviderContext>>
+				_module2context;
+		static std::shared_mutex _mutex;
+		/// Incremented each time a context is removed -> invalidates caches.
+		static std::atomic<std::size_t> _generation;
+		static thread_local LookupCache _lookupCache;
+};
+
+} // namespace bin2llvmir
+} // namespace retdec
+
+#endif
@@ -0,0 +1,183 @@
+/**
+ * @file include/retdec/common/region_index.h
+ * @brief Declaration of templated RegionIndex class.
+ * @copyright (c) 2019 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_COMMON_REGION_INDEX_H
+#define RETDEC_COMMON_REGION_INDEX_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace retdec {
+namespace common {
+
+/**
+ * Index answering "which region contains this address" in O(log n).
+ *
+ * Regions may overlap. When more of them contain the same address, the
+ * winner is decided by a comparator given when the index is created, so
+ * the index gives exactly the same answers as a linear scan that uses the
+ * same rule. Internally, the address space is split into elementary
+ * intervals (between consecutive region boundaries) and the winner of each
+ * interval is precomputed.
+ *
+ * The index is immutable once created -- owners are expected to create a
+ * new one whenever their regions change. It can be safely used by several
+ * threads at once. The last found interval is remembered, so repeated
+ * lookups into the same region do not even need the binary search.
+ *
+ * @tparam T Type of objects associated with regions.
+ */
+template <typename T> class RegionIndex
+{
+public:
+	/**
+	 * One indexed region <start, end).
+	 */
+	struct Region
+	{
+		std::uint64_t start = 0;
+		std::uint64_t end = 0;
+		const T* value = nullptr;
+	};
+
+	/**
+	 * Create index of the given regions.
+	 *
+	 * @param regions Regions to index. Empty regions are never found.
+	 * @param better Strict weak ordering on regions. @c better(a,b) means
+	 *        that @c a wins over @c b if both contain some address. If
+	 *        neither region is better, the one listed first wins.
+	 */
+	template <typename Better>
+	RegionIndex(const std::vector<Region>& regions, Better better) :
+			_numberOfRegions(regions.size())
+	{
+		// Boundary events: (position, region index).
+		std::vector<std::pair<std::uint64_t, std::size_t>> events;
+		events.reserve(2 * regions.size());
+		for (std::size_t i = 0; i < regions.size(); ++i)
+		{
+			if (regions[i].start < regions[i].end)
+			{
+				events.emplace_back(regions[i].start, i);
+				events.emplace_back(regions[i].end, i);
+			}
+		}
+		std::sort(events.begin(), events.end());
+
+		auto cmp = [&regions, &better](std::size_t a, std::size_t b)
+		{
+			if (better(regions[a], regions[b]))
+				return true;
+			if (better(regions[b], regions[a]))
+				return false;
+			return a < b;
+		};
+		std::set<std::size_t, decltype(cmp)> active(cmp);
+
+		for (std::size_t i = 0; i < events.size(); )
+		{
+			auto position = events[i].first;
+			for (; i < events.size() && events[i].first == position; ++i)
+			{
+				auto r = events[i].second;
+				if (regions[r].start == position)
+					active.insert(r);
+				else
+					active.erase(r);
+			}
+
+			const T* winner = active.empty()
+					? nullptr
+					: regions[*active.begin()].value;
+			if (_entries.empty() || _entries.back().value != winner)
+				_entries.push_back({position, winner});
+		}
+	}
+
+	RegionIndex(const RegionIndex& other) :
+			_entries(other._entries),
+			_numberOfRegions(other._numberOfRegions)
+	{}
+
+	RegionIndex& operator=(const RegionIndex& other)
+	{
+		_entries = other._entries;
+		_numberOfRegions = other._numberOfRegions;
+		_lastHit = 0;
+		return *this;
+	}
+
+	/**
+	 * @return Winning region containing @a address or @c nullptr if there
+	 *         is no such region.
+	 */
+	const T* find(std::uint64_t address) const
+	{
+		if (_entries.empty() || address < _entries.front().start)
+			return nullptr;
+
+		auto i = _lastHit.load(std::memory_order_relaxed);
+		if (i < _entries.size()
+				&& _entries[i].start <= address
+				&& (i + 1 == _entries.size() || address < _entries[i + 1].start))
+		{
+			return _entries[i].value;
+		}
+
+		auto it = std::upper_bound(
+				_entries.begin(),
+				_entries.end(),
+				address,
+				[](std::uint64_t a, const Entry& e) { return a < e.start; });
+		i = std::distance(_entries.begin(), it) - 1;
+		_lastHit.store(i, std::memory_order_relaxed);
+		return _entries[i].value;
+	}
+
+	/**
+	 * @return Number of regions this index was created from.
+	 */
+	std::size_t getNumberOfRegions() const
+	{
+		return _numberOfRegions;
+	}
+
+	/**
+	 * @return End of region starting at @a start with size @a size.
+	 *         Ends that would overflow are saturated.
+	 */
+	static std::uint64_t regionEnd(std::uint64_t start, std::uint64_t size)
+	{
+		return size > std::numeric_limits<std::uint64_t>::max() - start
+				? std::numeric_limits<std::uint64_t>::max()
+				: start + size;
+	}
+
+private:
+	/**
+	 * Elementary interval from @c start up to the start of the next entry.
+	 */
+	struct Entry
+	{
+		std::uint64_t start;
+		const T* value;
+	};
+
+	std::vector<Entry> _entries;
+	std::size_t _numberOfRegions = 0;
+	mutable std::atomic<std::size_t> _lastHit{0};
+};
+
+} // namespace common
+} // namespace retdec
+
+#endif
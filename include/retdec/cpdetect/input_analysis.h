@@ -0,0 +1,60 @@
+/**
+ * @file include/retdec/cpdetect/input_analysis.h
+ * @brief Results of the analysis of one input file shared by all its users.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_CPDETECT_INPUT_ANALYSIS_H
+#define RETDEC_CPDETECT_INPUT_ANALYSIS_H
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "retdec/utils/non_copyable.h"
+#include "retdec/cpdetect/cptypes.h"
+#include "retdec/fileformat/file_format/file_format.h"
+
+namespace retdec {
+namespace cpdetect {
+
+/**
+ * InputAnalysis - one parsed input file and the tools detected in it
+ *
+ * The input is parsed only once and the tool detection is run at most once,
+ * no matter how many components (unpacker, decompiler's providers, ...) ask
+ * for it. The file format is shared, so its loaded bytes can be used
+ * instead of reading the file again.
+ */
+class InputAnalysis : private retdec::utils::NonCopyable
+{
+	private:
+		std::string path;
+		std::shared_ptr<retdec::fileformat::FileFormat> fileFormat;
+		std::optional<ReturnCode> detectionStatus;
+		ToolInformation toolInfo;
+
+		InputAnalysis(
+				const std::string &inputPath,
+				std::unique_ptr<retdec::fileformat::FileFormat> format);
+	public:
+		static std::shared_ptr<InputAnalysis> create(
+				const std::string &inputPath);
+
+		/// @name Getters
+		/// @{
+		const std::string& getPath() const;
+		const std::shared_ptr<retdec::fileformat::FileFormat>& getFileFormat() const;
+		/// @}
+
+		/// @name Detection methods
+		/// @{
+		ReturnCode detectTools();
+		const ToolInformation& getToolInformation();
+		/// @}
+};
+
+} // namespace cpdetect
+} // namespace retdec
+
+#endif
@@ -0,0 +1,54 @@
+/**
+ * @file include/retdec/cpdetect/literal_index.h
+ * @brief Index of occurrences of literals in file.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_CPDETECT_LITERAL_INDEX_H
+#define RETDEC_CPDETECT_LITERAL_INDEX_H
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace retdec {
+namespace cpdetect {
+
+/**
+ * Offsets of all occurrences of registered literals in one text
+ *
+ * All literals are searched at once in a single pass over the text
+ * (Aho-Corasick automaton), so the cost of indexing does not depend on
+ * the number of literals.
+ */
+class LiteralIndex
+{
+	private:
+		/// offsets of all occurrences of registered literals (ascending)
+		std::unordered_map<std::string, std::vector<std::size_t>> offsets;
+		/// @c true if occurrences of registered literals are indexed
+		bool built = false;
+	public:
+		/// @name Index building
+		/// @{
+		void addLiteral(const std::string &literal);
+		void build(const std::string &text);
+		/// @}
+
+		/// @name Index queries
+		/// @{
+		bool isBuilt() const;
+		bool isRegistered(const std::string &literal) const;
+		const std::vector<std::size_t>& getOffsets(
+				const std::string &literal) const;
+		std::size_t findFirst(
+				const std::string &literal,
+				std::size_t startOffset,
+				std::size_t endOffset) const;
+		/// @}
+};
+
+} // namespace cpdetect
+} // namespace retdec
+
+#endif
@@ -8,6 +8,7 @@
 #define RETDEC_CPDETECT_SEARCH_H
 
 #include "retdec/cpdetect/cptypes.h"
+#include "retdec/cpdetect/literal_index.h"
 #include "retdec/fileformat/file_format/file_format.h"
 
 namespace retdec {
@@ -42,9 +43,16 @@ class Search
 	private:
 		retdec::fileformat::FileFormat &parser;
 		/// content of file in hexadecimal string representation
-		std::string nibbles;
+		/// (created on demand if @c byteLayout is @c true)
+		mutable std::string nibbles;
 		/// content of file as plain string
 		std::string plain;
+		/// occurrences of registered strings in @c plain
+		/// (created on demand by the first query of registered string)
+		mutable LiteralIndex literals;
+		/// @c true if nibbles map directly to bytes of @c plain (two nibbles
+		/// per byte, little endian), so they are matched on bytes
+		bool byteLayout;
 		/// representation of supported relative jumps
 		std::vector<RelativeJump> jumps;
 		/// average length of one slash representation
@@ -60,6 +68,12 @@ class Search
 		bool haveSlashes() const;
 		std::size_t nibblesFromBytes(std::size_t nBytes) const;
 		std::size_t bytesFromNibbles(std::size_t nNibbles) const;
+		std::size_t getNumberOfNibbles() const;
+		char getNibble(std::size_t nibbleIndex) const;
+		bool hasNibblesOnPosition(
+				const std::string &str,
+				std::size_t nibbleOffset) const;
+		bool isIndexedString(const std::string &str) const;
 		/// @}
 	public:
 		Search(retdec::fileformat::FileFormat &fileParser);
@@ -110,10 +124,19 @@ class Search
 				Similarity &sim,
 				std::size_t startOffset,
 				std::size_t stopOffset) const;
+		bool mayBeSimilar(
+				const std::string &signPattern,
+				std::size_t startOffset,
+				std::size_t stopOffset,
+				double minRatio) const;
 		/// @}
 
 		/// @name Search methods based on plain-string comparison
 		/// @{
+		void registerStrings(const std::vector<std::string> &strs);
+		std::size_t findString(
+				const std::string &str,
+				std::size_t startOffset) const;
 		bool hasString(const std::string &str) const;
 		bool hasString(const std::string &str, std::size_t fileOffset) const;
 		bool hasString(
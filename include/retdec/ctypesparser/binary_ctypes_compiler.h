@@ -0,0 +1,21 @@
+/**
+* @file include/retdec/ctypesparser/binary_ctypes_compiler.h
+* @brief Compiler of C-types from JSON to binary databases.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_CTYPESPARSER_BINARY_CTYPES_COMPILER_H
+#define RETDEC_CTYPESPARSER_BINARY_CTYPES_COMPILER_H
+
+#include <istream>
+#include <ostream>
+
+namespace retdec {
+namespace ctypesparser {
+
+void compileJsonCTypes(std::istream &json, std::ostream &database);
+
+} // namespace ctypesparser
+} // namespace retdec
+
+#endif
@@ -0,0 +1,97 @@
+/**
+* @file include/retdec/ctypesparser/binary_ctypes_database.h
+* @brief Reader of binary C-types databases.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_CTYPESPARSER_BINARY_CTYPES_DATABASE_H
+#define RETDEC_CTYPESPARSER_BINARY_CTYPES_DATABASE_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "retdec/ctypesparser/ctypes_parser.h"
+#include "retdec/utils/mapped_file.h"
+
+namespace retdec {
+namespace ctypesparser {
+
+namespace binary {
+struct Header;
+struct TypeRecord;
+struct FunctionRecord;
+} // namespace binary
+
+/**
+* @brief Lazy reader of C-types compiled by @c compileJsonCTypes().
+*
+* The database is mapped into memory and C-types objects are created only for
+* the requested functions and types they use. Created functions and types are
+* the same as the ones created by @c JSONCTypesParser from the source JSON.
+*/
+class BinaryCTypesDatabase: public CTypesParser
+{
+	public:
+		BinaryCTypesDatabase();
+		BinaryCTypesDatabase(unsigned defaultBitWidth);
+
+		bool load(
+			const std::string &path,
+			const std::shared_ptr<retdec::ctypes::Context> &context,
+			const TypeWidths &typeWidths = {},
+			const retdec::ctypes::CallConvention &callConvention = retdec::ctypes::CallConvention());
+		bool isLoaded() const;
+
+		std::size_t getFunctionCount() const;
+		bool hasFunction(const std::string &name) const;
+		std::shared_ptr<retdec::ctypes::Function> getFunction(
+			const std::string &name);
+
+		static std::string getDatabasePath(const std::string &jsonPath);
+
+	private:
+		bool checkLayout() const;
+		std::uint32_t findFunction(const std::string &name) const;
+		std::string getString(std::uint32_t offset) const;
+		std::string getStringOr(
+			std::uint32_t offset,
+			const std::string &defaultValue) const;
+		const std::uint32_t *getList(
+			std::uint32_t begin,
+			std::uint32_t count,
+			std::uint32_t wordsPerItem) const;
+
+		/// @name Creation of C-types.
+		/// @{
+		std::shared_ptr<retdec::ctypes::Type> getType(std::uint32_t index);
+		std::shared_ptr<retdec::ctypes::Type> createType(
+			const binary::TypeRecord &record);
+		std::shared_ptr<retdec::ctypes::Type> createTypedefedType(
+			const binary::TypeRecord &record);
+		std::shared_ptr<retdec::ctypes::Type> createNamedType(
+			const binary::TypeRecord &record);
+		std::shared_ptr<retdec::ctypes::Type> createFunctionType(
+			const binary::TypeRecord &record);
+		retdec::ctypes::CompositeType::Members createMembers(
+			const binary::TypeRecord &record);
+		/// @}
+
+	private:
+		/// Mapped database.
+		retdec::utils::MappedFile file;
+		/// Header of the mapped database, @c nullptr if nothing is loaded.
+		const binary::Header *header = nullptr;
+		/// Already created types, indexed like type records.
+		std::vector<std::shared_ptr<retdec::ctypes::Type>> types;
+		/// Names of typedefs being created, to break cycles.
+		std::vector<std::string> typedefsInProgress;
+		/// Call convention used when database does not contain one.
+		retdec::ctypes::CallConvention defaultCallConv;
+};
+
+} // namespace ctypesparser
+} // namespace retdec
+
+#endif
@@ -66,12 +66,26 @@ enum class Architecture
 	MIPS
 };
 
+/**
+ * Flags for configurable file loading
+ *
+ * Parts of the file selected by @c LOAD_* flags are parsed while the file
+ * is being loaded. The other parts are parsed on the first access.
+ */
 enum LoadFlags
 {
 	NONE              = 0,
 	NO_FILE_HASHES    = 1,
 	NO_VERBOSE_HASHES = 2,
-	DETECT_STRINGS    = 4
+	DETECT_STRINGS    = 4,
+	LOAD_RICH_HEADER  = 8,
+	LOAD_RESOURCES    = 16,
+	LOAD_CERTIFICATES = 32,
+	LOAD_DOTNET       = 64,
+	LOAD_VISUAL_BASIC = 128,
+	LOAD_ANOMALIES    = 256,
+	LOAD_ALL          = LOAD_RICH_HEADER | LOAD_RESOURCES | LOAD_CERTIFICATES
+			| LOAD_DOTNET | LOAD_VISUAL_BASIC | LOAD_ANOMALIES
 };
 
 } // namespace fileformat
@@ -7,15 +7,22 @@
 #ifndef RETDEC_FILEFORMAT_FILE_FORMAT_FILE_FORMAT_H
 #define RETDEC_FILEFORMAT_FILE_FORMAT_FILE_FORMAT_H
 
+#include <array>
 #include <fstream>
+#include <functional>
 #include <initializer_list>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <set>
 #include <utility>
 #include <vector>
 
+#include "retdec/common/region_index.h"
 #include "retdec/utils/byte_value_storage.h"
+#include "retdec/utils/byte_view.h"
+#include "retdec/utils/mapped_file.h"
 #include "retdec/utils/non_copyable.h"
 #include "retdec/fileformat/fftypes.h"
 #include "retdec/fileformat/utils/byte_array_buffer.h"
@@ -41,15 +48,24 @@ struct LoaderErrorInfo
 class FileFormat : public retdec::utils::ByteValueStorage, private retdec::utils::NonCopyable
 {
 	private:
+		retdec::utils::MappedFile mappedFile;    ///< input file mapped into memory
 		byte_array_buffer auxBuff;               ///< auxiliary input buffer
 		std::ifstream auxFStream;                ///< auxiliary input file stream
 		std::istream auxIStream;                 ///< auxiliary input stream
+		std::vector<unsigned char> ownedBytes;   ///< content of input file if it could not be mapped
 		std::vector<unsigned char> *loadedBytes; ///< reference to serialized content of input file
 		LoadFlags loadFlags;                     ///< load flags for configurable file loading
+		/// address to section index, created lazily on the first lookup
+		mutable std::shared_ptr<const retdec::common::RegionIndex<Section>> sectionIndex;
+		/// address to segment index, created lazily on the first lookup
+		mutable std::shared_ptr<const retdec::common::RegionIndex<Segment>> segmentIndex;
+		/// guards of parts of the file which are loaded on the first access
+		mutable std::array<std::once_flag, 6> deferredParts;
 
 		/// @name Initialization methods
 		/// @{
 		void init();
+		void initBytes();
 		void initStream();
 		/// @}
 
@@ -71,8 +87,8 @@ class FileFormat : public retdec::utils::ByteValueStorage, private retdec::utils
 		std::vector<SymbolTable*> symbolTables;                           ///< symbol tables
 		std::vector<RelocationTable*> relocationTables;                   ///< relocation tables
 		std::vector<DynamicTable*> dynamicTables;                         ///< tables with dynamic records
-		std::vector<unsigned char> bytes;                                 ///< content of file as bytes
-		std::vector<String> strings;                                      ///< detected strings
+		retdec::utils::ByteView bytes;                                    ///< content of file as bytes
+		std::vector<StringRecord> strings;                                ///< detected strings
 		std::vector<ElfNoteSecSeg> noteSecSegs;                           ///< note sections or segemnts found in ELF file
 		std::set<std::uint64_t> unknownRelocs;                            ///< unknown relocations
 		ImportTable *importTable;                                         ///< table of imports
@@ -95,6 +111,7 @@ class FileFormat : public retdec::utils::ByteValueStorage, private retdec::utils
 		/// @name Clear methods
 		/// @{
 		void clear();
+		void invalidateAddressIndexes();
 		/// @}
 
 		/// @name Protected detection methods
@@ -102,9 +119,17 @@ class FileFormat : public retdec::utils::ByteValueStorage, private retdec::utils
 		void computeSectionTableHashes();
 		/// @}
 
+		/// @name Deferred loading methods
+		/// @{
+		void loadRequestedParts();
+		void ensureLoaded(LoadFlags part) const;
+		virtual void loadDeferredPart(LoadFlags part);
+		/// @}
+
 		/// @name Setters
 		/// @{
 		void setLoadedBytes(std::vector<unsigned char> *lBytes);
+		void appendBytes(const unsigned char *data, std::size_t size);
 		/// @}
 
 	public:
@@ -122,8 +147,8 @@ class FileFormat : public retdec::utils::ByteValueStorage, private retdec::utils
 				retdec::common::Address entryPoint = retdec::common::Address::Undefined,
 				retdec::common::Address sectionVMA = retdec::common::Address::Undefined);
 		void loadStrings();
-		void loadStrings(StringType type, std::size_t charSize);
-		void loadStrings(StringType type, std::size_t charSize, const SecSeg* secSeg);
+		void scanStrings(const std::function<void(const StringRecord&)> &callback) const;
+		void scanStrings(const SecSeg* secSeg, const std::function<void(const StringRecord&)> &callback) const;
 		void loadImpHash();
 		void loadExpHash();
 		void loadResourceIconHash();
@@ -259,11 +284,11 @@ class FileFormat : public retdec::utils::ByteValueStorage, private retdec::utils
 		const std::vector<SymbolTable*>& getSymbolTables() const;
 		const std::vector<RelocationTable*>& getRelocationTables() const;
 		const std::vector<DynamicTable*>& getDynamicTables() const;
-		const std::vector<unsigned char>& getBytes() const;
-		const std::vector<unsigned char>& getLoadedBytes() const;
+		retdec::utils::ByteView getBytes() const;
+		retdec::utils::ByteView getLoadedBytes() const;
 		const unsigned char* getBytesData() const;
 		const unsigned char* getLoadedBytesData() const;
-		const std::vector<String>& getStrings() const;
+		const std::vector<StringRecord>& getStrings() const;
 		const std::vector<ElfNoteSecSeg>& getElfNoteSecSegs() const;
 		const std::set<std::uint64_t>& getUnknownRelocations() const;
 		const std::vector<std::pair<std::string,std::string>> &getAnomalies() const;
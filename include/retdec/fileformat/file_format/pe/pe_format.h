@@ -60,6 +60,11 @@ class PeFormat : public FileFormat
 		virtual std::size_t initSectionTableHashOffsets() override;
 		/// @}
 
+		/// @name Virtual deferred loading methods
+		/// @{
+		virtual void loadDeferredPart(LoadFlags part) override;
+		/// @}
+
 		/// @name Auxiliary methods
 		/// @{
 		std::size_t getRichHeaderOffset(const std::string &plainFile);
@@ -81,6 +86,7 @@ class PeFormat : public FileFormat
 		/// @name .NET methods
 		/// @{
 		void loadDotnetHeaders();
+		bool hasValidDotnetHeaders() const;
 		void parseMetadataStream(std::uint64_t baseAddress, std::uint64_t offset, std::uint64_t size);
 		void parseBlobStream(std::uint64_t baseAddress, std::uint64_t offset, std::uint64_t size);
 		void parseGuidStream(std::uint64_t baseAddress, std::uint64_t offset, std::uint64_t size);
@@ -124,9 +124,8 @@ class RawDataFormat : public FileFormat
 			const auto *pd = reinterpret_cast<const unsigned char*>(&d);
 			assert(pd && "Invalid data");
 			assert(section && "Section must be initialized in constructor");
-			std::vector<unsigned char> aBytes(pd, pd + sizeof(d));
 			const auto pos = bytes.size();
-			bytes.insert(bytes.end(), aBytes.begin(), aBytes.end());
+			appendBytes(pd, sizeof(d));
 			section->setSizeInFile(bytes.size());
 			section->setSizeInMemory(bytes.size());
 			section->load(this);
@@ -11,6 +11,7 @@
 #include <unordered_map>
 
 #include "retdec/fileformat/types/dotnet_headers/stream.h"
+#include "retdec/utils/byte_view.h"
 
 namespace retdec {
 namespace fileformat {
@@ -23,6 +24,7 @@ class BlobStream : public Stream
 		BlobStream(std::vector<std::uint8_t> data, std::uint64_t streamOffset, std::uint64_t streamSize);
 
 		std::vector<std::uint8_t> getElement(std::size_t offset) const;
+		retdec::utils::ByteView getElementView(std::size_t offset) const;
 };
 
 } // namespace fileformat
@@ -22,7 +22,7 @@ class DotnetTypeReconstructor
 		using ClassTable = std::map<std::size_t, std::shared_ptr<DotnetClass>>;
 		using ClassToMethodTable = std::unordered_map<const DotnetClass*, std::vector<std::unique_ptr<DotnetMethod>>>;
 		using MethodTable = std::map<std::size_t, DotnetMethod*>;
-		using SignatureTable = std::map<const DotnetMethod*, std::vector<std::uint8_t>>;
+		using SignatureTable = std::map<const DotnetMethod*, retdec::utils::ByteView>;
 
 		DotnetTypeReconstructor(const MetadataStream* metadata, const StringStream* strings, const BlobStream* blob);
 
@@ -50,17 +50,17 @@ class DotnetTypeReconstructor
 		std::unique_ptr<DotnetField> createField(const Field* field, const DotnetClass* ownerClass);
 		std::unique_ptr<DotnetProperty> createProperty(const Property* property, const DotnetClass* ownerClass);
 		std::unique_ptr<DotnetMethod> createMethod(const MethodDef* methodDef, const DotnetClass* ownerClass);
-		std::unique_ptr<DotnetParameter> createMethodParameter(std::size_t paramIdx, std::size_t startIdx, const DotnetClass* ownerClass, const DotnetMethod* ownerMethod, std::vector<std::uint8_t>& signature);
+		std::unique_ptr<DotnetParameter> createMethodParameter(std::size_t paramIdx, std::size_t startIdx, const DotnetClass* ownerClass, const DotnetMethod* ownerMethod, retdec::utils::ByteView& signature);
 
-		template <typename T> std::unique_ptr<T> createDataTypeFollowedByReference(std::vector<std::uint8_t>& data);
-		template <typename T> std::unique_ptr<T> createDataTypeFollowedByType(std::vector<std::uint8_t>& data, const DotnetClass* ownerClass, const DotnetMethod* ownerMethod);
-		template <typename T, typename U> std::unique_ptr<T> createGenericReference(std::vector<std::uint8_t>& data, const U* owner);
-		std::unique_ptr<DotnetDataTypeGenericInst> createGenericInstantiation(std::vector<std::uint8_t>& data, const DotnetClass* ownerClass, const DotnetMethod* ownerMethod);
-		std::unique_ptr<DotnetDataTypeArray> createArray(std::vector<std::uint8_t>& data, const DotnetClass* ownerClass, const DotnetMethod* ownerMethod);
-		template <typename T> std::unique_ptr<T> createModifier(std::vector<std::uint8_t>& data, const DotnetClass* ownerClass, const DotnetMethod* ownerMethod);
-		std::unique_ptr<DotnetDataTypeFnPtr> createFnPtr(std::vector<std::uint8_t>& data, const DotnetClass* ownerClass, const DotnetMethod* ownerMethod);
+		template <typename T> std::unique_ptr<T> createDataTypeFollowedByReference(retdec::utils::ByteView& data);
+		template <typename T> std::unique_ptr<T> createDataTypeFollowedByType(retdec::utils::ByteView& data, const DotnetClass* ownerClass, const DotnetMethod* ownerMethod);
+		template <typename T, typename U> std::unique_ptr<T> createGenericReference(retdec::utils::ByteView& data, const U* owner);
+		std::unique_ptr<DotnetDataTypeGenericInst> createGenericInstantiation(retdec::utils::ByteView& data, const DotnetClass* ownerClass, const DotnetMethod* ownerMethod);
+		std::unique_ptr<DotnetDataTypeArray> createArray(retdec::utils::ByteView& data, const DotnetClass* ownerClass, const DotnetMethod* ownerMethod);
+		template <typename T> std::unique_ptr<T> createModifier(retdec::utils::ByteView& data, const DotnetClass* ownerClass, const DotnetMethod* ownerMethod);
+		std::unique_ptr<DotnetDataTypeFnPtr> createFnPtr(retdec::utils::ByteView& data, const DotnetClass* ownerClass, const DotnetMethod* ownerMethod);
 
-		std::unique_ptr<DotnetDataTypeBase> dataTypeFromSignature(std::vector<std::uint8_t>& signature, const DotnetClass* ownerClass, const DotnetMethod* ownerMethod);
+		std::unique_ptr<DotnetDataTypeBase> dataTypeFromSignature(retdec::utils::ByteView& signature, const DotnetClass* ownerClass, const DotnetMethod* ownerMethod);
 
 		const DotnetClass* selectClass(const TypeDefOrRef& typeDefOrRef) const;
 
@@ -13,6 +13,8 @@
 namespace retdec {
 namespace fileformat {
 
+class SecSeg;
+
 enum class StringType
 {
 	Ascii,
@@ -57,6 +59,40 @@ class String
 		bool operator!=(const String& rhs) const;
 };
 
+/**
+ * String found in section or segment
+ *
+ * Record does not hold content of the string, it refers to data of the section
+ * or segment instead. Content is read from there only when it is requested.
+ */
+class StringRecord
+{
+	private:
+		const SecSeg *secSeg;
+		std::uint64_t fileOffset;
+		std::uint64_t length;
+		StringType type;
+		bool bigEndian;
+	public:
+		StringRecord(const SecSeg *secSeg, std::uint64_t fileOffset, std::uint64_t length, StringType type, bool bigEndian = false)
+			: secSeg(secSeg), fileOffset(fileOffset), length(length), type(type), bigEndian(bigEndian) {}
+
+		StringType getType() const;
+		std::uint64_t getFileOffset() const;
+		std::uint64_t getLength() const;
+		const SecSeg* getSecSeg() const;
+		std::string getSectionName() const;
+		std::string getContent() const;
+		String toString() const;
+
+		bool isAscii() const;
+		bool isWide() const;
+
+		bool operator<(const StringRecord& rhs) const;
+		bool operator==(const StringRecord& rhs) const;
+		bool operator!=(const StringRecord& rhs) const;
+};
+
 } // namespace fileformat
 } // namespace retdec
 
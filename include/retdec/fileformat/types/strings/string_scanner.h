@@ -0,0 +1,37 @@
+/**
+ * @file include/retdec/fileformat/types/strings/string_scanner.h
+ * @brief Detection of strings in raw data.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_FILEFORMAT_TYPES_STRINGS_STRING_SCANNER_H
+#define RETDEC_FILEFORMAT_TYPES_STRINGS_STRING_SCANNER_H
+
+#include <cstdint>
+#include <functional>
+
+#include "retdec/fileformat/types/strings/character_iterator.h"
+#include "retdec/fileformat/types/strings/string.h"
+
+namespace retdec {
+namespace fileformat {
+
+/**
+ * Called for every string found by @c scanStrings()
+ *
+ * Arguments are offset of the string in the scanned data, number of its
+ * characters and its type.
+ */
+using StringScanCallback = std::function<void(std::size_t, std::size_t, StringType)>;
+
+void scanStrings(
+		const std::uint8_t *data,
+		std::size_t size,
+		CharacterEndianness endian,
+		std::size_t minLength,
+		const StringScanCallback &callback);
+
+} // namespace fileformat
+} // namespace retdec
+
+#endif
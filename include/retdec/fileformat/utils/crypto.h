@@ -8,11 +8,56 @@
 #define RETDEC_FILEFORMAT_UTILS_CRYPTO_H
 
 #include <cstdint>
+#include <memory>
 #include <string>
 
 namespace retdec {
 namespace fileformat {
 
+/**
+ * Computes several digests of the same data in one pass
+ *
+ * Data are processed in blocks small enough to stay in cache while all the
+ * selected digests are updated, so the input is read from memory only once.
+ * Data may be added in more calls, the digests are finished on the first
+ * call of a getter.
+ */
+class MultiDigest
+{
+	public:
+		/// Supported digests
+		enum Digest : unsigned
+		{
+			CRC32   = 1,
+			MD5     = 2,
+			SHA1    = 4,
+			SHA256  = 8,
+			ENTROPY = 16,
+			DEFAULT = CRC32 | MD5 | SHA256
+		};
+
+		explicit MultiDigest(unsigned digests = DEFAULT);
+		MultiDigest(const unsigned char *data, std::uint64_t length, unsigned digests = DEFAULT);
+		~MultiDigest();
+
+		void add(const unsigned char *data, std::uint64_t length);
+
+		/// @name Getters
+		/// @{
+		std::string getCrc32();
+		std::string getMd5();
+		std::string getSha1();
+		std::string getSha256();
+		double getEntropy();
+		/// @}
+	private:
+		struct State;
+		std::unique_ptr<State> state; ///< contexts of selected digests
+		unsigned selected;            ///< selected digests
+
+		void finish();
+};
+
 std::string getCrc32(const unsigned char *data, std::uint64_t length);
 std::string getMd5(const unsigned char *data, std::uint64_t length);
 std::string getSha1(const unsigned char *data, std::uint64_t length);
@@ -21,4 +66,4 @@ std::string getSha256(const unsigned char *data, std::uint64_t length);
 } // namespace fileformat
 } // namespace retdec
 
-#endif
\ No newline at end of file
+#endif
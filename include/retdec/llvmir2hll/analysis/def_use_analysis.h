@@ -8,10 +8,11 @@
 #define RETDEC_LLVMIR2HLL_ANALYSIS_DEF_USE_ANALYSIS_H
 
 #include <functional>
-#include <map>
-#include <set>
+#include <unordered_map>
 #include <vector>
 
+#include <llvm/ADT/BitVector.h>
+
 #include "retdec/llvmir2hll/graphs/cfg/cfg.h"
 #include "retdec/llvmir2hll/support/smart_ptr.h"
 #include "retdec/utils/non_copyable.h"
@@ -23,7 +24,6 @@ class CFGBuilder;
 class Function;
 class Module;
 class ValueAnalysis;
-class VarUsesVisitor;
 class Variable;
 
 /**
@@ -37,18 +37,20 @@ public:
 	/// (statement, variable) pair
 	using StmtVarPair = std::pair<ShPtr<Statement>, ShPtr<Variable>>;
 
-	/// Set of (statement, variable) pairs.
-	using StmtVarPairSet = std::set<StmtVarPair>;
-
-	/// Mapping of a CFG node into a set of (statement, variable) pairs.
-	using NodePairMap = std::map<ShPtr<CFG::Node>, StmtVarPairSet>;
+	/// Set of uses, given by their indexes in @c uses (one bit per use).
+	using UseSet = llvm::BitVector;
 
 	/// A def-use chain (see [ItC]).
 	// Implementation note: we have to use std::vector instead of std::map to
-	// make the chain deterministic.
+	// make the chain deterministic. Only the computation works on numbered
+	// uses, the chains themselves are still statement sets ordered by
+	// pointers. Users that need a deterministic order have to sort them (see
+	// CopyPropagationOptimizer).
 	using DefUseChain = std::vector<std::pair<StmtVarPair, StmtSet>>;
 
 public:
+	std::size_t getNodeIndex(ShPtr<CFG::Node> node) const;
+
 	void debugPrint();
 
 public:
@@ -66,33 +68,54 @@ public:
 	/// <tt>DU(s, x)</tt> set in [ItC]).
 	DefUseChain du;
 
-	/// Mapping of a CFG node @c B into the following set:
+	/// All uses @c (s, x) in @c cfg, where @c s reads an included variable
+	/// @c x. They are numbered in the order of nodes of @c cfg and statements
+	/// in them.
+	std::vector<StmtVarPair> uses;
+
+	/// Included variables, numbered in the order of their first use in
+	/// @c uses.
+	std::vector<ShPtr<Variable>> vars;
+
+	/// Indexes of variables in @c vars.
+	std::unordered_map<ShPtr<Variable>, std::size_t> varIndexes;
+
+	/// Indexes of uses of the variable with index @c i are
+	/// <tt>varUses[varUsesBegins[i]]</tt> to
+	/// <tt>varUses[varUsesBegins[i + 1] - 1]</tt> (ascending).
+	std::vector<std::size_t> varUses;
+	std::vector<std::size_t> varUsesBegins;
+
+	/// Indexes of nodes of @c cfg (in the order of their iteration).
+	std::unordered_map<ShPtr<CFG::Node>, std::size_t> nodeIndexes;
+
+	/// For the node with index @c i, the following set:
 	/// @code
 	/// {(s, x) | s \notin B uses x and B defines x}
 	/// @endcode
 	/// (The @c KILL[B] set from Definition 27 in [ItC].)
-	NodePairMap kill;
+	std::vector<UseSet> kill;
 
-	/// Mapping of a CFG node @c B into the following set:
+	/// For the node with index @c i, the following set:
 	/// @code
 	/// {(s, x) | s \in B uses x and x is not defined prior to s in B}
 	/// @endcode
 	/// (The @c GEN[B] set from Definition 27 in [ItC].)
-	NodePairMap gen;
+	std::vector<UseSet> gen;
 
-	/// Mapping of a CFG node @c B into the following set:
+	/// For the node with index @c i, the following set:
 	/// @code
 	/// {(s, x) | s uses x and s is reachable from the beginning of B}
 	/// @endcode
 	/// (The @c IN[B] set from Definition 27 in [ItC].)
-	NodePairMap in;
+	std::vector<UseSet> in;
 
-	/// Mapping of a CFG node @c B into the following set:
+	/// For the node with index @c i, the following set:
 	/// @code
 	/// {(s, x) | s \notin B uses x and s is reachable from the end of B}
 	/// @endcode
 	/// (The @c OUT[B] set from Definition 27 in [ItC].)
-	NodePairMap out;
+	std::vector<UseSet> out;
 };
 
 /**
@@ -119,18 +142,19 @@ public:
 	);
 
 	static ShPtr<DefUseAnalysis> create(ShPtr<Module> module,
-		ShPtr<ValueAnalysis> va, ShPtr<VarUsesVisitor> vuv = nullptr);
+		ShPtr<ValueAnalysis> va);
 
 private:
-	DefUseAnalysis(ShPtr<Module> module,
-		ShPtr<ValueAnalysis> va, ShPtr<VarUsesVisitor> vuv = nullptr);
+	DefUseAnalysis(ShPtr<Module> module, ShPtr<ValueAnalysis> va);
 
+	void computeUses(ShPtr<DefUseChains> ducs);
 	void computeGenAndKill(ShPtr<DefUseChains> ducs);
 	void computeGenAndKillForNode(ShPtr<DefUseChains> ducs,
-		ShPtr<CFG::Node> node);
+		ShPtr<CFG::Node> node, std::size_t &firstUse,
+		llvm::BitVector &isDefined);
 	void computeInAndOut(ShPtr<DefUseChains> ducs);
 	bool computeInAndOutForNode(ShPtr<DefUseChains> ducs,
-		ShPtr<CFG::Node> node);
+		ShPtr<CFG::Node> node, DefUseChains::UseSet &newOut);
 	void computeDefUseChains(ShPtr<DefUseChains> ducs);
 	void computeDefUseChainForNode(ShPtr<DefUseChains> ducs,
 		ShPtr<CFG::Node> node);
@@ -146,9 +170,6 @@ private:
 	/// Analysis of used values.
 	ShPtr<ValueAnalysis> va;
 
-	/// Visitor for obtaining uses of variables.
-	ShPtr<VarUsesVisitor> vuv;
-
 	/// The used builder of CFGs.
 	ShPtr<CFGBuilder> cfgBuilder;
 };
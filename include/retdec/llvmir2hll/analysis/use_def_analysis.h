@@ -36,7 +36,7 @@ public:
 	using StmtVarPairSet = std::set<VarStmtPair>;
 
 	/// Mapping of a pair (variable, statement) to a set of statements (a
-	/// use-def chain).
+	/// use-def chain). Both are ordered by pointers, not deterministically.
 	using UseDefChain = std::map<VarStmtPair, StmtSet>;
 
 public:
@@ -179,6 +179,11 @@ public:
 	StringSet getSelectedButNotFoundFuncs() const;
 	/// @}
 
+	/// @name Debugging
+	/// @{
+	unsigned getNextDumpNumber();
+	/// @}
+
 private:
 	/// Mapping of a function into an address range.
 	using FuncAddressRangeMap = std::map<ShPtr<Function>, AddressRange>;
@@ -205,6 +210,9 @@ private:
 	/// Mapping of a variable into its name in the debug information.
 	VarStringMap debugVarNameMap;
 
+	/// Number of dumps of the module written so far.
+	unsigned dumpsCount = 0;
+
 private:
 	bool hasFuncSatisfyingPredicate(
 		std::function<bool (ShPtr<Function>)> pred
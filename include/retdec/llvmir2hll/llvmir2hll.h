@@ -73,6 +73,7 @@
 #include "retdec/llvmir2hll/var_name_gen/var_name_gens/num_var_name_gen.h"
 #include "retdec/llvmir2hll/var_renamer/var_renamer.h"
 #include "retdec/llvmir2hll/var_renamer/var_renamer_factory.h"
+#include "retdec/utils/cancellation.h"
 #include "retdec/utils/container.h"
 #include "retdec/utils/conversion.h"
 #include "retdec/utils/memory.h"
@@ -110,8 +111,10 @@ public:
 
 	void setConfig(retdec::config::Config* c);
 	void setOutputString(std::string* outString);
+	void setCancellationFlag(const utils::CancellationFlag* cancel);
 
 private:
+	void startPhase(const std::string &name);
 	bool initialize(llvm::Module &m);
 	void createSemantics();
 	void createSemanticsFromParameter();
@@ -180,6 +183,9 @@ private:
 
 	/// Output string stream.
 	std::unique_ptr<llvm::raw_string_ostream> outStringStream;
+
+	/// Flag signalling that the decompilation should be stopped.
+	const utils::CancellationFlag* cancellationFlag = nullptr;
 };
 
 } // namespace llvmir2hll
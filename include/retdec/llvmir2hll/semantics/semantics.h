@@ -9,6 +9,7 @@
 
 #include <optional>
 #include <string>
+#include <string_view>
 
 #include "retdec/llvmir2hll/support/types.h"
 #include "retdec/utils/non_copyable.h"
@@ -28,6 +29,9 @@ namespace llvmir2hll {
 *  - create a static create() function and register the semantics at
 *    SemanticsFactory (see the implementation of existing subclasses)
 *
+* Names returned as @c std::string_view have to refer to statically allocated
+* data (e.g. tables of semantics), so they stay valid after the call.
+*
 * Instances of this class have reference object semantics.
 */
 class Semantics: private retdec::utils::NonCopyable {
@@ -54,7 +58,7 @@ public:
 	* For example, semantics describing the standard C library may return
 	* @c "stdio.h" for @c "printf".
 	*/
-	virtual std::optional<std::string> getCHeaderFileForFunc(
+	virtual std::optional<std::string_view> getCHeaderFileForFunc(
 		const std::string &funcName) const = 0;
 
 	/**
@@ -81,7 +85,7 @@ public:
 	* For example, semantics describing the standard C library may return
 	* @c "c" for @c "getchar".
 	*/
-	virtual std::optional<std::string> getNameOfVarStoringResult(
+	virtual std::optional<std::string_view> getNameOfVarStoringResult(
 		const std::string &funcName) const = 0;
 
 	/**
@@ -95,14 +99,16 @@ public:
 	* For example, semantics describing the standard C library may return
 	* @c "file_path" for the first parameter of @c "fopen".
 	*/
-	virtual std::optional<std::string> getNameOfParam(const std::string &funcName,
-		unsigned paramPos) const = 0;
+	virtual std::optional<std::string_view> getNameOfParam(
+		const std::string &funcName, unsigned paramPos) const = 0;
 
 	/**
 	* @brief Returns a mapping of integers into their symbolic names for the
 	*        given parameter of the given function.
 	*
-	* @return @c map if the mapping is known, @c std::nullopt otherwise.
+	* @return Pointer to the mapping if it is known, @c nullptr otherwise. The
+	*         mapping is owned by the semantics and lives until the end of the
+	*         program, so a lookup does not copy it.
 	*
 	* @param[in] funcName Name of the function.
 	* @param[in] paramPos Position of the parameter.
@@ -116,7 +122,7 @@ public:
 	* @endcode
 	* for @c "flock" and @c 2.
 	*/
-	virtual std::optional<IntStringMap> getSymbolicNamesForParam(
+	virtual const IntStringMap *getSymbolicNamesForParam(
 		const std::string &funcName, unsigned paramPos) const = 0;
 
 protected:
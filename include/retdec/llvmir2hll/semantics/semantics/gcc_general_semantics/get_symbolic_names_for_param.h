@@ -18,7 +18,7 @@ namespace llvmir2hll {
 namespace semantics {
 namespace gcc_general {
 
-std::optional<IntStringMap> getSymbolicNamesForParam(const std::string &funcName,
+const IntStringMap *getSymbolicNamesForParam(const std::string &funcName,
 	unsigned paramPos);
 
 } // namespace gcc_general
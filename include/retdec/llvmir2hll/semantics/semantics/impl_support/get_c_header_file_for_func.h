@@ -7,33 +7,32 @@
 #ifndef RETDEC_LLVMIR2HLL_SEMANTICS_SEMANTICS_IMPL_SUPPORT_GET_C_HEADER_FILE_FOR_FUNC_H
 #define RETDEC_LLVMIR2HLL_SEMANTICS_SEMANTICS_IMPL_SUPPORT_GET_C_HEADER_FILE_FOR_FUNC_H
 
-#include <cstddef>
 #include <optional>
+#include <string>
+#include <string_view>
 
-#include "retdec/llvmir2hll/support/types.h"
-#include "retdec/utils/array.h"
-
-/**
-* @brief Maps all the functions from array @a funcs into @a header by adding
-*        them into @a map.
-*
-* @param[in] funcs Statically allocated array of function names
-*                  (<tt>const char *</tt>).
-* @param[in] header The name of the header file (<tt>const char *</tt>).
-* @param[out] map A map into which the mappings will be stored.
-*/
-#define ADD_FUNCS_TO_C_HEADER_MAP(funcs, header, map) \
-	for (std::size_t i = 0, e = retdec::utils::arraySize(funcs); i != e; ++i) { \
-		map[funcs[i]] = header; \
-	}
+#include "retdec/llvmir2hll/semantics/semantics/impl_support/sorted_table.h"
 
 namespace retdec {
 namespace llvmir2hll {
 namespace semantics {
 
-std::optional<std::string> getCHeaderFileForFuncFromMap(
+/**
+* @brief A function and the C header file declaring it.
+*/
+struct FuncCHeader {
+	std::string_view funcName;
+	std::string_view header;
+
+	constexpr std::string_view key() const { return funcName; }
+};
+
+/// Functions and their header files, sorted by the names of functions.
+using FuncCHeaderTable = SortedTable<FuncCHeader>;
+
+std::optional<std::string_view> getCHeaderFileForFuncFromTable(
 		const std::string &funcName,
-		const StringStringUMap &map);
+		const FuncCHeaderTable &table);
 
 } // namespace semantics
 } // namespace llvmir2hll
@@ -7,40 +7,38 @@
 #ifndef RETDEC_LLVMIR2HLL_SEMANTICS_SEMANTICS_IMPL_SUPPORT_GET_NAME_OF_PARAM_H
 #define RETDEC_LLVMIR2HLL_SEMANTICS_SEMANTICS_IMPL_SUPPORT_GET_NAME_OF_PARAM_H
 
-#include <cstddef>
 #include <optional>
 #include <string>
-#include <unordered_map>
+#include <string_view>
+#include <utility>
 
-/**
-* @brief Sets a name of the given parameter for the given function.
-*/
-#define ADD_PARAM_NAME(funcName, paramPos, paramName) \
-	funcParamNamesMap[FuncParamPosPair(funcName, paramPos)] = paramName;
+#include "retdec/llvmir2hll/semantics/semantics/impl_support/sorted_table.h"
 
 namespace retdec {
 namespace llvmir2hll {
 namespace semantics {
 
 /// A pair of function name and parameter position.
-using FuncParamPosPair = std::pair<std::string, unsigned>;
+using FuncParamPosPair = std::pair<std::string_view, unsigned>;
 
 /**
-* @brief A hashing functor for FuncParamPosPair.
+* @brief A parameter of a function and its name.
 */
-struct FuncParamPosPairHasher {
-	std::size_t operator()(const FuncParamPosPair &p) const {
-		return std::hash<std::string>()(p.first) + p.second;
-	}
+struct FuncParamName {
+	std::string_view funcName;
+	unsigned paramPos;
+	std::string_view paramName;
+
+	constexpr FuncParamPosPair key() const { return {funcName, paramPos}; }
 };
 
-/// Mapping of a function name and parameter position into the name of this
-/// parameter.
-using FuncParamNamesMap = std::unordered_map<FuncParamPosPair, std::string,
-	FuncParamPosPairHasher>;
+/// Names of parameters, sorted by the names of functions and positions of
+/// parameters.
+using FuncParamNameTable = SortedTable<FuncParamName>;
 
-std::optional<std::string> getNameOfParamFromMap(const std::string &funcName,
-	unsigned paramPos, const FuncParamNamesMap &map);
+std::optional<std::string_view> getNameOfParamFromTable(
+	const std::string &funcName, unsigned paramPos,
+	const FuncParamNameTable &table);
 
 } // namespace semantics
 } // namespace llvmir2hll
@@ -8,15 +8,31 @@
 #define RETDEC_LLVMIR2HLL_SEMANTICS_SEMANTICS_IMPL_SUPPORT_GET_NAME_OF_VAR_STORING_RESULT_H
 
 #include <optional>
+#include <string>
+#include <string_view>
 
-#include "retdec/llvmir2hll/support/types.h"
+#include "retdec/llvmir2hll/semantics/semantics/impl_support/sorted_table.h"
 
 namespace retdec {
 namespace llvmir2hll {
 namespace semantics {
 
-std::optional<std::string> getNameOfVarStoringResultFromMap(
-	const std::string &funcName, const StringStringUMap &map);
+/**
+* @brief A function and the name of a variable storing its result.
+*/
+struct FuncVarName {
+	std::string_view funcName;
+	std::string_view varName;
+
+	constexpr std::string_view key() const { return funcName; }
+};
+
+/// Functions and names of variables storing their results, sorted by the
+/// names of functions.
+using FuncVarNameTable = SortedTable<FuncVarName>;
+
+std::optional<std::string_view> getNameOfVarStoringResultFromTable(
+	const std::string &funcName, const FuncVarNameTable &table);
 
 } // namespace semantics
 } // namespace llvmir2hll
@@ -7,72 +7,72 @@
 #ifndef RETDEC_LLVMIR2HLL_SEMANTICS_SEMANTICS_IMPL_SUPPORT_GET_SYMBOLIC_NAMES_FOR_PARAM_H
 #define RETDEC_LLVMIR2HLL_SEMANTICS_SEMANTICS_IMPL_SUPPORT_GET_SYMBOLIC_NAMES_FOR_PARAM_H
 
-#include <map>
+#include <cstddef>
+#include <cstdint>
 #include <optional>
-#include <unordered_map>
+#include <string>
+#include <string_view>
+#include <utility>
 
+#include "retdec/llvmir2hll/semantics/semantics/impl_support/sorted_table.h"
 #include "retdec/llvmir2hll/support/types.h"
 
+namespace retdec {
+namespace llvmir2hll {
+namespace semantics {
+
 /**
-* @brief Starts a definition of a getSymbolicNamesFor() function.
-*
-* Such a function can be used to provide the creation of @c symbolicNamesMap
-* for a specific set of names, like signal numbers or error numbers. In this
-* way, the names can be aggregated on a single place and not copy&pasted to
-* every place they are needed (@c error(), @c error_at_line(), etc).
-*
-* The created function ensures that the map is filled at most once (upon the
-* first call). Therefore, when you call the function for the second time, the
-* already filled map is returned without filling the map again with the same
-* data.
-*
-* @par Important Note
-*
-* Every use of this macro has to be ended with
-* DEFINE_GET_SYMBOLIC_NAMES_FUNC_END.
-*
-* @par Usage Example
-* @code
-* DEFINE_GET_SYMBOLIC_NAMES_FUNC_BEGIN(getSymbolicNamesForSignalHandlers)
-*     // Info from: <sys/signal.h>
-*     symbolicNamesMap[0] = "SIG_DFL";
-*     symbolicNamesMap[1] = "SIG_IGN";
-* DEFINE_GET_SYMBOLIC_NAMES_FUNC_END()
-*
-* // ...
-*
-* paramSymbolsMap[2] = getSymbolicNamesForSignalHandlers();
-* @endcode
+* @brief A value and its symbolic name.
 */
-#define DEFINE_GET_SYMBOLIC_NAMES_FUNC_BEGIN(funcName) \
-	const IntStringMap &funcName() { \
-		static IntStringMap symbolicNamesMap; \
-		if (!symbolicNamesMap.empty()) { \
-			return symbolicNamesMap; \
-		}
+struct SymbolicName {
+	std::int64_t value;
+	std::string_view name;
+};
 
 /**
-* @brief The ending part of DEFINE_GET_SYMBOLIC_NAMES_FUNC_BEGIN.
+* @brief A read-only view of a statically allocated array of symbolic names.
 *
-* @see DEFINE_GET_SYMBOLIC_NAMES_FUNC_BEGIN
+* Arrays of symbolic names can be shared by several parameters, like signal
+* numbers or error numbers. In this way, the names can be aggregated on a
+* single place and not copy&pasted to every place they are needed (@c error(),
+* @c error_at_line(), etc).
 */
-#define DEFINE_GET_SYMBOLIC_NAMES_FUNC_END() \
-		return symbolicNamesMap; \
-	}
+class SymbolicNames {
+public:
+	template<std::size_t N>
+	constexpr SymbolicNames(const SymbolicName (&names)[N]):
+		first(names), last(names + N) {}
 
-namespace retdec {
-namespace llvmir2hll {
-namespace semantics {
+	constexpr const SymbolicName *begin() const { return first; }
+	constexpr const SymbolicName *end() const { return last; }
 
-/// Mapping of a parameter position into symbolic names of its possible values.
-using ParamSymbolsMap = std::map<unsigned, IntStringMap>;
+private:
+	/// The first name.
+	const SymbolicName *first;
+	/// One past the last name.
+	const SymbolicName *last;
+};
+
+/**
+* @brief A parameter of a function and symbolic names of its values.
+*/
+struct FuncParamSymbolicNames {
+	std::string_view funcName;
+	unsigned paramPos;
+	SymbolicNames names;
+
+	constexpr std::pair<std::string_view, unsigned> key() const {
+		return {funcName, paramPos};
+	}
+};
 
-/// Mapping of a function name into ParamSymbolsMap.
-using FuncParamsMap = std::unordered_map<std::string, ParamSymbolsMap>;
+/// Symbolic names of parameters, sorted by the names of functions and
+/// positions of parameters.
+using FuncParamSymbolicNamesTable = SortedTable<FuncParamSymbolicNames>;
 
-std::optional<IntStringMap> getSymbolicNamesForParamFromMap(
-	const std::string &funcName,
-	unsigned paramPos, const FuncParamsMap &map);
+const IntStringMap *getSymbolicNamesForParamFromTable(
+	const std::string &funcName, unsigned paramPos,
+	const FuncParamSymbolicNamesTable &table);
 
 } // namespace semantics
 } // namespace llvmir2hll
@@ -0,0 +1,91 @@
+/**
+* @file include/retdec/llvmir2hll/semantics/semantics/impl_support/sorted_table.h
+* @brief A read-only view of a statically allocated sorted table.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_LLVMIR2HLL_SEMANTICS_SEMANTICS_IMPL_SUPPORT_SORTED_TABLE_H
+#define RETDEC_LLVMIR2HLL_SEMANTICS_SEMANTICS_IMPL_SUPPORT_SORTED_TABLE_H
+
+#include <algorithm>
+#include <cstddef>
+
+namespace retdec {
+namespace llvmir2hll {
+namespace semantics {
+
+/**
+* @brief A read-only view of a table whose entries are sorted by their keys.
+*
+* The tables of semantics are @c constexpr arrays, so they are placed into
+* read-only data and they need no initialization at runtime. Every entry has to
+* provide a @c constexpr member function @c key(), whose results are strictly
+* increasing in the table. This should be checked by a static assertion of
+* isSorted() next to the table. The tables are kept sorted by
+* <tt>scripts/llvmir2hll/sort_semantics_tables.py</tt>.
+*
+* Lookups in the table do not allocate memory.
+*
+* @tparam Entry Type of entries.
+*/
+template<typename Entry>
+class SortedTable {
+public:
+	/**
+	* @brief Creates an empty table.
+	*/
+	constexpr SortedTable() = default;
+
+	/**
+	* @brief Creates a view of the given table.
+	*/
+	template<std::size_t N>
+	constexpr SortedTable(const Entry (&entries)[N]):
+		first(entries), last(entries + N) {}
+
+	constexpr const Entry *begin() const { return first; }
+	constexpr const Entry *end() const { return last; }
+	constexpr std::size_t size() const { return last - first; }
+
+	/**
+	* @brief Are the entries sorted by their keys and are the keys unique?
+	*/
+	constexpr bool isSorted() const {
+		for (auto i = first; i != last && i + 1 != last; ++i) {
+			if (!(i->key() < (i + 1)->key())) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/**
+	* @brief Returns the entry with the given key, or @c nullptr if there is no
+	*        such entry.
+	*/
+	template<typename Key>
+	const Entry *find(const Key &key) const {
+		if (first == last || key < first->key() || (last - 1)->key() < key) {
+			return nullptr;
+		}
+
+		auto i = std::lower_bound(first, last, key,
+			[](const Entry &entry, const Key &key) {
+				return entry.key() < key;
+			}
+		);
+		return i != last && !(key < i->key()) ? i : nullptr;
+	}
+
+private:
+	/// The first entry.
+	const Entry *first = nullptr;
+	/// One past the last entry.
+	const Entry *last = nullptr;
+};
+
+} // namespace semantics
+} // namespace llvmir2hll
+} // namespace retdec
+
+#endif
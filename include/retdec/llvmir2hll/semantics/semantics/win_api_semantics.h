@@ -30,15 +30,15 @@ public:
 	/// @name Semantics Interface
 	/// @{
 	virtual std::string getId() const override;
-	virtual std::optional<std::string> getCHeaderFileForFunc(
+	virtual std::optional<std::string_view> getCHeaderFileForFunc(
 		const std::string &funcName) const override;
 	virtual std::optional<bool> funcNeverReturns(
 		const std::string &funcName) const override;
-	virtual std::optional<std::string> getNameOfVarStoringResult(
+	virtual std::optional<std::string_view> getNameOfVarStoringResult(
 		const std::string &funcName) const override;
-	virtual std::optional<std::string> getNameOfParam(const std::string &funcName,
-		unsigned paramPos) const override;
-	virtual std::optional<IntStringMap> getSymbolicNamesForParam(
+	virtual std::optional<std::string_view> getNameOfParam(
+		const std::string &funcName, unsigned paramPos) const override;
+	virtual const IntStringMap *getSymbolicNamesForParam(
 		const std::string &funcName, unsigned paramPos) const override;
 	/// @}
 
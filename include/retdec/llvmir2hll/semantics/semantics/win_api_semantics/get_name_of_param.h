@@ -10,13 +10,14 @@
 
 #include <optional>
 #include <string>
+#include <string_view>
 
 namespace retdec {
 namespace llvmir2hll {
 namespace semantics {
 namespace win_api {
 
-std::optional<std::string> getNameOfParam(const std::string &funcName,
+std::optional<std::string_view> getNameOfParam(const std::string &funcName,
 	unsigned paramPos);
 
 } // namespace win_api
@@ -1,6 +1,6 @@
 /**
 * @file include/retdec/llvmir2hll/semantics/semantics/win_api_semantics/get_name_of_param/g1.h
-* @brief Initializes FuncParamNamesMap for WinAPI functions starting with G
+* @brief Table of names of parameters of WinAPI functions starting with G
 *        (first part).
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
@@ -15,7 +15,7 @@ namespace llvmir2hll {
 namespace semantics {
 namespace win_api {
 
-void initFuncParamNamesMap_G1(FuncParamNamesMap &funcParamNamesMap);
+extern const FuncParamNameTable FUNC_PARAM_NAMES_G1;
 
 } // namespace win_api
 } // namespace semantics
@@ -18,7 +18,7 @@ namespace llvmir2hll {
 namespace semantics {
 namespace win_api {
 
-std::optional<IntStringMap> getSymbolicNamesForParam(const std::string &funcName,
+const IntStringMap *getSymbolicNamesForParam(const std::string &funcName,
 	unsigned paramPos);
 
 } // namespace win_api
@@ -7,11 +7,18 @@
 #ifndef RETDEC_LOADER_RETDEC_LOADER_IMAGE_H
 #define RETDEC_LOADER_RETDEC_LOADER_IMAGE_H
 
+#include <climits>
+#include <cstring>
 #include <memory>
+#include <type_traits>
 
+#include "retdec/common/region_index.h"
 #include "retdec/utils/byte_value_storage.h"
+#include "retdec/utils/conversion.h"
+#include "retdec/utils/system.h"
 #include "retdec/fileformat/fftypes.h"
 #include "retdec/fileformat/file_format/file_format.h"
+#include "retdec/loader/loader/pointer_map.h"
 #include "retdec/loader/loader/segment.h"
 #include "retdec/loader/utils/name_generator.h"
 
@@ -40,6 +47,9 @@ public:
 
 	virtual bool getXByte(std::uint64_t address, std::uint64_t x, std::uint64_t& res, retdec::utils::Endianness e = retdec::utils::Endianness::UNKNOWN) const override;
 	virtual bool getXBytes(std::uint64_t address, std::uint64_t x, std::vector<std::uint8_t>& res) const override;
+	virtual bool readBytes(std::uint64_t address, std::uint64_t x, std::uint8_t* res) const override;
+	const std::uint8_t* getRawBytes(std::uint64_t address, std::uint64_t x) const;
+	template <typename T> bool read(std::uint64_t address, T& res, retdec::utils::Endianness e = retdec::utils::Endianness::UNKNOWN) const;
 
 	virtual bool setXByte(std::uint64_t address, std::uint64_t x, std::uint64_t val, retdec::utils::Endianness e = retdec::utils::Endianness::UNKNOWN) override;
 	virtual bool setXBytes(std::uint64_t address, const std::vector<std::uint8_t>& res) override;
@@ -59,6 +69,7 @@ public:
 	bool hasReadOnlyDataOnAddress(std::uint64_t address) const;
 	bool hasSegmentOnAddress(std::uint64_t address) const;
 	bool isPointer(std::uint64_t address, std::uint64_t* pointer = nullptr) const;
+	std::shared_ptr<const PointerMap> getPointerMap() const;
 
 	Segment* getSegment(std::size_t index);
 	Segment* getSegment(const std::string& name);
@@ -80,10 +91,14 @@ protected:
 	void removeSegment(Segment* segment);
 	void nameSegment(Segment* segment);
 	void sortSegments();
+	void invalidateSegmentIndex();
 
 	void setStatusMessage(const std::string& message);
 
 private:
+	void invalidatePointerMap();
+	bool resolveEndianness(retdec::utils::Endianness& e) const;
+
 	const Segment* _getSegment(std::size_t index) const;
 	const Segment* _getSegment(const std::string& name) const;
 	const Segment* _getSegmentWithIndex(std::size_t index) const;
@@ -91,11 +106,58 @@ private:
 
 	std::shared_ptr<retdec::fileformat::FileFormat> _fileFormat;
 	std::vector<std::unique_ptr<Segment>> _segments;
+	/// Address to segment index, created lazily on the first lookup.
+	mutable std::shared_ptr<const retdec::common::RegionIndex<Segment>> _segmentIndex;
+	/// Pointers in segments, created lazily on the first query.
+	mutable std::shared_ptr<const PointerMap> _pointerMap;
 	std::uint64_t _baseAddress;
 	NameGenerator _namelessSegNameGen;
 	std::string _statusMessage;
+
+	friend class Segment;
 };
 
+/**
+ * Read integer of type @a T located at provided address using the specified
+ * endian or default file endian. Nothing is allocated -- for files with 8-bit
+ * bytes, this is only a segment lookup, a bounds check and a (byte swapping)
+ * load.
+ *
+ * @param address Address to read integer from
+ * @param res Result integer
+ * @param e Endian - if specified it is forced, otherwise file's endian is used
+ *
+ * @return Status of operation (@c true if all is OK, @c false otherwise)
+ */
+template <typename T>
+bool Image::read(std::uint64_t address, T& res, retdec::utils::Endianness e) const
+{
+	static_assert(std::is_integral<T>::value, "Image::read() needs an integral type");
+
+	if (getByteLength() != CHAR_BIT)
+	{
+		std::uint64_t val = 0;
+		if (!getXByte(address, sizeof(T), val, e))
+			return false;
+
+		res = static_cast<T>(val);
+		return true;
+	}
+
+	std::uint8_t data[sizeof(T)];
+	if (!readBytes(address, sizeof(T), data) || !resolveEndianness(e))
+		return false;
+
+	static const bool hostIsLittle = retdec::utils::isLittleEndian();
+	std::make_unsigned_t<T> val;
+	std::memcpy(&val, data, sizeof(T));
+	if ((e == retdec::utils::Endianness::LITTLE) != hostIsLittle)
+		val = retdec::utils::byteSwap(val);
+
+	res = static_cast<T>(val);
+	return true;
+}
+
 } // namespace loader
 } // namespace retdec
 
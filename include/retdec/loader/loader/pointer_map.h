@@ -0,0 +1,72 @@
+/**
+ * @file include/retdec/loader/loader/pointer_map.h
+ * @brief Declaration of map of pointers stored in loadable image.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_LOADER_RETDEC_LOADER_POINTER_MAP_H
+#define RETDEC_LOADER_RETDEC_LOADER_POINTER_MAP_H
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "retdec/loader/loader/segment.h"
+
+namespace retdec {
+namespace loader {
+
+class Image;
+
+/**
+ * Map of all word slots in image segments holding a pointer, i.e. a value
+ * for which @c Image::hasDataOnAddress() holds.
+ *
+ * Slots are aligned to the start of their segment. All segments are scanned
+ * only once, when the map is created. Then, the question whether there is
+ * a pointer in the slot and where it points to is answered in O(1).
+ *
+ * Segments overlapping other segments are not mapped, as well as images with
+ * bytes that do not have 8 bits. Queries into them must be answered by
+ * reading the image.
+ */
+class PointerMap
+{
+public:
+	PointerMap(const Image& image);
+
+	bool lookup(const Segment* segment, std::uint64_t address, bool& isPointer, std::uint64_t* pointer = nullptr) const;
+	std::uint64_t skipToPointer(const Segment* segment, std::uint64_t address) const;
+
+	std::size_t getNumberOfPointers() const;
+
+private:
+	/**
+	 * Pointers in one segment.
+	 */
+	struct SegmentPointers
+	{
+		/// Address of the first slot.
+		std::uint64_t address = 0;
+		/// Number of slots.
+		std::uint64_t slots = 0;
+		/// One bit per slot, set if there is a pointer in the slot.
+		std::vector<std::uint64_t> bits;
+		/// Number of pointers in all the preceding bit words.
+		std::vector<std::uint32_t> ranks;
+		/// Values of pointers, in the order of their slots.
+		std::vector<std::uint64_t> targets;
+	};
+
+	void mapSegment(const Image& image, const Segment* segment, std::uint64_t low, std::uint64_t high, SegmentPointers& pointers);
+	const SegmentPointers* getSegmentPointers(const Segment* segment, std::uint64_t address, std::uint64_t& slot) const;
+
+	std::size_t _wordSize = 0;
+	std::unordered_map<const Segment*, SegmentPointers> _segments;
+	std::size_t _numberOfPointers = 0;
+};
+
+} // namespace loader
+} // namespace retdec
+
+#endif
@@ -21,6 +21,8 @@
 namespace retdec {
 namespace loader {
 
+class Image;
+
 class Segment
 {
 public:
@@ -46,6 +48,8 @@ public:
 
 	bool getBytes(std::vector<unsigned char>& result) const;
 	bool getBytes(std::vector<unsigned char>& result, std::uint64_t addressOffset, std::uint64_t size) const;
+	bool getBytes(std::uint8_t* result, std::uint64_t addressOffset, std::uint64_t size) const;
+	const std::uint8_t* getRawBytes(std::uint64_t addressOffset, std::uint64_t size) const;
 	bool getBits(std::string& result) const;
 	bool getBits(std::string& result, std::uint64_t addressOffset, std::uint64_t bytesCount) const;
 
@@ -63,6 +67,10 @@ private:
 	std::unique_ptr<SegmentDataSource> _dataSource;
 	std::string _name;
 	retdec::common::RangeContainer<std::uint64_t> _nonDecodableRanges;
+	/// Image the segment is inserted into, notified when the segment changes.
+	Image* _image = nullptr;
+
+	friend class Image;
 };
 
 } // namespace loader
@@ -67,6 +67,7 @@ const std::uint32_t BuildNumber64Bit = 0x10000;     // Emulate 64-bit system
 const std::uint32_t IoFlagHeadersOnly = 1;          // Only load/save PE headers
 const std::uint32_t IoFlagNewFile     = 2;          // Create the PE as new file (for unpackers)
 const std::uint32_t IoFlagLoadAsImage = 4;          // Load the data as mapped image file
+const std::uint32_t IoFlagSharedData  = 8;          // File data outlive the loader; pages refer to them instead of copying
 
 //-----------------------------------------------------------------------------
 // Structure for comparison with Windows mapped images
@@ -92,6 +93,7 @@ struct PELIB_FILE_PAGE
 {
 	PELIB_FILE_PAGE()
 	{
+		sharedData = nullptr;
 		isInvalidPage = true;
 		isZeroPage = false;
 	}
@@ -100,6 +102,7 @@ struct PELIB_FILE_PAGE
 	bool setValidPage(const void * data, size_t length)
 	{
 		// Write the valid data to the page
+		sharedData = nullptr;
 		writeToPage(data, 0, length);
 
 		// Write zero data to the end of the page
@@ -110,18 +113,45 @@ struct PELIB_FILE_PAGE
 		return true;
 	}
 
+	// Initializes the page with a full page of data that outlive the page.
+	// The data are not copied until somebody writes to the page.
+	bool setSharedPage(const std::uint8_t * data)
+	{
+		buffer.clear();
+		sharedData = data;
+		isInvalidPage = false;
+		isZeroPage = false;
+		return true;
+	}
+
 	// Initializes the page as zero page. To save memory, we won't initialize buffer
 	void setZeroPage()
 	{
 		buffer.clear();
+		sharedData = nullptr;
 		isInvalidPage = false;
 		isZeroPage = true;
 	}
 
+	// Returns the page content or nullptr if the page has no data
+	const std::uint8_t * getData() const
+	{
+		if(sharedData != nullptr)
+			return sharedData;
+		return buffer.empty() ? nullptr : buffer.data();
+	}
+
 	void writeToPage(const void * data, size_t offset, size_t length)
 	{
 		if(offset < PELIB_PAGE_SIZE)
 		{
+			// Make a private copy of shared data before the first write
+			if(sharedData != nullptr)
+			{
+				buffer.assign(sharedData, sharedData + PELIB_PAGE_SIZE);
+				sharedData = nullptr;
+			}
+
 			// Make sure that there is buffer allocated
 			if(buffer.size() != PELIB_PAGE_SIZE)
 				buffer.resize(PELIB_PAGE_SIZE);
@@ -133,7 +163,8 @@ struct PELIB_FILE_PAGE
 		}
 	}
 
-	ByteBuffer buffer;                    // A page-sized buffer, holding one image page. Empty if isInvalidPage
+	ByteBuffer buffer;                    // A page-sized buffer, holding one image page. Empty if isInvalidPage or shared
+	const std::uint8_t * sharedData;      // Page-sized data owned by the caller of ImageLoader::Load(), if any
 	bool isInvalidPage;                   // For invalid pages within image (SectionAlignment > 0x1000)
 	bool isZeroPage;                      // For sections with VirtualSize != 0, RawSize = 0
 };
@@ -148,6 +179,7 @@ class ImageLoader
 	ImageLoader(std::uint32_t loaderFlags = 0);
 
 	int Load(ByteBuffer & fileData, std::uint32_t loadFlags = 0);
+	int Load(const std::uint8_t * fileData, std::size_t fileSize, std::uint32_t loadFlags = 0);
 	int Load(std::istream & fs, std::streamoff fileOffset = 0, std::uint32_t loadFlags = 0);
 	int Load(const char * fileName, std::uint32_t loadFlags = 0);
 
@@ -161,7 +193,8 @@ class ImageLoader
 
 	std::uint32_t readString(std::string & str, std::uint32_t rva, std::uint32_t maxLength = 65535);
 	std::uint32_t readStringRc(std::string & str, std::uint32_t rva);
-	std::uint32_t readStringRaw(ByteBuffer & fileData,
+	std::uint32_t readStringRaw(const std::uint8_t * fileData,
+		                        std::size_t fileSize,
 		                        std::string & str,
 		                        std::size_t offset,
 		                        std::size_t maxLength = 65535,
@@ -394,33 +427,36 @@ class ImageLoader
 	std::uint32_t readWriteImage(void * buffer, std::uint32_t rva, std::uint32_t bytesToRead, READWRITE ReadWrite);
 	std::uint32_t readWriteImageFile(void * buffer, std::uint32_t rva, std::uint32_t bytesToRead, bool bReadOperation);
 
-	void processSectionHeader(PELIB_IMAGE_SECTION_HEADER * pSectionHeader);
+	void processSectionHeader(const PELIB_IMAGE_SECTION_HEADER & sectionHeader, std::uint32_t headerOffset);
+	void applyHeaderFixups(PELIB_FILE_PAGE & page, std::size_t fileOffset, std::size_t length);
 	bool processImageRelocation_IA64_IMM64(std::uint32_t fixupAddress, std::uint64_t difference);
 	bool processImageRelocations(std::uint64_t oldImageBase, std::uint64_t getImageBase, std::uint32_t VirtualAddress, std::uint32_t Size);
 	void writeNewImageBase(std::uint64_t newImageBase);
 
-	int captureDosHeader(ByteBuffer & fileData);
+	int captureDosHeader(const std::uint8_t * fileData, std::size_t fileSize);
 	int saveToFile(std::ostream & fs, std::streamoff fileOffset, std::size_t rva, std::size_t length);
 	int saveDosHeaderNew(std::ostream & fs, std::streamoff fileOffset);
 	int saveDosHeader(std::ostream & fs, std::streamoff fileOffset);
-	int captureNtHeaders(ByteBuffer & fileData);
+	int captureNtHeaders(const std::uint8_t * fileData, std::size_t fileSize);
 	int saveNtHeadersNew(std::ostream & fs, std::streamoff fileOffset);
 	int saveNtHeaders(std::ostream & fs, std::streamoff fileOffset);
-	int captureSectionName(ByteBuffer & fileData, std::string & sectionName, const std::uint8_t * name);
-	int captureSectionHeaders(ByteBuffer & fileData);
+	int captureSectionName(const std::uint8_t * fileData, std::size_t fileSize, std::string & sectionName, const std::uint8_t * name);
+	int captureSectionHeaders(const std::uint8_t * fileData, std::size_t fileSize);
 	int saveSectionHeadersNew(std::ostream & fs, std::streamoff fileOffset);
 	int saveSectionHeaders(std::ostream & fs, std::streamoff fileOffset);
-	int captureImageSections(ByteBuffer & fileData, std::uint32_t loadFlags);
-	int captureOptionalHeader32(std::uint8_t * fileData, std::uint8_t * filePtr, std::uint8_t * fileEnd);
-	int captureOptionalHeader64(std::uint8_t * fileData, std::uint8_t * filePtr, std::uint8_t * fileEnd);
+	int captureImageSections(const std::uint8_t * fileData, std::size_t fileSize, std::uint32_t loadFlags);
+	int captureOptionalHeader32(const std::uint8_t * fileData, const std::uint8_t * filePtr, const std::uint8_t * fileEnd);
+	int captureOptionalHeader64(const std::uint8_t * fileData, const std::uint8_t * filePtr, const std::uint8_t * fileEnd);
 	std::uint32_t copyDataDirectories(std::uint8_t * optionalHeaderPtr, std::uint8_t * dataDirectoriesPtr, std::size_t optionalHeaderMax, std::uint32_t numberOfRvaAndSizes);
 
 	int verifyDosHeader(PELIB_IMAGE_DOS_HEADER & hdr, std::size_t fileSize);
 	int verifyDosHeader(std::istream & fs, std::streamoff fileOffset, std::size_t fileSize);
 
-	int loadImageAsIs(ByteBuffer & fileData);
+	int loadImageAsIs(const std::uint8_t * fileData, std::size_t fileSize);
 
-	std::uint32_t captureImageSection(ByteBuffer & fileData,
+	std::uint32_t captureImageSection(const std::uint8_t * fileData,
+									  std::size_t fileSize,
+									  std::uint32_t loadFlags,
 									  std::uint32_t virtualAddress,
 									  std::uint32_t virtualSize,
 									  std::uint32_t pointerToRawData,
@@ -439,7 +475,7 @@ class ImageLoader
 	bool checkForInvalidImageRange();
 	bool isValidMachineForCodeIntegrifyCheck(std::uint32_t Bits);
 	bool checkForSectionTablesWithinHeader(std::uint32_t e_lfanew);
-	bool checkForBadCodeIntegrityImages(ByteBuffer & fileData);
+	bool checkForBadCodeIntegrityImages(const std::uint8_t * fileData, std::size_t fileSize);
 	bool checkForBadArchitectureSpecific();
 	bool checkForImageAfterMapping();
 
@@ -483,6 +519,7 @@ class ImageLoader
 	PELIB_IMAGE_FILE_HEADER fileHeader;                 // Loaded NT file header
 	PELIB_IMAGE_OPTIONAL_HEADER optionalHeader;         // 32/64-bit optional header
 	ByteBuffer rawFileData;                             // Loaded content of the image in case it couldn't have been mapped
+	std::vector<std::uint32_t> headerFixups;            // Offsets of section header fields zeroed by the Windows loader
 	LoaderError ldrError;
 	std::uint64_t savedFileSize;                        // Size of the raw file
 	std::uint32_t windowsBuildNumber;
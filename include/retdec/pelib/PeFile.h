@@ -72,7 +72,7 @@ namespace PeLib
 		  /// Reads rich header of the current file.
 		  virtual int readRichHeader(std::size_t offset, std::size_t size, bool ignoreInvalidKey = false)  = 0; // EXPORT
 		  /// Reads the COFF symbol table of the current file.
-		  virtual int readCoffSymbolTable(ByteBuffer & fileData) = 0; // EXPORT
+		  virtual int readCoffSymbolTable(const std::uint8_t * fileData, std::size_t fileSize) = 0; // EXPORT
 		  /// Reads delay import directory of the current file.
 		  virtual int readDelayImportDirectory() = 0; // EXPORT
 		  /// Reads security directory of the current file.
@@ -138,6 +138,10 @@ namespace PeLib
 		/// Alternate load - can be used when the data are already loaded to memory to prevent duplicating large buffers
 		int loadPeHeaders(ByteBuffer & fileData, bool loadHeadersOnly = false);
 
+		/// Alternate load - the data must stay valid and unchanged for the lifetime of this object.
+		/// The mapped image refers to them and copies only the pages that are written to.
+		int loadPeHeaders(const std::uint8_t * fileData, std::size_t fileSize, bool loadHeadersOnly = false);
+
 		/// returns PEFILE64 or PEFILE32
 		int getFileType() const;
 
@@ -167,7 +171,7 @@ namespace PeLib
 		/// Reads rich header of the current file.
 		int readRichHeader(std::size_t offset, std::size_t size, bool ignoreInvalidKey = false) ;
 		/// Reads the COFF symbol table of the current file.
-		int readCoffSymbolTable(ByteBuffer & fileData);
+		int readCoffSymbolTable(const std::uint8_t * fileData, std::size_t fileSize);
 		/// Reads delay import directory of the current file.
 		int readDelayImportDirectory() ;
 		/// Reads the security directory of the current file.
@@ -14,18 +14,20 @@
 #include "retdec/common/basic_block.h"
 #include "retdec/common/function.h"
 #include "retdec/config/config.h"
+#include "retdec/utils/cancellation.h"
 
 namespace retdec {
 
+namespace cpdetect {
+
+class InputAnalysis;
+
+} // namespace cpdetect
+
 struct LlvmModuleContextPair
 {
 	LlvmModuleContextPair(LlvmModuleContextPair&&) = default;
-	~LlvmModuleContextPair()
-	{
-		// Order matters: module destructor uses context.
-		module.reset();
-		context.reset();
-	}
+	~LlvmModuleContextPair();
 	std::unique_ptr<llvm::Module> module;
 	std::unique_ptr<llvm::LLVMContext> context;
 };
@@ -45,10 +47,16 @@ LlvmModuleContextPair disassemble(
  * Run a decompilation according to a \p config configuration.
  * If \p outString is set, decompilation output will be returned
  * in this string. Otherwise, output file is expected to be set in \p config.
+ * If \p cancel is set, it is checked between decompilation phases and
+ * \c retdec::utils::OperationCancelled is thrown once it gets raised.
+ * If \p input is set, the already parsed input file and the tools detected
+ * in it are used instead of parsing the input file from \p config again.
  */
 bool decompile(
 		retdec::config::Config& config,
-		std::string* outString = nullptr
+		std::string* outString = nullptr,
+		const retdec::utils::CancellationFlag* cancel = nullptr,
+		const std::shared_ptr<retdec::cpdetect::InputAnalysis>& input = nullptr
 );
 
 } // namespace retdec
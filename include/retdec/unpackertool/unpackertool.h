@@ -7,11 +7,29 @@
 #ifndef RETDEC_UNPACKERTOOL_UNPACKERTOOL_H
 #define RETDEC_UNPACKERTOOL_UNPACKERTOOL_H
 
+#include <string>
+
 namespace retdec {
+
+namespace cpdetect {
+
+class InputAnalysis;
+
+} // namespace cpdetect
+
 namespace unpackertool {
 
 int _main(int argc, char** argv);
 
+/**
+ * Unpack an input that was already parsed (and possibly also analyzed by
+ * cpdetect) by the caller. Returns the same exit codes as \c _main().
+ */
+int unpack(
+		cpdetect::InputAnalysis& input,
+		const std::string& outputFile,
+		bool brute = false);
+
 } // namespace unpackertool
 } // namespace retdec
 
@@ -11,6 +11,8 @@
 #include <string>
 #include <vector>
 
+#include "retdec/utils/byte_view.h"
+
 namespace retdec {
 namespace utils {
 
@@ -47,6 +49,10 @@ public:
 			std::uint64_t address,
 			std::uint64_t x,
 			std::vector<std::uint8_t>& res) const = 0;
+	virtual bool readBytes(
+			std::uint64_t address,
+			std::uint64_t x,
+			std::uint8_t* res) const;
 
 	virtual bool setXByte(
 			std::uint64_t address,
@@ -186,7 +192,7 @@ public:
 
 protected:
 	bool createValueFromBytes(
-			const std::vector<std::uint8_t>& data,
+			const ByteView& data,
 			std::uint64_t& value,
 			Endianness endian,
 			std::uint64_t offset = 0,
@@ -0,0 +1,69 @@
+/**
+* @file include/retdec/utils/byte_view.h
+* @brief Non-owning read-only view of a sequence of bytes.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_UTILS_BYTE_VIEW_H
+#define RETDEC_UTILS_BYTE_VIEW_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace retdec {
+namespace utils {
+
+/**
+* @brief Non-owning read-only view of a sequence of bytes.
+*
+* The view only remembers where the bytes are, so it is cheap to create and
+* copy. The viewed bytes have to outlive the view. It provides the read-only
+* part of the @c std::vector interface, so it can replace a constant reference
+* to a vector of bytes.
+*/
+class ByteView {
+public:
+	using value_type = std::uint8_t;
+	using size_type = std::size_t;
+	using const_iterator = const std::uint8_t *;
+	using iterator = const_iterator;
+
+	ByteView() = default;
+	ByteView(const std::uint8_t *data, std::size_t size):
+		ptr(data), length(size) {}
+	ByteView(const std::vector<std::uint8_t> &bytes):
+		ptr(bytes.data()), length(bytes.size()) {}
+
+	const std::uint8_t *data() const { return ptr; }
+	std::size_t size() const { return length; }
+	bool empty() const { return length == 0; }
+
+	const_iterator begin() const { return ptr; }
+	const_iterator end() const { return ptr + length; }
+
+	const std::uint8_t &operator[](std::size_t i) const { return ptr[i]; }
+
+	/// Moves the start of the view @a n bytes forward, at most to its end.
+	void removePrefix(std::size_t n) {
+		n = n < length ? n : length;
+		ptr += n;
+		length -= n;
+	}
+
+	/// Returns the viewed bytes as a vector, i.e. makes their copy.
+	std::vector<std::uint8_t> toVector() const {
+		return std::vector<std::uint8_t>(begin(), end());
+	}
+
+private:
+	/// Start of the viewed bytes.
+	const std::uint8_t *ptr = nullptr;
+	/// Number of the viewed bytes.
+	std::size_t length = 0;
+};
+
+} // namespace utils
+} // namespace retdec
+
+#endif
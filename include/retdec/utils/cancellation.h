@@ -0,0 +1,46 @@
+/**
+* @file include/retdec/utils/cancellation.h
+* @brief Cooperative cancellation of long-running operations.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_UTILS_CANCELLATION_H
+#define RETDEC_UTILS_CANCELLATION_H
+
+#include <atomic>
+#include <stdexcept>
+
+namespace retdec {
+namespace utils {
+
+/**
+* @brief Flag set by one thread to ask another thread to stop its work.
+*
+* The working thread is expected to poll the flag at safe points (e.g. between
+* decompilation phases) via @c throwIfCancelled().
+*/
+using CancellationFlag = std::atomic<bool>;
+
+/**
+* @brief Exception thrown when an operation notices it was cancelled.
+*/
+class OperationCancelled : public std::runtime_error {
+public:
+	OperationCancelled() : std::runtime_error("operation was cancelled") {}
+};
+
+/**
+* @brief Throws @c OperationCancelled if the given @a flag is set.
+*
+* A null @a flag means that the operation cannot be cancelled.
+*/
+inline void throwIfCancelled(const CancellationFlag* flag) {
+	if (flag && flag->load(std::memory_order_relaxed)) {
+		throw OperationCancelled();
+	}
+}
+
+} // namespace utils
+} // namespace retdec
+
+#endif
@@ -293,6 +293,26 @@ unsigned int byteSwap32(unsigned int val);
 std::string byteSwap16(const std::string &val);
 std::string byteSwap32(const std::string &val);
 
+/**
+* @brief Reverse the order of bytes in the given unsigned integer.
+*
+* @param val Original value.
+*
+* @return Value with swapped bytes.
+*
+* Compilers recognize the loop and emit a single byte swap instruction.
+*/
+template<typename N>
+inline N byteSwap(N val) {
+	static_assert(std::is_unsigned<N>::value, "byteSwap() needs an unsigned type");
+	N res = 0;
+	for (std::size_t i = 0; i < sizeof(N); ++i) {
+		res = static_cast<N>((res << 8) | (val & 0xFF));
+		val = static_cast<N>(val >> 8);
+	}
+	return res;
+}
+
 /// @}
 
 } // namespace utils
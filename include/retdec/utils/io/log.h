@@ -124,8 +124,10 @@ public:
 private:
 	/**
 	 * Structure containing initialized/default loggers.
+	 * Each thread has its own loggers, so that concurrently running
+	 * decompilations can log into different destinations.
 	 */
-	static Logger::Ptr writers[static_cast<int>(Type::Undefined)+1];
+	static thread_local Logger::Ptr writers[static_cast<int>(Type::Undefined)+1];
 
 	/**
 	 * Fallback logger. In case of bad initialization of the writers
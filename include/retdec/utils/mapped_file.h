@@ -0,0 +1,59 @@
+/**
+* @file include/retdec/utils/mapped_file.h
+* @brief Read-only memory-mapped file.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_UTILS_MAPPED_FILE_H
+#define RETDEC_UTILS_MAPPED_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "retdec/utils/non_copyable.h"
+
+namespace retdec {
+namespace utils {
+
+/**
+* @brief Read-only view of a whole file mapped into memory.
+*
+* The content is not read until it is accessed and it is backed by the page
+* cache of the operating system, so mapping even a very large file does not
+* allocate memory for its copy. The view is valid for as long as the object
+* lives. The file must not be truncated by somebody else while it is mapped.
+*
+* A default-constructed object maps nothing and it is not valid.
+*/
+class MappedFile: private NonCopyable {
+public:
+	MappedFile() = default;
+	explicit MappedFile(const std::string &path);
+	MappedFile(MappedFile &&other) noexcept;
+	MappedFile &operator=(MappedFile &&other) noexcept;
+	~MappedFile();
+
+	bool isValid() const;
+	const std::uint8_t *getData() const;
+	std::size_t getSize() const;
+
+	const std::uint8_t *begin() const { return getData(); }
+	const std::uint8_t *end() const { return getData() + getSize(); }
+
+private:
+	void unmap();
+
+private:
+	/// Start of the mapped view, @c nullptr for empty or invalid files.
+	const std::uint8_t *data = nullptr;
+	/// Size of the mapped view.
+	std::size_t size = 0;
+	/// Was the file successfully opened and mapped?
+	bool valid = false;
+};
+
+} // namespace utils
+} // namespace retdec
+
+#endif
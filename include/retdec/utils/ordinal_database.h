@@ -0,0 +1,65 @@
+/**
+* @file include/retdec/utils/ordinal_database.h
+* @brief Packed database of function names of imports by ordinal.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_UTILS_ORDINAL_DATABASE_H
+#define RETDEC_UTILS_ORDINAL_DATABASE_H
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+#include "retdec/utils/mapped_file.h"
+
+namespace retdec {
+namespace utils {
+
+/**
+* @brief Read-only database of names of functions exported by ordinals.
+*
+* One database holds all libraries of one architecture. It is created by
+* compile() from a directory of @c .ord text files and mapped
+* into memory when opened. Libraries are found through a hash index and names
+* of their functions through a table indexed by ordinals, so no lookup
+* allocates memory. The database is not modified after it is opened, so one
+* object can be shared by several threads.
+*/
+class OrdinalDatabase {
+public:
+	OrdinalDatabase() = default;
+	explicit OrdinalDatabase(const std::string &path);
+	OrdinalDatabase(OrdinalDatabase &&other) noexcept;
+	OrdinalDatabase &operator=(OrdinalDatabase &&other) noexcept;
+
+	bool isValid() const;
+	std::size_t getLibraryCount() const;
+	bool hasLibrary(std::string_view libName) const;
+	std::string_view getName(std::string_view libName,
+		std::uint64_t ordinal) const;
+
+	static bool compile(const std::string &ordDirectory,
+		std::ostream &database);
+
+private:
+	struct Header;
+	struct Library;
+
+	bool checkLayout() const;
+	const Library *findLibrary(std::string_view libName) const;
+	std::string_view getString(std::uint32_t offset) const;
+	const std::uint32_t *getWords(std::uint32_t offset) const;
+
+private:
+	/// Mapped database.
+	MappedFile file;
+	/// Header of the mapped database, @c nullptr if it is not valid.
+	const Header *header = nullptr;
+};
+
+} // namespace utils
+} // namespace retdec
+
+#endif
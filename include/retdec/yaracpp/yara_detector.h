@@ -7,6 +7,8 @@
 #ifndef RETDEC_YARACPP_YARA_DETECTOR_H
 #define RETDEC_YARACPP_YARA_DETECTOR_H
 
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -69,6 +71,17 @@ class YaraDetector
 			FILE* handle;
 		};
 
+		/**
+		 * Contiguous block of memory to scan. Offsets of matches found in
+		 * the block are reported relative to @c base.
+		 */
+		struct MemoryBlock
+		{
+			const std::uint8_t* data = nullptr;
+			std::size_t size = 0;
+			std::uint64_t base = 0;
+		};
+
 	private:
 		/// compiler or text rules
 		YR_COMPILER *compiler = nullptr;
@@ -80,12 +93,16 @@ class YaraDetector
 		std::vector<YaraRule> undetectedRules;
 		/// rules from input text files
 		YR_RULES* textFilesRules = nullptr;
-		/// rules from precompiled files
-		std::vector<YR_RULES*> precompiledRules;
+		/// rules from precompiled files and shared compiled rules
+		std::vector<std::shared_ptr<YR_RULES>> precompiledRules;
 		/// internal state of instance
 		bool stateIsValid = true;
 		/// indicates whether text files need recompilation
 		bool needsRecompilation = true;
+		/// indicates whether any text rules were added
+		bool hasTextRules = false;
+
+		friend class YaraScanner;
 
 		/// @name Static auxiliary methods
 		/// @{
@@ -112,6 +129,7 @@ class YaraDetector
 		/// @name Other methods
 		/// @{
 		bool addRules(const char *string);
+		bool addRules(const std::shared_ptr<YR_RULES> &rules);
 		bool addRuleFile(
 				const std::string &pathToFile,
 				const std::string &nameSpace = std::string()
@@ -126,7 +144,11 @@ class YaraDetector
 				bool storeAllRules = false
 		);
 		bool analyze(
-				std::vector<std::uint8_t> &bytes,
+				const std::vector<std::uint8_t> &bytes,
+				bool storeAllRules = false
+		);
+		bool analyze(
+				const std::vector<MemoryBlock> &blocks,
 				bool storeAllRules = false
 		);
 		const std::vector<YaraRule>& getDetectedRules() const;
@@ -0,0 +1,48 @@
+/**
+ * @file include/retdec/yaracpp/yara_rules_cache.h
+ * @brief Process-wide cache of compiled YARA rules.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_YARACPP_YARA_RULES_CACHE_H
+#define RETDEC_YARACPP_YARA_RULES_CACHE_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+typedef struct YR_RULES YR_RULES;
+
+namespace retdec {
+namespace yaracpp {
+
+/**
+ * Process-wide cache of compiled YARA rules.
+ *
+ * Every rule file (precompiled or text) is loaded or compiled only once per
+ * process and the resulting rules are shared by all the users. An entry is
+ * reloaded when the modification time of its file changes.
+ *
+ * All the methods are thread-safe. Compiled rules are read-only during
+ * scanning, so the same rules may be used by several threads at once.
+ *
+ * The cache also owns the initialization of libyara, which is not
+ * thread-safe. Use @c initialize() instead of @c yr_initialize().
+ */
+class YaraRulesCache
+{
+	public:
+		using Rules = std::shared_ptr<YR_RULES>;
+
+	public:
+		static bool initialize();
+		static Rules getRules(const std::string& pathToFile);
+		static Rules getRules(const std::vector<std::string>& pathsToFiles);
+		static Rules getPrecompiledRules(const std::string& pathToFile);
+		static void clear();
+};
+
+} // namespace yaracpp
+} // namespace retdec
+
+#endif
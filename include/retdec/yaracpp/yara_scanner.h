@@ -0,0 +1,88 @@
+/**
+ * @file include/retdec/yaracpp/yara_scanner.h
+ * @brief Reusable scanner of compiled YARA rules.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_YARACPP_YARA_SCANNER_H
+#define RETDEC_YARACPP_YARA_SCANNER_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "retdec/yaracpp/yara_detector.h"
+#include "retdec/yaracpp/yara_rule.h"
+#include "retdec/yaracpp/yara_rules_cache.h"
+
+typedef struct YR_SCANNER YR_SCANNER;
+
+namespace retdec {
+namespace yaracpp {
+
+/**
+ * Scanner of one set of compiled rules (typically taken from
+ * @c YaraRulesCache). The underlying libyara scanner is created only once
+ * and reused for all the scanned inputs.
+ *
+ * Rules may be shared by any number of scanners, but one scanner must not
+ * be used by several threads at once.
+ */
+class YaraScanner
+{
+	public:
+		explicit YaraScanner(const YaraRulesCache::Rules& rules);
+		~YaraScanner();
+
+		YaraScanner(const YaraScanner&) = delete;
+		YaraScanner& operator=(const YaraScanner&) = delete;
+
+		/// @name Other methods
+		/// @{
+		bool isInValidState() const;
+		/// @}
+
+		/// @name Detection methods
+		/// @{
+		bool scan(
+				const std::uint8_t *data,
+				std::size_t size,
+				bool storeAllRules = false
+		);
+		bool scan(
+				const std::vector<std::uint8_t> &bytes,
+				bool storeAllRules = false
+		);
+		bool scan(
+				const std::vector<YaraDetector::MemoryBlock> &blocks,
+				bool storeAllRules = false
+		);
+		bool scanFile(
+				const std::string &pathToFile,
+				bool storeAllRules = false
+		);
+		const std::vector<YaraRule>& getDetectedRules() const;
+		const std::vector<YaraRule>& getUndetectedRules() const;
+		/// @}
+
+	private:
+		template <typename ScanFnc> bool doScan(
+				bool storeAllRules,
+				ScanFnc scanFnc
+		);
+
+	private:
+		/// scanned rules
+		YaraRulesCache::Rules rules;
+		/// libyara scanner
+		YR_SCANNER *scanner = nullptr;
+		/// representation of detected rules from the last scan
+		std::vector<YaraRule> detectedRules;
+		/// representation of undetected rules from the last scan
+		std::vector<YaraRule> undetectedRules;
+};
+
+} // namespace yaracpp
+} // namespace retdec
+
+#endif
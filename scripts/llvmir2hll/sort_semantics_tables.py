@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+"""Sorts tables of semantics in llvmir2hll by their keys.
+
+Tables of semantics are constexpr arrays of FuncCHeader, FuncParamName,
+FuncVarName, and FuncParamSymbolicNames, which are searched by binary search,
+so their entries have to be sorted by names of functions (and positions of
+parameters). The sorting is checked by static assertions during compilation.
+Run this script after adding entries to a table.
+
+Comment lines preceding an entry are moved together with the entry.
+Commented-out entries are sorted as well, so they stay next to the active
+entries of the same function.
+"""
+
+import argparse
+import glob
+import os
+import re
+import sys
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+SEMANTICS_DIR = os.path.join(SCRIPT_DIR, '..', '..', 'src', 'llvmir2hll',
+                             'semantics', 'semantics')
+
+TABLE_BEGIN_RE = re.compile(
+    r'^constexpr (FuncCHeader|FuncParamName|FuncVarName|FuncParamSymbolicNames)'
+    r' \w+\[\] = \{$')
+TABLE_END = '};'
+ENTRY_RE = re.compile(
+    r'^\t(?P<disabled>// )?\{"(?P<func>(?:[^"\\]|\\.)*)"'
+    r'(?:, (?P<pos>\d+))?, [^{}]*\},(?: //.*)?$')
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('files', nargs='*',
+                        help='Files with tables (default: all sources of semantics).')
+    parser.add_argument('--check', action='store_true',
+                        help='Only check that the tables are sorted, do not modify the files.')
+    return parser.parse_args()
+
+
+def entry_key(match):
+    pos = int(match.group('pos')) if match.group('pos') is not None else 0
+    return match.group('func'), pos
+
+
+def sort_table(lines, path, first_line):
+    """Returns sorted lines of the given table body, or None on an error."""
+    entries = []
+    comments = []
+    for i, line in enumerate(lines):
+        match = ENTRY_RE.match(line)
+        if match:
+            active = match.group('disabled') is None
+            entries.append((entry_key(match), active, comments + [line]))
+            comments = []
+        elif line.startswith('\t//'):
+            comments.append(line)
+        else:
+            print('{}:{}: unexpected line in a table: {}'.format(
+                path, first_line + i, line), file=sys.stderr)
+            return None
+
+    seen = set()
+    for key, active, _ in entries:
+        if active and key in seen:
+            print('{}: duplicate entry {}'.format(path, key), file=sys.stderr)
+            return None
+        if active:
+            seen.add(key)
+
+    # Commented-out entries go before the active entry with the same key. The
+    # sort is stable, so the order of equal entries is kept.
+    entries.sort(key=lambda e: (e[0], e[1]))
+    result = [line for _, _, entry_lines in entries for line in entry_lines]
+    # Comments after the last entry stay at the end.
+    return result + comments
+
+
+def sort_file(path, check):
+    """Sorts all tables in the given file. Returns False on an error."""
+    with open(path) as f:
+        lines = f.read().split('\n')
+
+    result = []
+    i = 0
+    while i < len(lines):
+        result.append(lines[i])
+        if not TABLE_BEGIN_RE.match(lines[i]):
+            i += 1
+            continue
+        end = lines.index(TABLE_END, i + 1)
+        sorted_lines = sort_table(lines[i + 1:end], path, i + 2)
+        if sorted_lines is None:
+            return False
+        result += sorted_lines
+        i = end
+
+    if result == lines:
+        return True
+    if check:
+        print('{}: tables are not sorted'.format(path), file=sys.stderr)
+        return False
+    with open(path, 'w') as f:
+        f.write('\n'.join(result))
+    print('Sorted {}'.format(path))
+    return True
+
+
+def main(args):
+    files = args.files or sorted(glob.glob(
+        os.path.join(SEMANTICS_DIR, '**', '*.cpp'), recursive=True))
+    ok = True
+    for path in files:
+        ok = sort_file(path, args.check) and ok
+    return 0 if ok else 1
+
+
+if __name__ == '__main__':
+    sys.exit(main(parse_args()))
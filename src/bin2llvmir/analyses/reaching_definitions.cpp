@@ -4,12 +4,17 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <algorithm>
+#include <atomic>
 #include <iomanip>
 #include <set>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
+#include <llvm/ADT/BitVector.h>
+#include <llvm/ADT/DenseMap.h>
 #include <llvm/ADT/PostOrderIterator.h>
 #include <llvm/IR/CFG.h>
 #include <llvm/IR/Instruction.h>
@@ -29,16 +34,289 @@ using namespace llvm;
 namespace retdec {
 namespace bin2llvmir {
 
+//
+//=============================================================================
+//  DenseReachingDefinitions
+//=============================================================================
+//
+
+namespace {
+
+/**
+ * Reaching definitions of one function in a dense representation, which is
+ * used only while they are computed.
+ *
+ * All definitions in the function are numbered so that definitions of the
+ * same source get consecutive numbers. Sets of definitions are bit vectors
+ * indexed by these numbers, and a basic block kills definitions of a source
+ * by clearing their range of bits.
+ */
+class DenseReachingDefinitions
+{
+	public:
+		DenseReachingDefinitions(std::vector<BasicBlockEntry>& bbs);
+
+		void propagate();
+		void initializeDefsAndUses();
+
+	private:
+		unsigned getIndex(const BasicBlockEntry* bbe) const;
+		void getDefsIn(unsigned bb, llvm::BitVector& defsIn) const;
+		Changed initDefsOut(unsigned bb, llvm::BitVector& tmp);
+
+	private:
+		std::vector<BasicBlockEntry>& _bbs;
+		/// Definitions by their numbers.
+		std::vector<Definition*> _defs;
+		/// Source -> its number.
+		llvm::DenseMap<const llvm::Value*, unsigned> _srcs;
+		/// Source number -> number of its first definition. The last item is
+		/// the number of all definitions.
+		std::vector<unsigned> _srcDefsBegin;
+		/// Basic block -> numbers of sources it defines.
+		std::vector<std::vector<unsigned>> _killSrcs;
+		/// Basic block -> numbers of its last definitions of sources.
+		std::vector<std::vector<unsigned>> _genDefs;
+		/// Basic block -> indexes of its successors.
+		std::vector<std::vector<unsigned>> _succs;
+		/// Basic block -> definitions reaching its end.
+		std::vector<llvm::BitVector> _defsOut;
+};
+
+DenseReachingDefinitions::DenseReachingDefinitions(
+		std::vector<BasicBlockEntry>& bbs) :
+		_bbs(bbs),
+		_killSrcs(bbs.size()),
+		_genDefs(bbs.size()),
+		_succs(bbs.size())
+{
+	std::vector<unsigned> srcDefsCount;
+	for (auto& bbe : _bbs)
+	for (auto& d : bbe.defs)
+	{
+		auto p = _srcs.insert({d.getSource(), srcDefsCount.size()});
+		if (p.second)
+		{
+			srcDefsCount.push_back(0);
+		}
+		++srcDefsCount[p.first->second];
+	}
+
+	_srcDefsBegin.resize(srcDefsCount.size() + 1, 0);
+	for (std::size_t i = 0; i < srcDefsCount.size(); ++i)
+	{
+		_srcDefsBegin[i + 1] = _srcDefsBegin[i] + srcDefsCount[i];
+	}
+	_defs.resize(_srcDefsBegin.back());
+
+	std::vector<unsigned> nextDef(_srcDefsBegin.begin(), _srcDefsBegin.end() - 1);
+	std::vector<unsigned> lastDef(srcDefsCount.size());
+	std::vector<unsigned> lastBb(srcDefsCount.size(), unsigned(-1));
+	for (unsigned bb = 0; bb < _bbs.size(); ++bb)
+	{
+		for (auto& d : _bbs[bb].defs)
+		{
+			auto src = _srcs.find(d.getSource())->second;
+			auto num = nextDef[src]++;
+			_defs[num] = &d;
+
+			if (lastBb[src] != bb)
+			{
+				lastBb[src] = bb;
+				_killSrcs[bb].push_back(src);
+			}
+			lastDef[src] = num;
+		}
+
+		for (auto src : _killSrcs[bb])
+		{
+			_genDefs[bb].push_back(lastDef[src]);
+		}
+
+		for (auto* p : _bbs[bb].prevBBs)
+		{
+			_succs[getIndex(p)].push_back(bb);
+		}
+	}
+
+	_defsOut.assign(_bbs.size(), llvm::BitVector(_defs.size()));
+}
+
+unsigned DenseReachingDefinitions::getIndex(const BasicBlockEntry* bbe) const
+{
+	return bbe - _bbs.data();
+}
+
+/**
+ * REACH_in[B] = Sum (p in pred[B]) (REACH_out[p])
+ */
+void DenseReachingDefinitions::getDefsIn(
+		unsigned bb,
+		llvm::BitVector& defsIn) const
+{
+	defsIn.reset();
+	for (auto* p : _bbs[bb].prevBBs)
+	{
+		defsIn |= _defsOut[getIndex(p)];
+	}
+}
+
+/**
+ * REACH_out[B] = GEN[B] + ( REACH_in[B] - KILL[B] )
+ */
+Changed DenseReachingDefinitions::initDefsOut(
+		unsigned bb,
+		llvm::BitVector& tmp)
+{
+	getDefsIn(bb, tmp);
+	for (auto src : _killSrcs[bb])
+	{
+		tmp.reset(_srcDefsBegin[src], _srcDefsBegin[src + 1]);
+	}
+	for (auto d : _genDefs[bb])
+	{
+		tmp.set(d);
+	}
+
+	if (tmp == _defsOut[bb])
+	{
+		return false;
+	}
+	std::swap(tmp, _defsOut[bb]);
+	return true;
+}
+
+/**
+ * Compute definitions reaching ends of basic blocks. Basic blocks wait in
+ * the worklist in reverse post-order, and a basic block is put back only when
+ * one of its predecessors changed. Unreachable basic blocks are not
+ * processed, so no definitions reach their ends.
+ */
+void DenseReachingDefinitions::propagate()
+{
+	const Function* fnc = _bbs.front().bb->getParent();
+
+	llvm::DenseMap<const BasicBlock*, unsigned> indexes;
+	for (unsigned bb = 0; bb < _bbs.size(); ++bb)
+	{
+		indexes[_bbs[bb].bb] = bb;
+	}
+
+	std::vector<unsigned> rpo;
+	rpo.reserve(_bbs.size());
+	std::vector<int> rpoPos(_bbs.size(), -1);
+	ReversePostOrderTraversal<const Function*> RPOT(fnc);
+	for (const BasicBlock* B : RPOT)
+	{
+		auto bb = indexes.find(B)->second;
+		rpoPos[bb] = rpo.size();
+		rpo.push_back(bb);
+	}
+
+	llvm::BitVector workList(rpo.size(), true);
+	llvm::BitVector tmp(_defs.size());
+	int pos = workList.find_first();
+	while (pos != -1)
+	{
+		workList.reset(pos);
+
+		auto bb = rpo[pos];
+		if (initDefsOut(bb, tmp))
+		{
+			for (auto succ : _succs[bb])
+			{
+				if (rpoPos[succ] != -1)
+				{
+					workList.set(rpoPos[succ]);
+				}
+			}
+		}
+
+		// Continue in reverse post-order, start again from the beginning when
+		// the end is reached.
+		int next = workList.find_next(pos);
+		pos = next != -1 ? next : workList.find_first();
+	}
+}
+
+void DenseReachingDefinitions::initializeDefsAndUses()
+{
+	llvm::BitVector defsIn(_defs.size());
+	for (unsigned bb = 0; bb < _bbs.size(); ++bb)
+	{
+		BasicBlockEntry& bbe = _bbs[bb];
+		bool defsInComputed = false;
+
+		for (Use& u : bbe.uses)
+		{
+			for (auto dIt = bbe.defs.rbegin(); dIt != bbe.defs.rend(); ++dIt)
+			{
+				Definition& d = *dIt;
+
+				if (d.getSource() != u.src)
+				{
+					continue;
+				}
+
+				if (d.dominates(&u))
+				{
+					d.uses.insert(&u);
+					u.defs.insert(&d);
+					break;
+				}
+			}
+
+			if (!u.defs.empty())
+			{
+				continue;
+			}
+
+			auto src = _srcs.find(u.src);
+			if (src == _srcs.end())
+			{
+				continue;
+			}
+
+			if (!defsInComputed)
+			{
+				getDefsIn(bb, defsIn);
+				defsInComputed = true;
+			}
+
+			auto end = _srcDefsBegin[src->second + 1];
+			for (int i = defsIn.find_first_in(_srcDefsBegin[src->second], end);
+					i != -1;
+					i = defsIn.find_first_in(i + 1, end))
+			{
+				Definition* d = _defs[i];
+				d->uses.insert(&u);
+				u.defs.insert(d);
+			}
+		}
+	}
+}
+
+} // anonymous namespace
+
 //
 //=============================================================================
 //  ReachingDefinitionsAnalysis
 //=============================================================================
 //
 
+/**
+ * Run the analysis on all functions in module @a M.
+ * @param M Module to analyze.
+ * @param abi ABI used to recognize flag registers.
+ * @param trackFlagRegs Should flag registers be tracked?
+ * @param jobs Number of threads analyzing the functions. Instructions are
+ *             collected in this thread, so @a abi is never used concurrently.
+ */
 bool ReachingDefinitionsAnalysis::runOnModule(
 		Module& M,
 		Abi* abi,
-		bool trackFlagRegs)
+		bool trackFlagRegs,
+		unsigned jobs)
 {
 	_trackFlagRegs = trackFlagRegs;
 	_abi = abi;
@@ -46,7 +324,7 @@ bool ReachingDefinitionsAnalysis::runOnModule(
 
 	clear();
 	initializeBasicBlocks(M);
-	run();
+	run(jobs);
 
 	_run = true;
 	return false;
@@ -69,16 +347,42 @@ bool ReachingDefinitionsAnalysis::runOnFunction(
 	return false;
 }
 
-void ReachingDefinitionsAnalysis::run()
+void ReachingDefinitionsAnalysis::run(unsigned jobs)
 {
-	initializeBasicBlocksPrev();
-	initializeKillGenSets();
-	propagate();
-	initializeDefsAndUses();
+	auto threadCount = std::min<std::size_t>(jobs, fncBbs.size());
+	if (threadCount <= 1)
+	{
+		for (auto& bbs : fncBbs)
+		{
+			analyzeFunction(bbs);
+		}
+	}
+	else
+	{
+		// Functions do not share any data, so they are simply distributed
+		// among threads.
+		std::atomic<std::size_t> nextFnc(0);
+		auto worker = [this, &nextFnc]()
+		{
+			for (auto i = nextFnc++; i < fncBbs.size(); i = nextFnc++)
+			{
+				analyzeFunction(fncBbs[i]);
+			}
+		};
 
-	LOG << *this << "\n";
+		std::vector<std::thread> threads;
+		for (std::size_t i = 1; i < threadCount; ++i)
+		{
+			threads.emplace_back(worker);
+		}
+		worker();
+		for (auto& t : threads)
+		{
+			t.join();
+		}
+	}
 
-	clearInternal();
+	LOG << *this << "\n";
 }
 
 void ReachingDefinitionsAnalysis::initializeBasicBlocks(llvm::Module& M)
@@ -91,9 +395,20 @@ void ReachingDefinitionsAnalysis::initializeBasicBlocks(llvm::Module& M)
 
 void ReachingDefinitionsAnalysis::initializeBasicBlocks(llvm::Function& F)
 {
+	if (F.empty())
+	{
+		return;
+	}
+
+	fncBbs.emplace_back();
+	auto& bbs = fncBbs.back();
+	bbs.reserve(F.size());
+
 	for (BasicBlock& B : F)
 	{
-		BasicBlockEntry bbe(&B, bbMap.size());
+		bbs.emplace_back(&B, bbs.size());
+		auto& bbe = bbs.back();
+		bbMap[&B] = &bbe;
 
 		int insnPos = -1;
 		for (Instruction& I : B)
@@ -199,13 +514,27 @@ void ReachingDefinitionsAnalysis::initializeBasicBlocks(llvm::Function& F)
 				// Maybe, there are other users or definitions.
 			}
 		}
+	}
+
+	for (auto& bbe : bbs)
+	{
+		for (auto* pred : predecessors(bbe.bb))
+		{
+			auto p = bbMap.find(pred);
+			assert(p != bbMap.end() && "we should have all BBs stored in bbMap");
 
-		bbMap[&F][&B] = bbe;
+			auto& prevBBs = bbe.prevBBs;
+			if (std::find(prevBBs.begin(), prevBBs.end(), p->second) == prevBBs.end())
+			{
+				prevBBs.push_back(p->second);
+			}
+		}
 	}
 }
 
 void ReachingDefinitionsAnalysis::clear()
 {
+	fncBbs.clear();
 	bbMap.clear();
 	_run = false;
 }
@@ -216,136 +545,25 @@ bool ReachingDefinitionsAnalysis::wasRun() const
 }
 
 /**
- * Clear internal structures used to compute RDA, but not needed to use it once
- * it is computed.
+ * Compute definitions reaching uses in one function and link them together.
+ * The function's basic blocks are not shared with any other function, so
+ * functions can be analyzed concurrently.
  */
-void ReachingDefinitionsAnalysis::clearInternal()
+void ReachingDefinitionsAnalysis::analyzeFunction(
+		std::vector<BasicBlockEntry>& bbs)
 {
-	for (auto& pair1 : bbMap)
-	for (auto& pair : pair1.second)
-	{
-		BasicBlockEntry& bb = pair.second;
-		bb.defsOut.clear();
-		bb.genDefs.clear();
-		bb.killDefs.clear();
-	}
-}
-
-void ReachingDefinitionsAnalysis::initializeBasicBlocksPrev()
-{
-	for (auto &pair1 : bbMap)
-	for (auto& pair : pair1.second)
-	{
-		auto B = pair.first;
-		auto &entry = pair.second;
-
-		for (auto PI = pred_begin(B), E = pred_end(B); PI != E; ++PI)
-		{
-			auto* pred = *PI;
-			auto p = pair1.second.find(pred);
-
-			assert(p != pair1.second.end() && "we should have all BBs stored in bbMap");
-
-			entry.prevBBs.insert( &p->second );
-		}
-	}
-}
-
-void ReachingDefinitionsAnalysis::initializeKillGenSets()
-{
-	for (auto &pair1 : bbMap)
-	for (auto& pair : pair1.second)
-	{
-		pair.second.initializeKillDefSets();
-	}
-}
-
-void ReachingDefinitionsAnalysis::propagate()
-{
-	for (auto &pair1 : bbMap)
-	{
-		const Function* fnc = pair1.first;
-
-		std::vector<BasicBlockEntry*> workList;
-		workList.reserve(pair1.second.size());
-		ReversePostOrderTraversal<const Function*> RPOT(fnc); // Expensive to create
-		for (auto I = RPOT.begin(); I != RPOT.end(); ++I)
-		{
-			const BasicBlock* bb = *I;
-			auto fIt = pair1.second.find(bb);
-			assert(fIt != pair1.second.end());
-			workList.push_back(&(fIt->second));
-
-			fIt->second.changed = true;
-		}
-
-		bool changed = true;
-		while (changed)
-		{
-			changed = false;
-
-			for (auto* bbe : workList)
-			{
-				changed |= bbe->initDefsOut();
-			}
-		}
-	}
-}
-
-void ReachingDefinitionsAnalysis::initializeDefsAndUses()
-{
-	for (auto &pair1 : bbMap)
-	for (auto& pair : pair1.second)
-	{
-		BasicBlockEntry &bb = pair.second;
-
-		for (Use &u : bb.uses)
-		{
-			for (auto dIt = bb.defs.rbegin(); dIt != bb.defs.rend(); ++dIt)
-			{
-				Definition &d = *dIt;
-
-				if (d.getSource() != u.src)
-				{
-					continue;
-				}
-
-				if (d.dominates(&u))
-				{
-					d.uses.insert(&u);
-					u.defs.insert(&d);
-					break;
-				}
-			}
-
-			if (u.defs.empty())
-			{
-				for (auto p : bb.prevBBs)
-				for (auto d : p->defsOut)
-				{
-					if (d->getSource() == u.src)
-					{
-						d->uses.insert(&u);
-						u.defs.insert(d);
-					}
-				}
-			}
-		}
-	}
+	DenseReachingDefinitions rd(bbs);
+	rd.propagate();
+	rd.initializeDefsAndUses();
 }
 
 const BasicBlockEntry& ReachingDefinitionsAnalysis::getBasicBlockEntry(
 		const Instruction* I) const
 {
-	auto* F = I->getFunction();
-	auto pair1 = bbMap.find(F);
-	assert(pair1 != bbMap.end() && "we do not have this function in bbMap");
-
-	auto* BB = I->getParent();
-	auto pair = pair1->second.find(BB);
-	assert(pair != pair1->second.end() && "we do not have this basic block in bbMap");
+	auto pair = bbMap.find(I->getParent());
+	assert(pair != bbMap.end() && "we do not have this basic block in bbMap");
 
-	return pair->second;
+	return *pair->second;
 }
 
 const DefSet& ReachingDefinitionsAnalysis::defsFromUse(const Instruction* I) const
@@ -370,10 +588,10 @@ const Use* ReachingDefinitionsAnalysis::getUse(const Instruction* I) const
 
 std::ostream& operator<<(std::ostream& out, const ReachingDefinitionsAnalysis& rda)
 {
-	for (auto &pair1 : rda.bbMap)
-	for (auto& pair : pair1.second)
+	for (auto& bbs : rda.fncBbs)
+	for (auto& bbe : bbs)
 	{
-		out << pair.second;
+		out << bbe;
 	}
 	return out;
 }
@@ -391,54 +609,6 @@ BasicBlockEntry::BasicBlockEntry(const llvm::BasicBlock* b, std::size_t _id) :
 
 }
 
-void BasicBlockEntry::initializeKillDefSets()
-{
-	killDefs.clear();
-	genDefs.clear();
-
-	for (auto dIt = defs.rbegin(); dIt != defs.rend(); ++dIt)
-	{
-		Definition& d = *dIt;
-
-		bool added = (killDefs.insert(d.getSource())).second;
-		if (added)
-		{
-			genDefs.insert(&d);
-		}
-	}
-}
-
-/**
- * REACH_in[B] = Sum (p in pred[B]) (REACH_out[p])
- * REACH_out[B] = GEN[B] + ( REACH_in[B] - KILL[B] )
- */
-Changed BasicBlockEntry::initDefsOut()
-{
-	auto oldSz = defsOut.size();
-
-	if (defsOut.empty() && !genDefs.empty())
-	{
-		defsOut = std::move(genDefs);
-	}
-
-	for (auto* p : prevBBs)
-	{
-		if (p->changed)
-		{
-			for (auto* d : p->defsOut)
-			{
-				if (killDefs.find(d->getSource()) == killDefs.end())
-				{
-					defsOut.insert(d);
-				}
-			}
-		}
-	}
-
-	changed = oldSz != defsOut.size();
-	return changed;
-}
-
 std::string BasicBlockEntry::getName() const
 {
 	std::stringstream out;
@@ -4,12 +4,15 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
 #include <ostream>
 #include <sstream>
 
+#include <llvm/ADT/Hashing.h>
 #include <llvm/IR/Constants.h>
 #include <llvm/IR/LLVMContext.h>
 #include <llvm/IR/Operator.h>
+#include <llvm/IR/ValueHandle.h>
 
 #include "retdec/utils/string.h"
 #include "retdec/bin2llvmir/analyses/symbolic_tree.h"
@@ -27,6 +30,13 @@ using namespace retdec::bin2llvmir::st_match;
 namespace retdec {
 namespace bin2llvmir {
 
+namespace {
+
+/// Trees with fewer nodes are simplified without memoized simplifications.
+const std::size_t MIN_MEMOIZED_TREE_SIZE = 32;
+
+} // anonymous namespace
+
 SymbolicTree SymbolicTree::PrecomputedRda(
 		ReachingDefinitionsAnalysis& rda,
 		llvm::Value* v,
@@ -35,6 +45,15 @@ SymbolicTree SymbolicTree::PrecomputedRda(
 	return SymbolicTree(&rda, v, nullptr, 0, maxNodeLevel, nullptr, false);
 }
 
+SymbolicTree SymbolicTree::PrecomputedRda(
+		SymbolicTreeCache& cache,
+		ReachingDefinitionsAnalysis& rda,
+		llvm::Value* v,
+		unsigned maxNodeLevel)
+{
+	return cache.construct(&rda, v, maxNodeLevel, false);
+}
+
 SymbolicTree SymbolicTree::PrecomputedRdaWithValueMap(
 		ReachingDefinitionsAnalysis& rda,
 		llvm::Value* v,
@@ -52,6 +71,14 @@ SymbolicTree SymbolicTree::OnDemandRda(
 	return SymbolicTree(nullptr, v, nullptr, 0, maxNodeLevel, nullptr, false);
 }
 
+SymbolicTree SymbolicTree::OnDemandRda(
+		SymbolicTreeCache& cache,
+		llvm::Value* v,
+		unsigned maxNodeLevel)
+{
+	return cache.construct(nullptr, v, maxNodeLevel, false);
+}
+
 SymbolicTree SymbolicTree::Linear(
 		llvm::Value* v,
 		unsigned maxNodeLevel)
@@ -59,6 +86,14 @@ SymbolicTree SymbolicTree::Linear(
 	return SymbolicTree(nullptr, v, nullptr, 0, maxNodeLevel, nullptr, true);
 }
 
+SymbolicTree SymbolicTree::Linear(
+		SymbolicTreeCache& cache,
+		llvm::Value* v,
+		unsigned maxNodeLevel)
+{
+	return cache.construct(nullptr, v, maxNodeLevel, true);
+}
+
 SymbolicTree::SymbolicTree(
 		ReachingDefinitionsAnalysis* rda,
 		llvm::Value* v,
@@ -93,6 +128,14 @@ SymbolicTree::SymbolicTree(
 	expandNode(rda, val2val, maxNodeLevel, linear);
 }
 
+SymbolicTree::SymbolicTree(llvm::Value* v, llvm::Value* u, unsigned nodeLevel) :
+		value(v),
+		user(u),
+		_level(nodeLevel)
+{
+
+}
+
 unsigned SymbolicTree::getLevel() const
 {
 	return _level;
@@ -104,6 +147,7 @@ SymbolicTree& SymbolicTree::operator=(SymbolicTree&& other)
 	{
 		value = other.value;
 		user = other.user;
+		_node = other._node;
 		// Do NOT use `ops = std::move(other.ops);` to allow use like
 		// `*this = ops[0];`. Use std::swap() instead.
 		std::swap(ops, other.ops);
@@ -143,6 +187,56 @@ void SymbolicTree::expandNode(
 		std::map<llvm::Value*, llvm::Value*>* val2val,
 		unsigned maxNodeLevel,
 		bool linear)
+{
+	llvm::SmallVector<llvm::Value*, 4> defs;
+	expandValue(
+			value,
+			[&](LoadInst* l) -> ArrayRef<Value*>
+			{
+				findLoadDefs(l, RDA, linear, defs);
+				return defs;
+			},
+			[&](Value* v, Value* u)
+			{
+				ops.emplace_back(
+						RDA,
+						v,
+						u,
+						getLevel() + 1,
+						maxNodeLevel,
+						val2val,
+						linear);
+			},
+			[&](Value* v, Value* u)
+			{
+				*this = SymbolicTree(
+						RDA,
+						v,
+						u,
+						getLevel(),
+						maxNodeLevel,
+						val2val,
+						linear);
+			},
+			linear);
+}
+
+/**
+ * Expands @a value into a symbolic tree node. This is common for trees
+ * constructed with and without @c SymbolicTreeCache.
+ * @param value     Value to expand.
+ * @param loadDefs  Returns definitions reaching the given load.
+ * @param addOp     Adds an operand (value, user) to the node.
+ * @param replace   Replaces the node by the given (value, user) at the same
+ *                  level. Nothing else is done after the replacement.
+ * @param linear    Linear tree construction is used.
+ */
+void SymbolicTree::expandValue(
+		llvm::Value* value,
+		llvm::function_ref<llvm::ArrayRef<llvm::Value*>(llvm::LoadInst*)> loadDefs,
+		llvm::function_ref<void(llvm::Value*, llvm::Value*)> addOp,
+		llvm::function_ref<void(llvm::Value*, llvm::Value*)> replace,
+		bool linear)
 {
 	if (auto* l = dyn_cast<LoadInst>(value))
 	{
@@ -167,136 +261,27 @@ void SymbolicTree::expandNode(
 			return;
 		}
 
-		if (linear)
-		{
-			std::unordered_set<BasicBlock*> seenBbs;
-			auto* bb = l->getParent();
-			Instruction* prev = l;
-			while (prev)
-			{
-				auto* s = dyn_cast<StoreInst>(prev);
-				if (s && s->getPointerOperand() == l->getPointerOperand())
-				{
-					ops.emplace_back(
-							RDA,
-							s,
-							l,
-							getLevel() + 1,
-							maxNodeLevel,
-							val2val,
-							linear);
-					break;
-				}
-
-				prev = prev->getPrevNode();
-
-				if (prev == nullptr)
-				{
-					seenBbs.insert(bb);
-
-					bb = bb->getSinglePredecessor();
-					if (bb && seenBbs.count(bb) == 0)
-					{
-						prev = &bb->back();
-					}
-				}
-			}
-		}
-		else if (RDA && RDA->wasRun())
+		auto defs = loadDefs(l);
+		for (auto* d : defs)
 		{
-			auto defs = RDA->defsFromUse(l);
-			if (defs.size() > _naryLimit)
-			{
-// TODO!!! replace with invalid tree
-				ops.emplace_back(
-						RDA,
-						UndefValue::get(l->getType()),
-						l,
-						getLevel() + 1,
-						maxNodeLevel,
-						val2val,
-						linear);
-				return;
-			}
-			else
-			for (auto* d : defs)
-			{
-				ops.emplace_back(
-						RDA,
-						d->def,
-						l,
-						getLevel() + 1,
-						maxNodeLevel,
-						val2val,
-						linear);
-			}
-		}
-		else
-		{
-			auto defs = ReachingDefinitionsAnalysis::defsFromUse_onDemand(l);
-			if (defs.size() > _naryLimit)
-			{
-// TODO!!! replace with invalid tree
-				ops.emplace_back(
-						RDA,
-						UndefValue::get(l->getType()),
-						l,
-						getLevel() + 1,
-						maxNodeLevel,
-						val2val,
-						linear);
-				return;
-			}
-
-			for (auto* d : defs)
-			{
-				ops.emplace_back(
-						RDA,
-						d,
-						l,
-						getLevel() + 1,
-						maxNodeLevel,
-						val2val,
-						linear);
-			}
+			addOp(d, l);
 		}
 
 // TODO!!!!! Do not replace register with their default values down the line.
-		if (!linear && ops.empty())
+		if (!linear && defs.empty())
 		{
-			ops.emplace_back(
-					RDA,
-					l->getPointerOperand(),
-					l,
-					getLevel() + 1,
-					maxNodeLevel,
-					val2val,
-					linear);
+			addOp(l->getPointerOperand(), l);
 		}
 	}
 	else if (auto* s = dyn_cast<StoreInst>(value))
 	{
 		if (_simplifyAtCreation)
 		{
-			*this = SymbolicTree(
-					RDA,
-					s->getValueOperand(),
-					s,
-					getLevel(),
-					maxNodeLevel,
-					val2val,
-					linear);
+			replace(s->getValueOperand(), s);
 		}
 		else
 		{
-			ops.emplace_back(
-					RDA,
-					s->getValueOperand(),
-					s,
-					getLevel() + 1,
-					maxNodeLevel,
-					val2val,
-					linear);
+			addOp(s->getValueOperand(), s);
 		}
 	}
 	else if (isa<AllocaInst>(value)
@@ -313,34 +298,92 @@ void SymbolicTree::expandNode(
 			&& (isa<CastInst>(value) || isa<ConstantExpr>(value)))
 	{
 		auto* U = cast<User>(value);
-		*this = SymbolicTree(
-				RDA,
-				U->getOperand(0),
-				U,
-				getLevel(),
-				maxNodeLevel,
-				val2val,
-				linear);
+		replace(U->getOperand(0), U);
 	}
 	else if (User* U = dyn_cast<User>(value))
 	{
 		for (unsigned i = 0; i < U->getNumOperands(); ++i)
 		{
-			ops.emplace_back(
-					RDA,
-					U->getOperand(i),
-					U,
-					getLevel() + 1,
-					maxNodeLevel,
-					val2val,
-					linear);
+			addOp(U->getOperand(i), U);
+		}
+	}
+}
+
+/**
+ * Finds definitions reaching load @a l. If there are too many of them, only
+ * undefined value is returned.
+ */
+void SymbolicTree::findLoadDefs(
+		llvm::LoadInst* l,
+		ReachingDefinitionsAnalysis* RDA,
+		bool linear,
+		llvm::SmallVectorImpl<llvm::Value*>& defs)
+{
+	defs.clear();
+
+	if (linear)
+	{
+		std::unordered_set<BasicBlock*> seenBbs;
+		auto* bb = l->getParent();
+		Instruction* prev = l;
+		while (prev)
+		{
+			auto* s = dyn_cast<StoreInst>(prev);
+			if (s && s->getPointerOperand() == l->getPointerOperand())
+			{
+				defs.push_back(s);
+				break;
+			}
+
+			prev = prev->getPrevNode();
+
+			if (prev == nullptr)
+			{
+				seenBbs.insert(bb);
+
+				bb = bb->getSinglePredecessor();
+				if (bb && seenBbs.count(bb) == 0)
+				{
+					prev = &bb->back();
+				}
+			}
+		}
+	}
+	else if (RDA && RDA->wasRun())
+	{
+		auto& rdaDefs = RDA->defsFromUse(l);
+		if (rdaDefs.size() > _naryLimit)
+		{
+// TODO!!! replace with invalid tree
+			defs.push_back(UndefValue::get(l->getType()));
+		}
+		else
+		for (auto* d : rdaDefs)
+		{
+			defs.push_back(d->def);
+		}
+	}
+	else
+	{
+		auto rdaDefs = ReachingDefinitionsAnalysis::defsFromUse_onDemand(l);
+		if (rdaDefs.size() > _naryLimit)
+		{
+// TODO!!! replace with invalid tree
+			defs.push_back(UndefValue::get(l->getType()));
+		}
+		else
+		{
+			defs.append(rdaDefs.begin(), rdaDefs.end());
 		}
 	}
 }
 
 void SymbolicTree::simplifyNode()
 {
-	_simplifyNode();
+	if (!SymbolicTreeCache::simplify(*this))
+	{
+		_simplifyNode();
+	}
 	fixLevel();
 }
 
@@ -356,6 +399,19 @@ void SymbolicTree::_simplifyNode()
 		o._simplifyNode();
 	}
 
+	_simplifyTopNode();
+}
+
+/**
+ * Simplifies only this node, its operands must be already simplified.
+ */
+void SymbolicTree::_simplifyTopNode()
+{
+	if (ops.empty())
+	{
+		return;
+	}
+
 	if (isa<LoadInst>(value) && ops.size() > 1)
 	{
 		bool allEq = true;
@@ -693,20 +749,417 @@ bool SymbolicTree::isNary(unsigned N) const
 	return ops.size() == N;
 }
 
+//
+//==============================================================================
+// SymbolicTreeCache
+//==============================================================================
+//
+
+struct SymbolicTreeCache::Node
+{
+	/// Key this node is interned under.
+	Key key;
+	/// Value of the node, it differs from key value if the node was replaced
+	/// by its operand at creation.
+	llvm::Value* value = nullptr;
+	llvm::Value* user = nullptr;
+	std::vector<Node*> ops;
+	/// Nodes using this node as their operand or their replacement.
+	std::vector<Node*> parents;
+	/// Node this node was replaced by at creation.
+	Node* alias = nullptr;
+	/// Number of nodes in the tree materialized from this node.
+	std::size_t treeSize = 1;
+	/// Cache owning this node.
+	SymbolicTreeCache* cache = nullptr;
+	/// Memoized simplified subtree.
+	std::unique_ptr<SymbolicTree> simplified;
+};
+
+/**
+ * Invalidates nodes of a value when it is deleted or replaced.
+ */
+class SymbolicTreeCache::ValueHandle : public llvm::CallbackVH
+{
+	public:
+		ValueHandle(llvm::Value* v, SymbolicTreeCache* cache) :
+				CallbackVH(v),
+				_cache(cache)
+		{
+
+		}
+
+		void deleted() override
+		{
+			// This handle is destroyed by the invalidation.
+			_cache->invalidate(getValPtr());
+		}
+
+		void allUsesReplacedWith(llvm::Value*) override
+		{
+			_cache->invalidate(getValPtr());
+		}
+
+	private:
+		SymbolicTreeCache* _cache = nullptr;
+};
+
+bool SymbolicTreeCache::Key::operator==(const Key& o) const
+{
+	return value == o.value && user == o.user && levels == o.levels;
+}
+
+std::size_t SymbolicTreeCache::KeyHash::operator()(const Key& k) const
+{
+	return llvm::hash_combine(k.value, k.user, k.levels);
+}
+
+bool SymbolicTreeCache::Context::operator==(const Context& o) const
+{
+	return rda == o.rda
+			&& linear == o.linear
+			&& configuration == o.configuration;
+}
+
+bool SymbolicTreeCache::Context::operator!=(const Context& o) const
+{
+	return !(*this == o);
+}
+
+SymbolicTreeCache::SymbolicTreeCache()
+{
+
+}
+
+SymbolicTreeCache::~SymbolicTreeCache() = default;
+
+/**
+ * Invalidates all nodes containing the given value, e.g. because operands
+ * of the value were changed.
+ */
+void SymbolicTreeCache::invalidate(llvm::Value* v)
+{
+	if (auto* l = dyn_cast<LoadInst>(v))
+	{
+		_loadDefs.erase(l);
+	}
+	// If this is called from the handle of the value, the handle is destroyed
+	// here -- it must not be used afterwards.
+	_handles.erase(v);
+
+	auto vIt = _valueNodes.find(v);
+	if (vIt == _valueNodes.end())
+	{
+		return;
+	}
+	std::vector<Node*> worklist = std::move(vIt->second);
+	_valueNodes.erase(vIt);
+
+	std::unordered_set<Node*> dead;
+	while (!worklist.empty())
+	{
+		auto* n = worklist.back();
+		worklist.pop_back();
+		if (dead.insert(n).second)
+		{
+			worklist.insert(worklist.end(), n->parents.begin(), n->parents.end());
+		}
+	}
+
+	auto unlink = [&dead](Node* n, Node* op)
+	{
+		if (op && dead.count(op) == 0)
+		{
+			auto& ps = op->parents;
+			ps.erase(std::remove(ps.begin(), ps.end(), n), ps.end());
+		}
+	};
+
+	std::vector<Key> deadKeys;
+	deadKeys.reserve(dead.size());
+	for (auto* n : dead)
+	{
+		for (auto* op : n->ops)
+		{
+			unlink(n, op);
+		}
+		unlink(n, n->alias);
+
+		for (auto* k : {n->key.value, n->key.user})
+		{
+			auto kIt = k && k != v ? _valueNodes.find(k) : _valueNodes.end();
+			if (kIt == _valueNodes.end())
+			{
+				continue;
+			}
+			auto& ns = kIt->second;
+			ns.erase(std::remove(ns.begin(), ns.end(), n), ns.end());
+			if (ns.empty())
+			{
+				_valueNodes.erase(kIt);
+				_handles.erase(k);
+			}
+		}
+
+		if (auto* l = dyn_cast<LoadInst>(n->key.value))
+		{
+			_loadDefs.erase(l);
+		}
+		deadKeys.push_back(n->key);
+	}
+
+	for (auto& k : deadKeys)
+	{
+		_nodes.erase(k);
+	}
+}
+
+/**
+ * Removes all nodes from the cache.
+ */
+void SymbolicTreeCache::clear()
+{
+	_nodes.clear();
+	_valueNodes.clear();
+	_loadDefs.clear();
+	_handles.clear();
+}
+
+/**
+ * @return Number of interned nodes.
+ */
+std::size_t SymbolicTreeCache::size() const
+{
+	return _nodes.size();
+}
+
+SymbolicTreeCache::Context SymbolicTreeCache::currentContext(
+		ReachingDefinitionsAnalysis* rda,
+		bool linear)
+{
+	Context c;
+	// RDA which was not run yet is not used at all.
+	c.rda = rda && rda->wasRun() ? rda : nullptr;
+	c.linear = linear;
+	c.configuration = SymbolicTree::_configuration;
+	return c;
+}
+
+SymbolicTree SymbolicTreeCache::construct(
+		ReachingDefinitionsAnalysis* rda,
+		llvm::Value* v,
+		unsigned maxNodeLevel,
+		bool linear)
+{
+	auto context = currentContext(rda, linear);
+	if (context != _context)
+	{
+		clear();
+		_context = context;
+	}
+
+	auto& node = getNode(v, nullptr, maxNodeLevel);
+	SymbolicTree tree(node->value, node->user, 0);
+	materialize(node.get(), tree);
+	tree._node = node;
+	return tree;
+}
+
+const std::shared_ptr<SymbolicTreeCache::Node>& SymbolicTreeCache::getNode(
+		llvm::Value* v,
+		llvm::Value* u,
+		unsigned levels)
+{
+	Key key{v, u, levels};
+	auto fIt = _nodes.find(key);
+	if (fIt != _nodes.end())
+	{
+		return fIt->second;
+	}
+
+	// References to elements are not invalidated by the insertions made by
+	// the expansion.
+	auto& ptr = _nodes.emplace(key, std::make_shared<Node>()).first->second;
+	auto* node = ptr.get();
+	node->key = key;
+	node->value = v;
+	node->user = u;
+	node->cache = this;
+
+	_valueNodes[v].push_back(node);
+	trackValue(v);
+	if (u)
+	{
+		_valueNodes[u].push_back(node);
+		trackValue(u);
+	}
+
+	expandNode(node);
+	return ptr;
+}
+
+void SymbolicTreeCache::trackValue(llvm::Value* v)
+{
+	// Constant data are never changed.
+	if (!isa<ConstantData>(v) && _handles.count(v) == 0)
+	{
+		_handles.emplace(v, std::make_unique<ValueHandle>(v, this));
+	}
+}
+
+void SymbolicTreeCache::addOperand(Node* node, Node* op)
+{
+	node->ops.push_back(op);
+	node->treeSize += op->treeSize;
+	op->parents.push_back(node);
+}
+
+/**
+ * Replaces @a node by @a target -- it has the same value, user and operands.
+ */
+void SymbolicTreeCache::aliasNode(Node* node, Node* target)
+{
+	node->value = target->value;
+	node->user = target->user;
+	node->ops = target->ops;
+	node->treeSize = target->treeSize;
+	node->alias = target;
+	target->parents.push_back(node);
+}
+
+void SymbolicTreeCache::expandNode(Node* node)
+{
+	auto levels = node->key.levels;
+	if (levels == 0)
+	{
+		return;
+	}
+
+	SymbolicTree::expandValue(
+			node->value,
+			[this](LoadInst* l)
+			{
+				return getLoadDefs(l);
+			},
+			[this, node, levels](Value* v, Value* u)
+			{
+				addOperand(node, getNode(v, u, levels - 1).get());
+			},
+			[this, node, levels](Value* v, Value* u)
+			{
+				aliasNode(node, getNode(v, u, levels).get());
+			},
+			_context.linear);
+}
+
+/**
+ * @return Definitions reaching load @a l, they are found only once.
+ */
+llvm::ArrayRef<llvm::Value*> SymbolicTreeCache::getLoadDefs(llvm::LoadInst* l)
+{
+	auto fIt = _loadDefs.find(l);
+	if (fIt == _loadDefs.end())
+	{
+		fIt = _loadDefs.emplace(l, llvm::SmallVector<llvm::Value*, 2>()).first;
+		SymbolicTree::findLoadDefs(
+				l,
+				_context.rda,
+				_context.linear,
+				fIt->second);
+	}
+	return fIt->second;
+}
+
+/**
+ * Creates operands of @a tree from operands of @a node.
+ */
+void SymbolicTreeCache::materialize(const Node* node, SymbolicTree& tree) const
+{
+	tree.ops.reserve(node->ops.size());
+	for (auto* op : node->ops)
+	{
+		tree.ops.emplace_back(op->value, op->user, tree.getLevel() + 1);
+		materialize(op, tree.ops.back());
+	}
+}
+
+/**
+ * @return Simplified subtree of @a node, it is computed only once.
+ */
+const SymbolicTree& SymbolicTreeCache::getSimplified(Node* node)
+{
+	if (node->simplified == nullptr)
+	{
+		SymbolicTree tree(node->value, node->user, 0);
+		tree.ops.reserve(node->ops.size());
+		for (auto* op : node->ops)
+		{
+			tree.ops.push_back(getSimplified(op));
+		}
+		tree._simplifyTopNode();
+		node->simplified = std::make_unique<SymbolicTree>(std::move(tree));
+	}
+	return *node->simplified;
+}
+
+/**
+ * Simplifies @a tree using memoized simplifications of the node it was
+ * materialized from. This is possible only if the tree was not changed since
+ * and if it is simplified in the same context it was constructed in.
+ * @return @c True if the tree was simplified, @c false otherwise.
+ */
+bool SymbolicTreeCache::simplify(SymbolicTree& tree)
+{
+	auto node = tree._node.lock();
+	// Copying memoized simplification of a small tree is not faster than
+	// simplifying it.
+	if (node == nullptr
+			|| node->treeSize < MIN_MEMOIZED_TREE_SIZE
+			|| node->cache->_context.configuration
+					!= SymbolicTree::_configuration)
+	{
+		return false;
+	}
+
+	std::vector<std::pair<const SymbolicTree*, const Node*>> worklist;
+	worklist.emplace_back(&tree, node.get());
+	while (!worklist.empty())
+	{
+		auto [t, n] = worklist.back();
+		worklist.pop_back();
+		if (t->value != n->value
+				|| t->user != n->user
+				|| t->ops.size() != n->ops.size())
+		{
+			return false;
+		}
+		for (std::size_t i = 0; i < t->ops.size(); ++i)
+		{
+			worklist.emplace_back(&t->ops[i], n->ops[i]);
+		}
+	}
+
+	auto simplified = node->cache->getSimplified(node.get());
+	tree = std::move(simplified);
+	tree._node.reset();
+	return true;
+}
+
 //
 //==============================================================================
 // Static methods.
 //==============================================================================
 //
 
-Abi* SymbolicTree::_abi = nullptr;
-Config* SymbolicTree::_config = nullptr;
-bool SymbolicTree::_val2valUsed = false;
-bool SymbolicTree::_trackThroughAllocaLoads = true;
-bool SymbolicTree::_trackThroughGeneralRegisterLoads = true;
-bool SymbolicTree::_trackOnlyFlagRegisters = false;
-bool SymbolicTree::_simplifyAtCreation = true;
-unsigned SymbolicTree::_naryLimit = 3;
+thread_local Abi* SymbolicTree::_abi = nullptr;
+thread_local Config* SymbolicTree::_config = nullptr;
+thread_local bool SymbolicTree::_val2valUsed = false;
+thread_local bool SymbolicTree::_trackThroughAllocaLoads = true;
+thread_local bool SymbolicTree::_trackThroughGeneralRegisterLoads = true;
+thread_local bool SymbolicTree::_trackOnlyFlagRegisters = false;
+thread_local bool SymbolicTree::_simplifyAtCreation = true;
+thread_local unsigned SymbolicTree::_naryLimit = 3;
+thread_local unsigned SymbolicTree::_configuration = 0;
 
 void SymbolicTree::clear()
 {
@@ -717,6 +1170,7 @@ void SymbolicTree::clear()
 
 void SymbolicTree::setToDefaultConfiguration()
 {
+	++_configuration;
 	_val2valUsed = false;
 	_trackThroughAllocaLoads = true;
 	_trackThroughGeneralRegisterLoads = true;
@@ -732,36 +1186,43 @@ bool SymbolicTree::isVal2ValMapUsed()
 
 void SymbolicTree::setAbi(Abi* abi)
 {
+	++_configuration;
 	_abi = abi;
 }
 
 void SymbolicTree::setConfig(Config* config)
 {
+	++_configuration;
 	_config = config;
 }
 
 void SymbolicTree::setTrackThroughAllocaLoads(bool b)
 {
+	++_configuration;
 	_trackThroughAllocaLoads = b;
 }
 
 void SymbolicTree::setTrackThroughGeneralRegisterLoads(bool b)
 {
+	++_configuration;
 	_trackThroughGeneralRegisterLoads = b;
 }
 
 void SymbolicTree::setTrackOnlyFlagRegisters(bool b)
 {
+	++_configuration;
 	_trackOnlyFlagRegisters = b;
 }
 
 void SymbolicTree::setSimplifyAtCreation(bool b)
 {
+	++_configuration;
 	_simplifyAtCreation = b;
 }
 
 void SymbolicTree::setNaryLimit(unsigned n)
 {
+	++_configuration;
 	_naryLimit = n;
 }
 
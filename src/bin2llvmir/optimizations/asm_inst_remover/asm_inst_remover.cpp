@@ -73,14 +73,9 @@ bool AsmInstructionRemover::run(Module& M)
 		changed = true;
 	}
 
-	// Free Capstone instructions.
+	// Free instructions.
 	//
-	auto& insnMap = AsmInstruction::getLlvmToCapstoneInsnMap(&M);
-	for (auto& p : insnMap)
-	{
-		cs_free(p.second, 1);
-	}
-	insnMap.clear();
+	AsmInstruction::getInstructionTable(&M).clear();
 
 	// Remove special global variable.
 	//
@@ -76,6 +76,8 @@ bool ConstantsAnalysis::run()
 {
 	ReachingDefinitionsAnalysis RDA;
 	RDA.runOnModule(*_module, _abi);
+	// Trees of different instructions share many subtrees.
+	SymbolicTreeCache trees;
 
 	for (Function& f : *_module)
 	for (inst_iterator I = inst_begin(&f), E = inst_end(&f); I != E;)
@@ -90,14 +92,14 @@ bool ConstantsAnalysis::run()
 				continue;
 			}
 
-			checkForGlobalInInstruction(RDA, store, store->getValueOperand(), true);
+			checkForGlobalInInstruction(RDA, trees, store, store->getValueOperand(), true);
 
 			if (isa<GlobalVariable>(store->getPointerOperand()))
 			{
 				continue;
 			}
 
-			checkForGlobalInInstruction(RDA, store, store->getPointerOperand());
+			checkForGlobalInInstruction(RDA, trees, store, store->getPointerOperand());
 		}
 		else if (auto* load = dyn_cast<LoadInst>(&i))
 		{
@@ -106,7 +108,7 @@ bool ConstantsAnalysis::run()
 				continue;
 			}
 
-			checkForGlobalInInstruction(RDA, load, load->getPointerOperand());
+			checkForGlobalInInstruction(RDA, trees, load, load->getPointerOperand());
 		}
 	}
 
@@ -117,13 +119,14 @@ bool ConstantsAnalysis::run()
 
 void ConstantsAnalysis::checkForGlobalInInstruction(
 		ReachingDefinitionsAnalysis& RDA,
+		SymbolicTreeCache& trees,
 		Instruction* inst,
 		Value* val,
 		bool storeValue)
 {
 	LOG << llvmObjToString(inst) << std::endl;
 
-	auto root = SymbolicTree::PrecomputedRda(RDA, val);
+	auto root = SymbolicTree::PrecomputedRda(trees, RDA, val);
 	root.simplifyNode();
 
 	LOG << root << std::endl;
@@ -150,12 +153,14 @@ void ConstantsAnalysis::checkForGlobalInInstruction(
 				auto* conv = IrModifier::convertConstantToType(ngv, val->getType());
 				_toRemove.insert(val);
 				inst->replaceUsesOfWith(val, conv);
+				trees.invalidate(inst);
 				return;
 			}
 			else if (userI)
 			{
 				auto* conv = IrModifier::convertConstantToType(ngv, maxC->getType());
 				userI->replaceUsesOfWith(maxC, conv);
+				trees.invalidate(userI);
 				return;
 			}
 		}
@@ -167,6 +172,7 @@ void ConstantsAnalysis::checkForGlobalInInstruction(
 		auto* conv = IrModifier::convertConstantToType(gv, val->getType());
 		_toRemove.insert(val);
 		inst->replaceUsesOfWith(val, conv);
+		trees.invalidate(inst);
 		return;
 	}
 }
@@ -105,42 +105,40 @@ std::size_t Decoder::decodeJumpTargetDryRun_arm(
 		std::size_t &decodedSz,
 		bool strict)
 {
-
-	auto basicMode = _c2l->getBasicMode();
-	if (mode != basicMode) _c2l->modifyBasicMode(mode);
-
 	csh ce = _c2l->getCapstoneEngine();
 
 	decodedSz = 0;
 	uint64_t addr = jt.getAddress();
 	std::size_t nops = 0;
 	bool first = true;
-	while (cs_disasm_iter(ce, &bytes.first, &bytes.second, &addr, _dryCsInsn))
+	while (cs_insn* insn = _disasm.disassemble(
+			bytes.first,
+			bytes.second,
+			addr,
+			mode))
 	{
-		decodedSz += _dryCsInsn->size;
+		decodedSz += insn->size;
 
-		if (strict && first && !looksLikeArmFunctionStart(_dryCsInsn))
+		if (strict && first && !looksLikeArmFunctionStart(insn))
 		{
 			return true;
 		}
 
 		if (jt.getType() == JumpTarget::eType::LEFTOVER
 				&& (first || nops > 0)
-				&& _abi->isNopInstruction(_dryCsInsn))
+				&& _abi->isNopInstruction(insn))
 		{
-			nops += _dryCsInsn->size;
+			nops += insn->size;
 		}
 		else if (jt.getType() == JumpTarget::eType::LEFTOVER
 				&& nops > 0)
 		{
-			if (mode != basicMode) _c2l->modifyBasicMode(basicMode);
 			return nops;
 		}
 
-		if (_c2l->isControlFlowInstruction(*_dryCsInsn)
-				|| insnWrittesPc(ce, _dryCsInsn))
+		if (_c2l->isControlFlowInstruction(*insn)
+				|| insnWrittesPc(ce, insn))
 		{
-			if (mode != basicMode) _c2l->modifyBasicMode(basicMode);
 			return false;
 		}
 
@@ -149,7 +147,6 @@ std::size_t Decoder::decodeJumpTargetDryRun_arm(
 
 	if (nops > 0)
 	{
-		if (mode != basicMode) _c2l->modifyBasicMode(basicMode);
 		return nops;
 	}
 
@@ -157,11 +154,9 @@ std::size_t Decoder::decodeJumpTargetDryRun_arm(
 	//
 	if (getBasicBlockAtAddress(addr) && getFunctionAtAddress(addr) == nullptr)
 	{
-		if (mode != basicMode) _c2l->modifyBasicMode(basicMode);
 		return false;
 	}
 
-	if (mode != basicMode) _c2l->modifyBasicMode(basicMode);
 	return true;
 }
 
@@ -63,19 +63,23 @@ std::size_t Decoder::decodeJumpTargetDryRun_arm64(
 	// bytes.first  -> Code
 	// bytes.second -> Code size
 	// addr         -> Address of first instruction
-	while (cs_disasm_iter(ce, &bytes.first, &bytes.second, &addr, _dryCsInsn))
+	while (cs_insn* insn = _disasm.disassemble(
+			bytes.first,
+			bytes.second,
+			addr,
+			_c2l->getBasicMode()))
 	{
 
-		if (strict && first && !looksLikeArm64FunctionStart(_dryCsInsn))
+		if (strict && first && !looksLikeArm64FunctionStart(insn))
 		{
 			return true;
 		}
 
 		if (jt.getType() == JumpTarget::eType::LEFTOVER
 				&& (first || nops > 0)
-				&& _abi->isNopInstruction(_dryCsInsn))
+				&& _abi->isNopInstruction(insn))
 		{
-			nops += _dryCsInsn->size;
+			nops += insn->size;
 		}
 		else if (jt.getType() == JumpTarget::eType::LEFTOVER
 				&& nops > 0)
@@ -83,8 +87,8 @@ std::size_t Decoder::decodeJumpTargetDryRun_arm64(
 			return nops;
 		}
 
-		if (_c2l->isControlFlowInstruction(*_dryCsInsn)
-				|| insnWrittesPcArm64(ce, _dryCsInsn))
+		if (_c2l->isControlFlowInstruction(*insn)
+				|| insnWrittesPcArm64(ce, insn))
 		{
 			return false;
 		}
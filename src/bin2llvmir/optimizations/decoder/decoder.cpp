@@ -4,6 +4,8 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <stdexcept>
+
 #include <llvm/IR/Dominators.h>
 #include <llvm/IR/PatternMatch.h>
 
@@ -40,10 +42,7 @@ Decoder::Decoder() :
 
 Decoder::~Decoder()
 {
-	if (_dryCsInsn)
-	{
-		cs_free(_dryCsInsn, 1);
-	}
+
 }
 
 bool Decoder::runOnModule(llvm::Module& m)
@@ -54,7 +53,7 @@ bool Decoder::runOnModule(llvm::Module& m)
 	_debug = DebugFormatProvider::getDebugFormat(_module);
 	_names = NamesProvider::getNames(_module);
 	_abi = AbiProvider::getAbi(_module);
-	_llvm2capstone = &AsmInstruction::getLlvmToCapstoneInsnMap(_module);
+	_asmInstructions = &AsmInstruction::getInstructionTable(_module);
 	return runCatcher();
 }
 
@@ -72,10 +71,15 @@ bool Decoder::runOnModuleCustom(
 	_debug = d;
 	_names = n;
 	_abi = a;
-	_llvm2capstone = &AsmInstruction::getLlvmToCapstoneInsnMap(_module);
+	_asmInstructions = &AsmInstruction::getInstructionTable(_module);
 	return runCatcher();
 }
 
+void Decoder::setCancellationFlag(const utils::CancellationFlag* cancel)
+{
+	_cancel = cancel;
+}
+
 bool Decoder::runCatcher()
 {
 	// TODO: here, we shoudl catch only the most severe capstone2llvmir
@@ -90,8 +94,10 @@ bool Decoder::runCatcher()
 	}
 	catch (const BaseError& e)
 	{
-		Log::error() << "[capstone2llvmir]: " << e.what() << std::endl;
-		exit(1);
+		// Do not exit, other inputs of a batch run are still decompiled.
+		throw std::runtime_error(
+				std::string("[capstone2llvmir]: ") + e.what()
+		);
 	}
 }
 
@@ -104,7 +110,7 @@ bool Decoder::run()
 	}
 
 	initTranslator();
-	initDryRunCsInstruction();
+	initDisassemblyCache();
 	initEnvironment();
 	initRanges();
 	initJumpTargets();
@@ -148,10 +154,18 @@ void Decoder::decode()
 	JumpTarget jt;
 	while (getJumpTarget(jt))
 	{
+		// Decoding of a big binary may take a long time, there is no need
+		// to wait for the next pass to stop it.
+		utils::throwIfCancelled(_cancel);
+
 		LOG << "\t" << "processing : " << jt << std::endl;
 		decodeJumpTarget(jt);
 	}
 
+	LOG << "\t" << _disasm << std::endl;
+	// Instructions are kept in AsmInstructionTable after the decoding.
+	_disasm.clear();
+
 	if (!_somethingDecoded)
 	{
 		throw std::runtime_error("No instructions were decoded");
@@ -169,6 +183,7 @@ bool Decoder::getJumpTarget(JumpTarget& jt)
 	else if (!_ranges.primaryEmpty())
 	{
 		jt = JumpTarget(
+				_config,
 				_ranges.primaryFront().getStart(),
 				JumpTarget::eType::LEFTOVER,
 				_c2l->getBasicMode(),
@@ -250,6 +265,7 @@ void Decoder::decodeJumpTarget(const JumpTarget& jt)
 			LOG << "\t\t" << "dry run failed -> skip range = " << sr
 					<< std::endl;
 			_ranges.remove(sr);
+			_disasm.release(sr.getStart(), sr.getEnd());
 			return;
 		}
 	}
@@ -326,8 +342,6 @@ void Decoder::decodeJumpTarget(const JumpTarget& jt)
 		}
 		_somethingDecoded = true;
 
-		_llvm2capstone->emplace(res.llvmInsn, res.capstoneInsn);
-
 		bbEnd |= getJumpTargetsFromInstruction(oldAddr, res, bytes.second);
 		bbEnd |= instructionBreaksBasicBlock(oldAddr, res);
 
@@ -338,30 +352,50 @@ void Decoder::decodeJumpTarget(const JumpTarget& jt)
 
 	auto end = addr > start ? addr : Address(start+1);
 	_ranges.remove(start, end);
+	_disasm.release(start, end);
 	LOG << "\t\tdecoded range = " << AddressRange(start, end) << std::endl;
 }
 
 capstone2llvmir::Capstone2LlvmIrTranslator::TranslationResultOne
 Decoder::translate(ByteData& bytes, common::Address& addr, llvm::IRBuilder<>& irb)
 {
-	auto res = _c2l->translateOne(bytes.first, bytes.second, addr, irb);
+	const std::uint8_t* insnBytes = bytes.first;
+	uint64_t a = addr;
+	cs_mode mode = _c2l->getBasicMode();
+	cs_insn* insn = _disasm.disassemble(bytes.first, bytes.second, a, mode);
 
 	// MIPS 64-bit mode can decompile more instructions than the 32-bit mode.
 	// When 32-bit mode is used, some 32-bit instructions that IDA handles fail
 	// to disassemble.
 	// But we cannot always use 64-bit mode, because some other (FPU)
 	// instructions are disassembled differently. Try to swtich modes only if
-	// translations fails.
+	// disassembly fails.
 	//
-	if (_config->getConfig().architecture.isMipsOrPic32()
-			&& (_c2l->getBasicMode() & CS_MODE_MIPS32)
-			&& res.failed())
+	if (insn == nullptr
+			&& _config->getConfig().architecture.isMipsOrPic32()
+			&& (_c2l->getBasicMode() & CS_MODE_MIPS32))
 	{
-		_c2l->modifyBasicMode(CS_MODE_MIPS64);
-		res = _c2l->translateOne(bytes.first, bytes.second, addr, irb);
-		_c2l->modifyBasicMode(CS_MODE_MIPS32);
+		mode = CS_MODE_MIPS64;
+		insn = _disasm.disassemble(bytes.first, bytes.second, a, mode);
 	}
 
+	if (insn == nullptr)
+	{
+		return {};
+	}
+
+	auto res = _c2l->translateOne(insn, irb);
+	// Only instructions which are in the module are kept.
+	if (!res.failed())
+	{
+		_asmInstructions->add(
+				addr,
+				insnBytes,
+				insn->size,
+				static_cast<cs_mode>(mode + _c2l->getExtraMode()),
+				insn);
+	}
+	addr = a;
 	return res;
 }
 
@@ -1402,7 +1436,6 @@ void Decoder::handleDelaySlotTypical(
 		{
 			break;
 		}
-		_llvm2capstone->emplace(r.llvmInsn, r.capstoneInsn);
 	}
 
 	irb.SetInsertPoint(oldIp);
@@ -1459,7 +1492,6 @@ void Decoder::handleDelaySlotLikely(
 			{
 				break;
 			}
-			_llvm2capstone->emplace(res.llvmInsn, res.capstoneInsn);
 		}
 
 		_likelyBb2Target.emplace(newBb, target);
@@ -87,12 +87,11 @@ void Decoder::initTranslator()
 }
 
 /**
- * Initialize instruction used in dry run disassembly.
+ * Initialize cache of instructions disassembled in dry runs and translations.
  */
-void Decoder::initDryRunCsInstruction()
+void Decoder::initDisassemblyCache()
 {
-	csh ce = _c2l->getCapstoneEngine();
-	_dryCsInsn = cs_malloc(ce);
+	_disasm.setTranslator(_c2l.get());
 }
 
 /**
@@ -112,6 +111,7 @@ void Decoder::initEnvironment()
  * 2. Set it to config.
  * 3. Create metadata for it, so it can be quickly recognized without querying
  *    config.
+ * 4. Set architecture of the table of decoded instructions.
  */
 void Decoder::initEnvironmentAsm2LlvmMapping()
 {
@@ -119,6 +119,7 @@ void Decoder::initEnvironmentAsm2LlvmMapping()
 	a2lGv->setName(names::asm2llvmGv);
 
 	AsmInstruction::setLlvmToAsmGlobalVariable(_module, a2lGv);
+	_asmInstructions->setArchitecture(_c2l->getArchitecture());
 }
 
 /**
@@ -182,8 +183,7 @@ void Decoder::initEnvironmentRegisters()
  */
 void Decoder::initRanges()
 {
-	JumpTarget::config = _config;
-	JumpTargets::config = _config;
+	_jumpTargets.config = _config;
 
 	auto& arch = _config->getConfig().architecture;
 	unsigned a = 0;
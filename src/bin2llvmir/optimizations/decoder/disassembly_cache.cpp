@@ -0,0 +1,136 @@
+/**
+* @file src/bin2llvmir/optimizations/decoder/disassembly_cache.cpp
+* @brief Cache of instructions disassembled by the decoder.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include "retdec/bin2llvmir/optimizations/decoder/disassembly_cache.h"
+
+namespace retdec {
+namespace bin2llvmir {
+
+DisassemblyCache::~DisassemblyCache()
+{
+	clear();
+}
+
+/**
+ * Set translator whose Capstone engine is used for disassembling.
+ * This must be done before the first disassembly.
+ */
+void DisassemblyCache::setTranslator(
+		capstone2llvmir::Capstone2LlvmIrTranslator* c2l)
+{
+	clear();
+	_c2l = c2l;
+}
+
+/**
+ * Disassemble one instruction in the given mode. Parameters are the same as
+ * in @c cs_disasm_iter() and they are updated to point after the instruction
+ * if the disassembly succeeds.
+ * @return Disassembled instruction, or @c nullptr if the disassembly failed.
+ *         The instruction is owned by the cache and it must not be modified.
+ */
+cs_insn* DisassemblyCache::disassemble(
+		const std::uint8_t*& bytes,
+		std::size_t& size,
+		std::uint64_t& address,
+		cs_mode mode)
+{
+	auto& e = getEntry(bytes, size, address, mode);
+	if (e.insn == nullptr || e.insn->size > size)
+	{
+		return nullptr;
+	}
+
+	bytes += e.insn->size;
+	size -= e.insn->size;
+	address += e.insn->size;
+	return e.insn;
+}
+
+/**
+ * Free instructions at addresses in the range [@a start, @a end), in all
+ * the modes. Instructions returned for these addresses must not be used
+ * any more.
+ */
+void DisassemblyCache::release(common::Address start, common::Address end)
+{
+	auto b = _entries.lower_bound(Key{start, 0});
+	auto e = _entries.lower_bound(Key{end, 0});
+	for (auto it = b; it != e; ++it)
+	{
+		if (it->second.insn)
+		{
+			cs_free(it->second.insn, 1);
+		}
+	}
+	_entries.erase(b, e);
+}
+
+/**
+ * Free all the instructions.
+ */
+void DisassemblyCache::clear()
+{
+	for (auto& p : _entries)
+	{
+		if (p.second.insn)
+		{
+			cs_free(p.second.insn, 1);
+		}
+	}
+	_entries.clear();
+	_hits = 0;
+	_misses = 0;
+}
+
+DisassemblyCache::Entry& DisassemblyCache::getEntry(
+		const std::uint8_t* bytes,
+		std::size_t size,
+		std::uint64_t address,
+		cs_mode mode)
+{
+	Key key{address, static_cast<unsigned>(mode | _c2l->getExtraMode())};
+	auto& e = _entries[key];
+	// Instruction which does not fit into the bytes is not disassembled with
+	// them either.
+	if (e.insn || size <= e.failedSize)
+	{
+		++_hits;
+		return e;
+	}
+	++_misses;
+
+	auto basicMode = _c2l->getBasicMode();
+	if (mode != basicMode) _c2l->modifyBasicMode(mode);
+
+	csh ce = _c2l->getCapstoneEngine();
+	cs_insn* insn = cs_malloc(ce);
+	std::size_t insnSize = size;
+	if (cs_disasm_iter(ce, &bytes, &insnSize, &address, insn))
+	{
+		e.insn = insn;
+	}
+	else
+	{
+		cs_free(insn, 1);
+		e.failedSize = size;
+	}
+
+	if (mode != basicMode) _c2l->modifyBasicMode(basicMode);
+	return e;
+}
+
+std::ostream& operator<<(std::ostream& os, const DisassemblyCache& cache)
+{
+	auto all = cache._hits + cache._misses;
+	os << "disassembly cache: hits = " << cache._hits
+			<< ", misses = " << cache._misses
+			<< ", hit rate = " << (all ? 100 * cache._hits / all : 0) << " %";
+	return os;
+}
+
+} // namespace bin2llvmir
+} // namespace retdec
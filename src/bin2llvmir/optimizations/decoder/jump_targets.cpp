@@ -18,27 +18,29 @@ namespace bin2llvmir {
 //==============================================================================
 //
 
-Config* JumpTarget::config = nullptr;
-
 JumpTarget::JumpTarget()
 {
 
 }
 
 JumpTarget::JumpTarget(
+		Config* c,
 		retdec::common::Address a,
 		eType t,
 		cs_mode m,
 		retdec::common::Address f,
 		std::optional<std::size_t> sz)
 		:
+		_config(c),
 		_address(a),
 		_size(sz),
 		_type(t),
 		_fromAddress(f),
 		_mode(m)
 {
-	if (config->getConfig().architecture.isArm32OrThumb() && _address % 2)
+	if (_config
+			&& _config->getConfig().architecture.isArm32OrThumb()
+			&& _address % 2)
 	{
 		_mode = CS_MODE_THUMB;
 		_address -= 1;
@@ -157,8 +159,11 @@ std::ostream& operator<<(std::ostream &out, const JumpTarget& jt)
 
 	out << jt.getAddress() << " (" << t << ")";
 
-	auto& arch = jt.config->getConfig().architecture;
-	out << " (" << capstone_utils::mode2string(arch, jt.getMode()) << ")";
+	if (jt._config)
+	{
+		auto& arch = jt._config->getConfig().architecture;
+		out << " (" << capstone_utils::mode2string(arch, jt.getMode()) << ")";
+	}
 
 	if (jt.getFromAddress().isDefined())
 	{
@@ -178,8 +183,6 @@ std::ostream& operator<<(std::ostream &out, const JumpTarget& jt)
 //==============================================================================
 //
 
-Config* JumpTargets::config = nullptr;
-
 const JumpTarget* JumpTargets::push(
 		retdec::common::Address a,
 		JumpTarget::eType t,
@@ -213,7 +216,7 @@ const JumpTarget* JumpTargets::push(
 		else
 		{
 			LOG << "\t\t" << "[+] JT @ " << a << std::endl;
-			return &(*_data.emplace(a, t, m, f, sz).first);
+			return &(*_data.emplace(config, a, t, m, f, sz).first);
 		}
 	}
 
@@ -46,23 +46,16 @@ bool isBadBranch(FileImage* img, cs_insn* br)
 	return false;
 }
 
-bool Decoder::disasm_mips(
-		csh ce,
-		cs_mode m,
-		ByteData& bytes,
-		uint64_t& a,
-		cs_insn* i)
+cs_insn* Decoder::disasm_mips(cs_mode m, ByteData& bytes, uint64_t& a)
 {
-	bool ret = cs_disasm_iter(ce, &bytes.first, &bytes.second, &a, i);
+	cs_insn* i = _disasm.disassemble(bytes.first, bytes.second, a, m);
 
-	if (ret == false && (m & CS_MODE_MIPS32))
+	if (i == nullptr && (m & CS_MODE_MIPS32))
 	{
-		_c2l->modifyBasicMode(CS_MODE_MIPS64);
-		ret = cs_disasm_iter(ce, &bytes.first, &bytes.second, &a, i);
-		_c2l->modifyBasicMode(CS_MODE_MIPS32);
+		i = _disasm.disassemble(bytes.first, bytes.second, a, CS_MODE_MIPS64);
 	}
 
-	return ret;
+	return i;
 }
 
 std::size_t Decoder::decodeJumpTargetDryRun_mips(
@@ -75,22 +68,20 @@ std::size_t Decoder::decodeJumpTargetDryRun_mips(
 		return true;
 	}
 
-	csh ce = _c2l->getCapstoneEngine();
-
 	uint64_t addr = jt.getAddress();
 	std::size_t nops = 0;
 	bool first = true;
 	unsigned counter = 0;
 	unsigned cfChangePos = 0;
-	while (disasm_mips(ce, _c2l->getBasicMode(), bytes, addr, _dryCsInsn))
+	while (cs_insn* insn = disasm_mips(_c2l->getBasicMode(), bytes, addr))
 	{
 		++counter;
 
 		if (jt.getType() == JumpTarget::eType::LEFTOVER
 				&& (first || nops > 0)
-				&& _abi->isNopInstruction(_dryCsInsn))
+				&& _abi->isNopInstruction(insn))
 		{
-			nops += _dryCsInsn->size;
+			nops += insn->size;
 		}
 		else if (jt.getType() == JumpTarget::eType::LEFTOVER
 				&& nops > 0)
@@ -98,20 +89,20 @@ std::size_t Decoder::decodeJumpTargetDryRun_mips(
 			return nops;
 		}
 
-		if (_c2l->isReturnInstruction(*_dryCsInsn))
+		if (_c2l->isReturnInstruction(*insn))
 		{
 			return false;
 		}
-		if (_c2l->isBranchInstruction(*_dryCsInsn)
-				&& !isBadBranch(_image, _dryCsInsn))
+		if (_c2l->isBranchInstruction(*insn)
+				&& !isBadBranch(_image, insn))
 		{
 			return false;
 		}
 
-		if (_c2l->isReturnInstruction(*_dryCsInsn)
-				|| _c2l->isBranchInstruction(*_dryCsInsn)
-				|| _c2l->isCondBranchInstruction(*_dryCsInsn)
-				|| _c2l->isCallInstruction(*_dryCsInsn))
+		if (_c2l->isReturnInstruction(*insn)
+				|| _c2l->isBranchInstruction(*insn)
+				|| _c2l->isCondBranchInstruction(*insn)
+				|| _c2l->isCallInstruction(*insn))
 		{
 			cfChangePos = counter;
 		}
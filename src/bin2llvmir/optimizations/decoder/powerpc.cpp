@@ -25,18 +25,20 @@ std::size_t Decoder::decodeJumpTargetDryRun_ppc(
 		return true;
 	}
 
-	csh ce = _c2l->getCapstoneEngine();
-
 	uint64_t addr = jt.getAddress();
 	std::size_t nops = 0;
 	bool first = true;
-	while (cs_disasm_iter(ce, &bytes.first, &bytes.second, &addr, _dryCsInsn))
+	while (cs_insn* insn = _disasm.disassemble(
+			bytes.first,
+			bytes.second,
+			addr,
+			_c2l->getBasicMode()))
 	{
 		if (jt.getType() == JumpTarget::eType::LEFTOVER
 				&& (first || nops > 0)
-				&& _abi->isNopInstruction(_dryCsInsn))
+				&& _abi->isNopInstruction(insn))
 		{
-			nops += _dryCsInsn->size;
+			nops += insn->size;
 		}
 		else if (jt.getType() == JumpTarget::eType::LEFTOVER
 				&& nops > 0)
@@ -44,7 +46,7 @@ std::size_t Decoder::decodeJumpTargetDryRun_ppc(
 			return nops;
 		}
 
-		if (_c2l->isControlFlowInstruction(*_dryCsInsn))
+		if (_c2l->isControlFlowInstruction(*insn))
 		{
 			return false;
 		}
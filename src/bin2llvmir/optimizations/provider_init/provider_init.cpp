@@ -13,16 +13,18 @@
 #include "retdec/bin2llvmir/optimizations/provider_init/provider_init.h"
 #include "retdec/bin2llvmir/providers/abi/abi.h"
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
-#include "retdec/bin2llvmir/providers/calling_convention/calling_convention.h"
 #include "retdec/bin2llvmir/providers/config.h"
 #include "retdec/bin2llvmir/providers/debugformat.h"
 #include "retdec/bin2llvmir/providers/demangler.h"
 #include "retdec/bin2llvmir/providers/fileimage.h"
 #include "retdec/bin2llvmir/providers/lti.h"
 #include "retdec/bin2llvmir/providers/names.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/cpdetect/cpdetect.h"
+#include "retdec/cpdetect/input_analysis.h"
 #include "retdec/utils/string.h"
-#include "retdec/yaracpp/yara_detector.h"
+#include "retdec/yaracpp/yara_rules_cache.h"
+#include "retdec/yaracpp/yara_scanner.h"
 
 using namespace llvm;
 using namespace retdec::utils::io;
@@ -168,21 +170,27 @@ void ProviderInitialization::setConfig(retdec::config::Config* c)
 	_config = c;
 }
 
+/**
+ * Use the given analysis of the input file instead of parsing the file and
+ * detecting tools in it again. It is ignored if it was made for another file
+ * than the one in config.
+ */
+void ProviderInitialization::setInputAnalysis(
+		const std::shared_ptr<cpdetect::InputAnalysis>& input)
+{
+	_input = input;
+}
+
 /**
  * @return Always @c false -- this pass does not modify module.
  */
 bool ProviderInitialization::runOnModule(Module& m)
 {
-	AbiProvider::clear();
-	AsmInstruction::clear();
-	ConfigProvider::clear();
-	DebugFormatProvider::clear();
-	DemanglerProvider::clear();
-	FileImageProvider::clear();
-	LtiProvider::clear();
-	NamesProvider::clear();
+	// Providers' data are associated only with this module -> other modules
+	// (e.g. decompilations running in other threads) are not affected.
+	//
+	ProviderContext::removeContext(&m);
 	SymbolicTree::clear();
-	CallingConventionProvider::clear();
 
 	// Config.
 	//
@@ -197,12 +205,18 @@ bool ProviderInitialization::runOnModule(Module& m)
 		throw std::runtime_error("ProviderInitialization: c == nullptr");
 	}
 
+	auto& inputFile = c->getConfig().parameters.getInputFile();
+	auto input = (_input
+			&& _input->getPath() == inputFile
+			&& !c->getConfig().fileFormat.isRaw())
+		? _input
+		: nullptr;
+
 	// Fileimage.
 	//
-	auto* f = FileImageProvider::addFileImage(
-			&m,
-			c->getConfig().parameters.getInputFile(),
-			c);
+	auto* f = input
+		? FileImageProvider::addFileImage(&m, input->getFileFormat(), c)
+		: FileImageProvider::addFileImage(&m, inputFile, c);
 	if (f == nullptr)
 	{
 		throw std::runtime_error("ProviderInitialization: f == nullptr");
@@ -267,23 +281,35 @@ bool ProviderInitialization::runOnModule(Module& m)
 	}
 
 	// Run cpdetect and set info to config.
-	// TODO: we could probably be using cpdetect results.
+	// Results from the shared input analysis are reused, unless the format
+	// needed the architecture info from the config (Intel HEX).
 	//
-	cpdetect::ToolInformation tools;
-	cpdetect::DetectParams searchParams(
-			cpdetect::SearchType::MOST_SIMILAR,
-			true, // internal database
-			false,
-			50 // ep bytes size
-	);
-	cpdetect::CompilerDetector cd(
-			*f->getFileFormat(),
-			searchParams,
-			tools
-	);
-	if (cd.getAllInformation() == cpdetect::ReturnCode::OK)
+	cpdetect::ToolInformation localTools;
+	const cpdetect::ToolInformation* tools = &localTools;
+	cpdetect::ReturnCode detectionStatus;
+	if (input && !f->getFileFormat()->isIntelHex())
+	{
+		detectionStatus = input->detectTools();
+		tools = &input->getToolInformation();
+	}
+	else
 	{
-		for (auto& t : tools.detectedTools)
+		cpdetect::DetectParams searchParams(
+				cpdetect::SearchType::MOST_SIMILAR,
+				true, // internal database
+				false,
+				50 // ep bytes size
+		);
+		cpdetect::CompilerDetector cd(
+				*f->getFileFormat(),
+				searchParams,
+				localTools
+		);
+		detectionStatus = cd.getAllInformation();
+	}
+	if (detectionStatus == cpdetect::ReturnCode::OK)
+	{
+		for (auto& t : tools->detectedTools)
 		{
 			common::ToolInfo ci;
 
@@ -337,7 +363,7 @@ bool ProviderInitialization::runOnModule(Module& m)
 
 			c->getConfig().tools.push_back(ci);
 		}
-		for (auto& l : tools.detectedLanguages)
+		for (auto& l : tools->detectedLanguages)
 		{
 			if (l.bytecode)
 			{
@@ -355,20 +381,26 @@ bool ProviderInitialization::runOnModule(Module& m)
 	}
 
 	// YARA crypto patterns scanning.
+	// File format holds all the input bytes -> no need to read the file again.
+	// Rules are compiled only once per process and shared by all the runs.
 	//
-	yaracpp::YaraDetector yara;
 	for (auto& crypto : c->getConfig().parameters.cryptoPatternPaths)
 	{
-		yara.addRuleFile(crypto);
-	}
-	yara.analyze(c->getConfig().parameters.getInputFile());
-	for(const auto &rule : yara.getDetectedRules())
-	{
-		common::Pattern p = saveCryptoRule(
-				rule,
-				f->getFileFormat()
-		);
-		c->getConfig().patterns.push_back(p);
+		yaracpp::YaraScanner yara(yaracpp::YaraRulesCache::getRules(crypto));
+		const auto bytes = f->getFileFormat()->getBytes();
+		if (!yara.scan(bytes.data(), bytes.size()))
+		{
+			continue;
+		}
+
+		for(const auto &rule : yara.getDetectedRules())
+		{
+			common::Pattern p = saveCryptoRule(
+					rule,
+					f->getFileFormat()
+			);
+			c->getConfig().patterns.push_back(p);
+		}
 	}
 	// TODO: removeRedundantCryptoRules()
 	// TODO: sortCryptoPatternMatches()
@@ -403,7 +435,7 @@ bool ProviderInitialization::runOnModule(Module& m)
 
 	NamesProvider::addNames(&m, c, debug, f, d, lti);
 
-	AsmInstruction::clear();
+	AsmInstruction::clear(&m);
 
 	return false;
 }
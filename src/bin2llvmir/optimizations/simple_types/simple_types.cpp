@@ -4,7 +4,9 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <algorithm>
 #include <iomanip>
+#include <numeric>
 #include <queue>
 #include <set>
 #include <string>
@@ -22,6 +24,7 @@
 #include "retdec/bin2llvmir/optimizations/simple_types/simple_types.h"
 #include "retdec/bin2llvmir/providers/abi/abi.h"
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/utils/debug.h"
 #include "retdec/bin2llvmir/utils/ir_modifier.h"
 
@@ -82,16 +85,20 @@ bool SimpleTypesAnalysis::runOnModule(Module& M)
 	module = &M;
 	_specialGlobal = AsmInstruction::getLlvmToAsmGlobalVariable(module);
 
-	static bool first = true;
+	// Every even run on the module builds and applies equivalence sets,
+	// every odd run fixes types of strings.
+	//
+	auto& runs = ProviderContext::createContext(&M).simpleTypesRuns;
 
-	if (first)
+	if (runs++ % 2 == 0)
 	{
-		first = false;
+		eqClasses.clear();
+		eqSets.eqSets.clear();
+		val2PtrVal.clear();
 
 		RDA.runOnModule(M, AbiProvider::getAbi(&M));
 		buildEqSets(M);
 		buildEquations();
-		eqSets.propagate(module);
 		eqSets.apply(module, config, objf, instToErase);
 		eraseObsoleteInstructions();
 		setGlobalConstants();
@@ -99,8 +106,6 @@ bool SimpleTypesAnalysis::runOnModule(Module& M)
 	}
 	else
 	{
-		first = true;
-
 		instToErase.clear();
 
 		IrModifier irModif(module, config);
@@ -327,61 +332,75 @@ void SimpleTypesAnalysis::buildEqSets(Module& M)
 			}
 		}
 	}
+
+	eqClasses.createEqSets(eqSets);
 }
 
 void SimpleTypesAnalysis::processRoot(Value* root)
 {
-	if (processedObjs.find(root) == processedObjs.end())
+	if (eqClasses.getId(root) != EqSetUnionFind::npos)
 	{
-		auto& eqSet = eqSets.createEmptySet();
-		LOG << "[ROOT #" << eqSet.id << "]: " << llvmObjToString(root) << std::endl;
-		std::queue<Value*> toProcess;
-		toProcess.push(root);
-		processValue(toProcess, eqSet);
-
-		if (eqSet.valSet.size() <= 1 && eqSet.typeSet.size() <= 1 && eqSet.equationSet.size() <= 1)
-		{
-			eqSets.eqSets.pop_back();
-		}
+		return;
 	}
-}
 
-/**
- * While not empty, pop value from @p toProcess queue and add it to @p eqSet.
- * Go through all users of this value and based on their instruction types do one of the following:
- * (1) Nothing.
- * (2) Add some value(s) directly to @p eqSet -- user of this value will not be processed.
- * (3) Add some value(s) to @p toProcess -- value will be added to @p eqSet when popped and its
- *     users will be processed.
- *
- * @param toProcess Queue of values to process.
- * @param eqSet Equivalence set to create.
- */
-void SimpleTypesAnalysis::processValue(std::queue<Value*>& toProcess, EqSet& eqSet)
-{
+	auto rootId = eqClasses.insert(
+			root,
+			ValueEntry::getSourcePriority(config, root),
+			module);
+	LOG << "[ROOT #" << rootId << "]: " << llvmObjToString(root) << std::endl;
+
+	std::queue<Value*> toProcess;
+	processValue(root, toProcess, rootId);
+
 	while (!toProcess.empty())
 	{
 		auto current = toProcess.front();
 		toProcess.pop();
 
-		if (processedObjs.find(current) != processedObjs.end())
+		// Value already processed from this or some other root -- it stays
+		// in its set and its users are not processed again. Sets built from
+		// different roots are never united.
+		if (eqClasses.getId(current) != EqSetUnionFind::npos)
 		{
 			continue;
 		}
 
-		LOG << "\t[CURRENT]: " << llvmObjToString(current) << std::endl;
+		auto id = eqClasses.insert(
+				current,
+				ValueEntry::getSourcePriority(config, current),
+				module);
+		eqClasses.unite(rootId, id, module);
+		processValue(current, toProcess, rootId);
+	}
+}
 
-		eqSet.insert(config, current);
-		processedObjs.insert({current, &eqSet});
+/**
+ * Go through all users of @p current value and based on their instruction
+ * types do one of the following:
+ * (1) Nothing.
+ * (2) Add some type(s) directly to the set @p eqClass -- user of this value
+ *     will not be processed.
+ * (3) Add some value(s) to @p toProcess -- value will be added to the set
+ *     @p eqClass when popped and its users will be processed.
+ *
+ * @param current Value already added to the set @p eqClass.
+ * @param toProcess Queue of values to process.
+ * @param eqClass ID of any value in the set to build.
+ */
+void SimpleTypesAnalysis::processValue(
+		Value* current,
+		std::queue<Value*>& toProcess,
+		std::size_t eqClass)
+{
+	LOG << "\t[CURRENT]: " << llvmObjToString(current) << std::endl;
 
-		for (auto uIt = current->user_begin(); uIt != current->user_end(); ++uIt)
-		{
-			processUse(current, *uIt, toProcess, eqSet);
-		}
+	for (auto uIt = current->user_begin(); uIt != current->user_end(); ++uIt)
+	{
+		processUse(current, *uIt, toProcess, eqClass);
 	}
 }
 
-void SimpleTypesAnalysis::processUse(llvm::Value* current, Value* u, std::queue<Value*>& toProcess, EqSet& eqSet)
+void SimpleTypesAnalysis::processUse(llvm::Value* current, Value* u, std::queue<Value*>& toProcess, std::size_t eqClass)
 {
 	if (auto* eu = dyn_cast<ConstantExpr>(u))
 	{
@@ -456,7 +475,7 @@ void SimpleTypesAnalysis::processUse(llvm::Value* current, Value* u, std::queue<
 			p = eSourcePriority::PRIORITY_LTI;
 		}
 
-		eqSet.insert(fnc->getReturnType(), p);
+		eqClasses.insert(eqClass, TypeEntry(fnc->getReturnType(), p), module);
 	}
 	else if (isa<BranchInst>(user))
 	{
@@ -670,7 +689,10 @@ void SimpleTypesAnalysis::processUse(llvm::Value* current, Value* u, std::queue<
 			{
 				if (tmp == current && tmp->getType() != Abi::getDefaultType(module))
 				{
-					eqSet.insert(tmp->getType(), eSourcePriority::PRIORITY_LTI);
+					eqClasses.insert(
+							eqClass,
+							TypeEntry(tmp->getType(), eSourcePriority::PRIORITY_LTI),
+							module);
 					break;
 				}
 			}
@@ -688,22 +710,22 @@ void SimpleTypesAnalysis::buildEquations()
 
 	for (auto& p : val2PtrVal)
 	{
-		auto fIt1 = processedObjs.find(p.first);
-		auto fIt2 = processedObjs.find(p.second);
+		auto* eq1 = eqClasses.getEqSet(p.first);
+		auto* eq2 = eqClasses.getEqSet(p.second);
 
-		LOG << "\t" << llvmObjToString(p.first) << "(" << (fIt1 != processedObjs.end()) << ")"
+		LOG << "\t" << llvmObjToString(p.first) << "(" << (eq1 != nullptr) << ")"
 				<< "  ->  "
-				<< llvmObjToString(p.second) << " (" << (fIt2 != processedObjs.end()) << ")"
+				<< llvmObjToString(p.second) << " (" << (eq2 != nullptr) << ")"
 				<< std::endl;
 
-		if (fIt1 == processedObjs.end() || fIt2 == processedObjs.end())
+		if (eq1 == nullptr || eq2 == nullptr)
 		{
 			LOG << "\t\tskipped" << std::endl;
 			continue;
 		}
 
-		fIt1->second->equationSet.insert( EquationEntry::otherIsPtrToThis(fIt2->second) );
-		LOG << "\t\t#" << fIt1->second->id << " otherIsPtrToThis #" << fIt2->second->id << std::endl;
+		eq1->equationSet.insert( EquationEntry::otherIsPtrToThis(eq2) );
+		LOG << "\t\t#" << eq1->id << " otherIsPtrToThis #" << eq2->id << std::endl;
 	}
 }
 
@@ -727,23 +749,16 @@ EqSet& EqSetContainer::createEmptySet()
 	return eqSets.back();
 }
 
-void EqSetContainer::propagate(llvm::Module* module)
-{
-	for (auto& eq : eqSets)
-	{
-		eq.propagate(module);
-	}
-}
-
 void EqSetContainer::apply(
 		llvm::Module* module,
 		Config* config,
 		FileImage* objf,
 		std::unordered_set<llvm::Instruction*>& instToErase)
 {
+	IrModifier irModif(module, config);
 	for (auto& eq : eqSets)
 	{
-		eq.apply(module, config, objf, instToErase);
+		eq.apply(irModif, config, objf, instToErase);
 	}
 }
 
@@ -760,78 +775,202 @@ std::ostream& operator<<(std::ostream& out, const EqSetContainer& eqs)
 
 //
 //=============================================================================
-//  EqSet
+//  EqSetUnionFind
 //=============================================================================
 //
 
-EqSet::EqSet(std::size_t id) :
-		id(id)
+void EqSetUnionFind::clear()
 {
+	ids.clear();
+	values.clear();
+	parents.clear();
+	sizes.clear();
+	masterTypes.clear();
+	types.clear();
+	rootEqSets.clear();
+}
 
+/**
+ * @return ID of value @p v, or @c npos if it was not inserted.
+ */
+std::size_t EqSetUnionFind::getId(llvm::Value* v) const
+{
+	auto fIt = ids.find(v);
+	return fIt != ids.end() ? fIt->second : npos;
 }
 
-void EqSet::insert(Config* config, llvm::Value* v, eSourcePriority p)
+/**
+ * Insert value @p v with priority @p p as a new set.
+ * @return ID of the value.
+ */
+std::size_t EqSetUnionFind::insert(
+		llvm::Value* v,
+		eSourcePriority p,
+		llvm::Module* module)
 {
-	auto& conf = config->getConfig();
+	auto id = values.size();
+	ids.emplace(v, id);
+	values.emplace_back(v, p);
+	parents.push_back(id);
+	sizes.push_back(1);
+	masterTypes.emplace_back();
+	EqSet::mergeMasterType(
+			module,
+			masterTypes.back(),
+			TypeEntry(values.back().getTypeForPropagation(), p));
+	return id;
+}
 
-	if (p != eSourcePriority::PRIORITY_NONE)
+/**
+ * Add type @p t to the set containing value with ID @p id.
+ */
+void EqSetUnionFind::insert(
+		std::size_t id,
+		const TypeEntry& t,
+		llvm::Module* module)
+{
+	types.emplace_back(id, t);
+	EqSet::mergeMasterType(module, masterTypes[find(id)], t);
+}
+
+/**
+ * @return ID of the root of the set containing value with ID @p id.
+ */
+std::size_t EqSetUnionFind::find(std::size_t id)
+{
+	auto root = id;
+	while (parents[root] != root)
 	{
-		valSet.insert( {v,p} );
+		root = parents[root];
 	}
-	else
+	while (parents[id] != root)
+	{
+		auto next = parents[id];
+		parents[id] = root;
+		id = next;
+	}
+	return root;
+}
+
+/**
+ * Unite sets containing values with IDs @p id1 and @p id2.
+ * @return ID of the root of the united set.
+ */
+std::size_t EqSetUnionFind::unite(
+		std::size_t id1,
+		std::size_t id2,
+		llvm::Module* module)
+{
+	auto r1 = find(id1);
+	auto r2 = find(id2);
+	if (r1 == r2)
+	{
+		return r1;
+	}
+
+	if (sizes[r1] < sizes[r2])
+	{
+		std::swap(r1, r2);
+	}
+	parents[r2] = r1;
+	sizes[r1] += sizes[r2];
+	EqSet::mergeMasterType(module, masterTypes[r1], masterTypes[r2]);
+	return r1;
+}
+
+/**
+ * Create equivalence sets in @p eqs from all the disjoint sets, except sets
+ * with a single value and at most one type, which carry no information.
+ * Values of each set are collected at once, in the order of their IDs.
+ */
+void EqSetUnionFind::createEqSets(EqSetContainer& eqs)
+{
+	std::size_t n = values.size();
+
+	// Values and types sorted by their sets (counting sort by roots).
+	std::vector<std::size_t> valBegins(n + 1, 0);
+	std::vector<std::size_t> typeBegins(n + 1, 0);
+	std::vector<std::size_t> roots(n);
+	for (std::size_t i = 0; i < n; ++i)
 	{
-		if (auto* fnc = dyn_cast<Function>(v))
+		roots[i] = find(i);
+		++valBegins[roots[i] + 1];
+	}
+	for (auto& t : types)
+	{
+		t.first = roots[t.first];
+		++typeBegins[t.first + 1];
+	}
+	std::partial_sum(valBegins.begin(), valBegins.end(), valBegins.begin());
+	std::partial_sum(typeBegins.begin(), typeBegins.end(), typeBegins.begin());
+
+	std::vector<std::size_t> valOrder(n);
+	std::vector<std::size_t> next(valBegins.begin(), valBegins.end() - 1);
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		valOrder[next[roots[i]]++] = i;
+	}
+	std::vector<const TypeEntry*> typeOrder(types.size());
+	next.assign(typeBegins.begin(), typeBegins.end() - 1);
+	for (auto& t : types)
+	{
+		typeOrder[next[t.first]++] = &t.second;
+	}
+
+	rootEqSets.assign(n, nullptr);
+	for (std::size_t r = 0; r < n; ++r)
+	{
+		if (roots[r] != r)
 		{
-			auto* cf = conf.functions.getFunctionByName(fnc->getName());
-			if (cf && cf->isFromDebug())
-			{
-				p = eSourcePriority::PRIORITY_DEBUG;
-			}
+			continue;
 		}
-		else if (auto* alloca = dyn_cast<AllocaInst>(v))
-		{
-			assert(alloca->getParent());
-			assert(alloca->getParent()->getParent());
-			auto* fnc = alloca->getParent()->getParent();
 
-			auto* cf = conf.functions.getFunctionByName(fnc->getName());
-			if (cf)
-			{
-				auto* local = cf->locals.getObjectByName(alloca->getName());
-				if (local && local->isFromDebug())
-				{
-					p = eSourcePriority::PRIORITY_DEBUG;
-				}
-			}
-		}
-		else if (auto* global = dyn_cast<GlobalVariable>(v))
+		TypeEntrySet typeSet;
+		for (auto i = typeBegins[r]; i < typeBegins[r + 1]; ++i)
 		{
-			auto* cg = conf.globals.getObjectByName(global->getName());
-			if (cg && cg->isFromDebug())
-			{
-				p = eSourcePriority::PRIORITY_DEBUG;
-			}
+			typeSet.insert(*typeOrder[i]);
 		}
-		else if (auto* param = dyn_cast<Argument>(v))
+		if (sizes[r] <= 1 && typeSet.size() <= 1)
 		{
-			assert(param->getParent());
-			auto* fnc = param->getParent();
-
-			auto* cf = conf.functions.getFunctionByName(fnc->getName());
-			if (cf)
-			{
-				auto* cp = cf->parameters.getObjectByName(param->getName());
-				if (cp && cp->isFromDebug())
-				{
-					p = eSourcePriority::PRIORITY_DEBUG;
-				}
-			}
+			continue;
 		}
 
-		valSet.insert( {v,p} );
+		auto& eqSet = eqs.createEmptySet();
+		eqSet.masterType = masterTypes[r];
+		eqSet.typeSet = std::move(typeSet);
+		eqSet.valSet.reserve(sizes[r]);
+		for (auto i = valBegins[r]; i < valBegins[r + 1]; ++i)
+		{
+			eqSet.valSet.push_back(values[valOrder[i]]);
+		}
+		rootEqSets[r] = &eqSet;
 	}
 }
 
+/**
+ * @return Equivalence set containing value @p v, or @c nullptr if there is
+ *         no such set. Valid only after @c createEqSets().
+ */
+EqSet* EqSetUnionFind::getEqSet(llvm::Value* v)
+{
+	auto id = getId(v);
+	return id != npos && id < rootEqSets.size()
+			? rootEqSets[find(id)]
+			: nullptr;
+}
+
+//
+//=============================================================================
+//  EqSet
+//=============================================================================
+//
+
+EqSet::EqSet(std::size_t id) :
+		id(id)
+{
+
+}
+
 void EqSet::insert(llvm::Type* t, eSourcePriority p)
 {
 	typeSet.insert( {t,p} );
@@ -1149,88 +1288,55 @@ llvm::Type* EqSet::getHigherPriorityTypePrivate(
 	}
 }
 
-void EqSet::propagate(llvm::Module* module)
+/**
+ * Merge type @p t into @p master type of some set. Type with higher priority
+ * wins, types with the same priority are ordered by
+ * @c getHigherPriorityType().
+ */
+void EqSet::mergeMasterType(
+		llvm::Module* module,
+		TypeEntry& master,
+		const TypeEntry& t)
 {
-	if (valSet.empty())
+	if (t.priority < master.priority)
+	{
 		return;
-
-	LOG << "\npropagate BEGIN " << id << " =============================\n";
-
-	for (auto& vs : valSet)
+	}
+	else if (t.priority == master.priority)
 	{
-		Type* valueType = vs.getTypeForPropagation();
-
-		if (vs.priority < masterType.priority)
+		if (t.type != master.type && master.priority != eSourcePriority::PRIORITY_NONE)
 		{
-			continue;
+			LOG << "[WARNING] same priority types differ: "
+				<< llvmObjToString(t.type) << " vs. "
+				<< llvmObjToString(master.type) << std::endl;
 		}
-		else if (vs.priority == masterType.priority)
-		{
-			if (valueType != masterType.type && masterType.priority != eSourcePriority::PRIORITY_NONE)
-			{
-				LOG << "[WARNING] same priority types differ: "
-					<< llvmObjToString(valueType) << " vs. "
-					<< llvmObjToString(masterType.type) << std::endl;
-			}
 
-			auto* r = getHigherPriorityType(module, masterType.type, valueType);
-			if (r == valueType)
-			{
-				masterType.type = valueType;
-			}
-		}
-		else if (vs.priority > masterType.priority)
+		auto* r = getHigherPriorityType(module, master.type, t.type);
+		if (r == t.type)
 		{
-			masterType.priority = vs.priority;
-			masterType.type = valueType;
+			master.type = t.type;
 		}
 	}
-	for (auto& ts : typeSet)
+	else
 	{
-		if (ts.priority < masterType.priority)
-		{
-			continue;
-		}
-		else if (ts.priority == masterType.priority)
-		{
-			if (ts.type != masterType.type && masterType.priority != eSourcePriority::PRIORITY_NONE)
-			{
-				LOG << "[WARNING] same priority types differ: "
-					<< llvmObjToString(ts.type) << " vs. "
-					<< llvmObjToString(masterType.type) << std::endl;
-			}
-
-			auto* r = getHigherPriorityType(module, masterType.type, ts.type);
-			if (r == ts.type)
-			{
-				masterType.type = ts.type;
-			}
-		}
-		else if (ts.priority > masterType.priority)
-		{
-			masterType.priority = ts.priority;
-			masterType.type = ts.type;
-		}
+		master = t;
 	}
-
-	LOG << *this;
-	LOG << "\npropagate END   " << id << " =============================\n";
 }
 
 void EqSet::apply(
-		llvm::Module* module,
+		IrModifier& irModif,
 		Config* config,
 		FileImage* objf,
 		std::unordered_set<llvm::Instruction*>& instToErase)
 {
-	if (valSet.empty())
+	if (valSet.empty() || masterType.type == nullptr)
 		return;
 
 	LOG << "\napply BEGIN " << id << " =============================\n";
+	LOG << *this;
 
 	auto &conf = config->getConfig();
 
-	IrModifier irModif(module, config);
 	for (auto& vs : valSet)
 	{
 		if (!(isa<AllocaInst>(vs.value) || isa<GlobalVariable>(vs.value) || isa<Argument>(vs.value)))
@@ -1238,7 +1344,6 @@ void EqSet::apply(
 			continue;
 		}
 		if (vs.getTypeForPropagation() == masterType.type
-				|| masterType.type == nullptr
 				|| (vs.priority >= masterType.priority && vs.priority > eSourcePriority::PRIORITY_NONE)
 				|| vs.getTypeForPropagation()->isAggregateType())
 		{
@@ -1305,6 +1410,65 @@ ValueEntry::ValueEntry(Value* v, eSourcePriority p) :
 
 }
 
+/**
+ * Get priority of type of value @p v given by its source.
+ */
+eSourcePriority ValueEntry::getSourcePriority(Config* config, llvm::Value* v)
+{
+	auto& conf = config->getConfig();
+	eSourcePriority p = eSourcePriority::PRIORITY_NONE;
+
+	if (auto* fnc = dyn_cast<Function>(v))
+	{
+		auto* cf = conf.functions.getFunctionByName(fnc->getName());
+		if (cf && cf->isFromDebug())
+		{
+			p = eSourcePriority::PRIORITY_DEBUG;
+		}
+	}
+	else if (auto* alloca = dyn_cast<AllocaInst>(v))
+	{
+		assert(alloca->getParent());
+		assert(alloca->getParent()->getParent());
+		auto* fnc = alloca->getParent()->getParent();
+
+		auto* cf = conf.functions.getFunctionByName(fnc->getName());
+		if (cf)
+		{
+			auto* local = cf->locals.getObjectByName(alloca->getName());
+			if (local && local->isFromDebug())
+			{
+				p = eSourcePriority::PRIORITY_DEBUG;
+			}
+		}
+	}
+	else if (auto* global = dyn_cast<GlobalVariable>(v))
+	{
+		auto* cg = conf.globals.getObjectByName(global->getName());
+		if (cg && cg->isFromDebug())
+		{
+			p = eSourcePriority::PRIORITY_DEBUG;
+		}
+	}
+	else if (auto* param = dyn_cast<Argument>(v))
+	{
+		assert(param->getParent());
+		auto* fnc = param->getParent();
+
+		auto* cf = conf.functions.getFunctionByName(fnc->getName());
+		if (cf)
+		{
+			auto* cp = cf->parameters.getObjectByName(param->getName());
+			if (cp && cp->isFromDebug())
+			{
+				p = eSourcePriority::PRIORITY_DEBUG;
+			}
+		}
+	}
+
+	return p;
+}
+
 /**
  * We want to proapgate true type of this entry.
  * However, object allocated on stack (@c AllocaInst),
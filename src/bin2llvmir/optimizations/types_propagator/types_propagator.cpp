@@ -6,6 +6,7 @@
 
 #include <optional>
 #include <queue>
+#include <stdexcept>
 
 #include "retdec/utils/io/log.h"
 #include "retdec/bin2llvmir/optimizations/types_propagator/types_propagator.h"
@@ -70,7 +71,7 @@ for (auto& eq : _eqSets)
 			Log::info() << "\t\t" << llvmObjToString(v) << std::endl;
 	}
 }
-exit(1);
+throw std::runtime_error("TypesPropagator: propagation of types is not finished");
 
 	return changed;
 }
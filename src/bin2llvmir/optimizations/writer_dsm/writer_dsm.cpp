@@ -357,7 +357,7 @@ std::string DsmWriter::processInstructionDsm(AsmInstruction& ai)
 	std::string comment;
 	if (_config->getConfig().architecture.isX86())
 	{
-		auto* capstoneI = ai.getCapstoneInsn();
+		auto* capstoneI = ai.getTemporaryCapstoneInsn();
 		auto& xi = capstoneI->detail->x86;
 		for (unsigned j = 0; j < xi.op_count; ++j)
 		{
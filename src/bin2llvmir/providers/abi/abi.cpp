@@ -13,6 +13,7 @@
 #include "retdec/bin2llvmir/providers/abi/x86.h"
 #include "retdec/bin2llvmir/providers/abi/x64.h"
 #include "retdec/bin2llvmir/providers/abi/pic32.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 
 using namespace llvm;
 
@@ -146,7 +147,7 @@ bool Abi::isStackVariable(const Value* val) const
 
 bool Abi::isNopInstruction(AsmInstruction ai)
 {
-	return isNopInstruction(ai.getCapstoneInsn());
+	return isNopInstruction(ai.getTemporaryCapstoneInsn());
 }
 
 std::size_t Abi::getTypeByteSize(llvm::Type* t) const
@@ -297,8 +298,6 @@ Config* Abi::getConfig() const
 //==============================================================================
 //
 
-std::map<llvm::Module*, std::unique_ptr<Abi>> AbiProvider::_module2abi;
-
 Abi* AbiProvider::addAbi(
 		llvm::Module* m,
 		Config* c)
@@ -308,30 +307,31 @@ Abi* AbiProvider::addAbi(
 		return nullptr;
 	}
 
+	auto& ctx = ProviderContext::createContext(m);
+	if (ctx.abi)
+	{
+		return ctx.abi.get();
+	}
+
 	if (c->getConfig().architecture.isArm32OrThumb())
 	{
-		auto p = _module2abi.emplace(m, std::make_unique<AbiArm>(m, c));
-		return p.first->second.get();
+		ctx.abi = std::make_unique<AbiArm>(m, c);
 	}
 	else if (c->getConfig().architecture.isArm64())
 	{
-		auto p = _module2abi.emplace(m, std::make_unique<AbiArm64>(m, c));
-		return p.first->second.get();
+		ctx.abi = std::make_unique<AbiArm64>(m, c);
 	}
 	else if (c->getConfig().architecture.isMips())
 	{
-		auto p = _module2abi.emplace(m, std::make_unique<AbiMips>(m, c));
-		return p.first->second.get();
+		ctx.abi = std::make_unique<AbiMips>(m, c);
 	}
 	else if (c->getConfig().architecture.isPic32())
 	{
-		auto p = _module2abi.emplace(m, std::make_unique<AbiPic32>(m, c));
-		return p.first->second.get();
+		ctx.abi = std::make_unique<AbiPic32>(m, c);
 	}
 	else if (c->getConfig().architecture.isPpc())
 	{
-		auto p = _module2abi.emplace(m, std::make_unique<AbiPowerpc>(m, c));
-		return p.first->second.get();
+		ctx.abi = std::make_unique<AbiPowerpc>(m, c);
 	}
 	else if (c->getConfig().architecture.isX86_64())
 	{
@@ -339,27 +339,26 @@ Abi* AbiProvider::addAbi(
 
 		if (isPe || c->getConfig().tools.isMsvc())
 		{
-			auto p = _module2abi.emplace(m, std::make_unique<AbiMS_X64>(m, c));
-			return p.first->second.get();
+			ctx.abi = std::make_unique<AbiMS_X64>(m, c);
+		}
+		else
+		{
+			ctx.abi = std::make_unique<AbiX64>(m, c);
 		}
-
-		auto p = _module2abi.emplace(m, std::make_unique<AbiX64>(m, c));
-		return p.first->second.get();
 	}
 	else if (c->getConfig().architecture.isX86())
 	{
-		auto p = _module2abi.emplace(m, std::make_unique<AbiX86>(m, c));
-		return p.first->second.get();
+		ctx.abi = std::make_unique<AbiX86>(m, c);
 	}
 	// ...
 
-	return nullptr;
+	return ctx.abi.get();
 }
 
 Abi* AbiProvider::getAbi(llvm::Module* m)
 {
-	auto f = _module2abi.find(m);
-	return f != _module2abi.end() ? f->second.get() : nullptr;
+	auto* ctx = ProviderContext::getContext(m);
+	return ctx ? ctx->abi.get() : nullptr;
 }
 
 bool AbiProvider::getAbi(llvm::Module* m, Abi*& abi)
@@ -370,7 +369,10 @@ bool AbiProvider::getAbi(llvm::Module* m, Abi*& abi)
 
 void AbiProvider::clear()
 {
-	_module2abi.clear();
+	ProviderContext::forEachContext([](ProviderContext& ctx)
+	{
+		ctx.abi.reset();
+	});
 }
 
 } // namespace bin2llvmir
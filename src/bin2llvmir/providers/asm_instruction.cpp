@@ -11,6 +11,7 @@
 #include "retdec/utils/string.h"
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
 #include "retdec/bin2llvmir/providers/names.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/utils/debug.h"
 #include "retdec/bin2llvmir/utils/ir_modifier.h"
 #include "retdec/bin2llvmir/utils/llvm.h"
@@ -20,9 +21,6 @@ using namespace llvm;
 namespace retdec {
 namespace bin2llvmir {
 
-std::vector<AsmInstruction::ModuleGlobalPair> AsmInstruction::_module2global;
-std::vector<AsmInstruction::ModuleInstructionMap> AsmInstruction::_module2instMap;
-
 AsmInstruction::AsmInstruction()
 {
 
@@ -183,41 +181,37 @@ const llvm::GlobalVariable* AsmInstruction::getLlvmToAsmGlobalVariablePrivate(
 	}
 }
 
-Llvm2CapstoneInsnMap& AsmInstruction::getLlvmToCapstoneInsnMap(
-		const llvm::Module* m)
+/**
+ * @return Table of instructions decoded into the given module @a m.
+ */
+AsmInstructionTable& AsmInstruction::getInstructionTable(const llvm::Module* m)
 {
-	for (auto& p : _module2instMap)
+	auto& ctx = ProviderContext::createContext(m);
+	if (ctx.asmInstructions == nullptr)
 	{
-		if (p.first == m)
-		{
-			return p.second;
-		}
+		ctx.asmInstructions = std::make_unique<AsmInstructionTable>();
 	}
+	return *ctx.asmInstructions;
+}
 
-	auto it = _module2instMap.emplace(_module2instMap.end(), std::make_pair(
-			m,
-			std::map<llvm::StoreInst*, cs_insn*>()));
-	return it->second;
+AsmInstructionTable* AsmInstruction::getInstructionTablePrivate() const
+{
+	auto* ctx = ProviderContext::getContext(_llvmToAsmInstr->getModule());
+	return ctx ? ctx->asmInstructions.get() : nullptr;
 }
 
 llvm::GlobalVariable* AsmInstruction::getLlvmToAsmGlobalVariable(
 		const llvm::Module* m)
 {
-	for (auto& p : _module2global)
-	{
-		if (p.first == m)
-		{
-			return p.second;
-		}
-	}
-	return nullptr;
+	auto* ctx = ProviderContext::getContext(m);
+	return ctx ? ctx->llvmToAsmGlobal : nullptr;
 }
 
 void AsmInstruction::setLlvmToAsmGlobalVariable(
 		const llvm::Module* m,
 		llvm::GlobalVariable* gv)
 {
-	_module2global.emplace_back(m, gv);
+	ProviderContext::createContext(m).llvmToAsmGlobal = gv;
 }
 
 retdec::common::Address AsmInstruction::getInstructionAddress(
@@ -328,8 +322,23 @@ bool AsmInstruction::isLlvmToAsmInstruction(const llvm::Value* inst)
 
 void AsmInstruction::clear()
 {
-	_module2global.clear();
-	_module2instMap.clear();
+	ProviderContext::forEachContext([](ProviderContext& ctx)
+	{
+		ctx.llvmToAsmGlobal = nullptr;
+		ctx.asmInstructions.reset();
+	});
+}
+
+/**
+ * Clear LLVM to ASM mapping data associated with the given module @a m.
+ */
+void AsmInstruction::clear(const llvm::Module* m)
+{
+	if (auto* ctx = ProviderContext::getContext(m))
+	{
+		ctx->llvmToAsmGlobal = nullptr;
+		ctx->asmInstructions.reset();
+	}
 }
 
 bool AsmInstruction::isValid() const
@@ -342,29 +351,39 @@ bool AsmInstruction::isInvalid() const
 	return !isValid();
 }
 
+/**
+ * @return Capstone instruction of this ASM instruction. It is disassembled
+ *         again when it is asked for the first time and it is kept until
+ *         the instructions are freed by @c AsmInstructionRemover.
+ */
 cs_insn* AsmInstruction::getCapstoneInsn() const
 {
-	for (auto& p : _module2instMap)
-	{
-		if (p.first == _llvmToAsmInstr->getModule())
-		{
-			auto it =  p.second.find(_llvmToAsmInstr);
-			return it != p.second.end() ? it->second : nullptr;
-		}
-	}
+	auto* table = getInstructionTablePrivate();
+	return table ? table->getCapstoneInsn(getAddress()) : nullptr;
+}
 
-	return nullptr;
+/**
+ * The same as @c getCapstoneInsn(), but the returned instruction is not kept
+ * and it is overwritten by the next call of this method (on any instruction
+ * in the same module). Use it when many instructions are inspected one by one.
+ */
+cs_insn* AsmInstruction::getTemporaryCapstoneInsn() const
+{
+	auto* table = getInstructionTablePrivate();
+	return table ? table->getTemporaryCapstoneInsn(getAddress()) : nullptr;
 }
 
 std::string AsmInstruction::getDsm() const
 {
-	auto* i = getCapstoneInsn();
+	auto* i = getTemporaryCapstoneInsn();
 	return std::string(i->mnemonic) + " " + std::string(i->op_str);
 }
 
 std::size_t AsmInstruction::getByteSize() const
 {
-	return getCapstoneInsn()->size;
+	auto* table = getInstructionTablePrivate();
+	auto* r = table ? table->get(getAddress()) : nullptr;
+	return r ? r->size : 0;
 }
 
 retdec::common::Address AsmInstruction::getAddress() const
@@ -0,0 +1,264 @@
+/**
+ * @file src/bin2llvmir/providers/asm_instruction_table.cpp
+ * @brief Compact storage of decoded assembly instructions.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include "retdec/bin2llvmir/providers/asm_instruction_table.h"
+
+namespace retdec {
+namespace bin2llvmir {
+
+AsmInstructionTable::~AsmInstructionTable()
+{
+	clear();
+	if (_handle)
+	{
+		cs_close(&_handle);
+	}
+}
+
+/**
+ * Set Capstone architecture used to disassemble the instructions.
+ * This must be done before any instruction is disassembled.
+ */
+void AsmInstructionTable::setArchitecture(cs_arch arch)
+{
+	if (_handle && arch != _arch)
+	{
+		clear();
+		cs_close(&_handle);
+		_handle = 0;
+	}
+	_arch = arch;
+}
+
+/**
+ * Add instruction decoded at the given address.
+ * @param addr  Address of the instruction.
+ * @param bytes Bytes of the instruction. They must live as long as the
+ *              table, i.e. they should point into the input image.
+ * @param size  Byte size of the instruction.
+ * @param mode  Capstone mode (basic and extra) it was decoded in.
+ * @param insn  Capstone instruction as it was decoded, if available. It is
+ *              copied if it could not be disassembled again from its bytes
+ *              alone, it is not used otherwise.
+ */
+void AsmInstructionTable::add(
+		common::Address addr,
+		const std::uint8_t* bytes,
+		std::size_t size,
+		cs_mode mode,
+		const cs_insn* insn)
+{
+	auto& r = _records[addr];
+	bool keep = insn && dependsOnContext(insn, mode);
+	if (r.bytes == bytes && r.mode == mode && r.size == size && !keep)
+	{
+		return;
+	}
+
+	r.bytes = bytes;
+	r.mode = mode;
+	r.size = size;
+
+	auto fIt = _insns.find(addr);
+	if (fIt != _insns.end())
+	{
+		cs_free(fIt->second, 1);
+		_insns.erase(fIt);
+	}
+
+	if (keep)
+	{
+		if (auto* c = copy(insn, mode))
+		{
+			_insns.emplace(addr, c);
+		}
+	}
+}
+
+/**
+ * @return Record of the instruction at the given address, or @c nullptr if
+ *         there is no such instruction.
+ */
+const AsmInstructionTable::Record* AsmInstructionTable::get(
+		common::Address addr) const
+{
+	auto fIt = _records.find(addr);
+	return fIt != _records.end() ? &fIt->second : nullptr;
+}
+
+std::size_t AsmInstructionTable::size() const
+{
+	return _records.size();
+}
+
+/**
+ * @return Capstone instruction at the given address, or @c nullptr if there
+ *         is no such instruction. It is disassembled when it is asked for
+ *         the first time and it lives until the table is cleared.
+ */
+cs_insn* AsmInstructionTable::getCapstoneInsn(common::Address addr)
+{
+	auto fIt = _insns.find(addr);
+	if (fIt != _insns.end())
+	{
+		return fIt->second;
+	}
+
+	auto* r = get(addr);
+	if (r == nullptr)
+	{
+		return nullptr;
+	}
+
+	cs_insn* insn = nullptr;
+	if (!disassemble(addr, *r, insn))
+	{
+		if (insn)
+		{
+			cs_free(insn, 1);
+		}
+		return nullptr;
+	}
+
+	_insns.emplace(addr, insn);
+	return insn;
+}
+
+/**
+ * The same as getCapstoneInsn(), but the returned instruction is not kept.
+ *
+ * The instruction may be a single scratch buffer owned by the table and
+ * shared by all its callers. It is overwritten by the next call of this
+ * method for any address, so it must not be stored, modified, or used after
+ * calling anything that may inspect other instructions. Use getCapstoneInsn()
+ * for instructions which must stay valid.
+ */
+cs_insn* AsmInstructionTable::getTemporaryCapstoneInsn(common::Address addr)
+{
+	auto fIt = _insns.find(addr);
+	if (fIt != _insns.end())
+	{
+		return fIt->second;
+	}
+
+	auto* r = get(addr);
+	return r && disassemble(addr, *r, _temporary) ? _temporary : nullptr;
+}
+
+/**
+ * Remove all the instructions.
+ */
+void AsmInstructionTable::clear()
+{
+	for (auto& p : _insns)
+	{
+		cs_free(p.second, 1);
+	}
+	_insns.clear();
+	_records.clear();
+
+	if (_temporary)
+	{
+		cs_free(_temporary, 1);
+		_temporary = nullptr;
+	}
+}
+
+/**
+ * Open the Capstone engine if it is not opened yet, and switch it to the
+ * given mode.
+ */
+bool AsmInstructionTable::openHandle(cs_mode mode)
+{
+	if (_handle == 0)
+	{
+		if (cs_open(_arch, mode, &_handle) != CS_ERR_OK)
+		{
+			_handle = 0;
+			return false;
+		}
+		cs_option(_handle, CS_OPT_DETAIL, CS_OPT_ON);
+		_handleMode = mode;
+	}
+	else if (mode != _handleMode)
+	{
+		if (cs_option(_handle, CS_OPT_MODE, mode) != CS_ERR_OK)
+		{
+			return false;
+		}
+		_handleMode = mode;
+	}
+	return true;
+}
+
+/**
+ * Capstone tracks IT blocks across the instructions it disassembles. THUMB
+ * instructions in them get the condition code of the block (and 16-bit ones
+ * also a different flag setting), which is lost when they are disassembled
+ * on their own.
+ * @return @c True if the given instruction would be disassembled differently
+ *         from its bytes alone.
+ */
+bool AsmInstructionTable::dependsOnContext(
+		const cs_insn* insn,
+		cs_mode mode) const
+{
+	return _arch == CS_ARCH_ARM
+			&& (mode & CS_MODE_THUMB)
+			&& insn->detail
+			&& insn->detail->arm.cc != ARM_CC_INVALID
+			&& insn->detail->arm.cc != ARM_CC_AL;
+}
+
+/**
+ * @return Copy of the given instruction with its details, allocated by the
+ *         table's Capstone engine, or @c nullptr if it cannot be allocated.
+ */
+cs_insn* AsmInstructionTable::copy(const cs_insn* insn, cs_mode mode)
+{
+	if (!openHandle(mode))
+	{
+		return nullptr;
+	}
+
+	cs_insn* c = cs_malloc(_handle);
+	cs_detail* detail = c->detail;
+	*c = *insn;
+	c->detail = detail;
+	if (detail && insn->detail)
+	{
+		*detail = *insn->detail;
+	}
+	return c;
+}
+
+/**
+ * Disassemble the instruction from the given record into @a insn.
+ * If @a insn is @c nullptr, a new instruction is allocated.
+ */
+bool AsmInstructionTable::disassemble(
+		common::Address addr,
+		const Record& r,
+		cs_insn*& insn)
+{
+	if (!openHandle(r.mode))
+	{
+		return false;
+	}
+
+	if (insn == nullptr)
+	{
+		insn = cs_malloc(_handle);
+	}
+
+	const std::uint8_t* bytes = r.bytes;
+	std::size_t size = r.size;
+	std::uint64_t address = addr;
+	return cs_disasm_iter(_handle, &bytes, &size, &address, insn);
+}
+
+} // namespace bin2llvmir
+} // namespace retdec
@@ -10,6 +10,7 @@
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
 #include "retdec/bin2llvmir/providers/config.h"
 #include "retdec/bin2llvmir/providers/demangler.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/utils/debug.h"
 #include "retdec/bin2llvmir/utils/llvm.h"
 #include "retdec/utils/string.h"
@@ -732,18 +733,20 @@ void Config::tagFunctionsWithUsedCryptoGlobals()
 //=============================================================================
 //
 
-std::map<llvm::Module*, Config> ConfigProvider::_module2config;
-
 Config* ConfigProvider::addConfig(llvm::Module* m, retdec::config::Config& c)
 {
-	auto p = _module2config.emplace(m, Config::fromConfig(m, c));
-	return &p.first->second;
+	auto& ctx = ProviderContext::createContext(m);
+	if (ctx.config == nullptr)
+	{
+		ctx.config = std::make_unique<Config>(Config::fromConfig(m, c));
+	}
+	return ctx.config.get();
 }
 
 Config* ConfigProvider::getConfig(llvm::Module* m)
 {
-	auto f = _module2config.find(m);
-	return f != _module2config.end() ? &f->second : nullptr;
+	auto* ctx = ProviderContext::getContext(m);
+	return ctx ? ctx->config.get() : nullptr;
 }
 
 bool ConfigProvider::getConfig(llvm::Module* m, Config*& c)
@@ -766,7 +769,10 @@ void ConfigProvider::doFinalization(llvm::Module* m)
  */
 void ConfigProvider::clear()
 {
-	_module2config.clear();
+	ProviderContext::forEachContext([](ProviderContext& ctx)
+	{
+		ctx.config.reset();
+	});
 }
 
 } // namespace bin2llvmir
@@ -6,6 +6,7 @@
 
 #include "retdec/utils/string.h"
 #include "retdec/bin2llvmir/providers/fileimage.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/utils/ir_modifier.h"
 #include "retdec/loader/image_factory.h"
 #include "retdec/loader/loader/raw_data/raw_data_image.h"
@@ -625,8 +626,6 @@ bool FileImage::isImportTerminating(
 //=============================================================================
 //
 
-std::map<llvm::Module*, FileImage> FileImageProvider::_module2image;
-
 /**
  * Create and add to provider a file image created from file at @a path for
  * the given module @a m and architecture @a a.
@@ -659,8 +658,12 @@ FileImage* FileImageProvider::addFileImage(
 		llvm::Module* m,
 		FileImage img)
 {
-	auto p = _module2image.emplace(m, std::move(img));
-	return &p.first->second;
+	auto& ctx = ProviderContext::createContext(m);
+	if (ctx.fileImage == nullptr)
+	{
+		ctx.fileImage = std::make_unique<FileImage>(std::move(img));
+	}
+	return ctx.fileImage.get();
 }
 
 /**
@@ -670,8 +673,8 @@ FileImage* FileImageProvider::addFileImage(
 FileImage* FileImageProvider::getFileImage(
 		llvm::Module* m)
 {
-	auto f = _module2image.find(m);
-	return f != _module2image.end() ? &f->second : nullptr;
+	auto* ctx = ProviderContext::getContext(m);
+	return ctx ? ctx->fileImage.get() : nullptr;
 }
 
 /**
@@ -695,7 +698,10 @@ bool FileImageProvider::getFileImage(
  */
 void FileImageProvider::clear()
 {
-	_module2image.clear();
+	ProviderContext::forEachContext([](ProviderContext& ctx)
+	{
+		ctx.fileImage.reset();
+	});
 }
 
 } // namespace bin2llvmir
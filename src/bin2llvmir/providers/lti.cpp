@@ -18,6 +18,7 @@
 #include "retdec/ctypes/void_type.h"
 #include "retdec/utils/string.h"
 #include "retdec/bin2llvmir/providers/lti.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/utils/ctypes2llvm.h"
 
 using namespace llvm;
@@ -91,16 +92,34 @@ Lti::Lti(
 	}
 }
 
+/**
+ * Load LTI file from @c filePath. Its precompiled database is used instead of
+ * the JSON file if it exists.
+ */
 void Lti::loadLtiFile(const std::string& filePath)
 {
+	std::string cc = "cdecl";
+	if (retdec::utils::containsCaseInsensitive(filePath, "win"))
+	{
+		cc = "stdcall";
+	}
+
+	auto db = std::make_unique<ctypesparser::BinaryCTypesDatabase>(
+			static_cast<unsigned>(
+					_config->getConfig().architecture.getBitSize()));
+	if (db->load(
+			ctypesparser::BinaryCTypesDatabase::getDatabasePath(filePath),
+			_ltiModule->getContext(),
+			_typeConfig->typeWidths(),
+			cc))
+	{
+		_ltiDatabases.push_back(std::move(db));
+		return;
+	}
+
 	std::ifstream file(filePath);
 	if (file)
 	{
-		std::string cc = "cdecl";
-		if (retdec::utils::containsCaseInsensitive(filePath, "win"))
-		{
-			cc = "stdcall";
-		}
 		_ltiParser.parseInto(file, _ltiModule, _typeConfig->typeWidths(), cc);
 	}
 }
@@ -110,10 +129,29 @@ bool Lti::hasLtiFunction(const std::string& name)
 	return getLtiFunction(name) != nullptr;
 }
 
+/**
+ * Get LTI function with @c name. Functions from precompiled databases are
+ * created on the first request, databases are searched in the order in which
+ * they were loaded.
+ */
 std::shared_ptr<retdec::ctypes::Function> Lti::getLtiFunction(
 		const std::string& name)
 {
-	return _ltiModule->getFunctionWithName(name);
+	if (auto fnc = _ltiModule->getFunctionWithName(name))
+	{
+		return fnc;
+	}
+
+	for (auto& db : _ltiDatabases)
+	{
+		if (auto fnc = db->getFunction(name))
+		{
+			_ltiModule->addFunction(fnc);
+			return fnc;
+		}
+	}
+
+	return nullptr;
 }
 
 /**
@@ -234,8 +272,6 @@ llvm::Type* Lti::getLlvmType(std::shared_ptr<retdec::ctypes::Type> type)
 //=============================================================================
 //
 
-std::map<llvm::Module*, Lti> LtiProvider::_module2lti;
-
 Lti* LtiProvider::addLti(
 	llvm::Module *m,
 	Config *c,
@@ -247,14 +283,18 @@ Lti* LtiProvider::addLti(
 		return nullptr;
 	}
 
-	auto p = _module2lti.emplace(m, Lti(m, c, typeConfig, objf));
-	return &p.first->second;
+	auto& ctx = ProviderContext::createContext(m);
+	if (ctx.lti == nullptr)
+	{
+		ctx.lti = std::make_unique<Lti>(m, c, typeConfig, objf);
+	}
+	return ctx.lti.get();
 }
 
 Lti* LtiProvider::getLti(llvm::Module* m)
 {
-	auto f = _module2lti.find(m);
-	return f != _module2lti.end() ? &f->second : nullptr;
+	auto* ctx = ProviderContext::getContext(m);
+	return ctx ? ctx->lti.get() : nullptr;
 }
 
 bool LtiProvider::getLti(llvm::Module* m, Lti*& lti)
@@ -265,7 +305,10 @@ bool LtiProvider::getLti(llvm::Module* m, Lti*& lti)
 
 void LtiProvider::clear()
 {
-	_module2lti.clear();
+	ProviderContext::forEachContext([](ProviderContext& ctx)
+	{
+		ctx.lti.reset();
+	});
 }
 
 } // namespace bin2llvmir
@@ -4,7 +4,12 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <map>
+#include <memory>
+#include <mutex>
+
 #include "retdec/bin2llvmir/providers/names.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/utils/string.h"
 
 using namespace retdec::common;
@@ -474,16 +479,58 @@ void NameContainer::initFromImage()
 //	}
 }
 
-std::string NameContainer::getNameFromImportLibAndOrd(
+/**
+ * Packed ordinal database at the given path. Each database is opened and
+ * mapped only once per process and it is shared by all the name containers
+ * (and threads) which ask for it. It is never closed.
+ * @return Database, which is not valid if it cannot be opened.
+ */
+const retdec::utils::OrdinalDatabase& NameContainer::getOrdinalDatabase(
+		const std::string& path)
+{
+	static std::mutex mutex;
+	static std::map<std::string, std::unique_ptr<OrdinalDatabase>> databases;
+
+	std::lock_guard<std::mutex> lock(mutex);
+	auto& db = databases[path];
+	if (db == nullptr)
+	{
+		db = std::make_unique<OrdinalDatabase>(path);
+	}
+	return *db;
+}
+
+/**
+ * @return Name of the function imported from the given library by the given
+ *         ordinal, or an empty string if it is not known. The name points
+ *         either into the shared ordinal database, or into this container.
+ */
+std::string_view NameContainer::getNameFromImportLibAndOrd(
 		const std::string& libName,
 		int ord)
 {
+	if (_ordDatabase == nullptr)
+	{
+		static const OrdinalDatabase noDatabase;
+		auto arch = getOrdinalsArchitecture();
+		auto dir = _config->getConfig().parameters.getOrdinalNumbersDirectory();
+		_ordDatabase = arch.empty()
+				? &noDatabase
+				: &getOrdinalDatabase(dir + "/" + arch + ".orddb");
+	}
+	if (_ordDatabase->isValid())
+	{
+		return ord < 0
+				? std::string_view()
+				: _ordDatabase->getName(libName, ord);
+	}
+
 	auto it = _dllOrds.find(libName);
 	if (it == _dllOrds.end())
 	{
 		if (!loadImportOrds(libName))
 		{
-			return std::string();
+			return std::string_view();
 		}
 		else
 		{
@@ -498,15 +545,31 @@ std::string NameContainer::getNameFromImportLibAndOrd(
 		return ordIt->second;
 	}
 
-	return std::string();
+	return std::string_view();
+}
+
+/**
+ * Name of the subdirectory of the ordinal numbers directory with ordinals for
+ * the architecture of the input, or an empty string if there is none.
+ */
+std::string NameContainer::getOrdinalsArchitecture() const
+{
+	if (_config->getConfig().architecture.isArm()) return "arm";
+	else if (_config->getConfig().architecture.isX86()) return "x86";
+	else return std::string();
 }
 
+/**
+ * Loads ordinals of the given library from its text file. This is a fallback
+ * for ordinal directories without packed databases.
+ */
 bool NameContainer::loadImportOrds(const std::string& libName)
 {
-	std::string arch;
-	if (_config->getConfig().architecture.isArm()) arch = "arm";
-	else if (_config->getConfig().architecture.isX86()) arch = "x86";
-	else return false;
+	std::string arch = getOrdinalsArchitecture();
+	if (arch.empty())
+	{
+		return false;
+	}
 
 	auto dir = _config->getConfig().parameters.getOrdinalNumbersDirectory();
 	auto filePath = dir + "/" + arch + "/" + libName + ".ord";
@@ -544,8 +607,6 @@ bool NameContainer::loadImportOrds(const std::string& libName)
 //==============================================================================
 //
 
-std::map<llvm::Module*, NameContainer> NamesProvider::_module2names;
-
 NameContainer* NamesProvider::addNames(
 		llvm::Module* m,
 		Config* c,
@@ -563,14 +624,18 @@ NameContainer* NamesProvider::addNames(
 		return nullptr;
 	}
 
-	auto p = _module2names.emplace(m, NameContainer(m, c, d, i, dm, lti));
-	return &p.first->second;
+	auto& ctx = ProviderContext::createContext(m);
+	if (ctx.names == nullptr)
+	{
+		ctx.names = std::make_unique<NameContainer>(m, c, d, i, dm, lti);
+	}
+	return ctx.names.get();
 }
 
 NameContainer* NamesProvider::getNames(llvm::Module* m)
 {
-	auto f = _module2names.find(m);
-	return f != _module2names.end() ? &f->second : nullptr;
+	auto* ctx = ProviderContext::getContext(m);
+	return ctx ? ctx->names.get() : nullptr;
 }
 
 bool NamesProvider::getNames(llvm::Module* m, NameContainer*& names)
@@ -581,7 +646,10 @@ bool NamesProvider::getNames(llvm::Module* m, NameContainer*& names)
 
 void NamesProvider::clear()
 {
-	_module2names.clear();
+	ProviderContext::forEachContext([](ProviderContext& ctx)
+	{
+		ctx.names.reset();
+	});
 }
 
 } // namespace bin2llvmir
@@ -0,0 +1,124 @@
+/**
+ * @file src/bin2llvmir/providers/provider_context.cpp
+ * @brief Per-module storage of all the objects managed by providers.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <mutex>
+
+#include "retdec/bin2llvmir/providers/abi/abi.h"
+#include "retdec/bin2llvmir/providers/asm_instruction_table.h"
+#include "retdec/bin2llvmir/providers/config.h"
+#include "retdec/bin2llvmir/providers/debugformat.h"
+#include "retdec/bin2llvmir/providers/demangler.h"
+#include "retdec/bin2llvmir/providers/fileimage.h"
+#include "retdec/bin2llvmir/providers/lti.h"
+#include "retdec/bin2llvmir/providers/names.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
+
+namespace retdec {
+namespace bin2llvmir {
+
+std::map<const llvm::Module*, std::unique_ptr<ProviderContext>>
+		ProviderContext::_module2context;
+std::shared_mutex ProviderContext::_mutex;
+std::atomic<std::size_t> ProviderContext::_generation(1);
+thread_local ProviderContext::LookupCache ProviderContext::_lookupCache;
+
+ProviderContext::~ProviderContext()
+{
+
+}
+
+/**
+ * @return Context associated with the given module @a m or @c nullptr if
+ *         there is no associated context.
+ */
+ProviderContext* ProviderContext::getContext(const llvm::Module* m)
+{
+	auto gen = _generation.load(std::memory_order_acquire);
+	if (_lookupCache.module == m && _lookupCache.generation == gen)
+	{
+		return _lookupCache.context;
+	}
+
+	std::shared_lock<std::shared_mutex> lock(_mutex);
+	auto f = _module2context.find(m);
+	if (f == _module2context.end())
+	{
+		return nullptr;
+	}
+
+	_lookupCache = LookupCache{m, f->second.get(), gen};
+	return f->second.get();
+}
+
+/**
+ * @return Context associated with the given module @a m. If there is no such
+ *         context, a new empty one is created.
+ */
+ProviderContext& ProviderContext::createContext(const llvm::Module* m)
+{
+	if (auto* c = getContext(m))
+	{
+		return *c;
+	}
+
+	std::unique_lock<std::shared_mutex> lock(_mutex);
+	auto& c = _module2context[m];
+	if (c == nullptr)
+	{
+		c = std::make_unique<ProviderContext>();
+	}
+	return *c;
+}
+
+/**
+ * Destroy the context associated with the given module @a m, together with
+ * all the provided objects it holds.
+ */
+void ProviderContext::removeContext(const llvm::Module* m)
+{
+	std::unique_ptr<ProviderContext> removed;
+	{
+		std::unique_lock<std::shared_mutex> lock(_mutex);
+		auto f = _module2context.find(m);
+		if (f == _module2context.end())
+		{
+			return;
+		}
+		removed = std::move(f->second);
+		_module2context.erase(f);
+		_generation.fetch_add(1, std::memory_order_acq_rel);
+	}
+	// Destroy the context outside of the lock.
+}
+
+/**
+ * Call @a f on all the existing contexts.
+ */
+void ProviderContext::forEachContext(
+		const std::function<void(ProviderContext&)>& f)
+{
+	std::unique_lock<std::shared_mutex> lock(_mutex);
+	for (auto& p : _module2context)
+	{
+		f(*p.second);
+	}
+}
+
+/**
+ * Destroy all the contexts.
+ */
+void ProviderContext::clear()
+{
+	std::map<const llvm::Module*, std::unique_ptr<ProviderContext>> removed;
+	{
+		std::unique_lock<std::shared_mutex> lock(_mutex);
+		removed.swap(_module2context);
+		_generation.fetch_add(1, std::memory_order_acq_rel);
+	}
+}
+
+} // namespace bin2llvmir
+} // namespace retdec
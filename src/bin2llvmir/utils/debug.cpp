@@ -14,6 +14,7 @@
 
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
 #include "retdec/bin2llvmir/providers/names.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/utils/debug.h"
 #include "retdec/common/address.h"
 
@@ -57,9 +58,9 @@ void dumpModuleToFile(
 		fs::path dirName,
 		const std::string& fileName)
 {
-	static unsigned cntr = 0;
+	auto& ctx = ProviderContext::createContext(m);
 	std::string n = fileName.empty()
-			? "dump_" + std::to_string(cntr++) + ".ll"
+			? "dump_" + std::to_string(ctx.moduleDumps++) + ".ll"
 			: fileName;
 
 	dirName.append(n);
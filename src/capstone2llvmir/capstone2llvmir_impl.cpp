@@ -236,14 +236,10 @@ Capstone2LlvmIrTranslator_impl<CInsn, CInsnOp>::translateOne(
 		retdec::common::Address& a,
 		llvm::IRBuilder<>& irb)
 {
-	TranslationResultOne res;
-
 	// We want to keep all Capstone instructions -> alloc a new one each time.
 	cs_insn* insn = cs_malloc(_handle);
 
 	uint64_t address = a;
-	_branchGenerated = nullptr;
-	_inCondition = false;
 
 	// TODO: hack, solve better.
 	bool disasmRes = cs_disasm_iter(_handle, &bytes, &size, &address, insn);
@@ -256,21 +252,35 @@ Capstone2LlvmIrTranslator_impl<CInsn, CInsnOp>::translateOne(
 
 	if (disasmRes)
 	{
-		auto* a2l = generateSpecialAsm2LlvmInstr(irb, insn);
-		translateInstruction(insn, irb);
-
-		res.llvmInsn = a2l;
-		res.capstoneInsn = insn;
-		res.size = insn->size;
-		res.branchCall = _branchGenerated;
-		res.inCondition = _inCondition;
-
 		a = address;
+		return translateOne(insn, irb);
 	}
 	else
 	{
 		cs_free(insn, 1);
+		return TranslationResultOne();
 	}
+}
+
+template <typename CInsn, typename CInsnOp>
+typename Capstone2LlvmIrTranslator_impl<CInsn, CInsnOp>::TranslationResultOne
+Capstone2LlvmIrTranslator_impl<CInsn, CInsnOp>::translateOne(
+		cs_insn* insn,
+		llvm::IRBuilder<>& irb)
+{
+	TranslationResultOne res;
+
+	_branchGenerated = nullptr;
+	_inCondition = false;
+
+	auto* a2l = generateSpecialAsm2LlvmInstr(irb, insn);
+	translateInstruction(insn, irb);
+
+	res.llvmInsn = a2l;
+	res.capstoneInsn = insn;
+	res.size = insn->size;
+	res.branchCall = _branchGenerated;
+	res.inCondition = _inCondition;
 
 	return res;
 }
@@ -16,6 +16,7 @@
 #include "retdec/cpdetect/heuristics/pe_heuristics.h"
 #include "retdec/cpdetect/settings.h"
 #include "retdec/yaracpp/yara_detector.h"
+#include "retdec/yaracpp/yara_rules_cache.h"
 
 using namespace retdec::fileformat;
 using namespace retdec::utils;
@@ -500,26 +501,28 @@ ReturnCode CompilerDetector::getAllSignatures()
 {
 	YaraDetector yara;
 
-	// Add internal paths.
-	unsigned iCntr = 0;
+	// Every database is compiled (or loaded if it is precompiled) only once
+	// per process, so there is no need for namespaces - each database has
+	// its own compiled rules.
 	for (const auto &ruleFile : internalPaths)
 	{
-		std::string nameSpace = "internal_" + std::to_string(iCntr++);
-		yara.addRuleFile(ruleFile, nameSpace);
+		yara.addRules(YaraRulesCache::getRules(ruleFile));
 	}
 
-	unsigned eCntr = 0;
 	if (cpParams.external && getExternalDatabases())
 	{
 		for (const auto &item : externalDatabase)
 		{
-			std::string nameSpace = "external_" + std::to_string(eCntr++);
-			yara.addRuleFile(item, nameSpace);
+			yara.addRules(YaraRulesCache::getRules(item));
 		}
 	}
 
+	// Scan the file which is already in memory instead of reading it again.
+	YaraDetector::MemoryBlock block;
+	block.data = fileParser.getBytesData();
+	block.size = fileParser.getFileLength();
 	yara.analyze(
-			fileParser.getPathToFile(),
+			{block},
 			cpParams.searchType != SearchType::EXACT_MATCH
 	);
 	const auto &detected = yara.getDetectedRules();
@@ -681,6 +684,13 @@ ReturnCode CompilerDetector::getAllSignatures()
 			const auto end = base
 					+ endShift
 					+ fileParser.bytesFromNibblesRounded(pattern.length()) - 1;
+			// Only rules that can reach the best similarity found so far are
+			// worth the full comparison.
+			if (cpParams.searchType == SearchType::MOST_SIMILAR
+					&& !search.mayBeSimilar(pattern, start, end, maxRatio))
+			{
+				continue;
+			}
 			if (search.areaSimilarity(pattern, sim, start, end)
 					&& (cpParams.searchType == SearchType::SIM_LIST
 						|| (cpParams.searchType == SearchType::MOST_SIMILAR
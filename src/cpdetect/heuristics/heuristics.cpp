@@ -34,6 +34,9 @@ const std::size_t MINIMUM_RUST_FUNCTIONS = 5;
 const std::size_t MINIMUM_GHC_SYMBOLS = 15;
 const std::size_t MINIMUM_GHC_RECORD_SIZE = 9; // "GHC X.X.X"
 
+/// UPX version string in ELF and Mach-O files
+const std::string upxIdString = "$Id: UPX ";
+
 /**
  * Delphi version names
  *
@@ -260,6 +263,11 @@ Heuristics::Heuristics(
 	}
 
 	noOfSections = sections.size();
+
+	if (fileParser.isElf() || fileParser.isMacho())
+	{
+		search.registerStrings({upxIdString});
+	}
 }
 
 /**
@@ -947,9 +955,9 @@ std::string Heuristics::getUpxVersion()
 	if (fileParser.isElf() || fileParser.isMacho())
 	{
 		// format: $Id: UPX x.xx
-		const std::string pattern = "$Id: UPX ";
+		const std::string &pattern = upxIdString;
 		const auto &content = search.getPlainString();
-		const auto pos = content.find(pattern);
+		const auto pos = search.findString(pattern, 0);
 		const std::size_t versionLen = 4;
 		if (pos <= content.length() - pattern.length() - versionLen)
 		{
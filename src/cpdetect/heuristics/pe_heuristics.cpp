@@ -102,6 +102,42 @@ const std::vector<std::string> msvcRuntimeStrings =
 	toWide(msvcRuntimeString, 4)
 };
 
+const std::string goBuildIdString = "\xFF Go build ID: ";
+
+const std::string autoItPrefix = "AU3!EA";
+
+const std::string beRoString = "Compiled by: BeRoTinyPascal - (C) Copyright 2006, Benjamin";
+
+/**
+ * Strings searched for by heuristics. Their occurrences are found in one pass
+ * over the file, see Search::registerStrings().
+ */
+const std::vector<std::string> searchedStrings =
+{
+	goBuildIdString,
+	"\0\0\0ENIGMA"s,
+	"Enigma protector v",
+	"BoG_ *90.0&!!  Yy>",
+	"UPX 1.0",
+	"UPX!",
+	"PEC2",
+	"FSG!",
+	"PECompact2",
+	"ByAdeptProtector",
+	"STAThreadAttribute",
+	"Protected_By_Attribute\0NETSpider.Attribute"s,
+	"Protected/Packed with ReNET-Pack by stx",
+	"\0NetzStarter\0netz\0"s,
+	"?.resources",
+	"ExcelsiorII1",
+	"SOFTWARE\\Borland\\Delphi\\RTL\0FPUMaskValue"s,
+	autoItPrefix,
+	beRoString,
+	msvcRuntimeStrings[0],
+	msvcRuntimeStrings[1],
+	msvcRuntimeStrings[2]
+};
+
 const std::vector<PeHeaderStyle> headerStyles =
 {
 //	{"Unknown",      { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 }},
@@ -114,15 +150,14 @@ const std::vector<PeHeaderStyle> headerStyles =
 };
 
 /**
- * Try to find string which indicates AutoIt programming language
+ * Check if string which indicates AutoIt programming language is on offset
  * @param content Content of file
+ * @param offset Offset of AutoIt prefix in @a content
  * @return @c true if string is found, @c false otherwise
  */
-bool findAutoIt(const std::string &content)
+bool isAutoIt(const std::string &content, std::size_t offset)
 {
-	const std::string prefix = "AU3!EA";
-	const std::regex regExp(prefix + "[0-9]{2}");
-	const auto offset = content.find(prefix);
+	const std::regex regExp(autoItPrefix + "[0-9]{2}");
 	return offset != std::string::npos
 			&& regex_match(content.substr(offset, 8), regExp);
 }
@@ -168,6 +203,7 @@ PeHeuristics::PeHeuristics(
 		, declaredLength(parser.getDeclaredFileLength())
 		, loadedLength(parser.getLoadedFileLength())
 {
+	search.registerStrings(searchedStrings);
 }
 
 /**
@@ -187,8 +223,7 @@ std::string PeHeuristics::getEnigmaVersion()
 	}
 
 	const std::string pattern = "\0\0\0ENIGMA"s;
-	const auto &content = search.getPlainString();
-	const auto pos = content.find(pattern, sec->getOffset());
+	const auto pos = search.findString(pattern, sec->getOffset());
 	if (pos < sec->getOffset() + sec->getLoadedSize())
 	{
 		std::uint64_t result1, result2;
@@ -272,13 +307,12 @@ void PeHeuristics::getGoHeuristics()
 		return;
 	}
 
-	const auto goString = "\xFF Go build ID: ";
-	if (section->getBytes(0, 15) == goString)
+	if (section->getBytes(0, 15) == goBuildIdString)
 	{
 		addCompiler(source, DetectionStrength::MEDIUM, "gc");
 		addLanguage("Go");
 	}
-	else if (search.hasStringInSection(goString, section))
+	else if (search.hasStringInSection(goBuildIdString, section))
 	{
 		// Go build ID not on start of section
 		addCompiler(source, DetectionStrength::LOW, "gc");
@@ -295,7 +329,8 @@ void PeHeuristics::getAutoItHeuristics()
 	auto strength = DetectionStrength::MEDIUM;
 
 	std::string end;
-	if (fileParser.getStringFromEnd(end, 8) && findAutoIt(end))
+	if (fileParser.getStringFromEnd(end, 8)
+			&& isAutoIt(end, end.find(autoItPrefix)))
 	{
 		addCompiler(source, strength, "Aut2Exe");
 		addPriorityLanguage("AutoIt", "", true);
@@ -304,7 +339,9 @@ void PeHeuristics::getAutoItHeuristics()
 	const auto &content = search.getPlainString();
 	const auto *rsrc = fileParser.getSection(".rsrc");
 	if (rsrc && rsrc->getOffset() < content.length()
-			&& findAutoIt(content.substr(rsrc->getOffset())))
+			&& isAutoIt(
+					content,
+					search.findString(autoItPrefix, rsrc->getOffset())))
 	{
 		addCompiler(source, strength, "Aut2Exe");
 		addPriorityLanguage("AutoIt", "", true);
@@ -590,9 +627,10 @@ void PeHeuristics::getStarForceHeuristics()
  */
 void PeHeuristics::getSafeDiscHeuristics()
 {
-	const auto &content = search.getPlainString();
 	const std::string safeDiscString = "BoG_ *90.0&!!  Yy>";
-	auto pos = content.find(safeDiscString, peParser.getSizeOfHeaders() - 0x2C);
+	auto pos = search.findString(
+			safeDiscString,
+			peParser.getSizeOfHeaders() - 0x2C);
 
 	if (pos == peParser.getSizeOfHeaders() - 0x2C)
 	{
@@ -907,7 +945,7 @@ void PeHeuristics::getUpxHeuristics()
 	// format: UPX 1.0x
 	const std::string upxVer = "UPX 1.0";
 	const auto &content = search.getPlainString();
-	auto pos = content.find(upxVer);
+	auto pos = search.findString(upxVer, 0);
 	if (pos < 0x500 && pos < content.length() - upxVer.length())
 	{
 		// we must decide between UPX and UPX$HiT
@@ -936,7 +974,7 @@ void PeHeuristics::getUpxHeuristics()
 	// UPX 1.08 and later
 	// format: x.xx'\0'UPX!
 	const std::size_t minPos = 5, verLen = 4;
-	pos = content.find("UPX!");
+	pos = search.findString("UPX!", 0);
 	if (pos >= minPos && pos < 0x500 && !sections.empty() && pos < sections[0]->getOffset())
 	{
 		std::string version;
@@ -989,7 +1027,7 @@ void PeHeuristics::getPeCompactHeuristics()
 	const auto patLen = pattern.length();
 
 	const auto &content = search.getPlainString();
-	const auto pos = content.find(pattern);
+	const auto pos = search.findString(pattern, 0);
 
 	if (pos < 0x500
 			&& pos + patLen + 2 <= content.length()
@@ -1049,7 +1087,7 @@ void PeHeuristics::getEnigmaHeuristics()
 		{
 			const std::string pattern = "Enigma protector v";
 			const auto &content = search.getPlainString();
-			const auto pos = content.find(pattern, sec->getOffset());
+			const auto pos = search.findString(pattern, sec->getOffset());
 			if (pos < sec->getOffset() + sec->getSizeInFile()
 					&& pos <= content.length() - 4)
 			{
@@ -1390,9 +1428,10 @@ void PeHeuristics::getBeRoHeuristics()
 	auto source = DetectionMethod::STRING_SEARCH_H;
 	auto strength = DetectionStrength::MEDIUM;
 
-	const std::string &str = "Compiled by: BeRoTinyPascal - (C) Copyright 2006, Benjamin";
 	if (toolInfo.entryPointSection
-			&& search.hasStringInSection(str, toolInfo.epSection.getIndex()))
+			&& search.hasStringInSection(
+					beRoString,
+					toolInfo.epSection.getIndex()))
 	{
 		addCompiler(source, strength, "BeRo Tiny Pascal");
 		addLanguage("Pascal");
@@ -0,0 +1,103 @@
+/**
+ * @file src/cpdetect/input_analysis.cpp
+ * @brief Results of the analysis of one input file shared by all its users.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include "retdec/cpdetect/cpdetect.h"
+#include "retdec/cpdetect/input_analysis.h"
+#include "retdec/cpdetect/settings.h"
+#include "retdec/fileformat/format_factory.h"
+#include "retdec/fileformat/utils/format_detection.h"
+
+using namespace retdec::fileformat;
+
+namespace retdec {
+namespace cpdetect {
+
+/**
+ * Constructor
+ * @param inputPath Path to the input file
+ * @param format Parsed input file
+ */
+InputAnalysis::InputAnalysis(
+		const std::string &inputPath,
+		std::unique_ptr<FileFormat> format)
+		: path(inputPath), fileFormat(std::move(format))
+{
+
+}
+
+/**
+ * Parse the given input file
+ * @param inputPath Path to the input file
+ * @return Analysis of the input file or @c nullptr if the file does not
+ *         exist, is in an unknown format or cannot be parsed
+ */
+std::shared_ptr<InputAnalysis> InputAnalysis::create(
+		const std::string &inputPath)
+{
+	const auto format = detectFileFormat(inputPath);
+	if (format == Format::UNDETECTABLE || format == Format::UNKNOWN)
+	{
+		return nullptr;
+	}
+
+	auto fileParser = createFileFormat(inputPath);
+	if (!fileParser)
+	{
+		return nullptr;
+	}
+
+	return std::shared_ptr<InputAnalysis>(
+			new InputAnalysis(inputPath, std::move(fileParser)));
+}
+
+/**
+ * Get path to the analyzed file
+ */
+const std::string& InputAnalysis::getPath() const
+{
+	return path;
+}
+
+/**
+ * Get parsed input file
+ */
+const std::shared_ptr<FileFormat>& InputAnalysis::getFileFormat() const
+{
+	return fileFormat;
+}
+
+/**
+ * Detect tools used to create the input file
+ * @return Status of the detection
+ *
+ * The detection runs only on the first call, subsequent calls return the
+ * stored status.
+ */
+ReturnCode InputAnalysis::detectTools()
+{
+	if (!detectionStatus)
+	{
+		DetectParams params(SearchType::MOST_SIMILAR, true, false, EP_BYTES_SIZE);
+		CompilerDetector detector(*fileFormat, params, toolInfo);
+		detectionStatus = detector.getAllInformation();
+	}
+
+	return *detectionStatus;
+}
+
+/**
+ * Get tools detected in the input file
+ *
+ * Runs the detection if it was not run yet.
+ */
+const ToolInformation& InputAnalysis::getToolInformation()
+{
+	detectTools();
+	return toolInfo;
+}
+
+} // namespace cpdetect
+} // namespace retdec
@@ -0,0 +1,211 @@
+/**
+ * @file src/cpdetect/literal_index.cpp
+ * @brief Index of occurrences of literals in file.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <queue>
+
+#include "retdec/cpdetect/literal_index.h"
+
+namespace retdec {
+namespace cpdetect {
+
+namespace
+{
+
+/**
+ * Aho-Corasick automaton with transitions for all bytes in every state
+ */
+class Automaton
+{
+	private:
+		/// transitions of states, state 0 is the initial state
+		std::vector<std::array<std::uint32_t, 256>> next;
+		/// indexes of literals which end in states
+		std::vector<std::vector<std::size_t>> out;
+	public:
+		Automaton(const std::vector<const std::string*> &literals)
+		{
+			addState();
+
+			// Trie of all literals, zero transition means no transition yet.
+			for (std::size_t i = 0, e = literals.size(); i < e; ++i)
+			{
+				std::uint32_t state = 0;
+				for (const auto c : *literals[i])
+				{
+					const auto byte = static_cast<unsigned char>(c);
+					if (!next[state][byte])
+					{
+						// Adding of state invalidates references to transitions.
+						const auto n = addState();
+						next[state][byte] = n;
+					}
+					state = next[state][byte];
+				}
+				out[state].push_back(i);
+			}
+
+			// Breadth-first completion of transitions by failure links.
+			std::vector<std::uint32_t> fail(next.size(), 0);
+			std::queue<std::uint32_t> queue;
+			for (auto n : next[0])
+			{
+				if (n)
+				{
+					queue.push(n);
+				}
+			}
+			while (!queue.empty())
+			{
+				const auto state = queue.front();
+				queue.pop();
+				const auto &failOut = out[fail[state]];
+				out[state].insert(out[state].end(), failOut.begin(), failOut.end());
+
+				for (std::size_t c = 0; c < 256; ++c)
+				{
+					auto &n = next[state][c];
+					if (n)
+					{
+						fail[n] = next[fail[state]][c];
+						queue.push(n);
+					}
+					else
+					{
+						n = next[fail[state]][c];
+					}
+				}
+			}
+		}
+
+		std::uint32_t addState()
+		{
+			next.emplace_back();
+			next.back().fill(0);
+			out.emplace_back();
+			return next.size() - 1;
+		}
+
+		std::uint32_t step(std::uint32_t state, unsigned char c) const
+		{
+			return next[state][c];
+		}
+
+		const std::vector<std::size_t>& getOutput(std::uint32_t state) const
+		{
+			return out[state];
+		}
+};
+
+const std::vector<std::size_t> noOffsets;
+
+} // anonymous namespace
+
+/**
+ * Register literal to be indexed by the next call of @c build()
+ * @param literal Literal to register (empty literals are ignored)
+ */
+void LiteralIndex::addLiteral(const std::string &literal)
+{
+	if (!literal.empty())
+	{
+		offsets[literal];
+		built = false;
+	}
+}
+
+/**
+ * Find all occurrences of all registered literals in @a text
+ * @param text Text to index
+ */
+void LiteralIndex::build(const std::string &text)
+{
+	std::vector<const std::string*> literals;
+	std::vector<std::vector<std::size_t>*> results;
+	for (auto &item : offsets)
+	{
+		item.second.clear();
+		literals.push_back(&item.first);
+		results.push_back(&item.second);
+	}
+
+	if (!literals.empty())
+	{
+		const Automaton automaton(literals);
+		std::uint32_t state = 0;
+		for (std::size_t i = 0, e = text.size(); i < e; ++i)
+		{
+			state = automaton.step(state, text[i]);
+			for (const auto l : automaton.getOutput(state))
+			{
+				results[l]->push_back(i + 1 - literals[l]->length());
+			}
+		}
+	}
+
+	built = true;
+}
+
+/**
+ * Check if all registered literals are indexed
+ * @return @c true if index is up to date, @c false otherwise
+ */
+bool LiteralIndex::isBuilt() const
+{
+	return built;
+}
+
+/**
+ * Check if @a literal is registered
+ * @param literal Coveted literal
+ * @return @c true if @a literal is registered, @c false otherwise
+ */
+bool LiteralIndex::isRegistered(const std::string &literal) const
+{
+	return offsets.find(literal) != offsets.end();
+}
+
+/**
+ * Get offsets of all occurrences of @a literal
+ * @param literal Coveted literal
+ * @return Ascending offsets of occurrences, empty vector if @a literal is not
+ *    indexed
+ */
+const std::vector<std::size_t>& LiteralIndex::getOffsets(
+		const std::string &literal) const
+{
+	const auto it = offsets.find(literal);
+	return built && it != offsets.end() ? it->second : noOffsets;
+}
+
+/**
+ * Find first occurrence of @a literal which is completely in selected area
+ * @param literal Coveted literal
+ * @param startOffset Start offset of area
+ * @param endOffset Offset after the end of area
+ * @return Offset of the first occurrence or @c std::string::npos if there is
+ *    no such occurrence
+ */
+std::size_t LiteralIndex::findFirst(
+		const std::string &literal,
+		std::size_t startOffset,
+		std::size_t endOffset) const
+{
+	const auto &all = getOffsets(literal);
+	const auto it = std::lower_bound(all.begin(), all.end(), startOffset);
+	if (it == all.end() || endOffset < literal.length()
+			|| *it > endOffset - literal.length())
+	{
+		return std::string::npos;
+	}
+
+	return *it;
+}
+
+} // namespace cpdetect
+} // namespace retdec
@@ -5,6 +5,7 @@
  */
 
 #include <algorithm>
+#include <cstring>
 #include <map>
 
 #include "retdec/utils/container.h"
@@ -37,6 +38,243 @@ const std::map<Architecture, std::vector<Search::RelativeJump>> jumpMap =
 	},
 };
 
+const char hexDigits[] = "0123456789ABCDEF";
+
+/**
+ * Signature pattern compiled into value/mask form, so that it can be matched
+ * directly against bytes of file.
+ *
+ * Patterns are matched on nibble offsets, so they may also start in the middle
+ * of a byte. Therefore, there are two compiled forms of each pattern -- one
+ * for patterns starting on even and one for patterns starting on odd nibbles.
+ * Candidate offsets are found by searching for the longest fully specified
+ * part of the pattern (literal) and then confirmed by masked comparison.
+ */
+class BytePattern
+{
+	private:
+		struct Phase
+		{
+			std::vector<std::uint8_t> value;
+			std::vector<std::uint8_t> mask;
+			/// longest sequence of fully specified bytes
+			std::string literal;
+			/// offset of literal in value
+			std::size_t literalOffset = 0;
+		};
+
+		/// compiled forms for even and odd nibble offsets
+		Phase phases[2];
+		/// length of the original pattern in nibbles
+		std::size_t nibbleLength;
+		/// @c false if pattern contains a nibble which cannot match anything
+		bool matchable = true;
+
+		bool matchesAt(
+				const Phase &phase,
+				const std::string &bytes,
+				std::size_t byteOffset) const;
+		std::size_t find(
+				std::size_t phaseIndex,
+				const std::string &bytes,
+				std::size_t firstNibble,
+				std::size_t lastNibble) const;
+	public:
+		BytePattern(const std::string &pattern);
+
+		std::size_t getNibbleLength() const;
+		std::size_t find(
+				const std::string &bytes,
+				std::size_t firstNibble,
+				std::size_t lastNibble) const;
+};
+
+/**
+ * Constructor
+ * @param pattern Signature pattern without slashes
+ *
+ * Hexadecimal digits in pattern must be uppercase, '-', '?' and ';' match
+ * any nibble. Any other character does not match anything.
+ */
+BytePattern::BytePattern(const std::string &pattern)
+		: nibbleLength(pattern.length())
+{
+	for (std::size_t phaseIndex = 0; phaseIndex < 2; ++phaseIndex)
+	{
+		auto &phase = phases[phaseIndex];
+		const auto size = (phaseIndex + nibbleLength + 1) / 2;
+		phase.value.assign(size, 0);
+		phase.mask.assign(size, 0);
+
+		for (std::size_t i = 0; i < nibbleLength; ++i)
+		{
+			const auto c = pattern[i];
+			if (c == '-' || c == '?' || c == ';')
+			{
+				continue;
+			}
+
+			const auto *digit = std::strchr(hexDigits, c);
+			if (c == '\0' || !digit)
+			{
+				matchable = false;
+				return;
+			}
+
+			const auto nibbleIndex = i + phaseIndex;
+			const auto shift = nibbleIndex % 2 ? 0 : 4;
+			phase.value[nibbleIndex / 2] |= static_cast<std::uint8_t>(
+					(digit - hexDigits) << shift);
+			phase.mask[nibbleIndex / 2] |= static_cast<std::uint8_t>(
+					0x0F << shift);
+		}
+
+		std::size_t bestLength = 0;
+		for (std::size_t i = 0, start = 0; i <= size; ++i)
+		{
+			if (i < size && phase.mask[i] == 0xFF)
+			{
+				continue;
+			}
+			if (i - start > bestLength)
+			{
+				bestLength = i - start;
+				phase.literalOffset = start;
+			}
+			start = i + 1;
+		}
+		phase.literal.assign(
+				phase.value.begin() + phase.literalOffset,
+				phase.value.begin() + phase.literalOffset + bestLength);
+	}
+}
+
+/**
+ * Get length of pattern in nibbles
+ */
+std::size_t BytePattern::getNibbleLength() const
+{
+	return nibbleLength;
+}
+
+/**
+ * Masked comparison of compiled pattern with bytes on the given offset.
+ * Caller must ensure that all the compared bytes are in @a bytes.
+ */
+bool BytePattern::matchesAt(
+		const Phase &phase,
+		const std::string &bytes,
+		std::size_t byteOffset) const
+{
+	const auto *data = reinterpret_cast<const std::uint8_t*>(bytes.data())
+			+ byteOffset;
+	const auto *value = phase.value.data();
+	const auto *mask = phase.mask.data();
+	const auto size = phase.value.size();
+
+	// Compare eight bytes at a time, compilers vectorize this loop well.
+	std::size_t i = 0;
+	for (; i + sizeof(std::uint64_t) <= size; i += sizeof(std::uint64_t))
+	{
+		std::uint64_t d, v, m;
+		std::memcpy(&d, data + i, sizeof(d));
+		std::memcpy(&v, value + i, sizeof(v));
+		std::memcpy(&m, mask + i, sizeof(m));
+		if ((d & m) != v)
+		{
+			return false;
+		}
+	}
+	for (; i < size; ++i)
+	{
+		if ((data[i] & mask[i]) != value[i])
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Find the first match of the pattern starting on nibble offset with the
+ * given parity
+ * @param phaseIndex Parity of nibble offsets
+ * @param bytes Searched bytes
+ * @param firstNibble First nibble offset where match may start
+ * @param lastNibble Last nibble offset where match may start
+ * @return Nibble offset of match or @c std::string::npos if there is no match
+ */
+std::size_t BytePattern::find(
+		std::size_t phaseIndex,
+		const std::string &bytes,
+		std::size_t firstNibble,
+		std::size_t lastNibble) const
+{
+	if (lastNibble < phaseIndex)
+	{
+		return std::string::npos;
+	}
+
+	const auto &phase = phases[phaseIndex];
+	const auto firstByte = firstNibble > phaseIndex
+			? (firstNibble - phaseIndex + 1) / 2
+			: 0;
+	const auto lastByte = (lastNibble - phaseIndex) / 2;
+	if (firstByte > lastByte)
+	{
+		return std::string::npos;
+	}
+
+	if (phase.literal.empty())
+	{
+		for (auto i = firstByte; i <= lastByte; ++i)
+		{
+			if (matchesAt(phase, bytes, i))
+			{
+				return 2 * i + phaseIndex;
+			}
+		}
+		return std::string::npos;
+	}
+
+	for (auto pos = bytes.find(phase.literal, firstByte + phase.literalOffset);
+			pos != std::string::npos && pos - phase.literalOffset <= lastByte;
+			pos = bytes.find(phase.literal, pos + 1))
+	{
+		const auto i = pos - phase.literalOffset;
+		if (matchesAt(phase, bytes, i))
+		{
+			return 2 * i + phaseIndex;
+		}
+	}
+
+	return std::string::npos;
+}
+
+/**
+ * Find the first match of the pattern
+ * @param bytes Searched bytes
+ * @param firstNibble First nibble offset where match may start
+ * @param lastNibble Last nibble offset where match may start, pattern must
+ *    fit into @a bytes when it starts on this offset
+ * @return Nibble offset of match or @c std::string::npos if there is no match
+ */
+std::size_t BytePattern::find(
+		const std::string &bytes,
+		std::size_t firstNibble,
+		std::size_t lastNibble) const
+{
+	if (!matchable || firstNibble > lastNibble)
+	{
+		return std::string::npos;
+	}
+
+	return std::min(
+			find(0, bytes, firstNibble, lastNibble),
+			find(1, bytes, firstNibble, lastNibble));
+}
+
 } // anonymous namespace
 
 /**
@@ -47,12 +285,21 @@ Search::Search(retdec::fileformat::FileFormat &fileParser)
 		: parser(fileParser)
 		, averageSlashLen(0)
 {
-	const auto &bytes = parser.getLoadedBytes();
-	bytesToHexString(bytes, nibbles);
-	bytesToString(bytes, plain);
+	const auto bytes = parser.getLoadedBytes();
+	bytesToString(bytes.data(), bytes.size(), plain);
 	fileLoaded = !bytes.empty();
-	fileSupported = parser.hexToLittle(nibbles)
-			&& parser.getNumberOfNibblesInByte();
+	byteLayout = parser.getNumberOfNibblesInByte() == 2
+			&& parser.isLittleEndian();
+	if (byteLayout)
+	{
+		fileSupported = true;
+	}
+	else
+	{
+		bytesToHexString(bytes.data(), bytes.size(), nibbles);
+		fileSupported = parser.hexToLittle(nibbles)
+				&& parser.getNumberOfNibblesInByte();
+	}
 	jumps = mapGetValueOrDefault(
 			jumpMap,
 			parser.getTargetArchitecture(),
@@ -145,6 +392,57 @@ std::size_t Search::bytesFromNibbles(std::size_t nNibbles) const
 	return parser.bytesFromNibbles(nNibbles);
 }
 
+/**
+ * Get number of nibbles in file
+ */
+std::size_t Search::getNumberOfNibbles() const
+{
+	return byteLayout ? 2 * plain.length() : nibbles.length();
+}
+
+/**
+ * Get nibble on the given index in hexadecimal string representation of file
+ * @param nibbleIndex Index of nibble (must be lower than number of nibbles)
+ * @return Hexadecimal digit
+ */
+char Search::getNibble(std::size_t nibbleIndex) const
+{
+	if (!byteLayout)
+	{
+		return nibbles[nibbleIndex];
+	}
+
+	const auto byte = static_cast<std::uint8_t>(plain[nibbleIndex / 2]);
+	return hexDigits[nibbleIndex % 2 ? byte & 0x0F : byte >> 4];
+}
+
+/**
+ * Check if file has nibbles @a str on specified nibble offset
+ * @param str Hexadecimal string
+ * @param nibbleOffset Offset in nibbles
+ * @return @c true if file has @a str on @a nibbleOffset, @c false otherwise
+ */
+bool Search::hasNibblesOnPosition(
+		const std::string &str,
+		std::size_t nibbleOffset) const
+{
+	const auto length = getNumberOfNibbles();
+	if (nibbleOffset >= length || length - nibbleOffset < str.length())
+	{
+		return false;
+	}
+
+	for (std::size_t i = 0, e = str.length(); i < e; ++i)
+	{
+		if (getNibble(nibbleOffset + i) != str[i])
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
 /**
  * Check if input file was successfully loaded
  * @return @c true if file was successfully loaded, @c false otherwise
@@ -169,6 +467,12 @@ bool Search::isFileSupported() const
  */
 const std::string& Search::getNibbles() const
 {
+	if (byteLayout && nibbles.empty())
+	{
+		const auto bytes = parser.getLoadedBytes();
+		bytesToHexString(bytes.data(), bytes.size(), nibbles);
+	}
+
 	return nibbles;
 }
 
@@ -201,9 +505,9 @@ const Search::RelativeJump* Search::getRelativeJump(
 	for (const auto &jump : jumps)
 	{
 		const auto nibblesAfter = nibblesFromBytes(jump.getBytesAfter());
-		if (!hasSubstringOnPosition(nibbles, jump.getSlash(), nibbleOffset)
+		if (!hasNibblesOnPosition(jump.getSlash(), nibbleOffset)
 				|| (nibbleOffset + jump.getSlashNibbleSize() + nibblesAfter - 1
-						>= nibbles.length()))
+						>= getNumberOfNibbles()))
 		{
 			continue;
 		}
@@ -287,6 +591,25 @@ unsigned long long Search::findUnslashedSignature(
 		return 0;
 	}
 
+	if (byteLayout)
+	{
+		const auto startIndex = nibblesFromBytes(startOffset);
+		const auto stopIndex = std::min(
+				nibblesFromBytes(stopOffset) + 1,
+				getNumberOfNibbles());
+		const BytePattern pattern(signPattern);
+		if (signPattern.empty()
+				|| startIndex + signPattern.length() > stopIndex)
+		{
+			return 0;
+		}
+
+		const auto lastIndex = stopIndex - signPattern.length();
+		return pattern.find(plain, startIndex, lastIndex) != std::string::npos
+				? countImpNibbles(signPattern)
+				: 0;
+	}
+
 	const auto startIterator = nibbles.begin() + nibblesFromBytes(startOffset);
 	const auto stopIndex = nibblesFromBytes(stopOffset) + 1;
 	const auto stopIterator = stopIndex < nibbles.size()
@@ -336,6 +659,38 @@ unsigned long long Search::findSlashedSignature(
 	}
 	const auto iters = startOffset == stopOffset ? 1 : areaSize - signSize + 1;
 
+	// Signature can match only where its part before the first slash does.
+	const auto prefixSize = signPattern.find_first_of("/;");
+	if (byteLayout && prefixSize != 0)
+	{
+		const BytePattern prefix(signPattern.substr(0, prefixSize));
+		const auto startIndex = nibblesFromBytes(startOffset);
+		const auto length = getNumberOfNibbles();
+		if (length < prefix.getNibbleLength())
+		{
+			return 0;
+		}
+
+		const auto lastIndex = std::min(
+				startIndex + iters - 1,
+				length - prefix.getNibbleLength());
+		for (auto i = prefix.find(plain, startIndex, lastIndex);
+				i != std::string::npos;
+				i = i < lastIndex
+						? prefix.find(plain, i + 1, lastIndex)
+						: std::string::npos)
+		{
+			const auto result = exactComparison(
+					signPattern, startOffset, i - startIndex);
+			if (result)
+			{
+				return result;
+			}
+		}
+
+		return 0;
+	}
+
 	for (std::size_t i = 0; i < iters; ++i)
 	{
 		const auto result = exactComparison(signPattern, startOffset, i);
@@ -363,7 +718,7 @@ unsigned long long Search::exactComparison(
 {
 	for (std::size_t sigIndex = 0,
 			fileIndex = nibblesFromBytes(fileOffset) + shift,
-			fileLen = nibbles.length()
+			fileLen = getNumberOfNibbles()
 			;
 			fileIndex < fileLen
 			;
@@ -398,7 +753,7 @@ unsigned long long Search::exactComparison(
 					+ moveSize
 					- 1;
 		}
-		else if (signPattern[sigIndex] != nibbles[fileIndex]
+		else if (signPattern[sigIndex] != getNibble(fileIndex)
 				&& signPattern[sigIndex] != '-'
 				&& signPattern[sigIndex] != '?')
 		{
@@ -430,7 +785,7 @@ bool Search::countSimilarity(
 
 	for (std::size_t sigIndex = 0,
 			fileIndex = nibblesFromBytes(fileOffset) + shift,
-			fileLen = nibbles.length()
+			fileLen = getNumberOfNibbles()
 			;
 			fileIndex < fileLen
 			;
@@ -475,7 +830,7 @@ bool Search::countSimilarity(
 			}
 			continue;
 		}
-		else if (signPattern[sigIndex] == nibbles[fileIndex])
+		else if (signPattern[sigIndex] == getNibble(fileIndex))
 		{
 			++result.same;
 		}
@@ -544,6 +899,132 @@ bool Search::areaSimilarity(
 	return result;
 }
 
+/**
+ * Cheap check whether @c areaSimilarity() can find similarity at least
+ * @a minRatio in selected area of file
+ * @param signPattern Signature pattern
+ * @param startOffset Start offset in file (in bytes)
+ * @param stopOffset Stop offset in file (in bytes)
+ * @param minRatio Minimal interesting similarity
+ * @return @c false if similarity of pattern is surely lower than
+ *    @a minRatio (or cannot be counted at all), @c true otherwise
+ *
+ * Comparison at each position is abandoned as soon as it has too many
+ * different nibbles, so dissimilar patterns are rejected after a few nibbles.
+ * Patterns with slashes are not checked and they are always accepted.
+ */
+bool Search::mayBeSimilar(
+		const std::string &signPattern,
+		std::size_t startOffset,
+		std::size_t stopOffset,
+		double minRatio) const
+{
+	if (startOffset > stopOffset)
+	{
+		return false;
+	}
+	if (minRatio <= 0.0
+			|| signPattern.find_first_of("/;") != std::string::npos)
+	{
+		return true;
+	}
+
+	const auto areaSize = nibblesFromBytes(stopOffset - startOffset + 1);
+	const auto signSize = signPattern.length();
+	const auto total = countImpNibbles(signPattern);
+	if (areaSize < signSize || !total)
+	{
+		return false;
+	}
+	const auto iters = startOffset == stopOffset
+			? 1
+			: areaSize - signSize + 1;
+	const auto startIndex = nibblesFromBytes(startOffset);
+	const auto fileLen = getNumberOfNibbles();
+
+	for (std::size_t i = 0; i < iters; ++i)
+	{
+		// Pattern which does not fit into the file has no similarity.
+		if (startIndex + i + signSize > fileLen)
+		{
+			return false;
+		}
+
+		unsigned long long different = 0;
+		auto similar = true;
+		for (std::size_t sigIndex = 0; sigIndex < signSize; ++sigIndex)
+		{
+			const auto c = signPattern[sigIndex];
+			if (c != '-' && c != '?'
+					&& c != getNibble(startIndex + i + sigIndex)
+					&& static_cast<double>(total - ++different) / total
+							< minRatio)
+			{
+				similar = false;
+				break;
+			}
+		}
+
+		if (similar)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/**
+ * Register strings which are going to be searched for
+ * @param strs Strings to register
+ *
+ * Occurrences of all registered strings are found in one pass over the file
+ * when any of them is searched for the first time. Searches of registered
+ * strings then only look into this index.
+ */
+void Search::registerStrings(const std::vector<std::string> &strs)
+{
+	for (const auto &str : strs)
+	{
+		literals.addLiteral(str);
+	}
+}
+
+/**
+ * Check if occurrences of @a str are indexed (index is built if needed)
+ * @param str Coveted string
+ * @return @c true if @a str is registered, @c false otherwise
+ */
+bool Search::isIndexedString(const std::string &str) const
+{
+	if (!literals.isRegistered(str))
+	{
+		return false;
+	}
+	if (!literals.isBuilt())
+	{
+		literals.build(plain);
+	}
+
+	return true;
+}
+
+/**
+ * Find first occurrence of string in file
+ * @param str Coveted string
+ * @param startOffset Start offset in file (in bytes)
+ * @return Offset of the first occurrence of @a str at or after @a startOffset
+ *    or @c std::string::npos if there is no such occurrence
+ */
+std::size_t Search::findString(
+		const std::string &str,
+		std::size_t startOffset) const
+{
+	return isIndexedString(str)
+			? literals.findFirst(str, startOffset, plain.size())
+			: plain.find(str, startOffset);
+}
+
 /**
  * Check if file contains specified substring
  * @param str Coveted substring
@@ -551,7 +1032,9 @@ bool Search::areaSimilarity(
  */
 bool Search::hasString(const std::string &str) const
 {
-	return contains(plain, str);
+	return isIndexedString(str)
+			? !literals.getOffsets(str).empty()
+			: contains(plain, str);
 }
 
 /**
@@ -579,6 +1062,18 @@ bool Search::hasString(
 		std::size_t startOffset,
 		std::size_t stopOffset) const
 {
+	// Stop offset of empty area at the beginning of file may overflow.
+	if (startOffset <= stopOffset && startOffset <= plain.size()
+			&& stopOffset != std::string::npos
+			&& isIndexedString(str))
+	{
+		const auto endOffset = stopOffset < plain.size()
+				? stopOffset + 1
+				: plain.size();
+		return literals.findFirst(str, startOffset, endOffset)
+				!= std::string::npos;
+	}
+
 	return hasSubstringInArea(plain, str, startOffset, stopOffset);
 }
 
@@ -641,7 +1136,7 @@ bool Search::createSignature(
 
 	for (std::size_t i = 0,
 			fileIndex = nibblesFromBytes(fileOffset),
-			fileLen = nibbles.length(),
+			fileLen = getNumberOfNibbles(),
 			nibbleSize = nibblesFromBytes(size)
 			;
 			fileIndex < fileLen && i < nibbleSize
@@ -664,7 +1159,7 @@ bool Search::createSignature(
 		}
 		else
 		{
-			pattern += nibbles[fileIndex];
+			pattern += getNibble(fileIndex);
 		}
 	}
 
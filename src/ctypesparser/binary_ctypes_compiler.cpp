@@ -0,0 +1,561 @@
+/**
+* @file src/ctypesparser/binary_ctypes_compiler.cpp
+* @brief Compiler of C-types from JSON to binary databases.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <rapidjson/document.h>
+#include <rapidjson/error/en.h>
+
+#include "retdec/ctypes/array_type.h"
+#include "retdec/ctypes/enum_type.h"
+#include "retdec/ctypesparser/binary_ctypes_compiler.h"
+#include "retdec/ctypesparser/exceptions.h"
+#include "ctypesparser/binary_ctypes_format.h"
+#include "ctypesparser/json_getters.h"
+
+namespace retdec {
+namespace ctypesparser {
+
+namespace {
+
+using namespace binary;
+
+const std::string JSON_functions   = "functions";
+const std::string JSON_types       = "types";
+
+const std::string JSON_annotations      = "annotations";
+const std::string JSON_array            = "array";
+const std::string JSON_array_dimensions = "dimensions";
+const std::string JSON_array_element    = "element_type";
+const std::string JSON_bit_width        = "bit_width";
+const std::string JSON_call_conv        = "call_conv";
+const std::string JSON_decl             = "decl";
+const std::string JSON_enum             = "enum";
+const std::string JSON_enum_items       = "items";
+const std::string JSON_enum_value       = "value";
+const std::string JSON_floating_point   = "floating_point_type";
+const std::string JSON_function_type    = "function";
+const std::string JSON_header           = "header";
+const std::string JSON_integral_type    = "integral_type";
+const std::string JSON_members          = "members";
+const std::string JSON_modified_type    = "modified_type";
+const std::string JSON_name             = "name";
+const std::string JSON_params           = "params";
+const std::string JSON_pointed_type     = "pointed_type";
+const std::string JSON_pointer          = "pointer";
+const std::string JSON_qualifier        = "qualifier";
+const std::string JSON_ret_type         = "ret_type";
+const std::string JSON_structure        = "structure";
+const std::string JSON_type             = "type";
+const std::string JSON_typedef          = "typedef";
+const std::string JSON_typedefed_type   = "typedefed_type";
+const std::string JSON_union            = "union";
+const std::string JSON_unknown_type     = "unknown";
+const std::string JSON_vararg           = "vararg";
+const std::string JSON_void             = "void";
+
+/// Number of seeds tried for one bucket before the slot table is enlarged.
+const std::uint32_t MAX_SEED_TRIES = 1 << 16;
+
+void appendWide(std::vector<std::uint32_t> &words, std::uint64_t value)
+{
+	words.push_back(static_cast<std::uint32_t>(value));
+	words.push_back(static_cast<std::uint32_t>(value >> 32));
+}
+
+template <typename T>
+void writeSection(std::ostream &out, const std::vector<T> &data)
+{
+	out.write(
+		reinterpret_cast<const char *>(data.data()),
+		data.size() * sizeof(T)
+	);
+}
+
+/**
+* @brief Compiles one JSON document into the binary layout.
+*
+* Only types reachable from functions are compiled, the same types would be
+* parsed by @c JSONCTypesParser.
+*/
+class Compiler
+{
+	public:
+		explicit Compiler(const rapidjson::Value &root);
+
+		void write(std::ostream &out) const;
+
+	private:
+		std::uint32_t addString(const std::string &str);
+		std::uint32_t addOptionalString(
+			const rapidjson::Value &val,
+			const std::string &name);
+		std::uint32_t appendList(const std::vector<std::uint32_t> &words);
+		void compileFunction(
+			const std::string &name,
+			const rapidjson::Value &jsonFunction);
+		std::uint32_t compileType(const std::string &typeKey);
+		void compileTypeBody(
+			const rapidjson::Value &jsonType,
+			TypeRecord &record);
+		void compileBitWidth(
+			const rapidjson::Value &jsonType,
+			TypeRecord &record) const;
+		bool tryBuildIndex(std::uint32_t slotsCount);
+		void buildIndex();
+
+	private:
+		using TypesMap = std::unordered_map<std::string, const rapidjson::Value *>;
+
+		TypesMap typesMap;
+		std::unordered_map<std::string, std::uint32_t> typeIndices;
+		std::unordered_map<std::string, std::uint32_t> stringOffsets;
+		std::string strings;
+		std::vector<TypeRecord> types;
+		std::vector<FunctionRecord> functions;
+		std::vector<std::string> functionNames;
+		std::vector<std::uint32_t> lists;
+		std::vector<std::uint32_t> seeds;
+		std::vector<std::uint32_t> slots;
+};
+
+Compiler::Compiler(const rapidjson::Value &root)
+{
+	const auto &jsonFunctions = safeGetObject(root, JSON_functions);
+	const auto &jsonTypes = safeGetObject(root, JSON_types);
+	for (auto i = jsonTypes.MemberBegin(), e = jsonTypes.MemberEnd(); i != e; ++i)
+	{
+		typesMap.emplace(i->name.GetString(), &i->value);
+	}
+
+	std::unordered_set<std::string> seen;
+	for (auto i = jsonFunctions.MemberBegin(), e = jsonFunctions.MemberEnd(); i != e; ++i)
+	{
+		std::string name = i->name.GetString();
+		// The first definition wins, as in the parser.
+		if (seen.insert(name).second)
+		{
+			compileFunction(name, i->value);
+		}
+	}
+
+	buildIndex();
+}
+
+/**
+* @brief Returns offset of interned @a str in the string section.
+*/
+std::uint32_t Compiler::addString(const std::string &str)
+{
+	auto it = stringOffsets.find(str);
+	if (it != stringOffsets.end())
+	{
+		return it->second;
+	}
+
+	auto offset = static_cast<std::uint32_t>(strings.size());
+	strings.append(str.c_str());
+	strings.push_back('\0');
+	stringOffsets.emplace(str, offset);
+	return offset;
+}
+
+/**
+* @brief Returns offset of string member @a name of @a val, or @c NO_INDEX if
+*        there is no such string.
+*/
+std::uint32_t Compiler::addOptionalString(
+	const rapidjson::Value &val,
+	const std::string &name)
+{
+	auto res = val.FindMember(name.c_str());
+	return res != val.MemberEnd() && res->value.IsString()
+		? addString(res->value.GetString())
+		: NO_INDEX;
+}
+
+/**
+* @brief Appends @a words to the list section and returns index of the first one.
+*/
+std::uint32_t Compiler::appendList(const std::vector<std::uint32_t> &words)
+{
+	auto begin = static_cast<std::uint32_t>(lists.size());
+	lists.insert(lists.end(), words.begin(), words.end());
+	return begin;
+}
+
+void Compiler::compileFunction(
+	const std::string &name,
+	const rapidjson::Value &jsonFunction)
+{
+	static const rapidjson::Value emptyAnnotation("");
+	static const rapidjson::Value defaultVarArg(rapidjson::Type::kFalseType);
+
+	FunctionRecord record = {};
+	record.name = addString(name);
+	record.returnType = compileType(safeGetString(jsonFunction, JSON_ret_type));
+
+	std::vector<std::uint32_t> params;
+	const auto &jsonParams = safeGetArray(jsonFunction, JSON_params);
+	for (auto i = jsonParams.Begin(), e = jsonParams.End(); i != e; ++i)
+	{
+		auto annotations = safeGetString(*i, JSON_annotations, emptyAnnotation);
+		auto paramName = safeGetString(*i, JSON_name);
+		auto paramType = compileType(safeGetString(*i, JSON_type));
+		params.push_back(addString(paramName));
+		params.push_back(paramType);
+		params.push_back(addString(annotations));
+	}
+	record.paramsBegin = appendList(params);
+	record.paramsCount = static_cast<std::uint32_t>(params.size() / PARAMETER_WORDS);
+
+	if (safeGetBool(jsonFunction, JSON_vararg, defaultVarArg))
+	{
+		record.flags |= FUNCTION_IS_VAR_ARG;
+	}
+	record.callConv = addOptionalString(jsonFunction, JSON_call_conv);
+	record.declaration = addString(safeGetString(jsonFunction, JSON_decl));
+	record.header = addString(safeGetString(jsonFunction, JSON_header));
+
+	functions.push_back(record);
+	functionNames.push_back(name);
+}
+
+/**
+* @brief Returns index of type with @a typeKey, compiles it when needed.
+*
+* Index is assigned before the referenced types are compiled, so recursive
+* types refer to themselves.
+*/
+std::uint32_t Compiler::compileType(const std::string &typeKey)
+{
+	auto it = typeIndices.find(typeKey);
+	if (it != typeIndices.end())
+	{
+		return it->second;
+	}
+
+	auto jsonIt = typesMap.find(typeKey);
+	if (jsonIt == typesMap.end())
+	{
+		throw CTypesParseError("Type " + typeKey + " is not defined.");
+	}
+
+	auto index = static_cast<std::uint32_t>(types.size());
+	types.emplace_back();
+	typeIndices.emplace(typeKey, index);
+
+	TypeRecord record = {};
+	record.name = NO_INDEX;
+	record.ref = NO_INDEX;
+	record.callConv = NO_INDEX;
+	compileTypeBody(*jsonIt->second, record);
+	types[index] = record;
+	return index;
+}
+
+void Compiler::compileTypeBody(
+	const rapidjson::Value &jsonType,
+	TypeRecord &record)
+{
+	static const rapidjson::Value defaultVarArg(rapidjson::Type::kFalseType);
+	static const rapidjson::Value defaultEnumValue(retdec::ctypes::EnumType::DEFAULT_VALUE);
+
+	std::string typeOfType = safeGetString(jsonType, JSON_type);
+	std::vector<std::uint32_t> list;
+
+	if (typeOfType == JSON_typedef)
+	{
+		record.kind = TypeKind::Typedef;
+		record.name = addString(safeGetString(jsonType, JSON_name));
+		auto aliasedKey = safeGetString(jsonType, JSON_typedefed_type);
+		if (aliasedKey != JSON_unknown_type)
+		{
+			record.ref = compileType(aliasedKey);
+		}
+	}
+	else if (typeOfType == JSON_pointer)
+	{
+		record.kind = TypeKind::Pointer;
+		record.ref = compileType(safeGetString(jsonType, JSON_pointed_type));
+	}
+	else if (typeOfType == JSON_integral_type)
+	{
+		record.kind = TypeKind::Integral;
+		record.name = addString(safeGetString(jsonType, JSON_name));
+		compileBitWidth(jsonType, record);
+	}
+	else if (typeOfType == JSON_structure || typeOfType == JSON_union)
+	{
+		record.kind = typeOfType == JSON_structure ? TypeKind::Struct : TypeKind::Union;
+		record.name = addString(safeGetString(jsonType, JSON_name));
+		const auto &jsonMembers = safeGetArray(jsonType, JSON_members);
+		for (auto i = jsonMembers.Begin(), e = jsonMembers.End(); i != e; ++i)
+		{
+			auto memberType = compileType(safeGetString(*i, JSON_type));
+			list.push_back(addString(safeGetString(*i, JSON_name)));
+			list.push_back(memberType);
+		}
+		record.listCount = static_cast<std::uint32_t>(list.size() / MEMBER_WORDS);
+	}
+	else if (typeOfType == JSON_void)
+	{
+		record.kind = TypeKind::Void;
+	}
+	else if (typeOfType == JSON_function_type)
+	{
+		record.kind = TypeKind::Function;
+		record.ref = compileType(safeGetString(jsonType, JSON_ret_type));
+		const auto &jsonParams = safeGetArray(jsonType, JSON_params);
+		for (auto i = jsonParams.Begin(), e = jsonParams.End(); i != e; ++i)
+		{
+			list.push_back(compileType(safeGetString(*i, JSON_type)));
+		}
+		record.listCount = static_cast<std::uint32_t>(list.size() / TYPE_PARAMETER_WORDS);
+		if (safeGetBool(jsonType, JSON_vararg, defaultVarArg))
+		{
+			record.flags |= TYPE_IS_VAR_ARG;
+		}
+		record.callConv = addOptionalString(jsonType, JSON_call_conv);
+	}
+	else if (typeOfType == JSON_array)
+	{
+		record.kind = TypeKind::Array;
+		record.ref = compileType(safeGetString(jsonType, JSON_array_element));
+		const auto &jsonDimensions = safeGetArray(jsonType, JSON_array_dimensions);
+		for (auto i = jsonDimensions.Begin(), e = jsonDimensions.End(); i != e; ++i)
+		{
+			retdec::ctypes::ArrayType::DimensionType dimension = i->IsInt()
+				? i->GetInt()
+				: retdec::ctypes::ArrayType::UNKNOWN_DIMENSION;
+			appendWide(list, dimension);
+		}
+		record.listCount = static_cast<std::uint32_t>(list.size() / DIMENSION_WORDS);
+	}
+	else if (typeOfType == JSON_floating_point)
+	{
+		record.kind = TypeKind::FloatingPoint;
+		record.name = addString(safeGetString(jsonType, JSON_name));
+		compileBitWidth(jsonType, record);
+	}
+	else if (typeOfType == JSON_enum)
+	{
+		record.kind = TypeKind::Enum;
+		record.name = addString(safeGetString(jsonType, JSON_name));
+		const auto &jsonItems = safeGetArray(jsonType, JSON_enum_items);
+		for (auto i = jsonItems.Begin(), e = jsonItems.End(); i != e; ++i)
+		{
+			list.push_back(addString(safeGetString(*i, JSON_name)));
+			appendWide(list, safeGetInt64(*i, JSON_enum_value, defaultEnumValue));
+		}
+		record.listCount = static_cast<std::uint32_t>(list.size() / ENUM_ITEM_WORDS);
+	}
+	else if (typeOfType == JSON_qualifier)
+	{
+		record.kind = TypeKind::Qualifier;
+		record.ref = compileType(safeGetString(jsonType, JSON_modified_type));
+	}
+	else
+	{
+		record.kind = TypeKind::Unknown;
+	}
+
+	record.listBegin = appendList(list);
+}
+
+/**
+* @brief Stores explicit bit width of @a jsonType, if it has a valid one.
+*
+* Otherwise, the reader computes the bit width from the type name and the
+* bit widths of the target architecture.
+*/
+void Compiler::compileBitWidth(
+	const rapidjson::Value &jsonType,
+	TypeRecord &record) const
+{
+	auto res = jsonType.FindMember(JSON_bit_width.c_str());
+	if (res != jsonType.MemberEnd() && res->value.IsInt64())
+	{
+		record.flags |= TYPE_HAS_BIT_WIDTH;
+		record.bitWidth = static_cast<std::uint32_t>(res->value.GetInt64());
+	}
+}
+
+/**
+* @brief Tries to find seeds placing all functions into @a slotsCount slots.
+*
+* Buckets are placed from the largest one, while there is still a lot of free
+* slots.
+*/
+bool Compiler::tryBuildIndex(std::uint32_t slotsCount)
+{
+	std::vector<std::vector<std::uint32_t>> buckets(seeds.size());
+	for (std::uint32_t i = 0; i < functionNames.size(); ++i)
+	{
+		buckets[hashName(functionNames[i], 0) % buckets.size()].push_back(i);
+	}
+
+	std::vector<std::uint32_t> order(buckets.size());
+	for (std::uint32_t i = 0; i < order.size(); ++i)
+	{
+		order[i] = i;
+	}
+	std::stable_sort(order.begin(), order.end(),
+		[&buckets](std::uint32_t a, std::uint32_t b)
+		{
+			return buckets[a].size() > buckets[b].size();
+		}
+	);
+
+	slots.assign(slotsCount, NO_INDEX);
+	std::fill(seeds.begin(), seeds.end(), 0);
+	std::vector<std::uint32_t> positions;
+	for (auto b : order)
+	{
+		const auto &bucket = buckets[b];
+		if (bucket.empty())
+		{
+			break;
+		}
+
+		bool placed = false;
+		for (std::uint32_t seed = 1; seed < MAX_SEED_TRIES && !placed; ++seed)
+		{
+			positions.clear();
+			placed = true;
+			for (auto f : bucket)
+			{
+				auto pos = static_cast<std::uint32_t>(
+					hashName(functionNames[f], seed) % slotsCount);
+				if (slots[pos] != NO_INDEX
+						|| std::find(positions.begin(), positions.end(), pos) != positions.end())
+				{
+					placed = false;
+					break;
+				}
+				positions.push_back(pos);
+			}
+
+			if (placed)
+			{
+				seeds[b] = seed;
+				for (std::size_t i = 0; i < bucket.size(); ++i)
+				{
+					slots[positions[i]] = bucket[i];
+				}
+			}
+		}
+
+		if (!placed)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void Compiler::buildIndex()
+{
+	auto count = static_cast<std::uint32_t>(functions.size());
+	seeds.resize(count / 2 + 1);
+	auto slotsCount = count + count / 4 + 1;
+	while (!tryBuildIndex(slotsCount))
+	{
+		slotsCount += slotsCount / 4 + 1;
+	}
+}
+
+void Compiler::write(std::ostream &out) const
+{
+	std::string paddedStrings = strings;
+	paddedStrings.resize((strings.size() + 3) & ~std::size_t(3), '\0');
+
+	Header header = {};
+	std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+	header.byteOrderMark = BYTE_ORDER_MARK;
+	header.version = VERSION;
+
+	std::uint64_t offset = sizeof(Header);
+	auto place = [&offset](std::uint32_t &sectionOffset, std::size_t bytes)
+	{
+		sectionOffset = static_cast<std::uint32_t>(offset);
+		offset += bytes;
+	};
+	place(header.typesOffset, types.size() * sizeof(TypeRecord));
+	place(header.functionsOffset, functions.size() * sizeof(FunctionRecord));
+	place(header.listsOffset, lists.size() * sizeof(std::uint32_t));
+	place(header.seedsOffset, seeds.size() * sizeof(std::uint32_t));
+	place(header.slotsOffset, slots.size() * sizeof(std::uint32_t));
+	place(header.stringsOffset, paddedStrings.size());
+	if (offset > NO_INDEX)
+	{
+		throw CTypesParseError("C-types database is too large.");
+	}
+
+	header.typesCount = static_cast<std::uint32_t>(types.size());
+	header.functionsCount = static_cast<std::uint32_t>(functions.size());
+	header.listsCount = static_cast<std::uint32_t>(lists.size());
+	header.seedsCount = static_cast<std::uint32_t>(seeds.size());
+	header.slotsCount = static_cast<std::uint32_t>(slots.size());
+	header.stringsSize = static_cast<std::uint32_t>(paddedStrings.size());
+
+	out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+	writeSection(out, types);
+	writeSection(out, functions);
+	writeSection(out, lists);
+	writeSection(out, seeds);
+	writeSection(out, slots);
+	out.write(paddedStrings.data(), paddedStrings.size());
+}
+
+} // anonymous namespace
+
+/**
+* @brief Compiles C-types from JSON representation to a binary database.
+*
+* @param[in] json Input stream containing C-types in JSON.
+* @param[out] database Output stream for the database, it should be binary.
+*
+* @throw CTypesParseError when the input JSON is invalid or the database
+*        cannot be written.
+*
+* Bit widths and call conventions missing in JSON are not resolved, they are
+* resolved by @c BinaryCTypesDatabase for the target architecture, in the same
+* way as by @c JSONCTypesParser.
+*/
+void compileJsonCTypes(std::istream &json, std::ostream &database)
+{
+	std::ostringstream buffer;
+	buffer << json.rdbuf();
+	if (!json.good())
+	{
+		throw CTypesParseError("Failed to read from the input stream.");
+	}
+
+	rapidjson::Document root;
+	rapidjson::ParseResult res = root.Parse(buffer.str().c_str());
+	if (!res)
+	{
+		std::ostringstream errMsg;
+		errMsg << "Failed to parse JSON.\n";
+		errMsg << "Error (offset " << res.Offset() << "): " << GetParseError_En(res.Code());
+		throw CTypesParseError(errMsg.str());
+	}
+
+	Compiler(root).write(database);
+	if (!database.good())
+	{
+		throw CTypesParseError("Failed to write the C-types database.");
+	}
+}
+
+} // namespace ctypesparser
+} // namespace retdec
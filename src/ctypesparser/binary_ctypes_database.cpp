@@ -0,0 +1,475 @@
+/**
+* @file src/ctypesparser/binary_ctypes_database.cpp
+* @brief Reader of binary C-types databases.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <cassert>
+#include <cstring>
+
+#include "retdec/ctypes/ctypes.h"
+#include "retdec/ctypesparser/binary_ctypes_database.h"
+#include "retdec/utils/container.h"
+#include "retdec/utils/string.h"
+#include "ctypesparser/binary_ctypes_format.h"
+
+namespace retdec {
+namespace ctypesparser {
+
+using namespace binary;
+
+namespace {
+
+/// Extension of binary databases, replaces @c .json of the source.
+const std::string DATABASE_EXTENSION = ".ltidb";
+
+[[noreturn]] void throwCorrupted()
+{
+	throw CTypesParseError("C-types database is corrupted.");
+}
+
+std::uint64_t wideValue(const std::uint32_t *words)
+{
+	return words[0] | (static_cast<std::uint64_t>(words[1]) << 32);
+}
+
+} // anonymous namespace
+
+/**
+* @brief Constructs a new database reader.
+*/
+BinaryCTypesDatabase::BinaryCTypesDatabase() = default;
+
+/**
+* @brief Constructs a new database reader.
+*
+* @param defaultBitWidth BitWidth used for types that are not in typeWidths.
+*/
+BinaryCTypesDatabase::BinaryCTypesDatabase(unsigned defaultBitWidth):
+	CTypesParser(defaultBitWidth) {}
+
+/**
+* @brief Returns path of the database compiled from JSON at @a jsonPath.
+*/
+std::string BinaryCTypesDatabase::getDatabasePath(const std::string &jsonPath)
+{
+	const std::string jsonExtension = ".json";
+	if (retdec::utils::endsWith(jsonPath, jsonExtension))
+	{
+		return jsonPath.substr(0, jsonPath.size() - jsonExtension.size())
+			+ DATABASE_EXTENSION;
+	}
+	return jsonPath + DATABASE_EXTENSION;
+}
+
+/**
+* @brief Maps the database and prepares it for lookups.
+*
+* @param[in] path Path to the database.
+* @param[in] context Context to which C-types are added.
+* @param[in] typeWidths C-types' bit widths.
+* @param[in] callConvention Function call convention.
+*
+* @return @c false if the database does not exist or it has an unsupported
+*         version or byte order, @c true otherwise.
+*
+* Call convention is used when function itself does not specify its call
+* convention.
+*/
+bool BinaryCTypesDatabase::load(
+	const std::string &path,
+	const std::shared_ptr<retdec::ctypes::Context> &context,
+	const CTypesParser::TypeWidths &typeWidths,
+	const retdec::ctypes::CallConvention &callConvention)
+{
+	assert(context && "violated precondition - context cannot be null");
+
+	header = nullptr;
+	types.clear();
+	file = retdec::utils::MappedFile(path);
+	if (!file.isValid() || file.getSize() < sizeof(Header))
+	{
+		return false;
+	}
+
+	header = reinterpret_cast<const Header *>(file.getData());
+	if (!checkLayout())
+	{
+		header = nullptr;
+		return false;
+	}
+
+	this->context = context;
+	this->typeWidths = typeWidths;
+	defaultCallConv = callConvention;
+	types.resize(header->typesCount);
+	return true;
+}
+
+/**
+* @brief Checks that the mapped file is a database this reader understands.
+*/
+bool BinaryCTypesDatabase::checkLayout() const
+{
+	if (std::memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0
+			|| header->byteOrderMark != BYTE_ORDER_MARK
+			|| header->version != VERSION
+			|| header->seedsCount == 0
+			|| header->slotsCount == 0)
+	{
+		return false;
+	}
+
+	auto fits = [this](std::uint32_t offset, std::uint64_t count, std::size_t size)
+	{
+		return offset % sizeof(std::uint32_t) == 0
+			&& offset + count * size <= file.getSize();
+	};
+	auto *strings = file.getData() + header->stringsOffset;
+	return fits(header->typesOffset, header->typesCount, sizeof(TypeRecord))
+		&& fits(header->functionsOffset, header->functionsCount, sizeof(FunctionRecord))
+		&& fits(header->listsOffset, header->listsCount, sizeof(std::uint32_t))
+		&& fits(header->seedsOffset, header->seedsCount, sizeof(std::uint32_t))
+		&& fits(header->slotsOffset, header->slotsCount, sizeof(std::uint32_t))
+		&& fits(header->stringsOffset, header->stringsSize, 1)
+		// Every string in the section is terminated.
+		&& (header->stringsSize == 0 || strings[header->stringsSize - 1] == '\0');
+}
+
+/**
+* @brief Returns @c true if the database was successfully loaded.
+*/
+bool BinaryCTypesDatabase::isLoaded() const
+{
+	return header != nullptr;
+}
+
+/**
+* @brief Returns number of functions in the database.
+*/
+std::size_t BinaryCTypesDatabase::getFunctionCount() const
+{
+	return header ? header->functionsCount : 0;
+}
+
+/**
+* @brief Returns @c true if the database contains function @a name.
+*
+* No C-types are created.
+*/
+bool BinaryCTypesDatabase::hasFunction(const std::string &name) const
+{
+	return findFunction(name) != NO_INDEX;
+}
+
+/**
+* @brief Returns function @a name, or @c nullptr if it is not in the database.
+*
+* @throw CTypesParseError when the database is corrupted.
+*
+* Function and types it uses are created on the first request. When context
+* already contains function with the same name, it is returned instead.
+*/
+std::shared_ptr<retdec::ctypes::Function> BinaryCTypesDatabase::getFunction(
+	const std::string &name)
+{
+	auto index = findFunction(name);
+	if (index == NO_INDEX)
+	{
+		return nullptr;
+	}
+
+	if (auto cachedFunc = context->getFunctionWithName(name))
+	{
+		return cachedFunc;
+	}
+
+	auto *functions = reinterpret_cast<const FunctionRecord *>(
+		file.getData() + header->functionsOffset);
+	const auto &record = functions[index];
+
+	auto returnType = getType(record.returnType);
+
+	retdec::ctypes::Function::Parameters parameters;
+	auto *params = getList(record.paramsBegin, record.paramsCount, PARAMETER_WORDS);
+	for (std::uint32_t i = 0; i < record.paramsCount; ++i, params += PARAMETER_WORDS)
+	{
+		auto paramName = getString(params[0]);
+		auto paramType = getType(params[1]);
+		auto annotationStr = getString(params[2]);
+		retdec::ctypes::Parameter::Annotations annots;
+		if (!annotationStr.empty())
+		{
+			annots = parseAnnotations(annotationStr);
+		}
+		parameters.emplace_back(paramName, paramType, annots);
+	}
+
+	auto varArgness = record.flags & FUNCTION_IS_VAR_ARG
+		? retdec::ctypes::FunctionType::VarArgness::IsVarArg
+		: retdec::ctypes::FunctionType::VarArgness::IsNotVarArg;
+	retdec::ctypes::CallConvention callConv(
+		getStringOr(record.callConv, std::string(defaultCallConv)));
+
+	auto newFunction = retdec::ctypes::Function::create(
+		context, name, returnType, parameters, callConv, varArgness);
+	newFunction->setDeclaration(
+		retdec::ctypes::FunctionDeclaration(getString(record.declaration)));
+	newFunction->setHeaderFile(
+		retdec::ctypes::HeaderFile(getString(record.header)));
+	return newFunction;
+}
+
+/**
+* @brief Returns index of function @a name, or @c NO_INDEX if there is none.
+*/
+std::uint32_t BinaryCTypesDatabase::findFunction(const std::string &name) const
+{
+	if (!header || header->functionsCount == 0)
+	{
+		return NO_INDEX;
+	}
+
+	auto *seeds = reinterpret_cast<const std::uint32_t *>(
+		file.getData() + header->seedsOffset);
+	auto *slots = reinterpret_cast<const std::uint32_t *>(
+		file.getData() + header->slotsOffset);
+	auto *functions = reinterpret_cast<const FunctionRecord *>(
+		file.getData() + header->functionsOffset);
+
+	auto seed = seeds[hashName(name, 0) % header->seedsCount];
+	auto index = slots[hashName(name, seed) % header->slotsCount];
+	// Perfect hash maps names which are not in the database to random slots.
+	if (index >= header->functionsCount
+			|| getString(functions[index].name) != name)
+	{
+		return NO_INDEX;
+	}
+	return index;
+}
+
+/**
+* @brief Returns string at @a offset in the string section.
+*/
+std::string BinaryCTypesDatabase::getString(std::uint32_t offset) const
+{
+	if (offset >= header->stringsSize)
+	{
+		throwCorrupted();
+	}
+	return reinterpret_cast<const char *>(
+		file.getData() + header->stringsOffset + offset);
+}
+
+/**
+* @brief Returns string at @a offset, or @a defaultValue for a missing string.
+*/
+std::string BinaryCTypesDatabase::getStringOr(
+	std::uint32_t offset,
+	const std::string &defaultValue) const
+{
+	return offset == NO_INDEX ? defaultValue : getString(offset);
+}
+
+/**
+* @brief Returns words of @a count list items starting at word @a begin.
+*/
+const std::uint32_t *BinaryCTypesDatabase::getList(
+	std::uint32_t begin,
+	std::uint32_t count,
+	std::uint32_t wordsPerItem) const
+{
+	if (begin + std::uint64_t(count) * wordsPerItem > header->listsCount)
+	{
+		throwCorrupted();
+	}
+	return reinterpret_cast<const std::uint32_t *>(
+		file.getData() + header->listsOffset) + begin;
+}
+
+/**
+* @brief Returns type with @a index, creates it on the first request.
+*/
+std::shared_ptr<retdec::ctypes::Type> BinaryCTypesDatabase::getType(
+	std::uint32_t index)
+{
+	if (index >= header->typesCount)
+	{
+		throwCorrupted();
+	}
+	if (types[index])
+	{
+		return types[index];
+	}
+
+	auto *records = reinterpret_cast<const TypeRecord *>(
+		file.getData() + header->typesOffset);
+	auto newType = createType(records[index]);
+	// Type created while breaking a cycle of typedefs stays in the cache, like
+	// in JSONCTypesParser.
+	if (!types[index])
+	{
+		types[index] = newType;
+	}
+	return newType;
+}
+
+std::shared_ptr<retdec::ctypes::Type> BinaryCTypesDatabase::createType(
+	const TypeRecord &record)
+{
+	switch (record.kind)
+	{
+		case TypeKind::Typedef:
+			return createTypedefedType(record);
+		case TypeKind::Pointer:
+			return retdec::ctypes::PointerType::create(
+				context, getType(record.ref), getBitWidthOrDefault("*"));
+		case TypeKind::Integral:
+		case TypeKind::FloatingPoint:
+		case TypeKind::Struct:
+		case TypeKind::Union:
+		case TypeKind::Enum:
+			return createNamedType(record);
+		case TypeKind::Void:
+			return retdec::ctypes::VoidType::create();
+		case TypeKind::Function:
+			return createFunctionType(record);
+		case TypeKind::Array:
+		{
+			auto elementType = getType(record.ref);
+			retdec::ctypes::ArrayType::Dimensions dimensions;
+			auto *dims = getList(record.listBegin, record.listCount, DIMENSION_WORDS);
+			for (std::uint32_t i = 0; i < record.listCount; ++i, dims += DIMENSION_WORDS)
+			{
+				dimensions.emplace_back(wideValue(dims));
+			}
+			return retdec::ctypes::ArrayType::create(context, elementType, dimensions);
+		}
+		case TypeKind::Qualifier:
+			return getType(record.ref);
+		default:
+			return retdec::ctypes::UnknownType::create();
+	}
+}
+
+/**
+* @brief Creates typedef, typedefs referring to themselves alias unknown type.
+*/
+std::shared_ptr<retdec::ctypes::Type> BinaryCTypesDatabase::createTypedefedType(
+	const TypeRecord &record)
+{
+	auto typeName = getString(record.name);
+	if (auto cachedType = context->getNamedType(typeName))
+	{
+		return cachedType;
+	}
+	if (retdec::utils::hasItem(typedefsInProgress, typeName))
+	{
+		return retdec::ctypes::UnknownType::create();
+	}
+
+	typedefsInProgress.emplace_back(typeName);
+	auto aliasedType = record.ref == NO_INDEX
+		? retdec::ctypes::UnknownType::create()
+		: getType(record.ref);
+	if (typeName == typedefsInProgress[0])
+	{   // returned from all nested types
+		typedefsInProgress.clear();
+	}
+	return retdec::ctypes::TypedefedType::create(context, typeName, aliasedType);
+}
+
+/**
+* @brief Creates type identified by its name, unless context already has it.
+*/
+std::shared_ptr<retdec::ctypes::Type> BinaryCTypesDatabase::createNamedType(
+	const TypeRecord &record)
+{
+	auto typeName = getString(record.name);
+	if (auto cachedType = context->getNamedType(typeName))
+	{
+		return cachedType;
+	}
+
+	switch (record.kind)
+	{
+		case TypeKind::Integral:
+		{
+			auto bitWidth = record.flags & TYPE_HAS_BIT_WIDTH
+				? record.bitWidth
+				: getIntegralTypeBitWidth(typeName);
+			auto sign = retdec::utils::contains(typeName, "unsigned") ?
+				retdec::ctypes::IntegralType::Signess::Unsigned :
+				retdec::ctypes::IntegralType::Signess::Signed;
+			return retdec::ctypes::IntegralType::create(context, typeName, bitWidth, sign);
+		}
+		case TypeKind::FloatingPoint:
+		{
+			auto bitWidth = record.flags & TYPE_HAS_BIT_WIDTH
+				? record.bitWidth
+				: getBitWidthOrDefault(typeName);
+			return retdec::ctypes::FloatingPointType::create(context, typeName, bitWidth);
+		}
+		case TypeKind::Struct:
+		{
+			// Created before its members, which may refer to it.
+			auto newStruct = retdec::ctypes::StructType::create(context, typeName, {});
+			newStruct->setMembers(createMembers(record));
+			return newStruct;
+		}
+		case TypeKind::Union:
+		{
+			auto newUnion = retdec::ctypes::UnionType::create(context, typeName, {});
+			newUnion->setMembers(createMembers(record));
+			return newUnion;
+		}
+		default:
+		{
+			retdec::ctypes::EnumType::Values values;
+			auto *items = getList(record.listBegin, record.listCount, ENUM_ITEM_WORDS);
+			for (std::uint32_t i = 0; i < record.listCount; ++i, items += ENUM_ITEM_WORDS)
+			{
+				values.emplace_back(
+					getString(items[0]),
+					static_cast<std::int64_t>(wideValue(items + 1))
+				);
+			}
+			return retdec::ctypes::EnumType::create(context, typeName, values);
+		}
+	}
+}
+
+std::shared_ptr<retdec::ctypes::Type> BinaryCTypesDatabase::createFunctionType(
+	const TypeRecord &record)
+{
+	auto returnType = getType(record.ref);
+	retdec::ctypes::FunctionType::Parameters params;
+	auto *paramTypes = getList(record.listBegin, record.listCount, TYPE_PARAMETER_WORDS);
+	for (std::uint32_t i = 0; i < record.listCount; ++i)
+	{
+		params.emplace_back(getType(paramTypes[i]));
+	}
+	auto varArgness = record.flags & TYPE_IS_VAR_ARG
+		? retdec::ctypes::FunctionType::VarArgness::IsVarArg
+		: retdec::ctypes::FunctionType::VarArgness::IsNotVarArg;
+	retdec::ctypes::CallConvention callConv(
+		getStringOr(record.callConv, std::string(defaultCallConv)));
+	return retdec::ctypes::FunctionType::create(
+		context, returnType, params, callConv, varArgness);
+}
+
+retdec::ctypes::CompositeType::Members BinaryCTypesDatabase::createMembers(
+	const TypeRecord &record)
+{
+	retdec::ctypes::CompositeType::Members members;
+	auto *words = getList(record.listBegin, record.listCount, MEMBER_WORDS);
+	for (std::uint32_t i = 0; i < record.listCount; ++i, words += MEMBER_WORDS)
+	{
+		auto memberName = getString(words[0]);
+		members.emplace_back(memberName, getType(words[1]));
+	}
+	return members;
+}
+
+} // namespace ctypesparser
+} // namespace retdec
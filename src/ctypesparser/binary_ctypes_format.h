@@ -0,0 +1,160 @@
+/**
+* @file src/ctypesparser/binary_ctypes_format.h
+* @brief Layout of binary C-types databases.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*
+* Database is compiled from the JSON representation of C-types by
+* @c compileJsonCTypes() and read by @c BinaryCTypesDatabase. All numbers are
+* stored in the byte order of the machine which compiled the database, which is
+* detected by the reader from @c Header::byteOrderMark.
+*
+* Layout of the file:
+* @code
+* Header
+* types      TypeRecord[typesCount]
+* functions  FunctionRecord[functionsCount]
+* lists      std::uint32_t[listsCount]
+* seeds      std::uint32_t[seedsCount]
+* slots      std::uint32_t[slotsCount]
+* strings    char[stringsSize]
+* @endcode
+*
+* Strings are interned and null-terminated, they are referenced by their offset
+* in the string section. Types and functions are referenced by their index.
+* Variable-length parts of records (parameters, members, dimensions, enum
+* items) are stored as runs of words in the list section.
+*
+* Functions are indexed by a perfect hash of their names: bucket of a name is
+* selected by @c hashName(name, 0) modulo @c seedsCount and its slot by
+* @c hashName(name, seeds[bucket]) modulo @c slotsCount. Slot contains the
+* index of the function, or @c NO_INDEX when unused.
+*/
+
+#ifndef RETDEC_CTYPESPARSER_BINARY_CTYPES_FORMAT_H
+#define RETDEC_CTYPESPARSER_BINARY_CTYPES_FORMAT_H
+
+#include <cstdint>
+#include <string>
+
+namespace retdec {
+namespace ctypesparser {
+namespace binary {
+
+/// Magic bytes at the start of the database.
+const char MAGIC[8] = {'R', 'D', 'L', 'T', 'I', 'D', 'B', '\0'};
+/// Version of the layout, increase it on every incompatible change.
+const std::uint32_t VERSION = 1;
+/// Value of @c Header::byteOrderMark as written by the compiler.
+const std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+/// Reference to nothing (missing string, unknown type, unused slot).
+const std::uint32_t NO_INDEX = 0xffffffff;
+
+/**
+* @brief Kinds of types.
+*/
+enum class TypeKind : std::uint8_t
+{
+	Unknown,
+	Void,
+	Integral,
+	FloatingPoint,
+	Typedef,
+	Pointer,
+	Array,
+	Function,
+	Struct,
+	Union,
+	Enum,
+	Qualifier
+};
+
+/// @name Flags of types and functions.
+/// @{
+const std::uint8_t TYPE_HAS_BIT_WIDTH = 1;
+const std::uint8_t TYPE_IS_VAR_ARG    = 2;
+const std::uint32_t FUNCTION_IS_VAR_ARG = 1;
+/// @}
+
+/// @name Number of list words used by one item.
+/// @{
+const std::uint32_t PARAMETER_WORDS      = 3; ///< name, type, annotations
+const std::uint32_t TYPE_PARAMETER_WORDS = 1; ///< type
+const std::uint32_t MEMBER_WORDS         = 2; ///< name, type
+const std::uint32_t DIMENSION_WORDS      = 2; ///< low and high half
+const std::uint32_t ENUM_ITEM_WORDS      = 3; ///< name, low and high half of value
+/// @}
+
+struct Header
+{
+	char magic[8];
+	std::uint32_t byteOrderMark;
+	std::uint32_t version;
+	std::uint32_t typesOffset;
+	std::uint32_t typesCount;
+	std::uint32_t functionsOffset;
+	std::uint32_t functionsCount;
+	std::uint32_t listsOffset;
+	std::uint32_t listsCount;
+	std::uint32_t seedsOffset;
+	std::uint32_t seedsCount;
+	std::uint32_t slotsOffset;
+	std::uint32_t slotsCount;
+	std::uint32_t stringsOffset;
+	std::uint32_t stringsSize;
+};
+
+/**
+* @brief One type.
+*
+* Meaning of @c ref depends on the kind: pointed type, array element type,
+* aliased type (@c NO_INDEX for unknown), return type of function type or
+* modified type of qualifier. @c callConv is used only by function types.
+*/
+struct TypeRecord
+{
+	TypeKind kind;
+	std::uint8_t flags;
+	std::uint16_t reserved;
+	std::uint32_t name;
+	std::uint32_t ref;
+	std::uint32_t callConv;
+	std::uint32_t bitWidth;
+	std::uint32_t listBegin;
+	std::uint32_t listCount;
+};
+
+/**
+* @brief One function.
+*/
+struct FunctionRecord
+{
+	std::uint32_t name;
+	std::uint32_t returnType;
+	std::uint32_t callConv;
+	std::uint32_t declaration;
+	std::uint32_t header;
+	std::uint32_t flags;
+	std::uint32_t paramsBegin;
+	std::uint32_t paramsCount;
+};
+
+/**
+* @brief Hashes function name for the function index.
+*/
+inline std::uint64_t hashName(const std::string &name, std::uint32_t seed)
+{
+	// FNV-1a with the seed mixed into the offset basis.
+	std::uint64_t hash = 0xcbf29ce484222325ULL ^ (seed * 0x9e3779b97f4a7c15ULL);
+	for (unsigned char c : name)
+	{
+		hash ^= c;
+		hash *= 0x100000001b3ULL;
+	}
+	return hash;
+}
+
+} // namespace binary
+} // namespace ctypesparser
+} // namespace retdec
+
+#endif
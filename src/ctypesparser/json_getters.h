@@ -0,0 +1,43 @@
+/**
+* @file src/ctypesparser/json_getters.h
+* @brief Checked access to members of JSON C-types representation.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_CTYPESPARSER_JSON_GETTERS_H
+#define RETDEC_CTYPESPARSER_JSON_GETTERS_H
+
+#include <cstdint>
+#include <string>
+
+#include <rapidjson/document.h>
+
+namespace retdec {
+namespace ctypesparser {
+
+/// @name Getters throwing CTypesParseError when member has a wrong type.
+/// @{
+const rapidjson::Value &safeGetObject(
+	const rapidjson::Value &val,
+	const std::string &name);
+const rapidjson::Value &safeGetArray(
+	const rapidjson::Value &val,
+	const std::string &name);
+std::string safeGetString(
+	const rapidjson::Value &val,
+	const std::string &name,
+	const rapidjson::Value &defaultValue = rapidjson::Value());
+int64_t safeGetInt64(
+	const rapidjson::Value &val,
+	const std::string &name,
+	const rapidjson::Value &defaultValue = rapidjson::Value());
+bool safeGetBool(
+	const rapidjson::Value &val,
+	const std::string &name,
+	const rapidjson::Value &defaultValue = rapidjson::Value());
+/// @}
+
+} // namespace ctypesparser
+} // namespace retdec
+
+#endif
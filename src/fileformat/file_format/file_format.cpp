@@ -21,7 +21,7 @@
 #include "retdec/fileformat/utils/byte_array_buffer.h"
 #include "retdec/fileformat/file_format/intel_hex/intel_hex_format.h"
 #include "retdec/fileformat/file_format/raw_data/raw_data_format.h"
-#include "retdec/fileformat/types/strings/character_iterator.h"
+#include "retdec/fileformat/types/strings/string_scanner.h"
 #include "retdec/fileformat/utils/conversions.h"
 #include "retdec/fileformat/utils/crypto.h"
 #include "retdec/fileformat/utils/file_io.h"
@@ -70,45 +70,44 @@ bool isOffsetFromRegion(const SecSeg *actualRegion, const SecSeg *newRegion, std
 }
 
 /**
- * Decide whether @a address is part of region (section or segment) @a newRegion
- * @param actualRegion Region to which is address currently assigned (may be @c nullptr)
- * @param newRegion Currently examined region
- * @param address Address in memory
- * @return @c true if @a address is in range of @a newRegion and @a actualRegion is
- *    @c nullptr or @a newRegion is subset of @a actualRegion, @c false otherwise
+ * Create address index of the given regions (sections or segments)
+ * @param regions Regions to index
+ * @return Created index
+ *
+ * If more regions contain the same address, the one which starts later wins.
+ * If they start at the same address, the smaller one wins. Regions which are
+ * not mapped into memory are never found.
  */
-bool isAddressFromRegion(const SecSeg *actualRegion, const SecSeg *newRegion, std::size_t address)
+template <typename T>
+std::shared_ptr<const retdec::common::RegionIndex<T>> createAddressIndex(const std::vector<T*> &regions)
 {
-	if(!newRegion)
-	{
-		return false;
-	}
-
-	unsigned long long newRegionSize = 0;
-	if(!newRegion->getSizeInMemory(newRegionSize))
+	std::vector<typename retdec::common::RegionIndex<T>::Region> indexRegions;
+	indexRegions.reserve(regions.size());
+	for(const auto *item : regions)
 	{
-		newRegionSize = newRegion->getSizeInFile();
-	}
-
-	unsigned long long actualRegionSize = 0;
-	if(actualRegion)
-	{
-		if(!actualRegion->getSizeInMemory(actualRegionSize))
+		typename retdec::common::RegionIndex<T>::Region r;
+		r.value = item;
+		if(item && item->getMemory())
 		{
-			actualRegionSize = actualRegion->getSizeInFile();
-		}
-	}
-
-	if(newRegion->getMemory() && address >= newRegion->getAddress() && address - newRegion->getAddress() < newRegionSize)
-	{
-		if(!actualRegion || (newRegion->getAddress() > actualRegion->getAddress() ||
-			(newRegion->getAddress() == actualRegion->getAddress() && newRegionSize < actualRegionSize)))
-		{
-			return true;
+			unsigned long long size = 0;
+			if(!item->getSizeInMemory(size))
+			{
+				size = item->getSizeInFile();
+			}
+			r.start = item->getAddress();
+			r.end = retdec::common::RegionIndex<T>::regionEnd(r.start, size);
 		}
+		indexRegions.push_back(r);
 	}
 
-	return false;
+	// Region which starts later wins, then the smaller one.
+	return std::make_shared<const retdec::common::RegionIndex<T>>(
+			indexRegions,
+			[](const auto &a, const auto &b)
+			{
+				return a.start > b.start
+						|| (a.start == b.start && a.end - a.start < b.end - b.start);
+			});
 }
 
 } // anonymous namespace
@@ -119,16 +118,26 @@ bool isAddressFromRegion(const SecSeg *actualRegion, const SecSeg *newRegion, st
  * @param loadFlags Load flags
  */
 FileFormat::FileFormat(const std::string & pathToFile, LoadFlags loadFlags) :
-		auxBuff(nullptr, nullptr),
+		mappedFile(pathToFile),
+		auxBuff(mappedFile.begin(), mappedFile.end()),
 		auxIStream(&auxBuff),
-		loadedBytes(&bytes),
+		loadedBytes(nullptr),
 		loadFlags(loadFlags),
 		filePath(pathToFile),
-		fileStream(auxFStream),
+		fileStream(mappedFile.isValid() ? auxIStream : auxFStream),
 		_ldrErrInfo()
 {
-	auxFStream.open(filePath, std::ifstream::binary);
-	stateIsValid = auxFStream.is_open();
+	// The file is read through the stream only if it could not be mapped
+	// (e.g. it is not a regular file).
+	if (mappedFile.isValid())
+	{
+		stateIsValid = true;
+	}
+	else
+	{
+		auxFStream.open(filePath, std::ifstream::binary);
+		stateIsValid = auxFStream.is_open();
+	}
 	init();
 }
 
@@ -140,7 +149,7 @@ FileFormat::FileFormat(const std::string & pathToFile, LoadFlags loadFlags) :
 FileFormat::FileFormat(std::istream &inputStream, LoadFlags loadFlags) :
 		auxBuff(nullptr, nullptr),
 		auxIStream(&auxBuff),
-		loadedBytes(&bytes),
+		loadedBytes(nullptr),
 		loadFlags(loadFlags),
 		fileStream(inputStream),
 		_ldrErrInfo()
@@ -158,7 +167,7 @@ FileFormat::FileFormat(std::istream &inputStream, LoadFlags loadFlags) :
 FileFormat::FileFormat(const std::uint8_t *data, std::size_t size, LoadFlags loadFlags) :
 		auxBuff(data, size),
 		auxIStream(&auxBuff),
-		loadedBytes(&bytes),
+		loadedBytes(nullptr),
 		loadFlags(loadFlags),
 		fileStream(auxIStream),
 		_ldrErrInfo()
@@ -190,7 +199,7 @@ void FileFormat::init()
 	tlsInfo = nullptr;
 	elfCoreInfo = nullptr;
 	fileFormat = Format::UNDETECTABLE;
-	stateIsValid = readFile(fileStream, bytes) && stateIsValid;
+	initBytes();
 	if (getLoadFlags() & LoadFlags::NO_FILE_HASHES)
 	{
 		crc32.clear();
@@ -199,13 +208,32 @@ void FileFormat::init()
 	}
 	else
 	{
-		crc32 = retdec::fileformat::getCrc32(bytes.data(), bytes.size());
-		md5 = retdec::fileformat::getMd5(bytes.data(), bytes.size());
-		sha256 = retdec::fileformat::getSha256(bytes.data(), bytes.size());
+		retdec::fileformat::MultiDigest digest(bytes.data(), bytes.size());
+		crc32 = digest.getCrc32();
+		md5 = digest.getMd5();
+		sha256 = digest.getSha256();
 	}
 	initStream();
 }
 
+/**
+ * Initialize member @c bytes
+ *
+ * Content of a mapped input file is used in place. Otherwise, the input
+ * stream is read into memory.
+ */
+void FileFormat::initBytes()
+{
+	if (mappedFile.isValid())
+	{
+		bytes = ByteView(mappedFile.getData(), mappedFile.getSize());
+		return;
+	}
+
+	stateIsValid = readFile(fileStream, ownedBytes) && stateIsValid;
+	bytes = ownedBytes;
+}
+
 /**
  * Initialize internal state of member @c fileStream
  */
@@ -263,11 +291,23 @@ void FileFormat::clear()
 
 	sections.clear();
 	segments.clear();
+	invalidateAddressIndexes();
 	symbolTables.clear();
 	relocationTables.clear();
 	dynamicTables.clear();
 }
 
+/**
+ * Drop address indexes of sections and segments. They are recreated on the
+ * next lookup. Must be called whenever an address or a size of an existing
+ * section or segment is changed.
+ */
+void FileFormat::invalidateAddressIndexes()
+{
+	std::atomic_store(&sectionIndex, std::shared_ptr<const retdec::common::RegionIndex<Section>>());
+	std::atomic_store(&segmentIndex, std::shared_ptr<const retdec::common::RegionIndex<Segment>>());
+}
+
 /**
  * Compute hashes of section table. This method must be called after
  * sections are loaded.
@@ -316,9 +356,10 @@ void FileFormat::computeSectionTableHashes()
 
 	if(!data.empty())
 	{
-		sectionCrc32 = retdec::fileformat::getCrc32(data.data(), data.size());
-		sectionMd5 = retdec::fileformat::getMd5(data.data(), data.size());
-		sectionSha256 = retdec::fileformat::getSha256(data.data(), data.size());
+		retdec::fileformat::MultiDigest digest(data.data(), data.size());
+		sectionCrc32 = digest.getCrc32();
+		sectionMd5 = digest.getMd5();
+		sectionSha256 = digest.getSha256();
 	}
 }
 
@@ -333,6 +374,25 @@ void FileFormat::setLoadedBytes(std::vector<unsigned char> *lBytes)
 	loadedBytes = lBytes;
 }
 
+/**
+ * Append bytes to the content of input file
+ * @param data Bytes to append
+ * @param size Number of bytes to append
+ *
+ * Mapped content of input file is copied into memory before the first
+ * modification. Views obtained by @a getBytes() are invalidated.
+ */
+void FileFormat::appendBytes(const unsigned char *data, std::size_t size)
+{
+	if (bytes.data() != ownedBytes.data())
+	{
+		ownedBytes.assign(bytes.begin(), bytes.end());
+	}
+
+	ownedBytes.insert(ownedBytes.end(), data, data + size);
+	bytes = ownedBytes;
+}
+
 /**
  * If fileformat is Intel HEX or raw binary then it does not contain
  * critical information like architecture, endianness or std::uint16_t size.
@@ -371,14 +431,16 @@ void FileFormat::initArchitecture(
 
 /**
  * Load strings from data sections
+ *
+ * Strings are stored as records which refer to the data of sections, their
+ * content is read only when requested.
  */
 void FileFormat::loadStrings()
 {
 	if (!(getLoadFlags() & LoadFlags::DETECT_STRINGS))
 		return;
 
-	loadStrings(StringType::Ascii, 1);
-	loadStrings(StringType::Wide, 2);
+	scanStrings([this](const StringRecord& record) { strings.push_back(record); });
 
 	// Sort and remove duplicates
 	std::sort(strings.begin(), strings.end());
@@ -387,11 +449,13 @@ void FileFormat::loadStrings()
 }
 
 /**
- * Load strings of specified type and with specified character size.
- * @param type Type of the strings.
- * @param charSize Character size.
+ * Find strings in data sections (or segments if there are no sections)
+ * @param callback Called for each found string
+ *
+ * Strings are not stored, so this can be used to process strings of large
+ * files without keeping all of them in memory.
  */
-void FileFormat::loadStrings(StringType type, std::size_t charSize)
+void FileFormat::scanStrings(const std::function<void(const StringRecord&)> &callback) const
 {
 	if (!sections.empty())
 	{
@@ -400,7 +464,7 @@ void FileFormat::loadStrings(StringType type, std::size_t charSize)
 			if (!sec->isSomeData() && !sec->isDebug())
 				continue;
 
-			loadStrings(type, charSize, sec);
+			scanStrings(sec, callback);
 		}
 	}
 	else
@@ -410,33 +474,29 @@ void FileFormat::loadStrings(StringType type, std::size_t charSize)
 			if (!seg->isSomeData() && !seg->isDebug())
 				continue;
 
-			loadStrings(type, charSize, seg);
+			scanStrings(seg, callback);
 		}
 	}
 }
 
-void FileFormat::loadStrings(StringType type, std::size_t charSize, const SecSeg* secSeg)
+/**
+ * Find ASCII and wide strings in one section or segment
+ * @param secSeg Section or segment to scan
+ * @param callback Called for each found string
+ */
+void FileFormat::scanStrings(const SecSeg* secSeg, const std::function<void(const StringRecord&)> &callback) const
 {
-	CharacterEndianness endian = isLittleEndian() ? CharacterEndianness::Little : CharacterEndianness::Big;
-
-	for (auto begin = secSeg->getBytes().begin(), end = secSeg->getBytes().end(), itr = begin; itr != end;)
-	{
-		if (makeCharacterIterator(itr, begin, end, charSize).pointsToValidCharacter(endian))
-		{
-			auto stringBeginItr = makeCharacterIterator(itr, begin, end, charSize);
-			auto stringDataEndItr = makeCharacterIterator(end, begin, end, charSize);
-			auto stringEndItr = stringBeginItr + 1;
-			while (stringEndItr != stringDataEndItr && stringEndItr.pointsToValidCharacter(endian))
-				++stringEndItr;
-
-			if (static_cast<std::size_t>(stringEndItr - stringBeginItr) >= DefaultMinStringLength)
-				strings.emplace_back(type, secSeg->getOffset() + (itr - begin), secSeg->getName(), std::string{stringBeginItr, stringEndItr});
-
-			itr = stringEndItr.getUnderlyingIterator();
-		}
-		else
-			++itr;
-	}
+	const auto bigEndian = !isLittleEndian();
+	const auto data = secSeg->getBytes();
+	retdec::fileformat::scanStrings(
+			reinterpret_cast<const std::uint8_t*>(data.data()),
+			data.size(),
+			bigEndian ? CharacterEndianness::Big : CharacterEndianness::Little,
+			DefaultMinStringLength,
+			[&](std::size_t offset, std::size_t length, StringType type) {
+				callback(StringRecord(secSeg, secSeg->getOffset() + offset, length, type, bigEndian));
+			}
+	);
 }
 
 /**
@@ -478,6 +538,57 @@ void FileFormat::loadResourceIconHash()
 	resourceTable->computeIconHashes();
 }
 
+/**
+ * Load parts of the file which were requested by load flags
+ *
+ * Formats call this at the end of their initialization. All other deferred
+ * parts are loaded on the first access.
+ */
+void FileFormat::loadRequestedParts()
+{
+	for (auto part = static_cast<std::uint32_t>(LoadFlags::LOAD_RICH_HEADER);
+			part & LoadFlags::LOAD_ALL; part <<= 1)
+	{
+		if (loadFlags & part)
+		{
+			ensureLoaded(static_cast<LoadFlags>(part));
+		}
+	}
+}
+
+/**
+ * Make sure that deferred part of the file is loaded
+ * @param part One of the @c LOAD_* load flags
+ *
+ * The part is loaded at most once, even if more threads access it at the same
+ * time. Loading fills in members which are logically a part of the constant
+ * object, that is why it is allowed from constant getters.
+ */
+void FileFormat::ensureLoaded(LoadFlags part) const
+{
+	std::size_t index = 0;
+	for (auto bits = part / LoadFlags::LOAD_RICH_HEADER; bits > 1; bits >>= 1)
+	{
+		++index;
+	}
+
+	std::call_once(deferredParts[index], [this, part]() {
+		const_cast<FileFormat*>(this)->loadDeferredPart(part);
+	});
+}
+
+/**
+ * Load deferred part of the file
+ * @param part One of the @c LOAD_* load flags
+ *
+ * Formats which defer loading of some parts override this method. Default
+ * implementation does nothing, the format has no such part.
+ */
+void FileFormat::loadDeferredPart(LoadFlags)
+{
+
+}
+
 /**
  * Getter for state of instance
  * @return @c true if all is OK, @c false otherwise
@@ -586,17 +697,14 @@ bool FileFormat::haveDataOnOffset(unsigned long long offset) const
  */
 const Section* FileFormat::getSectionFromAddress(unsigned long long address) const
 {
-	const Section *actSec = nullptr;
-
-	for(const auto *item : sections)
+	auto index = std::atomic_load(&sectionIndex);
+	if(!index || index->getNumberOfRegions() != sections.size())
 	{
-		if(isAddressFromRegion(actSec, item, address))
-		{
-			actSec = item;
-		}
+		index = createAddressIndex(sections);
+		std::atomic_store(&sectionIndex, index);
 	}
 
-	return actSec;
+	return index->find(address);
 }
 
 /**
@@ -607,17 +715,14 @@ const Section* FileFormat::getSectionFromAddress(unsigned long long address) con
  */
 const Segment* FileFormat::getSegmentFromAddress(unsigned long long address) const
 {
-	const Segment *actSeg = nullptr;
-
-	for(const auto *item : segments)
+	auto index = std::atomic_load(&segmentIndex);
+	if(!index || index->getNumberOfRegions() != segments.size())
 	{
-		if(isAddressFromRegion(actSeg, item, address))
-		{
-			actSeg = item;
-		}
+		index = createAddressIndex(segments);
+		std::atomic_store(&segmentIndex, index);
 	}
 
-	return actSeg;
+	return index->find(address);
 }
 
 /**
@@ -1060,7 +1165,7 @@ std::size_t FileFormat::getFileLength() const
  */
 std::size_t FileFormat::getLoadedFileLength() const
 {
-	return loadedBytes->size();
+	return getLoadedBytes().size();
 }
 
 /**
@@ -1084,7 +1189,7 @@ bool FileFormat::getOverlayEntropy(double &res) const
 {
 	const auto overlaySize = getOverlaySize();
 	const auto declSize = getDeclaredFileLength();
-	const auto &bytes = getBytes();
+	const auto bytes = getBytes();
 	if (overlaySize == 0 || declSize == 0 || bytes.size() < declSize + overlaySize)
 	{
 		return false;
@@ -1194,7 +1299,8 @@ bool FileFormat::getBytes(std::vector<std::uint8_t> &result, unsigned long long
 	numberOfBytes = offset + numberOfBytes > getLoadedFileLength() ? getLoadedFileLength() - offset : numberOfBytes;
 	result.clear();
 	result.reserve(numberOfBytes);
-	std::copy(loadedBytes->begin() + offset, loadedBytes->begin() + offset + numberOfBytes, std::back_inserter(result));
+	const auto loaded = getLoadedBytes();
+	std::copy(loaded.begin() + offset, loaded.begin() + offset + numberOfBytes, std::back_inserter(result));
 	return true;
 }
 
@@ -1230,7 +1336,8 @@ bool FileFormat::getEpBytes(std::vector<std::uint8_t> &result, unsigned long lon
  */
 bool FileFormat::getHexBytes(std::string &result, unsigned long long offset, unsigned long long numberOfBytes) const
 {
-	bytesToHexString(*loadedBytes, result, offset, numberOfBytes);
+	const auto loaded = getLoadedBytes();
+	bytesToHexString(loaded.data(), loaded.size(), result, offset, numberOfBytes);
 	return offset < getLoadedFileLength();
 }
 
@@ -1281,7 +1388,8 @@ bool FileFormat::getHexBytesFromEnd(std::string &result, unsigned long long numb
  */
 bool FileFormat::getString(std::string &result, unsigned long long offset, unsigned long long numberOfBytes) const
 {
-	bytesToString(*loadedBytes, result, offset, numberOfBytes);
+	const auto loaded = getLoadedBytes();
+	bytesToString(loaded.data(), loaded.size(), result, offset, numberOfBytes);
 	return offset < getLoadedFileLength();
 }
 
@@ -1549,6 +1657,7 @@ const ExportTable* FileFormat::getExportTable() const
  */
 const ResourceTable* FileFormat::getResourceTable() const
 {
+	ensureLoaded(LoadFlags::LOAD_RESOURCES);
 	return resourceTable;
 }
 
@@ -1558,6 +1667,7 @@ const ResourceTable* FileFormat::getResourceTable() const
  */
 const ResourceTree* FileFormat::getResourceTree() const
 {
+	ensureLoaded(LoadFlags::LOAD_RESOURCES);
 	return resourceTree;
 }
 
@@ -1567,6 +1677,7 @@ const ResourceTree* FileFormat::getResourceTree() const
  */
 const RichHeader* FileFormat::getRichHeader() const
 {
+	ensureLoaded(LoadFlags::LOAD_RICH_HEADER);
 	return richHeader;
 }
 
@@ -1585,6 +1696,7 @@ const PdbInfo* FileFormat::getPdbInfo() const
  */
 const CertificateTable* FileFormat::getCertificateTable() const
 {
+	ensureLoaded(LoadFlags::LOAD_CERTIFICATES);
 	return certificateTable;
 }
 
@@ -1740,7 +1852,8 @@ const Export* FileFormat::getExport(unsigned long long address) const
  */
 const Resource* FileFormat::getManifestResource() const
 {
-	return resourceTable ? resourceTable->getResourceWithType(PELIB_RT_MANIFEST) : nullptr;
+	const auto *resTable = getResourceTable();
+	return resTable ? resTable->getResourceWithType(PELIB_RT_MANIFEST) : nullptr;
 }
 
 /**
@@ -1749,7 +1862,8 @@ const Resource* FileFormat::getManifestResource() const
  */
 const Resource* FileFormat::getVersionResource() const
 {
-	return resourceTable ? resourceTable->getResourceWithType(PELIB_RT_VERSION) : nullptr;
+	const auto *resTable = getResourceTable();
+	return resTable ? resTable->getResourceWithType(PELIB_RT_VERSION) : nullptr;
 }
 
 /**
@@ -1877,8 +1991,10 @@ const std::vector<DynamicTable*>& FileFormat::getDynamicTables() const
 /**
  * Get content of input file as bytes
  * @return Content of input file as bytes
+ *
+ * The returned view is valid as long as this instance exists.
  */
-const std::vector<unsigned char>& FileFormat::getBytes() const
+ByteView FileFormat::getBytes() const
 {
 	return bytes;
 }
@@ -1886,10 +2002,12 @@ const std::vector<unsigned char>& FileFormat::getBytes() const
 /**
  * Get serialized loaded content of input file as bytes
  * @return Serialized content of input file as bytes
+ *
+ * The returned view is valid as long as this instance exists.
  */
-const std::vector<unsigned char>& FileFormat::getLoadedBytes() const
+ByteView FileFormat::getLoadedBytes() const
 {
-	return *loadedBytes;
+	return loadedBytes ? ByteView(*loadedBytes) : bytes;
 }
 
 /**
@@ -1907,14 +2025,14 @@ const unsigned char* FileFormat::getBytesData() const
  */
 const unsigned char* FileFormat::getLoadedBytesData() const
 {
-	return loadedBytes->data();
+	return getLoadedBytes().data();
 }
 
 /**
  * Get all detected strings
- * @return Reference to strings
+ * @return Reference to records of strings
  */
-const std::vector<String>& FileFormat::getStrings() const
+const std::vector<StringRecord>& FileFormat::getStrings() const
 {
 	return strings;
 }
@@ -1939,6 +2057,7 @@ const std::set<std::uint64_t> &FileFormat::getUnknownRelocations() const
  */
 const std::vector<std::pair<std::string,std::string>> &FileFormat::getAnomalies() const
 {
+	ensureLoaded(LoadFlags::LOAD_ANOMALIES);
 	return anomalies;
 }
 
@@ -1966,7 +2085,7 @@ bool FileFormat::getXByte(std::uint64_t address, std::uint64_t x, std::uint64_t
 	const auto secOffset = address - secSeg->getAddress();
 	const auto offset = secSeg->getOffset() + secOffset;
 	return (secOffset + x > secSeg->getLoadedSize() || offset + x > getLoadedFileLength()) ?
-		false : createValueFromBytes(*loadedBytes, res, e, offset, x);
+		false : createValueFromBytes(getLoadedBytes(), res, e, offset, x);
 }
 
 /**
@@ -2106,7 +2225,7 @@ bool FileFormat::getXByteOffset(std::uint64_t offset, std::uint64_t x, std::uint
 		return true;
 	}
 
-	return createValueFromBytes(*loadedBytes, res, e, offset, x);
+	return createValueFromBytes(getLoadedBytes(), res, e, offset, x);
 }
 
 /**
@@ -2121,7 +2240,8 @@ bool FileFormat::getXBytesOffset(std::uint64_t offset, std::uint64_t x, std::vec
 	res.clear();
 	if(offset + x <= getLoadedFileLength())
 	{
-		res.assign(loadedBytes->begin() + offset, loadedBytes->begin() + offset + x);
+		const auto loaded = getLoadedBytes();
+		res.assign(loaded.begin() + offset, loaded.begin() + offset + x);
 		return res.size() == x;
 	}
 
@@ -2611,13 +2731,14 @@ void FileFormat::dumpResourceTree()
 
 void FileFormat::dumpResourceTree(std::string &dumpStr)
 {
-	if(!resourceTree)
+	const auto *resTree = getResourceTree();
+	if(!resTree)
 	{
 		dumpStr.clear();
 	}
 	else
 	{
-		resourceTree->dump(dumpStr);
+		resTree->dump(dumpStr);
 	}
 }
 
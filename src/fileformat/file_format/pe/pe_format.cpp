@@ -612,10 +612,11 @@ void PeFormat::initStructures(const std::string & dllListFile)
 	{
 		try
 		{
-			if(file->loadPeHeaders(bytes) == ERROR_NONE)
+			// The image refers to the input bytes, which outlive it
+			if(file->loadPeHeaders(bytes.data(), bytes.size()) == ERROR_NONE)
 				stateIsValid = true;
 
-			file->readCoffSymbolTable(bytes);
+			file->readCoffSymbolTable(bytes.data(), bytes.size());
 			file->readImportDirectory();
 			file->readIatDirectory();
 			file->readBoundImportDirectory();
@@ -642,20 +643,55 @@ void PeFormat::initStructures(const std::string & dllListFile)
 	if(stateIsValid)
 	{
 		fileFormat = Format::PE;
-		loadRichHeader();
 		loadSections();
 		loadSymbols();
 		loadImports();
 		loadExports();
 		loadPdbInfo();
-		loadResources();
-		loadCertificates();
 		loadTlsInformation();
-		loadDotnetHeaders();
-		loadVisualBasicHeader();
 		computeSectionTableHashes();
 		loadStrings();
-		scanForAnomalies();
+		loadRequestedParts();
+	}
+}
+
+/**
+ * Load part of the file which is not needed by everyone
+ * @param part One of the @c LOAD_* load flags
+ *
+ * Directories of PeLib file are read while the file is being loaded, so that
+ * the loader error is the same regardless of what is accessed. Only the
+ * derived structures are built here.
+ */
+void PeFormat::loadDeferredPart(LoadFlags part)
+{
+	if(!stateIsValid || !formatParser)
+	{
+		return;
+	}
+
+	switch(part)
+	{
+		case LoadFlags::LOAD_RICH_HEADER:
+			loadRichHeader();
+			break;
+		case LoadFlags::LOAD_RESOURCES:
+			loadResources();
+			break;
+		case LoadFlags::LOAD_CERTIFICATES:
+			loadCertificates();
+			break;
+		case LoadFlags::LOAD_DOTNET:
+			loadDotnetHeaders();
+			break;
+		case LoadFlags::LOAD_VISUAL_BASIC:
+			loadVisualBasicHeader();
+			break;
+		case LoadFlags::LOAD_ANOMALIES:
+			scanForAnomalies();
+			break;
+		default:
+			break;
 	}
 }
 
@@ -766,7 +802,7 @@ void PeFormat::loadRichHeader()
 	}
 
 	std::string plainText;
-	bytesToString(bytes, plainText, getMzHeaderSize(), getPeHeaderOffset() - getMzHeaderSize());
+	bytesToString(bytes.data(), bytes.size(), plainText, getMzHeaderSize(), getPeHeaderOffset() - getMzHeaderSize());
 	auto offset = getRichHeaderOffset(plainText);
 	auto standardOffset = (offset == STANDARD_RICH_HEADER_OFFSET);
 	if(offset >= getPeHeaderOffset())
@@ -859,9 +895,10 @@ void PeFormat::loadRichHeader()
 	auto decrypted_bytes = header.getDecryptedHeaderBytes();
 	richHeader->setBytes(decrypted_bytes);
 
-	auto crc32 = retdec::fileformat::getCrc32(decrypted_bytes.data(), decrypted_bytes.size());
-	auto md5 = retdec::fileformat::getMd5(decrypted_bytes.data(), decrypted_bytes.size());
-	auto sha256 = retdec::fileformat::getSha256(decrypted_bytes.data(), decrypted_bytes.size());
+	retdec::fileformat::MultiDigest digest(decrypted_bytes.data(), decrypted_bytes.size());
+	auto crc32 = digest.getCrc32();
+	auto md5 = digest.getMd5();
+	auto sha256 = digest.getSha256();
 
 	richHeader->setCrc32(crc32);
 	richHeader->setMd5(md5);
@@ -873,7 +910,7 @@ void PeFormat::loadRichHeader()
  */
 void PeFormat::loadVisualBasicHeader()
 {
-	const auto &allBytes = getBytes();
+	const auto allBytes = getBytes();
 	std::vector<std::uint8_t> bytes;
 	std::uint64_t version = 0;
 	std::uint64_t vbHeaderAddress = 0;
@@ -997,7 +1034,7 @@ void PeFormat::loadVisualBasicHeader()
  */
 bool PeFormat::parseVisualBasicComRegistrationData(std::size_t structureOffset)
 {
-	const auto &allBytes = getBytes();
+	const auto allBytes = getBytes();
 	std::vector<std::uint8_t> bytes;
 	std::size_t offset = 0;
 	struct VBCOMRData vbcrd;
@@ -1060,7 +1097,7 @@ bool PeFormat::parseVisualBasicComRegistrationData(std::size_t structureOffset)
 bool PeFormat::parseVisualBasicComRegistrationInfo(std::size_t structureOffset,
 													std::size_t comRegDataOffset)
 {
-	const auto &allBytes = getBytes();
+	const auto allBytes = getBytes();
 	std::vector<std::uint8_t> bytes;
 	std::size_t offset = 0;
 	struct VBCOMRInfo vbcri;
@@ -1180,7 +1217,7 @@ bool PeFormat::parseVisualBasicProjectInfo(std::size_t structureOffset)
  */
 bool PeFormat::parseVisualBasicExternTable(std::size_t structureOffset, std::size_t nEntries)
 {
-	const auto &allBytes = getBytes();
+	const auto allBytes = getBytes();
 	std::vector<std::uint8_t> bytes;
 	struct VBExternTableEntry entry;
 	struct VBExternTableEntryData entryData;
@@ -1259,7 +1296,7 @@ bool PeFormat::parseVisualBasicExternTable(std::size_t structureOffset, std::siz
  */
 bool PeFormat::parseVisualBasicObjectTable(std::size_t structureOffset)
 {
-	const auto &allBytes = getBytes();
+	const auto allBytes = getBytes();
 	std::vector<std::uint8_t> bytes;
 	std::size_t offset = 0;
 	std::uint64_t projectNameOffset = 0;
@@ -1322,7 +1359,7 @@ bool PeFormat::parseVisualBasicObjectTable(std::size_t structureOffset)
  */
 bool PeFormat::parseVisualBasicObjects(std::size_t structureOffset, std::size_t nObjects)
 {
-	const auto &allBytes = getBytes();
+	const auto allBytes = getBytes();
 	std::vector<std::uint8_t> bytes;
 	struct VBPublicObjectDescriptor vbpod;
 	std::size_t offset = 0;
@@ -2161,7 +2198,7 @@ void PeFormat::loadDotnetHeaders()
 	metadataHeader->setFlags(flags);
 
 	// Check if it is actually a .NET application, this check is important to be aligned with YARA scanning
-	if (!isDotNet())
+	if (!hasValidDotnetHeaders())
 		return;
 
 	auto currentAddress = metadataHeaderStreamsHeader + 4;
@@ -2985,9 +3022,10 @@ void PeFormat::computeTypeRefHashes()
 		}
 	}
 
-	typeRefHashCrc32 = retdec::fileformat::getCrc32(typeRefHashBytes.data(), typeRefHashBytes.size());
-	typeRefHashMd5 = retdec::fileformat::getMd5(typeRefHashBytes.data(), typeRefHashBytes.size());
-	typeRefHashSha256 = retdec::fileformat::getSha256(typeRefHashBytes.data(), typeRefHashBytes.size());
+	retdec::fileformat::MultiDigest digest(typeRefHashBytes.data(), typeRefHashBytes.size());
+	typeRefHashCrc32 = digest.getCrc32();
+	typeRefHashMd5 = digest.getMd5();
+	typeRefHashSha256 = digest.getSha256();
 }
 
 retdec::utils::Endianness PeFormat::getEndianness() const
@@ -3489,6 +3527,16 @@ bool PeFormat::initDllList(const std::string & dllListFile)
  * @return @c true if input file contains CIL/.NET code, @c false otherwise
  */
 bool PeFormat::isDotNet() const
+{
+	ensureLoaded(LoadFlags::LOAD_DOTNET);
+	return hasValidDotnetHeaders();
+}
+
+/**
+ * Check if already loaded .NET headers describe CIL/.NET code
+ * @return @c true if .NET headers are valid, @c false otherwise
+ */
+bool PeFormat::hasValidDotnetHeaders() const
 {
 	if (!clrHeader || !metadataHeader) {
 		return false;
@@ -3688,76 +3736,91 @@ const PeCoffSection* PeFormat::getPeSection(std::uint64_t secIndex) const
 
 const CLRHeader* PeFormat::getCLRHeader() const
 {
+	ensureLoaded(LoadFlags::LOAD_DOTNET);
 	return clrHeader.get();
 }
 
 const MetadataHeader* PeFormat::getMetadataHeader() const
 {
+	ensureLoaded(LoadFlags::LOAD_DOTNET);
 	return metadataHeader.get();
 }
 
 const MetadataStream* PeFormat::getMetadataStream() const
 {
+	ensureLoaded(LoadFlags::LOAD_DOTNET);
 	return metadataStream.get();
 }
 
 const StringStream* PeFormat::getStringStream() const
 {
+	ensureLoaded(LoadFlags::LOAD_DOTNET);
 	return stringStream.get();
 }
 
 const BlobStream* PeFormat::getBlobStream() const
 {
+	ensureLoaded(LoadFlags::LOAD_DOTNET);
 	return blobStream.get();
 }
 
 const GuidStream* PeFormat::getGuidStream() const
 {
+	ensureLoaded(LoadFlags::LOAD_DOTNET);
 	return guidStream.get();
 }
 
 const UserStringStream* PeFormat::getUserStringStream() const
 {
+	ensureLoaded(LoadFlags::LOAD_DOTNET);
 	return userStringStream.get();
 }
 
 const std::string& PeFormat::getModuleVersionId() const
 {
+	ensureLoaded(LoadFlags::LOAD_DOTNET);
 	return moduleVersionId;
 }
 
 const std::string& PeFormat::getTypeLibId() const
 {
+	ensureLoaded(LoadFlags::LOAD_DOTNET);
 	return typeLibId;
 }
 
 const std::vector<std::shared_ptr<DotnetClass>>& PeFormat::getDefinedDotnetClasses() const
 {
+	ensureLoaded(LoadFlags::LOAD_DOTNET);
 	return definedClasses;
 }
 
 const std::vector<std::shared_ptr<DotnetClass>>& PeFormat::getImportedDotnetClasses() const
 {
+	ensureLoaded(LoadFlags::LOAD_DOTNET);
 	return importedClasses;
 }
 
 const std::string& PeFormat::getTypeRefhashCrc32() const
 {
+	ensureLoaded(LoadFlags::LOAD_DOTNET);
 	return typeRefHashCrc32;
 }
 
 const std::string& PeFormat::getTypeRefhashMd5() const
 {
+	ensureLoaded(LoadFlags::LOAD_DOTNET);
 	return typeRefHashMd5;
 }
 
 const std::string& PeFormat::getTypeRefhashSha256() const
 {
+	ensureLoaded(LoadFlags::LOAD_DOTNET);
 	return typeRefHashSha256;
 }
 
 const VisualBasicInfo* PeFormat::getVisualBasicInfo() const
 {
+	ensureLoaded(LoadFlags::LOAD_VISUAL_BASIC);
 	return &visualBasicInfo;
 }
 
@@ -3946,14 +4009,15 @@ void PeFormat::scanForSectionAnomalies(unsigned anomaliesLimit)
  */
 void PeFormat::scanForResourceAnomalies()
 {
-	if (!resourceTable)
+	const auto *resTable = getResourceTable();
+	if (!resTable)
 	{
 		return;
 	}
 
-	for (std::size_t i = 0; i < resourceTable->getNumberOfResources(); i++)
+	for (std::size_t i = 0; i < resTable->getNumberOfResources(); i++)
 	{
-		auto res = resourceTable->getResource(i);
+		auto res = resTable->getResource(i);
 		if (!res)
 		{
 			continue;
@@ -267,6 +267,7 @@ void RawDataFormat::setEntryPoint(retdec::common::Address entryPoint)
 void RawDataFormat::setBaseAddress(retdec::common::Address baseAddress)
 {
 	section->setAddress(baseAddress);
+	invalidateAddressIndexes();
 }
 
 /**
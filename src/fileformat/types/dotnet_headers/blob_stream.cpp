@@ -21,6 +21,17 @@ BlobStream::BlobStream(std::vector<std::uint8_t> data, std::uint64_t streamOffse
  * @return Element data if it exists, otherwise empty sequence.
  */
 std::vector<std::uint8_t> BlobStream::getElement(std::size_t offset) const
+{
+	return getElementView(offset).toVector();
+}
+
+/**
+ * Returns the element at the specified offset in the blob without copying it.
+ * @param offset Offset of the element.
+ * @return View of element data valid as long as the stream exists if the
+ *    element exists, otherwise empty view.
+ */
+retdec::utils::ByteView BlobStream::getElementView(std::size_t offset) const
 {
 	// Adapted from YARA
 	// https://github.com/VirusTotal/yara/blob/v4.1.2/libyara/modules/dotnet/dotnet.c#L130
@@ -41,7 +52,7 @@ std::vector<std::uint8_t> BlobStream::getElement(std::size_t offset) const
 		offset += 1;
 		if (offset + len <= data.size())
 		{
-			return { data.begin() + offset, data.begin() + offset + len };
+			return { data.data() + offset, len };
 		}
 	}
 	// If first 2 bits are 10, length is stored in 2 bytes
@@ -56,7 +67,7 @@ std::vector<std::uint8_t> BlobStream::getElement(std::size_t offset) const
 		}
 		if (offset + len <= data.size())
 		{
-			return { data.begin() + offset, data.begin() + offset + len };
+			return { data.data() + offset, len };
 		}
 	}
 	// If first 3 bits are 110, length is stored in 4 bytes
@@ -74,7 +85,7 @@ std::vector<std::uint8_t> BlobStream::getElement(std::size_t offset) const
 		}
 		if (offset + len <= data.size())
 		{
-			return { data.begin() + offset, data.begin() + offset + len };
+			return { data.data() + offset, len };
 		}
 	}
 
@@ -31,7 +31,7 @@ const std::uint8_t Generic           = 0x10; ///< Flag indicating whether the me
  * @param [out] bytesRead Amount of bytes read out of signature.
  * @return Decoded unsigned integer.
  */
-std::uint64_t decodeUnsigned(const std::vector<std::uint8_t>& data, std::uint64_t& bytesRead)
+std::uint64_t decodeUnsigned(const retdec::utils::ByteView& data, std::uint64_t& bytesRead)
 {
 	std::uint64_t result = 0;
 	bytesRead = 0;
@@ -80,7 +80,7 @@ std::uint64_t decodeUnsigned(const std::vector<std::uint8_t>& data, std::uint64_
  * @param [out] bytesRead Amount of bytes read out of signature.
  * @return Decoded signed integer.
  */
-std::int64_t decodeSigned(const std::vector<std::uint8_t>& data, std::uint64_t& bytesRead)
+std::int64_t decodeSigned(const retdec::utils::ByteView& data, std::uint64_t& bytesRead)
 {
 	std::int64_t result = 0;
 	bytesRead = 0;
@@ -729,7 +729,7 @@ bool DotnetTypeReconstructor::reconstructBaseTypes()
 			if (typeSpec == nullptr)
 				continue;
 
-			auto signature = blobStream->getElement(typeSpec->signature.getIndex());
+			auto signature = blobStream->getElementView(typeSpec->signature.getIndex());
 			baseType = dataTypeFromSignature(signature, classType.get(), nullptr);
 			if (baseType == nullptr)
 				continue;
@@ -784,7 +784,7 @@ bool DotnetTypeReconstructor::reconstructBaseTypes()
 			if (typeSpec == nullptr)
 				continue;
 
-			auto signature = blobStream->getElement(typeSpec->signature.getIndex());
+			auto signature = blobStream->getElementView(typeSpec->signature.getIndex());
 			baseType = dataTypeFromSignature(signature, itr->second.get(), nullptr);
 			if (baseType == nullptr)
 				continue;
@@ -907,11 +907,11 @@ std::unique_ptr<DotnetField> DotnetTypeReconstructor::createField(const Field* f
 		return nullptr;
 
 	fieldName = retdec::utils::replaceNonprintableChars(fieldName);
-	auto signature = blobStream->getElement(field->signature.getIndex());
+	auto signature = blobStream->getElementView(field->signature.getIndex());
 
 	if (signature.empty() || signature[0] != FieldSignature)
 		return nullptr;
-	signature.erase(signature.begin(), signature.begin() + 1);
+	signature.removePrefix(1);
 
 	auto type = dataTypeFromSignature(signature, ownerClass, nullptr);
 	if (type == nullptr)
@@ -940,14 +940,14 @@ std::unique_ptr<DotnetProperty> DotnetTypeReconstructor::createProperty(const Pr
 		return nullptr;
 
 	propertyName = retdec::utils::replaceNonprintableChars(propertyName);
-	auto signature = blobStream->getElement(property->type.getIndex());
+	auto signature = blobStream->getElementView(property->type.getIndex());
 
 	if (signature.size() < 2 || (signature[0] & ~HasThis) != PropertySignature)
 		return nullptr;
 	bool hasThis = signature[0] & HasThis;
 	// Delete two bytes because the first is 0x08 (or 0x28 if HASTHIS is set) and the other one is number of parameters
 	// This seems like a weird thing, because I don't think that C# allows any parameters in getters/setters and therefore this will always be 0
-	signature.erase(signature.begin(), signature.begin() + 2);
+	signature.removePrefix(2);
 
 	auto type = dataTypeFromSignature(signature, ownerClass, nullptr);
 	if (type == nullptr)
@@ -975,7 +975,7 @@ std::unique_ptr<DotnetMethod> DotnetTypeReconstructor::createMethod(const Method
 		return nullptr;
 
 	methodName = retdec::utils::replaceNonprintableChars(methodName);
-	auto signature = blobStream->getElement(methodDef->signature.getIndex());
+	auto signature = blobStream->getElementView(methodDef->signature.getIndex());
 
 	if (methodName.empty() || signature.empty())
 		return nullptr;
@@ -983,7 +983,7 @@ std::unique_ptr<DotnetMethod> DotnetTypeReconstructor::createMethod(const Method
 	// If method contains generic paramters, we need to read the number of these generic paramters
 	if (signature[0] & Generic)
 	{
-		signature.erase(signature.begin(), signature.begin() + 1);
+		signature.removePrefix(1);
 
 		// We ignore this value just because we have this information already from the class name in format 'ClassName`N'
 		std::uint64_t bytesRead = 0;
@@ -991,11 +991,11 @@ std::unique_ptr<DotnetMethod> DotnetTypeReconstructor::createMethod(const Method
 		if (bytesRead == 0)
 			return nullptr;
 
-		signature.erase(signature.begin(), signature.begin() + bytesRead);
+		signature.removePrefix(bytesRead);
 	}
 	else
 	{
-		signature.erase(signature.begin(), signature.begin() + 1);
+		signature.removePrefix(1);
 	}
 
 	// It is followed by number of parameters
@@ -1003,7 +1003,7 @@ std::unique_ptr<DotnetMethod> DotnetTypeReconstructor::createMethod(const Method
 	std::uint64_t paramsCount = decodeUnsigned(signature, bytesRead);
 	if (bytesRead == 0)
 		return nullptr;
-	signature.erase(signature.begin(), signature.begin() + bytesRead);
+	signature.removePrefix(bytesRead);
 
 	auto newMethod = std::make_unique<DotnetMethod>();
 	newMethod->setRawRecord(methodDef);
@@ -1030,12 +1030,12 @@ std::unique_ptr<DotnetMethod> DotnetTypeReconstructor::createMethod(const Method
  * @param startIdx Index of the first Param record of the method
  * @param ownerClass Owning class.
  * @param ownerMethod Owning method.
- * @param signature Signature with data types. Is destroyed in the meantime.
+ * @param signature Signature with data types. Decoded bytes are skipped in the view.
  * @return New method parameter or @c nullptr in case of failure.
  */
 std::unique_ptr<DotnetParameter> DotnetTypeReconstructor::createMethodParameter(
 		std::size_t paramIdx, std::size_t startIdx, const DotnetClass* ownerClass,
-		const DotnetMethod* ownerMethod, std::vector<std::uint8_t>& signature)
+		const DotnetMethod* ownerMethod, retdec::utils::ByteView& signature)
 {
 	std::string paramName;
 
@@ -1076,7 +1076,7 @@ std::unique_ptr<DotnetParameter> DotnetTypeReconstructor::createMethodParameter(
  * @return New data type or @c nullptr in case of failure.
  */
 template <typename T>
-std::unique_ptr<T> DotnetTypeReconstructor::createDataTypeFollowedByReference(std::vector<std::uint8_t>& data)
+std::unique_ptr<T> DotnetTypeReconstructor::createDataTypeFollowedByReference(retdec::utils::ByteView& data)
 {
 	std::uint64_t bytesRead;
 	TypeDefOrRef typeRef;
@@ -1088,7 +1088,7 @@ std::unique_ptr<T> DotnetTypeReconstructor::createDataTypeFollowedByReference(st
 	if (classRef == nullptr)
 		return nullptr;
 
-	data.erase(data.begin(), data.begin() + bytesRead);
+	data.removePrefix(bytesRead);
 	return std::make_unique<T>(classRef);
 }
 
@@ -1100,7 +1100,7 @@ std::unique_ptr<T> DotnetTypeReconstructor::createDataTypeFollowedByReference(st
  * @return New data type or @c nullptr in case of failure.
  */
 template <typename T>
-std::unique_ptr<T> DotnetTypeReconstructor::createDataTypeFollowedByType(std::vector<std::uint8_t>& data, const DotnetClass* ownerClass, const DotnetMethod* ownerMethod)
+std::unique_ptr<T> DotnetTypeReconstructor::createDataTypeFollowedByType(retdec::utils::ByteView& data, const DotnetClass* ownerClass, const DotnetMethod* ownerMethod)
 {
 	auto type = dataTypeFromSignature(data, ownerClass, ownerMethod);
 	if (type == nullptr)
@@ -1116,7 +1116,7 @@ std::unique_ptr<T> DotnetTypeReconstructor::createDataTypeFollowedByType(std::ve
  * @return New data type or @c nullptr in case of failure.
  */
 template <typename T, typename U>
-std::unique_ptr<T> DotnetTypeReconstructor::createGenericReference(std::vector<std::uint8_t>& data, const U* owner)
+std::unique_ptr<T> DotnetTypeReconstructor::createGenericReference(retdec::utils::ByteView& data, const U* owner)
 {
 	if (owner == nullptr)
 		return nullptr;
@@ -1131,7 +1131,7 @@ std::unique_ptr<T> DotnetTypeReconstructor::createGenericReference(std::vector<s
 	if (index >= genericParams.size())
 		return nullptr;
 
-	data.erase(data.begin(), data.begin() + bytesRead);
+	data.removePrefix(bytesRead);
 	return std::make_unique<T>(&genericParams[index]);
 }
 
@@ -1142,7 +1142,7 @@ std::unique_ptr<T> DotnetTypeReconstructor::createGenericReference(std::vector<s
  * @param ownerMethod Owning method.
  * @return New data type or @c nullptr in case of failure.
  */
-std::unique_ptr<DotnetDataTypeGenericInst> DotnetTypeReconstructor::createGenericInstantiation(std::vector<std::uint8_t>& data, const DotnetClass* ownerClass, const DotnetMethod* ownerMethod)
+std::unique_ptr<DotnetDataTypeGenericInst> DotnetTypeReconstructor::createGenericInstantiation(retdec::utils::ByteView& data, const DotnetClass* ownerClass, const DotnetMethod* ownerMethod)
 {
 	if (data.empty())
 		return nullptr;
@@ -1157,7 +1157,7 @@ std::unique_ptr<DotnetDataTypeGenericInst> DotnetTypeReconstructor::createGeneri
 
 	// Number of instantiated generic parameters
 	auto genericCount = data[0];
-	data.erase(data.begin(), data.begin() + 1);
+	data.removePrefix(1);
 
 	// Generic parameters used for instantiation
 	std::vector<std::unique_ptr<DotnetDataTypeBase>> genericTypes;
@@ -1180,7 +1180,7 @@ std::unique_ptr<DotnetDataTypeGenericInst> DotnetTypeReconstructor::createGeneri
  * @param ownerMethod Owning method.
  * @return New data type or @c nullptr in case of failure.
  */
-std::unique_ptr<DotnetDataTypeArray> DotnetTypeReconstructor::createArray(std::vector<std::uint8_t>& data, const DotnetClass* ownerClass, const DotnetMethod* ownerMethod)
+std::unique_ptr<DotnetDataTypeArray> DotnetTypeReconstructor::createArray(retdec::utils::ByteView& data, const DotnetClass* ownerClass, const DotnetMethod* ownerMethod)
 {
 	// First comes data type representing elements in array
 	auto type = dataTypeFromSignature(data, ownerClass, ownerMethod);
@@ -1192,7 +1192,7 @@ std::unique_ptr<DotnetDataTypeArray> DotnetTypeReconstructor::createArray(std::v
 	std::uint64_t rank = decodeUnsigned(data, bytesRead);
 	if (bytesRead == 0)
 		return nullptr;
-	data.erase(data.begin(), data.begin() + bytesRead);
+	data.removePrefix(bytesRead);
 
 	// Rank must be non-zero number
 	if (rank == 0)
@@ -1204,7 +1204,7 @@ std::unique_ptr<DotnetDataTypeArray> DotnetTypeReconstructor::createArray(std::v
 	std::uint64_t numOfSizes = decodeUnsigned(data, bytesRead);
 	if (bytesRead == 0 || numOfSizes > rank)
 		return nullptr;
-	data.erase(data.begin(), data.begin() + bytesRead);
+	data.removePrefix(bytesRead);
 
 	// Now get all those sizes
 	for (std::uint64_t i = 0; i < numOfSizes; ++i)
@@ -1212,14 +1212,14 @@ std::unique_ptr<DotnetDataTypeArray> DotnetTypeReconstructor::createArray(std::v
 		dimensions[i].second = decodeSigned(data, bytesRead);
 		if (bytesRead == 0)
 			return nullptr;
-		data.erase(data.begin(), data.begin() + bytesRead);
+		data.removePrefix(bytesRead);
 	}
 
 	// And some dimensions can also be limited by special lower bound
 	std::size_t numOfLowBounds = decodeUnsigned(data, bytesRead);
 	if (bytesRead == 0 || numOfLowBounds > rank)
 		return nullptr;
-	data.erase(data.begin(), data.begin() + bytesRead);
+	data.removePrefix(bytesRead);
 
 	// Make sure we don't get out of bounds with dimensions
 	numOfLowBounds = std::min(dimensions.size(), numOfLowBounds);
@@ -1228,7 +1228,7 @@ std::unique_ptr<DotnetDataTypeArray> DotnetTypeReconstructor::createArray(std::v
 		dimensions[i].first = decodeSigned(data, bytesRead);
 		if (bytesRead == 0)
 			return nullptr;
-		data.erase(data.begin(), data.begin() + bytesRead);
+		data.removePrefix(bytesRead);
 
 		// Adjust higher bound according to lower bound
 		dimensions[i].second += dimensions[i].first;
@@ -1245,7 +1245,7 @@ std::unique_ptr<DotnetDataTypeArray> DotnetTypeReconstructor::createArray(std::v
  * @return New data type or @c nullptr in case of failure.
  */
 template <typename T>
-std::unique_ptr<T> DotnetTypeReconstructor::createModifier(std::vector<std::uint8_t>& data, const DotnetClass* ownerClass, const DotnetMethod* ownerMethod)
+std::unique_ptr<T> DotnetTypeReconstructor::createModifier(retdec::utils::ByteView& data, const DotnetClass* ownerClass, const DotnetMethod* ownerMethod)
 {
 	// These modifiers are used to somehow specify data type using some data type
 	// The only usage we know about right know is 'volatile' keyword
@@ -1260,7 +1260,7 @@ std::unique_ptr<T> DotnetTypeReconstructor::createModifier(std::vector<std::uint
 	auto modifier = selectClass(typeRef);
 	if (modifier == nullptr)
 		return nullptr;
-	data.erase(data.begin(), data.begin() + bytesRead);
+	data.removePrefix(bytesRead);
 
 	// Go further in signature because we only have modifier, we need to obtain type that is modified
 	auto type = dataTypeFromSignature(data, ownerClass, ownerMethod);
@@ -1277,20 +1277,20 @@ std::unique_ptr<T> DotnetTypeReconstructor::createModifier(std::vector<std::uint
  * @param ownerMethod Owning method.
  * @return New data type or @c nullptr in case of failure.
  */
-std::unique_ptr<DotnetDataTypeFnPtr> DotnetTypeReconstructor::createFnPtr(std::vector<std::uint8_t>& data, const DotnetClass* ownerClass, const DotnetMethod* ownerMethod)
+std::unique_ptr<DotnetDataTypeFnPtr> DotnetTypeReconstructor::createFnPtr(retdec::utils::ByteView& data, const DotnetClass* ownerClass, const DotnetMethod* ownerMethod)
 {
 	if (data.empty())
 		return nullptr;
 
 	// Delete first byte, what does it even mean?
-	data.erase(data.begin(), data.begin() + 1);
+	data.removePrefix(1);
 
 	// Read number of parameters
 	std::uint64_t bytesRead = 0;
 	std::uint64_t paramsCount = decodeUnsigned(data, bytesRead);
 	if (bytesRead == 0)
 		return nullptr;
-	data.erase(data.begin(), data.begin() + bytesRead);
+	data.removePrefix(bytesRead);
 
 	auto returnType = dataTypeFromSignature(data, ownerClass, ownerMethod);
 	if (returnType == nullptr)
@@ -1310,20 +1310,20 @@ std::unique_ptr<DotnetDataTypeFnPtr> DotnetTypeReconstructor::createFnPtr(std::v
 }
 
 /**
- * Creates data type from signature. Signature is destroyed in the meantime.
+ * Creates data type from signature. Decoded bytes are skipped in the signature view.
  * @param signature Signature data.
  * @param ownerClass Owning class.
  * @param ownerMethod Owning method.
  * @return New data type or @c nullptr in case of failure.
  */
-std::unique_ptr<DotnetDataTypeBase> DotnetTypeReconstructor::dataTypeFromSignature(std::vector<std::uint8_t>& signature, const DotnetClass* ownerClass, const DotnetMethod* ownerMethod)
+std::unique_ptr<DotnetDataTypeBase> DotnetTypeReconstructor::dataTypeFromSignature(retdec::utils::ByteView& signature, const DotnetClass* ownerClass, const DotnetMethod* ownerMethod)
 {
 	if (signature.empty())
 		return nullptr;
 
 	std::unique_ptr<DotnetDataTypeBase> result;
 	auto type = static_cast<ElementType>(signature[0]);
-	signature.erase(signature.begin(), signature.begin() + 1);
+	signature.removePrefix(1);
 
 	switch (type)
 	{
@@ -173,9 +173,10 @@ void ExportTable::computeHashes()
 		}
 	}
 
-	expHashCrc32 = getCrc32(expHashBytes.data(), expHashBytes.size());
-	expHashMd5 = getMd5(expHashBytes.data(), expHashBytes.size());
-	expHashSha256 = getSha256(expHashBytes.data(), expHashBytes.size());
+	MultiDigest digest(expHashBytes.data(), expHashBytes.size());
+	expHashCrc32 = digest.getCrc32();
+	expHashMd5 = digest.getMd5();
+	expHashSha256 = digest.getSha256();
 }
 
 /**
@@ -51,9 +51,10 @@ void ElfImportTable::computeHashes()
 		const int show_version = 1;
 		impHashTlsh = tlsh.getHash(show_version);
 
-		impHashCrc32 = getCrc32(data, impHashString.size());
-		impHashMd5 = getMd5(data, impHashString.size());
-		impHashSha256 = getSha256(data, impHashString.size());
+		MultiDigest digest(data, impHashString.size());
+		impHashCrc32 = digest.getCrc32();
+		impHashMd5 = digest.getMd5();
+		impHashSha256 = digest.getSha256();
 	}
 }
 
@@ -286,9 +286,10 @@ void ImportTable::computeHashes()
 		const int show_version = 1;
 		impHashTlsh = tlsh.getHash(show_version);
 
-		impHashCrc32 = getCrc32(data, impHashBytes.size());
-		impHashMd5 = getMd5(data, impHashBytes.size());
-		impHashSha256 = getSha256(data, impHashBytes.size());
+		MultiDigest digest(data, impHashBytes.size());
+		impHashCrc32 = digest.getCrc32();
+		impHashMd5 = digest.getMd5();
+		impHashSha256 = digest.getSha256();
 	}
 }
 
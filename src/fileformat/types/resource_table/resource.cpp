@@ -439,9 +439,10 @@ void Resource::load(const FileFormat *rOwner)
 
 	if (!(rOwner->getLoadFlags() & LoadFlags::NO_VERBOSE_HASHES))
 	{
-		crc32 = retdec::fileformat::getCrc32(origBytes, bytes.size());
-		md5 = retdec::fileformat::getMd5(origBytes, bytes.size());
-		sha256 = retdec::fileformat::getSha256(origBytes, bytes.size());
+		retdec::fileformat::MultiDigest digest(origBytes, bytes.size());
+		crc32 = digest.getCrc32();
+		md5 = digest.getMd5();
+		sha256 = digest.getSha256();
 	}
 }
 
@@ -512,9 +512,10 @@ void ResourceTable::computeIconHashes()
 		return;
 	}
 
-	iconHashCrc32 = getCrc32(iconHashBytes.data(), iconHashBytes.size());
-	iconHashMd5 = getMd5(iconHashBytes.data(), iconHashBytes.size());
-	iconHashSha256 = getSha256(iconHashBytes.data(), iconHashBytes.size());
+	MultiDigest digest(iconHashBytes.data(), iconHashBytes.size());
+	iconHashCrc32 = digest.getCrc32();
+	iconHashMd5 = digest.getMd5();
+	iconHashSha256 = digest.getSha256();
 	iconPerceptualAvgHash = computePerceptualAvgHash(*priorIcon);
 }
 
@@ -23,13 +23,22 @@ namespace fileformat {
 
 /**
  * Compute all supported hashes
+ *
+ * Entropy is computed in the same pass over the data.
  */
 void SecSeg::computeHashes()
 {
 	const auto *hashData = reinterpret_cast<const unsigned char*>(bytes.data());
-	crc32 = retdec::fileformat::getCrc32(hashData, bytes.size());
-	md5 = retdec::fileformat::getMd5(hashData, bytes.size());
-	sha256 = retdec::fileformat::getSha256(hashData, bytes.size());
+	retdec::fileformat::MultiDigest digest(hashData, bytes.size(),
+			MultiDigest::DEFAULT | MultiDigest::ENTROPY);
+	crc32 = digest.getCrc32();
+	md5 = digest.getMd5();
+	sha256 = digest.getSha256();
+	if (hashData && !bytes.empty())
+	{
+		entropy = digest.getEntropy();
+		isEntropyValid = true;
+	}
 }
 
 /**
@@ -523,7 +532,7 @@ void SecSeg::setMemory(bool sMemory)
  */
 void SecSeg::computeEntropy()
 {
-	if (!loaded)
+	if (!loaded || isEntropyValid)
 	{
 		return;
 	}
@@ -580,6 +589,7 @@ void SecSeg::load(const FileFormat *sOwner)
 
 	bytes = StringRef(reinterpret_cast<const char*>(sOwner->getLoadedBytesData() + offset), std::min(fileSize, sOwner->getLoadedFileLength() - offset));
 	loaded = true;
+	isEntropyValid = false;
 
 	if (!(sOwner->getLoadFlags() & LoadFlags::NO_VERBOSE_HASHES))
 	{
@@ -4,6 +4,7 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include "retdec/fileformat/types/sec_seg/sec_seg.h"
 #include "retdec/fileformat/types/strings/string.h"
 
 namespace retdec {
@@ -86,5 +87,103 @@ bool String::operator!=(const String& rhs) const
 	return !(*this == rhs);
 }
 
+StringType StringRecord::getType() const
+{
+	return type;
+}
+
+std::uint64_t StringRecord::getFileOffset() const
+{
+	return fileOffset;
+}
+
+/**
+ * Get length of the string
+ * @return Number of characters
+ */
+std::uint64_t StringRecord::getLength() const
+{
+	return length;
+}
+
+const SecSeg* StringRecord::getSecSeg() const
+{
+	return secSeg;
+}
+
+std::string StringRecord::getSectionName() const
+{
+	return secSeg ? secSeg->getName() : std::string();
+}
+
+/**
+ * Read content of the string from data of its section or segment
+ * @return Printable characters of the string
+ */
+std::string StringRecord::getContent() const
+{
+	if (!secSeg || fileOffset < secSeg->getOffset())
+	{
+		return {};
+	}
+
+	const std::size_t charSize = isWide() ? 2 : 1;
+	const auto data = secSeg->getBytes();
+	const auto first = fileOffset - secSeg->getOffset();
+	if (first + length * charSize > data.size())
+	{
+		return {};
+	}
+
+	std::string content(length, '\0');
+	const auto *charByte = data.data() + first + (bigEndian ? charSize - 1 : 0);
+	for (std::uint64_t i = 0; i < length; ++i, charByte += charSize)
+	{
+		content[i] = *charByte;
+	}
+
+	return content;
+}
+
+/**
+ * Create string which holds its content
+ * @return Materialized string
+ */
+String StringRecord::toString() const
+{
+	return String(type, fileOffset, getSectionName(), getContent());
+}
+
+bool StringRecord::isAscii() const
+{
+	return type == StringType::Ascii;
+}
+
+bool StringRecord::isWide() const
+{
+	return type == StringType::Wide;
+}
+
+/**
+ * Records of strings from the same file data are ordered in the same way as
+ * the materialized strings, content of one of them is then prefix of the other.
+ */
+bool StringRecord::operator<(const StringRecord& rhs) const
+{
+	return (fileOffset < rhs.fileOffset)
+		|| (fileOffset == rhs.fileOffset && type < rhs.type)
+		|| (fileOffset == rhs.fileOffset && type == rhs.type && length < rhs.length);
+}
+
+bool StringRecord::operator==(const StringRecord& rhs) const
+{
+	return (fileOffset == rhs.fileOffset) && (type == rhs.type) && (length == rhs.length);
+}
+
+bool StringRecord::operator!=(const StringRecord& rhs) const
+{
+	return !(*this == rhs);
+}
+
 } // namespace fileformat
 } // namespace retdec
@@ -0,0 +1,216 @@
+/**
+ * @file src/fileformat/types/strings/string_scanner.cpp
+ * @brief Detection of strings in raw data.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define RETDEC_STRING_SCANNER_SSE2
+#endif
+
+#include <llvm/Support/MathExtras.h>
+
+#include "retdec/fileformat/types/strings/string_scanner.h"
+
+namespace retdec {
+namespace fileformat {
+
+namespace
+{
+
+/// Number of bytes classified at once, one bit of mask per byte
+const std::size_t BlockSize = 64;
+
+/// Mask of even positions in a block
+const std::uint64_t EvenPositions = 0x5555555555555555ULL;
+
+/**
+ * Classes of bytes of one block, bit @c i describes byte @c i
+ */
+struct ByteClasses
+{
+	std::uint64_t printable = 0; ///< byte is printable ASCII character
+	std::uint64_t zero = 0;      ///< byte is zero
+};
+
+/**
+ * Classify bytes of one block
+ * @param data Start of the block
+ * @param size Number of bytes in the block, at most @c BlockSize
+ */
+ByteClasses classifyBlock(const std::uint8_t *data, std::size_t size)
+{
+	ByteClasses result;
+	std::size_t i = 0;
+
+#ifdef RETDEC_STRING_SCANNER_SSE2
+	// Printable characters 0x20-0x7e are moved to 0x80-0xde, which are exactly
+	// the signed bytes lower than 0xdf.
+	const auto shift = _mm_set1_epi8(0x60);
+	const auto limit = _mm_set1_epi8(static_cast<char>(0xdf));
+	const auto zero = _mm_setzero_si128();
+	for (; i + 16 <= size; i += 16)
+	{
+		const auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+		const auto printable = _mm_cmplt_epi8(_mm_add_epi8(bytes, shift), limit);
+		result.printable |= static_cast<std::uint64_t>(_mm_movemask_epi8(printable)) << i;
+		result.zero |= static_cast<std::uint64_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, zero))) << i;
+	}
+#endif
+
+	for (; i < size; ++i)
+	{
+		result.printable |= static_cast<std::uint64_t>(data[i] - 0x20U < 0x5fU) << i;
+		result.zero |= static_cast<std::uint64_t>(data[i] == 0) << i;
+	}
+
+	return result;
+}
+
+/**
+ * Finds runs of valid characters in the stream of blocks
+ *
+ * Valid character is described by the bit at the position of its first byte.
+ * Character is @c charSize bytes long. When run of characters ends, scanning
+ * continues right after it, otherwise it continues with the next byte.
+ */
+class RunFinder
+{
+	private:
+		std::size_t charSize;
+		std::size_t minLength;
+		StringType type;
+		const StringScanCallback &callback;
+		bool inRun = false;      ///< @c true if current position is in run
+		std::size_t runStart = 0;
+		std::size_t position = 0; ///< next position to check
+
+		void endRun(std::size_t end)
+		{
+			const auto length = (end - runStart) / charSize;
+			if (length >= minLength)
+			{
+				callback(runStart, length, type);
+			}
+			inRun = false;
+			position = end;
+		}
+
+	public:
+		RunFinder(std::size_t charSize, std::size_t minLength, StringType type, const StringScanCallback &callback)
+			: charSize(charSize), minLength(minLength), type(type), callback(callback) {}
+
+		/**
+		 * Process one block
+		 * @param valid Mask of positions of valid characters
+		 * @param base Offset of the block
+		 * @param size Number of bytes in the block
+		 */
+		void feed(std::uint64_t valid, std::size_t base, std::size_t size)
+		{
+			const auto inBlock = size == BlockSize ? ~0ULL : (1ULL << size) - 1;
+			while (position < base + size)
+			{
+				const auto fromPosition = inBlock & (~0ULL << (position - base));
+				if (inRun)
+				{
+					// Only positions of characters following the first one
+					auto continuations = charSize == 1 ? ~0ULL : (runStart & 1 ? ~EvenPositions : EvenPositions);
+					auto ends = ~valid & continuations & fromPosition;
+					if (!ends)
+					{
+						position = base + size + ((base + size - runStart) % charSize);
+						return;
+					}
+					endRun(base + llvm::countTrailingZeros(ends));
+				}
+				else
+				{
+					auto starts = valid & fromPosition;
+					if (!starts)
+					{
+						position = base + size;
+						return;
+					}
+					runStart = position = base + llvm::countTrailingZeros(starts);
+					inRun = true;
+				}
+			}
+		}
+
+		/**
+		 * Finish the run at the end of data
+		 * @param size Size of data
+		 */
+		void finish(std::size_t size)
+		{
+			if (inRun)
+			{
+				endRun(std::min(position, size));
+			}
+		}
+};
+
+} // anonymous namespace
+
+/**
+ * Find ASCII and wide strings in @a data in one pass
+ * @param data Data to scan
+ * @param size Size of @a data
+ * @param endian Endianness of wide characters
+ * @param minLength Minimal number of characters of reported string
+ * @param callback Called for each found string, strings of the same type are
+ *    reported in order of their offsets
+ *
+ * ASCII string is a run of printable characters. Wide string is a run of
+ * two-byte characters with one printable and one zero byte.
+ */
+void scanStrings(
+		const std::uint8_t *data,
+		std::size_t size,
+		CharacterEndianness endian,
+		std::size_t minLength,
+		const StringScanCallback &callback)
+{
+	if (!data || !size)
+	{
+		return;
+	}
+
+	RunFinder ascii(1, minLength, StringType::Ascii, callback);
+	RunFinder wide(2, minLength, StringType::Wide, callback);
+
+	auto current = classifyBlock(data, std::min(size, BlockSize));
+	for (std::size_t base = 0; base < size; base += BlockSize)
+	{
+		const auto blockSize = std::min(size - base, BlockSize);
+		const auto nextBase = base + BlockSize;
+		const auto next = nextBase < size
+				? classifyBlock(data + nextBase, std::min(size - nextBase, BlockSize))
+				: ByteClasses();
+
+		// Wide character needs its second byte, which may be in the next block
+		std::uint64_t wideValid = 0;
+		if (endian == CharacterEndianness::Little)
+		{
+			wideValid = current.printable & ((current.zero >> 1) | (next.zero << (BlockSize - 1)));
+		}
+		else
+		{
+			wideValid = current.zero & ((current.printable >> 1) | (next.printable << (BlockSize - 1)));
+		}
+
+		ascii.feed(current.printable, base, blockSize);
+		wide.feed(wideValid, base, blockSize);
+		current = next;
+	}
+
+	ascii.finish(size);
+	wide.finish(size);
+}
+
+} // namespace fileformat
+} // namespace retdec
@@ -684,9 +684,10 @@ void VisualBasicInfo::computeExternTableHashes()
 		}
 	}
 
-	externTableHashCrc32 = getCrc32(hashBytes.data(), hashBytes.size());
-	externTableHashMd5 = getMd5(hashBytes.data(), hashBytes.size());
-	externTableHashSha256 = getSha256(hashBytes.data(), hashBytes.size());
+	MultiDigest digest(hashBytes.data(), hashBytes.size());
+	externTableHashCrc32 = digest.getCrc32();
+	externTableHashMd5 = digest.getMd5();
+	externTableHashSha256 = digest.getSha256();
 }
 
 /**
@@ -726,9 +727,10 @@ void VisualBasicInfo::computeObjectTableHashes()
 		}
 	}
 
-	objectTableHashCrc32 = getCrc32(hashBytes.data(), hashBytes.size());
-	objectTableHashMd5 = getMd5(hashBytes.data(), hashBytes.size());
-	objectTableHashSha256 = getSha256(hashBytes.data(), hashBytes.size());
+	MultiDigest digest(hashBytes.data(), hashBytes.size());
+	objectTableHashCrc32 = digest.getCrc32();
+	objectTableHashMd5 = digest.getMd5();
+	objectTableHashSha256 = digest.getSha256();
 }
 
 /**
@@ -4,6 +4,8 @@
  * @copyright (c) 2020 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
+#include <array>
 #include <climits>
 #include <cmath>
 #include <vector>
@@ -18,6 +20,219 @@
 namespace retdec {
 namespace fileformat {
 
+namespace
+{
+
+/// Number of bytes passed to all digests before moving to the next block
+const std::uint64_t DigestBlockSize = 0x10000;
+
+std::string digestToString(const unsigned char *digest, std::size_t length)
+{
+	std::string result;
+	retdec::utils::bytesToHexString(digest, length, result, 0, 0, false);
+	return result;
+}
+
+} // anonymous namespace
+
+/**
+ * Contexts of digests computed by @c MultiDigest
+ */
+struct MultiDigest::State
+{
+	retdec::utils::CRC32 crc32;
+	MD5_CTX md5;
+	SHA_CTX sha1;
+	SHA256_CTX sha256;
+	std::array<std::uint64_t, 256> histogram{};
+	std::uint64_t length = 0;
+	bool finished = false;
+
+	std::string crc32Digest;
+	std::string md5Digest;
+	std::string sha1Digest;
+	std::string sha256Digest;
+	double entropy = 0.0;
+};
+
+/**
+ * Constructor
+ * @param digests Digests to compute, combination of @c Digest values
+ */
+MultiDigest::MultiDigest(unsigned digests) : state(std::make_unique<State>()), selected(digests)
+{
+	if (selected & MD5)
+	{
+		MD5_Init(&state->md5);
+	}
+	if (selected & SHA1)
+	{
+		SHA1_Init(&state->sha1);
+	}
+	if (selected & SHA256)
+	{
+		SHA256_Init(&state->sha256);
+	}
+}
+
+/**
+ * Constructor which computes digests of @a data
+ * @param data Input data
+ * @param length Length of input data
+ * @param digests Digests to compute, combination of @c Digest values
+ */
+MultiDigest::MultiDigest(const unsigned char *data, std::uint64_t length, unsigned digests) : MultiDigest(digests)
+{
+	add(data, length);
+}
+
+/**
+ * Destructor
+ */
+MultiDigest::~MultiDigest() = default;
+
+/**
+ * Add data to all selected digests
+ * @param data Input data
+ * @param length Length of input data
+ *
+ * Data added after the digests were finished are ignored.
+ */
+void MultiDigest::add(const unsigned char *data, std::uint64_t length)
+{
+	if (!data || state->finished)
+	{
+		return;
+	}
+
+	state->length += length;
+	for (std::uint64_t offset = 0; offset < length; offset += DigestBlockSize)
+	{
+		const auto *block = data + offset;
+		const auto blockSize = std::min(DigestBlockSize, length - offset);
+
+		if (selected & CRC32)
+		{
+			state->crc32.add(block, blockSize);
+		}
+		if (selected & MD5)
+		{
+			MD5_Update(&state->md5, block, blockSize);
+		}
+		if (selected & SHA1)
+		{
+			SHA1_Update(&state->sha1, block, blockSize);
+		}
+		if (selected & SHA256)
+		{
+			SHA256_Update(&state->sha256, block, blockSize);
+		}
+		if (selected & ENTROPY)
+		{
+			for (std::uint64_t i = 0; i < blockSize; ++i)
+			{
+				state->histogram[block[i]]++;
+			}
+		}
+	}
+}
+
+/**
+ * Finish all selected digests
+ */
+void MultiDigest::finish()
+{
+	if (state->finished)
+	{
+		return;
+	}
+
+	state->finished = true;
+	if (selected & CRC32)
+	{
+		state->crc32Digest = state->crc32.getHash();
+	}
+	if (selected & MD5)
+	{
+		unsigned char digest[MD5_DIGEST_LENGTH];
+		MD5_Final(digest, &state->md5);
+		state->md5Digest = digestToString(digest, MD5_DIGEST_LENGTH);
+	}
+	if (selected & SHA1)
+	{
+		unsigned char digest[SHA_DIGEST_LENGTH];
+		SHA1_Final(digest, &state->sha1);
+		state->sha1Digest = digestToString(digest, SHA_DIGEST_LENGTH);
+	}
+	if (selected & SHA256)
+	{
+		unsigned char digest[SHA256_DIGEST_LENGTH];
+		SHA256_Final(digest, &state->sha256);
+		state->sha256Digest = digestToString(digest, SHA256_DIGEST_LENGTH);
+	}
+	if ((selected & ENTROPY) && state->length)
+	{
+		for (auto frequency : state->histogram)
+		{
+			if (frequency)
+			{
+				double probability = static_cast<double>(frequency) / state->length;
+				state->entropy -= probability * std::log2(probability);
+			}
+		}
+	}
+}
+
+/**
+ * Get CRC32 of added data
+ * @return CRC32 or empty string if it was not selected
+ */
+std::string MultiDigest::getCrc32()
+{
+	finish();
+	return state->crc32Digest;
+}
+
+/**
+ * Get MD5 of added data
+ * @return MD5 or empty string if it was not selected
+ */
+std::string MultiDigest::getMd5()
+{
+	finish();
+	return state->md5Digest;
+}
+
+/**
+ * Get SHA1 of added data
+ * @return SHA1 or empty string if it was not selected
+ */
+std::string MultiDigest::getSha1()
+{
+	finish();
+	return state->sha1Digest;
+}
+
+/**
+ * Get SHA256 of added data
+ * @return SHA256 or empty string if it was not selected
+ */
+std::string MultiDigest::getSha256()
+{
+	finish();
+	return state->sha256Digest;
+}
+
+/**
+ * Get entropy of added data
+ * @return Entropy in <0,8> or @c 0 if it was not selected
+ */
+double MultiDigest::getEntropy()
+{
+	finish();
+	return state->entropy;
+}
+
 /**
  * @brief Count CRC32 of @a data.
  * @param[in] data Input data.
@@ -3855,7 +3855,7 @@ void FileInformation::setResourceTable(const retdec::fileformat::ResourceTable *
  * Set pointer to detected strings
  * @param sStrings Pointer to detected strings
  */
-void FileInformation::setStrings(const std::vector<retdec::fileformat::String> *sStrings)
+void FileInformation::setStrings(const std::vector<retdec::fileformat::StringRecord> *sStrings)
 {
 	strings.setStrings(sStrings);
 }
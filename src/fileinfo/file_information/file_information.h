@@ -566,7 +566,7 @@ class FileInformation
 		void setImportTable(const retdec::fileformat::ImportTable *sTable);
 		void setExportTable(const retdec::fileformat::ExportTable *sTable);
 		void setResourceTable(const retdec::fileformat::ResourceTable *sTable);
-		void setStrings(const std::vector<retdec::fileformat::String> *sStrings);
+		void setStrings(const std::vector<retdec::fileformat::StringRecord> *sStrings);
 		void setCertificateTable(const retdec::fileformat::CertificateTable *sTable);
 		void setTlsInfo(const retdec::fileformat::TlsInfo *info);
 		void setSignatureVerified(bool verified);
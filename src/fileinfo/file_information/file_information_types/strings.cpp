@@ -49,7 +49,7 @@ std::string Strings::getStringContent(std::size_t index) const
 	return strings->at(index).getContent();
 }
 
-void Strings::setStrings(const std::vector<retdec::fileformat::String> *detectedStrings)
+void Strings::setStrings(const std::vector<retdec::fileformat::StringRecord> *detectedStrings)
 {
 	strings = detectedStrings;
 }
@@ -20,7 +20,7 @@ namespace fileinfo {
 class Strings
 {
 	private:
-		const std::vector<retdec::fileformat::String>* strings = nullptr;
+		const std::vector<retdec::fileformat::StringRecord>* strings = nullptr;
 	public:
 		/// @name Getters
 		/// @{
@@ -33,7 +33,7 @@ class Strings
 
 		/// @name Setters
 		/// @{
-		void setStrings(const std::vector<retdec::fileformat::String> *detectedStrings);
+		void setStrings(const std::vector<retdec::fileformat::StringRecord> *detectedStrings);
 		/// @}
 
 		/// @name Other methods
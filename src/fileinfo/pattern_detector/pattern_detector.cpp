@@ -4,13 +4,16 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <map>
+#include <memory>
 #include <regex>
 
 #include "retdec/utils/conversion.h"
 #include "retdec/utils/filesystem.h"
 #include "retdec/utils/string.h"
 #include "fileinfo/pattern_detector/pattern_detector.h"
-#include "retdec/yaracpp/yara_detector.h"
+#include "retdec/yaracpp/yara_rules_cache.h"
+#include "retdec/yaracpp/yara_scanner.h"
 
 using namespace retdec::utils;
 using namespace retdec::yaracpp;
@@ -18,6 +21,94 @@ using namespace retdec::yaracpp;
 namespace retdec {
 namespace fileinfo {
 
+namespace
+{
+
+/**
+ * Rules of one category of patterns and their scanners
+ */
+struct CategoryScanners
+{
+	std::vector<YaraRulesCache::Rules> rules;
+	std::vector<std::unique_ptr<YaraScanner>> scanners;
+};
+
+/**
+ * Get rules from the given rule files. All text files are compiled into
+ * one rule set, each precompiled file has its own rule set.
+ * @param ruleFiles Paths to rule files
+ * @return Rules from the given files
+ */
+std::vector<YaraRulesCache::Rules> getRules(const std::set<std::string> &ruleFiles)
+{
+	std::vector<YaraRulesCache::Rules> rules;
+	std::vector<std::string> textFiles;
+	for(const auto &item : ruleFiles)
+	{
+		if(auto precompiled = YaraRulesCache::getPrecompiledRules(item))
+		{
+			rules.push_back(precompiled);
+		}
+		else
+		{
+			textFiles.push_back(item);
+		}
+	}
+
+	if(textFiles.empty())
+	{
+		return rules;
+	}
+
+	if(auto compiled = YaraRulesCache::getRules(textFiles))
+	{
+		rules.push_back(compiled);
+	}
+	else
+	{
+		// Some of the files cannot be compiled, use at least the others.
+		for(const auto &item : textFiles)
+		{
+			if(auto compiled = YaraRulesCache::getRules(item))
+			{
+				rules.push_back(compiled);
+			}
+		}
+	}
+
+	return rules;
+}
+
+/**
+ * Get scanners of the given rule files
+ * @param ruleFiles Paths to rule files of one category
+ * @return Scanners of all rules from the given files
+ *
+ * Rules are compiled only once per process (see YaraRulesCache) and scanners
+ * are created only once per thread, so they are reused for all the analyzed
+ * files. Scanners are created again only if any of the rule files changes.
+ */
+const std::vector<std::unique_ptr<YaraScanner>>& getScanners(const std::set<std::string> &ruleFiles)
+{
+	thread_local std::map<std::set<std::string>, CategoryScanners> cache;
+
+	auto rules = getRules(ruleFiles);
+	auto &category = cache[ruleFiles];
+	if(category.rules != rules)
+	{
+		category.scanners.clear();
+		for(const auto &item : rules)
+		{
+			category.scanners.push_back(std::make_unique<YaraScanner>(item));
+		}
+		category.rules = std::move(rules);
+	}
+
+	return category.scanners;
+}
+
+} // anonymous namespace
+
 /**
  * Constructor
  * @param fparser Pointer to file parser
@@ -338,28 +429,27 @@ void PatternDetector::analyze()
 {
 	for(const auto &category : categories)
 	{
-		YaraDetector yara;
-
-		for(const auto &item : category.second)
+		for(const auto &yara : getScanners(category.second))
 		{
-			yara.addRuleFile(item);
-		}
-
-		yara.analyze(fileinfo.getPathToFile());
-
-		for(const auto &rule : yara.getDetectedRules())
-		{
-			if(category.first == "crypto")
-			{
-				saveCryptoRule(rule);
-			}
-			else if(category.first == "malware")
+			if(!yara->scanFile(fileinfo.getPathToFile()))
 			{
-				saveMalwareRule(rule);
+				continue;
 			}
-			else
+
+			for(const auto &rule : yara->getDetectedRules())
 			{
-				saveOtherRule(rule);
+				if(category.first == "crypto")
+				{
+					saveCryptoRule(rule);
+				}
+				else if(category.first == "malware")
+				{
+					saveMalwareRule(rule);
+				}
+				else
+				{
+					saveOtherRule(rule);
+				}
 			}
 		}
 	}
@@ -4,9 +4,10 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <numeric>
+
 #include "retdec/llvmir2hll/analysis/def_use_analysis.h"
 #include "retdec/llvmir2hll/analysis/value_analysis.h"
-#include "retdec/llvmir2hll/analysis/var_uses_visitor.h"
 #include "retdec/llvmir2hll/graphs/cfg/cfg_builders/recursive_cfg_builder.h"
 #include "retdec/llvmir2hll/ir/function.h"
 #include "retdec/llvmir2hll/ir/module.h"
@@ -15,7 +16,6 @@
 #include "retdec/llvmir2hll/support/debug.h"
 #include "retdec/utils/container.h"
 
-using retdec::utils::addToSet;
 using retdec::utils::hasItem;
 
 namespace retdec {
@@ -23,46 +23,52 @@ namespace llvmir2hll {
 
 namespace {
 
-/// Set of nodes in a CFG.
-using NodeSet = std::set<ShPtr<CFG::Node>>;
-
 /// Order of nodes in a CFG.
 using NodeOrder = std::vector<ShPtr<CFG::Node>>;
 
 } // anonymous namespace
 
+/**
+* @brief Returns the index of the given node in @c nodeIndexes.
+*
+* @par Preconditions
+*  - @a node is a node of @c cfg
+*/
+std::size_t DefUseChains::getNodeIndex(ShPtr<CFG::Node> node) const {
+	auto i = nodeIndexes.find(node);
+	PRECONDITION(i != nodeIndexes.end(), "node " << node->getLabel()
+		<< " is not in the CFG");
+	return i->second;
+}
+
 /**
 * @brief Emits all the live variables info to standard error.
 *
 * Only for debugging purposes.
 */
 void DefUseChains::debugPrint() {
+	auto printUses = [this](const std::string &name, const UseSet &useSet) {
+		llvm::errs() << "    " << name << ": \n";
+		for (auto i = useSet.find_first(); i != -1; i = useSet.find_next(i)) {
+			llvm::errs() << "      (" << uses[i].first << ", "
+				<< uses[i].second->getName() << ")\n";
+		}
+	};
+
 	llvm::errs() << "[DefUseChains] Debug info for function '" << func->getName() << "':\n";
 	llvm::errs() << "\n";
 	llvm::errs() << "Out, in, gen, and kill sets:\n";
 	llvm::errs() << "----------------------------\n";
 	for (auto i = cfg->node_begin(), e = cfg->node_end(); i != e; ++i) {
+		auto n = getNodeIndex(*i);
 		llvm::errs() << "  " << (*i)->getLabel() << ":\n";
-		llvm::errs() << "    kill: \n";
-		for (auto j = kill[*i].begin(), f = kill[*i].end(); j != f; ++j) {
-			llvm::errs() << "      (" << j->first << ", "
-				<< j->second->getName() << ")\n";
-		}
-		llvm::errs() << "\n    gen: \n";
-		for (auto j = gen[*i].begin(), f = gen[*i].end(); j != f; ++j) {
-			llvm::errs() << "      (" << j->first << ", "
-				<< j->second->getName() << ")\n";
-		}
-		llvm::errs() << "\n    in: \n";
-		for (auto j = in[*i].begin(), f = in[*i].end(); j != f; ++j) {
-			llvm::errs() << "      (" << j->first << ", "
-				<< j->second->getName() << ")\n";
-		}
-		llvm::errs() << "\n    out: \n";
-		for (auto j = out[*i].begin(), f = out[*i].end(); j != f; ++j) {
-			llvm::errs() << "      (" << j->first << ", "
-				<< j->second->getName() << ")\n";
-		}
+		printUses("kill", kill[n]);
+		llvm::errs() << "\n";
+		printUses("gen", gen[n]);
+		llvm::errs() << "\n";
+		printUses("in", in[n]);
+		llvm::errs() << "\n";
+		printUses("out", out[n]);
 		llvm::errs() << "\n\n";
 	}
 	llvm::errs() << "Def-use chains:\n";
@@ -85,14 +91,8 @@ void DefUseChains::debugPrint() {
 * See create() for the description of the parameters.
 */
 DefUseAnalysis::DefUseAnalysis(ShPtr<Module> module,
-		ShPtr<ValueAnalysis> va, ShPtr<VarUsesVisitor> vuv):
-		module(module), va(va), vuv(vuv),
-		cfgBuilder(RecursiveCFGBuilder::create()) {
-	// If we don't have a visitor for obtaining uses of variables, create one.
-	if (!this->vuv) {
-		this->vuv = VarUsesVisitor::create(this->va);
-	}
-}
+		ShPtr<ValueAnalysis> va):
+		module(module), va(va), cfgBuilder(RecursiveCFGBuilder::create()) {}
 
 /**
 * @brief Returns def-use chains for the given function.
@@ -118,6 +118,7 @@ ShPtr<DefUseChains> DefUseAnalysis::getDefUseChains(
 		ducs->cfg = cfgBuilder->getCFG(func);
 	}
 
+	computeUses(ducs);
 	computeGenAndKill(ducs);
 	computeInAndOut(ducs);
 	computeDefUseChains(ducs);
@@ -130,9 +131,6 @@ ShPtr<DefUseChains> DefUseAnalysis::getDefUseChains(
 *
 * @param[in] module Module for which the analysis is created.
 * @param[in] va The used analysis of values.
-* @param[in] vuv The used visitor for obtaining uses of variables.
-*
-* If @a vuv is not provided, a new visitor is created.
 *
 * @par Preconditions
 *  - @a va is in a valid state
@@ -140,22 +138,95 @@ ShPtr<DefUseChains> DefUseAnalysis::getDefUseChains(
 * All methods of this class leave @a va in a valid state.
 */
 ShPtr<DefUseAnalysis> DefUseAnalysis::create(ShPtr<Module> module,
-		ShPtr<ValueAnalysis> va, ShPtr<VarUsesVisitor> vuv) {
+		ShPtr<ValueAnalysis> va) {
 	PRECONDITION(va->isInValidState(), "it is not in a valid state");
 
-	return ShPtr<DefUseAnalysis>(new DefUseAnalysis(module, va, vuv));
+	return ShPtr<DefUseAnalysis>(new DefUseAnalysis(module, va));
 }
 
 /**
-* @brief Computes the @c GEN[B] and @c KILL[B] sets for each CFG node @c B.
+* @brief Numbers the nodes of the CFG, the uses @c (s, x) in them, and the used
+*        variables.
 *
 * This function modifies @a ducs.
 */
+void DefUseAnalysis::computeUses(ShPtr<DefUseChains> ducs) {
+	ducs->uses.clear();
+	ducs->vars.clear();
+	ducs->varIndexes.clear();
+	ducs->nodeIndexes.clear();
+
+	// Variables that should not be included (to ask about every variable only
+	// once).
+	VarSet excludedVars;
+
+	// Index of the variable of every use.
+	std::vector<std::size_t> useVars;
+
+	// For each statement in each node...
+	for (auto i = ducs->cfg->node_begin(), e = ducs->cfg->node_end();
+			i != e; ++i) {
+		ducs->nodeIndexes.emplace(*i, ducs->nodeIndexes.size());
+		for (auto j = (*i)->stmt_begin(), f = (*i)->stmt_end(); j != f; ++j) {
+			const auto &stmtData = va->getValueData(*j);
+			for (auto k = stmtData->dir_read_begin(),
+					g = stmtData->dir_read_end(); k != g; ++k) {
+				auto varIndex = ducs->varIndexes.find(*k);
+				if (varIndex == ducs->varIndexes.end()) {
+					if (hasItem(excludedVars, *k)) {
+						continue;
+					}
+					if (!ducs->shouldBeIncluded(*k)) {
+						excludedVars.insert(*k);
+						continue;
+					}
+					varIndex = ducs->varIndexes.emplace(*k,
+						ducs->vars.size()).first;
+					ducs->vars.push_back(*k);
+				}
+				ducs->uses.emplace_back(*j, *k);
+				useVars.push_back(varIndex->second);
+			}
+		}
+	}
+
+	// Group the uses by their variables (a counting sort, so the uses of every
+	// variable remain ascending).
+	ducs->varUsesBegins.assign(ducs->vars.size() + 1, 0);
+	for (auto var : useVars) {
+		++ducs->varUsesBegins[var + 1];
+	}
+	std::partial_sum(ducs->varUsesBegins.begin(), ducs->varUsesBegins.end(),
+		ducs->varUsesBegins.begin());
+	std::vector<std::size_t> next(ducs->varUsesBegins.begin(),
+		ducs->varUsesBegins.end() - 1);
+	ducs->varUses.resize(useVars.size());
+	for (std::size_t use = 0; use < useVars.size(); ++use) {
+		ducs->varUses[next[useVars[use]]++] = use;
+	}
+}
+
+/**
+* @brief Computes the @c GEN[B] and @c KILL[B] sets for each CFG node @c B.
+*
+* computeUses() has to be run before this function. This function modifies
+* @a ducs.
+*/
 void DefUseAnalysis::computeGenAndKill(ShPtr<DefUseChains> ducs) {
+	auto numOfNodes = ducs->cfg->getNumberOfNodes();
+	auto numOfUses = ducs->uses.size();
+	ducs->gen.assign(numOfNodes, DefUseChains::UseSet(numOfUses));
+	ducs->kill.assign(numOfNodes, DefUseChains::UseSet(numOfUses));
+
+	// The uses are numbered in the order of nodes, so the uses of every node
+	// start where the uses of the previous node end.
+	std::size_t firstUse = 0;
+	llvm::BitVector isDefined(ducs->vars.size());
+
 	// For each node B...
 	for (auto i = ducs->cfg->node_begin(), e = ducs->cfg->node_end();
 			i != e; ++i) {
-		computeGenAndKillForNode(ducs, *i);
+		computeGenAndKillForNode(ducs, *i, firstUse, isDefined);
 	}
 }
 
@@ -163,21 +234,27 @@ void DefUseAnalysis::computeGenAndKill(ShPtr<DefUseChains> ducs) {
 * @brief Computes the @c GEN[B] and @c KILL[B] sets for the given CFG node @a
 *        node @c B.
 *
+* @param[in] ducs Information about def-use chains.
+* @param[in] node Currently processed node.
+* @param[in,out] firstUse Index of the first use in @a node. It is set to the
+*                         index of the first use after @a node.
+* @param[in,out] isDefined Empty set of indexes of variables, it is used to
+*                          compute the defined variables in @a node and it is
+*                          emptied again at the end.
+*
 * This function modifies @a ducs.
 */
 void DefUseAnalysis::computeGenAndKillForNode(ShPtr<DefUseChains> ducs,
-	ShPtr<CFG::Node> node) {
-
+		ShPtr<CFG::Node> node, std::size_t &firstUse,
+		llvm::BitVector &isDefined) {
 	// Aliases to speed up the computation.
-	auto &gen = ducs->gen[node];
-	auto &kill = ducs->kill[node];
-
-	// Initialization.
-	gen.clear();
-	kill.clear();
+	auto n = ducs->getNodeIndex(node);
+	auto &gen = ducs->gen[n];
+	auto &kill = ducs->kill[n];
+	const auto &uses = ducs->uses;
 
 	// Defined variables in the node (regularly updated).
-	VarSet defVars;
+	std::vector<std::size_t> defVars;
 
 	//
 	// Compute GEN[node].
@@ -185,23 +262,25 @@ void DefUseAnalysis::computeGenAndKillForNode(ShPtr<DefUseChains> ducs,
 
 	// For each statement in the node...
 	for (auto i = node->stmt_begin(), e = node->stmt_end(); i != e; ++i) {
-		// Compute read/written variables in the current statement.
-		const auto &stmtData = va->getValueData(*i);
-
 		// Compute GEN[node] for the current statement.
-		for (auto j = stmtData->dir_read_begin(), f = stmtData->dir_read_end();
-				j != f; ++j) {
-			if (!hasItem(defVars, *j) && ducs->shouldBeIncluded(*j)) {
-				gen.emplace(*i, *j);
+		for (; firstUse < uses.size() && uses[firstUse].first == *i;
+				++firstUse) {
+			auto var = ducs->varIndexes.find(uses[firstUse].second)->second;
+			if (!isDefined.test(var)) {
+				gen.set(firstUse);
 			}
 		}
 
 		// Update the set of defined variables that the present statement
-		// defines.
+		// defines. Variables without uses are not numbered and they can be
+		// skipped because there is nothing to generate or kill for them.
+		const auto &stmtData = va->getValueData(*i);
 		for (auto j = stmtData->dir_written_begin(), f = stmtData->dir_written_end();
 				j != f; ++j) {
-			if (ducs->shouldBeIncluded(*j)) {
-				defVars.insert(*j);
+			auto var = ducs->varIndexes.find(*j);
+			if (var != ducs->varIndexes.end() && !isDefined.test(var->second)) {
+				isDefined.set(var->second);
+				defVars.push_back(var->second);
 			}
 		}
 	}
@@ -210,22 +289,14 @@ void DefUseAnalysis::computeGenAndKillForNode(ShPtr<DefUseChains> ducs,
 	// Compute KILL[node].
 	//
 
-	// For each defined variable in the node...
-	for (const auto &defVar : defVars) {
-		// Get all statements where the current variable is used.
-		const auto &varUses = vuv->getUses(defVar, ducs->func)->dirUses;
-
-		// Insert to KILL[node] such statements from varUses that are not in
-		// the node.
-		for (const auto &varUse : varUses) {
-			// Consider only uses which are "read" uses, not "write" uses.
-			const auto &readVarsInVarUse = va->getValueData(varUse)->getDirReadVars();
-			if (!hasItem(readVarsInVarUse, defVar)) {
-				continue;
-			}
-
-			kill.emplace(varUse, defVar);
+	// For each defined variable in the node, insert all statements where the
+	// variable is read to KILL[node].
+	for (auto var : defVars) {
+		for (auto j = ducs->varUsesBegins[var], f = ducs->varUsesBegins[var + 1];
+				j < f; ++j) {
+			kill.set(ducs->varUses[j]);
 		}
+		isDefined.reset(var);
 	}
 }
 
@@ -250,12 +321,10 @@ void DefUseAnalysis::computeInAndOut(ShPtr<DefUseChains> ducs) {
 	NodeOrder order;
 	order.reserve(ducs->cfg->getNumberOfNodes());
 	order.push_back(ducs->cfg->getEntryNode());
-	// To check whether a node has already been added to the order, we use a
-	// set. The reason is that a vector searches in O(n) while a set searches
-	// in O(log(n)).
-	// Note: Using unordered_set instead of a set doesn't speed up the
-	//       computation, so we use just set.
-	NodeSet orderSet(order.begin(), order.end());
+	// To check whether a node has already been added to the order, we mark
+	// the indexes of nodes in the order.
+	std::vector<bool> isInOrder(ducs->cfg->getNumberOfNodes(), false);
+	isInOrder[ducs->getNodeIndex(order.front())] = true;
 	// We will keep iterating until we add all non-exit nodes to the order.
 	do {
 		// For every node in the order...
@@ -270,11 +339,12 @@ void DefUseAnalysis::computeInAndOut(ShPtr<DefUseChains> ducs) {
 			// For every predecessor of this node...
 			for (auto j = node->succ_begin(), f = node->succ_end(); j != f; ++j) {
 				const auto &pred = (*j)->getDst();
+				auto predIndex = ducs->getNodeIndex(pred);
 				// Do not include the node if it is either already present in
 				// the order or it is the exit node.
-				if (!hasItem(orderSet, pred) && pred != ducs->cfg->getExitNode()) {
+				if (!isInOrder[predIndex] && pred != ducs->cfg->getExitNode()) {
 					order.push_back(pred);
-					orderSet.insert(pred);
+					isInOrder[predIndex] = true;
 				}
 			}
 		}
@@ -284,15 +354,22 @@ void DefUseAnalysis::computeInAndOut(ShPtr<DefUseChains> ducs) {
 	//
 	// Initialize the analysis.
 	//
-	ducs->in.clear();
-	ducs->out.clear();
-	// Normally, we would have to set IN[B] = \emptyset for each node B.
-	// However, since ducs->in[B] gets initialized to an empty set
-	// automatically upon first access, we don't have to do it.
+	// OUT[B] = \emptyset, so IN[B] = GEN[B] for each node B (except the exit
+	// node, for which IN is not computed).
+	auto numOfUses = ducs->uses.size();
+	ducs->out.assign(ducs->cfg->getNumberOfNodes(),
+		DefUseChains::UseSet(numOfUses));
+	ducs->in.assign(ducs->cfg->getNumberOfNodes(),
+		DefUseChains::UseSet(numOfUses));
+	for (const auto &node : order) {
+		auto n = ducs->getNodeIndex(node);
+		ducs->in[n] = ducs->gen[n];
+	}
 
 	//
 	// Perform the iterative algorithm to obtain IN and OUT for each node.
 	//
+	DefUseChains::UseSet newOut(numOfUses);
 	bool setChanged;
 	do {
 		setChanged = false;
@@ -300,7 +377,7 @@ void DefUseAnalysis::computeInAndOut(ShPtr<DefUseChains> ducs) {
 		// Note: To use the order computed above, we have to traverse the
 		// vector in reverse, i.e. from its end towards its beginning.
 		for (auto i = order.rbegin(), e = order.rend(); i != e; ++i) {
-			setChanged |= computeInAndOutForNode(ducs, *i);
+			setChanged |= computeInAndOutForNode(ducs, *i, newOut);
 		}
 	} while (setChanged);
 }
@@ -308,6 +385,11 @@ void DefUseAnalysis::computeInAndOut(ShPtr<DefUseChains> ducs) {
 /**
 * @brief Computes the @c IN[node] and @c OUT[node] set for the given node @a node.
 *
+* @param[in] ducs Information about def-use chains.
+* @param[in] node Currently processed node.
+* @param[in] newOut Auxiliary set of the same size as the sets in @a ducs (to
+*                   avoid its allocation for every node).
+*
 * @return @c true if either of these two sets has been changed, @c false
 *         otherwise.
 *
@@ -317,44 +399,31 @@ void DefUseAnalysis::computeInAndOut(ShPtr<DefUseChains> ducs) {
 *  - @a node is not the exit node of a CFG
 */
 bool DefUseAnalysis::computeInAndOutForNode(ShPtr<DefUseChains> ducs,
-		ShPtr<CFG::Node> node) {
+		ShPtr<CFG::Node> node, DefUseChains::UseSet &newOut) {
 	// See the implementation of computeInAndOut() for the description of the
 	// following algorithm.
 
 	// OUT[B] = \bigcup_{S \in succ(B)} IN[S]
-	DefUseChains::StmtVarPairSet newOut;
+	newOut.reset();
 	for (auto i = node->succ_begin(), e = node->succ_end(); i != e; ++i) {
-		addToSet(ducs->in[(*i)->getDst()], newOut);
+		newOut |= ducs->in[ducs->getNodeIndex((*i)->getDst())];
 	}
 
-	// Check whether OUT[B] has been changed.
-	auto &out = ducs->out[node];
-	auto &in = ducs->in[node];
-	if (out.size() != newOut.size()) {
-		// We no longer need newOut, so we can make a move instead of a copy.
-		out = std::move(newOut);
-	} else if (!in.empty()) {
-		// OUT[B] hasn't been changed and IN[B] has already been
-		// computed, so we don't have to recompute IN[B] because it
-		// would remain unchanged.
+	// IN[B] depends only on OUT[B], so if OUT[B] has not been changed, there
+	// is nothing to recompute.
+	auto n = ducs->getNodeIndex(node);
+	auto &out = ducs->out[n];
+	if (out == newOut) {
 		return false;
 	}
+	std::swap(out, newOut);
 
 	// IN[B] = GEN[B] \cup (OUT[B] - KILL[B])
-	// The following code is faster than
-	// in = setUnion(ducs->gen[node], setDifference(out, ducs->kill[node]));
-	in = ducs->gen[node];
-	auto &kill = ducs->kill[node];
-	for (auto &item : out) {
-		if (!hasItem(kill, item)) {
-			in.insert(item);
-		}
-	}
-
-	// At this moment, OUT may be unchanged, but IN has been computed for the
-	// first time. Therefore, we have to check that at least one item has been
-	// added to IN.
-	return !in.empty();
+	auto &in = ducs->in[n];
+	in = out;
+	in.reset(ducs->kill[n]);
+	in |= ducs->gen[n];
+	return true;
 }
 
 /**
@@ -440,9 +509,16 @@ void DefUseAnalysis::computeDefUseChainForStmt(ShPtr<DefUseChains> ducs,
 	// We have traversed all statements in the node without stopping the
 	// computation, so add also the relevant contents of OUT[node] to the
 	// def-use chain.
-	for (auto &item : ducs->out[node]) {
-		if (item.second == defVar) {
-			du.insert(item.first);
+	auto var = ducs->varIndexes.find(defVar);
+	if (var == ducs->varIndexes.end()) {
+		return;
+	}
+	const auto &out = ducs->out[ducs->getNodeIndex(node)];
+	for (auto j = ducs->varUsesBegins[var->second],
+			f = ducs->varUsesBegins[var->second + 1]; j < f; ++j) {
+		auto use = ducs->varUses[j];
+		if (out.test(use)) {
+			du.insert(ducs->uses[use].first);
 		}
 	}
 }
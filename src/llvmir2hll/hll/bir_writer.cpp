@@ -93,9 +93,8 @@ void BIRWriter::emit(ShPtr<Module> m, const std::string& fileName) {
 	emitFunctions();
 
 	fs::path dirName(".");
-	static unsigned cntr = 0;
 	std::string n = fileName.empty()
-			? "dump_" + std::to_string(cntr++) + ".bir"
+			? "dump_" + std::to_string(m->getNextDumpNumber()) + ".bir"
 			: fileName;
 	dirName.append(n);
 	std::ofstream myfile(dirName.string());
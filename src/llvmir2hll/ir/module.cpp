@@ -889,5 +889,15 @@ std::string Module::getDetectedLanguage() const {
 	return config->getDetectedLanguage();
 }
 
+/**
+* @brief Returns the number to be used in the name of the next dump of the
+*        module.
+*
+* Each call returns a new number, starting from 0.
+*/
+unsigned Module::getNextDumpNumber() {
+	return dumpsCount++;
+}
+
 } // namespace llvmir2hll
 } // namespace retdec
@@ -140,6 +140,16 @@ void LlvmIr2Hll::setOutputString(std::string* outString)
 	}
 }
 
+/**
+* @brief Sets a flag that is checked at the beginning of each decompilation
+*        phase. When it is raised, @c retdec::utils::OperationCancelled is
+*        thrown.
+*/
+void LlvmIr2Hll::setCancellationFlag(const utils::CancellationFlag* cancel)
+{
+	cancellationFlag = cancel;
+}
+
 void LlvmIr2Hll::getAnalysisUsage(llvm::AnalysisUsage &au) const
 {
 	au.addRequired<llvm::LoopInfoWrapperPass>();
@@ -149,7 +159,7 @@ void LlvmIr2Hll::getAnalysisUsage(llvm::AnalysisUsage &au) const
 
 bool LlvmIr2Hll::runOnModule(llvm::Module &m)
 {
-	Log::phase("initialization");
+	startPhase("initialization");
 
 	bool decompilationShouldContinue = initialize(m);
 	if (!decompilationShouldContinue)
@@ -157,7 +167,7 @@ bool LlvmIr2Hll::runOnModule(llvm::Module &m)
 		return false;
 	}
 
-	Log::phase("conversion of LLVM IR into BIR");
+	startPhase("conversion of LLVM IR into BIR");
 	decompilationShouldContinue = convertLLVMIRToBIR();
 	if (!decompilationShouldContinue)
 	{
@@ -166,7 +176,7 @@ bool LlvmIr2Hll::runOnModule(llvm::Module &m)
 
 	if (!globalConfig->parameters.isBackendKeepLibraryFuncs())
 	{
-		Log::phase("removing functions from standard libraries");
+		startPhase("removing functions from standard libraries");
 		removeLibraryFuncs();
 	}
 
@@ -175,67 +185,67 @@ bool LlvmIr2Hll::runOnModule(llvm::Module &m)
 	// the conversion of LLVM IR to BIR is not perfect, so it may introduce
 	// unreachable code. This causes problems later during optimizations
 	// because the code exists in BIR, but not in a CFG.
-	Log::phase("removing code that is not reachable in a CFG");
+	startPhase("removing code that is not reachable in a CFG");
 	removeCodeUnreachableInCFG();
 
-	Log::phase("signed/unsigned types fixing");
+	startPhase("signed/unsigned types fixing");
 	fixSignedUnsignedTypes();
 
-	Log::phase("converting LLVM intrinsic functions to standard functions");
+	startPhase("converting LLVM intrinsic functions to standard functions");
 	convertLLVMIntrinsicFunctions();
 
 	if (resModule->isDebugInfoAvailable())
 	{
-		Log::phase("obtaining debug information");
+		startPhase("obtaining debug information");
 		obtainDebugInfo();
 	}
 
 	if (!globalConfig->parameters.isBackendNoOpts())
 	{
-		Log::phase("alias analysis [" + aliasAnalysis->getId() + "]");
+		startPhase("alias analysis [" + aliasAnalysis->getId() + "]");
 		initAliasAnalysis();
 
-		Log::phase("optimizations");
+		startPhase("optimizations");
 		runOptimizations();
 	}
 
 	if (!globalConfig->parameters.isBackendNoVarRenaming())
 	{
-		Log::phase("variable renaming [" + varRenamer->getId() + "]");
+		startPhase("variable renaming [" + varRenamer->getId() + "]");
 		renameVariables();
 	}
 
 	if (!globalConfig->parameters.isBackendNoSymbolicNames())
 	{
-		Log::phase("converting constants to symbolic names");
+		startPhase("converting constants to symbolic names");
 		convertConstantsToSymbolicNames();
 	}
 
 	if (ValidateModule)
 	{
-		Log::phase("module validation");
+		startPhase("module validation");
 		validateResultingModule();
 	}
 
 	if (!FindPatterns.empty())
 	{
-		Log::phase("finding patterns");
+		startPhase("finding patterns");
 		findPatterns();
 	}
 
 	if (globalConfig->parameters.isBackendEmitCfg())
 	{
-		Log::phase("emission of control-flow graphs");
+		startPhase("emission of control-flow graphs");
 		emitCFGs();
 	}
 
 	if (globalConfig->parameters.isBackendEmitCg())
 	{
-		Log::phase("emission of a call graph");
+		startPhase("emission of a call graph");
 		emitCG();
 	}
 
-	Log::phase("emission of the target code [" + hllWriter->getId() + "]");
+	startPhase("emission of the target code [" + hllWriter->getId() + "]");
 	emitTargetHLLCode();
 
 	Log::phase("finalization");
@@ -247,6 +257,17 @@ bool LlvmIr2Hll::runOnModule(llvm::Module &m)
 	return false;
 }
 
+/**
+* @brief Starts a new top-level decompilation phase named @a name.
+*
+* Phases are the points where a cancelled decompilation stops.
+*/
+void LlvmIr2Hll::startPhase(const std::string &name)
+{
+	utils::throwIfCancelled(cancellationFlag);
+	Log::phase(name);
+}
+
 /**
 * @brief Initializes all the needed private variables.
 *
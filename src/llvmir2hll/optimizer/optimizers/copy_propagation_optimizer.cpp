@@ -223,7 +223,7 @@ void CopyPropagationOptimizer::doOptimization() {
 	va->clearCache();
 	va->initAliasAnalysis(module);
 	vuv = VarUsesVisitor::create(va, true, module);
-	dua = DefUseAnalysis::create(module, va, vuv);
+	dua = DefUseAnalysis::create(module, va);
 	uda = UseDefAnalysis::create(module);
 
 	FuncOptimizer::doOptimization();
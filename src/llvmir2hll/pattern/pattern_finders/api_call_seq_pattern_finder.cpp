@@ -52,7 +52,7 @@ using APICallInfoSeqMap = std::multimap<std::string, APICallInfoSeq>;
 */
 void parseAndAddAPICallInfoSeqToMap(APICallInfoSeqMap &map,
 		const std::string &funcName, const std::string &seqTextRepr) {
-	static ShPtr<APICallInfoSeqParser> parser(APICallInfoSeqParser::create());
+	ShPtr<APICallInfoSeqParser> parser(APICallInfoSeqParser::create());
 	std::optional<APICallInfoSeq> seq(parser->parse(seqTextRepr));
 	if (seq) {
 		map.insert(std::make_pair(funcName, seq.value()));
@@ -65,13 +65,12 @@ void parseAndAddAPICallInfoSeqToMap(APICallInfoSeqMap &map,
 
 /**
 * @brief Initializes a mapping of function names into a sequence of information
-*        about API calls that begin with that function, and returns a constant
-*        reference to it.
+*        about API calls that begin with that function, and returns it.
 *
 * This functions is supposed to be used to initialize API_CALL_INFO_SEQ_MAP.
 */
-const APICallInfoSeqMap &initAPICallInfoSeqMap() {
-	static APICallInfoSeqMap map;
+APICallInfoSeqMap initAPICallInfoSeqMap() {
+	APICallInfoSeqMap map;
 
 	parseAndAddAPICallInfoSeqToMap(map, "_open",
 		"X = _open()"
@@ -1090,7 +1089,7 @@ const APICallInfoSeqMap &initAPICallInfoSeqMap() {
 
 /// A mapping of function names into a sequence of information about API calls
 /// that begin with that function.
-const APICallInfoSeqMap &API_CALL_INFO_SEQ_MAP(initAPICallInfoSeqMap());
+const APICallInfoSeqMap API_CALL_INFO_SEQ_MAP(initAPICallInfoSeqMap());
 
 } // anonymous namespace
 
@@ -118,9 +118,9 @@ std::optional<std::string> CompoundSemantics::getMainFuncName() const {
 		&Semantics::getMainFuncName);
 }
 
-std::optional<std::string> CompoundSemantics::getCHeaderFileForFunc(
+std::optional<std::string_view> CompoundSemantics::getCHeaderFileForFunc(
 		const std::string &funcName) const {
-	return getAnswer<std::string>(providedSemantics,
+	return getAnswer<std::string_view>(providedSemantics,
 		&Semantics::getCHeaderFileForFunc, funcName);
 }
 
@@ -130,22 +130,26 @@ std::optional<bool> CompoundSemantics::funcNeverReturns(
 		&Semantics::funcNeverReturns, funcName);
 }
 
-std::optional<std::string> CompoundSemantics::getNameOfVarStoringResult(
+std::optional<std::string_view> CompoundSemantics::getNameOfVarStoringResult(
 		const std::string &funcName) const {
-	return getAnswer<std::string>(providedSemantics,
+	return getAnswer<std::string_view>(providedSemantics,
 		&Semantics::getNameOfVarStoringResult, funcName);
 }
 
-std::optional<std::string> CompoundSemantics::getNameOfParam(
+std::optional<std::string_view> CompoundSemantics::getNameOfParam(
 		const std::string &funcName, unsigned paramPos) const {
-	return getAnswer<std::string>(providedSemantics,
+	return getAnswer<std::string_view>(providedSemantics,
 		&Semantics::getNameOfParam, funcName, paramPos);
 }
 
-std::optional<IntStringMap> CompoundSemantics::getSymbolicNamesForParam(
+const IntStringMap *CompoundSemantics::getSymbolicNamesForParam(
 		const std::string &funcName, unsigned paramPos) const {
-	return getAnswer<IntStringMap>(providedSemantics,
-		&Semantics::getSymbolicNamesForParam, funcName, paramPos);
+	for (const auto &semantics : providedSemantics) {
+		if (auto answer = semantics->getSymbolicNamesForParam(funcName, paramPos)) {
+			return answer;
+		}
+	}
+	return nullptr;
 }
 
 } // namespace llvmir2hll
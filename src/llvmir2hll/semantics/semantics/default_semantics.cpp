@@ -34,7 +34,7 @@ std::optional<std::string> DefaultSemantics::getMainFuncName() const {
 	return std::nullopt;
 }
 
-std::optional<std::string> DefaultSemantics::getCHeaderFileForFunc(
+std::optional<std::string_view> DefaultSemantics::getCHeaderFileForFunc(
 		const std::string &funcName) const {
 	return std::nullopt;
 }
@@ -44,19 +44,19 @@ std::optional<bool> DefaultSemantics::funcNeverReturns(
 	return std::nullopt;
 }
 
-std::optional<std::string> DefaultSemantics::getNameOfVarStoringResult(
+std::optional<std::string_view> DefaultSemantics::getNameOfVarStoringResult(
 		const std::string &funcName) const {
 	return std::nullopt;
 }
 
-std::optional<std::string> DefaultSemantics::getNameOfParam(
+std::optional<std::string_view> DefaultSemantics::getNameOfParam(
 		const std::string &funcName, unsigned paramPos) const {
 	return std::nullopt;
 }
 
-std::optional<IntStringMap> DefaultSemantics::getSymbolicNamesForParam(
+const IntStringMap *DefaultSemantics::getSymbolicNamesForParam(
 		const std::string &funcName, unsigned paramPos) const {
-	return std::nullopt;
+	return nullptr;
 }
 
 } // namespace llvmir2hll
@@ -35,22 +35,22 @@ std::string GCCGeneralSemantics::getId() const {
 	return GCC_GENERAL_SEMANTICS_ID;
 }
 
-std::optional<std::string> GCCGeneralSemantics::getCHeaderFileForFunc(
+std::optional<std::string_view> GCCGeneralSemantics::getCHeaderFileForFunc(
 		const std::string &funcName) const {
 	return semantics::gcc_general::getCHeaderFileForFunc(funcName);
 }
 
-std::optional<std::string> GCCGeneralSemantics::getNameOfVarStoringResult(
+std::optional<std::string_view> GCCGeneralSemantics::getNameOfVarStoringResult(
 		const std::string &funcName) const {
 	return semantics::gcc_general::getNameOfVarStoringResult(funcName);
 }
 
-std::optional<std::string> GCCGeneralSemantics::getNameOfParam(
+std::optional<std::string_view> GCCGeneralSemantics::getNameOfParam(
 		const std::string &funcName, unsigned paramPos) const {
 	return semantics::gcc_general::getNameOfParam(funcName, paramPos);
 }
 
-std::optional<IntStringMap> GCCGeneralSemantics::getSymbolicNamesForParam(
+const IntStringMap *GCCGeneralSemantics::getSymbolicNamesForParam(
 		const std::string &funcName, unsigned paramPos) const {
 	return semantics::gcc_general::getSymbolicNamesForParam(funcName, paramPos);
 }
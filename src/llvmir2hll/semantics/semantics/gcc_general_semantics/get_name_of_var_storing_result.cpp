@@ -15,34 +15,19 @@ namespace gcc_general {
 
 namespace {
 
-/**
-* @brief This function is used to initialize FUNC_VAR_NAME_MAP later in the
-*        file.
-*/
-const StringStringUMap &initFuncVarNameMap() {
-	static StringStringUMap m;
-
-	// TODO Add more mappings.
-
-	// signal.h
-	m["signal"] = "prev_func_h";
-
-	// sys/socket.h
-	m["accept"] = "accepted_sock_fd";
-	m["socket"] = "sock_fd";
-
-	// sys/stat.h
-	m["open"] = "fd";
-
-	// unistd.h
-	m["getpid"] = "pid";
-	m["getppid"] = "ppid";
-
-	return m;
-}
+// TODO Add more mappings.
 
 /// Mapping of function names to their corresponding names of variables.
-const StringStringUMap &FUNC_VAR_NAME_MAP(initFuncVarNameMap());
+constexpr FuncVarName FUNC_VAR_NAMES[] = {
+	{"accept", "accepted_sock_fd"},
+	{"getpid", "pid"},
+	{"getppid", "ppid"},
+	{"open", "fd"},
+	{"signal", "prev_func_h"},
+	{"socket", "sock_fd"},
+};
+static_assert(FuncVarNameTable(FUNC_VAR_NAMES).isSorted(),
+	"FUNC_VAR_NAMES has to be sorted by scripts/llvmir2hll/sort_semantics_tables.py");
 
 } // anonymous namespace
 
@@ -51,8 +36,8 @@ const StringStringUMap &FUNC_VAR_NAME_MAP(initFuncVarNameMap());
 *
 * See its description for more details.
 */
-std::optional<std::string> getNameOfVarStoringResult(const std::string &funcName) {
-	return getNameOfVarStoringResultFromMap(funcName, FUNC_VAR_NAME_MAP);
+std::optional<std::string_view> getNameOfVarStoringResult(const std::string &funcName) {
+	return getNameOfVarStoringResultFromTable(funcName, FUNC_VAR_NAMES);
 }
 
 } // namespace gcc_general
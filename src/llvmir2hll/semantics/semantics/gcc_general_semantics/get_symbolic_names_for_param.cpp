@@ -15,1629 +15,1833 @@ namespace gcc_general {
 
 namespace {
 
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_BEGIN(getSymbolicNamesForSignals)
+//
+// Symbolic names shared by parameters of several functions.
+//
+
+constexpr SymbolicName SIGNALS[] = {
 	// Info from: <sys/signal.h>
-	symbolicNamesMap[1] = "SIGHUP";
-	symbolicNamesMap[2] = "SIGINT";
-	symbolicNamesMap[3] = "SIGQUIT";
-	symbolicNamesMap[4] = "SIGILL";
-	symbolicNamesMap[5] = "SIGTRAP";
-	symbolicNamesMap[6] = "SIGABRT";
-	symbolicNamesMap[7] = "SIGEMT";
-	symbolicNamesMap[8] = "SIGFPE";
-	symbolicNamesMap[9] = "SIGKILL";
-	symbolicNamesMap[10] = "SIGBUS";
-	symbolicNamesMap[11] = "SIGSEGV";
-	symbolicNamesMap[12] = "SIGSYS";
-	symbolicNamesMap[13] = "SIGPIPE";
-	symbolicNamesMap[14] = "SIGALARM";
-	symbolicNamesMap[15] = "SIGTERM";
-	symbolicNamesMap[16] = "SIGURG";
-	symbolicNamesMap[17] = "SIGSTOP";
-	symbolicNamesMap[18] = "SIGTSTP";
-	symbolicNamesMap[19] = "SIGCONT";
-	symbolicNamesMap[20] = "SIGCHLD";
-	symbolicNamesMap[21] = "SIGTTIN";
-	symbolicNamesMap[22] = "SIGTTOU";
-	symbolicNamesMap[23] = "SIGIO";
-	symbolicNamesMap[24] = "SIGXCPU";
-	symbolicNamesMap[25] = "SIGXFSZ";
-	symbolicNamesMap[26] = "SIGVTALRM";
-	symbolicNamesMap[27] = "SIGPROF";
-	symbolicNamesMap[28] = "SIGWINCH";
-	symbolicNamesMap[29] = "SIGINFO";
-	symbolicNamesMap[30] = "SIGUSR1";
-	symbolicNamesMap[31] = "SIGUSR2";
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_END()
-
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_BEGIN(getSymbolicNamesForSignalHandlers)
+	{1, "SIGHUP"},
+	{2, "SIGINT"},
+	{3, "SIGQUIT"},
+	{4, "SIGILL"},
+	{5, "SIGTRAP"},
+	{6, "SIGABRT"},
+	{7, "SIGEMT"},
+	{8, "SIGFPE"},
+	{9, "SIGKILL"},
+	{10, "SIGBUS"},
+	{11, "SIGSEGV"},
+	{12, "SIGSYS"},
+	{13, "SIGPIPE"},
+	{14, "SIGALARM"},
+	{15, "SIGTERM"},
+	{16, "SIGURG"},
+	{17, "SIGSTOP"},
+	{18, "SIGTSTP"},
+	{19, "SIGCONT"},
+	{20, "SIGCHLD"},
+	{21, "SIGTTIN"},
+	{22, "SIGTTOU"},
+	{23, "SIGIO"},
+	{24, "SIGXCPU"},
+	{25, "SIGXFSZ"},
+	{26, "SIGVTALRM"},
+	{27, "SIGPROF"},
+	{28, "SIGWINCH"},
+	{29, "SIGINFO"},
+	{30, "SIGUSR1"},
+	{31, "SIGUSR2"},
+};
+
+constexpr SymbolicName SIGNAL_HANDLERS[] = {
 	// Info from: <sys/signal.h>
-	symbolicNamesMap[0] = "SIG_DFL";
-	symbolicNamesMap[1] = "SIG_IGN";
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_END()
+	{0, "SIG_DFL"},
+	{1, "SIG_IGN"},
+};
 
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_BEGIN(getSymbolicNamesForErrors)
+constexpr SymbolicName ERRORS[] = {
 	// Info from: <asm-generic/errno-base.h>
 	// Info from: <asm-generic/errno.h>
-	symbolicNamesMap[1] = "EPERM";
-	symbolicNamesMap[2] = "ENOENT";
-	symbolicNamesMap[3] = "ESRCH";
-	symbolicNamesMap[4] = "EINTR";
-	symbolicNamesMap[5] = "EIO";
-	symbolicNamesMap[6] = "ENXIO";
-	symbolicNamesMap[7] = "E2BIG";
-	symbolicNamesMap[8] = "ENOEXEC";
-	symbolicNamesMap[9] = "EBADF";
-	symbolicNamesMap[10] = "ECHILD";
-	symbolicNamesMap[11] = "EAGAIN";
-	// symbolicNamesMap[11] = "EWOULDBLOCK"; // synonym for EAGAIN
-	symbolicNamesMap[12] = "ENOMEM";
-	symbolicNamesMap[13] = "EACCES";
-	symbolicNamesMap[14] = "EFAULT";
-	symbolicNamesMap[15] = "ENOTBLK";
-	symbolicNamesMap[16] = "EBUSY";
-	symbolicNamesMap[17] = "EEXIST";
-	symbolicNamesMap[18] = "EXDEV";
-	symbolicNamesMap[19] = "ENODEV";
-	symbolicNamesMap[20] = "ENOTDIR";
-	symbolicNamesMap[21] = "EISDIR";
-	symbolicNamesMap[22] = "EINVAL";
-	symbolicNamesMap[23] = "ENFILE";
-	symbolicNamesMap[24] = "EMFILE";
-	symbolicNamesMap[25] = "ENOTTY";
-	symbolicNamesMap[26] = "ETXTBSY";
-	symbolicNamesMap[27] = "EFBIG";
-	symbolicNamesMap[28] = "ENOSPC";
-	symbolicNamesMap[29] = "ESPIPE";
-	symbolicNamesMap[30] = "EROFS";
-	symbolicNamesMap[31] = "EMLINK";
-	symbolicNamesMap[32] = "EPIPE";
-	symbolicNamesMap[33] = "EDOM";
-	symbolicNamesMap[34] = "ERANGE";
-	symbolicNamesMap[35] = "EDEADLK";
-	// symbolicNamesMap[35] = "EDEADLOCK"; // synonym for EDEADLK
-	symbolicNamesMap[36] = "ENAMETOOLONG";
-	symbolicNamesMap[37] = "ENOLCK";
-	symbolicNamesMap[38] = "ENOSYS";
-	symbolicNamesMap[39] = "ENOTEMPTY";
-	symbolicNamesMap[40] = "ELOOP";
-	symbolicNamesMap[42] = "ENOMSG";
-	symbolicNamesMap[43] = "EIDRM";
-	symbolicNamesMap[44] = "ECHRNG";
-	symbolicNamesMap[45] = "EL2NSYNC";
-	symbolicNamesMap[46] = "EL3HLT";
-	symbolicNamesMap[47] = "EL3RST";
-	symbolicNamesMap[48] = "ELNRNG";
-	symbolicNamesMap[49] = "EUNATCH";
-	symbolicNamesMap[50] = "ENOCSI";
-	symbolicNamesMap[51] = "EL2HLT";
-	symbolicNamesMap[52] = "EBADE";
-	symbolicNamesMap[53] = "EBADR";
-	symbolicNamesMap[54] = "EXFULL";
-	symbolicNamesMap[55] = "ENOANO";
-	symbolicNamesMap[56] = "EBADRQC";
-	symbolicNamesMap[57] = "EBADSLT";
-	symbolicNamesMap[59] = "EBFONT";
-	symbolicNamesMap[60] = "ENOSTR";
-	symbolicNamesMap[61] = "ENODATA";
-	symbolicNamesMap[62] = "ETIME";
-	symbolicNamesMap[63] = "ENOSR";
-	symbolicNamesMap[64] = "ENONET";
-	symbolicNamesMap[65] = "ENOPKG";
-	symbolicNamesMap[66] = "EREMOTE";
-	symbolicNamesMap[67] = "ENOLINK";
-	symbolicNamesMap[68] = "EADV";
-	symbolicNamesMap[69] = "ESRMNT";
-	symbolicNamesMap[70] = "ECOMM";
-	symbolicNamesMap[71] = "EPROTO";
-	symbolicNamesMap[72] = "EMULTIHOP";
-	symbolicNamesMap[73] = "EDOTDOT";
-	symbolicNamesMap[74] = "EBADMSG";
-	symbolicNamesMap[75] = "EOVERFLOW";
-	symbolicNamesMap[76] = "ENOTUNIQ";
-	symbolicNamesMap[77] = "EBADFD";
-	symbolicNamesMap[78] = "EREMCHG";
-	symbolicNamesMap[79] = "ELIBACC";
-	symbolicNamesMap[80] = "ELIBBAD";
-	symbolicNamesMap[81] = "ELIBSCN";
-	symbolicNamesMap[82] = "ELIBMAX";
-	symbolicNamesMap[83] = "ELIBEXEC";
-	symbolicNamesMap[84] = "EILSEQ";
-	symbolicNamesMap[85] = "ERESTART";
-	symbolicNamesMap[86] = "ESTRPIPE";
-	symbolicNamesMap[87] = "EUSERS";
-	symbolicNamesMap[88] = "ENOTSOCK";
-	symbolicNamesMap[89] = "EDESTADDRREQ";
-	symbolicNamesMap[90] = "EMSGSIZE";
-	symbolicNamesMap[91] = "EPROTOTYPE";
-	symbolicNamesMap[92] = "ENOPROTOOPT";
-	symbolicNamesMap[93] = "EPROTONOSUPPORT";
-	symbolicNamesMap[94] = "ESOCKTNOSUPPORT";
-	symbolicNamesMap[95] = "EOPNOTSUPP";
-	symbolicNamesMap[96] = "EPFNOSUPPORT";
-	symbolicNamesMap[97] = "EAFNOSUPPORT";
-	symbolicNamesMap[98] = "EADDRINUSE";
-	symbolicNamesMap[99] = "EADDRNOTAVAIL";
-	symbolicNamesMap[100] = "ENETDOWN";
-	symbolicNamesMap[101] = "ENETUNREACH";
-	symbolicNamesMap[102] = "ENETRESET";
-	symbolicNamesMap[103] = "ECONNABORTED";
-	symbolicNamesMap[104] = "ECONNRESET";
-	symbolicNamesMap[105] = "ENOBUFS";
-	symbolicNamesMap[106] = "EISCONN";
-	symbolicNamesMap[107] = "ENOTCONN";
-	symbolicNamesMap[108] = "ESHUTDOWN";
-	symbolicNamesMap[109] = "ETOOMANYREFS";
-	symbolicNamesMap[110] = "ETIMEDOUT";
-	symbolicNamesMap[111] = "ECONNREFUSED";
-	symbolicNamesMap[112] = "EHOSTDOWN";
-	symbolicNamesMap[113] = "EHOSTUNREACH";
-	symbolicNamesMap[114] = "EALREADY";
-	symbolicNamesMap[115] = "EINPROGRESS";
-	symbolicNamesMap[116] = "ESTALE";
-	symbolicNamesMap[117] = "EUCLEAN";
-	symbolicNamesMap[118] = "ENOTNAM";
-	symbolicNamesMap[119] = "ENAVAIL";
-	symbolicNamesMap[120] = "EISNAM";
-	symbolicNamesMap[121] = "EREMOTEIO";
-	symbolicNamesMap[122] = "EDQUOT";
-	symbolicNamesMap[123] = "ENOMEDIUM";
-	symbolicNamesMap[124] = "EMEDIUMTYPE";
-	symbolicNamesMap[125] = "ECANCELED";
-	symbolicNamesMap[126] = "ENOKEY";
-	symbolicNamesMap[127] = "EKEYEXPIRED";
-	symbolicNamesMap[128] = "EKEYREVOKED";
-	symbolicNamesMap[129] = "EKEYREJECTED";
-	symbolicNamesMap[130] = "EOWNERDEAD";
-	symbolicNamesMap[131] = "ENOTRECOVERABLE";
-	symbolicNamesMap[132] = "ERFKILL";
-	symbolicNamesMap[133] = "EHWPOISON";
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_END()
-
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_BEGIN(getSymbolicNamesForOpenFlags)
+	{1, "EPERM"},
+	{2, "ENOENT"},
+	{3, "ESRCH"},
+	{4, "EINTR"},
+	{5, "EIO"},
+	{6, "ENXIO"},
+	{7, "E2BIG"},
+	{8, "ENOEXEC"},
+	{9, "EBADF"},
+	{10, "ECHILD"},
+	{11, "EAGAIN"},
+	// {11, "EWOULDBLOCK"}, // synonym for EAGAIN
+	{12, "ENOMEM"},
+	{13, "EACCES"},
+	{14, "EFAULT"},
+	{15, "ENOTBLK"},
+	{16, "EBUSY"},
+	{17, "EEXIST"},
+	{18, "EXDEV"},
+	{19, "ENODEV"},
+	{20, "ENOTDIR"},
+	{21, "EISDIR"},
+	{22, "EINVAL"},
+	{23, "ENFILE"},
+	{24, "EMFILE"},
+	{25, "ENOTTY"},
+	{26, "ETXTBSY"},
+	{27, "EFBIG"},
+	{28, "ENOSPC"},
+	{29, "ESPIPE"},
+	{30, "EROFS"},
+	{31, "EMLINK"},
+	{32, "EPIPE"},
+	{33, "EDOM"},
+	{34, "ERANGE"},
+	{35, "EDEADLK"},
+	// {35, "EDEADLOCK"}, // synonym for EDEADLK
+	{36, "ENAMETOOLONG"},
+	{37, "ENOLCK"},
+	{38, "ENOSYS"},
+	{39, "ENOTEMPTY"},
+	{40, "ELOOP"},
+	{42, "ENOMSG"},
+	{43, "EIDRM"},
+	{44, "ECHRNG"},
+	{45, "EL2NSYNC"},
+	{46, "EL3HLT"},
+	{47, "EL3RST"},
+	{48, "ELNRNG"},
+	{49, "EUNATCH"},
+	{50, "ENOCSI"},
+	{51, "EL2HLT"},
+	{52, "EBADE"},
+	{53, "EBADR"},
+	{54, "EXFULL"},
+	{55, "ENOANO"},
+	{56, "EBADRQC"},
+	{57, "EBADSLT"},
+	{59, "EBFONT"},
+	{60, "ENOSTR"},
+	{61, "ENODATA"},
+	{62, "ETIME"},
+	{63, "ENOSR"},
+	{64, "ENONET"},
+	{65, "ENOPKG"},
+	{66, "EREMOTE"},
+	{67, "ENOLINK"},
+	{68, "EADV"},
+	{69, "ESRMNT"},
+	{70, "ECOMM"},
+	{71, "EPROTO"},
+	{72, "EMULTIHOP"},
+	{73, "EDOTDOT"},
+	{74, "EBADMSG"},
+	{75, "EOVERFLOW"},
+	{76, "ENOTUNIQ"},
+	{77, "EBADFD"},
+	{78, "EREMCHG"},
+	{79, "ELIBACC"},
+	{80, "ELIBBAD"},
+	{81, "ELIBSCN"},
+	{82, "ELIBMAX"},
+	{83, "ELIBEXEC"},
+	{84, "EILSEQ"},
+	{85, "ERESTART"},
+	{86, "ESTRPIPE"},
+	{87, "EUSERS"},
+	{88, "ENOTSOCK"},
+	{89, "EDESTADDRREQ"},
+	{90, "EMSGSIZE"},
+	{91, "EPROTOTYPE"},
+	{92, "ENOPROTOOPT"},
+	{93, "EPROTONOSUPPORT"},
+	{94, "ESOCKTNOSUPPORT"},
+	{95, "EOPNOTSUPP"},
+	{96, "EPFNOSUPPORT"},
+	{97, "EAFNOSUPPORT"},
+	{98, "EADDRINUSE"},
+	{99, "EADDRNOTAVAIL"},
+	{100, "ENETDOWN"},
+	{101, "ENETUNREACH"},
+	{102, "ENETRESET"},
+	{103, "ECONNABORTED"},
+	{104, "ECONNRESET"},
+	{105, "ENOBUFS"},
+	{106, "EISCONN"},
+	{107, "ENOTCONN"},
+	{108, "ESHUTDOWN"},
+	{109, "ETOOMANYREFS"},
+	{110, "ETIMEDOUT"},
+	{111, "ECONNREFUSED"},
+	{112, "EHOSTDOWN"},
+	{113, "EHOSTUNREACH"},
+	{114, "EALREADY"},
+	{115, "EINPROGRESS"},
+	{116, "ESTALE"},
+	{117, "EUCLEAN"},
+	{118, "ENOTNAM"},
+	{119, "ENAVAIL"},
+	{120, "EISNAM"},
+	{121, "EREMOTEIO"},
+	{122, "EDQUOT"},
+	{123, "ENOMEDIUM"},
+	{124, "EMEDIUMTYPE"},
+	{125, "ECANCELED"},
+	{126, "ENOKEY"},
+	{127, "EKEYEXPIRED"},
+	{128, "EKEYREVOKED"},
+	{129, "EKEYREJECTED"},
+	{130, "EOWNERDEAD"},
+	{131, "ENOTRECOVERABLE"},
+	{132, "ERFKILL"},
+	{133, "EHWPOISON"},
+};
+
+constexpr SymbolicName OPEN_FLAGS[] = {
 	// Info from: <asm-generic/fcntl.h>
-	symbolicNamesMap[00000000] = "O_RDONLY";
-	symbolicNamesMap[00000001] = "O_WRONLY";
-	symbolicNamesMap[00000002] = "O_RDWR";
-	symbolicNamesMap[00000003] = "O_ACCMODE";
-	symbolicNamesMap[00000100] = "O_CREAT";
-	symbolicNamesMap[00000200] = "O_EXCL";
-	symbolicNamesMap[00000400] = "O_NOCTTY";
-	symbolicNamesMap[00001000] = "O_TRUNC";
-	symbolicNamesMap[00002000] = "O_APPEND";
-	symbolicNamesMap[00004000] = "O_NONBLOCK";
-	symbolicNamesMap[00010000] = "O_DSYNC";
-	symbolicNamesMap[00020000] = "FASYNC";
-	symbolicNamesMap[00040000] = "O_DIRECT";
-	symbolicNamesMap[00100000] = "O_LARGEFILE";
-	symbolicNamesMap[00200000] = "O_DIRECTORY";
-	symbolicNamesMap[00400000] = "O_NOFOLLOW";
-	symbolicNamesMap[01000000] = "O_NOATIME";
-	symbolicNamesMap[02000000] = "O_CLOEXEC";
+	{00000000, "O_RDONLY"},
+	{00000001, "O_WRONLY"},
+	{00000002, "O_RDWR"},
+	{00000003, "O_ACCMODE"},
+	{00000100, "O_CREAT"},
+	{00000200, "O_EXCL"},
+	{00000400, "O_NOCTTY"},
+	{00001000, "O_TRUNC"},
+	{00002000, "O_APPEND"},
+	{00004000, "O_NONBLOCK"},
+	{00010000, "O_DSYNC"},
+	{00020000, "FASYNC"},
+	{00040000, "O_DIRECT"},
+	{00100000, "O_LARGEFILE"},
+	{00200000, "O_DIRECTORY"},
+	{00400000, "O_NOFOLLOW"},
+	{01000000, "O_NOATIME"},
+	{02000000, "O_CLOEXEC"},
 	// Info from: <bits/fcntl-linux.h>
-	symbolicNamesMap[04010000] = "O_SYNC";
-	// symbolicNamesMap[04010000] = "O_FSYNC"; // synonym for O_SYNC
+	{04010000, "O_SYNC"},
+	// {04010000, "O_FSYNC"}, // synonym for O_SYNC
 	// The manual page for open() mentions also the following names. However, I
 	// was unable to find their values:
-	// symbolicNamesMap[?] = "O_EXEC";
-	// symbolicNamesMap[?] = "O_SEARCH";
-	// symbolicNamesMap[?] = "O_RSYNC";
-	// symbolicNamesMap[?] = "O_TTY_INIT";
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_END()
+	// {?, "O_EXEC"},
+	// {?, "O_SEARCH"},
+	// {?, "O_RSYNC"},
+	// {?, "O_TTY_INIT"},
+};
 
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_BEGIN(getSymbolicNamesForPermMode)
+constexpr SymbolicName PERM_MODE[] = {
 	// Info from: <linux/stat.h>
-	symbolicNamesMap[00700] = "S_IRWXU";
-	symbolicNamesMap[00400] = "S_IRUSR";
-	symbolicNamesMap[00200] = "S_IWUSR";
-	symbolicNamesMap[00100] = "S_IXUSR";
-	symbolicNamesMap[00070] = "S_IRWXG";
-	symbolicNamesMap[00040] = "S_IRGRP";
-	symbolicNamesMap[00020] = "S_IWGRP";
-	symbolicNamesMap[00010] = "S_IXGRP";
-	symbolicNamesMap[00007] = "S_IRWXO";
-	symbolicNamesMap[00004] = "S_IROTH";
-	symbolicNamesMap[00002] = "S_IWOTH";
-	symbolicNamesMap[00001] = "S_IXOTH";
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_END()
-
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_BEGIN(getSymbolicNamesForSignalMaskActions)
+	{00700, "S_IRWXU"},
+	{00400, "S_IRUSR"},
+	{00200, "S_IWUSR"},
+	{00100, "S_IXUSR"},
+	{00070, "S_IRWXG"},
+	{00040, "S_IRGRP"},
+	{00020, "S_IWGRP"},
+	{00010, "S_IXGRP"},
+	{00007, "S_IRWXO"},
+	{00004, "S_IROTH"},
+	{00002, "S_IWOTH"},
+	{00001, "S_IXOTH"},
+};
+
+constexpr SymbolicName SIGNAL_MASK_ACTIONS[] = {
 	// Info from: <asm-generic/signal-defs.h>
-	symbolicNamesMap[0] = "SIG_BLOCK";
-	symbolicNamesMap[1] = "SIG_UNBLOCK";
-	symbolicNamesMap[2] = "SIG_SETMASK";
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_END()
+	{0, "SIG_BLOCK"},
+	{1, "SIG_UNBLOCK"},
+	{2, "SIG_SETMASK"},
+};
 
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_BEGIN(getSymbolicNamesForPrioType)
+constexpr SymbolicName PRIO_TYPE[] = {
 	// Info from: <linux/resource.h>
-	symbolicNamesMap[0] = "PRIO_PROCESS";
-	symbolicNamesMap[1] = "PRIO_PGRP";
-	symbolicNamesMap[2] = "PRIO_USER";
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_END()
+	{0, "PRIO_PROCESS"},
+	{1, "PRIO_PGRP"},
+	{2, "PRIO_USER"},
+};
 
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_BEGIN(getSymbolicNamesForAddressFamilies)
+constexpr SymbolicName ADDRESS_FAMILIES[] = {
 	// Info from: <bits/socket.h>
-	symbolicNamesMap[0] = "AF_UNSPEC";
-	symbolicNamesMap[1] = "AF_LOCAL";
-	symbolicNamesMap[2] = "AF_INET";
-	symbolicNamesMap[3] = "AF_AX25";
-	symbolicNamesMap[4] = "AF_IPX";
-	symbolicNamesMap[5] = "AF_APPLETALK";
-	symbolicNamesMap[6] = "AF_NETROM";
-	symbolicNamesMap[7] = "AF_BRIDGE";
-	symbolicNamesMap[8] = "AF_ATMPVC";
-	symbolicNamesMap[9] = "AF_X25";
-	symbolicNamesMap[10] = "AF_INET6";
-	symbolicNamesMap[11] = "AF_ROSE";
-	symbolicNamesMap[12] = "AF_DECnet";
-	symbolicNamesMap[13] = "AF_NETBEUI";
-	symbolicNamesMap[14] = "AF_SECURITY";
-	symbolicNamesMap[15] = "AF_KEY";
-	symbolicNamesMap[16] = "AF_NETLINK";
-	symbolicNamesMap[17] = "AF_PACKET";
-	symbolicNamesMap[18] = "AF_ASH";
-	symbolicNamesMap[19] = "AF_ECONET";
-	symbolicNamesMap[20] = "AF_ATMSVC";
-	symbolicNamesMap[21] = "AF_RDS";
-	symbolicNamesMap[22] = "AF_SNA";
-	symbolicNamesMap[23] = "AF_IRDA";
-	symbolicNamesMap[24] = "AF_PPPOX";
-	symbolicNamesMap[25] = "AF_WANPIPE";
-	symbolicNamesMap[26] = "AF_LLC";
-	symbolicNamesMap[29] = "AF_CAN";
-	symbolicNamesMap[30] = "AF_TIPC";
-	symbolicNamesMap[31] = "AF_BLUETOOTH";
-	symbolicNamesMap[32] = "AF_IUCV";
-	symbolicNamesMap[33] = "AF_RXRPC";
-	symbolicNamesMap[34] = "AF_ISDN";
-	symbolicNamesMap[35] = "AF_PHONET";
-	symbolicNamesMap[36] = "AF_IEEE802154";
-	symbolicNamesMap[37] = "AF_CAIF";
-	symbolicNamesMap[38] = "AF_ALG";
-	symbolicNamesMap[39] = "AF_NFC";
-	symbolicNamesMap[40] = "AF_MAX";
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_END()
-
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_BEGIN(getSymbolicNamesForIPProtocols)
+	{0, "AF_UNSPEC"},
+	{1, "AF_LOCAL"},
+	{2, "AF_INET"},
+	{3, "AF_AX25"},
+	{4, "AF_IPX"},
+	{5, "AF_APPLETALK"},
+	{6, "AF_NETROM"},
+	{7, "AF_BRIDGE"},
+	{8, "AF_ATMPVC"},
+	{9, "AF_X25"},
+	{10, "AF_INET6"},
+	{11, "AF_ROSE"},
+	{12, "AF_DECnet"},
+	{13, "AF_NETBEUI"},
+	{14, "AF_SECURITY"},
+	{15, "AF_KEY"},
+	{16, "AF_NETLINK"},
+	{17, "AF_PACKET"},
+	{18, "AF_ASH"},
+	{19, "AF_ECONET"},
+	{20, "AF_ATMSVC"},
+	{21, "AF_RDS"},
+	{22, "AF_SNA"},
+	{23, "AF_IRDA"},
+	{24, "AF_PPPOX"},
+	{25, "AF_WANPIPE"},
+	{26, "AF_LLC"},
+	{29, "AF_CAN"},
+	{30, "AF_TIPC"},
+	{31, "AF_BLUETOOTH"},
+	{32, "AF_IUCV"},
+	{33, "AF_RXRPC"},
+	{34, "AF_ISDN"},
+	{35, "AF_PHONET"},
+	{36, "AF_IEEE802154"},
+	{37, "AF_CAIF"},
+	{38, "AF_ALG"},
+	{39, "AF_NFC"},
+	{40, "AF_MAX"},
+};
+
+constexpr SymbolicName IP_PROTOCOLS[] = {
 	// Info from: <linux/in.h>
-	symbolicNamesMap[0] = "IPPROTO_IP";
-	symbolicNamesMap[1] = "IPPROTO_ICMP";
-	symbolicNamesMap[2] = "IPPROTO_IGMP";
-	symbolicNamesMap[4] = "IPPROTO_IPIP";
-	symbolicNamesMap[6] = "IPPROTO_TCP";
-	symbolicNamesMap[8] = "IPPROTO_EGP";
-	symbolicNamesMap[12] = "IPPROTO_PUP";
-	symbolicNamesMap[17] = "IPPROTO_UDP";
-	symbolicNamesMap[22] = "IPPROTO_IDP";
-	symbolicNamesMap[33] = "IPPROTO_DCCP";
-	symbolicNamesMap[46] = "IPPROTO_RSVP";
-	symbolicNamesMap[47] = "IPPROTO_GRE";
-	symbolicNamesMap[41] = "IPPROTO_IPV6";
-	symbolicNamesMap[50] = "IPPROTO_ESP";
-	symbolicNamesMap[51] = "IPPROTO_AH";
-	symbolicNamesMap[94] = "IPPROTO_BEETPH";
-	symbolicNamesMap[103] = "IPPROTO_PIM" ;
-	symbolicNamesMap[108] = "IPPROTO_COMP";
-	symbolicNamesMap[132] = "IPPROTO_SCTP";
-	symbolicNamesMap[136] = "IPPROTO_UDPLITE";
-	symbolicNamesMap[255] = "IPPROTO_RAW";
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_END()
-
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_BEGIN(getSymbolicNamesForSocketTypes)
+	{0, "IPPROTO_IP"},
+	{1, "IPPROTO_ICMP"},
+	{2, "IPPROTO_IGMP"},
+	{4, "IPPROTO_IPIP"},
+	{6, "IPPROTO_TCP"},
+	{8, "IPPROTO_EGP"},
+	{12, "IPPROTO_PUP"},
+	{17, "IPPROTO_UDP"},
+	{22, "IPPROTO_IDP"},
+	{33, "IPPROTO_DCCP"},
+	{46, "IPPROTO_RSVP"},
+	{47, "IPPROTO_GRE"},
+	{41, "IPPROTO_IPV6"},
+	{50, "IPPROTO_ESP"},
+	{51, "IPPROTO_AH"},
+	{94, "IPPROTO_BEETPH"},
+	{103, "IPPROTO_PIM"},
+	{108, "IPPROTO_COMP"},
+	{132, "IPPROTO_SCTP"},
+	{136, "IPPROTO_UDPLITE"},
+	{255, "IPPROTO_RAW"},
+};
+
+constexpr SymbolicName SOCKET_TYPES[] = {
 	// Info from: <bits/socket_type.h>
-	symbolicNamesMap[1] = "SOCK_STREAM";
-	symbolicNamesMap[2] = "SOCK_DGRAM";
-	symbolicNamesMap[3] = "SOCK_RAW";
-	symbolicNamesMap[4] = "SOCK_RDM";
-	symbolicNamesMap[5] = "SOCK_SEQPACKET";
-	symbolicNamesMap[6] = "SOCK_DCCP";
-	symbolicNamesMap[10] = "SOCK_PACKET";
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_END()
-
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_BEGIN(getSymbolicNamesForSocketLevels)
+	{1, "SOCK_STREAM"},
+	{2, "SOCK_DGRAM"},
+	{3, "SOCK_RAW"},
+	{4, "SOCK_RDM"},
+	{5, "SOCK_SEQPACKET"},
+	{6, "SOCK_DCCP"},
+	{10, "SOCK_PACKET"},
+};
+
+constexpr SymbolicName SOCKET_LEVELS[] = {
 	// Info from: <bits/in.h>
-	symbolicNamesMap[0] = "SOL_IP";
-	symbolicNamesMap[41] = "SOL_IPV6";
-	symbolicNamesMap[58] = "SOL_ICMPV6";
+	{0, "SOL_IP"},
+	{41, "SOL_IPV6"},
+	{58, "SOL_ICMPV6"},
 	// Info from: <bits/socket.h>
-	symbolicNamesMap[255] = "SOL_RAW";
-	symbolicNamesMap[261] = "SOL_DECNET";
-	symbolicNamesMap[262] = "SOL_X25";
-	symbolicNamesMap[263] = "SOL_PACKET";
-	symbolicNamesMap[264] = "SOL_ATM";
-	symbolicNamesMap[265] = "SOL_AAL";
-	symbolicNamesMap[266] = "SOL_IRDA";
+	{255, "SOL_RAW"},
+	{261, "SOL_DECNET"},
+	{262, "SOL_X25"},
+	{263, "SOL_PACKET"},
+	{264, "SOL_ATM"},
+	{265, "SOL_AAL"},
+	{266, "SOL_IRDA"},
 	// Info from: <asm-generic/socket.h>
-	symbolicNamesMap[1] = "SOL_SOCKET";
+	{1, "SOL_SOCKET"},
 	// Info from: <netipx/ipx.h>
-	symbolicNamesMap[256] = "SOL_IPX";
+	{256, "SOL_IPX"},
 	// Info from: <netax25/ax25.h>
-	symbolicNamesMap[257] = "SOL_AX25";
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_END()
+	{257, "SOL_AX25"},
+};
 
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_BEGIN(getSymbolicNamesForSocketOptions)
+constexpr SymbolicName SOCKET_OPTIONS[] = {
 	// Info from: <asm-generic/socket.h>
-	symbolicNamesMap[1] = "SOL_SOCKET";
-	symbolicNamesMap[1] = "SO_DEBUG";
-	symbolicNamesMap[2] = "SO_REUSEADDR";
-	symbolicNamesMap[3] = "SO_TYPE";
-	symbolicNamesMap[4] = "SO_ERROR";
-	symbolicNamesMap[5] = "SO_DONTROUTE";
-	symbolicNamesMap[6] = "SO_BROADCAST";
-	symbolicNamesMap[7] = "SO_SNDBUF";
-	symbolicNamesMap[8] = "SO_RCVBUF";
-	symbolicNamesMap[9] = "SO_KEEPALIVE";
-	symbolicNamesMap[10] = "SO_OOBINLINE";
-	symbolicNamesMap[11] = "SO_NO_CHECK";
-	symbolicNamesMap[12] = "SO_PRIORITY";
-	symbolicNamesMap[13] = "SO_LINGER";
-	symbolicNamesMap[14] = "SO_BSDCOMPAT";
-	symbolicNamesMap[15] = "SO_REUSEPORT";
-	symbolicNamesMap[16] = "SO_PASSCRED";
-	symbolicNamesMap[17] = "SO_PEERCRED";
-	symbolicNamesMap[18] = "SO_RCVLOWAT";
-	symbolicNamesMap[19] = "SO_SNDLOWAT";
-	symbolicNamesMap[20] = "SO_RCVTIMEO";
-	symbolicNamesMap[21] = "SO_SNDTIMEO";
-	symbolicNamesMap[22] = "SO_SECURITY_AUTHENTICATION";
-	symbolicNamesMap[23] = "SO_SECURITY_ENCRYPTION_TRANSPORT";
-	symbolicNamesMap[24] = "SO_SECURITY_ENCRYPTION_NETWORK";
-	symbolicNamesMap[25] = "SO_BINDTODEVICE";
-	symbolicNamesMap[26] = "SO_ATTACH_FILTER";
-	// symbolicNamesMap[26] = "SO_GET_FILTER"; // synonym for SO_ATTACH_FILTER
-	symbolicNamesMap[27] = "SO_DETACH_FILTER";
-	symbolicNamesMap[28] = "SO_PEERNAME";
-	symbolicNamesMap[29] = "SO_TIMESTAMP";
-	symbolicNamesMap[30] = "SO_ACCEPTCONN";
-	symbolicNamesMap[31] = "SO_PEERSEC";
-	symbolicNamesMap[32] = "SO_SNDBUFFORCE";
-	symbolicNamesMap[33] = "SO_RCVBUFFORCE";
-	symbolicNamesMap[34] = "SO_PASSSEC";
-	symbolicNamesMap[35] = "SO_TIMESTAMPNS";
-	symbolicNamesMap[36] = "SO_MARK";
-	symbolicNamesMap[37] = "SO_TIMESTAMPING";
-	symbolicNamesMap[38] = "SO_PROTOCOL";
-	symbolicNamesMap[39] = "SO_DOMAIN";
-	symbolicNamesMap[40] = "SO_RXQ_OVFL";
-	symbolicNamesMap[41] = "SO_WIFI_STATUS";
-	symbolicNamesMap[42] = "SO_PEEK_OFF";
-	symbolicNamesMap[43] = "SO_NOFCS";
-	symbolicNamesMap[44] = "SO_LOCK_FILTER";
-	symbolicNamesMap[45] = "SO_SELECT_ERR_QUEUE";
-	symbolicNamesMap[46] = "SO_BUSY_POLL";
-	symbolicNamesMap[47] = "SO_MAX_PACING_RATE";
-	symbolicNamesMap[48] = "SO_BPF_EXTENSIONS";
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_END()
-
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_BEGIN(getSymbolicNamesForMessageFlags)
+	{1, "SOL_SOCKET"},
+	{1, "SO_DEBUG"},
+	{2, "SO_REUSEADDR"},
+	{3, "SO_TYPE"},
+	{4, "SO_ERROR"},
+	{5, "SO_DONTROUTE"},
+	{6, "SO_BROADCAST"},
+	{7, "SO_SNDBUF"},
+	{8, "SO_RCVBUF"},
+	{9, "SO_KEEPALIVE"},
+	{10, "SO_OOBINLINE"},
+	{11, "SO_NO_CHECK"},
+	{12, "SO_PRIORITY"},
+	{13, "SO_LINGER"},
+	{14, "SO_BSDCOMPAT"},
+	{15, "SO_REUSEPORT"},
+	{16, "SO_PASSCRED"},
+	{17, "SO_PEERCRED"},
+	{18, "SO_RCVLOWAT"},
+	{19, "SO_SNDLOWAT"},
+	{20, "SO_RCVTIMEO"},
+	{21, "SO_SNDTIMEO"},
+	{22, "SO_SECURITY_AUTHENTICATION"},
+	{23, "SO_SECURITY_ENCRYPTION_TRANSPORT"},
+	{24, "SO_SECURITY_ENCRYPTION_NETWORK"},
+	{25, "SO_BINDTODEVICE"},
+	{26, "SO_ATTACH_FILTER"},
+	// {26, "SO_GET_FILTER"}, // synonym for SO_ATTACH_FILTER
+	{27, "SO_DETACH_FILTER"},
+	{28, "SO_PEERNAME"},
+	{29, "SO_TIMESTAMP"},
+	{30, "SO_ACCEPTCONN"},
+	{31, "SO_PEERSEC"},
+	{32, "SO_SNDBUFFORCE"},
+	{33, "SO_RCVBUFFORCE"},
+	{34, "SO_PASSSEC"},
+	{35, "SO_TIMESTAMPNS"},
+	{36, "SO_MARK"},
+	{37, "SO_TIMESTAMPING"},
+	{38, "SO_PROTOCOL"},
+	{39, "SO_DOMAIN"},
+	{40, "SO_RXQ_OVFL"},
+	{41, "SO_WIFI_STATUS"},
+	{42, "SO_PEEK_OFF"},
+	{43, "SO_NOFCS"},
+	{44, "SO_LOCK_FILTER"},
+	{45, "SO_SELECT_ERR_QUEUE"},
+	{46, "SO_BUSY_POLL"},
+	{47, "SO_MAX_PACING_RATE"},
+	{48, "SO_BPF_EXTENSIONS"},
+};
+
+constexpr SymbolicName MESSAGE_FLAGS[] = {
 	// Info from: <bits/socket.h>
-	symbolicNamesMap[0x01] = "MSG_OOB";
-	symbolicNamesMap[0x02] = "MSG_PEEK";
-	symbolicNamesMap[0x04] = "MSG_DONTROUTE";
-	symbolicNamesMap[0x08] = "MSG_CTRUNC";
-	symbolicNamesMap[0x10] = "MSG_PROXY";
-	symbolicNamesMap[0x20] = "MSG_TRUNC";
-	symbolicNamesMap[0x40] = "MSG_DONTWAIT";
-	symbolicNamesMap[0x80] = "MSG_EOR";
-	symbolicNamesMap[0x100] = "MSG_WAITALL";
-	symbolicNamesMap[0x200] = "MSG_FIN";
-	symbolicNamesMap[0x400] = "MSG_SYN";
-	symbolicNamesMap[0x800] = "MSG_CONFIRM";
-	symbolicNamesMap[0x1000] = "MSG_RST";
-	symbolicNamesMap[0x2000] = "MSG_ERRQUEUE";
-	symbolicNamesMap[0x4000] = "MSG_NOSIGNAL";
-	symbolicNamesMap[0x8000] = "MSG_MORE";
-	symbolicNamesMap[0x10000] = "MSG_WAITFORONE";
-	symbolicNamesMap[0x20000000] = "MSG_FASTOPEN";
-	symbolicNamesMap[0x40000000] = "MSG_CMSG_CLOEXEC";
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_END()
-
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_BEGIN(getSymbolicNamesForSystemCalls)
+	{0x01, "MSG_OOB"},
+	{0x02, "MSG_PEEK"},
+	{0x04, "MSG_DONTROUTE"},
+	{0x08, "MSG_CTRUNC"},
+	{0x10, "MSG_PROXY"},
+	{0x20, "MSG_TRUNC"},
+	{0x40, "MSG_DONTWAIT"},
+	{0x80, "MSG_EOR"},
+	{0x100, "MSG_WAITALL"},
+	{0x200, "MSG_FIN"},
+	{0x400, "MSG_SYN"},
+	{0x800, "MSG_CONFIRM"},
+	{0x1000, "MSG_RST"},
+	{0x2000, "MSG_ERRQUEUE"},
+	{0x4000, "MSG_NOSIGNAL"},
+	{0x8000, "MSG_MORE"},
+	{0x10000, "MSG_WAITFORONE"},
+	{0x20000000, "MSG_FASTOPEN"},
+	{0x40000000, "MSG_CMSG_CLOEXEC"},
+};
+
+constexpr SymbolicName SYSTEM_CALLS[] = {
 	// Info from: <bits/syscall.h>
 	//            <asm/unistd_32.h>
-	symbolicNamesMap[0] = "SYS_restart_syscall";
-	symbolicNamesMap[1] = "SYS_exit";
-	symbolicNamesMap[2] = "SYS_fork";
-	symbolicNamesMap[3] = "SYS_read";
-	symbolicNamesMap[4] = "SYS_write";
-	symbolicNamesMap[5] = "SYS_open";
-	symbolicNamesMap[6] = "SYS_close";
-	symbolicNamesMap[7] = "SYS_waitpid";
-	symbolicNamesMap[8] = "SYS_creat";
-	symbolicNamesMap[9] = "SYS_link";
-	symbolicNamesMap[10] = "SYS_unlink";
-	symbolicNamesMap[11] = "SYS_execve";
-	symbolicNamesMap[12] = "SYS_chdir";
-	symbolicNamesMap[13] = "SYS_time";
-	symbolicNamesMap[14] = "SYS_mknod";
-	symbolicNamesMap[15] = "SYS_chmod";
-	symbolicNamesMap[16] = "SYS_lchown";
-	symbolicNamesMap[17] = "SYS_break";
-	symbolicNamesMap[18] = "SYS_oldstat";
-	symbolicNamesMap[19] = "SYS_lseek";
-	symbolicNamesMap[20] = "SYS_getpid";
-	symbolicNamesMap[21] = "SYS_mount";
-	symbolicNamesMap[22] = "SYS_umount";
-	symbolicNamesMap[23] = "SYS_setuid";
-	symbolicNamesMap[24] = "SYS_getuid";
-	symbolicNamesMap[25] = "SYS_stime";
-	symbolicNamesMap[26] = "SYS_ptrace";
-	symbolicNamesMap[27] = "SYS_alarm";
-	symbolicNamesMap[28] = "SYS_oldfstat";
-	symbolicNamesMap[29] = "SYS_pause";
-	symbolicNamesMap[30] = "SYS_utime";
-	symbolicNamesMap[31] = "SYS_stty";
-	symbolicNamesMap[32] = "SYS_gtty";
-	symbolicNamesMap[33] = "SYS_access";
-	symbolicNamesMap[34] = "SYS_nice";
-	symbolicNamesMap[35] = "SYS_ftime";
-	symbolicNamesMap[36] = "SYS_sync";
-	symbolicNamesMap[37] = "SYS_kill";
-	symbolicNamesMap[38] = "SYS_rename";
-	symbolicNamesMap[39] = "SYS_mkdir";
-	symbolicNamesMap[40] = "SYS_rmdir";
-	symbolicNamesMap[41] = "SYS_dup";
-	symbolicNamesMap[42] = "SYS_pipe";
-	symbolicNamesMap[43] = "SYS_times";
-	symbolicNamesMap[44] = "SYS_prof";
-	symbolicNamesMap[45] = "SYS_brk";
-	symbolicNamesMap[46] = "SYS_setgid";
-	symbolicNamesMap[47] = "SYS_getgid";
-	symbolicNamesMap[48] = "SYS_signal";
-	symbolicNamesMap[49] = "SYS_geteuid";
-	symbolicNamesMap[50] = "SYS_getegid";
-	symbolicNamesMap[51] = "SYS_acct";
-	symbolicNamesMap[52] = "SYS_umount2";
-	symbolicNamesMap[53] = "SYS_lock";
-	symbolicNamesMap[54] = "SYS_ioctl";
-	symbolicNamesMap[55] = "SYS_fcntl";
-	symbolicNamesMap[56] = "SYS_mpx";
-	symbolicNamesMap[57] = "SYS_setpgid";
-	symbolicNamesMap[58] = "SYS_ulimit";
-	symbolicNamesMap[59] = "SYS_oldolduname";
-	symbolicNamesMap[60] = "SYS_umask";
-	symbolicNamesMap[61] = "SYS_chroot";
-	symbolicNamesMap[62] = "SYS_ustat";
-	symbolicNamesMap[63] = "SYS_dup2";
-	symbolicNamesMap[64] = "SYS_getppid";
-	symbolicNamesMap[65] = "SYS_getpgrp";
-	symbolicNamesMap[66] = "SYS_setsid";
-	symbolicNamesMap[67] = "SYS_sigaction";
-	symbolicNamesMap[68] = "SYS_sgetmask";
-	symbolicNamesMap[69] = "SYS_ssetmask";
-	symbolicNamesMap[70] = "SYS_setreuid";
-	symbolicNamesMap[71] = "SYS_setregid";
-	symbolicNamesMap[72] = "SYS_sigsuspend";
-	symbolicNamesMap[73] = "SYS_sigpending";
-	symbolicNamesMap[74] = "SYS_sethostname";
-	symbolicNamesMap[75] = "SYS_setrlimit";
-	symbolicNamesMap[76] = "SYS_getrlimit";
-	symbolicNamesMap[77] = "SYS_getrusage";
-	symbolicNamesMap[78] = "SYS_gettimeofday";
-	symbolicNamesMap[79] = "SYS_settimeofday";
-	symbolicNamesMap[80] = "SYS_getgroups";
-	symbolicNamesMap[81] = "SYS_setgroups";
-	symbolicNamesMap[82] = "SYS_select";
-	symbolicNamesMap[83] = "SYS_symlink";
-	symbolicNamesMap[84] = "SYS_oldlstat";
-	symbolicNamesMap[85] = "SYS_readlink";
-	symbolicNamesMap[86] = "SYS_uselib";
-	symbolicNamesMap[87] = "SYS_swapon";
-	symbolicNamesMap[88] = "SYS_reboot";
-	symbolicNamesMap[89] = "SYS_readdir";
-	symbolicNamesMap[90] = "SYS_mmap";
-	symbolicNamesMap[91] = "SYS_munmap";
-	symbolicNamesMap[92] = "SYS_truncate";
-	symbolicNamesMap[93] = "SYS_ftruncate";
-	symbolicNamesMap[94] = "SYS_fchmod";
-	symbolicNamesMap[95] = "SYS_fchown";
-	symbolicNamesMap[96] = "SYS_getpriority";
-	symbolicNamesMap[97] = "SYS_setpriority";
-	symbolicNamesMap[98] = "SYS_profil";
-	symbolicNamesMap[99] = "SYS_statfs";
-	symbolicNamesMap[100] = "SYS_fstatfs";
-	symbolicNamesMap[101] = "SYS_ioperm";
-	symbolicNamesMap[102] = "SYS_socketcall";
-	symbolicNamesMap[103] = "SYS_syslog";
-	symbolicNamesMap[104] = "SYS_setitimer";
-	symbolicNamesMap[105] = "SYS_getitimer";
-	symbolicNamesMap[106] = "SYS_stat";
-	symbolicNamesMap[107] = "SYS_lstat";
-	symbolicNamesMap[108] = "SYS_fstat";
-	symbolicNamesMap[109] = "SYS_olduname";
-	symbolicNamesMap[110] = "SYS_iopl";
-	symbolicNamesMap[111] = "SYS_vhangup";
-	symbolicNamesMap[112] = "SYS_idle";
-	symbolicNamesMap[113] = "SYS_vm86old";
-	symbolicNamesMap[114] = "SYS_wait4";
-	symbolicNamesMap[115] = "SYS_swapoff";
-	symbolicNamesMap[116] = "SYS_sysinfo";
-	symbolicNamesMap[117] = "SYS_ipc";
-	symbolicNamesMap[118] = "SYS_fsync";
-	symbolicNamesMap[119] = "SYS_sigreturn";
-	symbolicNamesMap[120] = "SYS_clone";
-	symbolicNamesMap[121] = "SYS_setdomainname";
-	symbolicNamesMap[122] = "SYS_uname";
-	symbolicNamesMap[123] = "SYS_modify_ldt";
-	symbolicNamesMap[124] = "SYS_adjtimex";
-	symbolicNamesMap[125] = "SYS_mprotect";
-	symbolicNamesMap[126] = "SYS_sigprocmask";
-	symbolicNamesMap[127] = "SYS_create_module";
-	symbolicNamesMap[128] = "SYS_init_module";
-	symbolicNamesMap[129] = "SYS_delete_module";
-	symbolicNamesMap[130] = "SYS_get_kernel_syms";
-	symbolicNamesMap[131] = "SYS_quotactl";
-	symbolicNamesMap[132] = "SYS_getpgid";
-	symbolicNamesMap[133] = "SYS_fchdir";
-	symbolicNamesMap[134] = "SYS_bdflush";
-	symbolicNamesMap[135] = "SYS_sysfs";
-	symbolicNamesMap[136] = "SYS_personality";
-	symbolicNamesMap[137] = "SYS_afs_syscall";
-	symbolicNamesMap[138] = "SYS_setfsuid";
-	symbolicNamesMap[139] = "SYS_setfsgid";
-	symbolicNamesMap[140] = "SYS__llseek";
-	symbolicNamesMap[141] = "SYS_getdents";
-	symbolicNamesMap[142] = "SYS__newselect";
-	symbolicNamesMap[143] = "SYS_flock";
-	symbolicNamesMap[144] = "SYS_msync";
-	symbolicNamesMap[145] = "SYS_readv";
-	symbolicNamesMap[146] = "SYS_writev";
-	symbolicNamesMap[147] = "SYS_getsid";
-	symbolicNamesMap[148] = "SYS_fdatasync";
-	symbolicNamesMap[149] = "SYS__sysctl";
-	symbolicNamesMap[150] = "SYS_mlock";
-	symbolicNamesMap[151] = "SYS_munlock";
-	symbolicNamesMap[152] = "SYS_mlockall";
-	symbolicNamesMap[153] = "SYS_munlockall";
-	symbolicNamesMap[154] = "SYS_sched_setparam";
-	symbolicNamesMap[155] = "SYS_sched_getparam";
-	symbolicNamesMap[156] = "SYS_sched_setscheduler";
-	symbolicNamesMap[157] = "SYS_sched_getscheduler";
-	symbolicNamesMap[158] = "SYS_sched_yield";
-	symbolicNamesMap[159] = "SYS_sched_get_priority_max";
-	symbolicNamesMap[160] = "SYS_sched_get_priority_min";
-	symbolicNamesMap[161] = "SYS_sched_rr_get_interval";
-	symbolicNamesMap[162] = "SYS_nanosleep";
-	symbolicNamesMap[163] = "SYS_mremap";
-	symbolicNamesMap[164] = "SYS_setresuid";
-	symbolicNamesMap[165] = "SYS_getresuid";
-	symbolicNamesMap[166] = "SYS_vm86";
-	symbolicNamesMap[167] = "SYS_query_module";
-	symbolicNamesMap[168] = "SYS_poll";
-	symbolicNamesMap[169] = "SYS_nfsservctl";
-	symbolicNamesMap[170] = "SYS_setresgid";
-	symbolicNamesMap[171] = "SYS_getresgid";
-	symbolicNamesMap[172] = "SYS_prctl";
-	symbolicNamesMap[173] = "SYS_rt_sigreturn";
-	symbolicNamesMap[174] = "SYS_rt_sigaction";
-	symbolicNamesMap[175] = "SYS_rt_sigprocmask";
-	symbolicNamesMap[176] = "SYS_rt_sigpending";
-	symbolicNamesMap[177] = "SYS_rt_sigtimedwait";
-	symbolicNamesMap[178] = "SYS_rt_sigqueueinfo";
-	symbolicNamesMap[179] = "SYS_rt_sigsuspend";
-	symbolicNamesMap[180] = "SYS_pread64";
-	symbolicNamesMap[181] = "SYS_pwrite64";
-	symbolicNamesMap[182] = "SYS_chown";
-	symbolicNamesMap[183] = "SYS_getcwd";
-	symbolicNamesMap[184] = "SYS_capget";
-	symbolicNamesMap[185] = "SYS_capset";
-	symbolicNamesMap[186] = "SYS_sigaltstack";
-	symbolicNamesMap[187] = "SYS_sendfile";
-	symbolicNamesMap[188] = "SYS_getpmsg";
-	symbolicNamesMap[189] = "SYS_putpmsg";
-	symbolicNamesMap[190] = "SYS_vfork";
-	symbolicNamesMap[191] = "SYS_ugetrlimit";
-	symbolicNamesMap[192] = "SYS_mmap2";
-	symbolicNamesMap[193] = "SYS_truncate64";
-	symbolicNamesMap[194] = "SYS_ftruncate64";
-	symbolicNamesMap[195] = "SYS_stat64";
-	symbolicNamesMap[196] = "SYS_lstat64";
-	symbolicNamesMap[197] = "SYS_fstat64";
-	symbolicNamesMap[198] = "SYS_lchown32";
-	symbolicNamesMap[199] = "SYS_getuid32";
-	symbolicNamesMap[200] = "SYS_getgid32";
-	symbolicNamesMap[201] = "SYS_geteuid32";
-	symbolicNamesMap[202] = "SYS_getegid32";
-	symbolicNamesMap[203] = "SYS_setreuid32";
-	symbolicNamesMap[204] = "SYS_setregid32";
-	symbolicNamesMap[205] = "SYS_getgroups32";
-	symbolicNamesMap[206] = "SYS_setgroups32";
-	symbolicNamesMap[207] = "SYS_fchown32";
-	symbolicNamesMap[208] = "SYS_setresuid32";
-	symbolicNamesMap[209] = "SYS_getresuid32";
-	symbolicNamesMap[210] = "SYS_setresgid32";
-	symbolicNamesMap[211] = "SYS_getresgid32";
-	symbolicNamesMap[212] = "SYS_chown32";
-	symbolicNamesMap[213] = "SYS_setuid32";
-	symbolicNamesMap[214] = "SYS_setgid32";
-	symbolicNamesMap[215] = "SYS_setfsuid32";
-	symbolicNamesMap[216] = "SYS_setfsgid32";
-	symbolicNamesMap[217] = "SYS_pivot_root";
-	symbolicNamesMap[218] = "SYS_mincore";
-	symbolicNamesMap[219] = "SYS_madvise";
-	symbolicNamesMap[220] = "SYS_getdents64";
-	symbolicNamesMap[221] = "SYS_fcntl64";
-	symbolicNamesMap[224] = "SYS_gettid";
-	symbolicNamesMap[225] = "SYS_readahead";
-	symbolicNamesMap[226] = "SYS_setxattr";
-	symbolicNamesMap[227] = "SYS_lsetxattr";
-	symbolicNamesMap[228] = "SYS_fsetxattr";
-	symbolicNamesMap[229] = "SYS_getxattr";
-	symbolicNamesMap[230] = "SYS_lgetxattr";
-	symbolicNamesMap[231] = "SYS_fgetxattr";
-	symbolicNamesMap[232] = "SYS_listxattr";
-	symbolicNamesMap[233] = "SYS_llistxattr";
-	symbolicNamesMap[234] = "SYS_flistxattr";
-	symbolicNamesMap[235] = "SYS_removexattr";
-	symbolicNamesMap[236] = "SYS_lremovexattr";
-	symbolicNamesMap[237] = "SYS_fremovexattr";
-	symbolicNamesMap[238] = "SYS_tkill";
-	symbolicNamesMap[239] = "SYS_sendfile64";
-	symbolicNamesMap[240] = "SYS_futex";
-	symbolicNamesMap[241] = "SYS_sched_setaffinity";
-	symbolicNamesMap[242] = "SYS_sched_getaffinity";
-	symbolicNamesMap[243] = "SYS_set_thread_area";
-	symbolicNamesMap[244] = "SYS_get_thread_area";
-	symbolicNamesMap[245] = "SYS_io_setup";
-	symbolicNamesMap[246] = "SYS_io_destroy";
-	symbolicNamesMap[247] = "SYS_io_getevents";
-	symbolicNamesMap[248] = "SYS_io_submit";
-	symbolicNamesMap[249] = "SYS_io_cancel";
-	symbolicNamesMap[250] = "SYS_fadvise64";
-	symbolicNamesMap[252] = "SYS_exit_group";
-	symbolicNamesMap[253] = "SYS_lookup_dcookie";
-	symbolicNamesMap[254] = "SYS_epoll_create";
-	symbolicNamesMap[255] = "SYS_epoll_ctl";
-	symbolicNamesMap[256] = "SYS_epoll_wait";
-	symbolicNamesMap[257] = "SYS_remap_file_pages";
-	symbolicNamesMap[258] = "SYS_set_tid_address";
-	symbolicNamesMap[259] = "SYS_timer_create";
-	symbolicNamesMap[260] = "SYS_timer_settime";
-	symbolicNamesMap[261] = "SYS_timer_gettime";
-	symbolicNamesMap[262] = "SYS_timer_getoverrun";
-	symbolicNamesMap[263] = "SYS_timer_delete";
-	symbolicNamesMap[264] = "SYS_clock_settime";
-	symbolicNamesMap[265] = "SYS_clock_gettime";
-	symbolicNamesMap[266] = "SYS_clock_getres";
-	symbolicNamesMap[267] = "SYS_clock_nanosleep";
-	symbolicNamesMap[268] = "SYS_statfs64";
-	symbolicNamesMap[269] = "SYS_fstatfs64";
-	symbolicNamesMap[270] = "SYS_tgkill";
-	symbolicNamesMap[271] = "SYS_utimes";
-	symbolicNamesMap[272] = "SYS_fadvise64_64";
-	symbolicNamesMap[273] = "SYS_vserver";
-	symbolicNamesMap[274] = "SYS_mbind";
-	symbolicNamesMap[275] = "SYS_get_mempolicy";
-	symbolicNamesMap[276] = "SYS_set_mempolicy";
-	symbolicNamesMap[277] = "SYS_mq_open";
-	symbolicNamesMap[278] = "SYS_mq_unlink";
-	symbolicNamesMap[279] = "SYS_mq_timedsend";
-	symbolicNamesMap[280] = "SYS_mq_timedreceive";
-	symbolicNamesMap[281] = "SYS_mq_notify";
-	symbolicNamesMap[282] = "SYS_mq_getsetattr";
-	symbolicNamesMap[283] = "SYS_kexec_load";
-	symbolicNamesMap[284] = "SYS_waitid";
-	symbolicNamesMap[286] = "SYS_add_key";
-	symbolicNamesMap[287] = "SYS_request_key";
-	symbolicNamesMap[288] = "SYS_keyctl";
-	symbolicNamesMap[289] = "SYS_ioprio_set";
-	symbolicNamesMap[290] = "SYS_ioprio_get";
-	symbolicNamesMap[291] = "SYS_inotify_init";
-	symbolicNamesMap[292] = "SYS_inotify_add_watch";
-	symbolicNamesMap[293] = "SYS_inotify_rm_watch";
-	symbolicNamesMap[294] = "SYS_migrate_pages";
-	symbolicNamesMap[295] = "SYS_openat";
-	symbolicNamesMap[296] = "SYS_mkdirat";
-	symbolicNamesMap[297] = "SYS_mknodat";
-	symbolicNamesMap[298] = "SYS_fchownat";
-	symbolicNamesMap[299] = "SYS_futimesat";
-	symbolicNamesMap[300] = "SYS_fstatat64";
-	symbolicNamesMap[301] = "SYS_unlinkat";
-	symbolicNamesMap[302] = "SYS_renameat";
-	symbolicNamesMap[303] = "SYS_linkat";
-	symbolicNamesMap[304] = "SYS_symlinkat";
-	symbolicNamesMap[305] = "SYS_readlinkat";
-	symbolicNamesMap[306] = "SYS_fchmodat";
-	symbolicNamesMap[307] = "SYS_faccessat";
-	symbolicNamesMap[308] = "SYS_pselect6";
-	symbolicNamesMap[309] = "SYS_ppoll";
-	symbolicNamesMap[310] = "SYS_unshare";
-	symbolicNamesMap[311] = "SYS_set_robust_list";
-	symbolicNamesMap[312] = "SYS_get_robust_list";
-	symbolicNamesMap[313] = "SYS_splice";
-	symbolicNamesMap[314] = "SYS_sync_file_range";
-	symbolicNamesMap[315] = "SYS_tee";
-	symbolicNamesMap[316] = "SYS_vmsplice";
-	symbolicNamesMap[317] = "SYS_move_pages";
-	symbolicNamesMap[318] = "SYS_getcpu";
-	symbolicNamesMap[319] = "SYS_epoll_pwait";
-	symbolicNamesMap[320] = "SYS_utimensat";
-	symbolicNamesMap[321] = "SYS_signalfd";
-	symbolicNamesMap[322] = "SYS_timerfd_create";
-	symbolicNamesMap[323] = "SYS_eventfd";
-	symbolicNamesMap[324] = "SYS_fallocate";
-	symbolicNamesMap[325] = "SYS_timerfd_settime";
-	symbolicNamesMap[326] = "SYS_timerfd_gettime";
-	symbolicNamesMap[327] = "SYS_signalfd4";
-	symbolicNamesMap[328] = "SYS_eventfd2";
-	symbolicNamesMap[329] = "SYS_epoll_create1";
-	symbolicNamesMap[330] = "SYS_dup3";
-	symbolicNamesMap[331] = "SYS_pipe2";
-	symbolicNamesMap[332] = "SYS_inotify_init1";
-	symbolicNamesMap[333] = "SYS_preadv";
-	symbolicNamesMap[334] = "SYS_pwritev";
-	symbolicNamesMap[335] = "SYS_rt_tgsigqueueinfo";
-	symbolicNamesMap[336] = "SYS_perf_event_open";
-	symbolicNamesMap[337] = "SYS_recvmmsg";
-	symbolicNamesMap[338] = "SYS_fanotify_init";
-	symbolicNamesMap[339] = "SYS_fanotify_mark";
-	symbolicNamesMap[340] = "SYS_prlimit64";
-	symbolicNamesMap[341] = "SYS_name_to_handle_at";
-	symbolicNamesMap[342] = "SYS_open_by_handle_at";
-	symbolicNamesMap[343] = "SYS_clock_adjtime";
-	symbolicNamesMap[344] = "SYS_syncfs";
-	symbolicNamesMap[345] = "SYS_sendmmsg";
-	symbolicNamesMap[346] = "SYS_setns";
-	symbolicNamesMap[347] = "SYS_process_vm_readv";
-	symbolicNamesMap[348] = "SYS_process_vm_writev";
-	symbolicNamesMap[349] = "SYS_kcmp";
-	symbolicNamesMap[350] = "SYS_finit_module";
-	symbolicNamesMap[351] = "SYS_sched_setattr";
-	symbolicNamesMap[352] = "SYS_sched_getattr";
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_END()
-
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_BEGIN(getSymbolicNamesForSeekWhence)
+	{0, "SYS_restart_syscall"},
+	{1, "SYS_exit"},
+	{2, "SYS_fork"},
+	{3, "SYS_read"},
+	{4, "SYS_write"},
+	{5, "SYS_open"},
+	{6, "SYS_close"},
+	{7, "SYS_waitpid"},
+	{8, "SYS_creat"},
+	{9, "SYS_link"},
+	{10, "SYS_unlink"},
+	{11, "SYS_execve"},
+	{12, "SYS_chdir"},
+	{13, "SYS_time"},
+	{14, "SYS_mknod"},
+	{15, "SYS_chmod"},
+	{16, "SYS_lchown"},
+	{17, "SYS_break"},
+	{18, "SYS_oldstat"},
+	{19, "SYS_lseek"},
+	{20, "SYS_getpid"},
+	{21, "SYS_mount"},
+	{22, "SYS_umount"},
+	{23, "SYS_setuid"},
+	{24, "SYS_getuid"},
+	{25, "SYS_stime"},
+	{26, "SYS_ptrace"},
+	{27, "SYS_alarm"},
+	{28, "SYS_oldfstat"},
+	{29, "SYS_pause"},
+	{30, "SYS_utime"},
+	{31, "SYS_stty"},
+	{32, "SYS_gtty"},
+	{33, "SYS_access"},
+	{34, "SYS_nice"},
+	{35, "SYS_ftime"},
+	{36, "SYS_sync"},
+	{37, "SYS_kill"},
+	{38, "SYS_rename"},
+	{39, "SYS_mkdir"},
+	{40, "SYS_rmdir"},
+	{41, "SYS_dup"},
+	{42, "SYS_pipe"},
+	{43, "SYS_times"},
+	{44, "SYS_prof"},
+	{45, "SYS_brk"},
+	{46, "SYS_setgid"},
+	{47, "SYS_getgid"},
+	{48, "SYS_signal"},
+	{49, "SYS_geteuid"},
+	{50, "SYS_getegid"},
+	{51, "SYS_acct"},
+	{52, "SYS_umount2"},
+	{53, "SYS_lock"},
+	{54, "SYS_ioctl"},
+	{55, "SYS_fcntl"},
+	{56, "SYS_mpx"},
+	{57, "SYS_setpgid"},
+	{58, "SYS_ulimit"},
+	{59, "SYS_oldolduname"},
+	{60, "SYS_umask"},
+	{61, "SYS_chroot"},
+	{62, "SYS_ustat"},
+	{63, "SYS_dup2"},
+	{64, "SYS_getppid"},
+	{65, "SYS_getpgrp"},
+	{66, "SYS_setsid"},
+	{67, "SYS_sigaction"},
+	{68, "SYS_sgetmask"},
+	{69, "SYS_ssetmask"},
+	{70, "SYS_setreuid"},
+	{71, "SYS_setregid"},
+	{72, "SYS_sigsuspend"},
+	{73, "SYS_sigpending"},
+	{74, "SYS_sethostname"},
+	{75, "SYS_setrlimit"},
+	{76, "SYS_getrlimit"},
+	{77, "SYS_getrusage"},
+	{78, "SYS_gettimeofday"},
+	{79, "SYS_settimeofday"},
+	{80, "SYS_getgroups"},
+	{81, "SYS_setgroups"},
+	{82, "SYS_select"},
+	{83, "SYS_symlink"},
+	{84, "SYS_oldlstat"},
+	{85, "SYS_readlink"},
+	{86, "SYS_uselib"},
+	{87, "SYS_swapon"},
+	{88, "SYS_reboot"},
+	{89, "SYS_readdir"},
+	{90, "SYS_mmap"},
+	{91, "SYS_munmap"},
+	{92, "SYS_truncate"},
+	{93, "SYS_ftruncate"},
+	{94, "SYS_fchmod"},
+	{95, "SYS_fchown"},
+	{96, "SYS_getpriority"},
+	{97, "SYS_setpriority"},
+	{98, "SYS_profil"},
+	{99, "SYS_statfs"},
+	{100, "SYS_fstatfs"},
+	{101, "SYS_ioperm"},
+	{102, "SYS_socketcall"},
+	{103, "SYS_syslog"},
+	{104, "SYS_setitimer"},
+	{105, "SYS_getitimer"},
+	{106, "SYS_stat"},
+	{107, "SYS_lstat"},
+	{108, "SYS_fstat"},
+	{109, "SYS_olduname"},
+	{110, "SYS_iopl"},
+	{111, "SYS_vhangup"},
+	{112, "SYS_idle"},
+	{113, "SYS_vm86old"},
+	{114, "SYS_wait4"},
+	{115, "SYS_swapoff"},
+	{116, "SYS_sysinfo"},
+	{117, "SYS_ipc"},
+	{118, "SYS_fsync"},
+	{119, "SYS_sigreturn"},
+	{120, "SYS_clone"},
+	{121, "SYS_setdomainname"},
+	{122, "SYS_uname"},
+	{123, "SYS_modify_ldt"},
+	{124, "SYS_adjtimex"},
+	{125, "SYS_mprotect"},
+	{126, "SYS_sigprocmask"},
+	{127, "SYS_create_module"},
+	{128, "SYS_init_module"},
+	{129, "SYS_delete_module"},
+	{130, "SYS_get_kernel_syms"},
+	{131, "SYS_quotactl"},
+	{132, "SYS_getpgid"},
+	{133, "SYS_fchdir"},
+	{134, "SYS_bdflush"},
+	{135, "SYS_sysfs"},
+	{136, "SYS_personality"},
+	{137, "SYS_afs_syscall"},
+	{138, "SYS_setfsuid"},
+	{139, "SYS_setfsgid"},
+	{140, "SYS__llseek"},
+	{141, "SYS_getdents"},
+	{142, "SYS__newselect"},
+	{143, "SYS_flock"},
+	{144, "SYS_msync"},
+	{145, "SYS_readv"},
+	{146, "SYS_writev"},
+	{147, "SYS_getsid"},
+	{148, "SYS_fdatasync"},
+	{149, "SYS__sysctl"},
+	{150, "SYS_mlock"},
+	{151, "SYS_munlock"},
+	{152, "SYS_mlockall"},
+	{153, "SYS_munlockall"},
+	{154, "SYS_sched_setparam"},
+	{155, "SYS_sched_getparam"},
+	{156, "SYS_sched_setscheduler"},
+	{157, "SYS_sched_getscheduler"},
+	{158, "SYS_sched_yield"},
+	{159, "SYS_sched_get_priority_max"},
+	{160, "SYS_sched_get_priority_min"},
+	{161, "SYS_sched_rr_get_interval"},
+	{162, "SYS_nanosleep"},
+	{163, "SYS_mremap"},
+	{164, "SYS_setresuid"},
+	{165, "SYS_getresuid"},
+	{166, "SYS_vm86"},
+	{167, "SYS_query_module"},
+	{168, "SYS_poll"},
+	{169, "SYS_nfsservctl"},
+	{170, "SYS_setresgid"},
+	{171, "SYS_getresgid"},
+	{172, "SYS_prctl"},
+	{173, "SYS_rt_sigreturn"},
+	{174, "SYS_rt_sigaction"},
+	{175, "SYS_rt_sigprocmask"},
+	{176, "SYS_rt_sigpending"},
+	{177, "SYS_rt_sigtimedwait"},
+	{178, "SYS_rt_sigqueueinfo"},
+	{179, "SYS_rt_sigsuspend"},
+	{180, "SYS_pread64"},
+	{181, "SYS_pwrite64"},
+	{182, "SYS_chown"},
+	{183, "SYS_getcwd"},
+	{184, "SYS_capget"},
+	{185, "SYS_capset"},
+	{186, "SYS_sigaltstack"},
+	{187, "SYS_sendfile"},
+	{188, "SYS_getpmsg"},
+	{189, "SYS_putpmsg"},
+	{190, "SYS_vfork"},
+	{191, "SYS_ugetrlimit"},
+	{192, "SYS_mmap2"},
+	{193, "SYS_truncate64"},
+	{194, "SYS_ftruncate64"},
+	{195, "SYS_stat64"},
+	{196, "SYS_lstat64"},
+	{197, "SYS_fstat64"},
+	{198, "SYS_lchown32"},
+	{199, "SYS_getuid32"},
+	{200, "SYS_getgid32"},
+	{201, "SYS_geteuid32"},
+	{202, "SYS_getegid32"},
+	{203, "SYS_setreuid32"},
+	{204, "SYS_setregid32"},
+	{205, "SYS_getgroups32"},
+	{206, "SYS_setgroups32"},
+	{207, "SYS_fchown32"},
+	{208, "SYS_setresuid32"},
+	{209, "SYS_getresuid32"},
+	{210, "SYS_setresgid32"},
+	{211, "SYS_getresgid32"},
+	{212, "SYS_chown32"},
+	{213, "SYS_setuid32"},
+	{214, "SYS_setgid32"},
+	{215, "SYS_setfsuid32"},
+	{216, "SYS_setfsgid32"},
+	{217, "SYS_pivot_root"},
+	{218, "SYS_mincore"},
+	{219, "SYS_madvise"},
+	{220, "SYS_getdents64"},
+	{221, "SYS_fcntl64"},
+	{224, "SYS_gettid"},
+	{225, "SYS_readahead"},
+	{226, "SYS_setxattr"},
+	{227, "SYS_lsetxattr"},
+	{228, "SYS_fsetxattr"},
+	{229, "SYS_getxattr"},
+	{230, "SYS_lgetxattr"},
+	{231, "SYS_fgetxattr"},
+	{232, "SYS_listxattr"},
+	{233, "SYS_llistxattr"},
+	{234, "SYS_flistxattr"},
+	{235, "SYS_removexattr"},
+	{236, "SYS_lremovexattr"},
+	{237, "SYS_fremovexattr"},
+	{238, "SYS_tkill"},
+	{239, "SYS_sendfile64"},
+	{240, "SYS_futex"},
+	{241, "SYS_sched_setaffinity"},
+	{242, "SYS_sched_getaffinity"},
+	{243, "SYS_set_thread_area"},
+	{244, "SYS_get_thread_area"},
+	{245, "SYS_io_setup"},
+	{246, "SYS_io_destroy"},
+	{247, "SYS_io_getevents"},
+	{248, "SYS_io_submit"},
+	{249, "SYS_io_cancel"},
+	{250, "SYS_fadvise64"},
+	{252, "SYS_exit_group"},
+	{253, "SYS_lookup_dcookie"},
+	{254, "SYS_epoll_create"},
+	{255, "SYS_epoll_ctl"},
+	{256, "SYS_epoll_wait"},
+	{257, "SYS_remap_file_pages"},
+	{258, "SYS_set_tid_address"},
+	{259, "SYS_timer_create"},
+	{260, "SYS_timer_settime"},
+	{261, "SYS_timer_gettime"},
+	{262, "SYS_timer_getoverrun"},
+	{263, "SYS_timer_delete"},
+	{264, "SYS_clock_settime"},
+	{265, "SYS_clock_gettime"},
+	{266, "SYS_clock_getres"},
+	{267, "SYS_clock_nanosleep"},
+	{268, "SYS_statfs64"},
+	{269, "SYS_fstatfs64"},
+	{270, "SYS_tgkill"},
+	{271, "SYS_utimes"},
+	{272, "SYS_fadvise64_64"},
+	{273, "SYS_vserver"},
+	{274, "SYS_mbind"},
+	{275, "SYS_get_mempolicy"},
+	{276, "SYS_set_mempolicy"},
+	{277, "SYS_mq_open"},
+	{278, "SYS_mq_unlink"},
+	{279, "SYS_mq_timedsend"},
+	{280, "SYS_mq_timedreceive"},
+	{281, "SYS_mq_notify"},
+	{282, "SYS_mq_getsetattr"},
+	{283, "SYS_kexec_load"},
+	{284, "SYS_waitid"},
+	{286, "SYS_add_key"},
+	{287, "SYS_request_key"},
+	{288, "SYS_keyctl"},
+	{289, "SYS_ioprio_set"},
+	{290, "SYS_ioprio_get"},
+	{291, "SYS_inotify_init"},
+	{292, "SYS_inotify_add_watch"},
+	{293, "SYS_inotify_rm_watch"},
+	{294, "SYS_migrate_pages"},
+	{295, "SYS_openat"},
+	{296, "SYS_mkdirat"},
+	{297, "SYS_mknodat"},
+	{298, "SYS_fchownat"},
+	{299, "SYS_futimesat"},
+	{300, "SYS_fstatat64"},
+	{301, "SYS_unlinkat"},
+	{302, "SYS_renameat"},
+	{303, "SYS_linkat"},
+	{304, "SYS_symlinkat"},
+	{305, "SYS_readlinkat"},
+	{306, "SYS_fchmodat"},
+	{307, "SYS_faccessat"},
+	{308, "SYS_pselect6"},
+	{309, "SYS_ppoll"},
+	{310, "SYS_unshare"},
+	{311, "SYS_set_robust_list"},
+	{312, "SYS_get_robust_list"},
+	{313, "SYS_splice"},
+	{314, "SYS_sync_file_range"},
+	{315, "SYS_tee"},
+	{316, "SYS_vmsplice"},
+	{317, "SYS_move_pages"},
+	{318, "SYS_getcpu"},
+	{319, "SYS_epoll_pwait"},
+	{320, "SYS_utimensat"},
+	{321, "SYS_signalfd"},
+	{322, "SYS_timerfd_create"},
+	{323, "SYS_eventfd"},
+	{324, "SYS_fallocate"},
+	{325, "SYS_timerfd_settime"},
+	{326, "SYS_timerfd_gettime"},
+	{327, "SYS_signalfd4"},
+	{328, "SYS_eventfd2"},
+	{329, "SYS_epoll_create1"},
+	{330, "SYS_dup3"},
+	{331, "SYS_pipe2"},
+	{332, "SYS_inotify_init1"},
+	{333, "SYS_preadv"},
+	{334, "SYS_pwritev"},
+	{335, "SYS_rt_tgsigqueueinfo"},
+	{336, "SYS_perf_event_open"},
+	{337, "SYS_recvmmsg"},
+	{338, "SYS_fanotify_init"},
+	{339, "SYS_fanotify_mark"},
+	{340, "SYS_prlimit64"},
+	{341, "SYS_name_to_handle_at"},
+	{342, "SYS_open_by_handle_at"},
+	{343, "SYS_clock_adjtime"},
+	{344, "SYS_syncfs"},
+	{345, "SYS_sendmmsg"},
+	{346, "SYS_setns"},
+	{347, "SYS_process_vm_readv"},
+	{348, "SYS_process_vm_writev"},
+	{349, "SYS_kcmp"},
+	{350, "SYS_finit_module"},
+	{351, "SYS_sched_setattr"},
+	{352, "SYS_sched_getattr"},
+};
+
+constexpr SymbolicName SEEK_WHENCE[] = {
 	// Info from: <stdio.h>
-	symbolicNamesMap[0] = "SEEK_SET";
-	symbolicNamesMap[1] = "SEEK_CUR";
-	symbolicNamesMap[2] = "SEEK_END";
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_END()
+	{0, "SEEK_SET"},
+	{1, "SEEK_CUR"},
+	{2, "SEEK_END"},
+};
 
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_BEGIN(getSymbolicNamesForLocaleCategories)
+constexpr SymbolicName LOCALE_CATEGORIES[] = {
 	// Info from: <bits/locale.h>
-	symbolicNamesMap[0] = "LC_CTYPE";
-	symbolicNamesMap[1] = "LC_NUMERIC";
-	symbolicNamesMap[2] = "LC_TIME";
-	symbolicNamesMap[3] = "LC_COLLATE";
-	symbolicNamesMap[4] = "LC_MONETARY";
-	symbolicNamesMap[5] = "LC_MESSAGES";
-	symbolicNamesMap[6] = "LC_ALL";
-	symbolicNamesMap[7] = "LC_PAPER";
-	symbolicNamesMap[8] = "LC_NAME";
-	symbolicNamesMap[9] = "LC_ADDRESS";
-	symbolicNamesMap[10] = "LC_TELEPHONE";
-	symbolicNamesMap[11] = "LC_MEASUREMENT";
-	symbolicNamesMap[12] = "LC_IDENTIFICATION";
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_END()
-
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_BEGIN(getSymbolicNamesForSchedPolicies)
+	{0, "LC_CTYPE"},
+	{1, "LC_NUMERIC"},
+	{2, "LC_TIME"},
+	{3, "LC_COLLATE"},
+	{4, "LC_MONETARY"},
+	{5, "LC_MESSAGES"},
+	{6, "LC_ALL"},
+	{7, "LC_PAPER"},
+	{8, "LC_NAME"},
+	{9, "LC_ADDRESS"},
+	{10, "LC_TELEPHONE"},
+	{11, "LC_MEASUREMENT"},
+	{12, "LC_IDENTIFICATION"},
+};
+
+constexpr SymbolicName SCHED_POLICIES[] = {
 	// Info from: <bits/sched.h>
-	symbolicNamesMap[0] = "SCHED_OTHER";
-	symbolicNamesMap[1] = "SCHED_FIFO";
-	symbolicNamesMap[2] = "SCHED_RR";
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_END()
+	{0, "SCHED_OTHER"},
+	{1, "SCHED_FIFO"},
+	{2, "SCHED_RR"},
+};
 
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_BEGIN(getSymbolicNamesForResources)
+constexpr SymbolicName RESOURCES[] = {
 	// Info from: <asm-generic/resource.h>
-	symbolicNamesMap[0] = "RLIMIT_CPU";
-	symbolicNamesMap[1] = "RLIMIT_FSIZE";
-	symbolicNamesMap[2] = "RLIMIT_DATA";
-	symbolicNamesMap[3] = "RLIMIT_STACK";
-	symbolicNamesMap[4] = "RLIMIT_CORE";
-	symbolicNamesMap[10] = "RLIMIT_LOCKS";
-	symbolicNamesMap[11] = "RLIMIT_SIGPENDING";
-	symbolicNamesMap[12] = "RLIMIT_MSGQUEUE";
-	symbolicNamesMap[13] = "RLIMIT_NICE";
-	symbolicNamesMap[14] = "RLIMIT_RTPRIO";
-	symbolicNamesMap[15] = "RLIMIT_RTTIME";
-	symbolicNamesMap[16] = "RLIM_NLIMITS";
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_END()
-
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_BEGIN(getSymbolicNamesForWaitOptions)
+	{0, "RLIMIT_CPU"},
+	{1, "RLIMIT_FSIZE"},
+	{2, "RLIMIT_DATA"},
+	{3, "RLIMIT_STACK"},
+	{4, "RLIMIT_CORE"},
+	{10, "RLIMIT_LOCKS"},
+	{11, "RLIMIT_SIGPENDING"},
+	{12, "RLIMIT_MSGQUEUE"},
+	{13, "RLIMIT_NICE"},
+	{14, "RLIMIT_RTPRIO"},
+	{15, "RLIMIT_RTTIME"},
+	{16, "RLIM_NLIMITS"},
+};
+
+constexpr SymbolicName WAIT_OPTIONS[] = {
 	// Info from: <linux/wait.h>
-	symbolicNamesMap[0x00000001] = "WNOHANG";
-	symbolicNamesMap[0x00000002] = "WUNTRACED";
-	// symbolicNamesMap[0x00000002] = "WSTOPPED"; // synonym for WUNTRACED
-	symbolicNamesMap[0x00000004] = "WEXITED";
-	symbolicNamesMap[0x00000008] = "WCONTINUED";
-	symbolicNamesMap[0x01000000] = "WNOWAIT";
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_END()
-
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_BEGIN(getSymbolicNamesForAccessTypes)
+	{0x00000001, "WNOHANG"},
+	{0x00000002, "WUNTRACED"},
+	// {0x00000002, "WSTOPPED"}, // synonym for WUNTRACED
+	{0x00000004, "WEXITED"},
+	{0x00000008, "WCONTINUED"},
+	{0x01000000, "WNOWAIT"},
+};
+
+constexpr SymbolicName ACCESS_TYPES[] = {
 	// Info from: <linux/fcntl.h>
-	symbolicNamesMap[0x100] = "AT_SYMLINK_NOFOLLOW";
-	symbolicNamesMap[0x200] = "AT_REMOVEDIR";
-	symbolicNamesMap[0x400] = "AT_SYMLINK_FOLLOW";
-	symbolicNamesMap[0x800] = "AT_NO_AUTOMOUNT";
-	symbolicNamesMap[0x1000] = "AT_EMPTY_PATH";
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_END()
-
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_BEGIN(getSymbolicNamesForAccessModes)
+	{0x100, "AT_SYMLINK_NOFOLLOW"},
+	{0x200, "AT_REMOVEDIR"},
+	{0x400, "AT_SYMLINK_FOLLOW"},
+	{0x800, "AT_NO_AUTOMOUNT"},
+	{0x1000, "AT_EMPTY_PATH"},
+};
+
+constexpr SymbolicName ACCESS_MODES[] = {
 	// Info from: <unistd.h>
-	symbolicNamesMap[0] = "F_OK";
-	symbolicNamesMap[1] = "X_OK";
-	symbolicNamesMap[2] = "W_OK";
-	symbolicNamesMap[4] = "R_OK";
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_END()
+	{0, "F_OK"},
+	{1, "X_OK"},
+	{2, "W_OK"},
+	{4, "R_OK"},
+};
 
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_BEGIN(getSymbolicNamesForITimers)
+constexpr SymbolicName ITIMERS[] = {
 	// Info from: <linux/time.h>
-	symbolicNamesMap[0] = "ITIMER_REAL";
-	symbolicNamesMap[1] = "ITIMER_VIRTUAL";
-	symbolicNamesMap[2] = "ITIMER_PROF";
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_END()
+	{0, "ITIMER_REAL"},
+	{1, "ITIMER_VIRTUAL"},
+	{2, "ITIMER_PROF"},
+};
 
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_BEGIN(getSymbolicNamesForLogOptions)
+constexpr SymbolicName LOG_OPTIONS[] = {
 	// Info from: <sys/syslog.h>
-	symbolicNamesMap[0x01] = "LOG_PID";
-	symbolicNamesMap[0x02] = "LOG_CONS";
-	symbolicNamesMap[0x04] = "LOG_ODELAY";
-	symbolicNamesMap[0x08] = "LOG_NDELAY";
-	symbolicNamesMap[0x10] = "LOG_NOWAIT";
-	symbolicNamesMap[0x20] = "LOG_PERROR";
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_END()
-
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_BEGIN(getSymbolicNamesForLogFacilities)
+	{0x01, "LOG_PID"},
+	{0x02, "LOG_CONS"},
+	{0x04, "LOG_ODELAY"},
+	{0x08, "LOG_NDELAY"},
+	{0x10, "LOG_NOWAIT"},
+	{0x20, "LOG_PERROR"},
+};
+
+constexpr SymbolicName LOG_FACILITIES[] = {
 	// Info from: <sys/syslog.h>
-	symbolicNamesMap[0<<3] = "LOG_KERN";
-	symbolicNamesMap[1<<3] = "LOG_USER";
-	symbolicNamesMap[2<<3] = "LOG_MAIL";
-	symbolicNamesMap[3<<3] = "LOG_DAEMON";
-	symbolicNamesMap[4<<3] = "LOG_AUTH";
-	symbolicNamesMap[5<<3] = "LOG_SYSLOG";
-	symbolicNamesMap[6<<3] = "LOG_LPR";
-	symbolicNamesMap[7<<3] = "LOG_NEWS";
-	symbolicNamesMap[8<<3] = "LOG_UUCP";
-	symbolicNamesMap[9<<3] = "LOG_CRON";
-	symbolicNamesMap[10<<3] = "LOG_AUTHPRIV";
-	symbolicNamesMap[11<<3] = "LOG_FTP";
-	symbolicNamesMap[16<<3] = "LOG_LOCAL0";
-	symbolicNamesMap[17<<3] = "LOG_LOCAL1";
-	symbolicNamesMap[18<<3] = "LOG_LOCAL2";
-	symbolicNamesMap[19<<3] = "LOG_LOCAL3";
-	symbolicNamesMap[20<<3] = "LOG_LOCAL4";
-	symbolicNamesMap[21<<3] = "LOG_LOCAL5";
-	symbolicNamesMap[22<<3] = "LOG_LOCAL6";
-	symbolicNamesMap[23<<3] = "LOG_LOCAL7";
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_END()
-
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_BEGIN(getSymbolicNamesForLogLevels)
+	{0<<3, "LOG_KERN"},
+	{1<<3, "LOG_USER"},
+	{2<<3, "LOG_MAIL"},
+	{3<<3, "LOG_DAEMON"},
+	{4<<3, "LOG_AUTH"},
+	{5<<3, "LOG_SYSLOG"},
+	{6<<3, "LOG_LPR"},
+	{7<<3, "LOG_NEWS"},
+	{8<<3, "LOG_UUCP"},
+	{9<<3, "LOG_CRON"},
+	{10<<3, "LOG_AUTHPRIV"},
+	{11<<3, "LOG_FTP"},
+	{16<<3, "LOG_LOCAL0"},
+	{17<<3, "LOG_LOCAL1"},
+	{18<<3, "LOG_LOCAL2"},
+	{19<<3, "LOG_LOCAL3"},
+	{20<<3, "LOG_LOCAL4"},
+	{21<<3, "LOG_LOCAL5"},
+	{22<<3, "LOG_LOCAL6"},
+	{23<<3, "LOG_LOCAL7"},
+};
+
+constexpr SymbolicName LOG_LEVELS[] = {
 	// Info from: <sys/syslog.h>
-	symbolicNamesMap[0] = "LOG_EMERG";
-	symbolicNamesMap[1] = "LOG_ALERT";
-	symbolicNamesMap[2] = "LOG_CRIT";
-	symbolicNamesMap[3] = "LOG_ERR";
-	symbolicNamesMap[4] = "LOG_WARNING";
-	symbolicNamesMap[5] = "LOG_NOTICE";
-	symbolicNamesMap[6] = "LOG_INFO";
-	symbolicNamesMap[7] = "LOG_DEBUG";
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_END()
-
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_BEGIN(getSymbolicNamesForLogPriorities)
+	{0, "LOG_EMERG"},
+	{1, "LOG_ALERT"},
+	{2, "LOG_CRIT"},
+	{3, "LOG_ERR"},
+	{4, "LOG_WARNING"},
+	{5, "LOG_NOTICE"},
+	{6, "LOG_INFO"},
+	{7, "LOG_DEBUG"},
+};
+
+constexpr SymbolicName LOG_PRIORITIES[] = {
 	// From `man syslog`: The priority argument is formed by ORing the facility
-	//                    and the level values.
-	const IntStringMap &logFacilityNames(getSymbolicNamesForLogFacilities());
-	symbolicNamesMap.insert(logFacilityNames.begin(), logFacilityNames.end());
-	const IntStringMap &logLevelNames(getSymbolicNamesForLogLevels());
-	symbolicNamesMap.insert(logLevelNames.begin(), logLevelNames.end());
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_END()
-
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_BEGIN(getSymbolicNamesForTimeFlags)
+	//                    and the level values. When a level and a facility
+	//                    have the same value, the name of the facility is used.
+	// Info from: <sys/syslog.h>
+	{0, "LOG_EMERG"},
+	{1, "LOG_ALERT"},
+	{2, "LOG_CRIT"},
+	{3, "LOG_ERR"},
+	{4, "LOG_WARNING"},
+	{5, "LOG_NOTICE"},
+	{6, "LOG_INFO"},
+	{7, "LOG_DEBUG"},
+	// Info from: <sys/syslog.h>
+	{0<<3, "LOG_KERN"},
+	{1<<3, "LOG_USER"},
+	{2<<3, "LOG_MAIL"},
+	{3<<3, "LOG_DAEMON"},
+	{4<<3, "LOG_AUTH"},
+	{5<<3, "LOG_SYSLOG"},
+	{6<<3, "LOG_LPR"},
+	{7<<3, "LOG_NEWS"},
+	{8<<3, "LOG_UUCP"},
+	{9<<3, "LOG_CRON"},
+	{10<<3, "LOG_AUTHPRIV"},
+	{11<<3, "LOG_FTP"},
+	{16<<3, "LOG_LOCAL0"},
+	{17<<3, "LOG_LOCAL1"},
+	{18<<3, "LOG_LOCAL2"},
+	{19<<3, "LOG_LOCAL3"},
+	{20<<3, "LOG_LOCAL4"},
+	{21<<3, "LOG_LOCAL5"},
+	{22<<3, "LOG_LOCAL6"},
+	{23<<3, "LOG_LOCAL7"},
+};
+
+constexpr SymbolicName TIME_FLAGS[] = {
 	// Info from: <linux/time.h>
-	symbolicNamesMap[0x01] = "TIMER_ABSTIME";
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_END()
+	{0x01, "TIMER_ABSTIME"},
+};
 
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_BEGIN(getSymbolicNamesForPathConfs)
+constexpr SymbolicName PATH_CONFS[] = {
 	// Info from: <bits/confname.h>
-	symbolicNamesMap[0] = "_PC_LINK_MAX";
-	symbolicNamesMap[1] = "_PC_MAX_CANON";
-	symbolicNamesMap[2] = "_PC_MAX_INPUT";
-	symbolicNamesMap[3] = "_PC_NAME_MAX";
-	symbolicNamesMap[4] = "_PC_PATH_MAX";
-	symbolicNamesMap[5] = "_PC_PIPE_BUF";
-	symbolicNamesMap[6] = "_PC_CHOWN_RESTRICTED";
-	symbolicNamesMap[7] = "_PC_NO_TRUNC";
-	symbolicNamesMap[8] = "_PC_VDISABLE";
-	symbolicNamesMap[9] = "_PC_SYNC_IO";
-	symbolicNamesMap[10] = "_PC_ASYNC_IO";
-	symbolicNamesMap[11] = "_PC_PRIO_IO";
-	symbolicNamesMap[12] = "_PC_SOCK_MAXBUF";
-	symbolicNamesMap[13] = "_PC_FILESIZEBITS";
-	symbolicNamesMap[14] = "_PC_REC_INCR_XFER_SIZE";
-	symbolicNamesMap[15] = "_PC_REC_MAX_XFER_SIZE";
-	symbolicNamesMap[16] = "_PC_REC_MIN_XFER_SIZE";
-	symbolicNamesMap[17] = "_PC_REC_XFER_ALIGN";
-	symbolicNamesMap[18] = "_PC_ALLOC_SIZE_MIN";
-	symbolicNamesMap[19] = "_PC_SYMLINK_MAX";
-	symbolicNamesMap[20] = "_PC_2_SYMLINKS";
-DEFINE_GET_SYMBOLIC_NAMES_FUNC_END()
+	{0, "_PC_LINK_MAX"},
+	{1, "_PC_MAX_CANON"},
+	{2, "_PC_MAX_INPUT"},
+	{3, "_PC_NAME_MAX"},
+	{4, "_PC_PATH_MAX"},
+	{5, "_PC_PIPE_BUF"},
+	{6, "_PC_CHOWN_RESTRICTED"},
+	{7, "_PC_NO_TRUNC"},
+	{8, "_PC_VDISABLE"},
+	{9, "_PC_SYNC_IO"},
+	{10, "_PC_ASYNC_IO"},
+	{11, "_PC_PRIO_IO"},
+	{12, "_PC_SOCK_MAXBUF"},
+	{13, "_PC_FILESIZEBITS"},
+	{14, "_PC_REC_INCR_XFER_SIZE"},
+	{15, "_PC_REC_MAX_XFER_SIZE"},
+	{16, "_PC_REC_MIN_XFER_SIZE"},
+	{17, "_PC_REC_XFER_ALIGN"},
+	{18, "_PC_ALLOC_SIZE_MIN"},
+	{19, "_PC_SYMLINK_MAX"},
+	{20, "_PC_2_SYMLINKS"},
+};
+
+//
+// Symbolic names of parameters of single functions.
+//
+
+constexpr SymbolicName LIO_LISTIO_MODE[] = {
+	// Info from: <aio.h>
+	{0, "LIO_WAIT"},
+	{1, "LIO_NOWAIT"},
+};
 
-/**
-* @brief This function is used to initialize FUNC_PARAMS_MAP later in the file.
-*/
-const FuncParamsMap &initFuncParamsMap() {
-	static FuncParamsMap funcParamsMap;
+constexpr SymbolicName DLOPEN_FLAG[] = {
+	// Info from: <bits/dlfcn.h>
+	{0x00000, "RTLD_LOCAL"},
+	{0x00001, "RTLD_LAZY"},
+	{0x00002, "RTLD_NOW"},
+	{0x00003, "RTLD_BINDING_MASK"},
+	{0x00004, "RTLD_NOLOAD"},
+	{0x00008, "RTLD_DEEPBIND"},
+	{0x00100, "RTLD_GLOBAL"},
+	{0x01000, "RTLD_NODELETE"},
+};
+
+constexpr SymbolicName FCNTL_CMD[] = {
+	// Info from: <asm-generic/fcntl.h>
+	{0, "F_DUPFD"},
+	{1, "F_GETFD"},
+	{2, "F_SETFD"},
+	{3, "F_GETFL"},
+	{4, "F_SETFL"},
+	{5, "F_GETLK"},
+	{6, "F_SETLK"},
+	{7, "F_SETLKW"},
+	{8, "F_SETOWN"},
+	{9, "F_GETOWN"},
+	{10, "F_SETSIG"},
+	{11, "F_GETSIG"},
+	{12, "F_GETLK64"},
+	{13, "F_SETLK64"},
+	{14, "F_SETLKW64"},
+	{15, "F_SETOWN_EX"},
+	{16, "F_GETOWN_EX"},
+	{17, "F_GETOWNER_UIDS"},
+};
+
+constexpr SymbolicName POSIX_FADVISE_ADVICE[] = {
+	// Info from: <linux/fadvise.h>
+	{0, "POSIX_FADV_NORMAL"},
+	{1, "POSIX_FADV_RANDOM"},
+	{2, "POSIX_FADV_SEQUENTIAL"},
+	{3, "POSIX_FADV_WILLNEED"},
+	{6, "POSIX_FADV_DONTNEED"},
+	{7, "POSIX_FADV_NOREUSE"},
+	{4, "POSIX_FADV_DONTNEED"},
+	{5, "POSIX_FADV_NOREUSE"},
+};
+
+constexpr SymbolicName FMTMSG_CLASSIFICATION[] = {
+	// Info from: <fmtmsg.h>
+	{0x001, "MM_HARD"},
+	{0x002, "MM_SOFT"},
+	{0x004, "MM_FIRM"},
+	{0x008, "MM_APPL"},
+	{0x010, "MM_UTIL"},
+	{0x020, "MM_OPSYS"},
+	{0x040, "MM_RECOVER"},
+	{0x080, "MM_NRECOV"},
+	{0x100, "MM_PRINT"},
+	{0x200, "MM_CONSOLE"},
+};
+
+constexpr SymbolicName FMTMSG_SEVERITY[] = {
+	// Info from: <fmtmsg.h>
+	{0, "MM_NOSEV"},
+	{1, "MM_HALT"},
+	{2, "MM_ERROR"},
+	{3, "MM_WARNING"},
+	{4, "MM_INFO"},
+};
+
+constexpr SymbolicName FNMATCH_FLAGS[] = {
+	// Info from: <fnmatch.h>
+	{1 << 0, "FNM_PATHNAME"},
+	// {1 << 0, "FNM_FILE_NAME"}, // synonym for FNM_PATHNAME
+	{1 << 1, "FNM_NOESCAPE"},
+	{1 << 3, "FNM_LEADING_DIR "},
+	{1 << 4, "FNM_CASEFOLD"},
+	{1 << 5, "FNM_EXTMATCH"},
+};
+
+constexpr SymbolicName DBM_STORE_STORE_MODE[] = {
+	// Info from: <db.h>
+	{0, "DBM_INSERT"},
+	{1, "DBM_REPLACE"},
+};
+
+constexpr SymbolicName CATOPEN_FLAG[] = {
+	// Info from: <nl_types.h>
+	{1, "NL_CAT_LOCALE"},
+};
+
+constexpr SymbolicName PTHREAD_ATTR_SETDETACHSTATE_DETACHSTATE[] = {
+	// Info from: <pthread.h>
+	{0, "PTHREAD_CREATE_JOINABLE"},
+	{1, "PTHREAD_CREATE_DETACHED"},
+};
+
+constexpr SymbolicName PTHREAD_ATTR_SETINHERITSCHED_INHERITSCHED[] = {
+	// Info from: <pthread.h>
+	{0, "PTHREAD_INHERIT_SCHED"},
+	{1, "PTHREAD_EXPLICIT_SCHED"},
+};
+
+constexpr SymbolicName PTHREAD_ATTR_SETSCOPE_SCOPE[] = {
+	// Info from: <pthread.h>
+	{0, "PTHREAD_SCOPE_SYSTEM"},
+	{1, "PTHREAD_SCOPE_PROCESS"},
+};
+
+constexpr SymbolicName PTHREAD_MUTEXATTR_SETPROTOCOL_PROTOCOL[] = {
+	// Info from: <pthread.h>
+	{0, "PTHREAD_PRIO_NONE"},
+	{1, "PTHREAD_PRIO_INHERIT"},
+	{1, "PTHREAD_PRIO_PROTECT"},
+};
+
+constexpr SymbolicName PTHREAD_MUTEXATTR_SETROBUST_ROBUST[] = {
+	// Info from: <pthread.h>
+	{0, "PTHREAD_MUTEX_STALLED"},
+	{1, "PTHREAD_MUTEX_ROBUST"},
+};
+
+constexpr SymbolicName PTHREAD_MUTEXATTR_SETTYPE_TYPE[] = {
+	// Info from: <pthread.h>
+	{0, "PTHREAD_MUTEX_NORMAL"},
+	// {0, "PTHREAD_MUTEX_DEFAULT"}, // synonym for PTHREAD_MUTEX_NORMAL
+	{1, "PTHREAD_MUTEX_RECURSIVE"},
+	{2, "PTHREAD_MUTEX_ERRORCHECK"},
+};
+
+constexpr SymbolicName PTHREAD_SETCANCELSTATE_STATE[] = {
+	// Info from: <pthread.h>
+	{0, "PTHREAD_CANCEL_ENABLE"},
+	{1, "PTHREAD_CANCEL_DISABLE"},
+};
+
+constexpr SymbolicName PTHREAD_SETCANCELTYPE_TYPE[] = {
+	// Info from: <pthread.h>
+	{0, "PTHREAD_CANCEL_DEFERRED"},
+	{1, "PTHREAD_CANCEL_ASYNCHRONOUS"},
+};
+
+constexpr SymbolicName PUTMSG_FLAGS[] = {
+	// Info from: <bits/stropts.h>
+	{0x01, "RS_HIPRI"},
+};
+
+constexpr SymbolicName PUTPMSG_FLAGS[] = {
+	// Info from: <bits/stropts.h>
+	{0x01, "MSG_HIPRI"},
+	{0x02, "MSG_ANY"},
+	{0x04, "MSG_BAND"},
+};
+
+constexpr SymbolicName FLOCK_OPERATION[] = {
+	// Info from: <sys/file.h>
+	{1, "LOCK_SH"},
+	{2, "LOCK_EX"},
+	{4, "LOCK_NB"},
+	{8, "LOCK_UN"},
+};
+
+constexpr SymbolicName MLOCKALL_FLAGS[] = {
+	// Info from: <asm-generic/mman.h>
+	{1, "MCL_CURRENT"},
+	{2, "MCL_FUTURE"},
+};
+
+constexpr SymbolicName MSGCTL_CMD[] = {
+	// Info from: <bits/ipc.h>
+	{0, "IPC_RMID"},
+	{1, "IPC_SET"},
+	{2, "IPC_STAT"},
+};
+
+constexpr SymbolicName PRCTL_OPTION[] = {
+	// Info from: <linux/prctl.h>
+	{1, "PR_SET_PDEATHSIG"},
+	{2, "PR_GET_PDEATHSIG"},
+	{3, "PR_GET_DUMPABLE"},
+	{4, "PR_SET_DUMPABLE"},
+	{5, "PR_GET_UNALIGN"},
+	{6, "PR_SET_UNALIGN"},
+	{7, "PR_GET_KEEPCAPS"},
+	{8, "PR_SET_KEEPCAPS"},
+	{9, "PR_GET_FPEMU"},
+	{10, "PR_SET_FPEMU"},
+	{11, "PR_GET_FPEXC"},
+	{12, "PR_SET_FPEXC"},
+	{13, "PR_GET_TIMING"},
+	{14, "PR_SET_TIMING"},
+	{15, "PR_SET_NAME"},
+	{16, "PR_GET_NAME"},
+	{19, "PR_GET_ENDIAN"},
+	{20, "PR_SET_ENDIAN"},
+	{21, "PR_GET_SECCOMP"},
+	{22, "PR_SET_SECCOMP"},
+	{23, "PR_CAPBSET_READ"},
+	{24, "PR_CAPBSET_DROP"},
+	{25, "PR_GET_TSC"},
+	{26, "PR_SET_TSC"},
+	{27, "PR_GET_SECUREBITS"},
+	{28, "PR_SET_SECUREBITS"},
+	{29, "PR_SET_TIMERSLACK"},
+	{30, "PR_GET_TIMERSLACK"},
+	{31, "PR_TASK_PERF_EVENTS_DISABLE"},
+	{32, "PR_TASK_PERF_EVENTS_ENABLE"},
+	{33, "PR_MCE_KILL"},
+	{34, "PR_MCE_KILL_GET"},
+	{35, "PR_SET_MM"},
+	{36, "PR_SET_CHILD_SUBREAPER"},
+	{37, "PR_GET_CHILD_SUBREAPER"},
+	{38, "PR_SET_NO_NEW_PRIVS"},
+	{39, "PR_GET_NO_NEW_PRIVS"},
+	{40, "PR_GET_TID_ADDRESS"},
+};
+
+constexpr SymbolicName GETRUSAGE_WHO[] = {
+	// Info from: <bits/resource.h>
+	{0, "RUSAGE_SELF"},
+	{-1, "RUSAGE_CHILDREN"},
+	{1, "RUSAGE_THREAD"},
+};
+
+constexpr SymbolicName SEMCTL_CMD[] = {
+	// Info from: <bits/sem.h>
+	{11, "GETPID"},
+	{12, "GETVAL"},
+	{13, "GETALL"},
+	{14, "GETNCNT"},
+	{15, "GETZCNT"},
+	{16, "SETVAL"},
+	{17, "SETALL"},
+	// Info from: <bits/ipc.h>
+	{0, "IPC_RMID"},
+	{1, "IPC_SET"},
+	{2, "IPC_STAT"},
+};
+
+constexpr SymbolicName SHMCTL_CMD[] = {
+	// Info from: <bits/ipc.h>
+	{0, "IPC_RMID"},
+	{1, "IPC_SET"},
+	{2, "IPC_STAT"},
+};
+
+constexpr SymbolicName GETNAMEINFO_FLAGS[] = {
+	// Info from: <netdb.h>
+	{1, "NI_NUMERICHOST"},
+	{2, "NI_NUMERICSERV"},
+	{4, "NI_NOFQDN"},
+	{8, "NI_NAMEREQD"},
+	{16, "NI_DGRAM"},
+	{32, "NI_IDN"},
+	{64, "NI_IDN_ALLOW_UNASSIGNED"},
+	{128, "NI_IDN_USE_STD3_ASCII_RULES"},
+};
+
+constexpr SymbolicName SHUTDOWN_HOW[] = {
+	// Info from: <sys/socket.h>
+	{0, "SHUT_RD"},
+	{1, "SHUT_WR"},
+	{2, "SHUT_RDWR"},
+};
+
+constexpr SymbolicName REGCOMP_CFLAGS[] = {
+	// Info from: <regex.h>
+	{1, "REG_EXTENDED"},
+	{2, "REG_ICASE"},
+	{4, "REG_NEWLINE"},
+	{8, "REG_NOSUB"},
+};
+
+constexpr SymbolicName REGEXEC_EFLAGS[] = {
+	// Info from: <regex.h>
+	{1, "REG_NOTBOL"},
+	{2, "REG_NOTEOL"},
+	{4, "REG_STARTEND"},
+};
+
+constexpr SymbolicName TCSETATTR_OPTIONAL_ACTIONS[] = {
+	// Info from: <bits/termios.h>
+	{0, "TCSANOW"},
+	{1, "TCSADRAIN"},
+	{2, "TCSAFLUSH"},
+};
+
+constexpr SymbolicName TCFLOW_ACTION[] = {
+	// Info from: <bits/termios.h>
+	{0, "TCOOFF"},
+	{1, "TCOON"},
+	{2, "TCIOFF"},
+	{3, "TCION"},
+};
+
+constexpr SymbolicName TCFLUSH_QUEUE_SELECTOR[] = {
+	// Info from: <bits/termios.h>
+	{0, "TCIFLUSH"},
+	{1, "TCOFLUSH"},
+	{2, "TCIOFLUSH"},
+};
+
+constexpr SymbolicName ULIMIT_CMD[] = {
+	// Info from: <fcntl.h>
+	{1, "UL_GETFSIZE"},
+	{2, "UL_SETFSIZE"},
+};
 
-	// Temporary maps used to store the symbols for the current parameter of
-	// the current function. In this way, we don't have to keep separate maps
-	// for every function and every parameter. The only downside is that before
-	// adding new data into it, it has to be cleared.
-	ParamSymbolsMap paramSymbolsMap;
-	IntStringMap symbolicNamesMap;
+constexpr SymbolicName CONFSTR_NAME[] = {
+	// Info from: <bits/confname.h>
+	{0, "_CS_PATH"},
+	{2, "_CS_GNU_LIBC_VERSION"},
+	{3, "_CS_GNU_LIBPTHREAD_VERSION"},
+};
+
+constexpr SymbolicName LOCKF_CMD[] = {
+	// Info from: <fcntl.h>
+	{0, "F_UNLOCK"},
+	{1, "F_LOCK"},
+	{2, "F_TLOCK"},
+	{3, "F_TEST"},
+};
+
+constexpr SymbolicName SYSCONF_NAME[] = {
+	// Info from: <bits/confname.h>
+	{0, "_SC_ARG_MAX"},
+	{1, "_SC_CHILD_MAX"},
+	{2, "_SC_CLK_TCK"},
+	{3, "_SC_NGROUPS_MAX"},
+	{4, "_SC_OPEN_MAX"},
+	{5, "_SC_STREAM_MAX"},
+	{6, "_SC_TZNAME_MAX"},
+	{7, "_SC_JOB_CONTROL"},
+	{8, "_SC_SAVED_IDS"},
+	{9, "_SC_REALTIME_SIGNALS"},
+	{10, "_SC_PRIORITY_SCHEDULING"},
+	{11, "_SC_TIMERS"},
+	{12, "_SC_ASYNCHRONOUS_IO"},
+	{13, "_SC_PRIORITIZED_IO"},
+	{14, "_SC_SYNCHRONIZED_IO"},
+	{15, "_SC_FSYNC"},
+	{16, "_SC_MAPPED_FILES"},
+	{17, "_SC_MEMLOCK"},
+	{18, "_SC_MEMLOCK_RANGE"},
+	{19, "_SC_MEMORY_PROTECTION"},
+	{20, "_SC_MESSAGE_PASSING"},
+	{21, "_SC_SEMAPHORES"},
+	{22, "_SC_SHARED_MEMORY_OBJECTS"},
+	{23, "_SC_AIO_LISTIO_MAX"},
+	{24, "_SC_AIO_MAX"},
+	{25, "_SC_AIO_PRIO_DELTA_MAX"},
+	{26, "_SC_DELAYTIMER_MAX"},
+	{27, "_SC_MQ_OPEN_MAX"},
+	{28, "_SC_MQ_PRIO_MAX"},
+	{29, "_SC_VERSION"},
+	{30, "_SC_PAGESIZE"},
+	{31, "_SC_RTSIG_MAX"},
+	{32, "_SC_SEM_NSEMS_MAX"},
+	{33, "_SC_SEM_VALUE_MAX"},
+	{34, "_SC_SIGQUEUE_MAX"},
+	{35, "_SC_TIMER_MAX"},
+	{36, "_SC_BC_BASE_MAX"},
+	{37, "_SC_BC_DIM_MAX"},
+	{38, "_SC_BC_SCALE_MAX"},
+	{39, "_SC_BC_STRING_MAX"},
+	{40, "_SC_COLL_WEIGHTS_MAX"},
+	{41, "_SC_EQUIV_CLASS_MAX"},
+	{42, "_SC_EXPR_NEST_MAX"},
+	{43, "_SC_LINE_MAX"},
+	{44, "_SC_RE_DUP_MAX"},
+	{45, "_SC_CHARCLASS_NAME_MAX"},
+	{46, "_SC_2_VERSION"},
+	{47, "_SC_2_C_BIND"},
+	{48, "_SC_2_C_DEV"},
+	{49, "_SC_2_FORT_DEV"},
+	{50, "_SC_2_FORT_RUN"},
+	{51, "_SC_2_SW_DEV"},
+	{52, "_SC_2_LOCALEDEF"},
+	{53, "_SC_PII"},
+	{54, "_SC_PII_XTI"},
+	{55, "_SC_PII_SOCKET"},
+	{56, "_SC_PII_INTERNET"},
+	{57, "_SC_PII_OSI"},
+	{58, "_SC_POLL"},
+	{59, "_SC_SELECT"},
+	{60, "_SC_UIO_MAXIOV"},
+	{61, "_SC_IOV_MAX = _SC_UIO_MAXIOV"},
+	{62, "_SC_PII_INTERNET_STREAM"},
+	{63, "_SC_PII_INTERNET_DGRAM"},
+	{64, "_SC_PII_OSI_COTS"},
+	{65, "_SC_PII_OSI_CLTS"},
+	{66, "_SC_PII_OSI_M"},
+	{67, "_SC_T_IOV_MAX"},
+	{68, "_SC_THREADS"},
+	{69, "_SC_THREAD_SAFE_FUNCTIONS"},
+	{70, "_SC_GETGR_R_SIZE_MAX"},
+	{71, "_SC_GETPW_R_SIZE_MAX"},
+	{72, "_SC_LOGIN_NAME_MAX"},
+	{73, "_SC_TTY_NAME_MAX"},
+	{74, "_SC_THREAD_DESTRUCTOR_ITERATIONS"},
+	{75, "_SC_THREAD_KEYS_MAX"},
+	{76, "_SC_THREAD_STACK_MIN"},
+	{77, "_SC_THREAD_THREADS_MAX"},
+	{78, "_SC_THREAD_ATTR_STACKADDR"},
+	{79, "_SC_THREAD_ATTR_STACKSIZE"},
+	{80, "_SC_THREAD_PRIORITY_SCHEDULING"},
+	{81, "_SC_THREAD_PRIO_INHERIT"},
+	{82, "_SC_THREAD_PRIO_PROTECT"},
+	{83, "_SC_THREAD_PROCESS_SHARED"},
+	{84, "_SC_NPROCESSORS_CONF"},
+	{85, "_SC_NPROCESSORS_ONLN"},
+	{86, "_SC_PHYS_PAGES"},
+	{87, "_SC_AVPHYS_PAGES"},
+	{88, "_SC_ATEXIT_MAX"},
+	{89, "_SC_PASS_MAX"},
+	{90, "_SC_XOPEN_VERSION"},
+	{91, "_SC_XOPEN_XCU_VERSION"},
+	{92, "_SC_XOPEN_UNIX"},
+	{93, "_SC_XOPEN_CRYPT"},
+	{94, "_SC_XOPEN_ENH_I18N"},
+	{95, "_SC_XOPEN_SHM"},
+	{96, "_SC_2_CHAR_TERM"},
+	{97, "_SC_2_C_VERSION"},
+	{98, "_SC_2_UPE"},
+	{99, "_SC_XOPEN_XPG2"},
+	{100, "_SC_XOPEN_XPG3"},
+	{101, "_SC_XOPEN_XPG4"},
+	{102, "_SC_CHAR_BIT"},
+	{103, "_SC_CHAR_MAX"},
+	{104, "_SC_CHAR_MIN"},
+	{105, "_SC_INT_MAX"},
+	{106, "_SC_INT_MIN"},
+	{107, "_SC_LONG_BIT"},
+	{108, "_SC_WORD_BIT"},
+	{109, "_SC_MB_LEN_MAX"},
+	{110, "_SC_NZERO"},
+	{111, "_SC_SSIZE_MAX"},
+	{112, "_SC_SCHAR_MAX"},
+	{113, "_SC_SCHAR_MIN"},
+	{114, "_SC_SHRT_MAX"},
+	{115, "_SC_SHRT_MIN"},
+	{116, "_SC_UCHAR_MAX"},
+	{117, "_SC_UINT_MAX"},
+	{118, "_SC_ULONG_MAX"},
+	{119, "_SC_USHRT_MAX"},
+	{120, "_SC_NL_ARGMAX"},
+	{121, "_SC_NL_LANGMAX"},
+	{122, "_SC_NL_MSGMAX"},
+	{123, "_SC_NL_NMAX"},
+	{124, "_SC_NL_SETMAX"},
+	{125, "_SC_NL_TEXTMAX"},
+	{126, "_SC_XBS5_ILP32_OFF32"},
+	{127, "_SC_XBS5_ILP32_OFFBIG"},
+	{128, "_SC_XBS5_LP64_OFF64"},
+	{129, "_SC_XBS5_LPBIG_OFFBIG"},
+	{130, "_SC_XOPEN_LEGACY"},
+	{131, "_SC_XOPEN_REALTIME"},
+	{132, "_SC_XOPEN_REALTIME_THREADS"},
+	{133, "_SC_ADVISORY_INFO"},
+	{134, "_SC_BARRIERS"},
+	{135, "_SC_BASE"},
+	{136, "_SC_C_LANG_SUPPORT"},
+	{137, "_SC_C_LANG_SUPPORT_R"},
+	{138, "_SC_CLOCK_SELECTION"},
+	{139, "_SC_CPUTIME"},
+	{140, "_SC_THREAD_CPUTIME"},
+	{141, "_SC_DEVICE_IO"},
+	{142, "_SC_DEVICE_SPECIFIC"},
+	{143, "_SC_DEVICE_SPECIFIC_R"},
+	{144, "_SC_FD_MGMT"},
+	{145, "_SC_FIFO"},
+	{146, "_SC_PIPE"},
+	{147, "_SC_FILE_ATTRIBUTES"},
+	{148, "_SC_FILE_LOCKING"},
+	{149, "_SC_FILE_SYSTEM"},
+	{150, "_SC_MONOTONIC_CLOCK"},
+	{151, "_SC_MULTI_PROCESS"},
+	{152, "_SC_SINGLE_PROCESS"},
+	{153, "_SC_NETWORKING"},
+	{154, "_SC_READER_WRITER_LOCKS"},
+	{155, "_SC_SPIN_LOCKS"},
+	{156, "_SC_REGEXP"},
+	{157, "_SC_REGEX_VERSION"},
+	{158, "_SC_SHELL"},
+	{159, "_SC_SIGNALS"},
+	{160, "_SC_SPAWN"},
+	{161, "_SC_SPORADIC_SERVER"},
+	{162, "_SC_THREAD_SPORADIC_SERVER"},
+	{163, "_SC_SYSTEM_DATABASE"},
+	{164, "_SC_SYSTEM_DATABASE_R"},
+	{165, "_SC_TIMEOUTS"},
+	{166, "_SC_TYPED_MEMORY_OBJECTS"},
+	{167, "_SC_USER_GROUPS"},
+	{168, "_SC_USER_GROUPS_R"},
+	{169, "_SC_2_PBS"},
+	{170, "_SC_2_PBS_ACCOUNTING"},
+	{171, "_SC_2_PBS_LOCATE"},
+	{172, "_SC_2_PBS_MESSAGE"},
+	{173, "_SC_2_PBS_TRACK"},
+	{174, "_SC_SYMLOOP_MAX"},
+	{175, "_SC_STREAMS"},
+	{176, "_SC_2_PBS_CHECKPOINT"},
+	{177, "_SC_V6_ILP32_OFF32"},
+	{178, "_SC_V6_ILP32_OFFBIG"},
+	{179, "_SC_V6_LP64_OFF64"},
+	{180, "_SC_V6_LPBIG_OFFBIG"},
+	{181, "_SC_HOST_NAME_MAX"},
+	{182, "_SC_TRACE"},
+	{183, "_SC_TRACE_EVENT_FILTER"},
+	{184, "_SC_TRACE_INHERIT"},
+	{185, "_SC_TRACE_LOG"},
+	{186, "_SC_LEVEL1_ICACHE_SIZE"},
+	{187, "_SC_LEVEL1_ICACHE_ASSOC"},
+	{188, "_SC_LEVEL1_ICACHE_LINESIZE"},
+	{189, "_SC_LEVEL1_DCACHE_SIZE"},
+	{190, "_SC_LEVEL1_DCACHE_ASSOC"},
+	{191, "_SC_LEVEL1_DCACHE_LINESIZE"},
+	{192, "_SC_LEVEL2_CACHE_SIZE"},
+	{193, "_SC_LEVEL2_CACHE_ASSOC"},
+	{194, "_SC_LEVEL2_CACHE_LINESIZE"},
+	{195, "_SC_LEVEL3_CACHE_SIZE"},
+	{196, "_SC_LEVEL3_CACHE_ASSOC"},
+	{197, "_SC_LEVEL3_CACHE_LINESIZE"},
+	{198, "_SC_LEVEL4_CACHE_SIZE"},
+	{199, "_SC_LEVEL4_CACHE_ASSOC"},
+	{200, "_SC_LEVEL4_CACHE_LINESIZE"},
+	// Here is a deliberate room for more cache levels.
+	{236, "_SC_IPV6"},
+	{237, "_SC_RAW_SOCKETS"},
+	{238, "_SC_V7_ILP32_OFF32"},
+	{239, "_SC_V7_ILP32_OFFBIG"},
+	{240, "_SC_V7_LP64_OFF64"},
+	{241, "_SC_V7_LPBIG_OFFBIG"},
+	{242, "_SC_SS_REPL_MAX"},
+	{243, "_SC_TRACE_EVENT_NAME_MAX"},
+	{244, "_SC_TRACE_NAME_MAX"},
+	{245, "_SC_TRACE_SYS_MAX"},
+	{246, "_SC_TRACE_USER_EVENT_MAX"},
+	{247, "_SC_XOPEN_STREAMS"},
+	{248, "_SC_THREAD_ROBUST_PRIO_INHERIT"},
+	{249, "_SC_THREAD_ROBUST_PRIO_PROTECT"},
+};
+
+constexpr SymbolicName WORDEXP_FLAGS[] = {
+	// Info from: <wordexp.h>
+	{1 << 0, "WRDE_DOOFFS"},
+	{1 << 1, "WRDE_APPEND"},
+	{1 << 2, "WRDE_NOCMD"},
+	{1 << 3, "WRDE_REUSE"},
+	{1 << 4, "WRDE_SHOWERR"},
+	{1 << 5, "WRDE_UNDEF"},
+};
 
+/// Mapping of function names into symbolic names of their parameters.
+constexpr FuncParamSymbolicNames FUNC_PARAMS_SYMBOLIC_NAMES[] = {
+	//
+	// #include <unistd.h>
+	// int access(const char *path, int amode);
+	//
+	{"access", 2, ACCESS_MODES}, // amode
 	//
 	// #include <aio.h>
 	// int aio_fsync(int operation, struct aiocb *aiocbp);
 	//
-	paramSymbolsMap.clear();
-	// operation
-	paramSymbolsMap[1] = getSymbolicNamesForOpenFlags();
-	funcParamsMap["aio_fsync"] = paramSymbolsMap;
-
+	{"aio_fsync", 1, OPEN_FLAGS}, // operation
 	//
-	// #include <aio.h>
-	// int lio_listio(int mode, struct aiocb *const aiocb_list[],
-	//                int nitems, struct sigevent *sevp);
+	// #include <nl_types.h>
+	// nl_catd catopen(const char *name, int flag);
 	//
-	paramSymbolsMap.clear();
-	// mode
-	symbolicNamesMap.clear();
-	// Info from: <aio.h>
-	symbolicNamesMap[0] = "LIO_WAIT";
-	symbolicNamesMap[1] = "LIO_NOWAIT";
-	paramSymbolsMap[1] = symbolicNamesMap;
-	funcParamsMap["aio_fsync"] = paramSymbolsMap;
-
+	{"catopen", 2, CATOPEN_FLAG}, // flag
 	//
-	// #include <arpa/inet.h>
-	// int inet_net_pton(int address_family, const char *pres,
-	//                   void *netp, size_t nsize);
+	// #include <time.h>
+	// int clock_nanosleep(clockid_t clock_id, int flags,
+	//                     const struct timespec *rqtp,
+	//                     struct timespec *rmtp);
 	//
-	paramSymbolsMap.clear();
-	// address_family
-	paramSymbolsMap[1] = getSymbolicNamesForAddressFamilies();
-	funcParamsMap["inet_net_pton"] = paramSymbolsMap;
-
+	{"clock_nanosleep", 2, TIME_FLAGS}, // flags
 	//
-	// #include <arpa/inet.h>
-	// int inet_net_ntop(int address_family, const void *netp,
-	//                   int bits, char *pres, size_t psize);
+	// #include <unistd.h>
+	// size_t confstr(int name, char *buf, size_t len);
 	//
-	paramSymbolsMap.clear();
-	// address_family
-	paramSymbolsMap[1] = getSymbolicNamesForAddressFamilies();
-	funcParamsMap["inet_net_ntop"] = paramSymbolsMap;
-
+	{"confstr", 1, CONFSTR_NAME}, // name
 	//
-	// #include <arpa/inet.h>
-	// const char *inet_ntop(int address_family, const void *src,
-	//                       char *dst, socklen_t size);
+	// #include <ndbm.h>
+	// DBM *dbm_open(const char *file, int open_flags, mode_t file_mode);
 	//
-	paramSymbolsMap.clear();
-	// address_family
-	paramSymbolsMap[1] = getSymbolicNamesForAddressFamilies();
-	funcParamsMap["inet_ntop"] = paramSymbolsMap;
-
+	{"dbm_open", 2, OPEN_FLAGS}, // open_flags
 	//
-	// #include <arpa/inet.h>
-	// const char *inet_pton(int address_family, const char *src, void *dst);
+	// #include <ndbm.h>
+	// int dbm_store(DBM *db, datum key, datum content, int store_mode);
 	//
-	paramSymbolsMap.clear();
-	// address_family
-	paramSymbolsMap[1] = getSymbolicNamesForAddressFamilies();
-	funcParamsMap["inet_pton"] = paramSymbolsMap;
-
+	{"dbm_store", 4, DBM_STORE_STORE_MODE}, // store_mode
 	//
 	// #include <dlfcn.h>
 	// void *dlopen(const char *filename, int flag);
 	//
-	paramSymbolsMap.clear();
-	// flag
-	symbolicNamesMap.clear();
-	// Info from: <bits/dlfcn.h>
-	symbolicNamesMap[0x00000] = "RTLD_LOCAL";
-	symbolicNamesMap[0x00001] = "RTLD_LAZY";
-	symbolicNamesMap[0x00002] = "RTLD_NOW";
-	symbolicNamesMap[0x00003] = "RTLD_BINDING_MASK";
-	symbolicNamesMap[0x00004] = "RTLD_NOLOAD";
-	symbolicNamesMap[0x00008] = "RTLD_DEEPBIND";
-	symbolicNamesMap[0x00100] = "RTLD_GLOBAL";
-	symbolicNamesMap[0x01000] = "RTLD_NODELETE";
-	paramSymbolsMap[2] = symbolicNamesMap;
-	funcParamsMap["dlopen"] = paramSymbolsMap;
-
+	{"dlopen", 2, DLOPEN_FLAG}, // flag
 	//
 	// #include "error.h"
 	// void error(int status, int err_num, const char *format, ...);
 	//
-	paramSymbolsMap.clear();
-	// err_num
-	paramSymbolsMap[2] = getSymbolicNamesForErrors();
-	funcParamsMap["error"] = paramSymbolsMap;
-
+	{"error", 2, ERRORS}, // err_num
 	//
 	// #include "error.h"
 	// void error_at_line(int status, int errnum, const char *filename,
 	//                    unsigned int linenum, const char *format, ...);
 	//
-	paramSymbolsMap.clear();
-	// err_num
-	paramSymbolsMap[2] = getSymbolicNamesForSignals();
-	funcParamsMap["error_at_line"] = paramSymbolsMap;
-
+	{"error_at_line", 2, SIGNALS}, // err_num
 	//
-	// #include <fcntl.h>
-	// int open(const char *path, int oflag, ...);
+	// #include <unistd.h>
+	// int faccessat(int fd, const char *path, int amode, int flag);
 	//
-	paramSymbolsMap.clear();
-	// oflag
-	paramSymbolsMap[2] = getSymbolicNamesForOpenFlags();
-	funcParamsMap["open"] = paramSymbolsMap;
-
+	{"faccessat", 3, ACCESS_MODES}, // amode
+	{"faccessat", 4, ACCESS_TYPES}, // flag
 	//
-	// #include <fcntl.h>
-	// int fcntl(int fildes, int cmd, ...);
+	// #include <sys/stat.h>
+	// int fchmodat(int fd, const char *path, mode_t mode, int flag);
 	//
-	paramSymbolsMap.clear();
-	// cmd
-	symbolicNamesMap.clear();
-	// Info from: <asm-generic/fcntl.h>
-	symbolicNamesMap[0] = "F_DUPFD";
-	symbolicNamesMap[1] = "F_GETFD";
-	symbolicNamesMap[2] = "F_SETFD";
-	symbolicNamesMap[3] = "F_GETFL";
-	symbolicNamesMap[4] = "F_SETFL";
-	symbolicNamesMap[5] = "F_GETLK";
-	symbolicNamesMap[6] = "F_SETLK";
-	symbolicNamesMap[7] = "F_SETLKW";
-	symbolicNamesMap[8] = "F_SETOWN";
-	symbolicNamesMap[9] = "F_GETOWN";
-	symbolicNamesMap[10] = "F_SETSIG";
-	symbolicNamesMap[11] = "F_GETSIG";
-	symbolicNamesMap[12] = "F_GETLK64";
-	symbolicNamesMap[13] = "F_SETLK64";
-	symbolicNamesMap[14] = "F_SETLKW64";
-	symbolicNamesMap[15] = "F_SETOWN_EX";
-	symbolicNamesMap[16] = "F_GETOWN_EX";
-	symbolicNamesMap[17] = "F_GETOWNER_UIDS";
-	paramSymbolsMap[2] = symbolicNamesMap;
-	funcParamsMap["fcntl"] = paramSymbolsMap;
-
+	{"fchmodat", 2, ACCESS_TYPES}, // flag
 	//
-	// #include <mqueue.h>
-	// mqd_t mq_open(const char *name, int oflag);
-	// mqd_t mq_open(const char *name, int oflag, mode_t mode,
-	//               struct mq_attr *attr);
+	// #include <unistd.h>
+	// int fchownat(int fd, const char *path, uid_t owner,
+	//              gid_t group, int flag);
 	//
-	paramSymbolsMap.clear();
-	// oflag
-	paramSymbolsMap[2] = getSymbolicNamesForOpenFlags();
-	// mode
-	paramSymbolsMap[3] = getSymbolicNamesForPermMode();
-	funcParamsMap["mq_open"] = paramSymbolsMap;
-
+	{"fchownat", 5, ACCESS_TYPES}, // flag
 	//
 	// #include <fcntl.h>
-	// int openat(int fd, const char *path, int oflag, ...);
-	//
-	paramSymbolsMap.clear();
-	// oflag
-	paramSymbolsMap[3] = getSymbolicNamesForOpenFlags();
-	funcParamsMap["openat"] = paramSymbolsMap;
-
+	// int fcntl(int fildes, int cmd, ...);
 	//
-	// #include <fcntl.h>
-	// int posix_fadvise(int fd, off_t offset, off_t len, int advice);
+	{"fcntl", 2, FCNTL_CMD}, // cmd
 	//
-	paramSymbolsMap.clear();
-	// advice
-	symbolicNamesMap.clear();
-	// Info from: <linux/fadvise.h>
-	symbolicNamesMap[0] = "POSIX_FADV_NORMAL";
-	symbolicNamesMap[1] = "POSIX_FADV_RANDOM";
-	symbolicNamesMap[2] = "POSIX_FADV_SEQUENTIAL";
-	symbolicNamesMap[3] = "POSIX_FADV_WILLNEED";
-	symbolicNamesMap[6] = "POSIX_FADV_DONTNEED";
-	symbolicNamesMap[7] = "POSIX_FADV_NOREUSE";
-	symbolicNamesMap[4] = "POSIX_FADV_DONTNEED";
-	symbolicNamesMap[5] = "POSIX_FADV_NOREUSE";
-	paramSymbolsMap[4] = symbolicNamesMap;
-	funcParamsMap["posix_fadvise"] = paramSymbolsMap;
-
+	// #include "sys/file.h"
+	// int flock(int fd, int operation);
 	//
-	// #include <semaphore.h>
-	// sem_t *sem_open(const char *name, int oflag);
-	// sem_t *sem_open(const char *name, int oflag,
-	//                 mode_t mode, unsigned int value);
-	paramSymbolsMap.clear();
-	// oflag
-	paramSymbolsMap[2] = getSymbolicNamesForOpenFlags();
-	// mode
-	paramSymbolsMap[3] = getSymbolicNamesForPermMode();
-	funcParamsMap["sem_open"] = paramSymbolsMap;
-
+	{"flock", 2, FLOCK_OPERATION}, // operation
 	//
 	// #include <fmtmsg.h>
 	// int fmtmsg(long classification, const char *label, int severity,
 	//            const char *text, const char *action, const char *tag);
 	//
-	paramSymbolsMap.clear();
-	// classification
-	symbolicNamesMap.clear();
-	// Info from: <fmtmsg.h>
-	symbolicNamesMap[0x001] = "MM_HARD";
-	symbolicNamesMap[0x002] = "MM_SOFT";
-	symbolicNamesMap[0x004] = "MM_FIRM";
-	symbolicNamesMap[0x008] = "MM_APPL";
-	symbolicNamesMap[0x010] = "MM_UTIL";
-	symbolicNamesMap[0x020] = "MM_OPSYS";
-	symbolicNamesMap[0x040] = "MM_RECOVER";
-	symbolicNamesMap[0x080] = "MM_NRECOV";
-	symbolicNamesMap[0x100] = "MM_PRINT";
-	symbolicNamesMap[0x200] = "MM_CONSOLE";
-	paramSymbolsMap[1] = symbolicNamesMap;
-	// severity
-	symbolicNamesMap.clear();
-	// Info from: <fmtmsg.h>
-	symbolicNamesMap[0] = "MM_NOSEV";
-	symbolicNamesMap[1] = "MM_HALT";
-	symbolicNamesMap[2] = "MM_ERROR";
-	symbolicNamesMap[3] = "MM_WARNING";
-	symbolicNamesMap[4] = "MM_INFO";
-	paramSymbolsMap[3] = symbolicNamesMap;
-	funcParamsMap["fmtmsg"] = paramSymbolsMap;
-
+	{"fmtmsg", 1, FMTMSG_CLASSIFICATION}, // classification
+	{"fmtmsg", 3, FMTMSG_SEVERITY}, // severity
 	//
 	// #include <fnmatch.h>
 	// int fnmatch(const char *pattern, const char *string, int flags);
 	//
-	paramSymbolsMap.clear();
-	// flags
-	symbolicNamesMap.clear();
-	// Info from: <fnmatch.h>
-	symbolicNamesMap[1 << 0] = "FNM_PATHNAME";
-	// symbolicNamesMap[1 << 0] = "FNM_FILE_NAME"; // synonym for FNM_PATHNAME
-	symbolicNamesMap[1 << 1] = "FNM_NOESCAPE";
-	symbolicNamesMap[1 << 3] = "FNM_LEADING_DIR ";
-	symbolicNamesMap[1 << 4] = "FNM_CASEFOLD";
-	symbolicNamesMap[1 << 5] = "FNM_EXTMATCH";
-	paramSymbolsMap[3] = symbolicNamesMap;
-	funcParamsMap["fnmatch"] = paramSymbolsMap;
-
-	//
-	// #include <locale.h>
-	// locale_t newlocale(int locale_category, const char *locale, locale_t base);
-	//
-	paramSymbolsMap.clear();
-	// category_mask
-	paramSymbolsMap[1] = getSymbolicNamesForLocaleCategories();
-	funcParamsMap["newlocale"] = paramSymbolsMap;
-
+	{"fnmatch", 3, FNMATCH_FLAGS}, // flags
 	//
-	// #include <locale.h>
-	// char *setlocale(int locale_category, const char *locale);
+	// #include <unistd.h>
+	// long fpathconf(int fd, int name);
 	//
-	paramSymbolsMap.clear();
-	// category_mask
-	paramSymbolsMap[1] = getSymbolicNamesForLocaleCategories();
-	funcParamsMap["setlocale"] = paramSymbolsMap;
-
+	{"fpathconf", 2, PATH_CONFS}, // name
 	//
-	// #include <ndbm.h>
-	// DBM *dbm_open(const char *file, int open_flags, mode_t file_mode);
+	// #include <stdio.h>
+	// int fseeko(FILE *stream, off_t offset, int whence);
 	//
-	paramSymbolsMap.clear();
-	// open_flags
-	paramSymbolsMap[2] = getSymbolicNamesForOpenFlags();
-	funcParamsMap["dbm_open"] = paramSymbolsMap;
-
+	{"fseeko", 3, SEEK_WHENCE}, // whence
 	//
-	// #include <ndbm.h>
-	// int dbm_store(DBM *db, datum key, datum content, int store_mode);
+	// #include <sys/stat.h>
+	// int fstatat(int fd, const char *restrict path,
+	//             struct stat *restrict buf, int flag);
 	//
-	paramSymbolsMap.clear();
-	// store_mode
-	symbolicNamesMap.clear();
-	// Info from: <db.h>
-	symbolicNamesMap[0] = "DBM_INSERT";
-	symbolicNamesMap[1] = "DBM_REPLACE";
-	paramSymbolsMap[4] = symbolicNamesMap;
-	funcParamsMap["dbm_store"] = paramSymbolsMap;
-
+	{"fstatat", 4, ACCESS_TYPES}, // flag
 	//
 	// #include <netdb.h>
 	// struct hostent *gethostbyaddr(const void *addr, socklen_t len, int type);
 	//
-	paramSymbolsMap.clear();
-	// type
-	paramSymbolsMap[3] = getSymbolicNamesForAddressFamilies();
-	funcParamsMap["gethostbyaddr"] = paramSymbolsMap;
-
+	{"gethostbyaddr", 3, ADDRESS_FAMILIES}, // type
 	//
 	// #include <netdb.h>
 	// int gethostbyaddr_r(const void *addr, socklen_t len, int type,
 	//                     struct hostent *ret, char *buf, size_t buflen,
 	//                     struct hostent **result, int *h_errnop);
 	//
-	paramSymbolsMap.clear();
-	// type
-	paramSymbolsMap[3] = getSymbolicNamesForAddressFamilies();
-	funcParamsMap["gethostbyaddr_r"] = paramSymbolsMap;
-
+	{"gethostbyaddr_r", 3, ADDRESS_FAMILIES}, // type
 	//
 	// #include <netdb.h>
 	// struct hostent *gethostbyname2(const char *name, int address_family);
 	//
-	paramSymbolsMap.clear();
-	// address_family
-	paramSymbolsMap[2] = getSymbolicNamesForAddressFamilies();
-	funcParamsMap["gethostbyname2"] = paramSymbolsMap;
-
+	{"gethostbyname2", 2, ADDRESS_FAMILIES}, // address_family
 	//
 	// #include <netdb.h>
 	// int gethostbyname2_r(const char *name, int address_family,
 	//                      struct hostent *ret, char *buf, size_t buflen,
 	//                      struct hostent **result, int *h_errnop);
 	//
-	paramSymbolsMap.clear();
-	// address_family
-	paramSymbolsMap[2] = getSymbolicNamesForAddressFamilies();
-	funcParamsMap["gethostbyname2_r"] = paramSymbolsMap;
-
+	{"gethostbyname2_r", 2, ADDRESS_FAMILIES}, // address_family
+	//
+	// #include <sys/time.h>
+	// int getitimer(int which, struct itimerval *value);
+	//
+	{"getitimer", 1, ITIMERS}, // which
+	//
+	// #include <sys/socket.h>
+	// #include <netdb.h>
+	// int getnameinfo(const struct sockaddr *sa, socklen_t salen,
+	//                 char *host, socklen_t hostlen, char *serv,
+	//                 socklen_t servlen, int flags);
+	//
+	{"getnameinfo", 2, GETNAMEINFO_FLAGS}, // flags
 	//
 	// #include <netdb.h>
 	// struct netent *getnetbyaddr(uint32_t net, int type);
 	//
-	paramSymbolsMap.clear();
-	// type
-	paramSymbolsMap[2] = getSymbolicNamesForAddressFamilies();
-	funcParamsMap["getnetbyaddr"] = paramSymbolsMap;
-
+	{"getnetbyaddr", 2, ADDRESS_FAMILIES}, // type
 	//
 	// #include <netdb.h>
 	// int getnetbyaddr_r(uint32_t net, int type, struct netent *result_buf,
 	//                    char *buf, size_t buflen, struct netent **result,
 	//                    int *h_errnop);
 	//
-	paramSymbolsMap.clear();
-	// type
-	paramSymbolsMap[2] = getSymbolicNamesForAddressFamilies();
-	funcParamsMap["getnetbyaddr_r"] = paramSymbolsMap;
-
+	{"getnetbyaddr_r", 2, ADDRESS_FAMILIES}, // type
 	//
-	// #include "error.h"
-	// const char *hstrerror(int err_num);
+	// #include <sys/resource.h>
+	// int getpriority(int which, id_t who);
 	//
-	paramSymbolsMap.clear();
-	// err_num
-	paramSymbolsMap[2] = getSymbolicNamesForErrors();
-	funcParamsMap["hstrerror"] = paramSymbolsMap;
-
+	{"getpriority", 1, PRIO_TYPE}, // which
 	//
-	// #include <nl_types.h>
-	// nl_catd catopen(const char *name, int flag);
+	// #include <sys/resource.h>
+	// int getrlimit(int resource, struct rlimit *rlp);
 	//
-	paramSymbolsMap.clear();
-	// flag
-	symbolicNamesMap.clear();
-	// Info from: <nl_types.h>
-	symbolicNamesMap[1] = "NL_CAT_LOCALE";
-	paramSymbolsMap[2] = symbolicNamesMap;
-	funcParamsMap["catopen"] = paramSymbolsMap;
-
+	{"getrlimit", 1, RESOURCES}, // resource
 	//
-	// #include <pthread.h>
-	// int pthread_attr_setdetachstate(pthread_attr_t *attr, int detachstate);
+	// #include <sys/resource.h>
+	// int getrusage(int who, struct rusage *r_usage);
 	//
-	paramSymbolsMap.clear();
-	// detachstate
-	symbolicNamesMap.clear();
-	// Info from: <pthread.h>
-	symbolicNamesMap[0] = "PTHREAD_CREATE_JOINABLE";
-	symbolicNamesMap[1] = "PTHREAD_CREATE_DETACHED";
-	paramSymbolsMap[2] = symbolicNamesMap;
-	funcParamsMap["pthread_attr_setdetachstate"] = paramSymbolsMap;
-
+	{"getrusage", 1, GETRUSAGE_WHO}, // who
 	//
-	// #include "error.h"
-	// int pthread_attr_setinheritsched(pthread_attr_t *attr, int inheritsched);
+	// #include <sys/socket.h>
 	//
-	paramSymbolsMap.clear();
-	// inheritsched
-	symbolicNamesMap.clear();
-	// Info from: <pthread.h>
-	symbolicNamesMap[0] = "PTHREAD_INHERIT_SCHED";
-	symbolicNamesMap[1] = "PTHREAD_EXPLICIT_SCHED";
-	paramSymbolsMap[2] = symbolicNamesMap;
-	funcParamsMap["pthread_attr_setinheritsched"] = paramSymbolsMap;
-
+	// int getsockopt(int socket, int level, int option_name,
+	//                void *restrict option_value,
+	//                socklen_t *restrict option_len);
 	//
-	// #include <pthread.h>
-	// int pthread_attr_setschedpolicy(pthread_attr_t *attr, int policy);
+	{"getsockopt", 1, SOCKET_LEVELS}, // level
+	{"getsockopt", 2, SOCKET_OPTIONS}, // option_name
 	//
-	paramSymbolsMap.clear();
-	// policy
-	paramSymbolsMap[2] = getSymbolicNamesForSchedPolicies();
-	funcParamsMap["pthread_attr_setschedpolicy"] = paramSymbolsMap;
-
+	// #include <signal.h>
+	// int gsignal(int sig);
 	//
-	// #include "error.h"
-	// int pthread_attr_setscope(pthread_attr_t *attr, int scope);
+	{"gsignal", 1, SIGNALS}, // sig
 	//
-	paramSymbolsMap.clear();
-	// scope
-	symbolicNamesMap.clear();
-	// Info from: <pthread.h>
-	symbolicNamesMap[0] = "PTHREAD_SCOPE_SYSTEM";
-	symbolicNamesMap[1] = "PTHREAD_SCOPE_PROCESS";
-	paramSymbolsMap[2] = symbolicNamesMap;
-	funcParamsMap["pthread_attr_setscope"] = paramSymbolsMap;
-
+	// #include "error.h"
+	// const char *hstrerror(int err_num);
 	//
-	// #include <pthread.h>
-	// int pthread_mutexattr_setprotocol(pthread_mutexattr_t *attr, int protocol);
+	{"hstrerror", 2, ERRORS}, // err_num
 	//
-	paramSymbolsMap.clear();
-	// protocol
-	symbolicNamesMap.clear();
-	// Info from: <pthread.h>
-	symbolicNamesMap[0] = "PTHREAD_PRIO_NONE";
-	symbolicNamesMap[1] = "PTHREAD_PRIO_INHERIT";
-	symbolicNamesMap[1] = "PTHREAD_PRIO_PROTECT";
-	paramSymbolsMap[2] = symbolicNamesMap;
-	funcParamsMap["pthread_mutexattr_setprotocol"] = paramSymbolsMap;
-
+	// #include <arpa/inet.h>
+	// int inet_net_ntop(int address_family, const void *netp,
+	//                   int bits, char *pres, size_t psize);
 	//
-	// #include "error.h"
-	// int pthread_mutexattr_setrobust(pthread_mutexattr_t *attr, int robust);
+	{"inet_net_ntop", 1, ADDRESS_FAMILIES}, // address_family
 	//
-	paramSymbolsMap.clear();
-	// robust
-	symbolicNamesMap.clear();
-	// Info from: <pthread.h>
-	symbolicNamesMap[0] = "PTHREAD_MUTEX_STALLED";
-	symbolicNamesMap[1] = "PTHREAD_MUTEX_ROBUST";
-	paramSymbolsMap[2] = symbolicNamesMap;
-	funcParamsMap["pthread_mutexattr_setrobust"] = paramSymbolsMap;
-
+	// #include <arpa/inet.h>
+	// int inet_net_pton(int address_family, const char *pres,
+	//                   void *netp, size_t nsize);
 	//
-	// #include <pthread.h>
-	// int pthread_mutexattr_settype(pthread_mutexattr_t *attr, int type);
+	{"inet_net_pton", 1, ADDRESS_FAMILIES}, // address_family
 	//
-	paramSymbolsMap.clear();
-	// type
-	symbolicNamesMap.clear();
-	// Info from: <pthread.h>
-	symbolicNamesMap[0] = "PTHREAD_MUTEX_NORMAL";
-	// symbolicNamesMap[0] = "PTHREAD_MUTEX_DEFAULT"; // synonym for PTHREAD_MUTEX_NORMAL
-	symbolicNamesMap[1] = "PTHREAD_MUTEX_RECURSIVE";
-	symbolicNamesMap[2] = "PTHREAD_MUTEX_ERRORCHECK";
-	paramSymbolsMap[2] = symbolicNamesMap;
-	funcParamsMap["pthread_mutexattr_settype"] = paramSymbolsMap;
-
+	// #include <arpa/inet.h>
+	// const char *inet_ntop(int address_family, const void *src,
+	//                       char *dst, socklen_t size);
 	//
-	// #include <pthread.h>
-	// int pthread_setcancelstate(int state, int *oldstate);
+	{"inet_ntop", 1, ADDRESS_FAMILIES}, // address_family
 	//
-	paramSymbolsMap.clear();
-	// state
-	symbolicNamesMap.clear();
-	// Info from: <pthread.h>
-	symbolicNamesMap[0] = "PTHREAD_CANCEL_ENABLE";
-	symbolicNamesMap[1] = "PTHREAD_CANCEL_DISABLE";
-	paramSymbolsMap[2] = symbolicNamesMap;
-	funcParamsMap["pthread_setcancelstate"] = paramSymbolsMap;
-
+	// #include <arpa/inet.h>
+	// const char *inet_pton(int address_family, const char *src, void *dst);
 	//
-	// #include <pthread.h>
-	// int pthread_setcanceltype(int type, int *oldtype);
-	//
-	paramSymbolsMap.clear();
-	// type
-	symbolicNamesMap.clear();
-	// Info from: <pthread.h>
-	symbolicNamesMap[0] = "PTHREAD_CANCEL_DEFERRED";
-	symbolicNamesMap[1] = "PTHREAD_CANCEL_ASYNCHRONOUS";
-	paramSymbolsMap[2] = symbolicNamesMap;
-	funcParamsMap["pthread_setcanceltype"] = paramSymbolsMap;
-
-	//
-	// #include <pthread.h>
-	// int pthread_setschedparam(pthread_t thread, int policy,
-	//                           const struct sched_param *param);
-	//
-	paramSymbolsMap.clear();
-	// policy
-	paramSymbolsMap[2] = getSymbolicNamesForSchedPolicies();
-	funcParamsMap["pthread_setschedparam"] = paramSymbolsMap;
-
-	//
-	// #include <spawn.h>
-	// int posix_spawnattr_setschedpolicy(posix_spawnattr_t *attr, int policy);
-	//
-	paramSymbolsMap.clear();
-	// policy
-	paramSymbolsMap[2] = getSymbolicNamesForSchedPolicies();
-	funcParamsMap["posix_spawnattr_setschedpolicy"] = paramSymbolsMap;
-
-	//
-	// #include <pthread.h>
-	// int sched_get_priority_max(int policy);
-	//
-	paramSymbolsMap.clear();
-	// policy
-	paramSymbolsMap[1] = getSymbolicNamesForSchedPolicies();
-	funcParamsMap["sched_get_priority_max"] = paramSymbolsMap;
-
-	//
-	// #include <pthread.h>
-	// int sched_get_priority_min(int policy);
-	//
-	paramSymbolsMap.clear();
-	// policy
-	paramSymbolsMap[1] = getSymbolicNamesForSchedPolicies();
-	funcParamsMap["sched_get_priority_min"] = paramSymbolsMap;
-
-	//
-	// #include <sched.h>
-	// int sched_setscheduler(pid_t pid, int policy,
-	//                        const struct sched_param *param);
-	//
-	paramSymbolsMap.clear();
-	// policy
-	paramSymbolsMap[2] = getSymbolicNamesForSchedPolicies();
-	funcParamsMap["sched_setscheduler"] = paramSymbolsMap;
-
-	//
-	// #include <signal.h>
-	// sighandler_t signal(int sig, sighandler_t handler);
-	//
-	paramSymbolsMap.clear();
-	// sig
-	paramSymbolsMap[1] = getSymbolicNamesForSignals();
-	// handler
-	paramSymbolsMap[2] = getSymbolicNamesForSignalHandlers();
-	funcParamsMap["signal"] = paramSymbolsMap;
-
-	//
-	// #include <signal.h>
-	// int gsignal(int sig);
-	//
-	paramSymbolsMap.clear();
-	// sig
-	paramSymbolsMap[1] = getSymbolicNamesForSignals();
-	funcParamsMap["gsignal"] = paramSymbolsMap;
-
+	{"inet_pton", 1, ADDRESS_FAMILIES}, // address_family
 	//
 	// #include <signal.h>
 	// int kill(pid_t pid, int sig);
 	//
-	paramSymbolsMap.clear();
-	// sig
-	paramSymbolsMap[2] = getSymbolicNamesForSignals();
-	funcParamsMap["kill"] = paramSymbolsMap;
-
+	{"kill", 2, SIGNALS}, // sig
 	//
 	// #include <signal.h>
 	// int killpg(pid_t pgrp, int sig);
 	//
-	paramSymbolsMap.clear();
-	// sig
-	paramSymbolsMap[2] = getSymbolicNamesForSignals();
-	funcParamsMap["killpg"] = paramSymbolsMap;
-
+	{"killpg", 2, SIGNALS}, // sig
 	//
-	// #include <signal.h>
-	// void psignal(int sig, const char *s);
+	// #include <unistd.h>
+	// int linkat(int fd1, const char *path1, int fd2,
+	//            const char *path2, int flag);
 	//
-	paramSymbolsMap.clear();
-	// sig
-	paramSymbolsMap[1] = getSymbolicNamesForSignals();
-	funcParamsMap["psignal"] = paramSymbolsMap;
-
+	{"linkat", 5, ACCESS_TYPES}, // flag
 	//
-	// #include <signal.h>
-	// int pthread_kill(pthread_t thread, int sig);
+	// #include <aio.h>
+	// int lio_listio(int mode, struct aiocb *const aiocb_list[],
+	//                int nitems, struct sigevent *sevp);
 	//
-	paramSymbolsMap.clear();
-	// sig
-	paramSymbolsMap[2] = getSymbolicNamesForSignals();
-	funcParamsMap["pthread_kill"] = paramSymbolsMap;
-
+	{"lio_listio", 1, LIO_LISTIO_MODE}, // mode
 	//
-	// #include <signal.h>
-	// int pthread_sigmask(int how, const sigset_t *set, sigset_t *oldset);
+	// #include <unistd.h>
+	// int lockf(int fd, int cmd, off_t len);
 	//
-	paramSymbolsMap.clear();
-	// how
-	paramSymbolsMap[1] = getSymbolicNamesForSignalMaskActions();
-	funcParamsMap["pthread_sigmask"] = paramSymbolsMap;
-
+	{"lockf", 2, LOCKF_CMD}, // cmd
 	//
-	// #include <signal.h>
-	// int sigaction(int sig, const struct sigaction *restrict act,
-	//               struct sigaction *restrict oact);
+	// #include <unistd.h>
+	// off_t lseek(int fildes, off_t offset, int whence);
 	//
-	paramSymbolsMap.clear();
-	// sig
-	paramSymbolsMap[1] = getSymbolicNamesForSignals();
-	funcParamsMap["sigaction"] = paramSymbolsMap;
-
+	{"lseek", 3, SEEK_WHENCE}, // whence
 	//
-	// #include <signal.h>
-	// int sigaddset(sigset_t *set, int sig);
+	// #include <sys/mman.h>
+	// int mlockall(int flags);
 	//
-	paramSymbolsMap.clear();
-	// sig
-	paramSymbolsMap[2] = getSymbolicNamesForSignals();
-	funcParamsMap["sigaddset"] = paramSymbolsMap;
-
+	{"mlockall", 1, MLOCKALL_FLAGS}, // flags
 	//
-	// #include <signal.h>
-	// int sigdelset(sigset_t *set, int sig);
+	// #include <mqueue.h>
+	// mqd_t mq_open(const char *name, int oflag);
+	// mqd_t mq_open(const char *name, int oflag, mode_t mode,
+	//               struct mq_attr *attr);
 	//
-	paramSymbolsMap.clear();
-	// sig
-	paramSymbolsMap[2] = getSymbolicNamesForSignals();
-	funcParamsMap["sigdelset"] = paramSymbolsMap;
-
+	{"mq_open", 2, OPEN_FLAGS}, // oflag
+	{"mq_open", 3, PERM_MODE}, // mode
 	//
-	// #include <signal.h>
-	// int siginterrupt(int sig, int flag);
+	// #include <sys/msg.h>
+	// int msgctl(int msqid, int cmd, struct msqid_ds *buf);
 	//
-	paramSymbolsMap.clear();
-	// sig
-	paramSymbolsMap[1] = getSymbolicNamesForSignals();
-	funcParamsMap["siginterrupt"] = paramSymbolsMap;
-
+	{"msgctl", 2, MSGCTL_CMD}, // cmd
 	//
-	// #include <signal.h>
-	// int sigismember(const sigset_t *set, int sig);
+	// #include <locale.h>
+	// locale_t newlocale(int locale_category, const char *locale, locale_t base);
 	//
-	paramSymbolsMap.clear();
-	// sig
-	paramSymbolsMap[2] = getSymbolicNamesForSignals();
-	funcParamsMap["sigismember"] = paramSymbolsMap;
-
+	{"newlocale", 1, LOCALE_CATEGORIES}, // category_mask
 	//
-	// #include <signal.h>
-	// int sigprocmask(int how, const sigset_t *set, sigset_t *oldset);
+	// #include <fcntl.h>
+	// int open(const char *path, int oflag, ...);
 	//
-	paramSymbolsMap.clear();
-	// how
-	paramSymbolsMap[1] = getSymbolicNamesForSignalMaskActions();
-	funcParamsMap["sigprocmask"] = paramSymbolsMap;
-
+	{"open", 2, OPEN_FLAGS}, // oflag
 	//
-	// #include <signal.h>
-	// int sigqueue(pid_t pid, int sig, const union sigval value);
+	// #include <fcntl.h>
+	// int openat(int fd, const char *path, int oflag, ...);
 	//
-	paramSymbolsMap.clear();
-	// sig
-	paramSymbolsMap[2] = getSymbolicNamesForSignals();
-	funcParamsMap["sigqueue"] = paramSymbolsMap;
-
+	{"openat", 3, OPEN_FLAGS}, // oflag
 	//
-	// #include <signal.h>
-	// int sigvec(int sig, const struct sigvec *vec, struct sigvec *ovec);
+	// #include <syslog.h>
+	// void openlog(const char *ident, int option, int facility);
 	//
-	paramSymbolsMap.clear();
-	// sig
-	paramSymbolsMap[1] = getSymbolicNamesForSignals();
-	funcParamsMap["sigvec"] = paramSymbolsMap;
-
+	{"openlog", 2, LOG_OPTIONS}, // option
+	{"openlog", 3, LOG_FACILITIES}, // facility
 	//
-	// #include <signal.h>
-	// sighandler_t ssignal(int sig, sighandler_t action);
+	// #include <unistd.h>
+	// long pathconf(const char *path, int name);
 	//
-	paramSymbolsMap.clear();
-	// sig
-	paramSymbolsMap[1] = getSymbolicNamesForSignals();
-	// action
-	symbolicNamesMap.clear();
-	paramSymbolsMap[2] = getSymbolicNamesForSignalHandlers();
-	funcParamsMap["ssignal"] = paramSymbolsMap;
-
+	{"pathconf", 2, PATH_CONFS}, // name
+	//
+	// #include <fcntl.h>
+	// int posix_fadvise(int fd, off_t offset, off_t len, int advice);
+	//
+	{"posix_fadvise", 4, POSIX_FADVISE_ADVICE}, // advice
 	//
 	// #include <spawn.h>
 	// int posix_spawn_file_actions_addopen(
@@ -1647,978 +1851,369 @@ const FuncParamsMap &initFuncParamsMap() {
 	//         int oflag,
 	//         mode_t mode);
 	//
-	paramSymbolsMap.clear();
-	// oflag
-	paramSymbolsMap[4] = getSymbolicNamesForOpenFlags();
-	// mode
-	paramSymbolsMap[5] = getSymbolicNamesForPermMode();
-	funcParamsMap["posix_spawn_file_actions_addopen"] = paramSymbolsMap;
-
-	//
-	// #include <stdio.h>
-	// int fseeko(FILE *stream, off_t offset, int whence);
+	{"posix_spawn_file_actions_addopen", 4, OPEN_FLAGS}, // oflag
+	{"posix_spawn_file_actions_addopen", 5, PERM_MODE}, // mode
 	//
-	paramSymbolsMap.clear();
-	// whence
-	paramSymbolsMap[3] = getSymbolicNamesForSeekWhence();
-	funcParamsMap["fseeko"] = paramSymbolsMap;
-
-	//
-	// #include <signal.h>
-	// char *strsignal(int sig);
-	//
-	paramSymbolsMap.clear();
-	// sig
-	paramSymbolsMap[1] = getSymbolicNamesForSignals();
-	funcParamsMap["strsignal"] = paramSymbolsMap;
-
+	// #include <spawn.h>
+	// int posix_spawnattr_setschedpolicy(posix_spawnattr_t *attr, int policy);
 	//
-	// #include <stropts.h>
-	// int putmsg(int fildes, const struct strbuf *ctlptr,
-	//            const struct strbuf *dataptr, int flags);
+	{"posix_spawnattr_setschedpolicy", 2, SCHED_POLICIES}, // policy
 	//
-	paramSymbolsMap.clear();
-	// flags
-	symbolicNamesMap.clear();
-	// Info from: <bits/stropts.h>
-	symbolicNamesMap[0x01] = "RS_HIPRI";
-	paramSymbolsMap[4] = symbolicNamesMap;
-	funcParamsMap["putmsg"] = paramSymbolsMap;
-
+	// #include "sys/prctl.h"
+	// #include "linux/prctl.h"
+	// int prctl(int option, unsigned long arg2, unsigned long arg3,
+	//           unsigned long arg4, unsigned long arg5);
 	//
-	// #include <stropts.h>
-	// int putpmsg(int fildes, const struct strbuf *ctlptr,
-	//             const struct strbuf *dataptr, int band, int flags);
+	{"prctl", 1, PRCTL_OPTION}, // option
 	//
-	paramSymbolsMap.clear();
-	// flags
-	symbolicNamesMap.clear();
-	// Info from: <bits/stropts.h>
-	symbolicNamesMap[0x01] = "MSG_HIPRI";
-	symbolicNamesMap[0x02] = "MSG_ANY";
-	symbolicNamesMap[0x04] = "MSG_BAND";
-	paramSymbolsMap[5] = symbolicNamesMap;
-	funcParamsMap["putpmsg"] = paramSymbolsMap;
-
+	// #include <signal.h>
+	// void psignal(int sig, const char *s);
 	//
-	// #include "sys/file.h"
-	// int flock(int fd, int operation);
+	{"psignal", 1, SIGNALS}, // sig
 	//
-	paramSymbolsMap.clear();
-	// operation
-	symbolicNamesMap.clear();
-	// Info from: <sys/file.h>
-	symbolicNamesMap[1] = "LOCK_SH";
-	symbolicNamesMap[2] = "LOCK_EX";
-	symbolicNamesMap[4] = "LOCK_NB";
-	symbolicNamesMap[8] = "LOCK_UN";
-	paramSymbolsMap[2] = symbolicNamesMap;
-	funcParamsMap["flock"] = paramSymbolsMap;
-
+	// #include <pthread.h>
+	// int pthread_attr_setdetachstate(pthread_attr_t *attr, int detachstate);
 	//
-	// #include <sys/mman.h>
-	// int mlockall(int flags);
+	{"pthread_attr_setdetachstate", 2, PTHREAD_ATTR_SETDETACHSTATE_DETACHSTATE}, // detachstate
 	//
-	paramSymbolsMap.clear();
-	// flags
-	symbolicNamesMap.clear();
-	// Info from: <asm-generic/mman.h>
-	symbolicNamesMap[1] = "MCL_CURRENT";
-	symbolicNamesMap[2] = "MCL_FUTURE";
-	paramSymbolsMap[1] = symbolicNamesMap;
-	funcParamsMap["mlockall"] = paramSymbolsMap;
-
+	// #include "error.h"
+	// int pthread_attr_setinheritsched(pthread_attr_t *attr, int inheritsched);
 	//
-	// #include <sys/mman.h>
-	// int shm_open(const char *name, int oflag, mode_t mode);
+	{"pthread_attr_setinheritsched", 2, PTHREAD_ATTR_SETINHERITSCHED_INHERITSCHED}, // inheritsched
 	//
-	paramSymbolsMap.clear();
-	// oflag
-	paramSymbolsMap[2] = getSymbolicNamesForOpenFlags();
-	// mode
-	paramSymbolsMap[3] = getSymbolicNamesForPermMode();
-	funcParamsMap["shm_open"] = paramSymbolsMap;
-
+	// #include <pthread.h>
+	// int pthread_attr_setschedpolicy(pthread_attr_t *attr, int policy);
 	//
-	// #include <sys/msg.h>
-	// int msgctl(int msqid, int cmd, struct msqid_ds *buf);
+	{"pthread_attr_setschedpolicy", 2, SCHED_POLICIES}, // policy
 	//
-	paramSymbolsMap.clear();
-	// cmd
-	symbolicNamesMap.clear();
-	// Info from: <bits/ipc.h>
-	symbolicNamesMap[0] = "IPC_RMID";
-	symbolicNamesMap[1] = "IPC_SET";
-	symbolicNamesMap[2] = "IPC_STAT";
-	paramSymbolsMap[2] = symbolicNamesMap;
-	funcParamsMap["msgctl"] = paramSymbolsMap;
-
+	// #include "error.h"
+	// int pthread_attr_setscope(pthread_attr_t *attr, int scope);
 	//
-	// #include "sys/prctl.h"
-	// #include "linux/prctl.h"
-	// int prctl(int option, unsigned long arg2, unsigned long arg3,
-	//           unsigned long arg4, unsigned long arg5);
+	{"pthread_attr_setscope", 2, PTHREAD_ATTR_SETSCOPE_SCOPE}, // scope
 	//
-	paramSymbolsMap.clear();
-	// option
-	symbolicNamesMap.clear();
-	// Info from: <linux/prctl.h>
-	symbolicNamesMap[1] = "PR_SET_PDEATHSIG";
-	symbolicNamesMap[2] = "PR_GET_PDEATHSIG";
-	symbolicNamesMap[3] = "PR_GET_DUMPABLE";
-	symbolicNamesMap[4] = "PR_SET_DUMPABLE";
-	symbolicNamesMap[5] = "PR_GET_UNALIGN";
-	symbolicNamesMap[6] = "PR_SET_UNALIGN";
-	symbolicNamesMap[7] = "PR_GET_KEEPCAPS";
-	symbolicNamesMap[8] = "PR_SET_KEEPCAPS";
-	symbolicNamesMap[9] = "PR_GET_FPEMU";
-	symbolicNamesMap[10] = "PR_SET_FPEMU";
-	symbolicNamesMap[11] = "PR_GET_FPEXC";
-	symbolicNamesMap[12] = "PR_SET_FPEXC";
-	symbolicNamesMap[13] = "PR_GET_TIMING";
-	symbolicNamesMap[14] = "PR_SET_TIMING";
-	symbolicNamesMap[15] = "PR_SET_NAME";
-	symbolicNamesMap[16] = "PR_GET_NAME";
-	symbolicNamesMap[19] = "PR_GET_ENDIAN";
-	symbolicNamesMap[20] = "PR_SET_ENDIAN";
-	symbolicNamesMap[21] = "PR_GET_SECCOMP";
-	symbolicNamesMap[22] = "PR_SET_SECCOMP";
-	symbolicNamesMap[23] = "PR_CAPBSET_READ";
-	symbolicNamesMap[24] = "PR_CAPBSET_DROP";
-	symbolicNamesMap[25] = "PR_GET_TSC";
-	symbolicNamesMap[26] = "PR_SET_TSC";
-	symbolicNamesMap[27] = "PR_GET_SECUREBITS";
-	symbolicNamesMap[28] = "PR_SET_SECUREBITS";
-	symbolicNamesMap[29] = "PR_SET_TIMERSLACK";
-	symbolicNamesMap[30] = "PR_GET_TIMERSLACK";
-	symbolicNamesMap[31] = "PR_TASK_PERF_EVENTS_DISABLE";
-	symbolicNamesMap[32] = "PR_TASK_PERF_EVENTS_ENABLE";
-	symbolicNamesMap[33] = "PR_MCE_KILL";
-	symbolicNamesMap[34] = "PR_MCE_KILL_GET";
-	symbolicNamesMap[35] = "PR_SET_MM";
-	symbolicNamesMap[36] = "PR_SET_CHILD_SUBREAPER";
-	symbolicNamesMap[37] = "PR_GET_CHILD_SUBREAPER";
-	symbolicNamesMap[38] = "PR_SET_NO_NEW_PRIVS";
-	symbolicNamesMap[39] = "PR_GET_NO_NEW_PRIVS";
-	symbolicNamesMap[40] = "PR_GET_TID_ADDRESS";
-	paramSymbolsMap[1] = symbolicNamesMap;
-	funcParamsMap["prctl"] = paramSymbolsMap;
-
+	// #include <signal.h>
+	// int pthread_kill(pthread_t thread, int sig);
 	//
-	// #include <sys/resource.h>
-	// int getpriority(int which, id_t who);
+	{"pthread_kill", 2, SIGNALS}, // sig
 	//
-	paramSymbolsMap.clear();
-	// which
-	paramSymbolsMap[1] = getSymbolicNamesForPrioType();
-	funcParamsMap["getpriority"] = paramSymbolsMap;
-
+	// #include <pthread.h>
+	// int pthread_mutexattr_setprotocol(pthread_mutexattr_t *attr, int protocol);
 	//
-	// #include <sys/resource.h>
-	// int getrlimit(int resource, struct rlimit *rlp);
+	{"pthread_mutexattr_setprotocol", 2, PTHREAD_MUTEXATTR_SETPROTOCOL_PROTOCOL}, // protocol
 	//
-	paramSymbolsMap.clear();
-	// resource
-	paramSymbolsMap[1] = getSymbolicNamesForResources();
-	funcParamsMap["getrlimit"] = paramSymbolsMap;
-
+	// #include "error.h"
+	// int pthread_mutexattr_setrobust(pthread_mutexattr_t *attr, int robust);
 	//
-	// #include <sys/resource.h>
-	// int setrlimit(int resource, struct rlimit *rlp);
+	{"pthread_mutexattr_setrobust", 2, PTHREAD_MUTEXATTR_SETROBUST_ROBUST}, // robust
 	//
-	paramSymbolsMap.clear();
-	// resource
-	paramSymbolsMap[1] = getSymbolicNamesForResources();
-	funcParamsMap["setrlimit"] = paramSymbolsMap;
-
+	// #include <pthread.h>
+	// int pthread_mutexattr_settype(pthread_mutexattr_t *attr, int type);
 	//
-	// #include <sys/resource.h>
-	// int getrusage(int who, struct rusage *r_usage);
+	{"pthread_mutexattr_settype", 2, PTHREAD_MUTEXATTR_SETTYPE_TYPE}, // type
 	//
-	// who
-	symbolicNamesMap.clear();
-	// Info from: <bits/resource.h>
-	symbolicNamesMap[0] = "RUSAGE_SELF";
-	symbolicNamesMap[-1] = "RUSAGE_CHILDREN";
-	symbolicNamesMap[1] = "RUSAGE_THREAD";
-	paramSymbolsMap[3] = symbolicNamesMap;
-	funcParamsMap["getrusage"] = paramSymbolsMap;
-
+	// #include <pthread.h>
+	// int pthread_setcancelstate(int state, int *oldstate);
 	//
-	// #include <sys/resource.h>
-	// int setpriority(int which, id_t who, int value);
+	{"pthread_setcancelstate", 2, PTHREAD_SETCANCELSTATE_STATE}, // state
 	//
-	paramSymbolsMap.clear();
-	// which
-	paramSymbolsMap[1] = getSymbolicNamesForPrioType();
-	funcParamsMap["setpriority"] = paramSymbolsMap;
-
+	// #include <pthread.h>
+	// int pthread_setcanceltype(int type, int *oldtype);
 	//
-	// #include <sys/sem.h>
-	// int semctl(int semid, int semnum, int cmd, ...);
+	{"pthread_setcanceltype", 2, PTHREAD_SETCANCELTYPE_TYPE}, // type
 	//
-	paramSymbolsMap.clear();
-	// cmd
-	symbolicNamesMap.clear();
-	// Info from: <bits/sem.h>
-	symbolicNamesMap[11] = "GETPID";
-	symbolicNamesMap[12] = "GETVAL";
-	symbolicNamesMap[13] = "GETALL";
-	symbolicNamesMap[14] = "GETNCNT";
-	symbolicNamesMap[15] = "GETZCNT";
-	symbolicNamesMap[16] = "SETVAL";
-	symbolicNamesMap[17] = "SETALL";
-	// Info from: <bits/ipc.h>
-	symbolicNamesMap[0] = "IPC_RMID";
-	symbolicNamesMap[1] = "IPC_SET";
-	symbolicNamesMap[2] = "IPC_STAT";
-	paramSymbolsMap[3] = symbolicNamesMap;
-	funcParamsMap["semctl"] = paramSymbolsMap;
-
+	// #include <pthread.h>
+	// int pthread_setschedparam(pthread_t thread, int policy,
+	//                           const struct sched_param *param);
 	//
-	// #include <sys/shm.h>
-	// int shmctl(int shmid, int cmd, struct shmid_ds *buf);
+	{"pthread_setschedparam", 2, SCHED_POLICIES}, // policy
 	//
-	paramSymbolsMap.clear();
-	// cmd
-	symbolicNamesMap.clear();
-	// Info from: <bits/ipc.h>
-	symbolicNamesMap[0] = "IPC_RMID";
-	symbolicNamesMap[1] = "IPC_SET";
-	symbolicNamesMap[2] = "IPC_STAT";
-	paramSymbolsMap[2] = symbolicNamesMap;
-	funcParamsMap["shmctl"] = paramSymbolsMap;
-
+	// #include <signal.h>
+	// int pthread_sigmask(int how, const sigset_t *set, sigset_t *oldset);
 	//
-	// #include <sys/socket.h>
-	// #include <netdb.h>
-	// int getnameinfo(const struct sockaddr *sa, socklen_t salen,
-	//                 char *host, socklen_t hostlen, char *serv,
-	//                 socklen_t servlen, int flags);
+	{"pthread_sigmask", 1, SIGNAL_MASK_ACTIONS}, // how
 	//
-	paramSymbolsMap.clear();
-	// flags
-	symbolicNamesMap.clear();
-	// Info from: <netdb.h>
-	symbolicNamesMap[1] = "NI_NUMERICHOST";
-	symbolicNamesMap[2] = "NI_NUMERICSERV";
-	symbolicNamesMap[4] = "NI_NOFQDN";
-	symbolicNamesMap[8] = "NI_NAMEREQD";
-	symbolicNamesMap[16] = "NI_DGRAM";
-	symbolicNamesMap[32] = "NI_IDN";
-	symbolicNamesMap[64] = "NI_IDN_ALLOW_UNASSIGNED";
-	symbolicNamesMap[128] = "NI_IDN_USE_STD3_ASCII_RULES";
-	paramSymbolsMap[2] = symbolicNamesMap;
-	funcParamsMap["getnameinfo"] = paramSymbolsMap;
-
+	// #include <stropts.h>
+	// int putmsg(int fildes, const struct strbuf *ctlptr,
+	//            const struct strbuf *dataptr, int flags);
 	//
-	// #include <sys/socket.h>
+	{"putmsg", 4, PUTMSG_FLAGS}, // flags
 	//
-	// int getsockopt(int socket, int level, int option_name,
-	//                void *restrict option_value,
-	//                socklen_t *restrict option_len);
+	// #include <stropts.h>
+	// int putpmsg(int fildes, const struct strbuf *ctlptr,
+	//             const struct strbuf *dataptr, int band, int flags);
 	//
-	paramSymbolsMap.clear();
-	// level
-	paramSymbolsMap[1] = getSymbolicNamesForSocketLevels();
-	// option_name
-	paramSymbolsMap[2] = getSymbolicNamesForSocketOptions();
-	funcParamsMap["getsockopt"] = paramSymbolsMap;
-
+	{"putpmsg", 5, PUTPMSG_FLAGS}, // flags
 	//
 	// #include <sys/socket.h>
 	// ssize_t recv(int socket, void *buffer, size_t length, int flags);
 	//
-	paramSymbolsMap.clear();
-	// flags
-	paramSymbolsMap[4] = getSymbolicNamesForMessageFlags();
-	funcParamsMap["recv"] = paramSymbolsMap;
-
+	{"recv", 4, MESSAGE_FLAGS}, // flags
 	//
 	// #include <sys/socket.h>
 	// ssize_t recvfrom(int socket, void *restrict buffer, size_t length,
 	//                  int flags, struct sockaddr *restrict address,
 	//                  socklen_t *restrict address_len);
 	//
-	paramSymbolsMap.clear();
-	// flags
-	paramSymbolsMap[4] = getSymbolicNamesForMessageFlags();
-	funcParamsMap["recvfrom"] = paramSymbolsMap;
-
+	{"recvfrom", 4, MESSAGE_FLAGS}, // flags
 	//
 	// #include <sys/socket.h>
 	// ssize_t recvmsg(int socket, struct msghdr *message, int flags);
 	//
-	paramSymbolsMap.clear();
-	// flags
-	paramSymbolsMap[3] = getSymbolicNamesForMessageFlags();
-	funcParamsMap["recvmsg"] = paramSymbolsMap;
-
+	{"recvmsg", 3, MESSAGE_FLAGS}, // flags
 	//
-	// #include <sys/socket.h>
-	// ssize_t send(int socket, const void *buffer, size_t length, int flags);
+	// #include <regex.h>
+	// int regcomp(regex_t *preg, const char *regex, int cflags);
 	//
-	paramSymbolsMap.clear();
-	// flags
-	paramSymbolsMap[4] = getSymbolicNamesForMessageFlags();
-	funcParamsMap["send"] = paramSymbolsMap;
-
+	{"regcomp", 1, REGCOMP_CFLAGS}, // cflags
+	//
+	// #include <regex.h>
+	// int regexec(const regex_t *preg, const char *string, size_t nmatch,
+	//             regmatch_t pmatch[], int eflags);
+	//
+	{"regexec", 5, REGEXEC_EFLAGS}, // eflags
+	//
+	// #include <pthread.h>
+	// int sched_get_priority_max(int policy);
+	//
+	{"sched_get_priority_max", 1, SCHED_POLICIES}, // policy
+	//
+	// #include <pthread.h>
+	// int sched_get_priority_min(int policy);
+	//
+	{"sched_get_priority_min", 1, SCHED_POLICIES}, // policy
+	//
+	// #include <sched.h>
+	// int sched_setscheduler(pid_t pid, int policy,
+	//                        const struct sched_param *param);
+	//
+	{"sched_setscheduler", 2, SCHED_POLICIES}, // policy
+	//
+	// #include <semaphore.h>
+	// sem_t *sem_open(const char *name, int oflag);
+	// sem_t *sem_open(const char *name, int oflag,
+	//                 mode_t mode, unsigned int value);
+	{"sem_open", 2, OPEN_FLAGS}, // oflag
+	{"sem_open", 3, PERM_MODE}, // mode
+	//
+	// #include <sys/sem.h>
+	// int semctl(int semid, int semnum, int cmd, ...);
+	//
+	{"semctl", 3, SEMCTL_CMD}, // cmd
 	//
 	// #include <sys/socket.h>
 	// ssize_t send(int socket, const void *buffer, size_t length, int flags);
 	//
-	paramSymbolsMap.clear();
-	// flags
-	paramSymbolsMap[4] = getSymbolicNamesForMessageFlags();
-	funcParamsMap["send"] = paramSymbolsMap;
-
+	{"send", 4, MESSAGE_FLAGS}, // flags
 	//
 	// #include <sys/socket.h>
 	// ssize_t sendto(int socket, const void *message, size_t length, int flags,
 	//                const struct sockaddr *dest_addr, socklen_t dest_len);
 	//
-	paramSymbolsMap.clear();
-	// flags
-	paramSymbolsMap[4] = getSymbolicNamesForMessageFlags();
-	funcParamsMap["sendto"] = paramSymbolsMap;
-
+	{"sendto", 4, MESSAGE_FLAGS}, // flags
+	//
+	// #include <sys/time.h>
+	// int setitimer(int which, const struct itimerval *restrict value,
+	//               struct itimerval *restrict ovalue);
+	//
+	{"setitimer", 1, ITIMERS}, // which
+	//
+	// #include <locale.h>
+	// char *setlocale(int locale_category, const char *locale);
+	//
+	{"setlocale", 1, LOCALE_CATEGORIES}, // category_mask
+	//
+	// #include <sys/resource.h>
+	// int setpriority(int which, id_t who, int value);
+	//
+	{"setpriority", 1, PRIO_TYPE}, // which
+	//
+	// #include <sys/resource.h>
+	// int setrlimit(int resource, struct rlimit *rlp);
+	//
+	{"setrlimit", 1, RESOURCES}, // resource
 	//
 	// #include <sys/socket.h>
 	//
 	// int setsockopt(int socket, int level, int option_name,
 	//                const void *option_value, socklen_t option_len);
 	//
-	paramSymbolsMap.clear();
-	// level
-	paramSymbolsMap[1] = getSymbolicNamesForSocketLevels();
-	// option_name
-	paramSymbolsMap[2] = getSymbolicNamesForSocketOptions();
-	funcParamsMap["setsockopt"] = paramSymbolsMap;
-
+	{"setsockopt", 1, SOCKET_LEVELS}, // level
+	{"setsockopt", 2, SOCKET_OPTIONS}, // option_name
 	//
-	// #include <sys/socket.h>
-	// int shutdown(int socket, int how);
+	// #include <sys/mman.h>
+	// int shm_open(const char *name, int oflag, mode_t mode);
 	//
-	// how
-	symbolicNamesMap.clear();
-	// Info from: <sys/socket.h>
-	symbolicNamesMap[0] = "SHUT_RD";
-	symbolicNamesMap[1] = "SHUT_WR";
-	symbolicNamesMap[2] = "SHUT_RDWR";
-	paramSymbolsMap[2] = symbolicNamesMap;
-	funcParamsMap["shutdown"] = paramSymbolsMap;
-
+	{"shm_open", 2, OPEN_FLAGS}, // oflag
+	{"shm_open", 3, PERM_MODE}, // mode
 	//
-	// #include <sys/socket.h>
-	// int socket(int domain, int type, int protocol);
+	// #include <sys/shm.h>
+	// int shmctl(int shmid, int cmd, struct shmid_ds *buf);
 	//
-	paramSymbolsMap.clear();
-	// domain
-	paramSymbolsMap[1] = getSymbolicNamesForAddressFamilies();
-	// type
-	paramSymbolsMap[2] = getSymbolicNamesForSocketTypes();
-	// protocol
-	paramSymbolsMap[3] = getSymbolicNamesForIPProtocols();
-	funcParamsMap["socket"] = paramSymbolsMap;
-
+	{"shmctl", 2, SHMCTL_CMD}, // cmd
 	//
 	// #include <sys/socket.h>
-	// int socketpair(int domain, int type, int protocol, int socket_vector[2]);
+	// int shutdown(int socket, int how);
 	//
-	paramSymbolsMap.clear();
-	// domain
-	paramSymbolsMap[1] = getSymbolicNamesForAddressFamilies();
-	// type
-	paramSymbolsMap[2] = getSymbolicNamesForSocketTypes();
-	// protocol
-	paramSymbolsMap[3] = getSymbolicNamesForIPProtocols();
-	funcParamsMap["socketpair"] = paramSymbolsMap;
-
+	{"shutdown", 2, SHUTDOWN_HOW}, // how
 	//
-	// #include <sys/stat.h>
-	// int fchmodat(int fd, const char *path, mode_t mode, int flag);
+	// #include <signal.h>
+	// int sigaction(int sig, const struct sigaction *restrict act,
+	//               struct sigaction *restrict oact);
 	//
-	paramSymbolsMap.clear();
-	// flag
-	paramSymbolsMap[2] = getSymbolicNamesForAccessTypes();
-	funcParamsMap["fchmodat"] = paramSymbolsMap;
-
+	{"sigaction", 1, SIGNALS}, // sig
 	//
-	// #include <sys/stat.h>
-	// int fstatat(int fd, const char *restrict path,
-	//             struct stat *restrict buf, int flag);
+	// #include <signal.h>
+	// int sigaddset(sigset_t *set, int sig);
 	//
-	paramSymbolsMap.clear();
-	// flag
-	paramSymbolsMap[4] = getSymbolicNamesForAccessTypes();
-	funcParamsMap["fstatat"] = paramSymbolsMap;
-
+	{"sigaddset", 2, SIGNALS}, // sig
 	//
-	// #include <sys/stat.h>
-	// int utimensat(int fd, const char *path,
-	//               const struct timespec times[2], int flag);
+	// #include <signal.h>
+	// int sigdelset(sigset_t *set, int sig);
 	//
-	paramSymbolsMap.clear();
-	// flag
-	paramSymbolsMap[4] = getSymbolicNamesForAccessTypes();
-	funcParamsMap["utimensat"] = paramSymbolsMap;
-
+	{"sigdelset", 2, SIGNALS}, // sig
 	//
-	// #include <sys/time.h>
-	// int getitimer(int which, struct itimerval *value);
+	// #include <signal.h>
+	// int siginterrupt(int sig, int flag);
 	//
-	paramSymbolsMap.clear();
-	// which
-	paramSymbolsMap[1] = getSymbolicNamesForITimers();
-	funcParamsMap["getitimer"] = paramSymbolsMap;
-
+	{"siginterrupt", 1, SIGNALS}, // sig
 	//
-	// #include <sys/time.h>
-	// int setitimer(int which, const struct itimerval *restrict value,
-	//               struct itimerval *restrict ovalue);
+	// #include <signal.h>
+	// int sigismember(const sigset_t *set, int sig);
 	//
-	paramSymbolsMap.clear();
-	// which
-	paramSymbolsMap[1] = getSymbolicNamesForITimers();
-	funcParamsMap["setitimer"] = paramSymbolsMap;
-
+	{"sigismember", 2, SIGNALS}, // sig
 	//
-	// #include <regex.h>
-	// int regcomp(regex_t *preg, const char *regex, int cflags);
+	// #include <signal.h>
+	// sighandler_t signal(int sig, sighandler_t handler);
 	//
-	paramSymbolsMap.clear();
-	// cflags
-	symbolicNamesMap.clear();
-	// Info from: <regex.h>
-	symbolicNamesMap[1] = "REG_EXTENDED";
-	symbolicNamesMap[2] = "REG_ICASE";
-	symbolicNamesMap[4] = "REG_NEWLINE";
-	symbolicNamesMap[8] = "REG_NOSUB";
-	paramSymbolsMap[1] = symbolicNamesMap;
-	funcParamsMap["regcomp"] = paramSymbolsMap;
-
+	{"signal", 1, SIGNALS}, // sig
+	{"signal", 2, SIGNAL_HANDLERS}, // handler
 	//
-	// #include <regex.h>
-	// int regexec(const regex_t *preg, const char *string, size_t nmatch,
-	//             regmatch_t pmatch[], int eflags);
+	// #include <signal.h>
+	// int sigprocmask(int how, const sigset_t *set, sigset_t *oldset);
 	//
-	paramSymbolsMap.clear();
-	// eflags
-	symbolicNamesMap.clear();
-	// Info from: <regex.h>
-	symbolicNamesMap[1] = "REG_NOTBOL";
-	symbolicNamesMap[2] = "REG_NOTEOL";
-	symbolicNamesMap[4] = "REG_STARTEND";
-	paramSymbolsMap[5] = symbolicNamesMap;
-	funcParamsMap["regexec"] = paramSymbolsMap;
-
+	{"sigprocmask", 1, SIGNAL_MASK_ACTIONS}, // how
 	//
-	// #include <sys/wait.h>
-	// pid_t waitpid(pid_t pid, int *status, int options);
+	// #include <signal.h>
+	// int sigqueue(pid_t pid, int sig, const union sigval value);
 	//
-	paramSymbolsMap.clear();
-	// options
-	paramSymbolsMap[3] = getSymbolicNamesForWaitOptions();
-	funcParamsMap["waitpid"] = paramSymbolsMap;
-
+	{"sigqueue", 2, SIGNALS}, // sig
 	//
-	// #include <sys/wait.h>
-	// int waitid(idtype_t idtype, id_t id, siginfo_t *infop, int options);
+	// #include <signal.h>
+	// int sigvec(int sig, const struct sigvec *vec, struct sigvec *ovec);
 	//
-	paramSymbolsMap.clear();
-	// options
-	paramSymbolsMap[4] = getSymbolicNamesForWaitOptions();
-	funcParamsMap["waitid"] = paramSymbolsMap;
-
+	{"sigvec", 1, SIGNALS}, // sig
 	//
-	// #include <sys/wait.h>
-	// pid_t wait3(int *status, int options, struct rusage *rusage);
+	// #include <sys/socket.h>
+	// int socket(int domain, int type, int protocol);
 	//
-	paramSymbolsMap.clear();
-	// options
-	paramSymbolsMap[2] = getSymbolicNamesForWaitOptions();
-	funcParamsMap["wait3"] = paramSymbolsMap;
-
+	{"socket", 1, ADDRESS_FAMILIES}, // domain
+	{"socket", 2, SOCKET_TYPES}, // type
+	{"socket", 3, IP_PROTOCOLS}, // protocol
 	//
-	// #include <sys/wait.h>
-	// pid_t wait4(pid_t pid, int *status, int options, struct rusage *rusage);
+	// #include <sys/socket.h>
+	// int socketpair(int domain, int type, int protocol, int socket_vector[2]);
 	//
-	paramSymbolsMap.clear();
-	// options
-	paramSymbolsMap[3] = getSymbolicNamesForWaitOptions();
-	funcParamsMap["wait4"] = paramSymbolsMap;
-
+	{"socketpair", 1, ADDRESS_FAMILIES}, // domain
+	{"socketpair", 2, SOCKET_TYPES}, // type
+	{"socketpair", 3, IP_PROTOCOLS}, // protocol
 	//
-	// #include <syslog.h>
-	// void openlog(const char *ident, int option, int facility);
+	// #include <signal.h>
+	// sighandler_t ssignal(int sig, sighandler_t action);
 	//
-	paramSymbolsMap.clear();
-	// option
-	paramSymbolsMap[2] = getSymbolicNamesForLogOptions();
-	// facility
-	paramSymbolsMap[3] = getSymbolicNamesForLogFacilities();
-	funcParamsMap["openlog"] = paramSymbolsMap;
-
+	{"ssignal", 1, SIGNALS}, // sig
+	{"ssignal", 2, SIGNAL_HANDLERS}, // action
 	//
-	// #include <syslog.h>
-	// void syslog(int priority, const char *format, ...);
+	// #include <signal.h>
+	// char *strsignal(int sig);
 	//
-	paramSymbolsMap.clear();
-	// priority
-	paramSymbolsMap[1] = getSymbolicNamesForLogPriorities();
-	funcParamsMap["syslog"] = paramSymbolsMap;
-
+	{"strsignal", 1, SIGNALS}, // sig
 	//
-	// #include <syslog.h>
-	// void vsyslog(int priority, const char *format, va_list ap);
+	// #include <unistd.h>
+	// long syscall(long number, ...);
 	//
-	paramSymbolsMap.clear();
-	// priority
-	paramSymbolsMap[1] = getSymbolicNamesForLogPriorities();
-	funcParamsMap["vsyslog"] = paramSymbolsMap;
-
+	{"syscall", 1, SYSTEM_CALLS}, // number
 	//
-	// #include <termios.h>
-	// int tcsetattr(int fd, int optional_actions,
-	//               const struct termios *termios_p);
+	// #include <unistd.h>
+	// long sysconf(int name);
 	//
-	paramSymbolsMap.clear();
-	// optional_actions
-	symbolicNamesMap.clear();
-	// Info from: <bits/termios.h>
-	symbolicNamesMap[0] = "TCSANOW";
-	symbolicNamesMap[1] = "TCSADRAIN";
-	symbolicNamesMap[2] = "TCSAFLUSH";
-	paramSymbolsMap[2] = symbolicNamesMap;
-	funcParamsMap["tcsetattr"] = paramSymbolsMap;
-
+	{"sysconf", 1, SYSCONF_NAME}, // name
+	//
+	// #include <syslog.h>
+	// void syslog(int priority, const char *format, ...);
+	//
+	{"syslog", 1, LOG_PRIORITIES}, // priority
 	//
 	// #include <termios.h>
 	// int tcflow(int fd, int action);
 	//
-	paramSymbolsMap.clear();
-	// action
-	symbolicNamesMap.clear();
-	// Info from: <bits/termios.h>
-	symbolicNamesMap[0] = "TCOOFF";
-	symbolicNamesMap[1] = "TCOON";
-	symbolicNamesMap[2] = "TCIOFF";
-	symbolicNamesMap[3] = "TCION";
-	paramSymbolsMap[2] = symbolicNamesMap;
-	funcParamsMap["tcflow"] = paramSymbolsMap;
-
+	{"tcflow", 2, TCFLOW_ACTION}, // action
 	//
 	// #include <termios.h>
 	// int tcflush(int fd, int queue_selector);
 	//
-	paramSymbolsMap.clear();
-	// queue_selector
-	symbolicNamesMap.clear();
-	// Info from: <bits/termios.h>
-	symbolicNamesMap[0] = "TCIFLUSH";
-	symbolicNamesMap[1] = "TCOFLUSH";
-	symbolicNamesMap[2] = "TCIOFLUSH";
-	paramSymbolsMap[2] = symbolicNamesMap;
-	funcParamsMap["tcflush"] = paramSymbolsMap;
-
+	{"tcflush", 2, TCFLUSH_QUEUE_SELECTOR}, // queue_selector
 	//
-	// #include <time.h>
-	// int clock_nanosleep(clockid_t clock_id, int flags,
-	//                     const struct timespec *rqtp,
-	//                     struct timespec *rmtp);
+	// #include <termios.h>
+	// int tcsetattr(int fd, int optional_actions,
+	//               const struct termios *termios_p);
 	//
-	paramSymbolsMap.clear();
-	// flags
-	paramSymbolsMap[2] = getSymbolicNamesForTimeFlags();
-	funcParamsMap["clock_nanosleep"] = paramSymbolsMap;
-
+	{"tcsetattr", 2, TCSETATTR_OPTIONAL_ACTIONS}, // optional_actions
 	//
 	// #include <time.h>
 	// int timer_settime(timer_t timerid, int flags,
 	//                   const struct itimerspec *restrict value,
 	//                   struct itimerspec *restrict ovalue);
 	//
-	paramSymbolsMap.clear();
-	// flags
-	paramSymbolsMap[2] = getSymbolicNamesForTimeFlags();
-	funcParamsMap["timer_settime"] = paramSymbolsMap;
-
+	{"timer_settime", 2, TIME_FLAGS}, // flags
 	//
 	// #include <ulimit.h>
 	// long ulimit(int cmd, long newlimit);
 	//
-	paramSymbolsMap.clear();
-	// cmd
-	symbolicNamesMap.clear();
-	// Info from: <fcntl.h>
-	symbolicNamesMap[1] = "UL_GETFSIZE";
-	symbolicNamesMap[2] = "UL_SETFSIZE";
-	paramSymbolsMap[1] = symbolicNamesMap;
-	funcParamsMap["ulimit"] = paramSymbolsMap;
-
-	//
-	// #include <unistd.h>
-	// int access(const char *path, int amode);
-	//
-	paramSymbolsMap.clear();
-	// amode
-	paramSymbolsMap[2] = getSymbolicNamesForAccessModes();
-	funcParamsMap["access"] = paramSymbolsMap;
-
-	//
-	// #include <unistd.h>
-	// size_t confstr(int name, char *buf, size_t len);
-	//
-	paramSymbolsMap.clear();
-	// name
-	symbolicNamesMap.clear();
-	// Info from: <bits/confname.h>
-	symbolicNamesMap[0] = "_CS_PATH";
-	symbolicNamesMap[2] = "_CS_GNU_LIBC_VERSION";
-	symbolicNamesMap[3] = "_CS_GNU_LIBPTHREAD_VERSION";
-	paramSymbolsMap[1] = symbolicNamesMap;
-	funcParamsMap["confstr"] = paramSymbolsMap;
-
+	{"ulimit", 1, ULIMIT_CMD}, // cmd
 	//
 	// #include <unistd.h>
-	// int faccessat(int fd, const char *path, int amode, int flag);
-	//
-	paramSymbolsMap.clear();
-	// amode
-	paramSymbolsMap[3] = getSymbolicNamesForAccessModes();
-	// flag
-	paramSymbolsMap[4] = getSymbolicNamesForAccessTypes();
-	funcParamsMap["faccessat"] = paramSymbolsMap;
-
-	//
-	// #include <unistd.h>
-	// int fchownat(int fd, const char *path, uid_t owner,
-	//              gid_t group, int flag);
-	//
-	paramSymbolsMap.clear();
-	// flag
-	paramSymbolsMap[5] = getSymbolicNamesForAccessTypes();
-	funcParamsMap["fchownat"] = paramSymbolsMap;
-
-	//
-	// #include <unistd.h>
-	// long fpathconf(int fd, int name);
-	//
-	paramSymbolsMap.clear();
-	// name
-	paramSymbolsMap[2] = getSymbolicNamesForPathConfs();
-	funcParamsMap["fpathconf"] = paramSymbolsMap;
-
-	//
-	// #include <unistd.h>
-	// long pathconf(const char *path, int name);
+	// int unlinkat(int fd, const char *path, int flag);
 	//
-	paramSymbolsMap.clear();
-	// name
-	paramSymbolsMap[2] = getSymbolicNamesForPathConfs();
-	funcParamsMap["pathconf"] = paramSymbolsMap;
-
+	{"unlinkat", 3, ACCESS_TYPES}, // flag
 	//
-	// #include <unistd.h>
-	// int linkat(int fd1, const char *path1, int fd2,
-	//            const char *path2, int flag);
+	// #include <sys/stat.h>
+	// int utimensat(int fd, const char *path,
+	//               const struct timespec times[2], int flag);
 	//
-	paramSymbolsMap.clear();
-	// flag
-	paramSymbolsMap[5] = getSymbolicNamesForAccessTypes();
-	funcParamsMap["linkat"] = paramSymbolsMap;
-
+	{"utimensat", 4, ACCESS_TYPES}, // flag
 	//
-	// #include <unistd.h>
-	// int lockf(int fd, int cmd, off_t len);
+	// #include <syslog.h>
+	// void vsyslog(int priority, const char *format, va_list ap);
 	//
-	paramSymbolsMap.clear();
-	// cmd
-	symbolicNamesMap.clear();
-	// Info from: <fcntl.h>
-	symbolicNamesMap[0] = "F_UNLOCK";
-	symbolicNamesMap[1] = "F_LOCK";
-	symbolicNamesMap[2] = "F_TLOCK";
-	symbolicNamesMap[3] = "F_TEST";
-	paramSymbolsMap[2] = symbolicNamesMap;
-	funcParamsMap["lockf"] = paramSymbolsMap;
-
+	{"vsyslog", 1, LOG_PRIORITIES}, // priority
 	//
-	// #include <unistd.h>
-	// off_t lseek(int fildes, off_t offset, int whence);
+	// #include <sys/wait.h>
+	// pid_t wait3(int *status, int options, struct rusage *rusage);
 	//
-	paramSymbolsMap.clear();
-	// whence
-	paramSymbolsMap[3] = getSymbolicNamesForSeekWhence();
-	funcParamsMap["lseek"] = paramSymbolsMap;
-
+	{"wait3", 2, WAIT_OPTIONS}, // options
 	//
-	// #include <unistd.h>
-	// long syscall(long number, ...);
+	// #include <sys/wait.h>
+	// pid_t wait4(pid_t pid, int *status, int options, struct rusage *rusage);
 	//
-	paramSymbolsMap.clear();
-	// number
-	paramSymbolsMap[1] = getSymbolicNamesForSystemCalls();
-	funcParamsMap["syscall"] = paramSymbolsMap;
-
+	{"wait4", 3, WAIT_OPTIONS}, // options
 	//
-	// #include <unistd.h>
-	// long sysconf(int name);
+	// #include <sys/wait.h>
+	// int waitid(idtype_t idtype, id_t id, siginfo_t *infop, int options);
 	//
-	paramSymbolsMap.clear();
-	// name
-	symbolicNamesMap.clear();
-	// Info from: <bits/confname.h>
-	symbolicNamesMap[0] = "_SC_ARG_MAX";
-	symbolicNamesMap[1] = "_SC_CHILD_MAX";
-	symbolicNamesMap[2] = "_SC_CLK_TCK";
-	symbolicNamesMap[3] = "_SC_NGROUPS_MAX";
-	symbolicNamesMap[4] = "_SC_OPEN_MAX";
-	symbolicNamesMap[5] = "_SC_STREAM_MAX";
-	symbolicNamesMap[6] = "_SC_TZNAME_MAX";
-	symbolicNamesMap[7] = "_SC_JOB_CONTROL";
-	symbolicNamesMap[8] = "_SC_SAVED_IDS";
-	symbolicNamesMap[9] = "_SC_REALTIME_SIGNALS";
-	symbolicNamesMap[10] = "_SC_PRIORITY_SCHEDULING";
-	symbolicNamesMap[11] = "_SC_TIMERS";
-	symbolicNamesMap[12] = "_SC_ASYNCHRONOUS_IO";
-	symbolicNamesMap[13] = "_SC_PRIORITIZED_IO";
-	symbolicNamesMap[14] = "_SC_SYNCHRONIZED_IO";
-	symbolicNamesMap[15] = "_SC_FSYNC";
-	symbolicNamesMap[16] = "_SC_MAPPED_FILES";
-	symbolicNamesMap[17] = "_SC_MEMLOCK";
-	symbolicNamesMap[18] = "_SC_MEMLOCK_RANGE";
-	symbolicNamesMap[19] = "_SC_MEMORY_PROTECTION";
-	symbolicNamesMap[20] = "_SC_MESSAGE_PASSING";
-	symbolicNamesMap[21] = "_SC_SEMAPHORES";
-	symbolicNamesMap[22] = "_SC_SHARED_MEMORY_OBJECTS";
-	symbolicNamesMap[23] = "_SC_AIO_LISTIO_MAX";
-	symbolicNamesMap[24] = "_SC_AIO_MAX";
-	symbolicNamesMap[25] = "_SC_AIO_PRIO_DELTA_MAX";
-	symbolicNamesMap[26] = "_SC_DELAYTIMER_MAX";
-	symbolicNamesMap[27] = "_SC_MQ_OPEN_MAX";
-	symbolicNamesMap[28] = "_SC_MQ_PRIO_MAX";
-	symbolicNamesMap[29] = "_SC_VERSION";
-	symbolicNamesMap[30] = "_SC_PAGESIZE";
-	symbolicNamesMap[31] = "_SC_RTSIG_MAX";
-	symbolicNamesMap[32] = "_SC_SEM_NSEMS_MAX";
-	symbolicNamesMap[33] = "_SC_SEM_VALUE_MAX";
-	symbolicNamesMap[34] = "_SC_SIGQUEUE_MAX";
-	symbolicNamesMap[35] = "_SC_TIMER_MAX";
-	symbolicNamesMap[36] = "_SC_BC_BASE_MAX";
-	symbolicNamesMap[37] = "_SC_BC_DIM_MAX";
-	symbolicNamesMap[38] = "_SC_BC_SCALE_MAX";
-	symbolicNamesMap[39] = "_SC_BC_STRING_MAX";
-	symbolicNamesMap[40] = "_SC_COLL_WEIGHTS_MAX";
-	symbolicNamesMap[41] = "_SC_EQUIV_CLASS_MAX";
-	symbolicNamesMap[42] = "_SC_EXPR_NEST_MAX";
-	symbolicNamesMap[43] = "_SC_LINE_MAX";
-	symbolicNamesMap[44] = "_SC_RE_DUP_MAX";
-	symbolicNamesMap[45] = "_SC_CHARCLASS_NAME_MAX";
-	symbolicNamesMap[46] = "_SC_2_VERSION";
-	symbolicNamesMap[47] = "_SC_2_C_BIND";
-	symbolicNamesMap[48] = "_SC_2_C_DEV";
-	symbolicNamesMap[49] = "_SC_2_FORT_DEV";
-	symbolicNamesMap[50] = "_SC_2_FORT_RUN";
-	symbolicNamesMap[51] = "_SC_2_SW_DEV";
-	symbolicNamesMap[52] = "_SC_2_LOCALEDEF";
-	symbolicNamesMap[53] = "_SC_PII";
-	symbolicNamesMap[54] = "_SC_PII_XTI";
-	symbolicNamesMap[55] = "_SC_PII_SOCKET";
-	symbolicNamesMap[56] = "_SC_PII_INTERNET";
-	symbolicNamesMap[57] = "_SC_PII_OSI";
-	symbolicNamesMap[58] = "_SC_POLL";
-	symbolicNamesMap[59] = "_SC_SELECT";
-	symbolicNamesMap[60] = "_SC_UIO_MAXIOV";
-	symbolicNamesMap[61] = "_SC_IOV_MAX = _SC_UIO_MAXIOV";
-	symbolicNamesMap[62] = "_SC_PII_INTERNET_STREAM";
-	symbolicNamesMap[63] = "_SC_PII_INTERNET_DGRAM";
-	symbolicNamesMap[64] = "_SC_PII_OSI_COTS";
-	symbolicNamesMap[65] = "_SC_PII_OSI_CLTS";
-	symbolicNamesMap[66] = "_SC_PII_OSI_M";
-	symbolicNamesMap[67] = "_SC_T_IOV_MAX";
-	symbolicNamesMap[68] = "_SC_THREADS";
-	symbolicNamesMap[69] = "_SC_THREAD_SAFE_FUNCTIONS";
-	symbolicNamesMap[70] = "_SC_GETGR_R_SIZE_MAX";
-	symbolicNamesMap[71] = "_SC_GETPW_R_SIZE_MAX";
-	symbolicNamesMap[72] = "_SC_LOGIN_NAME_MAX";
-	symbolicNamesMap[73] = "_SC_TTY_NAME_MAX";
-	symbolicNamesMap[74] = "_SC_THREAD_DESTRUCTOR_ITERATIONS";
-	symbolicNamesMap[75] = "_SC_THREAD_KEYS_MAX";
-	symbolicNamesMap[76] = "_SC_THREAD_STACK_MIN";
-	symbolicNamesMap[77] = "_SC_THREAD_THREADS_MAX";
-	symbolicNamesMap[78] = "_SC_THREAD_ATTR_STACKADDR";
-	symbolicNamesMap[79] = "_SC_THREAD_ATTR_STACKSIZE";
-	symbolicNamesMap[80] = "_SC_THREAD_PRIORITY_SCHEDULING";
-	symbolicNamesMap[81] = "_SC_THREAD_PRIO_INHERIT";
-	symbolicNamesMap[82] = "_SC_THREAD_PRIO_PROTECT";
-	symbolicNamesMap[83] = "_SC_THREAD_PROCESS_SHARED";
-	symbolicNamesMap[84] = "_SC_NPROCESSORS_CONF";
-	symbolicNamesMap[85] = "_SC_NPROCESSORS_ONLN";
-	symbolicNamesMap[86] = "_SC_PHYS_PAGES";
-	symbolicNamesMap[87] = "_SC_AVPHYS_PAGES";
-	symbolicNamesMap[88] = "_SC_ATEXIT_MAX";
-	symbolicNamesMap[89] = "_SC_PASS_MAX";
-	symbolicNamesMap[90] = "_SC_XOPEN_VERSION";
-	symbolicNamesMap[91] = "_SC_XOPEN_XCU_VERSION";
-	symbolicNamesMap[92] = "_SC_XOPEN_UNIX";
-	symbolicNamesMap[93] = "_SC_XOPEN_CRYPT";
-	symbolicNamesMap[94] = "_SC_XOPEN_ENH_I18N";
-	symbolicNamesMap[95] = "_SC_XOPEN_SHM";
-	symbolicNamesMap[96] = "_SC_2_CHAR_TERM";
-	symbolicNamesMap[97] = "_SC_2_C_VERSION";
-	symbolicNamesMap[98] = "_SC_2_UPE";
-	symbolicNamesMap[99] = "_SC_XOPEN_XPG2";
-	symbolicNamesMap[100] = "_SC_XOPEN_XPG3";
-	symbolicNamesMap[101] = "_SC_XOPEN_XPG4";
-	symbolicNamesMap[102] = "_SC_CHAR_BIT";
-	symbolicNamesMap[103] = "_SC_CHAR_MAX";
-	symbolicNamesMap[104] = "_SC_CHAR_MIN";
-	symbolicNamesMap[105] = "_SC_INT_MAX";
-	symbolicNamesMap[106] = "_SC_INT_MIN";
-	symbolicNamesMap[107] = "_SC_LONG_BIT";
-	symbolicNamesMap[108] = "_SC_WORD_BIT";
-	symbolicNamesMap[109] = "_SC_MB_LEN_MAX";
-	symbolicNamesMap[110] = "_SC_NZERO";
-	symbolicNamesMap[111] = "_SC_SSIZE_MAX";
-	symbolicNamesMap[112] = "_SC_SCHAR_MAX";
-	symbolicNamesMap[113] = "_SC_SCHAR_MIN";
-	symbolicNamesMap[114] = "_SC_SHRT_MAX";
-	symbolicNamesMap[115] = "_SC_SHRT_MIN";
-	symbolicNamesMap[116] = "_SC_UCHAR_MAX";
-	symbolicNamesMap[117] = "_SC_UINT_MAX";
-	symbolicNamesMap[118] = "_SC_ULONG_MAX";
-	symbolicNamesMap[119] = "_SC_USHRT_MAX";
-	symbolicNamesMap[120] = "_SC_NL_ARGMAX";
-	symbolicNamesMap[121] = "_SC_NL_LANGMAX";
-	symbolicNamesMap[122] = "_SC_NL_MSGMAX";
-	symbolicNamesMap[123] = "_SC_NL_NMAX";
-	symbolicNamesMap[124] = "_SC_NL_SETMAX";
-	symbolicNamesMap[125] = "_SC_NL_TEXTMAX";
-	symbolicNamesMap[126] = "_SC_XBS5_ILP32_OFF32";
-	symbolicNamesMap[127] = "_SC_XBS5_ILP32_OFFBIG";
-	symbolicNamesMap[128] = "_SC_XBS5_LP64_OFF64";
-	symbolicNamesMap[129] = "_SC_XBS5_LPBIG_OFFBIG";
-	symbolicNamesMap[130] = "_SC_XOPEN_LEGACY";
-	symbolicNamesMap[131] = "_SC_XOPEN_REALTIME";
-	symbolicNamesMap[132] = "_SC_XOPEN_REALTIME_THREADS";
-	symbolicNamesMap[133] = "_SC_ADVISORY_INFO";
-	symbolicNamesMap[134] = "_SC_BARRIERS";
-	symbolicNamesMap[135] = "_SC_BASE";
-	symbolicNamesMap[136] = "_SC_C_LANG_SUPPORT";
-	symbolicNamesMap[137] = "_SC_C_LANG_SUPPORT_R";
-	symbolicNamesMap[138] = "_SC_CLOCK_SELECTION";
-	symbolicNamesMap[139] = "_SC_CPUTIME";
-	symbolicNamesMap[140] = "_SC_THREAD_CPUTIME";
-	symbolicNamesMap[141] = "_SC_DEVICE_IO";
-	symbolicNamesMap[142] = "_SC_DEVICE_SPECIFIC";
-	symbolicNamesMap[143] = "_SC_DEVICE_SPECIFIC_R";
-	symbolicNamesMap[144] = "_SC_FD_MGMT";
-	symbolicNamesMap[145] = "_SC_FIFO";
-	symbolicNamesMap[146] = "_SC_PIPE";
-	symbolicNamesMap[147] = "_SC_FILE_ATTRIBUTES";
-	symbolicNamesMap[148] = "_SC_FILE_LOCKING";
-	symbolicNamesMap[149] = "_SC_FILE_SYSTEM";
-	symbolicNamesMap[150] = "_SC_MONOTONIC_CLOCK";
-	symbolicNamesMap[151] = "_SC_MULTI_PROCESS";
-	symbolicNamesMap[152] = "_SC_SINGLE_PROCESS";
-	symbolicNamesMap[153] = "_SC_NETWORKING";
-	symbolicNamesMap[154] = "_SC_READER_WRITER_LOCKS";
-	symbolicNamesMap[155] = "_SC_SPIN_LOCKS";
-	symbolicNamesMap[156] = "_SC_REGEXP";
-	symbolicNamesMap[157] = "_SC_REGEX_VERSION";
-	symbolicNamesMap[158] = "_SC_SHELL";
-	symbolicNamesMap[159] = "_SC_SIGNALS";
-	symbolicNamesMap[160] = "_SC_SPAWN";
-	symbolicNamesMap[161] = "_SC_SPORADIC_SERVER";
-	symbolicNamesMap[162] = "_SC_THREAD_SPORADIC_SERVER";
-	symbolicNamesMap[163] = "_SC_SYSTEM_DATABASE";
-	symbolicNamesMap[164] = "_SC_SYSTEM_DATABASE_R";
-	symbolicNamesMap[165] = "_SC_TIMEOUTS";
-	symbolicNamesMap[166] = "_SC_TYPED_MEMORY_OBJECTS";
-	symbolicNamesMap[167] = "_SC_USER_GROUPS";
-	symbolicNamesMap[168] = "_SC_USER_GROUPS_R";
-	symbolicNamesMap[169] = "_SC_2_PBS";
-	symbolicNamesMap[170] = "_SC_2_PBS_ACCOUNTING";
-	symbolicNamesMap[171] = "_SC_2_PBS_LOCATE";
-	symbolicNamesMap[172] = "_SC_2_PBS_MESSAGE";
-	symbolicNamesMap[173] = "_SC_2_PBS_TRACK";
-	symbolicNamesMap[174] = "_SC_SYMLOOP_MAX";
-	symbolicNamesMap[175] = "_SC_STREAMS";
-	symbolicNamesMap[176] = "_SC_2_PBS_CHECKPOINT";
-	symbolicNamesMap[177] = "_SC_V6_ILP32_OFF32";
-	symbolicNamesMap[178] = "_SC_V6_ILP32_OFFBIG";
-	symbolicNamesMap[179] = "_SC_V6_LP64_OFF64";
-	symbolicNamesMap[180] = "_SC_V6_LPBIG_OFFBIG";
-	symbolicNamesMap[181] = "_SC_HOST_NAME_MAX";
-	symbolicNamesMap[182] = "_SC_TRACE";
-	symbolicNamesMap[183] = "_SC_TRACE_EVENT_FILTER";
-	symbolicNamesMap[184] = "_SC_TRACE_INHERIT";
-	symbolicNamesMap[185] = "_SC_TRACE_LOG";
-	symbolicNamesMap[186] = "_SC_LEVEL1_ICACHE_SIZE";
-	symbolicNamesMap[187] = "_SC_LEVEL1_ICACHE_ASSOC";
-	symbolicNamesMap[188] = "_SC_LEVEL1_ICACHE_LINESIZE";
-	symbolicNamesMap[189] = "_SC_LEVEL1_DCACHE_SIZE";
-	symbolicNamesMap[190] = "_SC_LEVEL1_DCACHE_ASSOC";
-	symbolicNamesMap[191] = "_SC_LEVEL1_DCACHE_LINESIZE";
-	symbolicNamesMap[192] = "_SC_LEVEL2_CACHE_SIZE";
-	symbolicNamesMap[193] = "_SC_LEVEL2_CACHE_ASSOC";
-	symbolicNamesMap[194] = "_SC_LEVEL2_CACHE_LINESIZE";
-	symbolicNamesMap[195] = "_SC_LEVEL3_CACHE_SIZE";
-	symbolicNamesMap[196] = "_SC_LEVEL3_CACHE_ASSOC";
-	symbolicNamesMap[197] = "_SC_LEVEL3_CACHE_LINESIZE";
-	symbolicNamesMap[198] = "_SC_LEVEL4_CACHE_SIZE";
-	symbolicNamesMap[199] = "_SC_LEVEL4_CACHE_ASSOC";
-	symbolicNamesMap[200] = "_SC_LEVEL4_CACHE_LINESIZE";
-	// Here is a deliberate room for more cache levels.
-	symbolicNamesMap[236] = "_SC_IPV6";
-	symbolicNamesMap[237] = "_SC_RAW_SOCKETS";
-	symbolicNamesMap[238] = "_SC_V7_ILP32_OFF32";
-	symbolicNamesMap[239] = "_SC_V7_ILP32_OFFBIG";
-	symbolicNamesMap[240] = "_SC_V7_LP64_OFF64";
-	symbolicNamesMap[241] = "_SC_V7_LPBIG_OFFBIG";
-	symbolicNamesMap[242] = "_SC_SS_REPL_MAX";
-	symbolicNamesMap[243] = "_SC_TRACE_EVENT_NAME_MAX";
-	symbolicNamesMap[244] = "_SC_TRACE_NAME_MAX";
-	symbolicNamesMap[245] = "_SC_TRACE_SYS_MAX";
-	symbolicNamesMap[246] = "_SC_TRACE_USER_EVENT_MAX";
-	symbolicNamesMap[247] = "_SC_XOPEN_STREAMS";
-	symbolicNamesMap[248] = "_SC_THREAD_ROBUST_PRIO_INHERIT";
-	symbolicNamesMap[249] = "_SC_THREAD_ROBUST_PRIO_PROTECT";
-	paramSymbolsMap[1] = symbolicNamesMap;
-	funcParamsMap["sysconf"] = paramSymbolsMap;
-
+	{"waitid", 4, WAIT_OPTIONS}, // options
 	//
-	// #include <unistd.h>
-	// int unlinkat(int fd, const char *path, int flag);
+	// #include <sys/wait.h>
+	// pid_t waitpid(pid_t pid, int *status, int options);
 	//
-	paramSymbolsMap.clear();
-	// flag
-	paramSymbolsMap[3] = getSymbolicNamesForAccessTypes();
-	funcParamsMap["unlinkat"] = paramSymbolsMap;
-
+	{"waitpid", 3, WAIT_OPTIONS}, // options
 	//
 	// #include <wordexp.h>
 	// int wordexp(const char *s, wordexp_t *p, int flags);
 	//
-	paramSymbolsMap.clear();
-	// flags
-	symbolicNamesMap.clear();
-	// Info from: <wordexp.h>
-	symbolicNamesMap[1 << 0] = "WRDE_DOOFFS";
-	symbolicNamesMap[1 << 1] = "WRDE_APPEND";
-	symbolicNamesMap[1 << 2] = "WRDE_NOCMD";
-	symbolicNamesMap[1 << 3] = "WRDE_REUSE";
-	symbolicNamesMap[1 << 4] = "WRDE_SHOWERR";
-	symbolicNamesMap[1 << 5] = "WRDE_UNDEF";
-	paramSymbolsMap[3] = symbolicNamesMap;
-	funcParamsMap["wordexp"] = paramSymbolsMap;
-
-	return funcParamsMap;
-}
-
-/// Mapping of function names into symbolic names of their parameters.
-const FuncParamsMap &FUNC_PARAMS_MAP(initFuncParamsMap());
+	{"wordexp", 3, WORDEXP_FLAGS}, // flags
+};
+static_assert(FuncParamSymbolicNamesTable(FUNC_PARAMS_SYMBOLIC_NAMES).isSorted(),
+	"FUNC_PARAMS_SYMBOLIC_NAMES has to be sorted by scripts/llvmir2hll/sort_semantics_tables.py");
 
 } // anonymous namespace
 
@@ -2627,9 +2222,10 @@ const FuncParamsMap &FUNC_PARAMS_MAP(initFuncParamsMap());
 *
 * See its description for more details.
 */
-std::optional<IntStringMap> getSymbolicNamesForParam(const std::string &funcName,
+const IntStringMap *getSymbolicNamesForParam(const std::string &funcName,
 		unsigned paramPos) {
-	return getSymbolicNamesForParamFromMap(funcName, paramPos, FUNC_PARAMS_MAP);
+	return getSymbolicNamesForParamFromTable(funcName, paramPos,
+		FUNC_PARAMS_SYMBOLIC_NAMES);
 }
 
 } // namespace gcc_general
@@ -11,13 +11,13 @@ namespace llvmir2hll {
 namespace semantics {
 
 /**
-* @brief Returns the header name for the given function from the given map.
+* @brief Returns the header name for the given function from the given table.
 */
-std::optional<std::string> getCHeaderFileForFuncFromMap(
+std::optional<std::string_view> getCHeaderFileForFuncFromTable(
 		const std::string &funcName,
-		const StringStringUMap &map) {
-	auto i = map.find(funcName);
-	return i != map.end() ? std::optional<std::string>(i->second) : std::nullopt;
+		const FuncCHeaderTable &table) {
+	auto entry = table.find(std::string_view(funcName));
+	return entry ? std::optional<std::string_view>(entry->header) : std::nullopt;
 }
 
 } // namespace semantics
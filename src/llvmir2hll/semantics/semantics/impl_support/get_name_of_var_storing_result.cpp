@@ -12,12 +12,12 @@ namespace semantics {
 
 /**
 * @brief Returns the name of a variable storing the result from the given
-*        function from the given map.
+*        function from the given table.
 */
-std::optional<std::string> getNameOfVarStoringResultFromMap(const std::string &funcName,
-		const StringStringUMap &map) {
-	auto i = map.find(funcName);
-	return i != map.end() ? std::optional<std::string>(i->second) : std::nullopt;
+std::optional<std::string_view> getNameOfVarStoringResultFromTable(
+		const std::string &funcName, const FuncVarNameTable &table) {
+	auto entry = table.find(std::string_view(funcName));
+	return entry ? std::optional<std::string_view>(entry->varName) : std::nullopt;
 }
 
 } // namespace semantics
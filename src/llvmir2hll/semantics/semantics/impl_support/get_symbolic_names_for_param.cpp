@@ -4,6 +4,9 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <mutex>
+#include <unordered_map>
+
 #include "retdec/llvmir2hll/semantics/semantics/impl_support/get_symbolic_names_for_param.h"
 
 namespace retdec {
@@ -11,20 +14,35 @@ namespace llvmir2hll {
 namespace semantics {
 
 /**
-* @brief Returns symbolic names for the given parameter from the given map.
+* @brief Returns symbolic names for the given parameter from the given table.
+*
+* The map for a table entry is created when it is asked for the first time and
+* it is kept until the end of the program. Later lookups return the same map.
+* Entries can be shared by all the tables, so the maps are kept in a single
+* cache. It is safe to call this function from several threads.
 */
-std::optional<IntStringMap> getSymbolicNamesForParamFromMap(const std::string &funcName,
-		unsigned paramPos, const FuncParamsMap &map) {
-	// Try to find the function.
-	auto funcIter = map.find(funcName);
-	if (funcIter == map.end()) {
-		return std::nullopt;
+const IntStringMap *getSymbolicNamesForParamFromTable(
+		const std::string &funcName, unsigned paramPos,
+		const FuncParamSymbolicNamesTable &table) {
+	auto entry = table.find(
+		std::pair<std::string_view, unsigned>(funcName, paramPos));
+	if (!entry) {
+		return nullptr;
 	}
 
-	// Try to find the parameter by its position.
-	auto paramIter = funcIter->second.find(paramPos);
-	return paramIter != funcIter->second.end() ?
-		std::optional<IntStringMap>(paramIter->second) : std::nullopt;
+	// Elements of std::unordered_map are not moved by insertions, so the
+	// returned maps stay valid.
+	static std::mutex cacheMutex;
+	static std::unordered_map<const FuncParamSymbolicNames *, IntStringMap> cache;
+	std::lock_guard<std::mutex> lock(cacheMutex);
+	auto [it, inserted] = cache.try_emplace(entry);
+	if (inserted) {
+		// When a value has more names, the last one is used.
+		for (const auto &name : entry->names) {
+			it->second[name.value] = std::string(name.name);
+		}
+	}
+	return &it->second;
 }
 
 } // namespace semantics
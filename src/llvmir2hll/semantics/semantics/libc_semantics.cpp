@@ -40,7 +40,7 @@ std::optional<std::string> LibcSemantics::getMainFuncName() const {
 	return "main";
 }
 
-std::optional<std::string> LibcSemantics::getCHeaderFileForFunc(
+std::optional<std::string_view> LibcSemantics::getCHeaderFileForFunc(
 		const std::string &funcName) const {
 	return semantics::libc::getCHeaderFileForFunc(funcName);
 }
@@ -50,17 +50,17 @@ std::optional<bool> LibcSemantics::funcNeverReturns(
 	return semantics::libc::funcNeverReturns(funcName);
 }
 
-std::optional<std::string> LibcSemantics::getNameOfVarStoringResult(
+std::optional<std::string_view> LibcSemantics::getNameOfVarStoringResult(
 		const std::string &funcName) const {
 	return semantics::libc::getNameOfVarStoringResult(funcName);
 }
 
-std::optional<std::string> LibcSemantics::getNameOfParam(
+std::optional<std::string_view> LibcSemantics::getNameOfParam(
 		const std::string &funcName, unsigned paramPos) const {
 	return semantics::libc::getNameOfParam(funcName, paramPos);
 }
 
-std::optional<IntStringMap> LibcSemantics::getSymbolicNamesForParam(
+const IntStringMap *LibcSemantics::getSymbolicNamesForParam(
 		const std::string &funcName, unsigned paramPos) const {
 	return semantics::libc::getSymbolicNamesForParam(funcName, paramPos);
 }
@@ -18,35 +18,24 @@ namespace libc {
 
 namespace {
 
-/**
-* @brief This function is used to initialize FUNC_NEVER_RETURNS later in
-*        the file.
-*/
-const StringSet &initFuncNeverReturns() {
-	static StringSet fnr;
-
-	// Currently, we only list the functions about which we actually know that
-	// they never return. The reason is that when using funcNeverReturns(), we
-	// actually only care whether it returns true. If it returns false or no
-	// answer at all is irrelevant.
-
+/// Functions that do not return.
+// Currently, we only list the functions about which we actually know that they
+// never return. The reason is that when using funcNeverReturns(), we actually
+// only care whether it returns true. If it returns false or no answer at all
+// is irrelevant.
+const StringSet FUNC_NEVER_RETURNS = {
 	// C89
-	fnr.insert("exit");
-	fnr.insert("abort");
-	fnr.insert("longjmp");
+	"exit",
+	"abort",
+	"longjmp",
 
 	// C99
-	fnr.insert("_Exit");
+	"_Exit",
 
 	// C11
-	fnr.insert("quick_exit");
-	fnr.insert("thrd_exit");
-
-	return fnr;
-}
-
-/// Functions that do not return.
-const StringSet &FUNC_NEVER_RETURNS(initFuncNeverReturns());
+	"quick_exit",
+	"thrd_exit",
+};
 
 } // anonymous namespace
 
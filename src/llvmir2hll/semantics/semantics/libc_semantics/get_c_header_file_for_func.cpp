@@ -15,614 +15,489 @@ namespace libc {
 
 namespace {
 
-/**
-* @brief This function is used to initialize FUNC_C_HEADER_MAP later in the
-*        file.
-*/
-const StringStringUMap &initFuncCHeaderMap() {
-	static StringStringUMap m;
-
-	// The following list is based on
-	//
-	//     - http://en.wikipedia.org/wiki/C_standard_library
-	//     - http://www.cplusplus.com/reference/clibrary/
-	//
-	// and contains header files from C89, C99, and C11. It is by all means not
-	// complete, but most of the functions should be there. If you find a
-	// function which is missing, please, add it.
-
-	// assert.h
-	static const char *ASSERT_H_FUNCS[] = {
-		"assert",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(ASSERT_H_FUNCS, "assert.h", m);
-
-	// complex.h
-	static const char *COMPLEX_H_FUNCS[] = {
-		"cabs",
-		"cabsf",
-		"cabsl",
-		"cacos",
-		"cacosf",
-		"cacosh",
-		"cacoshf",
-		"cacoshl",
-		"cacosl",
-		"carg",
-		"cargf",
-		"cargl",
-		"casin",
-		"casinf",
-		"casinh",
-		"casinhf",
-		"casinhl",
-		"casinl",
-		"catan",
-		"catanf",
-		"catanh",
-		"catanhf",
-		"catanhl",
-		"catanl",
-		"ccos",
-		"ccosf",
-		"ccosh",
-		"ccoshf",
-		"ccoshl",
-		"ccosl",
-		"cexp",
-		"cexpf",
-		"cexpl",
-		"cimag",
-		"cimagf",
-		"cimagl",
-		"clog",
-		"clogf",
-		"clogl",
-		"conj",
-		"conjf",
-		"conjl",
-		"cpow",
-		"cpowf",
-		"cpowl",
-		"cproj",
-		"cprojf",
-		"cprojl",
-		"creal",
-		"crealf",
-		"creall",
-		"csin",
-		"csinf",
-		"csinh",
-		"csinhf",
-		"csinhl",
-		"csinl",
-		"csqrt",
-		"csqrtf",
-		"csqrtl",
-		"ctan",
-		"ctanf",
-		"ctanh",
-		"ctanhf",
-		"ctanhl",
-		"ctanl",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(COMPLEX_H_FUNCS, "complex.h", m);
-
-	// ctype.h
-	static const char *CTYPE_H_FUNCS[] = {
-		"isalnum",
-		"isalpha",
-		"isblank",
-		"iscntrl",
-		"isdigit",
-		"isgraph",
-		"islower",
-		"isprint",
-		"ispunct",
-		"isspace",
-		"isupper",
-		"isxdigit",
-		"tolower",
-		"toupper",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(CTYPE_H_FUNCS, "ctype.h", m);
-
-	// errno.h
-	// -
-
-	// fenv.h
-	static const char *FENV_H_FUNCS[] = {
-		"feclearexcept",
-		"fegetenv",
-		"fegetexceptflag",
-		"fegetround",
-		"feholdexcept",
-		"feraiseexcept",
-		"fesetenv",
-		"fesetexceptflag",
-		"fesetround",
-		"fetestexcept",
-		"feupdateenv",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(FENV_H_FUNCS, "fenv.h", m);
-
-	// float.h
-	// -
-
-	// inttypes.h
-	static const char *INTTYPES_H_FUNCS[] = {
-		"imaxabs",
-		"imaxdiv",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(INTTYPES_H_FUNCS, "inttypes.h", m);
-
-	// iso646.h
-	// -
-
-	// limits.h
-	// -
-
-	// locale.h
-	static const char *LOCALE_H_FUNCS[] = {
-		"localeconv",
-		"setlocale",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(LOCALE_H_FUNCS, "locale.h", m);
-
-	// math.h
-	static const char *MATH_H_FUNCS[] = {
-		"acos",
-		"acosf",
-		"acosh",
-		"acoshf",
-		"acoshl",
-		"acosl",
-		"asin",
-		"asinf",
-		"asinh",
-		"asinhf",
-		"asinhl",
-		"asinl",
-		"atan",
-		"atan2",
-		"atan2f",
-		"atan2l",
-		"atanf",
-		"atanh",
-		"atanhf",
-		"atanhl",
-		"atanl",
-		"cbrt",
-		"cbrtf",
-		"cbrtl",
-		"ceil",
-		"ceilf",
-		"ceill",
-		"copysign",
-		"copysignf",
-		"copysignl",
-		"cos",
-		"cosf",
-		"cosh",
-		"coshf",
-		"coshl",
-		"cosl",
-		"erf",
-		"erfc",
-		"erfcf",
-		"erfcl",
-		"erff",
-		"erfl",
-		"exp",
-		"exp2",
-		"exp2f",
-		"exp2l",
-		"expf",
-		"expl",
-		"expm1",
-		"expm1f",
-		"expm1l",
-		"fabs",
-		"fabsf",
-		"fabsl",
-		"fdim",
-		"fdimf",
-		"fdiml",
-		"floor",
-		"floorf",
-		"floorl",
-		"fma",
-		"fmaf",
-		"fmal",
-		"fmax",
-		"fmaxf",
-		"fmaxl",
-		"fmin",
-		"fminf",
-		"fminl",
-		"fmod",
-		"fmodf",
-		"fmodl",
-		"fpclassify",
-		"frexp",
-		"frexpf",
-		"frexpl",
-		"hypot",
-		"hypotf",
-		"hypotl",
-		"ilogb",
-		"ilogbf",
-		"ilogbl",
-		"isfinite",
-		"isgreater",
-		"isgreaterequal",
-		"isinf",
-		"isless",
-		"islessequal",
-		"islessgreater",
-		"isnan",
-		"isnormal",
-		"isunordered",
-		"ldexp",
-		"ldexpf",
-		"ldexpl",
-		"lgamma",
-		"lgammaf",
-		"lgammal",
-		"llrint",
-		"llrintf",
-		"llrintl",
-		"llround",
-		"log",
-		"log10",
-		"log10f",
-		"log10l",
-		"log1p",
-		"log1pf",
-		"log1pl",
-		"log2",
-		"log2f",
-		"log2l",
-		"logb",
-		"logbf",
-		"logbl",
-		"logf",
-		"logl",
-		"lrint",
-		"lrintf",
-		"lrintl",
-		"lround",
-		"modf",
-		"modff",
-		"modfl",
-		"nan",
-		"nanf",
-		"nanl",
-		"nearbyint",
-		"nearbyintf",
-		"nearbyintl",
-		"nextafter",
-		"nextafterf",
-		"nextafterl",
-		"nexttoward",
-		"nexttowardf",
-		"nexttowardl",
-		"pow",
-		"powf",
-		"powl",
-		"remainder",
-		"remainderf",
-		"remainderl",
-		"remquo",
-		"remquof",
-		"remquol",
-		"rint",
-		"rintf",
-		"rintl",
-		"round",
-		"scalbln",
-		"scalblnf",
-		"scalblnl",
-		"scalbn",
-		"scalbnf",
-		"scalbnl",
-		"signbit",
-		"sin",
-		"sinf",
-		"sinh",
-		"sinhf",
-		"sinhl",
-		"sinl",
-		"sqrt",
-		"sqrtf",
-		"sqrtl",
-		"tan",
-		"tanf",
-		"tanh",
-		"tanhf",
-		"tanhl",
-		"tanl",
-		"tgamma",
-		"tgammaf",
-		"tgammal",
-		"trunc",
-		"truncf",
-		"truncl",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(MATH_H_FUNCS, "math.h", m);
-
-	// setjmp.h
-	static const char *SETJMP_H_FUNCS[] = {
-		"setjmp",
-		"longjmp",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(SETJMP_H_FUNCS, "setjmp.h", m);
-
-	// signal.h
-	static const char *SIGNAL_H_FUNCS[] = {
-		"signal",
-		"raise",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(SIGNAL_H_FUNCS, "signal.h", m);
-
-	// stdalign.h
-	// -
-
-	// stdarg.h
-	static const char *STDARG_H_FUNCS[] = {
-		"va_start",
-		"va_arg",
-		"va_end",
-		"va_copy",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(STDARG_H_FUNCS, "stdarg.h", m);
-
-	// stdatomic.h
-	// -
-
-	// stdbool.h
-	// -
-
-	// stddef.h
-	static const char *STDDEF_H_FUNCS[] = {
-		"offsetof",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(STDDEF_H_FUNCS, "stddef.h", m);
-
-	// stdint.h
-	// -
-
-	// stdio.h
-	static const char *STDIO_H_FUNCS[] = {
-		"clearerr",
-		"fclose",
-		"feof",
-		"ferror",
-		"fflush",
-		"fgetc",
-		"fgetpos",
-		"fgets",
-		"fopen",
-		"fprintf",
-		"fputc",
-		"fputs",
-		"fread",
-		"freopen",
-		"fscanf",
-		"fseek",
-		"fsetpos",
-		"ftell",
-		"fwrite",
-		"getc",
-		"getchar",
-		"gets",
-		"perror",
-		"printf",
-		"putc",
-		"putchar",
-		"puts",
-		"remove",
-		"rename",
-		"rewind",
-		"scanf",
-		"setbuf",
-		"setvbuf",
-		"snprintf",
-		"sprintf",
-		"sscanf",
-		"tmpfile",
-		"tmpnam",
-		"ungetc",
-		"vfprintf",
-		"vfscanf",
-		"vprintf",
-		"vscanf",
-		"vsnprintf",
-		"vsprintf",
-		"vsscanf",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(STDIO_H_FUNCS, "stdio.h", m);
-
-	// stdlib.h
-	static const char *STDLIB_H_FUNCS[] = {
-		"_Exit",
-		"abort",
-		"abs",
-		"at_quick_exit",
-		"atexit",
-		"atof",
-		"atoi",
-		"atol",
-		"atoll",
-		"bsearch",
-		"calloc",
-		"div",
-		"exit",
-		"free",
-		"getenv",
-		"labs",
-		"ldiv",
-		"llabs",
-		"lldiv",
-		"malloc",
-		"qsort",
-		"quick_exit",
-		"rand",
-		"realloc",
-		"srand",
-		"strtod",
-		"strtof",
-		"strtol",
-		"strtold",
-		"strtoll",
-		"strtoul",
-		"strtoull",
-		"system",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(STDLIB_H_FUNCS, "stdlib.h", m);
-
-	// stdnoreturn.h
-	// -
-
-	// string.h
-	static const char *STRING_H_FUNCS[] = {
-		"memchr",
-		"memcmp",
-		"memcpy",
-		"memmove",
-		"memset",
-		"strcat",
-		"strchr",
-		"strcmp",
-		"strcoll",
-		"strcpy",
-		"strcspn",
-		"strerror",
-		"strlen",
-		"strncat",
-		"strncmp",
-		"strncpy",
-		"strpbrk",
-		"strrchr",
-		"strspn",
-		"strstr",
-		"strtok",
-		"strxfrm",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(STRING_H_FUNCS, "string.h", m);
-
-	// tgmath.h
-	// -
-
-	// threads.h
-	// -
-
-	// time.h
-	static const char *TIME_H_FUNCS[] = {
-		"difftime",
-		"time",
-		"clock",
-		"asctime",
-		"ctime",
-		"strftime",
-		"gmtime",
-		"localtime",
-		"mktime",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(TIME_H_FUNCS, "time.h", m);
-
-	// wchar.h
-	static const char *WCHAR_H_FUNCS[] = {
-		"btowc",
-		"fgetwc",
-		"fgetws",
-		"fputwc",
-		"fputws",
-		"fwide",
-		"fwprintf",
-		"fwscanf",
-		"getwc",
-		"getwchar",
-		"mbrlen",
-		"mbrtowc",
-		"mbsinit",
-		"mbsrtowcs",
-		"putwc",
-		"putwchar",
-		"swprintf",
-		"swscanf",
-		"ungetwc",
-		"vfwprintf",
-		"vfwscanf",
-		"vswprintf",
-		"vswscanf",
-		"vwprintf",
-		"vwscanf",
-		"wcrtomb",
-		"wcscat",
-		"wcschr",
-		"wcscmp",
-		"wcscoll",
-		"wcscpy",
-		"wcscspn",
-		"wcsftime",
-		"wcslen",
-		"wcsncat",
-		"wcsncmp",
-		"wcsncpy",
-		"wcspbrk",
-		"wcsrchr",
-		"wcsrtombs",
-		"wcsspn",
-		"wcsstr",
-		"wcstod",
-		"wcstof",
-		"wcstok",
-		"wcstol",
-		"wcstold",
-		"wcstoll",
-		"wcstoul",
-		"wcstoull",
-		"wcsxfrm",
-		"wctob",
-		"wmemchr",
-		"wmemcmp",
-		"wmemcpy",
-		"wmemmove",
-		"wmemset",
-		"wprintf",
-		"wscanf",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(WCHAR_H_FUNCS, "wchar.h", m);
-
-	// wctype.h
-	static const char *WCTYPE_H_FUNCS[] = {
-		"iswalnum",
-		"iswalpha",
-		"iswblank",
-		"iswcntrl",
-		"iswctype",
-		"iswdigit",
-		"iswgraph",
-		"iswlower",
-		"iswprint",
-		"iswpunct",
-		"iswspace",
-		"iswupper",
-		"iswxdigit",
-		"towctrans",
-		"towlower",
-		"towupper",
-		"wctrans",
-		"wctype",
-	};
-	ADD_FUNCS_TO_C_HEADER_MAP(WCTYPE_H_FUNCS, "wctype.h", m);
-
-	return m;
-}
+// The following list is based on
+//
+//     - http://en.wikipedia.org/wiki/C_standard_library
+//     - http://www.cplusplus.com/reference/clibrary/
+//
+// and contains header files from C89, C99, and C11. It is by all means not
+// complete, but most of the functions should be there. If you find a
+// function which is missing, please, add it.
 
 /// Mapping of function names to their corresponding header files.
-const StringStringUMap &FUNC_C_HEADER_MAP(initFuncCHeaderMap());
+constexpr FuncCHeader FUNC_C_HEADERS[] = {
+	{"_Exit", "stdlib.h"},
+	{"abort", "stdlib.h"},
+	{"abs", "stdlib.h"},
+	{"acos", "math.h"},
+	{"acosf", "math.h"},
+	{"acosh", "math.h"},
+	{"acoshf", "math.h"},
+	{"acoshl", "math.h"},
+	{"acosl", "math.h"},
+	{"asctime", "time.h"},
+	{"asin", "math.h"},
+	{"asinf", "math.h"},
+	{"asinh", "math.h"},
+	{"asinhf", "math.h"},
+	{"asinhl", "math.h"},
+	{"asinl", "math.h"},
+	{"assert", "assert.h"},
+	{"at_quick_exit", "stdlib.h"},
+	{"atan", "math.h"},
+	{"atan2", "math.h"},
+	{"atan2f", "math.h"},
+	{"atan2l", "math.h"},
+	{"atanf", "math.h"},
+	{"atanh", "math.h"},
+	{"atanhf", "math.h"},
+	{"atanhl", "math.h"},
+	{"atanl", "math.h"},
+	{"atexit", "stdlib.h"},
+	{"atof", "stdlib.h"},
+	{"atoi", "stdlib.h"},
+	{"atol", "stdlib.h"},
+	{"atoll", "stdlib.h"},
+	{"bsearch", "stdlib.h"},
+	{"btowc", "wchar.h"},
+	{"cabs", "complex.h"},
+	{"cabsf", "complex.h"},
+	{"cabsl", "complex.h"},
+	{"cacos", "complex.h"},
+	{"cacosf", "complex.h"},
+	{"cacosh", "complex.h"},
+	{"cacoshf", "complex.h"},
+	{"cacoshl", "complex.h"},
+	{"cacosl", "complex.h"},
+	{"calloc", "stdlib.h"},
+	{"carg", "complex.h"},
+	{"cargf", "complex.h"},
+	{"cargl", "complex.h"},
+	{"casin", "complex.h"},
+	{"casinf", "complex.h"},
+	{"casinh", "complex.h"},
+	{"casinhf", "complex.h"},
+	{"casinhl", "complex.h"},
+	{"casinl", "complex.h"},
+	{"catan", "complex.h"},
+	{"catanf", "complex.h"},
+	{"catanh", "complex.h"},
+	{"catanhf", "complex.h"},
+	{"catanhl", "complex.h"},
+	{"catanl", "complex.h"},
+	{"cbrt", "math.h"},
+	{"cbrtf", "math.h"},
+	{"cbrtl", "math.h"},
+	{"ccos", "complex.h"},
+	{"ccosf", "complex.h"},
+	{"ccosh", "complex.h"},
+	{"ccoshf", "complex.h"},
+	{"ccoshl", "complex.h"},
+	{"ccosl", "complex.h"},
+	{"ceil", "math.h"},
+	{"ceilf", "math.h"},
+	{"ceill", "math.h"},
+	{"cexp", "complex.h"},
+	{"cexpf", "complex.h"},
+	{"cexpl", "complex.h"},
+	{"cimag", "complex.h"},
+	{"cimagf", "complex.h"},
+	{"cimagl", "complex.h"},
+	{"clearerr", "stdio.h"},
+	{"clock", "time.h"},
+	{"clog", "complex.h"},
+	{"clogf", "complex.h"},
+	{"clogl", "complex.h"},
+	{"conj", "complex.h"},
+	{"conjf", "complex.h"},
+	{"conjl", "complex.h"},
+	{"copysign", "math.h"},
+	{"copysignf", "math.h"},
+	{"copysignl", "math.h"},
+	{"cos", "math.h"},
+	{"cosf", "math.h"},
+	{"cosh", "math.h"},
+	{"coshf", "math.h"},
+	{"coshl", "math.h"},
+	{"cosl", "math.h"},
+	{"cpow", "complex.h"},
+	{"cpowf", "complex.h"},
+	{"cpowl", "complex.h"},
+	{"cproj", "complex.h"},
+	{"cprojf", "complex.h"},
+	{"cprojl", "complex.h"},
+	{"creal", "complex.h"},
+	{"crealf", "complex.h"},
+	{"creall", "complex.h"},
+	{"csin", "complex.h"},
+	{"csinf", "complex.h"},
+	{"csinh", "complex.h"},
+	{"csinhf", "complex.h"},
+	{"csinhl", "complex.h"},
+	{"csinl", "complex.h"},
+	{"csqrt", "complex.h"},
+	{"csqrtf", "complex.h"},
+	{"csqrtl", "complex.h"},
+	{"ctan", "complex.h"},
+	{"ctanf", "complex.h"},
+	{"ctanh", "complex.h"},
+	{"ctanhf", "complex.h"},
+	{"ctanhl", "complex.h"},
+	{"ctanl", "complex.h"},
+	{"ctime", "time.h"},
+	{"difftime", "time.h"},
+	{"div", "stdlib.h"},
+	{"erf", "math.h"},
+	{"erfc", "math.h"},
+	{"erfcf", "math.h"},
+	{"erfcl", "math.h"},
+	{"erff", "math.h"},
+	{"erfl", "math.h"},
+	{"exit", "stdlib.h"},
+	{"exp", "math.h"},
+	{"exp2", "math.h"},
+	{"exp2f", "math.h"},
+	{"exp2l", "math.h"},
+	{"expf", "math.h"},
+	{"expl", "math.h"},
+	{"expm1", "math.h"},
+	{"expm1f", "math.h"},
+	{"expm1l", "math.h"},
+	{"fabs", "math.h"},
+	{"fabsf", "math.h"},
+	{"fabsl", "math.h"},
+	{"fclose", "stdio.h"},
+	{"fdim", "math.h"},
+	{"fdimf", "math.h"},
+	{"fdiml", "math.h"},
+	{"feclearexcept", "fenv.h"},
+	{"fegetenv", "fenv.h"},
+	{"fegetexceptflag", "fenv.h"},
+	{"fegetround", "fenv.h"},
+	{"feholdexcept", "fenv.h"},
+	{"feof", "stdio.h"},
+	{"feraiseexcept", "fenv.h"},
+	{"ferror", "stdio.h"},
+	{"fesetenv", "fenv.h"},
+	{"fesetexceptflag", "fenv.h"},
+	{"fesetround", "fenv.h"},
+	{"fetestexcept", "fenv.h"},
+	{"feupdateenv", "fenv.h"},
+	{"fflush", "stdio.h"},
+	{"fgetc", "stdio.h"},
+	{"fgetpos", "stdio.h"},
+	{"fgets", "stdio.h"},
+	{"fgetwc", "wchar.h"},
+	{"fgetws", "wchar.h"},
+	{"floor", "math.h"},
+	{"floorf", "math.h"},
+	{"floorl", "math.h"},
+	{"fma", "math.h"},
+	{"fmaf", "math.h"},
+	{"fmal", "math.h"},
+	{"fmax", "math.h"},
+	{"fmaxf", "math.h"},
+	{"fmaxl", "math.h"},
+	{"fmin", "math.h"},
+	{"fminf", "math.h"},
+	{"fminl", "math.h"},
+	{"fmod", "math.h"},
+	{"fmodf", "math.h"},
+	{"fmodl", "math.h"},
+	{"fopen", "stdio.h"},
+	{"fpclassify", "math.h"},
+	{"fprintf", "stdio.h"},
+	{"fputc", "stdio.h"},
+	{"fputs", "stdio.h"},
+	{"fputwc", "wchar.h"},
+	{"fputws", "wchar.h"},
+	{"fread", "stdio.h"},
+	{"free", "stdlib.h"},
+	{"freopen", "stdio.h"},
+	{"frexp", "math.h"},
+	{"frexpf", "math.h"},
+	{"frexpl", "math.h"},
+	{"fscanf", "stdio.h"},
+	{"fseek", "stdio.h"},
+	{"fsetpos", "stdio.h"},
+	{"ftell", "stdio.h"},
+	{"fwide", "wchar.h"},
+	{"fwprintf", "wchar.h"},
+	{"fwrite", "stdio.h"},
+	{"fwscanf", "wchar.h"},
+	{"getc", "stdio.h"},
+	{"getchar", "stdio.h"},
+	{"getenv", "stdlib.h"},
+	{"gets", "stdio.h"},
+	{"getwc", "wchar.h"},
+	{"getwchar", "wchar.h"},
+	{"gmtime", "time.h"},
+	{"hypot", "math.h"},
+	{"hypotf", "math.h"},
+	{"hypotl", "math.h"},
+	{"ilogb", "math.h"},
+	{"ilogbf", "math.h"},
+	{"ilogbl", "math.h"},
+	{"imaxabs", "inttypes.h"},
+	{"imaxdiv", "inttypes.h"},
+	{"isalnum", "ctype.h"},
+	{"isalpha", "ctype.h"},
+	{"isblank", "ctype.h"},
+	{"iscntrl", "ctype.h"},
+	{"isdigit", "ctype.h"},
+	{"isfinite", "math.h"},
+	{"isgraph", "ctype.h"},
+	{"isgreater", "math.h"},
+	{"isgreaterequal", "math.h"},
+	{"isinf", "math.h"},
+	{"isless", "math.h"},
+	{"islessequal", "math.h"},
+	{"islessgreater", "math.h"},
+	{"islower", "ctype.h"},
+	{"isnan", "math.h"},
+	{"isnormal", "math.h"},
+	{"isprint", "ctype.h"},
+	{"ispunct", "ctype.h"},
+	{"isspace", "ctype.h"},
+	{"isunordered", "math.h"},
+	{"isupper", "ctype.h"},
+	{"iswalnum", "wctype.h"},
+	{"iswalpha", "wctype.h"},
+	{"iswblank", "wctype.h"},
+	{"iswcntrl", "wctype.h"},
+	{"iswctype", "wctype.h"},
+	{"iswdigit", "wctype.h"},
+	{"iswgraph", "wctype.h"},
+	{"iswlower", "wctype.h"},
+	{"iswprint", "wctype.h"},
+	{"iswpunct", "wctype.h"},
+	{"iswspace", "wctype.h"},
+	{"iswupper", "wctype.h"},
+	{"iswxdigit", "wctype.h"},
+	{"isxdigit", "ctype.h"},
+	{"labs", "stdlib.h"},
+	{"ldexp", "math.h"},
+	{"ldexpf", "math.h"},
+	{"ldexpl", "math.h"},
+	{"ldiv", "stdlib.h"},
+	{"lgamma", "math.h"},
+	{"lgammaf", "math.h"},
+	{"lgammal", "math.h"},
+	{"llabs", "stdlib.h"},
+	{"lldiv", "stdlib.h"},
+	{"llrint", "math.h"},
+	{"llrintf", "math.h"},
+	{"llrintl", "math.h"},
+	{"llround", "math.h"},
+	{"localeconv", "locale.h"},
+	{"localtime", "time.h"},
+	{"log", "math.h"},
+	{"log10", "math.h"},
+	{"log10f", "math.h"},
+	{"log10l", "math.h"},
+	{"log1p", "math.h"},
+	{"log1pf", "math.h"},
+	{"log1pl", "math.h"},
+	{"log2", "math.h"},
+	{"log2f", "math.h"},
+	{"log2l", "math.h"},
+	{"logb", "math.h"},
+	{"logbf", "math.h"},
+	{"logbl", "math.h"},
+	{"logf", "math.h"},
+	{"logl", "math.h"},
+	{"longjmp", "setjmp.h"},
+	{"lrint", "math.h"},
+	{"lrintf", "math.h"},
+	{"lrintl", "math.h"},
+	{"lround", "math.h"},
+	{"malloc", "stdlib.h"},
+	{"mbrlen", "wchar.h"},
+	{"mbrtowc", "wchar.h"},
+	{"mbsinit", "wchar.h"},
+	{"mbsrtowcs", "wchar.h"},
+	{"memchr", "string.h"},
+	{"memcmp", "string.h"},
+	{"memcpy", "string.h"},
+	{"memmove", "string.h"},
+	{"memset", "string.h"},
+	{"mktime", "time.h"},
+	{"modf", "math.h"},
+	{"modff", "math.h"},
+	{"modfl", "math.h"},
+	{"nan", "math.h"},
+	{"nanf", "math.h"},
+	{"nanl", "math.h"},
+	{"nearbyint", "math.h"},
+	{"nearbyintf", "math.h"},
+	{"nearbyintl", "math.h"},
+	{"nextafter", "math.h"},
+	{"nextafterf", "math.h"},
+	{"nextafterl", "math.h"},
+	{"nexttoward", "math.h"},
+	{"nexttowardf", "math.h"},
+	{"nexttowardl", "math.h"},
+	{"offsetof", "stddef.h"},
+	{"perror", "stdio.h"},
+	{"pow", "math.h"},
+	{"powf", "math.h"},
+	{"powl", "math.h"},
+	{"printf", "stdio.h"},
+	{"putc", "stdio.h"},
+	{"putchar", "stdio.h"},
+	{"puts", "stdio.h"},
+	{"putwc", "wchar.h"},
+	{"putwchar", "wchar.h"},
+	{"qsort", "stdlib.h"},
+	{"quick_exit", "stdlib.h"},
+	{"raise", "signal.h"},
+	{"rand", "stdlib.h"},
+	{"realloc", "stdlib.h"},
+	{"remainder", "math.h"},
+	{"remainderf", "math.h"},
+	{"remainderl", "math.h"},
+	{"remove", "stdio.h"},
+	{"remquo", "math.h"},
+	{"remquof", "math.h"},
+	{"remquol", "math.h"},
+	{"rename", "stdio.h"},
+	{"rewind", "stdio.h"},
+	{"rint", "math.h"},
+	{"rintf", "math.h"},
+	{"rintl", "math.h"},
+	{"round", "math.h"},
+	{"scalbln", "math.h"},
+	{"scalblnf", "math.h"},
+	{"scalblnl", "math.h"},
+	{"scalbn", "math.h"},
+	{"scalbnf", "math.h"},
+	{"scalbnl", "math.h"},
+	{"scanf", "stdio.h"},
+	{"setbuf", "stdio.h"},
+	{"setjmp", "setjmp.h"},
+	{"setlocale", "locale.h"},
+	{"setvbuf", "stdio.h"},
+	{"signal", "signal.h"},
+	{"signbit", "math.h"},
+	{"sin", "math.h"},
+	{"sinf", "math.h"},
+	{"sinh", "math.h"},
+	{"sinhf", "math.h"},
+	{"sinhl", "math.h"},
+	{"sinl", "math.h"},
+	{"snprintf", "stdio.h"},
+	{"sprintf", "stdio.h"},
+	{"sqrt", "math.h"},
+	{"sqrtf", "math.h"},
+	{"sqrtl", "math.h"},
+	{"srand", "stdlib.h"},
+	{"sscanf", "stdio.h"},
+	{"strcat", "string.h"},
+	{"strchr", "string.h"},
+	{"strcmp", "string.h"},
+	{"strcoll", "string.h"},
+	{"strcpy", "string.h"},
+	{"strcspn", "string.h"},
+	{"strerror", "string.h"},
+	{"strftime", "time.h"},
+	{"strlen", "string.h"},
+	{"strncat", "string.h"},
+	{"strncmp", "string.h"},
+	{"strncpy", "string.h"},
+	{"strpbrk", "string.h"},
+	{"strrchr", "string.h"},
+	{"strspn", "string.h"},
+	{"strstr", "string.h"},
+	{"strtod", "stdlib.h"},
+	{"strtof", "stdlib.h"},
+	{"strtok", "string.h"},
+	{"strtol", "stdlib.h"},
+	{"strtold", "stdlib.h"},
+	{"strtoll", "stdlib.h"},
+	{"strtoul", "stdlib.h"},
+	{"strtoull", "stdlib.h"},
+	{"strxfrm", "string.h"},
+	{"swprintf", "wchar.h"},
+	{"swscanf", "wchar.h"},
+	{"system", "stdlib.h"},
+	{"tan", "math.h"},
+	{"tanf", "math.h"},
+	{"tanh", "math.h"},
+	{"tanhf", "math.h"},
+	{"tanhl", "math.h"},
+	{"tanl", "math.h"},
+	{"tgamma", "math.h"},
+	{"tgammaf", "math.h"},
+	{"tgammal", "math.h"},
+	{"time", "time.h"},
+	{"tmpfile", "stdio.h"},
+	{"tmpnam", "stdio.h"},
+	{"tolower", "ctype.h"},
+	{"toupper", "ctype.h"},
+	{"towctrans", "wctype.h"},
+	{"towlower", "wctype.h"},
+	{"towupper", "wctype.h"},
+	{"trunc", "math.h"},
+	{"truncf", "math.h"},
+	{"truncl", "math.h"},
+	{"ungetc", "stdio.h"},
+	{"ungetwc", "wchar.h"},
+	{"va_arg", "stdarg.h"},
+	{"va_copy", "stdarg.h"},
+	{"va_end", "stdarg.h"},
+	{"va_start", "stdarg.h"},
+	{"vfprintf", "stdio.h"},
+	{"vfscanf", "stdio.h"},
+	{"vfwprintf", "wchar.h"},
+	{"vfwscanf", "wchar.h"},
+	{"vprintf", "stdio.h"},
+	{"vscanf", "stdio.h"},
+	{"vsnprintf", "stdio.h"},
+	{"vsprintf", "stdio.h"},
+	{"vsscanf", "stdio.h"},
+	{"vswprintf", "wchar.h"},
+	{"vswscanf", "wchar.h"},
+	{"vwprintf", "wchar.h"},
+	{"vwscanf", "wchar.h"},
+	{"wcrtomb", "wchar.h"},
+	{"wcscat", "wchar.h"},
+	{"wcschr", "wchar.h"},
+	{"wcscmp", "wchar.h"},
+	{"wcscoll", "wchar.h"},
+	{"wcscpy", "wchar.h"},
+	{"wcscspn", "wchar.h"},
+	{"wcsftime", "wchar.h"},
+	{"wcslen", "wchar.h"},
+	{"wcsncat", "wchar.h"},
+	{"wcsncmp", "wchar.h"},
+	{"wcsncpy", "wchar.h"},
+	{"wcspbrk", "wchar.h"},
+	{"wcsrchr", "wchar.h"},
+	{"wcsrtombs", "wchar.h"},
+	{"wcsspn", "wchar.h"},
+	{"wcsstr", "wchar.h"},
+	{"wcstod", "wchar.h"},
+	{"wcstof", "wchar.h"},
+	{"wcstok", "wchar.h"},
+	{"wcstol", "wchar.h"},
+	{"wcstold", "wchar.h"},
+	{"wcstoll", "wchar.h"},
+	{"wcstoul", "wchar.h"},
+	{"wcstoull", "wchar.h"},
+	{"wcsxfrm", "wchar.h"},
+	{"wctob", "wchar.h"},
+	{"wctrans", "wctype.h"},
+	{"wctype", "wctype.h"},
+	{"wmemchr", "wchar.h"},
+	{"wmemcmp", "wchar.h"},
+	{"wmemcpy", "wchar.h"},
+	{"wmemmove", "wchar.h"},
+	{"wmemset", "wchar.h"},
+	{"wprintf", "wchar.h"},
+	{"wscanf", "wchar.h"},
+};
+static_assert(FuncCHeaderTable(FUNC_C_HEADERS).isSorted(),
+	"FUNC_C_HEADERS has to be sorted by scripts/llvmir2hll/sort_semantics_tables.py");
 
 } // anonymous namespace
 
@@ -631,8 +506,8 @@ const StringStringUMap &FUNC_C_HEADER_MAP(initFuncCHeaderMap());
 *
 * See its description for more details.
 */
-std::optional<std::string> getCHeaderFileForFunc(const std::string &funcName) {
-	return getCHeaderFileForFuncFromMap(funcName, FUNC_C_HEADER_MAP);
+std::optional<std::string_view> getCHeaderFileForFunc(const std::string &funcName) {
+	return getCHeaderFileForFuncFromTable(funcName, FUNC_C_HEADERS);
 }
 
 } // namespace libc
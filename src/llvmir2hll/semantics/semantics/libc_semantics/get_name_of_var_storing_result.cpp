@@ -15,462 +15,331 @@ namespace libc {
 
 namespace {
 
-/**
-* @brief This function is used to initialize FUNC_VAR_NAME_MAP later in the
-*        file.
-*/
-const StringStringUMap &initFuncVarNameMap() {
-	static StringStringUMap m;
-
-	// The following list is based on
-	//
-	//     - http://en.wikipedia.org/wiki/C_standard_library
-	//     - http://www.cplusplus.com/reference/clibrary/
-	//
-	// and contains functions from C89, C99, and C11. It is by all means not
-	// complete, but most of the functions should be there. If you find a
-	// function that is missing, please, add it.
-
-	//
-	// assert.h
-	//
-	// m["assert"] = ""; // void
-
-	//
-	// complex.h
-	//
-	// m["cabs"] = "";
-	// m["carg"] = "";
-	// m["cimag"] = "";
-	// m["creal"] = "";
-	// m["conj"] = "";
-	// m["cproj"] = "";
-	// m["cexp"] = "";
-	// m["clog"] = "";
-	// m["csqrt"] = "";
-	// m["cpow"] = "";
-	// m["csin"] = "";
-	// m["ccos"] = "";
-	// m["ctan"] = "";
-	// m["casin"] = "";
-	// m["cacos"] = "";
-	// m["catan"] = "";
-	// m["csinh"] = "";
-	// m["ccosh"] = "";
-	// m["ctanh"] = "";
-	// m["casinh"] = "";
-	// m["cacosh"] = "";
-	// m["catanh"] = "";
-
-	//
-	// ctype.h
-	//
-	// m["isalnum"] = "";
-	// m["isalpha"] = "";
-	// m["isblank"] = "";
-	// m["iscntrl"] = "";
-	// m["isdigit"] = "";
-	// m["isgraph"] = "";
-	// m["islower"] = "";
-	// m["isprint"] = "";
-	// m["ispunct"] = "";
-	// m["isspace"] = "";
-	// m["isupper"] = "";
-	// m["isxdigit"] = "";
-	// m["tolower"] = "";
-	// m["toupper"] = "";
-
-	//
-	// errno.h
-	//
-	// -
-
-	//
-	// fenv.h
-	//
-	// m["feclearexcept"] = "";
-	// m["fegetenv"] = "";
-	// m["fegetexceptflag"] = "";
-	// m["fegetround "] = "";
-	// m["feholdexcept"] = "";
-	// m["feraiseexcept"] = "";
-	// m["fesetenv"] = "";
-	// m["fesetexceptflag"] = "";
-	// m["fesetround "] = "";
-	// m["fetestexcept"] = "";
-	// m["feupdateenv "] = "";
-
-	//
-	// float.h
-	//
-	// -
-
-	//
-	// inttypes.h
-	//
-	// -
-
-	//
-	// iso646.h
-	//
-	// -
-
-	//
-	// limits.h
-	//
-	// -
-
-	//
-	// locale.h
-	//
-	m["localeconv"] = "locale_info";
-	m["setlocale"] = "locale";
-
-	//
-	// math.h
-	//
-	// m["abs"] = "";
-	// m["labs"] = "";
-	// m["llabs"] = "";
-	// m["fabs"] = "";
-	// m["div"] = "";
-	// m["ldiv"] = "";
-	// m["lldiv"] = "";
-	// m["fmod"] = "";
-	// m["remainder"] = "";
-	// m["remquo"] = "";
-	// m["fma"] = "";
-	// m["fmax"] = "";
-	// m["fmin"] = "";
-	// m["fdim"] = "";
-	// m["nan"] = "";
-	// m["nanf"] = "";
-	// m["nanl"] = "";
-	// m["exp"] = "";
-	// m["exp2"] = "";
-	// m["expm1"] = "";
-	// m["log"] = "";
-	// m["log2"] = "";
-	// m["log10"] = "";
-	// m["log1p"] = "";
-	// m["ilogb"] = "";
-	// m["logb"] = "";
-	// m["sqrt"] = "";
-	// m["cbrt"] = "";
-	// m["hypot"] = "";
-	// m["pow"] = "";
-	// m["sin"] = "";
-	// m["cos"] = "";
-	// m["tan"] = "";
-	// m["asin"] = "";
-	// m["acos"] = "";
-	// m["atan"] = "";
-	// m["atan2"] = "";
-	// m["sinh"] = "";
-	// m["cosh"] = "";
-	// m["tanh"] = "";
-	// m["asinh"] = "";
-	// m["acosh"] = "";
-	// m["atanh"] = "";
-	// m["erf"] = "";
-	// m["erfc"] = "";
-	// m["lgamma"] = "";
-	// m["tgamma"] = "";
-	// m["ceil"] = "";
-	// m["floor"] = "";
-	// m["trunc"] = "";
-	// m["round"] = "";
-	// m["lround"] = "";
-	// m["llround"] = "";
-	// m["nearbyint"] = "";
-	// m["rint"] = "";
-	// m["lrint"] = "";
-	// m["llrint"] = "";
-	// m["frexp"] = "";
-	// m["ldexp"] = "";
-	// m["modf"] = "";
-	// m["scalbn"] = "";
-	// m["scalbln"] = "";
-	// m["nextafter"] = "";
-	// m["nexttoward"] = "";
-	// m["copysign"] = "";
-	// m["fpclassify"] = "";
-	// m["isfinite"] = "";
-	// m["isinf"] = "";
-	// m["isnan"] = "";
-	// m["isnormal"] = "";
-	// m["signbit"] = "";
-
-	//
-	// setjmp.h
-	//
-	m["setjmp"] = "val";
-	// m["longjmp"] = ""; // void
-
-	//
-	// signal.h
-	//
-	m["signal"] = "prev_sig_handler";
-	m["raise"] = "raise_rc";
-
-	//
-	// stdalign.h
-	//
-	// -
-
-	//
-	// stdarg.h
-	//
-	// m["va_start"] = ""; // void
-	// m["va_arg"] = "";
-	// m["va_end"] = ""; // void
-	// m["va_copy"] = ""; // void
-
-	//
-	// stdatomic.h
-	//
-	// -
-
-	//
-	// stdbool.h
-	//
-	// -
-
-	//
-	// stddef.h
-	//
-	// m["offsetof"] = "";
-
-	//
-	// stdint.h
-	//
-	// -
-
-	//
-	// stdio.h
-	//
-	// m["clearerr"] = ""; // void
-	// m["fclose"] = ""; // void
-	m["feof"] = "is_feof";
-	m["ferror"] = "is_ferror";
-	m["fflush"] = "fflush_rc";
-	m["fgetc"] = "c";
-	m["fgetpos"] = "fgetpos_rc";
-	m["fgets"] = "str";
-	m["fopen"] = "file";
-	m["fprintf"] = "chars_printed";
-	m["fputc"] = "fputc_rc";
-	m["fputs"] = "fputs_rc";
-	m["fread"] = "items_read";
-	m["freopen"] = "file";
-	m["fscanf"] = "items_assigned";
-	m["fseek"] = "fseek_rc";
-	m["fsetpos"] = "fsetpos_rc";
-	m["ftell"] = "curr_file_offset";
-	m["fwrite"] = "items_written";
-	m["getc"] = "c";
-	m["getchar"] = "c";
-	m["gets"] = "str";
-	// m["perror"] = ""; // void
-	m["printf"] = "chars_printed";
-	m["putc"] = "putc_rc";
-	m["putchar"] = "putchar_rc";
-	m["puts"] = "puts_rc";
-	m["remove"] = "remove_rc";
-	m["rename"] = "rename_rc";
-	// m["rewind"] = ""; // void
-	m["scanf"] = "items_assigned";
-	// m["setbuf"] = ""; // void
-	m["setvbuf"] = "setvbuf_rc";
-	m["snprintf"] = "chars_printed";
-	m["sprintf"] = "chars_printed";
-	m["sscanf"] = "items_assigned";
-	m["tmpfile"] = "tmp_file";
-	m["tmpnam"] = "tmp_file_name";
-	m["ungetc"] = "ungetc_rc";
-	m["vfprintf"] = "chars_printed";
-	m["vfscanf"] = "items_assigned";
-	m["vprintf"] = "chars_printed";
-	m["vscanf"] = "items_assigned";
-	m["vsnprintf"] = "chars_printed";
-	m["vsprintf"] = "chars_printed";
-	m["vsscanf"] = "items_assigned";
-
-	//
-	// stdlib.h
-	//
-	m["atof"] = "str_as_f";
-	m["atoi"] = "str_as_i";
-	m["atol"] = "str_as_l";
-	m["atoll"] = "str_as_ll";
-	m["strtof"] = "str_as_f";
-	m["strtod"] = "str_as_d";
-	m["strtold"] = "str_as_ld";
-	m["strtol"] = "str_as_l";
-	m["strtoll"] = "str_as_ll";
-	m["strtoul"] = "str_as_ul";
-	m["strtoull"] = "str_as_ull";
-	m["calloc"] = "mem";
-	m["malloc"] = "mem";
-	m["realloc"] = "mem";
-	// m["free"] = ""; // void
-	// m["abort"] = ""; // void
-	// m["exit"] = ""; // void
-	m["atexit"] = "atexit_rc";
-	// m["quick_exit"] = ""; // void
-	m["at_quick_exit"] = "at_quick_exit_rc";
-	m["system"] = "system_rc";
-	m["getenv"] = "env_val";
-	m["bsearch"] = "found_elem";
-	// m["qsort"] = ""; // void
-	// m["rand"] = "";
-	// m["srand"] = ""; // void
-	// m["_Exit"] = ""; // void
-
-	//
-	// stdnoreturn.h
-	//
-	// -
-
-	//
-	// string.h
-	//
-	m["memchr"] = "found_byte_pos";
-	m["memcmp"] = "memcmp_rc";
-	m["memcpy"] = "dest_mem";
-	m["memmove"] = "dest_mem";
-	m["memset"] = "set_mem";
-	m["strcat"] = "dest_str";
-	m["strchr"] = "found_char_pos";
-	m["strcmp"] = "strcmp_rc";
-	m["strcoll"] = "strcoll_rc";
-	m["strcpy"] = "dest_str";
-	m["strcspn"] = "ini_seg_bytes";
-	m["strerror"] = "err_str";
-	m["strlen"] = "len";
-	m["strncat"] = "dest_str";
-	m["strncmp"] = "strncmp_rc";
-	m["strncpy"] = "dest_str";
-	m["strpbrk"] = "found_byte_pos";
-	m["strrchr"] = "found_char_pos";
-	m["strspn"] = "ini_seg_bytes";
-	m["strstr"] = "substr_pos";
-	m["strtok"] = "next_token";
-	m["strxfrm"] = "req_bytes";
-
-	//
-	// tgmath.h
-	//
-	// -
-
-	//
-	// threads.h
-	//
-	// -
-
-	//
-	// time.h
-	//
-	m["difftime"] = "time_diff";
-	m["time"] = "time_val";
-	m["clock"] = "proc_time";
-	m["asctime"] = "time_str";
-	m["ctime"] = "time_str";
-	m["strftime"] = "copied_chars";
-	m["gmtime"] = "time_info";
-	m["localtime"] = "time_info";
-	m["mktime"] = "time_info";
-
-	//
-	// wchar.h
-	//
-	// m["btowc"] = "";
-	// m["fgetwc"] = "";
-	// m["fgetws"] = "";
-	// m["fputwc"] = "";
-	// m["fputws"] = "";
-	// m["fwide"] = "";
-	// m["fwprintf"] = "";
-	// m["fwscanf"] = "";
-	// m["getwc"] = "";
-	// m["getwchar"] = "";
-	// m["mbrlen"] = "";
-	// m["mbrtowc"] = "";
-	// m["mbsinit"] = "";
-	// m["mbsrtowcs"] = "";
-	// m["putwc"] = "";
-	// m["putwchar"] = "";
-	// m["swprintf"] = "";
-	// m["swscanf"] = "";
-	// m["ungetwc"] = "";
-	// m["vfwprintf"] = "";
-	// m["vfwscanf"] = "";
-	// m["vswprintf"] = "";
-	// m["vswscanf"] = "";
-	// m["vwprintf"] = "";
-	// m["vwscanf"] = "";
-	// m["wcrtomb"] = "";
-	// m["wcscat"] = "";
-	// m["wcschr"] = "";
-	// m["wcscmp"] = "";
-	// m["wcscoll"] = "";
-	// m["wcscpy"] = "";
-	// m["wcscspn"] = "";
-	// m["wcsftime"] = "";
-	// m["wcslen"] = "";
-	// m["wcsncat"] = "";
-	// m["wcsncmp"] = "";
-	// m["wcsncpy"] = "";
-	// m["wcspbrk"] = "";
-	// m["wcsrchr"] = "";
-	// m["wcsrtombs"] = "";
-	// m["wcsspn"] = "";
-	// m["wcsstr"] = "";
-	// m["wcstod"] = "";
-	// m["wcstof"] = "";
-	// m["wcstok"] = "";
-	// m["wcstol"] = "";
-	// m["wcstold"] = "";
-	// m["wcstoll"] = "";
-	// m["wcstoul"] = "";
-	// m["wcstoull"] = "";
-	// m["wcsxfrm"] = "";
-	// m["wctob"] = "";
-	// m["wmemchr"] = "";
-	// m["wmemcmp"] = "";
-	// m["wmemcpy"] = "";
-	// m["wmemmove"] = "";
-	// m["wmemset"] = "";
-	// m["wprintf"] = "";
-	// m["wscanf"] = "";
-
-	//
-	// wctype.h
-	//
-	// m["iswalnum"] = "";
-	// m["iswalpha"] = "";
-	// m["iswblank"] = "";
-	// m["iswcntrl"] = "";
-	// m["iswctype"] = "";
-	// m["iswdigit"] = "";
-	// m["iswgraph"] = "";
-	// m["iswlower"] = "";
-	// m["iswprint"] = "";
-	// m["iswpunct"] = "";
-	// m["iswspace"] = "";
-	// m["iswupper"] = "";
-	// m["iswxdigit"] = "";
-	// m["towctrans"] = "";
-	// m["towlower"] = "";
-	// m["towupper"] = "";
-	// m["wctrans"] = "";
-	// m["wctype"] = "";
-
-	return m;
-}
+// The following list is based on
+//
+//     - http://en.wikipedia.org/wiki/C_standard_library
+//     - http://www.cplusplus.com/reference/clibrary/
+//
+// and contains functions from C89, C99, and C11. It is by all means not
+// complete, but most of the functions should be there. If you find a
+// function that is missing, please, add it.
 
 /// Mapping of function names to their corresponding names of variables.
-const StringStringUMap &FUNC_VAR_NAME_MAP(initFuncVarNameMap());
+constexpr FuncVarName FUNC_VAR_NAMES[] = {
+	// {"_Exit", ""}, // void
+	// {"abort", ""}, // void
+	// {"abs", ""},
+	// {"acos", ""},
+	// {"acosh", ""},
+	{"asctime", "time_str"},
+	// {"asin", ""},
+	// {"asinh", ""},
+	// {"assert", ""}, // void
+	{"at_quick_exit", "at_quick_exit_rc"},
+	// {"atan", ""},
+	// {"atan2", ""},
+	// {"atanh", ""},
+	{"atexit", "atexit_rc"},
+	{"atof", "str_as_f"},
+	{"atoi", "str_as_i"},
+	{"atol", "str_as_l"},
+	{"atoll", "str_as_ll"},
+	{"bsearch", "found_elem"},
+	// {"btowc", ""},
+	// {"cabs", ""},
+	// {"cacos", ""},
+	// {"cacosh", ""},
+	{"calloc", "mem"},
+	// {"carg", ""},
+	// {"casin", ""},
+	// {"casinh", ""},
+	// {"catan", ""},
+	// {"catanh", ""},
+	// {"cbrt", ""},
+	// {"ccos", ""},
+	// {"ccosh", ""},
+	// {"ceil", ""},
+	// {"cexp", ""},
+	// {"cimag", ""},
+	// {"clearerr", ""}, // void
+	{"clock", "proc_time"},
+	// {"clog", ""},
+	// {"conj", ""},
+	// {"copysign", ""},
+	// {"cos", ""},
+	// {"cosh", ""},
+	// {"cpow", ""},
+	// {"cproj", ""},
+	// {"creal", ""},
+	// {"csin", ""},
+	// {"csinh", ""},
+	// {"csqrt", ""},
+	// {"ctan", ""},
+	// {"ctanh", ""},
+	{"ctime", "time_str"},
+	{"difftime", "time_diff"},
+	// {"div", ""},
+	// {"erf", ""},
+	// {"erfc", ""},
+	// {"exit", ""}, // void
+	// {"exp", ""},
+	// {"exp2", ""},
+	// {"expm1", ""},
+	// {"fabs", ""},
+	// {"fclose", ""}, // void
+	// {"fdim", ""},
+	// {"feclearexcept", ""},
+	// {"fegetenv", ""},
+	// {"fegetexceptflag", ""},
+	// {"fegetround ", ""},
+	// {"feholdexcept", ""},
+	{"feof", "is_feof"},
+	// {"feraiseexcept", ""},
+	{"ferror", "is_ferror"},
+	// {"fesetenv", ""},
+	// {"fesetexceptflag", ""},
+	// {"fesetround ", ""},
+	// {"fetestexcept", ""},
+	// {"feupdateenv ", ""},
+	{"fflush", "fflush_rc"},
+	{"fgetc", "c"},
+	{"fgetpos", "fgetpos_rc"},
+	{"fgets", "str"},
+	// {"fgetwc", ""},
+	// {"fgetws", ""},
+	// {"floor", ""},
+	// {"fma", ""},
+	// {"fmax", ""},
+	// {"fmin", ""},
+	// {"fmod", ""},
+	{"fopen", "file"},
+	// {"fpclassify", ""},
+	{"fprintf", "chars_printed"},
+	{"fputc", "fputc_rc"},
+	{"fputs", "fputs_rc"},
+	// {"fputwc", ""},
+	// {"fputws", ""},
+	{"fread", "items_read"},
+	// {"free", ""}, // void
+	{"freopen", "file"},
+	// {"frexp", ""},
+	{"fscanf", "items_assigned"},
+	{"fseek", "fseek_rc"},
+	{"fsetpos", "fsetpos_rc"},
+	{"ftell", "curr_file_offset"},
+	// {"fwide", ""},
+	// {"fwprintf", ""},
+	{"fwrite", "items_written"},
+	// {"fwscanf", ""},
+	{"getc", "c"},
+	{"getchar", "c"},
+	{"getenv", "env_val"},
+	{"gets", "str"},
+	// {"getwc", ""},
+	// {"getwchar", ""},
+	{"gmtime", "time_info"},
+	// {"hypot", ""},
+	// {"ilogb", ""},
+	// {"isalnum", ""},
+	// {"isalpha", ""},
+	// {"isblank", ""},
+	// {"iscntrl", ""},
+	// {"isdigit", ""},
+	// {"isfinite", ""},
+	// {"isgraph", ""},
+	// {"isinf", ""},
+	// {"islower", ""},
+	// {"isnan", ""},
+	// {"isnormal", ""},
+	// {"isprint", ""},
+	// {"ispunct", ""},
+	// {"isspace", ""},
+	// {"isupper", ""},
+	// {"iswalnum", ""},
+	// {"iswalpha", ""},
+	// {"iswblank", ""},
+	// {"iswcntrl", ""},
+	// {"iswctype", ""},
+	// {"iswdigit", ""},
+	// {"iswgraph", ""},
+	// {"iswlower", ""},
+	// {"iswprint", ""},
+	// {"iswpunct", ""},
+	// {"iswspace", ""},
+	// {"iswupper", ""},
+	// {"iswxdigit", ""},
+	// {"isxdigit", ""},
+	// {"labs", ""},
+	// {"ldexp", ""},
+	// {"ldiv", ""},
+	// {"lgamma", ""},
+	// {"llabs", ""},
+	// {"lldiv", ""},
+	// {"llrint", ""},
+	// {"llround", ""},
+	{"localeconv", "locale_info"},
+	{"localtime", "time_info"},
+	// {"log", ""},
+	// {"log10", ""},
+	// {"log1p", ""},
+	// {"log2", ""},
+	// {"logb", ""},
+	// {"longjmp", ""}, // void
+	// {"lrint", ""},
+	// {"lround", ""},
+	{"malloc", "mem"},
+	// {"mbrlen", ""},
+	// {"mbrtowc", ""},
+	// {"mbsinit", ""},
+	// {"mbsrtowcs", ""},
+	{"memchr", "found_byte_pos"},
+	{"memcmp", "memcmp_rc"},
+	{"memcpy", "dest_mem"},
+	{"memmove", "dest_mem"},
+	{"memset", "set_mem"},
+	{"mktime", "time_info"},
+	// {"modf", ""},
+	// {"nan", ""},
+	// {"nanf", ""},
+	// {"nanl", ""},
+	// {"nearbyint", ""},
+	// {"nextafter", ""},
+	// {"nexttoward", ""},
+	// {"offsetof", ""},
+	// {"perror", ""}, // void
+	// {"pow", ""},
+	{"printf", "chars_printed"},
+	{"putc", "putc_rc"},
+	{"putchar", "putchar_rc"},
+	{"puts", "puts_rc"},
+	// {"putwc", ""},
+	// {"putwchar", ""},
+	// {"qsort", ""}, // void
+	// {"quick_exit", ""}, // void
+	{"raise", "raise_rc"},
+	// {"rand", ""},
+	{"realloc", "mem"},
+	// {"remainder", ""},
+	{"remove", "remove_rc"},
+	// {"remquo", ""},
+	{"rename", "rename_rc"},
+	// {"rewind", ""}, // void
+	// {"rint", ""},
+	// {"round", ""},
+	// {"scalbln", ""},
+	// {"scalbn", ""},
+	{"scanf", "items_assigned"},
+	// {"setbuf", ""}, // void
+	{"setjmp", "val"},
+	{"setlocale", "locale"},
+	{"setvbuf", "setvbuf_rc"},
+	{"signal", "prev_sig_handler"},
+	// {"signbit", ""},
+	// {"sin", ""},
+	// {"sinh", ""},
+	{"snprintf", "chars_printed"},
+	{"sprintf", "chars_printed"},
+	// {"sqrt", ""},
+	// {"srand", ""}, // void
+	{"sscanf", "items_assigned"},
+	{"strcat", "dest_str"},
+	{"strchr", "found_char_pos"},
+	{"strcmp", "strcmp_rc"},
+	{"strcoll", "strcoll_rc"},
+	{"strcpy", "dest_str"},
+	{"strcspn", "ini_seg_bytes"},
+	{"strerror", "err_str"},
+	{"strftime", "copied_chars"},
+	{"strlen", "len"},
+	{"strncat", "dest_str"},
+	{"strncmp", "strncmp_rc"},
+	{"strncpy", "dest_str"},
+	{"strpbrk", "found_byte_pos"},
+	{"strrchr", "found_char_pos"},
+	{"strspn", "ini_seg_bytes"},
+	{"strstr", "substr_pos"},
+	{"strtod", "str_as_d"},
+	{"strtof", "str_as_f"},
+	{"strtok", "next_token"},
+	{"strtol", "str_as_l"},
+	{"strtold", "str_as_ld"},
+	{"strtoll", "str_as_ll"},
+	{"strtoul", "str_as_ul"},
+	{"strtoull", "str_as_ull"},
+	{"strxfrm", "req_bytes"},
+	// {"swprintf", ""},
+	// {"swscanf", ""},
+	{"system", "system_rc"},
+	// {"tan", ""},
+	// {"tanh", ""},
+	// {"tgamma", ""},
+	{"time", "time_val"},
+	{"tmpfile", "tmp_file"},
+	{"tmpnam", "tmp_file_name"},
+	// {"tolower", ""},
+	// {"toupper", ""},
+	// {"towctrans", ""},
+	// {"towlower", ""},
+	// {"towupper", ""},
+	// {"trunc", ""},
+	{"ungetc", "ungetc_rc"},
+	// {"ungetwc", ""},
+	// {"va_arg", ""},
+	// {"va_copy", ""}, // void
+	// {"va_end", ""}, // void
+	// {"va_start", ""}, // void
+	{"vfprintf", "chars_printed"},
+	{"vfscanf", "items_assigned"},
+	// {"vfwprintf", ""},
+	// {"vfwscanf", ""},
+	{"vprintf", "chars_printed"},
+	{"vscanf", "items_assigned"},
+	{"vsnprintf", "chars_printed"},
+	{"vsprintf", "chars_printed"},
+	{"vsscanf", "items_assigned"},
+	// {"vswprintf", ""},
+	// {"vswscanf", ""},
+	// {"vwprintf", ""},
+	// {"vwscanf", ""},
+	// {"wcrtomb", ""},
+	// {"wcscat", ""},
+	// {"wcschr", ""},
+	// {"wcscmp", ""},
+	// {"wcscoll", ""},
+	// {"wcscpy", ""},
+	// {"wcscspn", ""},
+	// {"wcsftime", ""},
+	// {"wcslen", ""},
+	// {"wcsncat", ""},
+	// {"wcsncmp", ""},
+	// {"wcsncpy", ""},
+	// {"wcspbrk", ""},
+	// {"wcsrchr", ""},
+	// {"wcsrtombs", ""},
+	// {"wcsspn", ""},
+	// {"wcsstr", ""},
+	// {"wcstod", ""},
+	// {"wcstof", ""},
+	// {"wcstok", ""},
+	// {"wcstol", ""},
+	// {"wcstold", ""},
+	// {"wcstoll", ""},
+	// {"wcstoul", ""},
+	// {"wcstoull", ""},
+	// {"wcsxfrm", ""},
+	// {"wctob", ""},
+	// {"wctrans", ""},
+	// {"wctype", ""},
+	// {"wmemchr", ""},
+	// {"wmemcmp", ""},
+	// {"wmemcpy", ""},
+	// {"wmemmove", ""},
+	// {"wmemset", ""},
+	// {"wprintf", ""},
+	// {"wscanf", ""},
+};
+static_assert(FuncVarNameTable(FUNC_VAR_NAMES).isSorted(),
+	"FUNC_VAR_NAMES has to be sorted by scripts/llvmir2hll/sort_semantics_tables.py");
 
 } // anonymous namespace
 
@@ -479,8 +348,8 @@ const StringStringUMap &FUNC_VAR_NAME_MAP(initFuncVarNameMap());
 *
 * See its description for more details.
 */
-std::optional<std::string> getNameOfVarStoringResult(const std::string &funcName) {
-	return getNameOfVarStoringResultFromMap(funcName, FUNC_VAR_NAME_MAP);
+std::optional<std::string_view> getNameOfVarStoringResult(const std::string &funcName) {
+	return getNameOfVarStoringResultFromTable(funcName, FUNC_VAR_NAMES);
 }
 
 } // namespace libc
@@ -15,39 +15,23 @@ namespace libc {
 
 namespace {
 
-/**
-* @brief This function is used to initialize FUNC_PARAMS_MAP later in the file.
-*/
-const FuncParamsMap &initFuncParamsMap() {
-	static FuncParamsMap funcParamsMap;
-
-	// Temporary maps used to store the symbols for the current parameter of
-	// the current function. In this way, we don't have to keep separate maps
-	// for every function and every parameter. The only downside is that before
-	// adding new data into it, it has to be cleared.
-	ParamSymbolsMap paramSymbolsMap;
-	IntStringMap symbolicNamesMap;
+constexpr SymbolicName FSEEK_WHENCE[] = {
+	// Info from: <stdio.h>
+	{0, "SEEK_SET"},
+	{1, "SEEK_CUR"},
+	{2, "SEEK_END"},
+};
 
+/// Mapping of function names into symbolic names of their parameters.
+constexpr FuncParamSymbolicNames FUNC_PARAMS_SYMBOLIC_NAMES[] = {
 	//
 	// #include <stdio.h>
 	// int fseek(FILE *stream, long offset, int whence);
 	//
-	// Info from: <stdio.h>
-	//
-	paramSymbolsMap.clear();
-	// whence
-	symbolicNamesMap.clear();
-	symbolicNamesMap[0] = "SEEK_SET";
-	symbolicNamesMap[1] = "SEEK_CUR";
-	symbolicNamesMap[2] = "SEEK_END";
-	paramSymbolsMap[3] = symbolicNamesMap;
-	funcParamsMap["fseek"] = paramSymbolsMap;
-
-	return funcParamsMap;
-}
-
-/// Mapping of function names into symbolic names of their parameters.
-const FuncParamsMap &FUNC_PARAMS_MAP(initFuncParamsMap());
+	{"fseek", 3, FSEEK_WHENCE}, // whence
+};
+static_assert(FuncParamSymbolicNamesTable(FUNC_PARAMS_SYMBOLIC_NAMES).isSorted(),
+	"FUNC_PARAMS_SYMBOLIC_NAMES has to be sorted by scripts/llvmir2hll/sort_semantics_tables.py");
 
 } // anonymous namespace
 
@@ -56,9 +40,10 @@ const FuncParamsMap &FUNC_PARAMS_MAP(initFuncParamsMap());
 *
 * See its description for more details.
 */
-std::optional<IntStringMap> getSymbolicNamesForParam(const std::string &funcName,
+const IntStringMap *getSymbolicNamesForParam(const std::string &funcName,
 		unsigned paramPos) {
-	return getSymbolicNamesForParamFromMap(funcName, paramPos, FUNC_PARAMS_MAP);
+	return getSymbolicNamesForParamFromTable(funcName, paramPos,
+		FUNC_PARAMS_SYMBOLIC_NAMES);
 }
 
 } // namespace libc
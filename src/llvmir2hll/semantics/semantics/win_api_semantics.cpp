@@ -36,7 +36,7 @@ std::string WinAPISemantics::getId() const {
 	return WIN_API_SEMANTICS_ID;
 }
 
-std::optional<std::string> WinAPISemantics::getCHeaderFileForFunc(
+std::optional<std::string_view> WinAPISemantics::getCHeaderFileForFunc(
 		const std::string &funcName) const {
 	return semantics::win_api::getCHeaderFileForFunc(funcName);
 }
@@ -46,17 +46,17 @@ std::optional<bool> WinAPISemantics::funcNeverReturns(
 	return semantics::win_api::funcNeverReturns(funcName);
 }
 
-std::optional<std::string> WinAPISemantics::getNameOfVarStoringResult(
+std::optional<std::string_view> WinAPISemantics::getNameOfVarStoringResult(
 		const std::string &funcName) const {
 	return semantics::win_api::getNameOfVarStoringResult(funcName);
 }
 
-std::optional<std::string> WinAPISemantics::getNameOfParam(
+std::optional<std::string_view> WinAPISemantics::getNameOfParam(
 		const std::string &funcName, unsigned paramPos) const {
 	return semantics::win_api::getNameOfParam(funcName, paramPos);
 }
 
-std::optional<IntStringMap> WinAPISemantics::getSymbolicNamesForParam(
+const IntStringMap *WinAPISemantics::getSymbolicNamesForParam(
 		const std::string &funcName, unsigned paramPos) const {
 	return semantics::win_api::getSymbolicNamesForParam(funcName, paramPos);
 }
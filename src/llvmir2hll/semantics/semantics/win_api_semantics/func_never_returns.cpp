@@ -18,28 +18,17 @@ namespace win_api {
 
 namespace {
 
-/**
-* @brief This function is used to initialize FUNC_NEVER_RETURNS later in
-*        the file.
-*/
-const StringSet &initFuncNeverReturns() {
-	static StringSet fnr;
-
-	// Currently, we only list the functions about which we actually know that
-	// they never return. The reason is that when using funcNeverReturns(), we
-	// actually only care whether it returns true. If it returns false or no
-	// answer at all is irrelevant.
-
+/// Functions that do not return.
+// Currently, we only list the functions about which we actually know that they
+// never return. The reason is that when using funcNeverReturns(), we actually
+// only care whether it returns true. If it returns false or no answer at all
+// is irrelevant.
+const StringSet FUNC_NEVER_RETURNS = {
 	// https://msdn.microsoft.com/en-us/library/windows/desktop/ms682658(v=vs.85).aspx
-	fnr.insert("ExitProcess");
+	"ExitProcess",
 	// https://msdn.microsoft.com/en-us/library/windows/desktop/ms682659(v=vs.85).aspx
-	fnr.insert("ExitThread");
-
-	return fnr;
-}
-
-/// Functions that do not return.
-const StringSet &FUNC_NEVER_RETURNS(initFuncNeverReturns());
+	"ExitThread",
+};
 
 } // anonymous namespace
 
@@ -5,6 +5,8 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <cctype>
+
 #include "retdec/llvmir2hll/semantics/semantics/impl_support/get_name_of_param.h"
 #include "retdec/llvmir2hll/semantics/semantics/win_api_semantics/get_name_of_param.h"
 #include "retdec/llvmir2hll/semantics/semantics/win_api_semantics/get_name_of_param/a.h"
@@ -43,61 +45,66 @@ namespace win_api {
 
 namespace {
 
-/**
-* @brief This function is used to initialize FUNC_PARAM_NAMES_MAP later in the
-*        file.
-*/
-const FuncParamNamesMap &initFuncParamNamesMap() {
-	static FuncParamNamesMap funcParamNamesMap;
+//
+// The base of the information for this type of semantics has been obtained
+// by using the
+// scripts/backend/semantics/func_var_names/gen_winapi_semantics_from_includes.py
+// script with includes mingw32-x86-pe/i686-w64-mingw32/includes/win*.h.
+// The resulting semantics has been updated manually. Useless mappings have
+// been commented out.
+//
+// The tables are split into several modules by the first letters of names of
+// functions (regardless of case, underscore belongs to A), so every function is
+// in exactly one of them.
+//
 
-	//
-	// The base of the information for this type of semantics has been obtained
-	// by using the
-	// scripts/backend/semantics/func_var_names/gen_winapi_semantics_from_includes.py
-	// script with includes mingw32-x86-pe/i686-w64-mingw32/includes/win*.h.
-	// The resulting semantics has been updated manually. Useless mappings have
-	// been commented out.
-	//
+/// Tables of names of parameters indexed by first letters of names of
+/// functions.
+const FuncParamNameTable *const FUNC_PARAM_NAMES_TABLES[][2] = {
+	{&FUNC_PARAM_NAMES_A, nullptr},
+	{&FUNC_PARAM_NAMES_B, nullptr},
+	{&FUNC_PARAM_NAMES_C1, &FUNC_PARAM_NAMES_C2},
+	{&FUNC_PARAM_NAMES_D, nullptr},
+	{&FUNC_PARAM_NAMES_E, nullptr},
+	{&FUNC_PARAM_NAMES_F, nullptr},
+	{&FUNC_PARAM_NAMES_G1, &FUNC_PARAM_NAMES_G2},
+	{&FUNC_PARAM_NAMES_H, nullptr},
+	{&FUNC_PARAM_NAMES_I, nullptr},
+	{&FUNC_PARAM_NAMES_J, nullptr},
+	{&FUNC_PARAM_NAMES_K, nullptr},
+	{&FUNC_PARAM_NAMES_L, nullptr},
+	{&FUNC_PARAM_NAMES_M, nullptr},
+	{&FUNC_PARAM_NAMES_N, nullptr},
+	{&FUNC_PARAM_NAMES_O, nullptr},
+	{&FUNC_PARAM_NAMES_P, nullptr},
+	{&FUNC_PARAM_NAMES_Q, nullptr},
+	{&FUNC_PARAM_NAMES_R, nullptr},
+	{&FUNC_PARAM_NAMES_S, nullptr},
+	{&FUNC_PARAM_NAMES_T, nullptr},
+	{&FUNC_PARAM_NAMES_U, nullptr},
+	{&FUNC_PARAM_NAMES_V, nullptr},
+	{&FUNC_PARAM_NAMES_W, nullptr},
+	{&FUNC_PARAM_NAMES_X, nullptr},
+	{&FUNC_PARAM_NAMES_Y, nullptr},
+	{&FUNC_PARAM_NAMES_Z, nullptr},
+};
 
-	// Since having 10 000 lines in a single file was found impossible to
-	// compile by using gcc in a reasonable amount of time and memory (even
-	// using -fno-var-tracking), we had to split the initialization into
-	// several modules.
-	initFuncParamNamesMap_A(funcParamNamesMap);
-	initFuncParamNamesMap_B(funcParamNamesMap);
-	initFuncParamNamesMap_C1(funcParamNamesMap);
-	initFuncParamNamesMap_C2(funcParamNamesMap);
-	initFuncParamNamesMap_D(funcParamNamesMap);
-	initFuncParamNamesMap_E(funcParamNamesMap);
-	initFuncParamNamesMap_F(funcParamNamesMap);
-	initFuncParamNamesMap_G1(funcParamNamesMap);
-	initFuncParamNamesMap_G2(funcParamNamesMap);
-	initFuncParamNamesMap_H(funcParamNamesMap);
-	initFuncParamNamesMap_I(funcParamNamesMap);
-	initFuncParamNamesMap_J(funcParamNamesMap);
-	initFuncParamNamesMap_K(funcParamNamesMap);
-	initFuncParamNamesMap_L(funcParamNamesMap);
-	initFuncParamNamesMap_M(funcParamNamesMap);
-	initFuncParamNamesMap_N(funcParamNamesMap);
-	initFuncParamNamesMap_O(funcParamNamesMap);
-	initFuncParamNamesMap_P(funcParamNamesMap);
-	initFuncParamNamesMap_Q(funcParamNamesMap);
-	initFuncParamNamesMap_R(funcParamNamesMap);
-	initFuncParamNamesMap_S(funcParamNamesMap);
-	initFuncParamNamesMap_T(funcParamNamesMap);
-	initFuncParamNamesMap_U(funcParamNamesMap);
-	initFuncParamNamesMap_V(funcParamNamesMap);
-	initFuncParamNamesMap_W(funcParamNamesMap);
-	initFuncParamNamesMap_X(funcParamNamesMap);
-	initFuncParamNamesMap_Y(funcParamNamesMap);
-	initFuncParamNamesMap_Z(funcParamNamesMap);
+/**
+* @brief Returns the tables that may contain the given function.
+*/
+const FuncParamNameTable *const *getTablesForFunc(const std::string &funcName) {
+	if (funcName.empty()) {
+		return nullptr;
+	}
 
-	return funcParamNamesMap;
+	char first = funcName[0] == '_' ? 'A' : std::toupper(
+		static_cast<unsigned char>(funcName[0]));
+	if (first < 'A' || first > 'Z') {
+		return nullptr;
+	}
+	return FUNC_PARAM_NAMES_TABLES[first - 'A'];
 }
 
-/// Mapping of function parameter positions into the names of parameters.
-const FuncParamNamesMap &FUNC_PARAM_NAMES_MAP(initFuncParamNamesMap());
-
 } // anonymous namespace
 
 /**
@@ -105,9 +112,19 @@ const FuncParamNamesMap &FUNC_PARAM_NAMES_MAP(initFuncParamNamesMap());
 *
 * See its description for more details.
 */
-std::optional<std::string> getNameOfParam(const std::string &funcName,
+std::optional<std::string_view> getNameOfParam(const std::string &funcName,
 		unsigned paramPos) {
-	return getNameOfParamFromMap(funcName, paramPos, FUNC_PARAM_NAMES_MAP);
+	auto tables = getTablesForFunc(funcName);
+	if (!tables) {
+		return std::nullopt;
+	}
+
+	for (auto table = tables; table != tables + 2 && *table; ++table) {
+		if (auto paramName = getNameOfParamFromTable(funcName, paramPos, **table)) {
+			return paramName;
+		}
+	}
+	return std::nullopt;
 }
 
 } // namespace win_api
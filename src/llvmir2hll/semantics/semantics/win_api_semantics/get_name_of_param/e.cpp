@@ -11,678 +11,681 @@ namespace llvmir2hll {
 namespace semantics {
 namespace win_api {
 
-/**
-* @brief Initializes the given map with info about functions starting with E.
-*/
-void initFuncParamNamesMap_E(FuncParamNamesMap &funcParamNamesMap) {
-	//
-	// windows.h
-	//
-	ADD_PARAM_NAME("Ellipse", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("Ellipse", 2, "left"); // int
-	ADD_PARAM_NAME("Ellipse", 3, "top"); // int
-	ADD_PARAM_NAME("Ellipse", 4, "right"); // int
-	ADD_PARAM_NAME("Ellipse", 5, "bottom"); // int
-	ADD_PARAM_NAME("EnableMenuItem", 1, "hMenu"); // HMENU
-	ADD_PARAM_NAME("EnableMenuItem", 2, "uIDEnableItem"); // UINT
-	ADD_PARAM_NAME("EnableMenuItem", 3, "uEnable"); // UINT
-	ADD_PARAM_NAME("EnableScrollBar", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("EnableScrollBar", 2, "wSBflags"); // UINT
-	ADD_PARAM_NAME("EnableScrollBar", 3, "wArrows"); // UINT
-	ADD_PARAM_NAME("EnableWindow", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("EnableWindow", 2, "bEnable"); // WINBOOL
-	ADD_PARAM_NAME("EncodePointer", 1, "Ptr"); // PVOID
-	ADD_PARAM_NAME("EncodeSystemPointer", 1, "Ptr"); // PVOID
-	ADD_PARAM_NAME("EncryptFileA", 1, "lpFileName"); // LPCSTR
-	ADD_PARAM_NAME("EncryptFileW", 1, "lpFileName"); // LPCWSTR
-	ADD_PARAM_NAME("EncryptionDisable", 1, "DirPath"); // LPCWSTR
-	ADD_PARAM_NAME("EncryptionDisable", 2, "Disable"); // WINBOOL
-	ADD_PARAM_NAME("EndDeferWindowPos", 1, "hWinPosInfo"); // HDWP
-	ADD_PARAM_NAME("EndDialog", 1, "hDlg"); // HWND
-	ADD_PARAM_NAME("EndDialog", 2, "nResult"); // INT_PTR
-	ADD_PARAM_NAME("EndDoc", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("EndDocPrinter", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("EndPage", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("EndPagePrinter", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("EndPaint", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("EndPaint", 2, "lpPaint"); // CONST PAINTSTRUCT *
-	ADD_PARAM_NAME("EndPath", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("EndTask", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("EndTask", 2, "fShutDown"); // WINBOOL
-	ADD_PARAM_NAME("EndTask", 3, "fForce"); // WINBOOL
-	ADD_PARAM_NAME("EndUpdateResourceA", 1, "hUpdate"); // HANDLE
-	ADD_PARAM_NAME("EndUpdateResourceA", 2, "fDiscard"); // WINBOOL
-	ADD_PARAM_NAME("EndUpdateResourceW", 1, "hUpdate"); // HANDLE
-	ADD_PARAM_NAME("EndUpdateResourceW", 2, "fDiscard"); // WINBOOL
-	ADD_PARAM_NAME("EnterCriticalSection", 1, "lpCriticalSection"); // LPCRITICAL_SECTION
-	ADD_PARAM_NAME("EnumCalendarInfoA", 1, "lpCalInfoEnumProc"); // CALINFO_ENUMPROCA
-	ADD_PARAM_NAME("EnumCalendarInfoA", 2, "Locale"); // LCID
-	ADD_PARAM_NAME("EnumCalendarInfoA", 3, "Calendar"); // CALID
-	ADD_PARAM_NAME("EnumCalendarInfoA", 4, "CalType"); // CALTYPE
-	ADD_PARAM_NAME("EnumCalendarInfoExA", 1, "lpCalInfoEnumProcEx"); // CALINFO_ENUMPROCEXA
-	ADD_PARAM_NAME("EnumCalendarInfoExA", 2, "Locale"); // LCID
-	ADD_PARAM_NAME("EnumCalendarInfoExA", 3, "Calendar"); // CALID
-	ADD_PARAM_NAME("EnumCalendarInfoExA", 4, "CalType"); // CALTYPE
-	ADD_PARAM_NAME("EnumCalendarInfoExEx", 1, "pCalInfoEnumProcExEx"); // CALINFO_ENUMPROCEXEX
-	ADD_PARAM_NAME("EnumCalendarInfoExEx", 2, "lpLocaleName"); // LPCWSTR
-	ADD_PARAM_NAME("EnumCalendarInfoExEx", 3, "Calendar"); // CALID
-	ADD_PARAM_NAME("EnumCalendarInfoExEx", 4, "lpReserved"); // LPCWSTR
-	ADD_PARAM_NAME("EnumCalendarInfoExEx", 5, "CalType"); // CALTYPE
-	ADD_PARAM_NAME("EnumCalendarInfoExEx", 6, "lParam"); // LPARAM
-	ADD_PARAM_NAME("EnumCalendarInfoExW", 1, "lpCalInfoEnumProcEx"); // CALINFO_ENUMPROCEXW
-	ADD_PARAM_NAME("EnumCalendarInfoExW", 2, "Locale"); // LCID
-	ADD_PARAM_NAME("EnumCalendarInfoExW", 3, "Calendar"); // CALID
-	ADD_PARAM_NAME("EnumCalendarInfoExW", 4, "CalType"); // CALTYPE
-	ADD_PARAM_NAME("EnumCalendarInfoW", 1, "lpCalInfoEnumProc"); // CALINFO_ENUMPROCW
-	ADD_PARAM_NAME("EnumCalendarInfoW", 2, "Locale"); // LCID
-	ADD_PARAM_NAME("EnumCalendarInfoW", 3, "Calendar"); // CALID
-	ADD_PARAM_NAME("EnumCalendarInfoW", 4, "CalType"); // CALTYPE
-	ADD_PARAM_NAME("EnumChildWindows", 1, "hWndParent"); // HWND
-	ADD_PARAM_NAME("EnumChildWindows", 2, "lpEnumFunc"); // WNDENUMPROC
-	ADD_PARAM_NAME("EnumChildWindows", 3, "lParam"); // LPARAM
-	ADD_PARAM_NAME("EnumClipboardFormats", 1, "format"); // UINT
-	ADD_PARAM_NAME("EnumDateFormatsA", 1, "lpDateFmtEnumProc"); // DATEFMT_ENUMPROCA
-	ADD_PARAM_NAME("EnumDateFormatsA", 2, "Locale"); // LCID
-	ADD_PARAM_NAME("EnumDateFormatsA", 3, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("EnumDateFormatsExA", 1, "lpDateFmtEnumProcEx"); // DATEFMT_ENUMPROCEXA
-	ADD_PARAM_NAME("EnumDateFormatsExA", 2, "Locale"); // LCID
-	ADD_PARAM_NAME("EnumDateFormatsExA", 3, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("EnumDateFormatsExEx", 1, "lpDateFmtEnumProcExEx"); // DATEFMT_ENUMPROCEXEX
-	ADD_PARAM_NAME("EnumDateFormatsExEx", 2, "lpLocaleName"); // LPCWSTR
-	ADD_PARAM_NAME("EnumDateFormatsExEx", 3, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("EnumDateFormatsExEx", 4, "lParam"); // LPARAM
-	ADD_PARAM_NAME("EnumDateFormatsExW", 1, "lpDateFmtEnumProcEx"); // DATEFMT_ENUMPROCEXW
-	ADD_PARAM_NAME("EnumDateFormatsExW", 2, "Locale"); // LCID
-	ADD_PARAM_NAME("EnumDateFormatsExW", 3, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("EnumDateFormatsW", 1, "lpDateFmtEnumProc"); // DATEFMT_ENUMPROCW
-	ADD_PARAM_NAME("EnumDateFormatsW", 2, "Locale"); // LCID
-	ADD_PARAM_NAME("EnumDateFormatsW", 3, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("EnumDependentServicesA", 1, "hService"); // SC_HANDLE
-	ADD_PARAM_NAME("EnumDependentServicesA", 2, "dwServiceState"); // DWORD
-	ADD_PARAM_NAME("EnumDependentServicesA", 3, "lpServices"); // LPENUM_SERVICE_STATUSA
-	ADD_PARAM_NAME("EnumDependentServicesA", 4, "cbBufSize"); // DWORD
-	ADD_PARAM_NAME("EnumDependentServicesA", 5, "pcbBytesNeeded"); // LPDWORD
-	ADD_PARAM_NAME("EnumDependentServicesA", 6, "lpServicesReturned"); // LPDWORD
-	ADD_PARAM_NAME("EnumDependentServicesW", 1, "hService"); // SC_HANDLE
-	ADD_PARAM_NAME("EnumDependentServicesW", 2, "dwServiceState"); // DWORD
-	ADD_PARAM_NAME("EnumDependentServicesW", 3, "lpServices"); // LPENUM_SERVICE_STATUSW
-	ADD_PARAM_NAME("EnumDependentServicesW", 4, "cbBufSize"); // DWORD
-	ADD_PARAM_NAME("EnumDependentServicesW", 5, "pcbBytesNeeded"); // LPDWORD
-	ADD_PARAM_NAME("EnumDependentServicesW", 6, "lpServicesReturned"); // LPDWORD
-	ADD_PARAM_NAME("EnumDesktopWindows", 1, "hDesktop"); // HDESK
-	ADD_PARAM_NAME("EnumDesktopWindows", 2, "lpfn"); // WNDENUMPROC
-	ADD_PARAM_NAME("EnumDesktopWindows", 3, "lParam"); // LPARAM
-	ADD_PARAM_NAME("EnumDesktopsA", 1, "hwinsta"); // HWINSTA
-	ADD_PARAM_NAME("EnumDesktopsA", 2, "lpEnumFunc"); // DESKTOPENUMPROCA
-	ADD_PARAM_NAME("EnumDesktopsA", 3, "lParam"); // LPARAM
-	ADD_PARAM_NAME("EnumDesktopsW", 1, "hwinsta"); // HWINSTA
-	ADD_PARAM_NAME("EnumDesktopsW", 2, "lpEnumFunc"); // DESKTOPENUMPROCW
-	ADD_PARAM_NAME("EnumDesktopsW", 3, "lParam"); // LPARAM
-	ADD_PARAM_NAME("EnumDisplayDevicesA", 1, "lpDevice"); // LPCSTR
-	ADD_PARAM_NAME("EnumDisplayDevicesA", 2, "iDevNum"); // DWORD
-	ADD_PARAM_NAME("EnumDisplayDevicesA", 3, "lpDisplayDevice"); // PDISPLAY_DEVICEA
-	ADD_PARAM_NAME("EnumDisplayDevicesA", 4, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("EnumDisplayDevicesW", 1, "lpDevice"); // LPCWSTR
-	ADD_PARAM_NAME("EnumDisplayDevicesW", 2, "iDevNum"); // DWORD
-	ADD_PARAM_NAME("EnumDisplayDevicesW", 3, "lpDisplayDevice"); // PDISPLAY_DEVICEW
-	ADD_PARAM_NAME("EnumDisplayDevicesW", 4, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("EnumDisplayMonitors", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("EnumDisplayMonitors", 2, "lprcClip"); // LPCRECT
-	ADD_PARAM_NAME("EnumDisplayMonitors", 3, "lpfnEnum"); // MONITORENUMPROC
-	ADD_PARAM_NAME("EnumDisplayMonitors", 4, "dwData"); // LPARAM
-	ADD_PARAM_NAME("EnumDisplaySettingsA", 1, "lpszDeviceName"); // LPCSTR
-	ADD_PARAM_NAME("EnumDisplaySettingsA", 2, "iModeNum"); // DWORD
-	ADD_PARAM_NAME("EnumDisplaySettingsA", 3, "lpDevMode"); // LPDEVMODEA
-	ADD_PARAM_NAME("EnumDisplaySettingsExA", 1, "lpszDeviceName"); // LPCSTR
-	ADD_PARAM_NAME("EnumDisplaySettingsExA", 2, "iModeNum"); // DWORD
-	ADD_PARAM_NAME("EnumDisplaySettingsExA", 3, "lpDevMode"); // LPDEVMODEA
-	ADD_PARAM_NAME("EnumDisplaySettingsExA", 4, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("EnumDisplaySettingsExW", 1, "lpszDeviceName"); // LPCWSTR
-	ADD_PARAM_NAME("EnumDisplaySettingsExW", 2, "iModeNum"); // DWORD
-	ADD_PARAM_NAME("EnumDisplaySettingsExW", 3, "lpDevMode"); // LPDEVMODEW
-	ADD_PARAM_NAME("EnumDisplaySettingsExW", 4, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("EnumDisplaySettingsW", 1, "lpszDeviceName"); // LPCWSTR
-	ADD_PARAM_NAME("EnumDisplaySettingsW", 2, "iModeNum"); // DWORD
-	ADD_PARAM_NAME("EnumDisplaySettingsW", 3, "lpDevMode"); // LPDEVMODEW
-	ADD_PARAM_NAME("EnumEnhMetaFile", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("EnumEnhMetaFile", 2, "hmf"); // HENHMETAFILE
-	ADD_PARAM_NAME("EnumEnhMetaFile", 3, "lpProc"); // ENHMFENUMPROC
-	ADD_PARAM_NAME("EnumEnhMetaFile", 4, "lpParam"); // LPVOID
-	ADD_PARAM_NAME("EnumEnhMetaFile", 5, "lpRect"); // CONST RECT *
-	ADD_PARAM_NAME("EnumFontFamiliesA", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("EnumFontFamiliesA", 2, "lpLogfont"); // LPCSTR
-	ADD_PARAM_NAME("EnumFontFamiliesA", 3, "lpProc"); // FONTENUMPROCA
-	ADD_PARAM_NAME("EnumFontFamiliesA", 4, "lParam"); // LPARAM
-	ADD_PARAM_NAME("EnumFontFamiliesExA", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("EnumFontFamiliesExA", 2, "lpLogfont"); // LPLOGFONTA
-	ADD_PARAM_NAME("EnumFontFamiliesExA", 3, "lpProc"); // FONTENUMPROCA
-	ADD_PARAM_NAME("EnumFontFamiliesExA", 4, "lParam"); // LPARAM
-	ADD_PARAM_NAME("EnumFontFamiliesExA", 5, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("EnumFontFamiliesExW", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("EnumFontFamiliesExW", 2, "lpLogfont"); // LPLOGFONTW
-	ADD_PARAM_NAME("EnumFontFamiliesExW", 3, "lpProc"); // FONTENUMPROCW
-	ADD_PARAM_NAME("EnumFontFamiliesExW", 4, "lParam"); // LPARAM
-	ADD_PARAM_NAME("EnumFontFamiliesExW", 5, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("EnumFontFamiliesW", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("EnumFontFamiliesW", 2, "lpLogfont"); // LPCWSTR
-	ADD_PARAM_NAME("EnumFontFamiliesW", 3, "lpProc"); // FONTENUMPROCW
-	ADD_PARAM_NAME("EnumFontFamiliesW", 4, "lParam"); // LPARAM
-	ADD_PARAM_NAME("EnumFontsA", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("EnumFontsA", 2, "lpLogfont"); // LPCSTR
-	ADD_PARAM_NAME("EnumFontsA", 3, "lpProc"); // FONTENUMPROCA
-	ADD_PARAM_NAME("EnumFontsA", 4, "lParam"); // LPARAM
-	ADD_PARAM_NAME("EnumFontsW", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("EnumFontsW", 2, "lpLogfont"); // LPCWSTR
-	ADD_PARAM_NAME("EnumFontsW", 3, "lpProc"); // FONTENUMPROCW
-	ADD_PARAM_NAME("EnumFontsW", 4, "lParam"); // LPARAM
-	ADD_PARAM_NAME("EnumFormsA", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("EnumFormsA", 2, "Level"); // DWORD
-	ADD_PARAM_NAME("EnumFormsA", 3, "pForm"); // LPBYTE
-	ADD_PARAM_NAME("EnumFormsA", 4, "cbBuf"); // DWORD
-	ADD_PARAM_NAME("EnumFormsA", 5, "pcbNeeded"); // LPDWORD
-	ADD_PARAM_NAME("EnumFormsA", 6, "pcReturned"); // LPDWORD
-	ADD_PARAM_NAME("EnumFormsW", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("EnumFormsW", 2, "Level"); // DWORD
-	ADD_PARAM_NAME("EnumFormsW", 3, "pForm"); // LPBYTE
-	ADD_PARAM_NAME("EnumFormsW", 4, "cbBuf"); // DWORD
-	ADD_PARAM_NAME("EnumFormsW", 5, "pcbNeeded"); // LPDWORD
-	ADD_PARAM_NAME("EnumFormsW", 6, "pcReturned"); // LPDWORD
-	ADD_PARAM_NAME("EnumICMProfilesA", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("EnumICMProfilesA", 2, "lpProc"); // ICMENUMPROCA
-	ADD_PARAM_NAME("EnumICMProfilesA", 3, "lParam"); // LPARAM
-	ADD_PARAM_NAME("EnumICMProfilesW", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("EnumICMProfilesW", 2, "lpProc"); // ICMENUMPROCW
-	ADD_PARAM_NAME("EnumICMProfilesW", 3, "lParam"); // LPARAM
-	ADD_PARAM_NAME("EnumJobsA", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("EnumJobsA", 2, "FirstJob"); // DWORD
-	ADD_PARAM_NAME("EnumJobsA", 3, "NoJobs"); // DWORD
-	ADD_PARAM_NAME("EnumJobsA", 4, "Level"); // DWORD
-	ADD_PARAM_NAME("EnumJobsA", 5, "pJob"); // LPBYTE
-	ADD_PARAM_NAME("EnumJobsA", 6, "cbBuf"); // DWORD
-	ADD_PARAM_NAME("EnumJobsA", 7, "pcbNeeded"); // LPDWORD
-	ADD_PARAM_NAME("EnumJobsA", 8, "pcReturned"); // LPDWORD
-	ADD_PARAM_NAME("EnumJobsW", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("EnumJobsW", 2, "FirstJob"); // DWORD
-	ADD_PARAM_NAME("EnumJobsW", 3, "NoJobs"); // DWORD
-	ADD_PARAM_NAME("EnumJobsW", 4, "Level"); // DWORD
-	ADD_PARAM_NAME("EnumJobsW", 5, "pJob"); // LPBYTE
-	ADD_PARAM_NAME("EnumJobsW", 6, "cbBuf"); // DWORD
-	ADD_PARAM_NAME("EnumJobsW", 7, "pcbNeeded"); // LPDWORD
-	ADD_PARAM_NAME("EnumJobsW", 8, "pcReturned"); // LPDWORD
-	ADD_PARAM_NAME("EnumLanguageGroupLocalesA", 1, "lpLangGroupLocaleEnumProc"); // LANGGROUPLOCALE_ENUMPROCA
-	ADD_PARAM_NAME("EnumLanguageGroupLocalesA", 2, "LanguageGroup"); // LGRPID
-	ADD_PARAM_NAME("EnumLanguageGroupLocalesA", 3, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("EnumLanguageGroupLocalesA", 4, "lParam"); // LONG_PTR
-	ADD_PARAM_NAME("EnumLanguageGroupLocalesW", 1, "lpLangGroupLocaleEnumProc"); // LANGGROUPLOCALE_ENUMPROCW
-	ADD_PARAM_NAME("EnumLanguageGroupLocalesW", 2, "LanguageGroup"); // LGRPID
-	ADD_PARAM_NAME("EnumLanguageGroupLocalesW", 3, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("EnumLanguageGroupLocalesW", 4, "lParam"); // LONG_PTR
-	ADD_PARAM_NAME("EnumMetaFile", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("EnumMetaFile", 2, "hmf"); // HMETAFILE
-	ADD_PARAM_NAME("EnumMetaFile", 3, "lpProc"); // MFENUMPROC
-	ADD_PARAM_NAME("EnumMetaFile", 4, "lParam"); // LPARAM
-	ADD_PARAM_NAME("EnumMonitorsA", 1, "pName"); // LPSTR
-	ADD_PARAM_NAME("EnumMonitorsA", 2, "Level"); // DWORD
-	ADD_PARAM_NAME("EnumMonitorsA", 3, "pMonitor"); // LPBYTE
-	ADD_PARAM_NAME("EnumMonitorsA", 4, "cbBuf"); // DWORD
-	ADD_PARAM_NAME("EnumMonitorsA", 5, "pcbNeeded"); // LPDWORD
-	ADD_PARAM_NAME("EnumMonitorsA", 6, "pcReturned"); // LPDWORD
-	ADD_PARAM_NAME("EnumMonitorsW", 1, "pName"); // LPWSTR
-	ADD_PARAM_NAME("EnumMonitorsW", 2, "Level"); // DWORD
-	ADD_PARAM_NAME("EnumMonitorsW", 3, "pMonitor"); // LPBYTE
-	ADD_PARAM_NAME("EnumMonitorsW", 4, "cbBuf"); // DWORD
-	ADD_PARAM_NAME("EnumMonitorsW", 5, "pcbNeeded"); // LPDWORD
-	ADD_PARAM_NAME("EnumMonitorsW", 6, "pcReturned"); // LPDWORD
-	ADD_PARAM_NAME("EnumObjects", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("EnumObjects", 2, "nType"); // int
-	ADD_PARAM_NAME("EnumObjects", 3, "lpFunc"); // GOBJENUMPROC
-	ADD_PARAM_NAME("EnumObjects", 4, "lParam"); // LPARAM
-	ADD_PARAM_NAME("EnumPortsA", 1, "pName"); // LPSTR
-	ADD_PARAM_NAME("EnumPortsA", 2, "Level"); // DWORD
-	ADD_PARAM_NAME("EnumPortsA", 3, "pPorts"); // LPBYTE
-	ADD_PARAM_NAME("EnumPortsA", 4, "cbBuf"); // DWORD
-	ADD_PARAM_NAME("EnumPortsA", 5, "pcbNeeded"); // LPDWORD
-	ADD_PARAM_NAME("EnumPortsA", 6, "pcReturned"); // LPDWORD
-	ADD_PARAM_NAME("EnumPortsW", 1, "pName"); // LPWSTR
-	ADD_PARAM_NAME("EnumPortsW", 2, "Level"); // DWORD
-	ADD_PARAM_NAME("EnumPortsW", 3, "pPorts"); // LPBYTE
-	ADD_PARAM_NAME("EnumPortsW", 4, "cbBuf"); // DWORD
-	ADD_PARAM_NAME("EnumPortsW", 5, "pcbNeeded"); // LPDWORD
-	ADD_PARAM_NAME("EnumPortsW", 6, "pcReturned"); // LPDWORD
-	ADD_PARAM_NAME("EnumPrintProcessorDatatypesA", 1, "pName"); // LPSTR
-	ADD_PARAM_NAME("EnumPrintProcessorDatatypesA", 2, "pPrintProcessorName"); // LPSTR
-	ADD_PARAM_NAME("EnumPrintProcessorDatatypesA", 3, "Level"); // DWORD
-	ADD_PARAM_NAME("EnumPrintProcessorDatatypesA", 4, "pDatatypes"); // LPBYTE
-	ADD_PARAM_NAME("EnumPrintProcessorDatatypesA", 5, "cbBuf"); // DWORD
-	ADD_PARAM_NAME("EnumPrintProcessorDatatypesA", 6, "pcbNeeded"); // LPDWORD
-	ADD_PARAM_NAME("EnumPrintProcessorDatatypesA", 7, "pcReturned"); // LPDWORD
-	ADD_PARAM_NAME("EnumPrintProcessorDatatypesW", 1, "pName"); // LPWSTR
-	ADD_PARAM_NAME("EnumPrintProcessorDatatypesW", 2, "pPrintProcessorName"); // LPWSTR
-	ADD_PARAM_NAME("EnumPrintProcessorDatatypesW", 3, "Level"); // DWORD
-	ADD_PARAM_NAME("EnumPrintProcessorDatatypesW", 4, "pDatatypes"); // LPBYTE
-	ADD_PARAM_NAME("EnumPrintProcessorDatatypesW", 5, "cbBuf"); // DWORD
-	ADD_PARAM_NAME("EnumPrintProcessorDatatypesW", 6, "pcbNeeded"); // LPDWORD
-	ADD_PARAM_NAME("EnumPrintProcessorDatatypesW", 7, "pcReturned"); // LPDWORD
-	ADD_PARAM_NAME("EnumPrintProcessorsA", 1, "pName"); // LPSTR
-	ADD_PARAM_NAME("EnumPrintProcessorsA", 2, "pEnvironment"); // LPSTR
-	ADD_PARAM_NAME("EnumPrintProcessorsA", 3, "Level"); // DWORD
-	ADD_PARAM_NAME("EnumPrintProcessorsA", 4, "pPrintProcessorInfo"); // LPBYTE
-	ADD_PARAM_NAME("EnumPrintProcessorsA", 5, "cbBuf"); // DWORD
-	ADD_PARAM_NAME("EnumPrintProcessorsA", 6, "pcbNeeded"); // LPDWORD
-	ADD_PARAM_NAME("EnumPrintProcessorsA", 7, "pcReturned"); // LPDWORD
-	ADD_PARAM_NAME("EnumPrintProcessorsW", 1, "pName"); // LPWSTR
-	ADD_PARAM_NAME("EnumPrintProcessorsW", 2, "pEnvironment"); // LPWSTR
-	ADD_PARAM_NAME("EnumPrintProcessorsW", 3, "Level"); // DWORD
-	ADD_PARAM_NAME("EnumPrintProcessorsW", 4, "pPrintProcessorInfo"); // LPBYTE
-	ADD_PARAM_NAME("EnumPrintProcessorsW", 5, "cbBuf"); // DWORD
-	ADD_PARAM_NAME("EnumPrintProcessorsW", 6, "pcbNeeded"); // LPDWORD
-	ADD_PARAM_NAME("EnumPrintProcessorsW", 7, "pcReturned"); // LPDWORD
-	ADD_PARAM_NAME("EnumPrinterDataA", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("EnumPrinterDataA", 2, "dwIndex"); // DWORD
-	ADD_PARAM_NAME("EnumPrinterDataA", 3, "pValueName"); // LPSTR
-	ADD_PARAM_NAME("EnumPrinterDataA", 4, "cbValueName"); // DWORD
-	ADD_PARAM_NAME("EnumPrinterDataA", 5, "pcbValueName"); // LPDWORD
-	ADD_PARAM_NAME("EnumPrinterDataA", 6, "pType"); // LPDWORD
-	ADD_PARAM_NAME("EnumPrinterDataA", 7, "pData"); // LPBYTE
-	ADD_PARAM_NAME("EnumPrinterDataA", 8, "cbData"); // DWORD
-	ADD_PARAM_NAME("EnumPrinterDataA", 9, "pcbData"); // LPDWORD
-	ADD_PARAM_NAME("EnumPrinterDataExA", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("EnumPrinterDataExA", 2, "pKeyName"); // LPCSTR
-	ADD_PARAM_NAME("EnumPrinterDataExA", 3, "pEnumValues"); // LPBYTE
-	ADD_PARAM_NAME("EnumPrinterDataExA", 4, "cbEnumValues"); // DWORD
-	ADD_PARAM_NAME("EnumPrinterDataExA", 5, "pcbEnumValues"); // LPDWORD
-	ADD_PARAM_NAME("EnumPrinterDataExA", 6, "pnEnumValues"); // LPDWORD
-	ADD_PARAM_NAME("EnumPrinterDataExW", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("EnumPrinterDataExW", 2, "pKeyName"); // LPCWSTR
-	ADD_PARAM_NAME("EnumPrinterDataExW", 3, "pEnumValues"); // LPBYTE
-	ADD_PARAM_NAME("EnumPrinterDataExW", 4, "cbEnumValues"); // DWORD
-	ADD_PARAM_NAME("EnumPrinterDataExW", 5, "pcbEnumValues"); // LPDWORD
-	ADD_PARAM_NAME("EnumPrinterDataExW", 6, "pnEnumValues"); // LPDWORD
-	ADD_PARAM_NAME("EnumPrinterDataW", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("EnumPrinterDataW", 2, "dwIndex"); // DWORD
-	ADD_PARAM_NAME("EnumPrinterDataW", 3, "pValueName"); // LPWSTR
-	ADD_PARAM_NAME("EnumPrinterDataW", 4, "cbValueName"); // DWORD
-	ADD_PARAM_NAME("EnumPrinterDataW", 5, "pcbValueName"); // LPDWORD
-	ADD_PARAM_NAME("EnumPrinterDataW", 6, "pType"); // LPDWORD
-	ADD_PARAM_NAME("EnumPrinterDataW", 7, "pData"); // LPBYTE
-	ADD_PARAM_NAME("EnumPrinterDataW", 8, "cbData"); // DWORD
-	ADD_PARAM_NAME("EnumPrinterDataW", 9, "pcbData"); // LPDWORD
-	ADD_PARAM_NAME("EnumPrinterDriversA", 1, "pName"); // LPSTR
-	ADD_PARAM_NAME("EnumPrinterDriversA", 2, "pEnvironment"); // LPSTR
-	ADD_PARAM_NAME("EnumPrinterDriversA", 3, "Level"); // DWORD
-	ADD_PARAM_NAME("EnumPrinterDriversA", 4, "pDriverInfo"); // LPBYTE
-	ADD_PARAM_NAME("EnumPrinterDriversA", 5, "cbBuf"); // DWORD
-	ADD_PARAM_NAME("EnumPrinterDriversA", 6, "pcbNeeded"); // LPDWORD
-	ADD_PARAM_NAME("EnumPrinterDriversA", 7, "pcReturned"); // LPDWORD
-	ADD_PARAM_NAME("EnumPrinterDriversW", 1, "pName"); // LPWSTR
-	ADD_PARAM_NAME("EnumPrinterDriversW", 2, "pEnvironment"); // LPWSTR
-	ADD_PARAM_NAME("EnumPrinterDriversW", 3, "Level"); // DWORD
-	ADD_PARAM_NAME("EnumPrinterDriversW", 4, "pDriverInfo"); // LPBYTE
-	ADD_PARAM_NAME("EnumPrinterDriversW", 5, "cbBuf"); // DWORD
-	ADD_PARAM_NAME("EnumPrinterDriversW", 6, "pcbNeeded"); // LPDWORD
-	ADD_PARAM_NAME("EnumPrinterDriversW", 7, "pcReturned"); // LPDWORD
-	ADD_PARAM_NAME("EnumPrinterKeyA", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("EnumPrinterKeyA", 2, "pKeyName"); // LPCSTR
-	ADD_PARAM_NAME("EnumPrinterKeyA", 3, "pSubkey"); // LPSTR
-	ADD_PARAM_NAME("EnumPrinterKeyA", 4, "cbSubkey"); // DWORD
-	ADD_PARAM_NAME("EnumPrinterKeyA", 5, "pcbSubkey"); // LPDWORD
-	ADD_PARAM_NAME("EnumPrinterKeyW", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("EnumPrinterKeyW", 2, "pKeyName"); // LPCWSTR
-	ADD_PARAM_NAME("EnumPrinterKeyW", 3, "pSubkey"); // LPWSTR
-	ADD_PARAM_NAME("EnumPrinterKeyW", 4, "cbSubkey"); // DWORD
-	ADD_PARAM_NAME("EnumPrinterKeyW", 5, "pcbSubkey"); // LPDWORD
-	ADD_PARAM_NAME("EnumPrintersA", 1, "Flags"); // DWORD
-	ADD_PARAM_NAME("EnumPrintersA", 2, "Name"); // LPSTR
-	ADD_PARAM_NAME("EnumPrintersA", 3, "Level"); // DWORD
-	ADD_PARAM_NAME("EnumPrintersA", 4, "pPrinterEnum"); // LPBYTE
-	ADD_PARAM_NAME("EnumPrintersA", 5, "cbBuf"); // DWORD
-	ADD_PARAM_NAME("EnumPrintersA", 6, "pcbNeeded"); // LPDWORD
-	ADD_PARAM_NAME("EnumPrintersA", 7, "pcReturned"); // LPDWORD
-	ADD_PARAM_NAME("EnumPrintersW", 1, "Flags"); // DWORD
-	ADD_PARAM_NAME("EnumPrintersW", 2, "Name"); // LPWSTR
-	ADD_PARAM_NAME("EnumPrintersW", 3, "Level"); // DWORD
-	ADD_PARAM_NAME("EnumPrintersW", 4, "pPrinterEnum"); // LPBYTE
-	ADD_PARAM_NAME("EnumPrintersW", 5, "cbBuf"); // DWORD
-	ADD_PARAM_NAME("EnumPrintersW", 6, "pcbNeeded"); // LPDWORD
-	ADD_PARAM_NAME("EnumPrintersW", 7, "pcReturned"); // LPDWORD
-	ADD_PARAM_NAME("EnumPropsA", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("EnumPropsA", 2, "lpEnumFunc"); // PROPENUMPROCA
-	ADD_PARAM_NAME("EnumPropsExA", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("EnumPropsExA", 2, "lpEnumFunc"); // PROPENUMPROCEXA
-	ADD_PARAM_NAME("EnumPropsExA", 3, "lParam"); // LPARAM
-	ADD_PARAM_NAME("EnumPropsExW", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("EnumPropsExW", 2, "lpEnumFunc"); // PROPENUMPROCEXW
-	ADD_PARAM_NAME("EnumPropsExW", 3, "lParam"); // LPARAM
-	ADD_PARAM_NAME("EnumPropsW", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("EnumPropsW", 2, "lpEnumFunc"); // PROPENUMPROCW
-	ADD_PARAM_NAME("EnumResourceLanguagesA", 1, "hModule"); // HMODULE
-	ADD_PARAM_NAME("EnumResourceLanguagesA", 2, "lpType"); // LPCSTR
-	ADD_PARAM_NAME("EnumResourceLanguagesA", 3, "lpName"); // LPCSTR
-	ADD_PARAM_NAME("EnumResourceLanguagesA", 4, "lpEnumFunc"); // ENUMRESLANGPROCA
-	ADD_PARAM_NAME("EnumResourceLanguagesA", 5, "lParam"); // LONG_PTR
-	ADD_PARAM_NAME("EnumResourceLanguagesW", 1, "hModule"); // HMODULE
-	ADD_PARAM_NAME("EnumResourceLanguagesW", 2, "lpType"); // LPCWSTR
-	ADD_PARAM_NAME("EnumResourceLanguagesW", 3, "lpName"); // LPCWSTR
-	ADD_PARAM_NAME("EnumResourceLanguagesW", 4, "lpEnumFunc"); // ENUMRESLANGPROCW
-	ADD_PARAM_NAME("EnumResourceLanguagesW", 5, "lParam"); // LONG_PTR
-	ADD_PARAM_NAME("EnumResourceNamesA", 1, "hModule"); // HMODULE
-	ADD_PARAM_NAME("EnumResourceNamesA", 2, "lpType"); // LPCSTR
-	ADD_PARAM_NAME("EnumResourceNamesA", 3, "lpEnumFunc"); // ENUMRESNAMEPROCA
-	ADD_PARAM_NAME("EnumResourceNamesA", 4, "lParam"); // LONG_PTR
-	ADD_PARAM_NAME("EnumResourceNamesW", 1, "hModule"); // HMODULE
-	ADD_PARAM_NAME("EnumResourceNamesW", 2, "lpType"); // LPCWSTR
-	ADD_PARAM_NAME("EnumResourceNamesW", 3, "lpEnumFunc"); // ENUMRESNAMEPROCW
-	ADD_PARAM_NAME("EnumResourceNamesW", 4, "lParam"); // LONG_PTR
-	ADD_PARAM_NAME("EnumResourceTypesA", 1, "hModule"); // HMODULE
-	ADD_PARAM_NAME("EnumResourceTypesA", 2, "lpEnumFunc"); // ENUMRESTYPEPROCA
-	ADD_PARAM_NAME("EnumResourceTypesA", 3, "lParam"); // LONG_PTR
-	ADD_PARAM_NAME("EnumResourceTypesW", 1, "hModule"); // HMODULE
-	ADD_PARAM_NAME("EnumResourceTypesW", 2, "lpEnumFunc"); // ENUMRESTYPEPROCW
-	ADD_PARAM_NAME("EnumResourceTypesW", 3, "lParam"); // LONG_PTR
-	ADD_PARAM_NAME("EnumServicesStatusA", 1, "hSCManager"); // SC_HANDLE
-	ADD_PARAM_NAME("EnumServicesStatusA", 2, "dwServiceType"); // DWORD
-	ADD_PARAM_NAME("EnumServicesStatusA", 3, "dwServiceState"); // DWORD
-	ADD_PARAM_NAME("EnumServicesStatusA", 4, "lpServices"); // LPENUM_SERVICE_STATUSA
-	ADD_PARAM_NAME("EnumServicesStatusA", 5, "cbBufSize"); // DWORD
-	ADD_PARAM_NAME("EnumServicesStatusA", 6, "pcbBytesNeeded"); // LPDWORD
-	ADD_PARAM_NAME("EnumServicesStatusA", 7, "lpServicesReturned"); // LPDWORD
-	ADD_PARAM_NAME("EnumServicesStatusA", 8, "lpResumeHandle"); // LPDWORD
-	ADD_PARAM_NAME("EnumServicesStatusExA", 1, "hSCManager"); // SC_HANDLE
-	ADD_PARAM_NAME("EnumServicesStatusExA", 2, "InfoLevel"); // SC_ENUM_TYPE
-	ADD_PARAM_NAME("EnumServicesStatusExA", 3, "dwServiceType"); // DWORD
-	ADD_PARAM_NAME("EnumServicesStatusExA", 4, "dwServiceState"); // DWORD
-	ADD_PARAM_NAME("EnumServicesStatusExA", 5, "lpServices"); // LPBYTE
-	ADD_PARAM_NAME("EnumServicesStatusExA", 6, "cbBufSize"); // DWORD
-	ADD_PARAM_NAME("EnumServicesStatusExA", 7, "pcbBytesNeeded"); // LPDWORD
-	ADD_PARAM_NAME("EnumServicesStatusExA", 8, "lpServicesReturned"); // LPDWORD
-	ADD_PARAM_NAME("EnumServicesStatusExA", 9, "lpResumeHandle"); // LPDWORD
-	ADD_PARAM_NAME("EnumServicesStatusExA", 10, "pszGroupName"); // LPCSTR
-	ADD_PARAM_NAME("EnumServicesStatusExW", 1, "hSCManager"); // SC_HANDLE
-	ADD_PARAM_NAME("EnumServicesStatusExW", 2, "InfoLevel"); // SC_ENUM_TYPE
-	ADD_PARAM_NAME("EnumServicesStatusExW", 3, "dwServiceType"); // DWORD
-	ADD_PARAM_NAME("EnumServicesStatusExW", 4, "dwServiceState"); // DWORD
-	ADD_PARAM_NAME("EnumServicesStatusExW", 5, "lpServices"); // LPBYTE
-	ADD_PARAM_NAME("EnumServicesStatusExW", 6, "cbBufSize"); // DWORD
-	ADD_PARAM_NAME("EnumServicesStatusExW", 7, "pcbBytesNeeded"); // LPDWORD
-	ADD_PARAM_NAME("EnumServicesStatusExW", 8, "lpServicesReturned"); // LPDWORD
-	ADD_PARAM_NAME("EnumServicesStatusExW", 9, "lpResumeHandle"); // LPDWORD
-	ADD_PARAM_NAME("EnumServicesStatusExW", 10, "pszGroupName"); // LPCWSTR
-	ADD_PARAM_NAME("EnumServicesStatusW", 1, "hSCManager"); // SC_HANDLE
-	ADD_PARAM_NAME("EnumServicesStatusW", 2, "dwServiceType"); // DWORD
-	ADD_PARAM_NAME("EnumServicesStatusW", 3, "dwServiceState"); // DWORD
-	ADD_PARAM_NAME("EnumServicesStatusW", 4, "lpServices"); // LPENUM_SERVICE_STATUSW
-	ADD_PARAM_NAME("EnumServicesStatusW", 5, "cbBufSize"); // DWORD
-	ADD_PARAM_NAME("EnumServicesStatusW", 6, "pcbBytesNeeded"); // LPDWORD
-	ADD_PARAM_NAME("EnumServicesStatusW", 7, "lpServicesReturned"); // LPDWORD
-	ADD_PARAM_NAME("EnumServicesStatusW", 8, "lpResumeHandle"); // LPDWORD
-	ADD_PARAM_NAME("EnumSystemCodePagesA", 1, "lpCodePageEnumProc"); // CODEPAGE_ENUMPROCA
-	ADD_PARAM_NAME("EnumSystemCodePagesA", 2, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("EnumSystemCodePagesW", 1, "lpCodePageEnumProc"); // CODEPAGE_ENUMPROCW
-	ADD_PARAM_NAME("EnumSystemCodePagesW", 2, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("EnumSystemFirmwareTables", 1, "FirmwareTableProviderSignature"); // DWORD
-	ADD_PARAM_NAME("EnumSystemFirmwareTables", 2, "pFirmwareTableEnumBuffer"); // PVOID
-	ADD_PARAM_NAME("EnumSystemFirmwareTables", 3, "BufferSize"); // DWORD
-	ADD_PARAM_NAME("EnumSystemGeoID", 1, "GeoClass"); // GEOCLASS
-	ADD_PARAM_NAME("EnumSystemGeoID", 2, "ParentGeoId"); // GEOID
-	ADD_PARAM_NAME("EnumSystemGeoID", 3, "lpGeoEnumProc"); // GEO_ENUMPROC
-	ADD_PARAM_NAME("EnumSystemLanguageGroupsA", 1, "lpLanguageGroupEnumProc"); // LANGUAGEGROUP_ENUMPROCA
-	ADD_PARAM_NAME("EnumSystemLanguageGroupsA", 2, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("EnumSystemLanguageGroupsA", 3, "lParam"); // LONG_PTR
-	ADD_PARAM_NAME("EnumSystemLanguageGroupsW", 1, "lpLanguageGroupEnumProc"); // LANGUAGEGROUP_ENUMPROCW
-	ADD_PARAM_NAME("EnumSystemLanguageGroupsW", 2, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("EnumSystemLanguageGroupsW", 3, "lParam"); // LONG_PTR
-	ADD_PARAM_NAME("EnumSystemLocalesA", 1, "lpLocaleEnumProc"); // LOCALE_ENUMPROCA
-	ADD_PARAM_NAME("EnumSystemLocalesA", 2, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("EnumSystemLocalesEx", 1, "lpLocaleEnumProcEx"); // LOCALE_ENUMPROCEX
-	ADD_PARAM_NAME("EnumSystemLocalesEx", 2, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("EnumSystemLocalesEx", 3, "lParam"); // LPARAM
-	ADD_PARAM_NAME("EnumSystemLocalesEx", 4, "lpReserved"); // LPVOID
-	ADD_PARAM_NAME("EnumSystemLocalesW", 1, "lpLocaleEnumProc"); // LOCALE_ENUMPROCW
-	ADD_PARAM_NAME("EnumSystemLocalesW", 2, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("EnumThreadWindows", 1, "dwThreadId"); // DWORD
-	ADD_PARAM_NAME("EnumThreadWindows", 2, "lpfn"); // WNDENUMPROC
-	ADD_PARAM_NAME("EnumThreadWindows", 3, "lParam"); // LPARAM
-	ADD_PARAM_NAME("EnumTimeFormatsA", 1, "lpTimeFmtEnumProc"); // TIMEFMT_ENUMPROCA
-	ADD_PARAM_NAME("EnumTimeFormatsA", 2, "Locale"); // LCID
-	ADD_PARAM_NAME("EnumTimeFormatsA", 3, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("EnumTimeFormatsEx", 1, "lpTimeFmtEnumProcEx"); // TIMEFMT_ENUMPROCEX
-	ADD_PARAM_NAME("EnumTimeFormatsEx", 2, "lpLocaleName"); // LPCWSTR
-	ADD_PARAM_NAME("EnumTimeFormatsEx", 3, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("EnumTimeFormatsEx", 4, "lParam"); // LPARAM
-	ADD_PARAM_NAME("EnumTimeFormatsW", 1, "lpTimeFmtEnumProc"); // TIMEFMT_ENUMPROCW
-	ADD_PARAM_NAME("EnumTimeFormatsW", 2, "Locale"); // LCID
-	ADD_PARAM_NAME("EnumTimeFormatsW", 3, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("EnumUILanguagesA", 1, "lpUILanguageEnumProc"); // UILANGUAGE_ENUMPROCA
-	ADD_PARAM_NAME("EnumUILanguagesA", 2, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("EnumUILanguagesA", 3, "lParam"); // LONG_PTR
-	ADD_PARAM_NAME("EnumUILanguagesW", 1, "lpUILanguageEnumProc"); // UILANGUAGE_ENUMPROCW
-	ADD_PARAM_NAME("EnumUILanguagesW", 2, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("EnumUILanguagesW", 3, "lParam"); // LONG_PTR
-	ADD_PARAM_NAME("EnumWindowStationsA", 1, "lpEnumFunc"); // WINSTAENUMPROCA
-	ADD_PARAM_NAME("EnumWindowStationsA", 2, "lParam"); // LPARAM
-	ADD_PARAM_NAME("EnumWindowStationsW", 1, "lpEnumFunc"); // WINSTAENUMPROCW
-	ADD_PARAM_NAME("EnumWindowStationsW", 2, "lParam"); // LPARAM
-	ADD_PARAM_NAME("EnumWindows", 1, "lpEnumFunc"); // WNDENUMPROC
-	ADD_PARAM_NAME("EnumWindows", 2, "lParam"); // LPARAM
-	ADD_PARAM_NAME("EqualDomainSid", 1, "pSid1"); // PSID
-	ADD_PARAM_NAME("EqualDomainSid", 2, "pSid2"); // PSID
-	ADD_PARAM_NAME("EqualDomainSid", 3, "pfEqual"); // WINBOOL *
-	ADD_PARAM_NAME("EqualPrefixSid", 1, "pSid1"); // PSID
-	ADD_PARAM_NAME("EqualPrefixSid", 2, "pSid2"); // PSID
-	ADD_PARAM_NAME("EqualRect", 1, "lprc1"); // CONST RECT *
-	ADD_PARAM_NAME("EqualRect", 2, "lprc2"); // CONST RECT *
-	ADD_PARAM_NAME("EqualRgn", 1, "hrgn1"); // HRGN
-	ADD_PARAM_NAME("EqualRgn", 2, "hrgn2"); // HRGN
-	ADD_PARAM_NAME("EqualSid", 1, "pSid1"); // PSID
-	ADD_PARAM_NAME("EqualSid", 2, "pSid2"); // PSID
-	ADD_PARAM_NAME("EraseTape", 1, "hDevice"); // HANDLE
-	ADD_PARAM_NAME("EraseTape", 2, "dwEraseType"); // DWORD
-	ADD_PARAM_NAME("EraseTape", 3, "bImmediate"); // WINBOOL
-	ADD_PARAM_NAME("Escape", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("Escape", 2, "iEscape"); // int
-	ADD_PARAM_NAME("Escape", 3, "cjIn"); // int
-	ADD_PARAM_NAME("Escape", 4, "pvIn"); // LPCSTR
-	ADD_PARAM_NAME("Escape", 5, "pvOut"); // LPVOID
-	ADD_PARAM_NAME("EscapeCommFunction", 1, "hFile"); // HANDLE
-	ADD_PARAM_NAME("EscapeCommFunction", 2, "dwFunc"); // DWORD
-	ADD_PARAM_NAME("EvtArchiveExportedLog", 1, "Session"); // EVT_HANDLE
-	ADD_PARAM_NAME("EvtArchiveExportedLog", 2, "LogFilePath"); // LPCWSTR
-	ADD_PARAM_NAME("EvtArchiveExportedLog", 3, "Locale"); // LCID
-	ADD_PARAM_NAME("EvtArchiveExportedLog", 4, "Flags"); // DWORD
-	ADD_PARAM_NAME("EvtCancel", 1, "Object"); // EVT_HANDLE
-	ADD_PARAM_NAME("EvtClearLog", 1, "Session"); // EVT_HANDLE
-	ADD_PARAM_NAME("EvtClearLog", 2, "ChannelPath"); // LPCWSTR
-	ADD_PARAM_NAME("EvtClearLog", 3, "TargetFilePath"); // LPCWSTR
-	ADD_PARAM_NAME("EvtClearLog", 4, "Flags"); // DWORD
-	ADD_PARAM_NAME("EvtClose", 1, "Object"); // EVT_HANDLE
-	ADD_PARAM_NAME("EvtCreateBookmark", 1, "BookmarkXml"); // LPCWSTR
-	ADD_PARAM_NAME("EvtCreateRenderContext", 1, "ValuePathsCount"); // DWORD
-	ADD_PARAM_NAME("EvtCreateRenderContext", 2, "ValuePaths"); // LPCWSTR *
-	ADD_PARAM_NAME("EvtCreateRenderContext", 3, "Flags"); // DWORD
-	ADD_PARAM_NAME("EvtExportLog", 1, "Session"); // EVT_HANDLE
-	ADD_PARAM_NAME("EvtExportLog", 2, "Path"); // LPCWSTR
-	ADD_PARAM_NAME("EvtExportLog", 3, "Query"); // LPCWSTR
-	ADD_PARAM_NAME("EvtExportLog", 4, "TargetFilePath"); // LPCWSTR
-	ADD_PARAM_NAME("EvtExportLog", 5, "Flags"); // DWORD
-	ADD_PARAM_NAME("EvtFormatMessage", 1, "PublisherMetadata"); // EVT_HANDLE
-	ADD_PARAM_NAME("EvtFormatMessage", 2, "Event"); // EVT_HANDLE
-	ADD_PARAM_NAME("EvtFormatMessage", 3, "MessageId"); // DWORD
-	ADD_PARAM_NAME("EvtFormatMessage", 4, "ValueCount"); // DWORD
-	ADD_PARAM_NAME("EvtFormatMessage", 5, "Values"); // PEVT_VARIANT
-	ADD_PARAM_NAME("EvtFormatMessage", 6, "Flags"); // DWORD
-	ADD_PARAM_NAME("EvtFormatMessage", 7, "BufferSize"); // DWORD
-	ADD_PARAM_NAME("EvtFormatMessage", 8, "Buffer"); // LPWSTR
-	ADD_PARAM_NAME("EvtFormatMessage", 9, "BufferUsed"); // PDWORD
-	ADD_PARAM_NAME("EvtGetChannelConfigProperty", 1, "ChannelConfig"); // EVT_HANDLE
-	ADD_PARAM_NAME("EvtGetChannelConfigProperty", 2, "PropertyId"); // EVT_CHANNEL_CONFIG_PROPERTY_ID
-	ADD_PARAM_NAME("EvtGetChannelConfigProperty", 3, "Flags"); // DWORD
-	ADD_PARAM_NAME("EvtGetChannelConfigProperty", 4, "PropertyValueBufferSize"); // DWORD
-	ADD_PARAM_NAME("EvtGetChannelConfigProperty", 5, "PropertyValueBuffer"); // PEVT_VARIANT
-	ADD_PARAM_NAME("EvtGetChannelConfigProperty", 6, "PropertyValueBufferUsed"); // PDWORD
-	ADD_PARAM_NAME("EvtGetEventInfo", 1, "Event"); // EVT_HANDLE
-	ADD_PARAM_NAME("EvtGetEventInfo", 2, "PropertyId"); // EVT_EVENT_PROPERTY_ID
-	ADD_PARAM_NAME("EvtGetEventInfo", 3, "PropertyValueBufferSize"); // DWORD
-	ADD_PARAM_NAME("EvtGetEventInfo", 4, "PropertyValueBuffer"); // PEVT_VARIANT
-	ADD_PARAM_NAME("EvtGetEventInfo", 5, "PropertyValueBufferUsed"); // PDWORD
-	ADD_PARAM_NAME("EvtGetEventMetadataProperty", 1, "EventMetadata"); // EVT_HANDLE
-	ADD_PARAM_NAME("EvtGetEventMetadataProperty", 2, "PropertyId"); // EVT_EVENT_METADATA_PROPERTY_ID
-	ADD_PARAM_NAME("EvtGetEventMetadataProperty", 3, "Flags"); // DWORD
-	ADD_PARAM_NAME("EvtGetEventMetadataProperty", 4, "EventMetadataPropertyBufferSize"); // DWORD
-	ADD_PARAM_NAME("EvtGetEventMetadataProperty", 5, "EventMetadataPropertyBuffer"); // PEVT_VARIANT
-	ADD_PARAM_NAME("EvtGetEventMetadataProperty", 6, "EventMetadataPropertyBufferUsed"); // PDWORD
-	ADD_PARAM_NAME("EvtGetExtendedStatus", 1, "BufferSize"); // DWORD
-	ADD_PARAM_NAME("EvtGetExtendedStatus", 2, "Buffer"); // LPWSTR
-	ADD_PARAM_NAME("EvtGetExtendedStatus", 3, "BufferUsed"); // PDWORD
-	ADD_PARAM_NAME("EvtGetLogInfo", 1, "Log"); // EVT_HANDLE
-	ADD_PARAM_NAME("EvtGetLogInfo", 2, "PropertyId"); // EVT_LOG_PROPERTY_ID
-	ADD_PARAM_NAME("EvtGetLogInfo", 3, "PropertyValueBufferSize"); // DWORD
-	ADD_PARAM_NAME("EvtGetLogInfo", 4, "PropertyValueBuffer"); // PEVT_VARIANT
-	ADD_PARAM_NAME("EvtGetLogInfo", 5, "PropertyValueBufferUsed"); // PDWORD
-	ADD_PARAM_NAME("EvtGetObjectArrayProperty", 1, "ObjectArray"); // EVT_OBJECT_ARRAY_PROPERTY_HANDLE
-	ADD_PARAM_NAME("EvtGetObjectArrayProperty", 2, "PropertyId"); // DWORD
-	ADD_PARAM_NAME("EvtGetObjectArrayProperty", 3, "ArrayIndex"); // DWORD
-	ADD_PARAM_NAME("EvtGetObjectArrayProperty", 4, "Flags"); // DWORD
-	ADD_PARAM_NAME("EvtGetObjectArrayProperty", 5, "PropertyValueBufferSize"); // DWORD
-	ADD_PARAM_NAME("EvtGetObjectArrayProperty", 6, "PropertyValueBuffer"); // PEVT_VARIANT
-	ADD_PARAM_NAME("EvtGetObjectArrayProperty", 7, "PropertyValueBufferUsed"); // PDWORD
-	ADD_PARAM_NAME("EvtGetObjectArraySize", 1, "ObjectArray"); // EVT_OBJECT_ARRAY_PROPERTY_HANDLE
-	ADD_PARAM_NAME("EvtGetObjectArraySize", 2, "ObjectArraySize"); // PDWORD
-	ADD_PARAM_NAME("EvtGetPublisherMetadataProperty", 1, "PublisherMetadata"); // EVT_HANDLE
-	ADD_PARAM_NAME("EvtGetPublisherMetadataProperty", 2, "PropertyId"); // EVT_PUBLISHER_METADATA_PROPERTY_ID
-	ADD_PARAM_NAME("EvtGetPublisherMetadataProperty", 3, "Flags"); // DWORD
-	ADD_PARAM_NAME("EvtGetPublisherMetadataProperty", 4, "PublisherMetadataPropertyBufferSize"); // DWORD
-	ADD_PARAM_NAME("EvtGetPublisherMetadataProperty", 5, "PublisherMetadataPropertyBuffer"); // PEVT_VARIANT
-	ADD_PARAM_NAME("EvtGetPublisherMetadataProperty", 6, "PublisherMetadataPropertyBufferUsed"); // PDWORD
-	ADD_PARAM_NAME("EvtGetQueryInfo", 1, "QueryOrSubscription"); // EVT_HANDLE
-	ADD_PARAM_NAME("EvtGetQueryInfo", 2, "PropertyId"); // EVT_QUERY_PROPERTY_ID
-	ADD_PARAM_NAME("EvtGetQueryInfo", 3, "PropertyValueBufferSize"); // DWORD
-	ADD_PARAM_NAME("EvtGetQueryInfo", 4, "PropertyValueBuffer"); // PEVT_VARIANT
-	ADD_PARAM_NAME("EvtGetQueryInfo", 5, "PropertyValueBufferUsed"); // PDWORD
-	ADD_PARAM_NAME("EvtNext", 1, "ResultSet"); // EVT_HANDLE
-	ADD_PARAM_NAME("EvtNext", 2, "EventArraySize"); // DWORD
-	ADD_PARAM_NAME("EvtNext", 3, "EventArray"); // EVT_HANDLE *
-	ADD_PARAM_NAME("EvtNext", 4, "Timeout"); // DWORD
-	ADD_PARAM_NAME("EvtNext", 5, "Flags"); // DWORD
-	ADD_PARAM_NAME("EvtNext", 6, "Returned"); // PDWORD
-	ADD_PARAM_NAME("EvtNextChannelPath", 1, "ChannelEnum"); // EVT_HANDLE
-	ADD_PARAM_NAME("EvtNextChannelPath", 2, "ChannelPathBufferSize"); // DWORD
-	ADD_PARAM_NAME("EvtNextChannelPath", 3, "ChannelPathBuffer"); // LPWSTR
-	ADD_PARAM_NAME("EvtNextChannelPath", 4, "ChannelPathBufferUsed"); // PDWORD
-	ADD_PARAM_NAME("EvtNextEventMetadata", 1, "EventMetadataEnum"); // EVT_HANDLE
-	ADD_PARAM_NAME("EvtNextEventMetadata", 2, "Flags"); // DWORD
-	ADD_PARAM_NAME("EvtNextPublisherId", 1, "PublisherEnum"); // EVT_HANDLE
-	ADD_PARAM_NAME("EvtNextPublisherId", 2, "PublisherIdBufferSize"); // DWORD
-	ADD_PARAM_NAME("EvtNextPublisherId", 3, "PublisherIdBuffer"); // LPWSTR
-	ADD_PARAM_NAME("EvtNextPublisherId", 4, "PublisherIdBufferUsed"); // PDWORD
-	ADD_PARAM_NAME("EvtOpenChannelConfig", 1, "Session"); // EVT_HANDLE
-	ADD_PARAM_NAME("EvtOpenChannelConfig", 2, "ChannelPath"); // LPCWSTR
-	ADD_PARAM_NAME("EvtOpenChannelConfig", 3, "Flags"); // DWORD
-	ADD_PARAM_NAME("EvtOpenChannelEnum", 1, "Session"); // EVT_HANDLE
-	ADD_PARAM_NAME("EvtOpenChannelEnum", 2, "Flags"); // DWORD
-	ADD_PARAM_NAME("EvtOpenEventMetadataEnum", 1, "PublisherMetadata"); // EVT_HANDLE
-	ADD_PARAM_NAME("EvtOpenEventMetadataEnum", 2, "Flags"); // DWORD
-	ADD_PARAM_NAME("EvtOpenLog", 1, "Session"); // EVT_HANDLE
-	ADD_PARAM_NAME("EvtOpenLog", 2, "Path"); // LPCWSTR
-	ADD_PARAM_NAME("EvtOpenLog", 3, "Flags"); // DWORD
-	ADD_PARAM_NAME("EvtOpenPublisherEnum", 1, "Session"); // EVT_HANDLE
-	ADD_PARAM_NAME("EvtOpenPublisherEnum", 2, "Flags"); // DWORD
-	ADD_PARAM_NAME("EvtOpenPublisherMetadata", 1, "Session"); // EVT_HANDLE
-	ADD_PARAM_NAME("EvtOpenPublisherMetadata", 2, "PublisherIdentity"); // LPCWSTR
-	ADD_PARAM_NAME("EvtOpenPublisherMetadata", 3, "LogFilePath"); // LPCWSTR
-	ADD_PARAM_NAME("EvtOpenPublisherMetadata", 4, "Locale"); // LCID
-	ADD_PARAM_NAME("EvtOpenPublisherMetadata", 5, "Flags"); // DWORD
-	ADD_PARAM_NAME("EvtOpenSession", 1, "LoginClass"); // EVT_LOGIN_CLASS
-	ADD_PARAM_NAME("EvtOpenSession", 2, "Login"); // PVOID
-	ADD_PARAM_NAME("EvtOpenSession", 3, "Timeout"); // DWORD
-	ADD_PARAM_NAME("EvtOpenSession", 4, "Flags"); // DWORD
-	ADD_PARAM_NAME("EvtQuery", 1, "Session"); // EVT_HANDLE
-	ADD_PARAM_NAME("EvtQuery", 2, "Path"); // LPCWSTR
-	ADD_PARAM_NAME("EvtQuery", 3, "Query"); // LPCWSTR
-	ADD_PARAM_NAME("EvtQuery", 4, "Flags"); // DWORD
-	ADD_PARAM_NAME("EvtRender", 1, "Context"); // EVT_HANDLE
-	ADD_PARAM_NAME("EvtRender", 2, "Fragment"); // EVT_HANDLE
-	ADD_PARAM_NAME("EvtRender", 3, "Flags"); // DWORD
-	ADD_PARAM_NAME("EvtRender", 4, "BufferSize"); // DWORD
-	ADD_PARAM_NAME("EvtRender", 5, "Buffer"); // PVOID
-	ADD_PARAM_NAME("EvtRender", 6, "BufferUsed"); // PDWORD
-	ADD_PARAM_NAME("EvtRender", 7, "PropertyCount"); // PDWORD
-	ADD_PARAM_NAME("EvtSaveChannelConfig", 1, "ChannelConfig"); // EVT_HANDLE
-	ADD_PARAM_NAME("EvtSaveChannelConfig", 2, "Flags"); // DWORD
-	ADD_PARAM_NAME("EvtSeek", 1, "ResultSet"); // EVT_HANDLE
-	ADD_PARAM_NAME("EvtSeek", 2, "Position"); // LONGLONG
-	ADD_PARAM_NAME("EvtSeek", 3, "Bookmark"); // EVT_HANDLE
-	ADD_PARAM_NAME("EvtSeek", 4, "Timeout"); // DWORD
-	ADD_PARAM_NAME("EvtSeek", 5, "Flags"); // DWORD
-	ADD_PARAM_NAME("EvtSetChannelConfigProperty", 1, "ChannelConfig"); // EVT_HANDLE
-	ADD_PARAM_NAME("EvtSetChannelConfigProperty", 2, "PropertyId"); // EVT_CHANNEL_CONFIG_PROPERTY_ID
-	ADD_PARAM_NAME("EvtSetChannelConfigProperty", 3, "Flags"); // DWORD
-	ADD_PARAM_NAME("EvtSetChannelConfigProperty", 4, "PropertyValue"); // PEVT_VARIANT
-	ADD_PARAM_NAME("EvtSubscribe", 1, "Session"); // EVT_HANDLE
-	ADD_PARAM_NAME("EvtSubscribe", 2, "SignalEvent"); // HANDLE
-	ADD_PARAM_NAME("EvtSubscribe", 3, "ChannelPath"); // LPCWSTR
-	ADD_PARAM_NAME("EvtSubscribe", 4, "Query"); // LPCWSTR
-	ADD_PARAM_NAME("EvtSubscribe", 5, "Bookmark"); // EVT_HANDLE
-	ADD_PARAM_NAME("EvtSubscribe", 6, "context"); // PVOID
-	ADD_PARAM_NAME("EvtSubscribe", 7, "Callback"); // EVT_SUBSCRIBE_CALLBACK
-	ADD_PARAM_NAME("EvtSubscribe", 8, "Flags"); // DWORD
-	ADD_PARAM_NAME("EvtUpdateBookmark", 1, "Bookmark"); // EVT_HANDLE
-	ADD_PARAM_NAME("EvtUpdateBookmark", 2, "Event"); // EVT_HANDLE
-	ADD_PARAM_NAME("ExcludeClipRect", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("ExcludeClipRect", 2, "left"); // int
-	ADD_PARAM_NAME("ExcludeClipRect", 3, "top"); // int
-	ADD_PARAM_NAME("ExcludeClipRect", 4, "right"); // int
-	ADD_PARAM_NAME("ExcludeClipRect", 5, "bottom"); // int
-	ADD_PARAM_NAME("ExcludeUpdateRgn", 1, "hDC"); // HDC
-	ADD_PARAM_NAME("ExcludeUpdateRgn", 2, "hWnd"); // HWND
-	ADD_PARAM_NAME("ExitProcess", 1, "uExitCode"); // UINT
-	ADD_PARAM_NAME("ExitThread", 1, "dwExitCode"); // DWORD
-	ADD_PARAM_NAME("ExitWindowsEx", 1, "uFlags"); // UINT
-	ADD_PARAM_NAME("ExitWindowsEx", 2, "dwReason"); // DWORD
-	ADD_PARAM_NAME("ExpandEnvironmentStringsA", 1, "lpSrc"); // LPCSTR
-	ADD_PARAM_NAME("ExpandEnvironmentStringsA", 2, "lpDst"); // LPSTR
-	ADD_PARAM_NAME("ExpandEnvironmentStringsA", 3, "nSize"); // DWORD
-	ADD_PARAM_NAME("ExpandEnvironmentStringsW", 1, "lpSrc"); // LPCWSTR
-	ADD_PARAM_NAME("ExpandEnvironmentStringsW", 2, "lpDst"); // LPWSTR
-	ADD_PARAM_NAME("ExpandEnvironmentStringsW", 3, "nSize"); // DWORD
-	ADD_PARAM_NAME("ExtCreatePen", 1, "iPenStyle"); // DWORD
-	ADD_PARAM_NAME("ExtCreatePen", 2, "cWidth"); // DWORD
-	ADD_PARAM_NAME("ExtCreatePen", 3, "plbrush"); // CONST LOGBRUSH *
-	ADD_PARAM_NAME("ExtCreatePen", 4, "cStyle"); // DWORD
-	ADD_PARAM_NAME("ExtCreatePen", 5, "pstyle"); // CONST DWORD *
-	ADD_PARAM_NAME("ExtCreateRegion", 1, "lpx"); // CONST XFORM *
-	ADD_PARAM_NAME("ExtCreateRegion", 2, "nCount"); // DWORD
-	ADD_PARAM_NAME("ExtCreateRegion", 3, "lpData"); // CONST RGNDATA *
-	ADD_PARAM_NAME("ExtEscape", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("ExtEscape", 2, "iEscape"); // int
-	ADD_PARAM_NAME("ExtEscape", 3, "cjInput"); // int
-	ADD_PARAM_NAME("ExtEscape", 4, "lpInData"); // LPCSTR
-	ADD_PARAM_NAME("ExtEscape", 5, "cjOutput"); // int
-	ADD_PARAM_NAME("ExtEscape", 6, "lpOutData"); // LPSTR
-	ADD_PARAM_NAME("ExtFloodFill", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("ExtFloodFill", 2, "x"); // int
-	ADD_PARAM_NAME("ExtFloodFill", 3, "y"); // int
-	ADD_PARAM_NAME("ExtFloodFill", 4, "color"); // COLORREF
-	ADD_PARAM_NAME("ExtFloodFill", 5, "type"); // UINT
-	ADD_PARAM_NAME("ExtSelectClipRgn", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("ExtSelectClipRgn", 2, "hrgn"); // HRGN
-	ADD_PARAM_NAME("ExtSelectClipRgn", 3, "mode"); // int
-	ADD_PARAM_NAME("ExtTextOutA", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("ExtTextOutA", 2, "x"); // int
-	ADD_PARAM_NAME("ExtTextOutA", 3, "y"); // int
-	ADD_PARAM_NAME("ExtTextOutA", 4, "options"); // UINT
-	ADD_PARAM_NAME("ExtTextOutA", 5, "lprect"); // CONST RECT *
-	ADD_PARAM_NAME("ExtTextOutA", 6, "lpString"); // LPCSTR
-	ADD_PARAM_NAME("ExtTextOutA", 7, "c"); // UINT
-	ADD_PARAM_NAME("ExtTextOutA", 8, "lpDx"); // CONST INT *
-	ADD_PARAM_NAME("ExtTextOutW", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("ExtTextOutW", 2, "x"); // int
-	ADD_PARAM_NAME("ExtTextOutW", 3, "y"); // int
-	ADD_PARAM_NAME("ExtTextOutW", 4, "options"); // UINT
-	ADD_PARAM_NAME("ExtTextOutW", 5, "lprect"); // CONST RECT *
-	ADD_PARAM_NAME("ExtTextOutW", 6, "lpString"); // LPCWSTR
-	ADD_PARAM_NAME("ExtTextOutW", 7, "c"); // UINT
-	ADD_PARAM_NAME("ExtTextOutW", 8, "lpDx"); // CONST INT *
-}
+namespace {
+
+constexpr FuncParamName FUNC_PARAM_NAMES[] = {
+	{"Ellipse", 1, "hdc"}, // HDC
+	{"Ellipse", 2, "left"}, // int
+	{"Ellipse", 3, "top"}, // int
+	{"Ellipse", 4, "right"}, // int
+	{"Ellipse", 5, "bottom"}, // int
+	{"EnableMenuItem", 1, "hMenu"}, // HMENU
+	{"EnableMenuItem", 2, "uIDEnableItem"}, // UINT
+	{"EnableMenuItem", 3, "uEnable"}, // UINT
+	{"EnableScrollBar", 1, "hWnd"}, // HWND
+	{"EnableScrollBar", 2, "wSBflags"}, // UINT
+	{"EnableScrollBar", 3, "wArrows"}, // UINT
+	{"EnableWindow", 1, "hWnd"}, // HWND
+	{"EnableWindow", 2, "bEnable"}, // WINBOOL
+	{"EncodePointer", 1, "Ptr"}, // PVOID
+	{"EncodeSystemPointer", 1, "Ptr"}, // PVOID
+	{"EncryptFileA", 1, "lpFileName"}, // LPCSTR
+	{"EncryptFileW", 1, "lpFileName"}, // LPCWSTR
+	{"EncryptionDisable", 1, "DirPath"}, // LPCWSTR
+	{"EncryptionDisable", 2, "Disable"}, // WINBOOL
+	{"EndDeferWindowPos", 1, "hWinPosInfo"}, // HDWP
+	{"EndDialog", 1, "hDlg"}, // HWND
+	{"EndDialog", 2, "nResult"}, // INT_PTR
+	{"EndDoc", 1, "hdc"}, // HDC
+	{"EndDocPrinter", 1, "hPrinter"}, // HANDLE
+	{"EndPage", 1, "hdc"}, // HDC
+	{"EndPagePrinter", 1, "hPrinter"}, // HANDLE
+	{"EndPaint", 1, "hWnd"}, // HWND
+	{"EndPaint", 2, "lpPaint"}, // CONST PAINTSTRUCT *
+	{"EndPath", 1, "hdc"}, // HDC
+	{"EndTask", 1, "hWnd"}, // HWND
+	{"EndTask", 2, "fShutDown"}, // WINBOOL
+	{"EndTask", 3, "fForce"}, // WINBOOL
+	{"EndUpdateResourceA", 1, "hUpdate"}, // HANDLE
+	{"EndUpdateResourceA", 2, "fDiscard"}, // WINBOOL
+	{"EndUpdateResourceW", 1, "hUpdate"}, // HANDLE
+	{"EndUpdateResourceW", 2, "fDiscard"}, // WINBOOL
+	{"EnterCriticalSection", 1, "lpCriticalSection"}, // LPCRITICAL_SECTION
+	{"EnumCalendarInfoA", 1, "lpCalInfoEnumProc"}, // CALINFO_ENUMPROCA
+	{"EnumCalendarInfoA", 2, "Locale"}, // LCID
+	{"EnumCalendarInfoA", 3, "Calendar"}, // CALID
+	{"EnumCalendarInfoA", 4, "CalType"}, // CALTYPE
+	{"EnumCalendarInfoExA", 1, "lpCalInfoEnumProcEx"}, // CALINFO_ENUMPROCEXA
+	{"EnumCalendarInfoExA", 2, "Locale"}, // LCID
+	{"EnumCalendarInfoExA", 3, "Calendar"}, // CALID
+	{"EnumCalendarInfoExA", 4, "CalType"}, // CALTYPE
+	{"EnumCalendarInfoExEx", 1, "pCalInfoEnumProcExEx"}, // CALINFO_ENUMPROCEXEX
+	{"EnumCalendarInfoExEx", 2, "lpLocaleName"}, // LPCWSTR
+	{"EnumCalendarInfoExEx", 3, "Calendar"}, // CALID
+	{"EnumCalendarInfoExEx", 4, "lpReserved"}, // LPCWSTR
+	{"EnumCalendarInfoExEx", 5, "CalType"}, // CALTYPE
+	{"EnumCalendarInfoExEx", 6, "lParam"}, // LPARAM
+	{"EnumCalendarInfoExW", 1, "lpCalInfoEnumProcEx"}, // CALINFO_ENUMPROCEXW
+	{"EnumCalendarInfoExW", 2, "Locale"}, // LCID
+	{"EnumCalendarInfoExW", 3, "Calendar"}, // CALID
+	{"EnumCalendarInfoExW", 4, "CalType"}, // CALTYPE
+	{"EnumCalendarInfoW", 1, "lpCalInfoEnumProc"}, // CALINFO_ENUMPROCW
+	{"EnumCalendarInfoW", 2, "Locale"}, // LCID
+	{"EnumCalendarInfoW", 3, "Calendar"}, // CALID
+	{"EnumCalendarInfoW", 4, "CalType"}, // CALTYPE
+	{"EnumChildWindows", 1, "hWndParent"}, // HWND
+	{"EnumChildWindows", 2, "lpEnumFunc"}, // WNDENUMPROC
+	{"EnumChildWindows", 3, "lParam"}, // LPARAM
+	{"EnumClipboardFormats", 1, "format"}, // UINT
+	{"EnumDateFormatsA", 1, "lpDateFmtEnumProc"}, // DATEFMT_ENUMPROCA
+	{"EnumDateFormatsA", 2, "Locale"}, // LCID
+	{"EnumDateFormatsA", 3, "dwFlags"}, // DWORD
+	{"EnumDateFormatsExA", 1, "lpDateFmtEnumProcEx"}, // DATEFMT_ENUMPROCEXA
+	{"EnumDateFormatsExA", 2, "Locale"}, // LCID
+	{"EnumDateFormatsExA", 3, "dwFlags"}, // DWORD
+	{"EnumDateFormatsExEx", 1, "lpDateFmtEnumProcExEx"}, // DATEFMT_ENUMPROCEXEX
+	{"EnumDateFormatsExEx", 2, "lpLocaleName"}, // LPCWSTR
+	{"EnumDateFormatsExEx", 3, "dwFlags"}, // DWORD
+	{"EnumDateFormatsExEx", 4, "lParam"}, // LPARAM
+	{"EnumDateFormatsExW", 1, "lpDateFmtEnumProcEx"}, // DATEFMT_ENUMPROCEXW
+	{"EnumDateFormatsExW", 2, "Locale"}, // LCID
+	{"EnumDateFormatsExW", 3, "dwFlags"}, // DWORD
+	{"EnumDateFormatsW", 1, "lpDateFmtEnumProc"}, // DATEFMT_ENUMPROCW
+	{"EnumDateFormatsW", 2, "Locale"}, // LCID
+	{"EnumDateFormatsW", 3, "dwFlags"}, // DWORD
+	{"EnumDependentServicesA", 1, "hService"}, // SC_HANDLE
+	{"EnumDependentServicesA", 2, "dwServiceState"}, // DWORD
+	{"EnumDependentServicesA", 3, "lpServices"}, // LPENUM_SERVICE_STATUSA
+	{"EnumDependentServicesA", 4, "cbBufSize"}, // DWORD
+	{"EnumDependentServicesA", 5, "pcbBytesNeeded"}, // LPDWORD
+	{"EnumDependentServicesA", 6, "lpServicesReturned"}, // LPDWORD
+	{"EnumDependentServicesW", 1, "hService"}, // SC_HANDLE
+	{"EnumDependentServicesW", 2, "dwServiceState"}, // DWORD
+	{"EnumDependentServicesW", 3, "lpServices"}, // LPENUM_SERVICE_STATUSW
+	{"EnumDependentServicesW", 4, "cbBufSize"}, // DWORD
+	{"EnumDependentServicesW", 5, "pcbBytesNeeded"}, // LPDWORD
+	{"EnumDependentServicesW", 6, "lpServicesReturned"}, // LPDWORD
+	{"EnumDesktopWindows", 1, "hDesktop"}, // HDESK
+	{"EnumDesktopWindows", 2, "lpfn"}, // WNDENUMPROC
+	{"EnumDesktopWindows", 3, "lParam"}, // LPARAM
+	{"EnumDesktopsA", 1, "hwinsta"}, // HWINSTA
+	{"EnumDesktopsA", 2, "lpEnumFunc"}, // DESKTOPENUMPROCA
+	{"EnumDesktopsA", 3, "lParam"}, // LPARAM
+	{"EnumDesktopsW", 1, "hwinsta"}, // HWINSTA
+	{"EnumDesktopsW", 2, "lpEnumFunc"}, // DESKTOPENUMPROCW
+	{"EnumDesktopsW", 3, "lParam"}, // LPARAM
+	{"EnumDisplayDevicesA", 1, "lpDevice"}, // LPCSTR
+	{"EnumDisplayDevicesA", 2, "iDevNum"}, // DWORD
+	{"EnumDisplayDevicesA", 3, "lpDisplayDevice"}, // PDISPLAY_DEVICEA
+	{"EnumDisplayDevicesA", 4, "dwFlags"}, // DWORD
+	{"EnumDisplayDevicesW", 1, "lpDevice"}, // LPCWSTR
+	{"EnumDisplayDevicesW", 2, "iDevNum"}, // DWORD
+	{"EnumDisplayDevicesW", 3, "lpDisplayDevice"}, // PDISPLAY_DEVICEW
+	{"EnumDisplayDevicesW", 4, "dwFlags"}, // DWORD
+	{"EnumDisplayMonitors", 1, "hdc"}, // HDC
+	{"EnumDisplayMonitors", 2, "lprcClip"}, // LPCRECT
+	{"EnumDisplayMonitors", 3, "lpfnEnum"}, // MONITORENUMPROC
+	{"EnumDisplayMonitors", 4, "dwData"}, // LPARAM
+	{"EnumDisplaySettingsA", 1, "lpszDeviceName"}, // LPCSTR
+	{"EnumDisplaySettingsA", 2, "iModeNum"}, // DWORD
+	{"EnumDisplaySettingsA", 3, "lpDevMode"}, // LPDEVMODEA
+	{"EnumDisplaySettingsExA", 1, "lpszDeviceName"}, // LPCSTR
+	{"EnumDisplaySettingsExA", 2, "iModeNum"}, // DWORD
+	{"EnumDisplaySettingsExA", 3, "lpDevMode"}, // LPDEVMODEA
+	{"EnumDisplaySettingsExA", 4, "dwFlags"}, // DWORD
+	{"EnumDisplaySettingsExW", 1, "lpszDeviceName"}, // LPCWSTR
+	{"EnumDisplaySettingsExW", 2, "iModeNum"}, // DWORD
+	{"EnumDisplaySettingsExW", 3, "lpDevMode"}, // LPDEVMODEW
+	{"EnumDisplaySettingsExW", 4, "dwFlags"}, // DWORD
+	{"EnumDisplaySettingsW", 1, "lpszDeviceName"}, // LPCWSTR
+	{"EnumDisplaySettingsW", 2, "iModeNum"}, // DWORD
+	{"EnumDisplaySettingsW", 3, "lpDevMode"}, // LPDEVMODEW
+	{"EnumEnhMetaFile", 1, "hdc"}, // HDC
+	{"EnumEnhMetaFile", 2, "hmf"}, // HENHMETAFILE
+	{"EnumEnhMetaFile", 3, "lpProc"}, // ENHMFENUMPROC
+	{"EnumEnhMetaFile", 4, "lpParam"}, // LPVOID
+	{"EnumEnhMetaFile", 5, "lpRect"}, // CONST RECT *
+	{"EnumFontFamiliesA", 1, "hdc"}, // HDC
+	{"EnumFontFamiliesA", 2, "lpLogfont"}, // LPCSTR
+	{"EnumFontFamiliesA", 3, "lpProc"}, // FONTENUMPROCA
+	{"EnumFontFamiliesA", 4, "lParam"}, // LPARAM
+	{"EnumFontFamiliesExA", 1, "hdc"}, // HDC
+	{"EnumFontFamiliesExA", 2, "lpLogfont"}, // LPLOGFONTA
+	{"EnumFontFamiliesExA", 3, "lpProc"}, // FONTENUMPROCA
+	{"EnumFontFamiliesExA", 4, "lParam"}, // LPARAM
+	{"EnumFontFamiliesExA", 5, "dwFlags"}, // DWORD
+	{"EnumFontFamiliesExW", 1, "hdc"}, // HDC
+	{"EnumFontFamiliesExW", 2, "lpLogfont"}, // LPLOGFONTW
+	{"EnumFontFamiliesExW", 3, "lpProc"}, // FONTENUMPROCW
+	{"EnumFontFamiliesExW", 4, "lParam"}, // LPARAM
+	{"EnumFontFamiliesExW", 5, "dwFlags"}, // DWORD
+	{"EnumFontFamiliesW", 1, "hdc"}, // HDC
+	{"EnumFontFamiliesW", 2, "lpLogfont"}, // LPCWSTR
+	{"EnumFontFamiliesW", 3, "lpProc"}, // FONTENUMPROCW
+	{"EnumFontFamiliesW", 4, "lParam"}, // LPARAM
+	{"EnumFontsA", 1, "hdc"}, // HDC
+	{"EnumFontsA", 2, "lpLogfont"}, // LPCSTR
+	{"EnumFontsA", 3, "lpProc"}, // FONTENUMPROCA
+	{"EnumFontsA", 4, "lParam"}, // LPARAM
+	{"EnumFontsW", 1, "hdc"}, // HDC
+	{"EnumFontsW", 2, "lpLogfont"}, // LPCWSTR
+	{"EnumFontsW", 3, "lpProc"}, // FONTENUMPROCW
+	{"EnumFontsW", 4, "lParam"}, // LPARAM
+	{"EnumFormsA", 1, "hPrinter"}, // HANDLE
+	{"EnumFormsA", 2, "Level"}, // DWORD
+	{"EnumFormsA", 3, "pForm"}, // LPBYTE
+	{"EnumFormsA", 4, "cbBuf"}, // DWORD
+	{"EnumFormsA", 5, "pcbNeeded"}, // LPDWORD
+	{"EnumFormsA", 6, "pcReturned"}, // LPDWORD
+	{"EnumFormsW", 1, "hPrinter"}, // HANDLE
+	{"EnumFormsW", 2, "Level"}, // DWORD
+	{"EnumFormsW", 3, "pForm"}, // LPBYTE
+	{"EnumFormsW", 4, "cbBuf"}, // DWORD
+	{"EnumFormsW", 5, "pcbNeeded"}, // LPDWORD
+	{"EnumFormsW", 6, "pcReturned"}, // LPDWORD
+	{"EnumICMProfilesA", 1, "hdc"}, // HDC
+	{"EnumICMProfilesA", 2, "lpProc"}, // ICMENUMPROCA
+	{"EnumICMProfilesA", 3, "lParam"}, // LPARAM
+	{"EnumICMProfilesW", 1, "hdc"}, // HDC
+	{"EnumICMProfilesW", 2, "lpProc"}, // ICMENUMPROCW
+	{"EnumICMProfilesW", 3, "lParam"}, // LPARAM
+	{"EnumJobsA", 1, "hPrinter"}, // HANDLE
+	{"EnumJobsA", 2, "FirstJob"}, // DWORD
+	{"EnumJobsA", 3, "NoJobs"}, // DWORD
+	{"EnumJobsA", 4, "Level"}, // DWORD
+	{"EnumJobsA", 5, "pJob"}, // LPBYTE
+	{"EnumJobsA", 6, "cbBuf"}, // DWORD
+	{"EnumJobsA", 7, "pcbNeeded"}, // LPDWORD
+	{"EnumJobsA", 8, "pcReturned"}, // LPDWORD
+	{"EnumJobsW", 1, "hPrinter"}, // HANDLE
+	{"EnumJobsW", 2, "FirstJob"}, // DWORD
+	{"EnumJobsW", 3, "NoJobs"}, // DWORD
+	{"EnumJobsW", 4, "Level"}, // DWORD
+	{"EnumJobsW", 5, "pJob"}, // LPBYTE
+	{"EnumJobsW", 6, "cbBuf"}, // DWORD
+	{"EnumJobsW", 7, "pcbNeeded"}, // LPDWORD
+	{"EnumJobsW", 8, "pcReturned"}, // LPDWORD
+	{"EnumLanguageGroupLocalesA", 1, "lpLangGroupLocaleEnumProc"}, // LANGGROUPLOCALE_ENUMPROCA
+	{"EnumLanguageGroupLocalesA", 2, "LanguageGroup"}, // LGRPID
+	{"EnumLanguageGroupLocalesA", 3, "dwFlags"}, // DWORD
+	{"EnumLanguageGroupLocalesA", 4, "lParam"}, // LONG_PTR
+	{"EnumLanguageGroupLocalesW", 1, "lpLangGroupLocaleEnumProc"}, // LANGGROUPLOCALE_ENUMPROCW
+	{"EnumLanguageGroupLocalesW", 2, "LanguageGroup"}, // LGRPID
+	{"EnumLanguageGroupLocalesW", 3, "dwFlags"}, // DWORD
+	{"EnumLanguageGroupLocalesW", 4, "lParam"}, // LONG_PTR
+	{"EnumMetaFile", 1, "hdc"}, // HDC
+	{"EnumMetaFile", 2, "hmf"}, // HMETAFILE
+	{"EnumMetaFile", 3, "lpProc"}, // MFENUMPROC
+	{"EnumMetaFile", 4, "lParam"}, // LPARAM
+	{"EnumMonitorsA", 1, "pName"}, // LPSTR
+	{"EnumMonitorsA", 2, "Level"}, // DWORD
+	{"EnumMonitorsA", 3, "pMonitor"}, // LPBYTE
+	{"EnumMonitorsA", 4, "cbBuf"}, // DWORD
+	{"EnumMonitorsA", 5, "pcbNeeded"}, // LPDWORD
+	{"EnumMonitorsA", 6, "pcReturned"}, // LPDWORD
+	{"EnumMonitorsW", 1, "pName"}, // LPWSTR
+	{"EnumMonitorsW", 2, "Level"}, // DWORD
+	{"EnumMonitorsW", 3, "pMonitor"}, // LPBYTE
+	{"EnumMonitorsW", 4, "cbBuf"}, // DWORD
+	{"EnumMonitorsW", 5, "pcbNeeded"}, // LPDWORD
+	{"EnumMonitorsW", 6, "pcReturned"}, // LPDWORD
+	{"EnumObjects", 1, "hdc"}, // HDC
+	{"EnumObjects", 2, "nType"}, // int
+	{"EnumObjects", 3, "lpFunc"}, // GOBJENUMPROC
+	{"EnumObjects", 4, "lParam"}, // LPARAM
+	{"EnumPortsA", 1, "pName"}, // LPSTR
+	{"EnumPortsA", 2, "Level"}, // DWORD
+	{"EnumPortsA", 3, "pPorts"}, // LPBYTE
+	{"EnumPortsA", 4, "cbBuf"}, // DWORD
+	{"EnumPortsA", 5, "pcbNeeded"}, // LPDWORD
+	{"EnumPortsA", 6, "pcReturned"}, // LPDWORD
+	{"EnumPortsW", 1, "pName"}, // LPWSTR
+	{"EnumPortsW", 2, "Level"}, // DWORD
+	{"EnumPortsW", 3, "pPorts"}, // LPBYTE
+	{"EnumPortsW", 4, "cbBuf"}, // DWORD
+	{"EnumPortsW", 5, "pcbNeeded"}, // LPDWORD
+	{"EnumPortsW", 6, "pcReturned"}, // LPDWORD
+	{"EnumPrintProcessorDatatypesA", 1, "pName"}, // LPSTR
+	{"EnumPrintProcessorDatatypesA", 2, "pPrintProcessorName"}, // LPSTR
+	{"EnumPrintProcessorDatatypesA", 3, "Level"}, // DWORD
+	{"EnumPrintProcessorDatatypesA", 4, "pDatatypes"}, // LPBYTE
+	{"EnumPrintProcessorDatatypesA", 5, "cbBuf"}, // DWORD
+	{"EnumPrintProcessorDatatypesA", 6, "pcbNeeded"}, // LPDWORD
+	{"EnumPrintProcessorDatatypesA", 7, "pcReturned"}, // LPDWORD
+	{"EnumPrintProcessorDatatypesW", 1, "pName"}, // LPWSTR
+	{"EnumPrintProcessorDatatypesW", 2, "pPrintProcessorName"}, // LPWSTR
+	{"EnumPrintProcessorDatatypesW", 3, "Level"}, // DWORD
+	{"EnumPrintProcessorDatatypesW", 4, "pDatatypes"}, // LPBYTE
+	{"EnumPrintProcessorDatatypesW", 5, "cbBuf"}, // DWORD
+	{"EnumPrintProcessorDatatypesW", 6, "pcbNeeded"}, // LPDWORD
+	{"EnumPrintProcessorDatatypesW", 7, "pcReturned"}, // LPDWORD
+	{"EnumPrintProcessorsA", 1, "pName"}, // LPSTR
+	{"EnumPrintProcessorsA", 2, "pEnvironment"}, // LPSTR
+	{"EnumPrintProcessorsA", 3, "Level"}, // DWORD
+	{"EnumPrintProcessorsA", 4, "pPrintProcessorInfo"}, // LPBYTE
+	{"EnumPrintProcessorsA", 5, "cbBuf"}, // DWORD
+	{"EnumPrintProcessorsA", 6, "pcbNeeded"}, // LPDWORD
+	{"EnumPrintProcessorsA", 7, "pcReturned"}, // LPDWORD
+	{"EnumPrintProcessorsW", 1, "pName"}, // LPWSTR
+	{"EnumPrintProcessorsW", 2, "pEnvironment"}, // LPWSTR
+	{"EnumPrintProcessorsW", 3, "Level"}, // DWORD
+	{"EnumPrintProcessorsW", 4, "pPrintProcessorInfo"}, // LPBYTE
+	{"EnumPrintProcessorsW", 5, "cbBuf"}, // DWORD
+	{"EnumPrintProcessorsW", 6, "pcbNeeded"}, // LPDWORD
+	{"EnumPrintProcessorsW", 7, "pcReturned"}, // LPDWORD
+	{"EnumPrinterDataA", 1, "hPrinter"}, // HANDLE
+	{"EnumPrinterDataA", 2, "dwIndex"}, // DWORD
+	{"EnumPrinterDataA", 3, "pValueName"}, // LPSTR
+	{"EnumPrinterDataA", 4, "cbValueName"}, // DWORD
+	{"EnumPrinterDataA", 5, "pcbValueName"}, // LPDWORD
+	{"EnumPrinterDataA", 6, "pType"}, // LPDWORD
+	{"EnumPrinterDataA", 7, "pData"}, // LPBYTE
+	{"EnumPrinterDataA", 8, "cbData"}, // DWORD
+	{"EnumPrinterDataA", 9, "pcbData"}, // LPDWORD
+	{"EnumPrinterDataExA", 1, "hPrinter"}, // HANDLE
+	{"EnumPrinterDataExA", 2, "pKeyName"}, // LPCSTR
+	{"EnumPrinterDataExA", 3, "pEnumValues"}, // LPBYTE
+	{"EnumPrinterDataExA", 4, "cbEnumValues"}, // DWORD
+	{"EnumPrinterDataExA", 5, "pcbEnumValues"}, // LPDWORD
+	{"EnumPrinterDataExA", 6, "pnEnumValues"}, // LPDWORD
+	{"EnumPrinterDataExW", 1, "hPrinter"}, // HANDLE
+	{"EnumPrinterDataExW", 2, "pKeyName"}, // LPCWSTR
+	{"EnumPrinterDataExW", 3, "pEnumValues"}, // LPBYTE
+	{"EnumPrinterDataExW", 4, "cbEnumValues"}, // DWORD
+	{"EnumPrinterDataExW", 5, "pcbEnumValues"}, // LPDWORD
+	{"EnumPrinterDataExW", 6, "pnEnumValues"}, // LPDWORD
+	{"EnumPrinterDataW", 1, "hPrinter"}, // HANDLE
+	{"EnumPrinterDataW", 2, "dwIndex"}, // DWORD
+	{"EnumPrinterDataW", 3, "pValueName"}, // LPWSTR
+	{"EnumPrinterDataW", 4, "cbValueName"}, // DWORD
+	{"EnumPrinterDataW", 5, "pcbValueName"}, // LPDWORD
+	{"EnumPrinterDataW", 6, "pType"}, // LPDWORD
+	{"EnumPrinterDataW", 7, "pData"}, // LPBYTE
+	{"EnumPrinterDataW", 8, "cbData"}, // DWORD
+	{"EnumPrinterDataW", 9, "pcbData"}, // LPDWORD
+	{"EnumPrinterDriversA", 1, "pName"}, // LPSTR
+	{"EnumPrinterDriversA", 2, "pEnvironment"}, // LPSTR
+	{"EnumPrinterDriversA", 3, "Level"}, // DWORD
+	{"EnumPrinterDriversA", 4, "pDriverInfo"}, // LPBYTE
+	{"EnumPrinterDriversA", 5, "cbBuf"}, // DWORD
+	{"EnumPrinterDriversA", 6, "pcbNeeded"}, // LPDWORD
+	{"EnumPrinterDriversA", 7, "pcReturned"}, // LPDWORD
+	{"EnumPrinterDriversW", 1, "pName"}, // LPWSTR
+	{"EnumPrinterDriversW", 2, "pEnvironment"}, // LPWSTR
+	{"EnumPrinterDriversW", 3, "Level"}, // DWORD
+	{"EnumPrinterDriversW", 4, "pDriverInfo"}, // LPBYTE
+	{"EnumPrinterDriversW", 5, "cbBuf"}, // DWORD
+	{"EnumPrinterDriversW", 6, "pcbNeeded"}, // LPDWORD
+	{"EnumPrinterDriversW", 7, "pcReturned"}, // LPDWORD
+	{"EnumPrinterKeyA", 1, "hPrinter"}, // HANDLE
+	{"EnumPrinterKeyA", 2, "pKeyName"}, // LPCSTR
+	{"EnumPrinterKeyA", 3, "pSubkey"}, // LPSTR
+	{"EnumPrinterKeyA", 4, "cbSubkey"}, // DWORD
+	{"EnumPrinterKeyA", 5, "pcbSubkey"}, // LPDWORD
+	{"EnumPrinterKeyW", 1, "hPrinter"}, // HANDLE
+	{"EnumPrinterKeyW", 2, "pKeyName"}, // LPCWSTR
+	{"EnumPrinterKeyW", 3, "pSubkey"}, // LPWSTR
+	{"EnumPrinterKeyW", 4, "cbSubkey"}, // DWORD
+	{"EnumPrinterKeyW", 5, "pcbSubkey"}, // LPDWORD
+	{"EnumPrintersA", 1, "Flags"}, // DWORD
+	{"EnumPrintersA", 2, "Name"}, // LPSTR
+	{"EnumPrintersA", 3, "Level"}, // DWORD
+	{"EnumPrintersA", 4, "pPrinterEnum"}, // LPBYTE
+	{"EnumPrintersA", 5, "cbBuf"}, // DWORD
+	{"EnumPrintersA", 6, "pcbNeeded"}, // LPDWORD
+	{"EnumPrintersA", 7, "pcReturned"}, // LPDWORD
+	{"EnumPrintersW", 1, "Flags"}, // DWORD
+	{"EnumPrintersW", 2, "Name"}, // LPWSTR
+	{"EnumPrintersW", 3, "Level"}, // DWORD
+	{"EnumPrintersW", 4, "pPrinterEnum"}, // LPBYTE
+	{"EnumPrintersW", 5, "cbBuf"}, // DWORD
+	{"EnumPrintersW", 6, "pcbNeeded"}, // LPDWORD
+	{"EnumPrintersW", 7, "pcReturned"}, // LPDWORD
+	{"EnumPropsA", 1, "hWnd"}, // HWND
+	{"EnumPropsA", 2, "lpEnumFunc"}, // PROPENUMPROCA
+	{"EnumPropsExA", 1, "hWnd"}, // HWND
+	{"EnumPropsExA", 2, "lpEnumFunc"}, // PROPENUMPROCEXA
+	{"EnumPropsExA", 3, "lParam"}, // LPARAM
+	{"EnumPropsExW", 1, "hWnd"}, // HWND
+	{"EnumPropsExW", 2, "lpEnumFunc"}, // PROPENUMPROCEXW
+	{"EnumPropsExW", 3, "lParam"}, // LPARAM
+	{"EnumPropsW", 1, "hWnd"}, // HWND
+	{"EnumPropsW", 2, "lpEnumFunc"}, // PROPENUMPROCW
+	{"EnumResourceLanguagesA", 1, "hModule"}, // HMODULE
+	{"EnumResourceLanguagesA", 2, "lpType"}, // LPCSTR
+	{"EnumResourceLanguagesA", 3, "lpName"}, // LPCSTR
+	{"EnumResourceLanguagesA", 4, "lpEnumFunc"}, // ENUMRESLANGPROCA
+	{"EnumResourceLanguagesA", 5, "lParam"}, // LONG_PTR
+	{"EnumResourceLanguagesW", 1, "hModule"}, // HMODULE
+	{"EnumResourceLanguagesW", 2, "lpType"}, // LPCWSTR
+	{"EnumResourceLanguagesW", 3, "lpName"}, // LPCWSTR
+	{"EnumResourceLanguagesW", 4, "lpEnumFunc"}, // ENUMRESLANGPROCW
+	{"EnumResourceLanguagesW", 5, "lParam"}, // LONG_PTR
+	{"EnumResourceNamesA", 1, "hModule"}, // HMODULE
+	{"EnumResourceNamesA", 2, "lpType"}, // LPCSTR
+	{"EnumResourceNamesA", 3, "lpEnumFunc"}, // ENUMRESNAMEPROCA
+	{"EnumResourceNamesA", 4, "lParam"}, // LONG_PTR
+	{"EnumResourceNamesW", 1, "hModule"}, // HMODULE
+	{"EnumResourceNamesW", 2, "lpType"}, // LPCWSTR
+	{"EnumResourceNamesW", 3, "lpEnumFunc"}, // ENUMRESNAMEPROCW
+	{"EnumResourceNamesW", 4, "lParam"}, // LONG_PTR
+	{"EnumResourceTypesA", 1, "hModule"}, // HMODULE
+	{"EnumResourceTypesA", 2, "lpEnumFunc"}, // ENUMRESTYPEPROCA
+	{"EnumResourceTypesA", 3, "lParam"}, // LONG_PTR
+	{"EnumResourceTypesW", 1, "hModule"}, // HMODULE
+	{"EnumResourceTypesW", 2, "lpEnumFunc"}, // ENUMRESTYPEPROCW
+	{"EnumResourceTypesW", 3, "lParam"}, // LONG_PTR
+	{"EnumServicesStatusA", 1, "hSCManager"}, // SC_HANDLE
+	{"EnumServicesStatusA", 2, "dwServiceType"}, // DWORD
+	{"EnumServicesStatusA", 3, "dwServiceState"}, // DWORD
+	{"EnumServicesStatusA", 4, "lpServices"}, // LPENUM_SERVICE_STATUSA
+	{"EnumServicesStatusA", 5, "cbBufSize"}, // DWORD
+	{"EnumServicesStatusA", 6, "pcbBytesNeeded"}, // LPDWORD
+	{"EnumServicesStatusA", 7, "lpServicesReturned"}, // LPDWORD
+	{"EnumServicesStatusA", 8, "lpResumeHandle"}, // LPDWORD
+	{"EnumServicesStatusExA", 1, "hSCManager"}, // SC_HANDLE
+	{"EnumServicesStatusExA", 2, "InfoLevel"}, // SC_ENUM_TYPE
+	{"EnumServicesStatusExA", 3, "dwServiceType"}, // DWORD
+	{"EnumServicesStatusExA", 4, "dwServiceState"}, // DWORD
+	{"EnumServicesStatusExA", 5, "lpServices"}, // LPBYTE
+	{"EnumServicesStatusExA", 6, "cbBufSize"}, // DWORD
+	{"EnumServicesStatusExA", 7, "pcbBytesNeeded"}, // LPDWORD
+	{"EnumServicesStatusExA", 8, "lpServicesReturned"}, // LPDWORD
+	{"EnumServicesStatusExA", 9, "lpResumeHandle"}, // LPDWORD
+	{"EnumServicesStatusExA", 10, "pszGroupName"}, // LPCSTR
+	{"EnumServicesStatusExW", 1, "hSCManager"}, // SC_HANDLE
+	{"EnumServicesStatusExW", 2, "InfoLevel"}, // SC_ENUM_TYPE
+	{"EnumServicesStatusExW", 3, "dwServiceType"}, // DWORD
+	{"EnumServicesStatusExW", 4, "dwServiceState"}, // DWORD
+	{"EnumServicesStatusExW", 5, "lpServices"}, // LPBYTE
+	{"EnumServicesStatusExW", 6, "cbBufSize"}, // DWORD
+	{"EnumServicesStatusExW", 7, "pcbBytesNeeded"}, // LPDWORD
+	{"EnumServicesStatusExW", 8, "lpServicesReturned"}, // LPDWORD
+	{"EnumServicesStatusExW", 9, "lpResumeHandle"}, // LPDWORD
+	{"EnumServicesStatusExW", 10, "pszGroupName"}, // LPCWSTR
+	{"EnumServicesStatusW", 1, "hSCManager"}, // SC_HANDLE
+	{"EnumServicesStatusW", 2, "dwServiceType"}, // DWORD
+	{"EnumServicesStatusW", 3, "dwServiceState"}, // DWORD
+	{"EnumServicesStatusW", 4, "lpServices"}, // LPENUM_SERVICE_STATUSW
+	{"EnumServicesStatusW", 5, "cbBufSize"}, // DWORD
+	{"EnumServicesStatusW", 6, "pcbBytesNeeded"}, // LPDWORD
+	{"EnumServicesStatusW", 7, "lpServicesReturned"}, // LPDWORD
+	{"EnumServicesStatusW", 8, "lpResumeHandle"}, // LPDWORD
+	{"EnumSystemCodePagesA", 1, "lpCodePageEnumProc"}, // CODEPAGE_ENUMPROCA
+	{"EnumSystemCodePagesA", 2, "dwFlags"}, // DWORD
+	{"EnumSystemCodePagesW", 1, "lpCodePageEnumProc"}, // CODEPAGE_ENUMPROCW
+	{"EnumSystemCodePagesW", 2, "dwFlags"}, // DWORD
+	{"EnumSystemFirmwareTables", 1, "FirmwareTableProviderSignature"}, // DWORD
+	{"EnumSystemFirmwareTables", 2, "pFirmwareTableEnumBuffer"}, // PVOID
+	{"EnumSystemFirmwareTables", 3, "BufferSize"}, // DWORD
+	{"EnumSystemGeoID", 1, "GeoClass"}, // GEOCLASS
+	{"EnumSystemGeoID", 2, "ParentGeoId"}, // GEOID
+	{"EnumSystemGeoID", 3, "lpGeoEnumProc"}, // GEO_ENUMPROC
+	{"EnumSystemLanguageGroupsA", 1, "lpLanguageGroupEnumProc"}, // LANGUAGEGROUP_ENUMPROCA
+	{"EnumSystemLanguageGroupsA", 2, "dwFlags"}, // DWORD
+	{"EnumSystemLanguageGroupsA", 3, "lParam"}, // LONG_PTR
+	{"EnumSystemLanguageGroupsW", 1, "lpLanguageGroupEnumProc"}, // LANGUAGEGROUP_ENUMPROCW
+	{"EnumSystemLanguageGroupsW", 2, "dwFlags"}, // DWORD
+	{"EnumSystemLanguageGroupsW", 3, "lParam"}, // LONG_PTR
+	{"EnumSystemLocalesA", 1, "lpLocaleEnumProc"}, // LOCALE_ENUMPROCA
+	{"EnumSystemLocalesA", 2, "dwFlags"}, // DWORD
+	{"EnumSystemLocalesEx", 1, "lpLocaleEnumProcEx"}, // LOCALE_ENUMPROCEX
+	{"EnumSystemLocalesEx", 2, "dwFlags"}, // DWORD
+	{"EnumSystemLocalesEx", 3, "lParam"}, // LPARAM
+	{"EnumSystemLocalesEx", 4, "lpReserved"}, // LPVOID
+	{"EnumSystemLocalesW", 1, "lpLocaleEnumProc"}, // LOCALE_ENUMPROCW
+	{"EnumSystemLocalesW", 2, "dwFlags"}, // DWORD
+	{"EnumThreadWindows", 1, "dwThreadId"}, // DWORD
+	{"EnumThreadWindows", 2, "lpfn"}, // WNDENUMPROC
+	{"EnumThreadWindows", 3, "lParam"}, // LPARAM
+	{"EnumTimeFormatsA", 1, "lpTimeFmtEnumProc"}, // TIMEFMT_ENUMPROCA
+	{"EnumTimeFormatsA", 2, "Locale"}, // LCID
+	{"EnumTimeFormatsA", 3, "dwFlags"}, // DWORD
+	{"EnumTimeFormatsEx", 1, "lpTimeFmtEnumProcEx"}, // TIMEFMT_ENUMPROCEX
+	{"EnumTimeFormatsEx", 2, "lpLocaleName"}, // LPCWSTR
+	{"EnumTimeFormatsEx", 3, "dwFlags"}, // DWORD
+	{"EnumTimeFormatsEx", 4, "lParam"}, // LPARAM
+	{"EnumTimeFormatsW", 1, "lpTimeFmtEnumProc"}, // TIMEFMT_ENUMPROCW
+	{"EnumTimeFormatsW", 2, "Locale"}, // LCID
+	{"EnumTimeFormatsW", 3, "dwFlags"}, // DWORD
+	{"EnumUILanguagesA", 1, "lpUILanguageEnumProc"}, // UILANGUAGE_ENUMPROCA
+	{"EnumUILanguagesA", 2, "dwFlags"}, // DWORD
+	{"EnumUILanguagesA", 3, "lParam"}, // LONG_PTR
+	{"EnumUILanguagesW", 1, "lpUILanguageEnumProc"}, // UILANGUAGE_ENUMPROCW
+	{"EnumUILanguagesW", 2, "dwFlags"}, // DWORD
+	{"EnumUILanguagesW", 3, "lParam"}, // LONG_PTR
+	{"EnumWindowStationsA", 1, "lpEnumFunc"}, // WINSTAENUMPROCA
+	{"EnumWindowStationsA", 2, "lParam"}, // LPARAM
+	{"EnumWindowStationsW", 1, "lpEnumFunc"}, // WINSTAENUMPROCW
+	{"EnumWindowStationsW", 2, "lParam"}, // LPARAM
+	{"EnumWindows", 1, "lpEnumFunc"}, // WNDENUMPROC
+	{"EnumWindows", 2, "lParam"}, // LPARAM
+	{"EqualDomainSid", 1, "pSid1"}, // PSID
+	{"EqualDomainSid", 2, "pSid2"}, // PSID
+	{"EqualDomainSid", 3, "pfEqual"}, // WINBOOL *
+	{"EqualPrefixSid", 1, "pSid1"}, // PSID
+	{"EqualPrefixSid", 2, "pSid2"}, // PSID
+	{"EqualRect", 1, "lprc1"}, // CONST RECT *
+	{"EqualRect", 2, "lprc2"}, // CONST RECT *
+	{"EqualRgn", 1, "hrgn1"}, // HRGN
+	{"EqualRgn", 2, "hrgn2"}, // HRGN
+	{"EqualSid", 1, "pSid1"}, // PSID
+	{"EqualSid", 2, "pSid2"}, // PSID
+	{"EraseTape", 1, "hDevice"}, // HANDLE
+	{"EraseTape", 2, "dwEraseType"}, // DWORD
+	{"EraseTape", 3, "bImmediate"}, // WINBOOL
+	{"Escape", 1, "hdc"}, // HDC
+	{"Escape", 2, "iEscape"}, // int
+	{"Escape", 3, "cjIn"}, // int
+	{"Escape", 4, "pvIn"}, // LPCSTR
+	{"Escape", 5, "pvOut"}, // LPVOID
+	{"EscapeCommFunction", 1, "hFile"}, // HANDLE
+	{"EscapeCommFunction", 2, "dwFunc"}, // DWORD
+	{"EvtArchiveExportedLog", 1, "Session"}, // EVT_HANDLE
+	{"EvtArchiveExportedLog", 2, "LogFilePath"}, // LPCWSTR
+	{"EvtArchiveExportedLog", 3, "Locale"}, // LCID
+	{"EvtArchiveExportedLog", 4, "Flags"}, // DWORD
+	{"EvtCancel", 1, "Object"}, // EVT_HANDLE
+	{"EvtClearLog", 1, "Session"}, // EVT_HANDLE
+	{"EvtClearLog", 2, "ChannelPath"}, // LPCWSTR
+	{"EvtClearLog", 3, "TargetFilePath"}, // LPCWSTR
+	{"EvtClearLog", 4, "Flags"}, // DWORD
+	{"EvtClose", 1, "Object"}, // EVT_HANDLE
+	{"EvtCreateBookmark", 1, "BookmarkXml"}, // LPCWSTR
+	{"EvtCreateRenderContext", 1, "ValuePathsCount"}, // DWORD
+	{"EvtCreateRenderContext", 2, "ValuePaths"}, // LPCWSTR *
+	{"EvtCreateRenderContext", 3, "Flags"}, // DWORD
+	{"EvtExportLog", 1, "Session"}, // EVT_HANDLE
+	{"EvtExportLog", 2, "Path"}, // LPCWSTR
+	{"EvtExportLog", 3, "Query"}, // LPCWSTR
+	{"EvtExportLog", 4, "TargetFilePath"}, // LPCWSTR
+	{"EvtExportLog", 5, "Flags"}, // DWORD
+	{"EvtFormatMessage", 1, "PublisherMetadata"}, // EVT_HANDLE
+	{"EvtFormatMessage", 2, "Event"}, // EVT_HANDLE
+	{"EvtFormatMessage", 3, "MessageId"}, // DWORD
+	{"EvtFormatMessage", 4, "ValueCount"}, // DWORD
+	{"EvtFormatMessage", 5, "Values"}, // PEVT_VARIANT
+	{"EvtFormatMessage", 6, "Flags"}, // DWORD
+	{"EvtFormatMessage", 7, "BufferSize"}, // DWORD
+	{"EvtFormatMessage", 8, "Buffer"}, // LPWSTR
+	{"EvtFormatMessage", 9, "BufferUsed"}, // PDWORD
+	{"EvtGetChannelConfigProperty", 1, "ChannelConfig"}, // EVT_HANDLE
+	{"EvtGetChannelConfigProperty", 2, "PropertyId"}, // EVT_CHANNEL_CONFIG_PROPERTY_ID
+	{"EvtGetChannelConfigProperty", 3, "Flags"}, // DWORD
+	{"EvtGetChannelConfigProperty", 4, "PropertyValueBufferSize"}, // DWORD
+	{"EvtGetChannelConfigProperty", 5, "PropertyValueBuffer"}, // PEVT_VARIANT
+	{"EvtGetChannelConfigProperty", 6, "PropertyValueBufferUsed"}, // PDWORD
+	{"EvtGetEventInfo", 1, "Event"}, // EVT_HANDLE
+	{"EvtGetEventInfo", 2, "PropertyId"}, // EVT_EVENT_PROPERTY_ID
+	{"EvtGetEventInfo", 3, "PropertyValueBufferSize"}, // DWORD
+	{"EvtGetEventInfo", 4, "PropertyValueBuffer"}, // PEVT_VARIANT
+	{"EvtGetEventInfo", 5, "PropertyValueBufferUsed"}, // PDWORD
+	{"EvtGetEventMetadataProperty", 1, "EventMetadata"}, // EVT_HANDLE
+	{"EvtGetEventMetadataProperty", 2, "PropertyId"}, // EVT_EVENT_METADATA_PROPERTY_ID
+	{"EvtGetEventMetadataProperty", 3, "Flags"}, // DWORD
+	{"EvtGetEventMetadataProperty", 4, "EventMetadataPropertyBufferSize"}, // DWORD
+	{"EvtGetEventMetadataProperty", 5, "EventMetadataPropertyBuffer"}, // PEVT_VARIANT
+	{"EvtGetEventMetadataProperty", 6, "EventMetadataPropertyBufferUsed"}, // PDWORD
+	{"EvtGetExtendedStatus", 1, "BufferSize"}, // DWORD
+	{"EvtGetExtendedStatus", 2, "Buffer"}, // LPWSTR
+	{"EvtGetExtendedStatus", 3, "BufferUsed"}, // PDWORD
+	{"EvtGetLogInfo", 1, "Log"}, // EVT_HANDLE
+	{"EvtGetLogInfo", 2, "PropertyId"}, // EVT_LOG_PROPERTY_ID
+	{"EvtGetLogInfo", 3, "PropertyValueBufferSize"}, // DWORD
+	{"EvtGetLogInfo", 4, "PropertyValueBuffer"}, // PEVT_VARIANT
+	{"EvtGetLogInfo", 5, "PropertyValueBufferUsed"}, // PDWORD
+	{"EvtGetObjectArrayProperty", 1, "ObjectArray"}, // EVT_OBJECT_ARRAY_PROPERTY_HANDLE
+	{"EvtGetObjectArrayProperty", 2, "PropertyId"}, // DWORD
+	{"EvtGetObjectArrayProperty", 3, "ArrayIndex"}, // DWORD
+	{"EvtGetObjectArrayProperty", 4, "Flags"}, // DWORD
+	{"EvtGetObjectArrayProperty", 5, "PropertyValueBufferSize"}, // DWORD
+	{"EvtGetObjectArrayProperty", 6, "PropertyValueBuffer"}, // PEVT_VARIANT
+	{"EvtGetObjectArrayProperty", 7, "PropertyValueBufferUsed"}, // PDWORD
+	{"EvtGetObjectArraySize", 1, "ObjectArray"}, // EVT_OBJECT_ARRAY_PROPERTY_HANDLE
+	{"EvtGetObjectArraySize", 2, "ObjectArraySize"}, // PDWORD
+	{"EvtGetPublisherMetadataProperty", 1, "PublisherMetadata"}, // EVT_HANDLE
+	{"EvtGetPublisherMetadataProperty", 2, "PropertyId"}, // EVT_PUBLISHER_METADATA_PROPERTY_ID
+	{"EvtGetPublisherMetadataProperty", 3, "Flags"}, // DWORD
+	{"EvtGetPublisherMetadataProperty", 4, "PublisherMetadataPropertyBufferSize"}, // DWORD
+	{"EvtGetPublisherMetadataProperty", 5, "PublisherMetadataPropertyBuffer"}, // PEVT_VARIANT
+	{"EvtGetPublisherMetadataProperty", 6, "PublisherMetadataPropertyBufferUsed"}, // PDWORD
+	{"EvtGetQueryInfo", 1, "QueryOrSubscription"}, // EVT_HANDLE
+	{"EvtGetQueryInfo", 2, "PropertyId"}, // EVT_QUERY_PROPERTY_ID
+	{"EvtGetQueryInfo", 3, "PropertyValueBufferSize"}, // DWORD
+	{"EvtGetQueryInfo", 4, "PropertyValueBuffer"}, // PEVT_VARIANT
+	{"EvtGetQueryInfo", 5, "PropertyValueBufferUsed"}, // PDWORD
+	{"EvtNext", 1, "ResultSet"}, // EVT_HANDLE
+	{"EvtNext", 2, "EventArraySize"}, // DWORD
+	{"EvtNext", 3, "EventArray"}, // EVT_HANDLE *
+	{"EvtNext", 4, "Timeout"}, // DWORD
+	{"EvtNext", 5, "Flags"}, // DWORD
+	{"EvtNext", 6, "Returned"}, // PDWORD
+	{"EvtNextChannelPath", 1, "ChannelEnum"}, // EVT_HANDLE
+	{"EvtNextChannelPath", 2, "ChannelPathBufferSize"}, // DWORD
+	{"EvtNextChannelPath", 3, "ChannelPathBuffer"}, // LPWSTR
+	{"EvtNextChannelPath", 4, "ChannelPathBufferUsed"}, // PDWORD
+	{"EvtNextEventMetadata", 1, "EventMetadataEnum"}, // EVT_HANDLE
+	{"EvtNextEventMetadata", 2, "Flags"}, // DWORD
+	{"EvtNextPublisherId", 1, "PublisherEnum"}, // EVT_HANDLE
+	{"EvtNextPublisherId", 2, "PublisherIdBufferSize"}, // DWORD
+	{"EvtNextPublisherId", 3, "PublisherIdBuffer"}, // LPWSTR
+	{"EvtNextPublisherId", 4, "PublisherIdBufferUsed"}, // PDWORD
+	{"EvtOpenChannelConfig", 1, "Session"}, // EVT_HANDLE
+	{"EvtOpenChannelConfig", 2, "ChannelPath"}, // LPCWSTR
+	{"EvtOpenChannelConfig", 3, "Flags"}, // DWORD
+	{"EvtOpenChannelEnum", 1, "Session"}, // EVT_HANDLE
+	{"EvtOpenChannelEnum", 2, "Flags"}, // DWORD
+	{"EvtOpenEventMetadataEnum", 1, "PublisherMetadata"}, // EVT_HANDLE
+	{"EvtOpenEventMetadataEnum", 2, "Flags"}, // DWORD
+	{"EvtOpenLog", 1, "Session"}, // EVT_HANDLE
+	{"EvtOpenLog", 2, "Path"}, // LPCWSTR
+	{"EvtOpenLog", 3, "Flags"}, // DWORD
+	{"EvtOpenPublisherEnum", 1, "Session"}, // EVT_HANDLE
+	{"EvtOpenPublisherEnum", 2, "Flags"}, // DWORD
+	{"EvtOpenPublisherMetadata", 1, "Session"}, // EVT_HANDLE
+	{"EvtOpenPublisherMetadata", 2, "PublisherIdentity"}, // LPCWSTR
+	{"EvtOpenPublisherMetadata", 3, "LogFilePath"}, // LPCWSTR
+	{"EvtOpenPublisherMetadata", 4, "Locale"}, // LCID
+	{"EvtOpenPublisherMetadata", 5, "Flags"}, // DWORD
+	{"EvtOpenSession", 1, "LoginClass"}, // EVT_LOGIN_CLASS
+	{"EvtOpenSession", 2, "Login"}, // PVOID
+	{"EvtOpenSession", 3, "Timeout"}, // DWORD
+	{"EvtOpenSession", 4, "Flags"}, // DWORD
+	{"EvtQuery", 1, "Session"}, // EVT_HANDLE
+	{"EvtQuery", 2, "Path"}, // LPCWSTR
+	{"EvtQuery", 3, "Query"}, // LPCWSTR
+	{"EvtQuery", 4, "Flags"}, // DWORD
+	{"EvtRender", 1, "Context"}, // EVT_HANDLE
+	{"EvtRender", 2, "Fragment"}, // EVT_HANDLE
+	{"EvtRender", 3, "Flags"}, // DWORD
+	{"EvtRender", 4, "BufferSize"}, // DWORD
+	{"EvtRender", 5, "Buffer"}, // PVOID
+	{"EvtRender", 6, "BufferUsed"}, // PDWORD
+	{"EvtRender", 7, "PropertyCount"}, // PDWORD
+	{"EvtSaveChannelConfig", 1, "ChannelConfig"}, // EVT_HANDLE
+	{"EvtSaveChannelConfig", 2, "Flags"}, // DWORD
+	{"EvtSeek", 1, "ResultSet"}, // EVT_HANDLE
+	{"EvtSeek", 2, "Position"}, // LONGLONG
+	{"EvtSeek", 3, "Bookmark"}, // EVT_HANDLE
+	{"EvtSeek", 4, "Timeout"}, // DWORD
+	{"EvtSeek", 5, "Flags"}, // DWORD
+	{"EvtSetChannelConfigProperty", 1, "ChannelConfig"}, // EVT_HANDLE
+	{"EvtSetChannelConfigProperty", 2, "PropertyId"}, // EVT_CHANNEL_CONFIG_PROPERTY_ID
+	{"EvtSetChannelConfigProperty", 3, "Flags"}, // DWORD
+	{"EvtSetChannelConfigProperty", 4, "PropertyValue"}, // PEVT_VARIANT
+	{"EvtSubscribe", 1, "Session"}, // EVT_HANDLE
+	{"EvtSubscribe", 2, "SignalEvent"}, // HANDLE
+	{"EvtSubscribe", 3, "ChannelPath"}, // LPCWSTR
+	{"EvtSubscribe", 4, "Query"}, // LPCWSTR
+	{"EvtSubscribe", 5, "Bookmark"}, // EVT_HANDLE
+	{"EvtSubscribe", 6, "context"}, // PVOID
+	{"EvtSubscribe", 7, "Callback"}, // EVT_SUBSCRIBE_CALLBACK
+	{"EvtSubscribe", 8, "Flags"}, // DWORD
+	{"EvtUpdateBookmark", 1, "Bookmark"}, // EVT_HANDLE
+	{"EvtUpdateBookmark", 2, "Event"}, // EVT_HANDLE
+	{"ExcludeClipRect", 1, "hdc"}, // HDC
+	{"ExcludeClipRect", 2, "left"}, // int
+	{"ExcludeClipRect", 3, "top"}, // int
+	{"ExcludeClipRect", 4, "right"}, // int
+	{"ExcludeClipRect", 5, "bottom"}, // int
+	{"ExcludeUpdateRgn", 1, "hDC"}, // HDC
+	{"ExcludeUpdateRgn", 2, "hWnd"}, // HWND
+	{"ExitProcess", 1, "uExitCode"}, // UINT
+	{"ExitThread", 1, "dwExitCode"}, // DWORD
+	{"ExitWindowsEx", 1, "uFlags"}, // UINT
+	{"ExitWindowsEx", 2, "dwReason"}, // DWORD
+	{"ExpandEnvironmentStringsA", 1, "lpSrc"}, // LPCSTR
+	{"ExpandEnvironmentStringsA", 2, "lpDst"}, // LPSTR
+	{"ExpandEnvironmentStringsA", 3, "nSize"}, // DWORD
+	{"ExpandEnvironmentStringsW", 1, "lpSrc"}, // LPCWSTR
+	{"ExpandEnvironmentStringsW", 2, "lpDst"}, // LPWSTR
+	{"ExpandEnvironmentStringsW", 3, "nSize"}, // DWORD
+	{"ExtCreatePen", 1, "iPenStyle"}, // DWORD
+	{"ExtCreatePen", 2, "cWidth"}, // DWORD
+	{"ExtCreatePen", 3, "plbrush"}, // CONST LOGBRUSH *
+	{"ExtCreatePen", 4, "cStyle"}, // DWORD
+	{"ExtCreatePen", 5, "pstyle"}, // CONST DWORD *
+	{"ExtCreateRegion", 1, "lpx"}, // CONST XFORM *
+	{"ExtCreateRegion", 2, "nCount"}, // DWORD
+	{"ExtCreateRegion", 3, "lpData"}, // CONST RGNDATA *
+	{"ExtEscape", 1, "hdc"}, // HDC
+	{"ExtEscape", 2, "iEscape"}, // int
+	{"ExtEscape", 3, "cjInput"}, // int
+	{"ExtEscape", 4, "lpInData"}, // LPCSTR
+	{"ExtEscape", 5, "cjOutput"}, // int
+	{"ExtEscape", 6, "lpOutData"}, // LPSTR
+	{"ExtFloodFill", 1, "hdc"}, // HDC
+	{"ExtFloodFill", 2, "x"}, // int
+	{"ExtFloodFill", 3, "y"}, // int
+	{"ExtFloodFill", 4, "color"}, // COLORREF
+	{"ExtFloodFill", 5, "type"}, // UINT
+	{"ExtSelectClipRgn", 1, "hdc"}, // HDC
+	{"ExtSelectClipRgn", 2, "hrgn"}, // HRGN
+	{"ExtSelectClipRgn", 3, "mode"}, // int
+	{"ExtTextOutA", 1, "hdc"}, // HDC
+	{"ExtTextOutA", 2, "x"}, // int
+	{"ExtTextOutA", 3, "y"}, // int
+	{"ExtTextOutA", 4, "options"}, // UINT
+	{"ExtTextOutA", 5, "lprect"}, // CONST RECT *
+	{"ExtTextOutA", 6, "lpString"}, // LPCSTR
+	{"ExtTextOutA", 7, "c"}, // UINT
+	{"ExtTextOutA", 8, "lpDx"}, // CONST INT *
+	{"ExtTextOutW", 1, "hdc"}, // HDC
+	{"ExtTextOutW", 2, "x"}, // int
+	{"ExtTextOutW", 3, "y"}, // int
+	{"ExtTextOutW", 4, "options"}, // UINT
+	{"ExtTextOutW", 5, "lprect"}, // CONST RECT *
+	{"ExtTextOutW", 6, "lpString"}, // LPCWSTR
+	{"ExtTextOutW", 7, "c"}, // UINT
+	{"ExtTextOutW", 8, "lpDx"}, // CONST INT *
+};
+static_assert(FuncParamNameTable(FUNC_PARAM_NAMES).isSorted(),
+	"FUNC_PARAM_NAMES has to be sorted by scripts/llvmir2hll/sort_semantics_tables.py");
+
+} // anonymous namespace
+
+/// Names of parameters of WinAPI functions starting with E.
+const FuncParamNameTable FUNC_PARAM_NAMES_E(FUNC_PARAM_NAMES);
 
 } // namespace win_api
 } // namespace semantics
@@ -11,54 +11,57 @@ namespace llvmir2hll {
 namespace semantics {
 namespace win_api {
 
-/**
-* @brief Initializes the given map with info about functions starting with H.
-*/
-void initFuncParamNamesMap_H(FuncParamNamesMap &funcParamNamesMap) {
-	//
-	// windows.h
-	//
-	ADD_PARAM_NAME("HeapAlloc", 1, "hHeap"); // HANDLE
-	ADD_PARAM_NAME("HeapAlloc", 2, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("HeapAlloc", 3, "dwBytes"); // SIZE_T
-	ADD_PARAM_NAME("HeapCompact", 1, "hHeap"); // HANDLE
-	ADD_PARAM_NAME("HeapCompact", 2, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("HeapCreate", 1, "flOptions"); // DWORD
-	ADD_PARAM_NAME("HeapCreate", 2, "dwInitialSize"); // SIZE_T
-	ADD_PARAM_NAME("HeapCreate", 3, "dwMaximumSize"); // SIZE_T
-	ADD_PARAM_NAME("HeapDestroy", 1, "hHeap"); // HANDLE
-	ADD_PARAM_NAME("HeapFree", 1, "hHeap"); // HANDLE
-	ADD_PARAM_NAME("HeapFree", 2, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("HeapFree", 3, "lpMem"); // LPVOID
-	ADD_PARAM_NAME("HeapLock", 1, "hHeap"); // HANDLE
-	ADD_PARAM_NAME("HeapQueryInformation", 1, "HeapHandle"); // HANDLE
-	ADD_PARAM_NAME("HeapQueryInformation", 2, "HeapInformationClass"); // HEAP_INFORMATION_CLASS
-	ADD_PARAM_NAME("HeapQueryInformation", 3, "HeapInformation"); // PVOID
-	ADD_PARAM_NAME("HeapQueryInformation", 4, "HeapInformationLength"); // SIZE_T
-	ADD_PARAM_NAME("HeapQueryInformation", 5, "ReturnLength"); // PSIZE_T
-	ADD_PARAM_NAME("HeapReAlloc", 1, "hHeap"); // HANDLE
-	ADD_PARAM_NAME("HeapReAlloc", 2, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("HeapReAlloc", 3, "lpMem"); // LPVOID
-	ADD_PARAM_NAME("HeapReAlloc", 4, "dwBytes"); // SIZE_T
-	ADD_PARAM_NAME("HeapSetInformation", 1, "HeapHandle"); // HANDLE
-	ADD_PARAM_NAME("HeapSetInformation", 2, "HeapInformationClass"); // HEAP_INFORMATION_CLASS
-	ADD_PARAM_NAME("HeapSetInformation", 3, "HeapInformation"); // PVOID
-	ADD_PARAM_NAME("HeapSetInformation", 4, "HeapInformationLength"); // SIZE_T
-	ADD_PARAM_NAME("HeapSize", 1, "hHeap"); // HANDLE
-	ADD_PARAM_NAME("HeapSize", 2, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("HeapSize", 3, "lpMem"); // LPCVOID
-	ADD_PARAM_NAME("HeapUnlock", 1, "hHeap"); // HANDLE
-	ADD_PARAM_NAME("HeapValidate", 1, "hHeap"); // HANDLE
-	ADD_PARAM_NAME("HeapValidate", 2, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("HeapValidate", 3, "lpMem"); // LPCVOID
-	ADD_PARAM_NAME("HeapWalk", 1, "hHeap"); // HANDLE
-	ADD_PARAM_NAME("HeapWalk", 2, "lpEntry"); // LPPROCESS_HEAP_ENTRY
-	ADD_PARAM_NAME("HideCaret", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("HiliteMenuItem", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("HiliteMenuItem", 2, "hMenu"); // HMENU
-	ADD_PARAM_NAME("HiliteMenuItem", 3, "uIDHiliteItem"); // UINT
-	ADD_PARAM_NAME("HiliteMenuItem", 4, "uHilite"); // UINT
-}
+namespace {
+
+constexpr FuncParamName FUNC_PARAM_NAMES[] = {
+	{"HeapAlloc", 1, "hHeap"}, // HANDLE
+	{"HeapAlloc", 2, "dwFlags"}, // DWORD
+	{"HeapAlloc", 3, "dwBytes"}, // SIZE_T
+	{"HeapCompact", 1, "hHeap"}, // HANDLE
+	{"HeapCompact", 2, "dwFlags"}, // DWORD
+	{"HeapCreate", 1, "flOptions"}, // DWORD
+	{"HeapCreate", 2, "dwInitialSize"}, // SIZE_T
+	{"HeapCreate", 3, "dwMaximumSize"}, // SIZE_T
+	{"HeapDestroy", 1, "hHeap"}, // HANDLE
+	{"HeapFree", 1, "hHeap"}, // HANDLE
+	{"HeapFree", 2, "dwFlags"}, // DWORD
+	{"HeapFree", 3, "lpMem"}, // LPVOID
+	{"HeapLock", 1, "hHeap"}, // HANDLE
+	{"HeapQueryInformation", 1, "HeapHandle"}, // HANDLE
+	{"HeapQueryInformation", 2, "HeapInformationClass"}, // HEAP_INFORMATION_CLASS
+	{"HeapQueryInformation", 3, "HeapInformation"}, // PVOID
+	{"HeapQueryInformation", 4, "HeapInformationLength"}, // SIZE_T
+	{"HeapQueryInformation", 5, "ReturnLength"}, // PSIZE_T
+	{"HeapReAlloc", 1, "hHeap"}, // HANDLE
+	{"HeapReAlloc", 2, "dwFlags"}, // DWORD
+	{"HeapReAlloc", 3, "lpMem"}, // LPVOID
+	{"HeapReAlloc", 4, "dwBytes"}, // SIZE_T
+	{"HeapSetInformation", 1, "HeapHandle"}, // HANDLE
+	{"HeapSetInformation", 2, "HeapInformationClass"}, // HEAP_INFORMATION_CLASS
+	{"HeapSetInformation", 3, "HeapInformation"}, // PVOID
+	{"HeapSetInformation", 4, "HeapInformationLength"}, // SIZE_T
+	{"HeapSize", 1, "hHeap"}, // HANDLE
+	{"HeapSize", 2, "dwFlags"}, // DWORD
+	{"HeapSize", 3, "lpMem"}, // LPCVOID
+	{"HeapUnlock", 1, "hHeap"}, // HANDLE
+	{"HeapValidate", 1, "hHeap"}, // HANDLE
+	{"HeapValidate", 2, "dwFlags"}, // DWORD
+	{"HeapValidate", 3, "lpMem"}, // LPCVOID
+	{"HeapWalk", 1, "hHeap"}, // HANDLE
+	{"HeapWalk", 2, "lpEntry"}, // LPPROCESS_HEAP_ENTRY
+	{"HideCaret", 1, "hWnd"}, // HWND
+	{"HiliteMenuItem", 1, "hWnd"}, // HWND
+	{"HiliteMenuItem", 2, "hMenu"}, // HMENU
+	{"HiliteMenuItem", 3, "uIDHiliteItem"}, // UINT
+	{"HiliteMenuItem", 4, "uHilite"}, // UINT
+};
+static_assert(FuncParamNameTable(FUNC_PARAM_NAMES).isSorted(),
+	"FUNC_PARAM_NAMES has to be sorted by scripts/llvmir2hll/sort_semantics_tables.py");
+
+} // anonymous namespace
+
+/// Names of parameters of WinAPI functions starting with H.
+const FuncParamNameTable FUNC_PARAM_NAMES_H(FUNC_PARAM_NAMES);
 
 } // namespace win_api
 } // namespace semantics
@@ -11,14 +11,9 @@ namespace llvmir2hll {
 namespace semantics {
 namespace win_api {
 
-/**
-* @brief Initializes the given map with info about functions starting with J.
-*/
-void initFuncParamNamesMap_J(FuncParamNamesMap &funcParamNamesMap) {
-	//
-	// windows.h
-	//
-}
+/// Names of parameters of WinAPI functions starting with J.
+/// There are no such functions in windows.h, so the table is empty.
+const FuncParamNameTable FUNC_PARAM_NAMES_J;
 
 } // namespace win_api
 } // namespace semantics
@@ -11,21 +11,23 @@ namespace llvmir2hll {
 namespace semantics {
 namespace win_api {
 
-/**
-* @brief Initializes the given map with info about functions starting with K.
-*/
-void initFuncParamNamesMap_K(FuncParamNamesMap &funcParamNamesMap) {
-	//
-	// windows.h
-	//
-	ADD_PARAM_NAME("KillTimer", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("KillTimer", 2, "uIDEvent"); // UINT_PTR
+namespace {
+
+constexpr FuncParamName FUNC_PARAM_NAMES[] = {
+	{"KillTimer", 1, "hWnd"}, // HWND
+	{"KillTimer", 2, "uIDEvent"}, // UINT_PTR
+	{"keybd_event", 1, "bVk"}, // BYTE
+	{"keybd_event", 2, "bScan"}, // BYTE
+	{"keybd_event", 3, "dwFlags"}, // DWORD
+	{"keybd_event", 4, "dwExtraInfo"}, // ULONG_PTR
+};
+static_assert(FuncParamNameTable(FUNC_PARAM_NAMES).isSorted(),
+	"FUNC_PARAM_NAMES has to be sorted by scripts/llvmir2hll/sort_semantics_tables.py");
+
+} // anonymous namespace
 
-	ADD_PARAM_NAME("keybd_event", 1, "bVk"); // BYTE
-	ADD_PARAM_NAME("keybd_event", 2, "bScan"); // BYTE
-	ADD_PARAM_NAME("keybd_event", 3, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("keybd_event", 4, "dwExtraInfo"); // ULONG_PTR
-}
+/// Names of parameters of WinAPI functions starting with K.
+const FuncParamNameTable FUNC_PARAM_NAMES_K(FUNC_PARAM_NAMES);
 
 } // namespace win_api
 } // namespace semantics
@@ -11,34 +11,37 @@ namespace llvmir2hll {
 namespace semantics {
 namespace win_api {
 
-/**
-* @brief Initializes the given map with info about functions starting with N.
-*/
-void initFuncParamNamesMap_N(FuncParamNamesMap &funcParamNamesMap) {
-	//
-	// windows.h
-	//
-	ADD_PARAM_NAME("NeedCurrentDirectoryForExePathA", 1, "ExeName"); // LPCSTR
-	ADD_PARAM_NAME("NeedCurrentDirectoryForExePathW", 1, "ExeName"); // LPCWSTR
-	ADD_PARAM_NAME("NormalizeString", 1, "NormForm"); // NORM_FORM
-	ADD_PARAM_NAME("NormalizeString", 2, "lpSrcString"); // LPCWSTR
-	ADD_PARAM_NAME("NormalizeString", 3, "cwSrcLength"); // int
-	ADD_PARAM_NAME("NormalizeString", 4, "lpDstString"); // LPWSTR
-	ADD_PARAM_NAME("NormalizeString", 5, "cwDstLength"); // int
-	ADD_PARAM_NAME("NotifyBootConfigStatus", 1, "BootAcceptable"); // WINBOOL
-	ADD_PARAM_NAME("NotifyChangeEventLog", 1, "hEventLog"); // HANDLE
-	ADD_PARAM_NAME("NotifyChangeEventLog", 2, "hEvent"); // HANDLE
-	ADD_PARAM_NAME("NotifyServiceStatusChangeA", 1, "hService"); // SC_HANDLE
-	ADD_PARAM_NAME("NotifyServiceStatusChangeA", 2, "dwNotifyMask"); // DWORD
-	ADD_PARAM_NAME("NotifyServiceStatusChangeA", 3, "pNotifyBuffer"); // PSERVICE_NOTIFYA
-	ADD_PARAM_NAME("NotifyServiceStatusChangeW", 1, "hService"); // SC_HANDLE
-	ADD_PARAM_NAME("NotifyServiceStatusChangeW", 2, "dwNotifyMask"); // DWORD
-	ADD_PARAM_NAME("NotifyServiceStatusChangeW", 3, "pNotifyBuffer"); // PSERVICE_NOTIFYW
-	ADD_PARAM_NAME("NotifyWinEvent", 1, "event"); // DWORD
-	ADD_PARAM_NAME("NotifyWinEvent", 2, "hWnd"); // HWND
-	ADD_PARAM_NAME("NotifyWinEvent", 3, "idObject"); // LONG
-	ADD_PARAM_NAME("NotifyWinEvent", 4, "idChild"); // LONG
-}
+namespace {
+
+constexpr FuncParamName FUNC_PARAM_NAMES[] = {
+	{"NeedCurrentDirectoryForExePathA", 1, "ExeName"}, // LPCSTR
+	{"NeedCurrentDirectoryForExePathW", 1, "ExeName"}, // LPCWSTR
+	{"NormalizeString", 1, "NormForm"}, // NORM_FORM
+	{"NormalizeString", 2, "lpSrcString"}, // LPCWSTR
+	{"NormalizeString", 3, "cwSrcLength"}, // int
+	{"NormalizeString", 4, "lpDstString"}, // LPWSTR
+	{"NormalizeString", 5, "cwDstLength"}, // int
+	{"NotifyBootConfigStatus", 1, "BootAcceptable"}, // WINBOOL
+	{"NotifyChangeEventLog", 1, "hEventLog"}, // HANDLE
+	{"NotifyChangeEventLog", 2, "hEvent"}, // HANDLE
+	{"NotifyServiceStatusChangeA", 1, "hService"}, // SC_HANDLE
+	{"NotifyServiceStatusChangeA", 2, "dwNotifyMask"}, // DWORD
+	{"NotifyServiceStatusChangeA", 3, "pNotifyBuffer"}, // PSERVICE_NOTIFYA
+	{"NotifyServiceStatusChangeW", 1, "hService"}, // SC_HANDLE
+	{"NotifyServiceStatusChangeW", 2, "dwNotifyMask"}, // DWORD
+	{"NotifyServiceStatusChangeW", 3, "pNotifyBuffer"}, // PSERVICE_NOTIFYW
+	{"NotifyWinEvent", 1, "event"}, // DWORD
+	{"NotifyWinEvent", 2, "hWnd"}, // HWND
+	{"NotifyWinEvent", 3, "idObject"}, // LONG
+	{"NotifyWinEvent", 4, "idChild"}, // LONG
+};
+static_assert(FuncParamNameTable(FUNC_PARAM_NAMES).isSorted(),
+	"FUNC_PARAM_NAMES has to be sorted by scripts/llvmir2hll/sort_semantics_tables.py");
+
+} // anonymous namespace
+
+/// Names of parameters of WinAPI functions starting with N.
+const FuncParamNameTable FUNC_PARAM_NAMES_N(FUNC_PARAM_NAMES);
 
 } // namespace win_api
 } // namespace semantics
@@ -11,22 +11,25 @@ namespace llvmir2hll {
 namespace semantics {
 namespace win_api {
 
-/**
-* @brief Initializes the given map with info about functions starting with X.
-*/
-void initFuncParamNamesMap_X(FuncParamNamesMap &funcParamNamesMap) {
-	//
-	// windows.h
-	//
-	ADD_PARAM_NAME("XcvDataW", 1, "hXcv"); // HANDLE
-	ADD_PARAM_NAME("XcvDataW", 2, "pszDataName"); // PCWSTR
-	ADD_PARAM_NAME("XcvDataW", 3, "pInputData"); // PBYTE
-	ADD_PARAM_NAME("XcvDataW", 4, "cbInputData"); // DWORD
-	ADD_PARAM_NAME("XcvDataW", 5, "pOutputData"); // PBYTE
-	ADD_PARAM_NAME("XcvDataW", 6, "cbOutputData"); // DWORD
-	ADD_PARAM_NAME("XcvDataW", 7, "pcbOutputNeeded"); // PDWORD
-	ADD_PARAM_NAME("XcvDataW", 8, "pdwStatus"); // PDWORD
-}
+namespace {
+
+constexpr FuncParamName FUNC_PARAM_NAMES[] = {
+	{"XcvDataW", 1, "hXcv"}, // HANDLE
+	{"XcvDataW", 2, "pszDataName"}, // PCWSTR
+	{"XcvDataW", 3, "pInputData"}, // PBYTE
+	{"XcvDataW", 4, "cbInputData"}, // DWORD
+	{"XcvDataW", 5, "pOutputData"}, // PBYTE
+	{"XcvDataW", 6, "cbOutputData"}, // DWORD
+	{"XcvDataW", 7, "pcbOutputNeeded"}, // PDWORD
+	{"XcvDataW", 8, "pdwStatus"}, // PDWORD
+};
+static_assert(FuncParamNameTable(FUNC_PARAM_NAMES).isSorted(),
+	"FUNC_PARAM_NAMES has to be sorted by scripts/llvmir2hll/sort_semantics_tables.py");
+
+} // anonymous namespace
+
+/// Names of parameters of WinAPI functions starting with X.
+const FuncParamNameTable FUNC_PARAM_NAMES_X(FUNC_PARAM_NAMES);
 
 } // namespace win_api
 } // namespace semantics
@@ -11,14 +11,9 @@ namespace llvmir2hll {
 namespace semantics {
 namespace win_api {
 
-/**
-* @brief Initializes the given map with info about functions starting with Y.
-*/
-void initFuncParamNamesMap_Y(FuncParamNamesMap &funcParamNamesMap) {
-	//
-	// windows.h
-	//
-}
+/// Names of parameters of WinAPI functions starting with Y.
+/// There are no such functions in windows.h, so the table is empty.
+const FuncParamNameTable FUNC_PARAM_NAMES_Y;
 
 } // namespace win_api
 } // namespace semantics
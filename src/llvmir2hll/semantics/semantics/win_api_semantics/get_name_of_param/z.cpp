@@ -11,15 +11,18 @@ namespace llvmir2hll {
 namespace semantics {
 namespace win_api {
 
-/**
-* @brief Initializes the given map with info about functions starting with Z.
-*/
-void initFuncParamNamesMap_Z(FuncParamNamesMap &funcParamNamesMap) {
-	//
-	// windows.h
-	//
-	ADD_PARAM_NAME("ZombifyActCtx", 1, "hActCtx"); // HANDLE
-}
+namespace {
+
+constexpr FuncParamName FUNC_PARAM_NAMES[] = {
+	{"ZombifyActCtx", 1, "hActCtx"}, // HANDLE
+};
+static_assert(FuncParamNameTable(FUNC_PARAM_NAMES).isSorted(),
+	"FUNC_PARAM_NAMES has to be sorted by scripts/llvmir2hll/sort_semantics_tables.py");
+
+} // anonymous namespace
+
+/// Names of parameters of WinAPI functions starting with Z.
+const FuncParamNameTable FUNC_PARAM_NAMES_Z(FUNC_PARAM_NAMES);
 
 } // namespace win_api
 } // namespace semantics
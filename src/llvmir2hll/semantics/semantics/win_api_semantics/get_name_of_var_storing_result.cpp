@@ -15,75 +15,66 @@ namespace win_api {
 
 namespace {
 
-/**
-* @brief This function is used to initialize FUNC_VAR_NAME_MAP later in the
-*        file.
-*/
-const StringStringUMap &initFuncVarNameMap() {
-	static StringStringUMap m;
-
-	// The following list is based on
-	//
-	//     - MSDN database (http://msdn.microsoft.com/en-US/windows/)
-	//
-	// It is by all means not complete (only few functions are there). If you
-	// find a function which is missing, please, add it.
-
-	// windows.h
-	m["ClientToScreen"] = "clientToScreenSuccess";
-	m["CloseHandle"] = "handleClosed";
-	m["CopyFile"] = "copyFileSuccess";
-	m["CopyFileA"] = "copyFileSuccess";
-	m["CreateFile"] = "fileHandle";
-	m["CreateFileA"] = "fileHandle";
-	m["CreateThread"] = "threadHandle";
-	m["CreateWindowEx"] = "windowHandle";
-	m["CreateWindowExA"] = "windowHandle";
-	m["EqualRect"] = "equalRect";
-	m["GetActiveWindow"] = "windowHandle";
-	m["GetBkColor"] = "color";
-	m["GetBkMode"] = "mode";
-	m["GetCommandLine"] = "commandLine";
-	m["GetCommandLineA"] = "commandLine";
-	m["GetCurrentProcess"] = "processHandle";
-	m["GetCurrentProcessId"] = "processId";
-	m["GetCurrentThread"] = "threadHandle";
-	m["GetCurrentThreadId"] = "threadId";
-	m["GetDriveType"] = "driveType";
-	m["GetDriveTypeA"] = "driveType";
-	m["GetFocus"] = "windowHandle";
-	m["GetForegroundWindow"] = "windowHandle";
-	m["GetLastError"] = "errorCode";
-	m["GetLogicalDrives"] = "availDiskDrives";
-	m["GetModuleFileName"] = "nameSize";
-	m["GetModuleFileNameA"] = "nameSize";
-	m["GetModuleHandle"] = "moduleHandle";
-	m["GetModuleHandleA"] = "moduleHandle";
-	m["GetProcAddress"] = "func";
-	m["GetSystemDefaultLangID"] = "langId";
-	m["GetTempPath"] = "pathSize";
-	m["GetTempPathA"] = "pathSize";
-	m["GetThreadPriority"] = "threadPriority";
-	m["IsValidCodePage"] = "validCodePage";
-	m["IsWindowVisible"] = "isVisible";
-	m["LoadCursor"] = "cursorHandle";
-	m["LoadCursorA"] = "cursorHandle";
-	m["LoadIcon"] = "iconHandle";
-	m["LoadIconA"] = "iconHandle";
-	m["LoadLibrary"] = "moduleHandle";
-	m["LoadLibraryA"] = "moduleHandle";
-	m["LocalAlloc"] = "memoryHandle";
-	m["RegisterClassEx"] = "classAtom";
-	m["RegisterClassExA"] = "classAtom";
-	m["SetTimer"] = "timerId";
-	m["SetUnhandledExceptionFilter"] = "prevExceptionFilter";
-	m["VirtualAlloc"] = "memory";
-
-	return m;
-}
+// The following list is based on
+//
+//     - MSDN database (http://msdn.microsoft.com/en-US/windows/)
+//
+// It is by all means not complete (only few functions are there). If you
+// find a function which is missing, please, add it.
 
 /// Mapping of function names to their corresponding names of variables.
-const StringStringUMap &FUNC_VAR_NAME_MAP(initFuncVarNameMap());
+constexpr FuncVarName FUNC_VAR_NAMES[] = {
+	{"ClientToScreen", "clientToScreenSuccess"},
+	{"CloseHandle", "handleClosed"},
+	{"CopyFile", "copyFileSuccess"},
+	{"CopyFileA", "copyFileSuccess"},
+	{"CreateFile", "fileHandle"},
+	{"CreateFileA", "fileHandle"},
+	{"CreateThread", "threadHandle"},
+	{"CreateWindowEx", "windowHandle"},
+	{"CreateWindowExA", "windowHandle"},
+	{"EqualRect", "equalRect"},
+	{"GetActiveWindow", "windowHandle"},
+	{"GetBkColor", "color"},
+	{"GetBkMode", "mode"},
+	{"GetCommandLine", "commandLine"},
+	{"GetCommandLineA", "commandLine"},
+	{"GetCurrentProcess", "processHandle"},
+	{"GetCurrentProcessId", "processId"},
+	{"GetCurrentThread", "threadHandle"},
+	{"GetCurrentThreadId", "threadId"},
+	{"GetDriveType", "driveType"},
+	{"GetDriveTypeA", "driveType"},
+	{"GetFocus", "windowHandle"},
+	{"GetForegroundWindow", "windowHandle"},
+	{"GetLastError", "errorCode"},
+	{"GetLogicalDrives", "availDiskDrives"},
+	{"GetModuleFileName", "nameSize"},
+	{"GetModuleFileNameA", "nameSize"},
+	{"GetModuleHandle", "moduleHandle"},
+	{"GetModuleHandleA", "moduleHandle"},
+	{"GetProcAddress", "func"},
+	{"GetSystemDefaultLangID", "langId"},
+	{"GetTempPath", "pathSize"},
+	{"GetTempPathA", "pathSize"},
+	{"GetThreadPriority", "threadPriority"},
+	{"IsValidCodePage", "validCodePage"},
+	{"IsWindowVisible", "isVisible"},
+	{"LoadCursor", "cursorHandle"},
+	{"LoadCursorA", "cursorHandle"},
+	{"LoadIcon", "iconHandle"},
+	{"LoadIconA", "iconHandle"},
+	{"LoadLibrary", "moduleHandle"},
+	{"LoadLibraryA", "moduleHandle"},
+	{"LocalAlloc", "memoryHandle"},
+	{"RegisterClassEx", "classAtom"},
+	{"RegisterClassExA", "classAtom"},
+	{"SetTimer", "timerId"},
+	{"SetUnhandledExceptionFilter", "prevExceptionFilter"},
+	{"VirtualAlloc", "memory"},
+};
+static_assert(FuncVarNameTable(FUNC_VAR_NAMES).isSorted(),
+	"FUNC_VAR_NAMES has to be sorted by scripts/llvmir2hll/sort_semantics_tables.py");
 
 } // anonymous namespace
 
@@ -92,8 +83,8 @@ const StringStringUMap &FUNC_VAR_NAME_MAP(initFuncVarNameMap());
 *
 * See its description for more details.
 */
-std::optional<std::string> getNameOfVarStoringResult(const std::string &funcName) {
-	return getNameOfVarStoringResultFromMap(funcName, FUNC_VAR_NAME_MAP);
+std::optional<std::string_view> getNameOfVarStoringResult(const std::string &funcName) {
+	return getNameOfVarStoringResultFromTable(funcName, FUNC_VAR_NAMES);
 }
 
 } // namespace win_api
@@ -15,78 +15,52 @@ namespace win_api {
 
 namespace {
 
-/**
-* @brief This function is used to initialize FUNC_PARAMS_MAP later in the file.
-*/
-const FuncParamsMap &initFuncParamsMap() {
-	static FuncParamsMap funcParamsMap;
-
-	// Temporary maps used to store the symbols for the current parameter of
-	// the current function. In this way, we don't have to keep separate maps
-	// for every function and every parameter. The only downside is that before
-	// adding new data into it, it has to be cleared.
-	ParamSymbolsMap paramSymbolsMap;
-	IntStringMap symbolicNamesMap;
+constexpr SymbolicName HKEYS[] = {
+	// Info from: <winreg.h>
+	//
+	// We have to use -2147483647 - 1 instead of -2147483648 because the latter
+	// is recognized as 2147483648, and only negated afterwards. This use of
+	// -2147483648 issues a warning on some compilers. See
+	// http://stackoverflow.com/q/9941261/2580955
+	{-2147483647 - 1, "HKEY_CLASSES_ROOT"},
+	{-2147483647, "HKEY_CURRENT_USER"},
+	{-2147483646, "HKEY_LOCAL_MACHINE"},
+	{-2147483645, "HKEY_USRS"},
+	{-2147483644, "HKEY_PERFORMANCE_DATA"},
+	{-2147483643, "HKEY_CURRENT_CONFIG"},
+	{-2147483642, "HKEY_DYN_DATA"},
+};
 
+/// Mapping of function names into symbolic names of their parameters.
+constexpr FuncParamSymbolicNames FUNC_PARAMS_SYMBOLIC_NAMES[] = {
 	//
 	// #include <windows.h>
-	// LONG WINAPI RegOpenKey(HKEY hKey, /* other parameters */);
-	// LONG WINAPI RegOpenKeyEx(HKEY hKey, /* other parameters */);
-	// LONG WINAPI RegOpenKeyExA(HKEY hKey, /* other parameters */);
-	// LONG WINAPI RegOpenKeyExW(HKEY hKey, /* other parameters */);
-	// LONG WINAPI RegSetKeyValue(HKEY hKey, /* other parameters */);
-	// LONG WINAPI RegSetKeyValueA(HKEY hKey, /* other parameters */);
-	// LONG WINAPI RegSetKeyValueW(HKEY hKey, /* other parameters */);
 	// LONG WINAPI RegCreateKey(HKEY hKey, /* other parameters */);
-	// LONG WINAPI RegCreateKeyA(HKEY hKey, /* other parameters */);
-	// LONG WINAPI RegCreateKeyW(HKEY hKey, /* other parameters */);
 	// LONG WINAPI RegCreateKeyEx(HKEY hKey, /* other parameters */);
-	// LONG WINAPI RegCreateKeyExA(HKEY hKey, /* other parameters */);
-	// LONG WINAPI RegCreateKeyExW(HKEY hKey, /* other parameters */);
 	// LONG WINAPI RegOpenKey(HKEY hKey, /* other parameters */);
-	// LONG WINAPI RegOpenKeyA(HKEY hKey, /* other parameters */);
-	// LONG WINAPI RegOpenKeyW(HKEY hKey, /* other parameters */);
 	// LONG WINAPI RegOpenKeyEx(HKEY hKey, /* other parameters */);
-	// LONG WINAPI RegOpenKeyExA(HKEY hKey, /* other parameters */);
-	// LONG WINAPI RegOpenKeyExW(HKEY hKey, /* other parameters */);
+	// LONG WINAPI RegSetKeyValue(HKEY hKey, /* other parameters */);
 	//
-	// Info from: <winreg.h>
+	// The same holds for the A and W variants of these functions.
 	//
-	paramSymbolsMap.clear();
-	// hKey
-	symbolicNamesMap.clear();
-	// We have to use -2147483647 - 1 instead of -2147483648 because the latter
-	// is recognized as 2147483648, and only negated afterwards. This use of
-	// -2147483648 issues a warning on some compilers. See
-	// http://stackoverflow.com/q/9941261/2580955
-	symbolicNamesMap[-2147483647 - 1] = "HKEY_CLASSES_ROOT";
-	symbolicNamesMap[-2147483647] = "HKEY_CURRENT_USER";
-	symbolicNamesMap[-2147483646] = "HKEY_LOCAL_MACHINE";
-	symbolicNamesMap[-2147483645] = "HKEY_USRS";
-	symbolicNamesMap[-2147483644] = "HKEY_PERFORMANCE_DATA";
-	symbolicNamesMap[-2147483643] = "HKEY_CURRENT_CONFIG";
-	symbolicNamesMap[-2147483642] = "HKEY_DYN_DATA";
-	paramSymbolsMap[1] = symbolicNamesMap;
-	funcParamsMap["RegOpenKey"] = paramSymbolsMap;
-	funcParamsMap["RegOpenKey"] = paramSymbolsMap;
-	funcParamsMap["RegOpenKeyEx"] = paramSymbolsMap;
-	funcParamsMap["RegOpenKeyExA"] = paramSymbolsMap;
-	funcParamsMap["RegOpenKeyExW"] = paramSymbolsMap;
-	funcParamsMap["RegSetKeyValue"] = paramSymbolsMap;
-	funcParamsMap["RegSetKeyValueA"] = paramSymbolsMap;
-	funcParamsMap["RegSetKeyValueW"] = paramSymbolsMap;
-	funcParamsMap["RegCreateKey"] = paramSymbolsMap;
-	funcParamsMap["RegCreateKeyA"] = paramSymbolsMap;
-	funcParamsMap["RegCreateKeyW"] = paramSymbolsMap;
-	funcParamsMap["RegCreateKeyEx"] = paramSymbolsMap;
-	funcParamsMap["RegCreateKeyExA"] = paramSymbolsMap;
-	funcParamsMap["RegCreateKeyExW"] = paramSymbolsMap;
-
-	return funcParamsMap;
-}
-
-/// Mapping of function names into symbolic names of their parameters.
-const FuncParamsMap &FUNC_PARAMS_MAP(initFuncParamsMap());
+	{"RegCreateKey", 1, HKEYS}, // hKey
+	{"RegCreateKeyA", 1, HKEYS}, // hKey
+	{"RegCreateKeyEx", 1, HKEYS}, // hKey
+	{"RegCreateKeyExA", 1, HKEYS}, // hKey
+	{"RegCreateKeyExW", 1, HKEYS}, // hKey
+	{"RegCreateKeyW", 1, HKEYS}, // hKey
+	{"RegOpenKey", 1, HKEYS}, // hKey
+	{"RegOpenKeyA", 1, HKEYS}, // hKey
+	{"RegOpenKeyEx", 1, HKEYS}, // hKey
+	{"RegOpenKeyExA", 1, HKEYS}, // hKey
+	{"RegOpenKeyExW", 1, HKEYS}, // hKey
+	{"RegOpenKeyW", 1, HKEYS}, // hKey
+	{"RegSetKeyValue", 1, HKEYS}, // hKey
+	{"RegSetKeyValueA", 1, HKEYS}, // hKey
+	{"RegSetKeyValueW", 1, HKEYS}, // hKey
+};
+static_assert(FuncParamSymbolicNamesTable(FUNC_PARAMS_SYMBOLIC_NAMES).isSorted(),
+	"FUNC_PARAMS_SYMBOLIC_NAMES has to be sorted by scripts/llvmir2hll/sort_semantics_tables.py");
 
 } // anonymous namespace
 
@@ -95,9 +69,10 @@ const FuncParamsMap &FUNC_PARAMS_MAP(initFuncParamsMap());
 *
 * See its description for more details.
 */
-std::optional<IntStringMap> getSymbolicNamesForParam(const std::string &funcName,
+const IntStringMap *getSymbolicNamesForParam(const std::string &funcName,
 		unsigned paramPos) {
-	return getSymbolicNamesForParamFromMap(funcName, paramPos, FUNC_PARAMS_MAP);
+	return getSymbolicNamesForParamFromTable(funcName, paramPos,
+		FUNC_PARAMS_SYMBOLIC_NAMES);
 }
 
 } // namespace win_api
@@ -146,7 +146,7 @@ void ConstSymbolConverter::convertArgsToSymbolicNames(
 			continue;
 		}
 
-		std::optional<IntStringMap> symbolicNamesMap(
+		const IntStringMap *symbolicNamesMap(
 			module->getSemantics()->getSymbolicNamesForParam(
 				calledFuncName, currArgPos));
 		if (!symbolicNamesMap) {
@@ -156,7 +156,7 @@ void ConstSymbolConverter::convertArgsToSymbolicNames(
 
 		// Perform the conversion of the argument.
 		ShPtr<Expression> newArg(convertArgToSymbolicNames(
-			argAsConstInt, symbolicNamesMap.value()));
+			argAsConstInt, *symbolicNamesMap));
 		callExpr->setArg(currArgPos - 1, newArg); // index starts at 0
 	}
 }
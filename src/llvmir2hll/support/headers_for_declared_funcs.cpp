@@ -31,10 +31,10 @@ StringSet HeadersForDeclaredFuncs::getHeaders(ShPtr<Module> module) {
 	StringSet headers;
 	for (auto i = module->func_declaration_begin(),
 			e = module->func_declaration_end(); i != e; ++i) {
-		std::optional<std::string> header(
+		std::optional<std::string_view> header(
 			module->getSemantics()->getCHeaderFileForFunc((*i)->getName()));
 		if (header) {
-			headers.insert(header.value());
+			headers.emplace(header.value());
 		}
 	}
 	return headers;
@@ -5,6 +5,8 @@
 */
 
 #include <optional>
+#include <set>
+#include <string_view>
 
 #include "retdec/llvmir2hll/ir/function.h"
 #include "retdec/llvmir2hll/ir/module.h"
@@ -21,6 +23,9 @@ namespace llvmir2hll {
 
 namespace {
 
+/// Views of header names, which can be looked up without creating strings.
+using HeaderViews = std::set<std::string_view>;
+
 /**
 * @brief Is the given function from a standard library?
 *
@@ -29,8 +34,8 @@ namespace {
 * @param[in] headers Headers for declared functions in the module.
 */
 bool isLibraryFunc(ShPtr<Function> func, ShPtr<Module> module,
-		const StringSet &headers) {
-	std::optional<std::string> header(
+		const HeaderViews &headers) {
+	std::optional<std::string_view> header(
 		module->getSemantics()->getCHeaderFileForFunc(func->getName())
 	);
 	if (!header) {
@@ -90,6 +95,7 @@ FuncVector LibraryFuncsRemover::removeFuncs(ShPtr<Module> module) {
 	// (1) First, we obtain the headers of all declared functions in the module.
 	//
 	StringSet headers(HeadersForDeclaredFuncs::getHeaders(module));
+	HeaderViews headerViews(headers.begin(), headers.end());
 
 	// (2) Then, we check which of the defined functions are from some of the
 	//     headers obtained in step (1). This is done by checking whether there
@@ -98,7 +104,7 @@ FuncVector LibraryFuncsRemover::removeFuncs(ShPtr<Module> module) {
 	for (auto i = module->func_definition_begin(), e = module->func_definition_end();
 			i != e; ++i) {
 		const auto &func = *i;
-		if (isLibraryFunc(func, module, headers)) {
+		if (isLibraryFunc(func, module, headerViews)) {
 			markAsLibraryFunc(func, module);
 			removedFuncs.push_back(func);
 		}
@@ -296,10 +296,10 @@ void ReadableVarRenamer::tryRenameVarStoringCallResult(ShPtr<Statement> stmt) {
 		return;
 	}
 
-	std::optional<std::string> newName(module->getSemantics()->getNameOfVarStoringResult(
-		calledFunc->getName()));
+	std::optional<std::string_view> newName(
+		module->getSemantics()->getNameOfVarStoringResult(calledFunc->getName()));
 	if (newName) {
-		assignName(lhsVar, newName.value(), currFunc);
+		assignName(lhsVar, std::string(newName.value()), currFunc);
 	}
 }
 
@@ -345,10 +345,10 @@ void ReadableVarRenamer::tryRenameVarPassedAsArgToFuncCall(
 		return;
 	}
 
-	std::optional<std::string> newName(module->getSemantics()->getNameOfParam(
+	std::optional<std::string_view> newName(module->getSemantics()->getNameOfParam(
 		calledFunc->getName(), argPos));
 	if (newName) {
-		assignName(var, newName.value(), currFunc);
+		assignName(var, std::string(newName.value()), currFunc);
 	}
 }
 
@@ -17,6 +17,24 @@ using namespace retdec::utils;
 namespace retdec {
 namespace loader {
 
+namespace {
+
+/**
+ * Read integer of type @a T and store it into 64-bit result.
+ */
+template <typename T>
+bool readInto(const Image& image, std::uint64_t address, std::uint64_t& res, Endianness e)
+{
+	T val = 0;
+	if (!image.read(address, val, e))
+		return false;
+
+	res = val;
+	return true;
+}
+
+} // anonymous namespace
+
 Image::Image(const std::shared_ptr<retdec::fileformat::FileFormat>& fileFormat) : _fileFormat(fileFormat), _segments(),
 	_baseAddress(0), _namelessSegNameGen("seg", '0', 4), _statusMessage()
 {
@@ -330,19 +348,37 @@ std::pair<const std::uint8_t*, std::uint64_t> Image::getRawSegmentData(std::uint
  */
 bool Image::getXByte(std::uint64_t address, std::uint64_t x, std::uint64_t& res, Endianness e/* = UNKNOWN*/) const
 {
-	const auto *seg = getSegmentFromAddress(address);
-	if (!seg || x * getByteLength() > sizeof(res) * CHAR_BIT)
+	if (x == 0 || x * getByteLength() > sizeof(res) * CHAR_BIT)
 	{
 		return false;
 	}
 
-	std::vector<std::uint8_t> data;
-	if (!seg->getBytes(data, address - seg->getAddress(), x) || data.size() != x)
+	if (getByteLength() == CHAR_BIT)
+	{
+		switch (x)
+		{
+			case 1: return readInto<std::uint8_t>(*this, address, res, e);
+			case 2: return readInto<std::uint16_t>(*this, address, res, e);
+			case 4: return readInto<std::uint32_t>(*this, address, res, e);
+			case 8: return readInto<std::uint64_t>(*this, address, res, e);
+			default: break;
+		}
+	}
+
+	std::uint8_t data[sizeof(res) * CHAR_BIT];
+	if (!readBytes(address, x, data) || !resolveEndianness(e))
 	{
 		return false;
 	}
 
-	return createValueFromBytes(data, res, e);
+	res = 0;
+	for (std::uint64_t i = 0; i < x; ++i)
+	{
+		res += static_cast<std::uint64_t>(data[i])
+				<< (getByteLength() * (e == Endianness::LITTLE ? i : x - i - 1));
+	}
+
+	return true;
 }
 
 /**
@@ -371,6 +407,39 @@ bool Image::getXBytes(std::uint64_t address, std::uint64_t x, std::vector<std::u
 	return true;
 }
 
+/**
+ * Read exactly @a x bytes from specified address into the provided buffer.
+ * Bytes are copied directly from the segment's data, nothing is allocated.
+ *
+ * @param address Address to read bytes from
+ * @param x       Number of bytes to read
+ * @param res     Buffer of at least @a x bytes for the result
+ *
+ * @return Status of operation (@c true if all is OK, @c false otherwise)
+ */
+bool Image::readBytes(std::uint64_t address, std::uint64_t x, std::uint8_t* res) const
+{
+	const auto *seg = getSegmentFromAddress(address);
+	return seg && seg->getBytes(res, address - seg->getAddress(), x);
+}
+
+/**
+ * Get pointer to @a x bytes located at specified address without copying them.
+ * The pointer points directly into the segment's data and stays valid as long
+ * as the segment does.
+ *
+ * @param address Address of the first byte
+ * @param x       Number of bytes that must be available
+ *
+ * @return Pointer to the bytes or @c nullptr if they are not all physically
+ *         present in one segment.
+ */
+const std::uint8_t* Image::getRawBytes(std::uint64_t address, std::uint64_t x) const
+{
+	const auto *seg = getSegmentFromAddress(address);
+	return seg ? seg->getRawBytes(address - seg->getAddress(), x) : nullptr;
+}
+
 bool Image::setXByte(std::uint64_t address, std::uint64_t x, std::uint64_t val, retdec::utils::Endianness e/* = retdec::utils::Endianness::UNKNOWN*/)
 {
 	const auto *seg = getSegmentFromAddress(address);
@@ -400,7 +469,10 @@ bool Image::setXBytes(std::uint64_t address, const std::vector<std::uint8_t>& va
 }
 
 /**
- * Find out, if there is a pointer (valid address) on the provided address
+ * Find out, if there is a pointer (valid address) on the provided address.
+ * The first call builds the pointer map of the whole image (see
+ * @c getPointerMap()), i.e. it scans all the segments. Following calls only
+ * look the address up in the map, until the image is changed.
  * @param address Address to check
  * @param pointer If not @c nullptr, and there is a pointer on @p address, then
  *                set the pointer value to where this parameter points.
@@ -408,6 +480,18 @@ bool Image::setXBytes(std::uint64_t address, const std::vector<std::uint8_t>& va
  */
 bool Image::isPointer(std::uint64_t address, std::uint64_t* pointer) const
 {
+	const auto* seg = getSegmentFromAddress(address);
+	if (!seg)
+	{
+		return false;
+	}
+
+	bool result = false;
+	if (getPointerMap()->lookup(seg, address, result, pointer))
+	{
+		return result;
+	}
+
 	std::uint64_t val = 0;
 	if (getWord(address, val) && hasDataOnAddress(val))
 	{
@@ -420,6 +504,25 @@ bool Image::isPointer(std::uint64_t address, std::uint64_t* pointer) const
 	return false;
 }
 
+/**
+ * Get map of all pointers in the image. It is created when it is needed for
+ * the first time -- all segments are scanned at once, so any number of
+ * @c isPointer() queries then costs only a segment lookup and a bit test.
+ *
+ * @return Pointer map, it stays valid even if the image changes.
+ */
+std::shared_ptr<const PointerMap> Image::getPointerMap() const
+{
+	auto map = std::atomic_load(&_pointerMap);
+	if (!map)
+	{
+		map = std::make_shared<const PointerMap>(*this);
+		std::atomic_store(&_pointerMap, map);
+	}
+
+	return map;
+}
+
 const std::string& Image::getStatusMessage() const
 {
 	return _statusMessage;
@@ -437,7 +540,9 @@ const retdec::fileformat::LoaderErrorInfo & Image::getLoaderErrorInfo() const
 
 Segment* Image::insertSegment(std::unique_ptr<Segment> segment)
 {
+	segment->_image = this;
 	_segments.push_back(std::move(segment));
+	invalidateSegmentIndex();
 
 	// We have used move constructor, segment is no longer valid pointer
 	// Now give segment name
@@ -453,6 +558,7 @@ void Image::removeSegment(Segment* segment)
 		if (itr->get() == segment)
 		{
 			_segments.erase(itr);
+			invalidateSegmentIndex();
 			return;
 		}
 	}
@@ -472,6 +578,48 @@ void Image::sortSegments()
 			{
 				return seg1->getAddress() < seg2->getAddress();
 			});
+	invalidateSegmentIndex();
+}
+
+/**
+ * Drop the address to segment index and the pointer map. They are recreated
+ * on the next lookup. Must be called whenever segments are added, removed,
+ * reordered, moved or resized. Segments of the image call it themselves when
+ * they are resized.
+ */
+void Image::invalidateSegmentIndex()
+{
+	std::atomic_store(&_segmentIndex, std::shared_ptr<const retdec::common::RegionIndex<Segment>>());
+	invalidatePointerMap();
+}
+
+/**
+ * Drop the pointer map. It is recreated on the next query. Segments of the
+ * image call it whenever their data change.
+ */
+void Image::invalidatePointerMap()
+{
+	std::atomic_store(&_pointerMap, std::shared_ptr<const PointerMap>());
+}
+
+/**
+ * Replace unknown endian with the file's endian.
+ *
+ * @param e Endian to resolve
+ *
+ * @return @c false if the endian is unknown and so is the file's one
+ */
+bool Image::resolveEndianness(Endianness& e) const
+{
+	if (e != Endianness::UNKNOWN)
+		return true;
+
+	if (isLittleEndian())
+		e = Endianness::LITTLE;
+	else if (isBigEndian())
+		e = Endianness::BIG;
+
+	return e != Endianness::UNKNOWN;
 }
 
 const Segment* Image::_getSegment(std::size_t index) const
@@ -506,13 +654,24 @@ const Segment* Image::_getSegmentWithIndex(std::size_t index) const
 
 const Segment* Image::_getSegmentFromAddress(std::uint64_t address) const
 {
-	for (const auto& segment : getSegments())
+	auto index = std::atomic_load(&_segmentIndex);
+	if (!index || index->getNumberOfRegions() != _segments.size())
 	{
-		if (segment->containsAddress(address))
-			return segment.get();
+		// The first segment containing the address wins -> no segment is
+		// better than the other one, the order decides.
+		std::vector<retdec::common::RegionIndex<Segment>::Region> regions;
+		regions.reserve(_segments.size());
+		for (const auto& segment : _segments)
+		{
+			regions.push_back({segment->getAddress(), segment->getEndAddress(), segment.get()});
+		}
+		index = std::make_shared<const retdec::common::RegionIndex<Segment>>(
+				regions,
+				[](const auto&, const auto&) { return false; });
+		std::atomic_store(&_segmentIndex, index);
 	}
 
-	return nullptr;
+	return index->find(address);
 }
 
 } // namespace loader
@@ -0,0 +1,299 @@
+/**
+ * @file src/loader/loader/pointer_map.cpp
+ * @brief Implementation of map of pointers stored in loadable image.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <algorithm>
+#include <bitset>
+#include <climits>
+#include <cstring>
+#include <limits>
+
+#include "retdec/utils/conversion.h"
+#include "retdec/utils/system.h"
+#include "retdec/loader/loader/image.h"
+#include "retdec/loader/loader/pointer_map.h"
+
+using namespace retdec::utils;
+
+namespace retdec {
+namespace loader {
+
+namespace {
+
+const std::uint64_t BITS = 64;
+
+std::size_t countBits(std::uint64_t bits)
+{
+	return std::bitset<BITS>(bits).count();
+}
+
+std::size_t lowestBit(std::uint64_t bits)
+{
+	return countBits((bits & (~bits + 1)) - 1);
+}
+
+/**
+ * Read word of type @a T from raw bytes.
+ */
+template <typename T>
+std::uint64_t load(const std::uint8_t* bytes, bool swap)
+{
+	T val;
+	std::memcpy(&val, bytes, sizeof(T));
+	return swap ? byteSwap(val) : val;
+}
+
+/**
+ * Read @a count words of @a wordSize bytes from raw bytes into @a res.
+ */
+void loadWords(const std::uint8_t* bytes, std::size_t count, std::size_t wordSize, bool swap, std::uint64_t* res)
+{
+	switch (wordSize)
+	{
+		case 1:
+			for (std::size_t i = 0; i < count; ++i)
+				res[i] = bytes[i];
+			break;
+		case 2:
+			for (std::size_t i = 0; i < count; ++i)
+				res[i] = load<std::uint16_t>(bytes + 2 * i, swap);
+			break;
+		case 4:
+			for (std::size_t i = 0; i < count; ++i)
+				res[i] = load<std::uint32_t>(bytes + 4 * i, swap);
+			break;
+		case 8:
+			for (std::size_t i = 0; i < count; ++i)
+				res[i] = load<std::uint64_t>(bytes + 8 * i, swap);
+			break;
+		default:
+			break;
+	}
+}
+
+} // anonymous namespace
+
+/**
+ * Scan all the segments of the image and find pointers in them.
+ *
+ * @param image Image to scan, its segments must be already loaded.
+ */
+PointerMap::PointerMap(const Image& image)
+{
+	auto wordSize = image.getBytesPerWord();
+	if (image.getByteLength() != CHAR_BIT
+			|| (wordSize != 1 && wordSize != 2 && wordSize != 4 && wordSize != 8)
+			|| (!image.isLittleEndian() && !image.isBigEndian()))
+	{
+		return;
+	}
+	_wordSize = wordSize;
+
+	// Segments sorted by their addresses, to find overlapping ones.
+	std::vector<const Segment*> segments;
+	for (const auto& segment : image.getSegments())
+	{
+		if (segment->getSize() != 0)
+			segments.push_back(segment.get());
+	}
+	std::sort(segments.begin(), segments.end(), [](const Segment* s1, const Segment* s2)
+			{
+				return s1->getAddress() < s2->getAddress();
+			});
+
+	// Values between the lowest and the highest address of segments with data
+	// may be pointers.
+	std::uint64_t low = std::numeric_limits<std::uint64_t>::max();
+	std::uint64_t high = 0;
+	for (auto* segment : segments)
+	{
+		if (segment->getSecSeg() && !segment->getSecSeg()->isDebug())
+		{
+			low = std::min(low, segment->getAddress());
+			high = std::max(high, segment->getEndAddress());
+		}
+	}
+	if (low >= high)
+	{
+		low = high = 0;
+	}
+
+	std::uint64_t prevEnd = 0;
+	for (std::size_t i = 0; i < segments.size(); ++i)
+	{
+		auto* segment = segments[i];
+		bool overlaps = (i > 0 && segment->getAddress() < prevEnd)
+				|| (i + 1 < segments.size() && segments[i + 1]->getAddress() < segment->getEndAddress());
+		prevEnd = std::max(prevEnd, segment->getEndAddress());
+		if (!overlaps)
+		{
+			mapSegment(image, segment, low, high, _segments[segment]);
+		}
+	}
+}
+
+/**
+ * Find pointers in one segment. Words are read directly from the segment's
+ * data and only values in <@a low, @a high) are looked up in the image.
+ */
+void PointerMap::mapSegment(const Image& image, const Segment* segment, std::uint64_t low, std::uint64_t high, SegmentPointers& pointers)
+{
+	static const bool hostIsLittle = isLittleEndian();
+	const bool swap = image.isLittleEndian() != hostIsLittle;
+
+	pointers.address = segment->getAddress();
+	pointers.slots = segment->getSize() / _wordSize;
+	pointers.bits.assign((pointers.slots + BITS - 1) / BITS, 0);
+	pointers.ranks.assign(pointers.bits.size(), 0);
+
+	// Slots before rawSlots have all their bytes in the raw data, slots from
+	// zeroSlots are after the raw data (segment is filled with zeroes there).
+	auto raw = segment->getRawData();
+	std::uint64_t rawSize = raw.first ? raw.second : 0;
+	std::uint64_t rawSlots = rawSize / _wordSize;
+	std::uint64_t zeroSlots = (rawSize + _wordSize - 1) / _wordSize;
+	std::uint32_t rank = 0;
+
+	std::uint64_t values[BITS];
+	for (std::uint64_t block = 0; block < pointers.bits.size(); ++block)
+	{
+		auto first = block * BITS;
+		auto count = std::min(BITS, pointers.slots - first);
+
+		// Read all the words in the block.
+		auto fromRaw = first < rawSlots ? std::min(count, rawSlots - first) : 0;
+		if (fromRaw)
+		{
+			loadWords(raw.first + first * _wordSize, fromRaw, _wordSize, swap, values);
+		}
+		std::uint64_t unreadable = 0;
+		for (auto i = fromRaw; i < count; ++i)
+		{
+			auto slot = first + i;
+			if (slot >= zeroSlots)
+				values[i] = 0;
+			else if (!image.getWord(pointers.address + slot * _wordSize, values[i]))
+				unreadable |= std::uint64_t(1) << i;
+		}
+
+		// Pick the values that may point into the image.
+		std::uint64_t candidates = 0;
+		for (std::uint64_t i = 0; i < count; ++i)
+		{
+			candidates |= std::uint64_t(values[i] - low < high - low) << i;
+		}
+		candidates &= ~unreadable;
+
+		// Check them.
+		std::uint64_t bits = 0;
+		for (; candidates; candidates &= candidates - 1)
+		{
+			auto i = lowestBit(candidates);
+			if (image.hasDataOnAddress(values[i]))
+			{
+				bits |= std::uint64_t(1) << i;
+				pointers.targets.push_back(values[i]);
+			}
+		}
+
+		pointers.bits[block] = bits;
+		pointers.ranks[block] = rank;
+		rank += countBits(bits);
+	}
+
+	_numberOfPointers += rank;
+}
+
+/**
+ * Find out if there is a pointer on the provided address.
+ *
+ * @param segment Segment containing @a address (as returned by
+ *        @c Image::getSegmentFromAddress()).
+ * @param address Address to check.
+ * @param isPointer Set to @c true if there is a pointer on @a address.
+ * @param pointer If not @c nullptr and there is a pointer on @a address, set
+ *        to the pointer value.
+ *
+ * @return @c True if the map knows the answer, @c false if the address is not
+ *         a mapped slot and the image must be read.
+ */
+bool PointerMap::lookup(const Segment* segment, std::uint64_t address, bool& isPointer, std::uint64_t* pointer) const
+{
+	std::uint64_t slot = 0;
+	auto* pointers = getSegmentPointers(segment, address, slot);
+	if (!pointers)
+	{
+		return false;
+	}
+
+	auto block = slot / BITS;
+	auto mask = std::uint64_t(1) << (slot % BITS);
+	isPointer = pointers->bits[block] & mask;
+	if (isPointer && pointer)
+	{
+		*pointer = pointers->targets[pointers->ranks[block] + countBits(pointers->bits[block] & (mask - 1))];
+	}
+	return true;
+}
+
+/**
+ * Skip slots without pointers.
+ *
+ * @param segment Segment containing @a address.
+ * @param address Address of the first slot to check.
+ *
+ * @return Address of the first slot with pointer at or after @a address.
+ *         If there is none, the address after the last mapped slot. If
+ *         @a address is not a mapped slot, @a address itself. All slots
+ *         before the returned address are mapped and have no pointers.
+ */
+std::uint64_t PointerMap::skipToPointer(const Segment* segment, std::uint64_t address) const
+{
+	std::uint64_t slot = 0;
+	auto* pointers = getSegmentPointers(segment, address, slot);
+	if (!pointers)
+	{
+		return address;
+	}
+
+	auto block = slot / BITS;
+	auto bits = pointers->bits[block] & (~std::uint64_t(0) << (slot % BITS));
+	while (!bits && ++block < pointers->bits.size())
+	{
+		bits = pointers->bits[block];
+	}
+
+	slot = bits ? block * BITS + lowestBit(bits) : pointers->slots;
+	return pointers->address + slot * _wordSize;
+}
+
+/**
+ * @return Number of pointers in all mapped segments.
+ */
+std::size_t PointerMap::getNumberOfPointers() const
+{
+	return _numberOfPointers;
+}
+
+const PointerMap::SegmentPointers* PointerMap::getSegmentPointers(const Segment* segment, std::uint64_t address, std::uint64_t& slot) const
+{
+	auto it = _segments.find(segment);
+	if (it == _segments.end() || address < it->second.address)
+	{
+		return nullptr;
+	}
+
+	auto offset = address - it->second.address;
+	slot = offset / _wordSize;
+	if (offset % _wordSize || slot >= it->second.slots)
+	{
+		return nullptr;
+	}
+
+	return &it->second;
+}
+
+} // namespace loader
+} // namespace retdec
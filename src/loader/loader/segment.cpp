@@ -8,6 +8,7 @@
 #include <cstring>
 
 #include "retdec/utils/conversion.h"
+#include "retdec/loader/loader/image.h"
 #include "retdec/loader/loader/segment.h"
 
 namespace retdec {
@@ -207,6 +208,60 @@ bool Segment::getBytes(std::vector<unsigned char>& result, std::uint64_t address
 	return true;
 }
 
+/**
+ * Get content of segment as bytes into the provided buffer. Unlike the vector
+ * variant, this succeeds only if exactly @a size bytes are available.
+ * Nothing is allocated.
+ *
+ * @param result Buffer of at least @a size bytes for the read bytes.
+ * @param addressOffset First byte of the segment to be read (0 means first byte of segment).
+ * @param size Number of bytes for read.
+ *
+ * @return True if read was successful, otherwise false.
+ */
+bool Segment::getBytes(std::uint8_t* result, std::uint64_t addressOffset, std::uint64_t size) const
+{
+	if (addressOffset >= getSize())
+		return false;
+
+	// Same amount of data as the vector variant would return -- data from
+	// data source and zeroes up to the end of the segment.
+	std::uint64_t loaded = 0;
+	if (_dataSource && _dataSource->isDataSet() && addressOffset < _dataSource->getDataSize())
+		loaded = std::min(size, _dataSource->getDataSize() - addressOffset);
+	auto available = std::max(loaded, std::min(size, getSize() - addressOffset));
+	if (available != size)
+		return false;
+
+	if (loaded)
+		std::memcpy(result, _dataSource->getData() + addressOffset, loaded);
+	std::memset(result + loaded, 0, size - loaded);
+	return true;
+}
+
+/**
+ * Get pointer to content of segment without copying it.
+ *
+ * @param addressOffset First byte of the segment (0 means first byte of segment).
+ * @param size Number of bytes that must be available.
+ *
+ * @return Pointer to @a size bytes or @c nullptr if the bytes are not all
+ *         physically present (e.g. they are partially out of the segment or
+ *         in its zero-filled part).
+ */
+const std::uint8_t* Segment::getRawBytes(std::uint64_t addressOffset, std::uint64_t size) const
+{
+	if (addressOffset >= getSize() || size > getSize() - addressOffset
+			|| !_dataSource || !_dataSource->isDataSet())
+		return nullptr;
+
+	auto dataSize = _dataSource->getDataSize();
+	if (addressOffset >= dataSize || size > dataSize - addressOffset)
+		return nullptr;
+
+	return _dataSource->getData() + addressOffset;
+}
+
 /**
  * Get content of segment as bits in string representation.
  *
@@ -247,6 +302,9 @@ bool Segment::setBytes(const std::vector<unsigned char>& value, std::uint64_t ad
 	if (_dataSource != nullptr)
 		_dataSource->saveData(addressOffset, size, value);
 
+	if (_image != nullptr)
+		_image->invalidatePointerMap();
+
 	return true;
 }
 
@@ -261,6 +319,9 @@ void Segment::resize(std::uint64_t newSize)
 
 	if (_dataSource != nullptr)
 		_dataSource->resize(newSize);
+
+	if (_image != nullptr)
+		_image->invalidateSegmentIndex();
 }
 
 /**
@@ -290,6 +351,9 @@ void Segment::shrink(std::uint64_t newAddress, std::uint64_t newSize)
 
 	if (_dataSource != nullptr)
 		_dataSource->shrink(shrinkOffset, newSize);
+
+	if (_image != nullptr)
+		_image->invalidateSegmentIndex();
 }
 
 /**
@@ -0,0 +1,79 @@
+/**
+ * @file src/lticompilertool/lti_compiler.cpp
+ * @brief Compiler of library type information from JSON to binary databases.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "retdec/ctypesparser/binary_ctypes_compiler.h"
+#include "retdec/ctypesparser/binary_ctypes_database.h"
+#include "retdec/utils/io/log.h"
+#include "retdec/utils/version.h"
+
+using namespace std::string_literals;
+using namespace retdec::ctypesparser;
+using namespace retdec::utils;
+using namespace retdec::utils::io;
+
+/**
+ * @brief String constant containing help.
+ */
+const std::string helpmsg =
+	"Usage:\n"
+	"\tretdec-lti-compiler [-h, --help]            | Show this help.\n"
+	"\tretdec-lti-compiler --version               | Show RetDec version.\n"
+	"\tretdec-lti-compiler <input.json> [<output>] | Compile <input.json> to <output>,\n"
+	"\t                                            | which is <input.ltidb> by default.\n";
+
+/**
+ * @brief Main function of the LTI compiler tool.
+ */
+int main(int argc, char *argv[])
+{
+	if (argc <= 1 || argc > 3 || "-h"s == argv[1] || "--help"s == argv[1])
+	{
+		Log::info() << helpmsg;
+		return argc <= 1 || argc > 3 ? 1 : 0;
+	}
+
+	if ("--version"s == argv[1])
+	{
+		Log::info() << version::getVersionStringLong() << std::endl;
+		return 0;
+	}
+
+	std::string inputPath = argv[1];
+	std::string outputPath = argc == 3
+		? argv[2]
+		: BinaryCTypesDatabase::getDatabasePath(inputPath);
+
+	std::ifstream input(inputPath);
+	if (!input)
+	{
+		Log::error() << Log::Error << "cannot open " << inputPath << std::endl;
+		return 1;
+	}
+	std::ofstream output(outputPath, std::ios::binary);
+	if (!output)
+	{
+		Log::error() << Log::Error << "cannot create " << outputPath << std::endl;
+		return 1;
+	}
+
+	try
+	{
+		compileJsonCTypes(input, output);
+	}
+	catch (const CTypesParseError &e)
+	{
+		output.close();
+		std::remove(outputPath.c_str());
+		Log::error() << Log::Error << inputPath << ": " << e.what() << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
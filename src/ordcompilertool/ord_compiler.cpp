@@ -0,0 +1,72 @@
+/**
+ * @file src/ordcompilertool/ord_compiler.cpp
+ * @brief Compiler of directories of ordinal files to packed databases.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "retdec/utils/io/log.h"
+#include "retdec/utils/ordinal_database.h"
+#include "retdec/utils/version.h"
+
+using namespace std::string_literals;
+using namespace retdec::utils;
+using namespace retdec::utils::io;
+
+/**
+ * @brief String constant containing help.
+ */
+const std::string helpmsg =
+	"Usage:\n"
+	"\tretdec-ord-compiler [-h, --help]         | Show this help.\n"
+	"\tretdec-ord-compiler --version            | Show RetDec version.\n"
+	"\tretdec-ord-compiler <input-dir> <output> | Compile all .ord files in <input-dir>\n"
+	"\t                                         | into one database <output>.\n";
+
+/**
+ * @brief Main function of the ordinal compiler tool.
+ */
+int main(int argc, char *argv[])
+{
+	if (argc == 2 && ("-h"s == argv[1] || "--help"s == argv[1]))
+	{
+		Log::info() << helpmsg;
+		return 0;
+	}
+
+	if (argc == 2 && "--version"s == argv[1])
+	{
+		Log::info() << version::getVersionStringLong() << std::endl;
+		return 0;
+	}
+
+	if (argc != 3)
+	{
+		Log::info() << helpmsg;
+		return 1;
+	}
+
+	std::string inputDir = argv[1];
+	std::string outputPath = argv[2];
+
+	std::ofstream output(outputPath, std::ios::binary);
+	if (!output)
+	{
+		Log::error() << Log::Error << "cannot create " << outputPath << std::endl;
+		return 1;
+	}
+
+	if (!OrdinalDatabase::compile(inputDir, output))
+	{
+		output.close();
+		std::remove(outputPath.c_str());
+		Log::error() << Log::Error << "cannot compile ordinals from "
+			<< inputDir << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
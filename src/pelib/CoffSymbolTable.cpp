@@ -71,7 +71,7 @@ namespace PeLib
 		numberOfStoredSymbols = (std::uint32_t)symbolTable.size();
 	}
 
-	int CoffSymbolTable::read(ByteBuffer & fileData, std::size_t uiOffset, std::size_t uiSize)
+	int CoffSymbolTable::read(const std::uint8_t * fileData, std::size_t fileSize, std::size_t uiOffset, std::size_t uiSize)
 	{
 		// Check for overflow
 		if ((uiOffset + uiSize) < uiOffset)
@@ -79,7 +79,7 @@ namespace PeLib
 			return ERROR_INVALID_FILE;
 		}
 
-		std::size_t ulFileSize = fileData.size();
+		std::size_t ulFileSize = fileSize;
 		std::size_t stringTableOffset = uiOffset + uiSize;
 		if (uiOffset >= ulFileSize || stringTableOffset >= ulFileSize)
 		{
@@ -87,7 +87,7 @@ namespace PeLib
 		}
 
 		// Copy part of the file data into symbol table dump
-		symbolTableDump.assign(fileData.begin() + uiOffset, fileData.begin() + uiOffset + uiSize);
+		symbolTableDump.assign(fileData + uiOffset, fileData + uiOffset + uiSize);
 		uiOffset += uiSize;
 
 		InputBuffer ibBuffer(symbolTableDump);
@@ -96,7 +96,7 @@ namespace PeLib
 		if (ulFileSize >= stringTableOffset + 4)
 		{
 			stringTable.resize(sizeof(std::uint32_t));
-			memcpy(&stringTableSize, fileData.data() + stringTableOffset, sizeof(uint32_t));
+			memcpy(&stringTableSize, fileData + stringTableOffset, sizeof(uint32_t));
 			*reinterpret_cast<std::uint32_t *>(stringTable.data()) = stringTableSize;
 			uiOffset = stringTableOffset + sizeof(uint32_t);
 		}
@@ -105,7 +105,7 @@ namespace PeLib
 		{
 			if ((ulFileSize - uiOffset) < 4)
 			{
-				memcpy(&stringTableSize, fileData.data() + stringTableOffset, sizeof(uint32_t));
+				memcpy(&stringTableSize, fileData + stringTableOffset, sizeof(uint32_t));
 			}
 			else if ((ulFileSize - uiOffset) == 4 && stringTableSize < 4)
 			{
@@ -122,7 +122,7 @@ namespace PeLib
 		if (stringTableSize > 4)
 		{
 			stringTable.resize(stringTableSize);
-			memcpy(stringTable.data() + 4, fileData.data() + uiOffset, stringTableSize - 4);
+			memcpy(stringTable.data() + 4, fileData + uiOffset, stringTableSize - 4);
 		}
 
 		read(ibBuffer, uiSize);
@@ -4,6 +4,7 @@
  * @copyright (c) 2020 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
 #include <cstdint>
 #include <iostream>
 #include <fstream>
@@ -222,9 +223,9 @@ std::uint32_t PeLib::ImageLoader::stringLength(
 					std::uint32_t rvaEndPage = (pageIndex + 1) * PELIB_PAGE_SIZE;
 
 					// If zero page, means this is a zeroed page. This is the end of the string.
-					if(page.buffer.empty())
+					if(page.getData() == nullptr)
 						break;
-					dataBegin = dataPtr = page.buffer.data() + (rva & (PELIB_PAGE_SIZE - 1));
+					dataBegin = dataPtr = page.getData() + (rva & (PELIB_PAGE_SIZE - 1));
 
 					// Perhaps the last page loaded?
 					if(rvaEndPage > rvaEnd)
@@ -345,7 +346,8 @@ std::uint32_t PeLib::ImageLoader::readStringRc(
 }
 
 std::uint32_t PeLib::ImageLoader::readStringRaw(
-	ByteBuffer & fileData,
+	const std::uint8_t * fileData,
+	std::size_t fileSize,
 	std::string & str,
 	std::size_t offset,
 	std::size_t maxLength,
@@ -354,19 +356,19 @@ std::uint32_t PeLib::ImageLoader::readStringRaw(
 {
 	std::size_t length = 0;
 
-	if(offset < fileData.size())
+	if(offset < fileSize)
 	{
-		std::uint8_t * stringBegin = fileData.data() + offset;
-		std::uint8_t * stringEnd;
+		const std::uint8_t * stringBegin = fileData + offset;
+		const std::uint8_t * stringEnd;
 
 		// Make sure we won't read past the end of the buffer
-		if((offset + maxLength) > fileData.size())
-			maxLength = fileData.size() - offset;
+		if((offset + maxLength) > fileSize)
+			maxLength = fileSize - offset;
 
 		// Get the length of the string. Do not go beyond the maximum length
 		// Note that there is no guaratee that the string is zero terminated, so can't use strlen
 		// retdec-regression-tests\tools\fileinfo\bugs\issue-451-strange-section-names\4383fe67fec6ea6e44d2c7d075b9693610817edc68e8b2a76b2246b53b9186a1-unpacked
-		stringEnd = (std::uint8_t *)memchr(stringBegin, 0, maxLength);
+		stringEnd = (const std::uint8_t *)memchr(stringBegin, 0, maxLength);
 		if(stringEnd == nullptr)
 		{
 			// No zero terminator means that the string is limited by max length
@@ -412,7 +414,7 @@ std::uint32_t PeLib::ImageLoader::dumpImage(const char * fileName)
 		// Write each page to the file
 		for(auto & page : pages)
 		{
-			dataToWrite = (char *)(page.buffer.size() ? page.buffer.data() : zeroPage);
+			dataToWrite = (char *)(page.getData() ? page.getData() : zeroPage);
 			fs.write(dataToWrite, PELIB_PAGE_SIZE);
 			bytesWritten += PELIB_PAGE_SIZE;
 		}
@@ -916,30 +918,39 @@ PeLib::LoaderError PeLib::ImageLoader::loaderError() const
 int PeLib::ImageLoader::Load(
 	ByteBuffer & fileData,
 	std::uint32_t loadFlags)
+{
+	return Load(fileData.data(), fileData.size(), loadFlags);
+}
+
+int PeLib::ImageLoader::Load(
+	const std::uint8_t * fileData,
+	std::size_t fileSize,
+	std::uint32_t loadFlags)
 {
 	int fileError;
 
 	// Remember the size of the file for later use
-	savedFileSize = fileData.size();
+	savedFileSize = fileSize;
+	headerFixups.clear();
 
 	// Check and capture DOS header
-	fileError = captureDosHeader(fileData);
+	fileError = captureDosHeader(fileData, fileSize);
 	if(fileError != ERROR_NONE)
 		return fileError;
 
 	// Check and capture NT headers. Don't go any fuhrter than here if the NT headers were detected as bad.
 	// Sample: retdec-regression-tests\tools\fileinfo\features\pe-loader-corruptions\001-pe-header-cut-001.ex_
-	fileError = captureNtHeaders(fileData);
+	fileError = captureNtHeaders(fileData, fileSize);
 	if(fileError != ERROR_NONE || ldrError == LDR_ERROR_NTHEADER_OUT_OF_FILE)
 		return fileError;
 
 	// Check and capture section headers
-	fileError = captureSectionHeaders(fileData);
+	fileError = captureSectionHeaders(fileData, fileSize);
 	if(fileError != ERROR_NONE)
 		return fileError;
 
 	// Performed by Vista+
-	if(forceIntegrityCheckEnabled && checkForBadCodeIntegrityImages(fileData))
+	if(forceIntegrityCheckEnabled && checkForBadCodeIntegrityImages(fileData, fileSize))
 		setLoaderError(LDR_ERROR_IMAGE_NON_EXECUTABLE);
 
 	// Shall we map the image content?
@@ -952,7 +963,7 @@ int PeLib::ImageLoader::Load(
 			// If there was no detected image error, map the image as if Windows loader would do
 			if(isImageLoadable())
 			{
-				fileError = captureImageSections(fileData, loadFlags);
+				fileError = captureImageSections(fileData, fileSize, loadFlags);
 
 				// If needed, also perform image load config directory check
 				if(fileError == ERROR_NONE)
@@ -978,7 +989,7 @@ int PeLib::ImageLoader::Load(
 			// we load the content as-is and translate virtual addresses using getFileOffsetFromRva
 			if(pages.size() == 0)
 			{
-				fileError = loadImageAsIs(fileData);
+				fileError = loadImageAsIs(fileData, fileSize);
 			}
 		}
 		catch(const std::bad_alloc&)
@@ -1171,9 +1182,9 @@ void PeLib::ImageLoader::readFromPage(
 	std::size_t bytesInPage)
 {
 	// Is it a page with actual data?
-	if(page.buffer.size())
+	if(page.getData() != nullptr)
 	{
-		memcpy(buffer, page.buffer.data() + offsetInPage, bytesInPage);
+		memcpy(buffer, page.getData() + offsetInPage, bytesInPage);
 	}
 	else
 	{
@@ -1289,22 +1300,41 @@ std::uint32_t PeLib::ImageLoader::readWriteImageFile(
 //
 
 void PeLib::ImageLoader::processSectionHeader(
-	PELIB_IMAGE_SECTION_HEADER * pSectionHeader)
+	const PELIB_IMAGE_SECTION_HEADER & sectionHeader,
+	std::uint32_t headerOffset)
 {
 	// Note: Retdec's regression tests don't like it, because they require section headers to have original data
 	// Also signature verification stops working if we modify the original data
 	if(windowsBuildNumber != 0)
 	{
-		// Fix the section header. Note that this will modify the data in the on-disk version
-		// of the image. Any section that will become mapped to this section header
-		// will have the corresponding DWORD zeroed, as expected.
-		if(pSectionHeader->PointerToRawData != 0 && pSectionHeader->SizeOfRawData == 0)
+		// Fix the section header. The on-disk data are left intact, but any page that
+		// will become mapped to this section header will have the corresponding DWORD zeroed,
+		// as expected. See applyHeaderFixups().
+		if(sectionHeader.PointerToRawData != 0 && sectionHeader.SizeOfRawData == 0)
 		{
-			pSectionHeader->PointerToRawData = 0;
+			headerFixups.push_back(headerOffset + offsetof(PELIB_IMAGE_SECTION_HEADER, PointerToRawData));
 		}
 	}
 }
 
+void PeLib::ImageLoader::applyHeaderFixups(
+	PELIB_FILE_PAGE & page,
+	std::size_t fileOffset,
+	std::size_t length)
+{
+	const std::uint32_t zeroValue = 0;
+
+	for(auto fixupOffset : headerFixups)
+	{
+		std::size_t fixupBegin = std::max<std::size_t>(fixupOffset, fileOffset);
+		std::size_t fixupEnd = std::min<std::size_t>(fixupOffset + sizeof(zeroValue), fileOffset + length);
+
+		// Zero the part of the fixed field that is within the page
+		if(fixupBegin < fixupEnd)
+			page.writeToPage(&zeroValue, fixupBegin - fileOffset, fixupEnd - fixupBegin);
+	}
+}
+
 //-----------------------------------------------------------------------------
 // Processes relocation entry for IA64 relocation bundle
 
@@ -1645,10 +1675,10 @@ void PeLib::ImageLoader::writeNewImageBase(std::uint64_t newImageBase)
 	}
 }
 
-int PeLib::ImageLoader::captureDosHeader(ByteBuffer & fileData)
+int PeLib::ImageLoader::captureDosHeader(const std::uint8_t * fileData, std::size_t fileSize)
 {
-	std::uint8_t * fileBegin = fileData.data();
-	std::uint8_t * fileEnd = fileBegin + fileData.size();
+	const std::uint8_t * fileBegin = fileData;
+	const std::uint8_t * fileEnd = fileBegin + fileSize;
 
 	// Capture the DOS header
 	if((fileBegin + sizeof(PELIB_IMAGE_DOS_HEADER)) >= fileEnd)
@@ -1656,7 +1686,7 @@ int PeLib::ImageLoader::captureDosHeader(ByteBuffer & fileData)
 	memcpy(&dosHeader, fileBegin, sizeof(PELIB_IMAGE_DOS_HEADER));
 
 	// Verify DOS header
-	return verifyDosHeader(dosHeader, fileData.size());
+	return verifyDosHeader(dosHeader, fileSize);
 }
 
 int PeLib::ImageLoader::saveToFile(
@@ -1693,11 +1723,11 @@ int PeLib::ImageLoader::saveDosHeader(
 	return saveToFile(fs, fileOffset, 0, dosHeader.e_lfanew);
 }
 
-int PeLib::ImageLoader::captureNtHeaders(ByteBuffer & fileData)
+int PeLib::ImageLoader::captureNtHeaders(const std::uint8_t * fileData, std::size_t fileSize)
 {
-	std::uint8_t * fileBegin = fileData.data();
-	std::uint8_t * filePtr = fileBegin + dosHeader.e_lfanew;
-	std::uint8_t * fileEnd = fileBegin + fileData.size();
+	const std::uint8_t * fileBegin = fileData;
+	const std::uint8_t * filePtr = fileBegin + dosHeader.e_lfanew;
+	const std::uint8_t * fileEnd = fileBegin + fileSize;
 	std::size_t ntHeaderSize;
 	std::uint16_t optionalHeaderMagic = PELIB_IMAGE_NT_OPTIONAL_HDR32_MAGIC;
 
@@ -1719,7 +1749,7 @@ int PeLib::ImageLoader::captureNtHeaders(ByteBuffer & fileData)
 	}
 
 	// Check the NT signature
-	if((ntSignature = *(std::uint32_t *)(filePtr)) != PELIB_IMAGE_NT_SIGNATURE)
+	if((ntSignature = *(const std::uint32_t *)(filePtr)) != PELIB_IMAGE_NT_SIGNATURE)
 	{
 		setLoaderError(LDR_ERROR_NO_NT_SIGNATURE);
 		return ERROR_INVALID_FILE;
@@ -1754,7 +1784,7 @@ int PeLib::ImageLoader::captureNtHeaders(ByteBuffer & fileData)
 	// Capture optional header. Note that we need to parse it
 	// according to IMAGE_OPTIONAL_HEADER::Magic
 	if((filePtr + sizeof(std::uint16_t)) < fileEnd)
-		optionalHeaderMagic = *(std::uint16_t *)(filePtr);
+		optionalHeaderMagic = *(const std::uint16_t *)(filePtr);
 	if(optionalHeaderMagic == PELIB_IMAGE_NT_OPTIONAL_HDR64_MAGIC)
 		captureOptionalHeader64(fileBegin, filePtr, fileEnd);
 	else
@@ -1952,7 +1982,8 @@ int PeLib::ImageLoader::saveNtHeaders(
 }
 
 int PeLib::ImageLoader::captureSectionName(
-	ByteBuffer & fileData,
+	const std::uint8_t * fileData,
+	std::size_t fileSize,
 	std::string & sectionName,
 	const std::uint8_t * Name)
 {
@@ -1969,7 +2000,7 @@ int PeLib::ImageLoader::captureSectionName(
 			stringTableIndex = (stringTableIndex * 10) + (Name[i] - '0');
 
 		// Get the section name
-		if(readStringRaw(fileData, sectionName, stringTableOffset + stringTableIndex, PELIB_IMAGE_SIZEOF_MAX_NAME, true, true) != 0)
+		if(readStringRaw(fileData, fileSize, sectionName, stringTableOffset + stringTableIndex, PELIB_IMAGE_SIZEOF_MAX_NAME, true, true) != 0)
 		    return ERROR_NONE;
 	}
 
@@ -1993,11 +2024,11 @@ int PeLib::ImageLoader::captureSectionName(
 	return ERROR_NONE;
 }
 
-int PeLib::ImageLoader::captureSectionHeaders(ByteBuffer & fileData)
+int PeLib::ImageLoader::captureSectionHeaders(const std::uint8_t * fileData, std::size_t fileSize)
 {
-	std::uint8_t * fileBegin = fileData.data();
-	std::uint8_t * filePtr;
-	std::uint8_t * fileEnd = fileBegin + fileData.size();
+	const std::uint8_t * fileBegin = fileData;
+	const std::uint8_t * filePtr;
+	const std::uint8_t * fileEnd = fileBegin + fileSize;
 	bool bRawDataBeyondEOF = false;
 
 	// If there are no sections, then we're done
@@ -2046,8 +2077,8 @@ int PeLib::ImageLoader::captureSectionHeaders(ByteBuffer & fileData)
 			break;
 		memcpy(&sectHdr, filePtr, sizeof(PELIB_IMAGE_SECTION_HEADER));
 
-		// Fix the section header *in the source data*. We need to do that *after* the section header was loaded
-		processSectionHeader((PELIB_IMAGE_SECTION_HEADER *)filePtr);
+		// Fix the section header *in the mapped data*. We need to do that *after* the section header was loaded
+		processSectionHeader(sectHdr, (std::uint32_t)(filePtr - fileBegin));
 
 		// Parse the section headers and check for corruptions
 		std::uint32_t PointerToRawData = (sectHdr.SizeOfRawData != 0) ? sectHdr.PointerToRawData : 0;
@@ -2095,7 +2126,7 @@ int PeLib::ImageLoader::captureSectionHeaders(ByteBuffer & fileData)
 			// Sample: a5957dad4b3a53a5894708c7c1ba91be0668ecbed49e33affee3a18c0737c3a5
 			if(i == fileHeader.NumberOfSections - 1 && sectHdr.SizeOfRawData != 0)
 			{
-				if((sectHdr.PointerToRawData + sectHdr.SizeOfRawData) > fileData.size())
+				if((sectHdr.PointerToRawData + sectHdr.SizeOfRawData) > fileSize)
 					setLoaderError(LDR_ERROR_FILE_IS_CUT);
 			}
 
@@ -2109,7 +2140,7 @@ int PeLib::ImageLoader::captureSectionHeaders(ByteBuffer & fileData)
 			bRawDataBeyondEOF = true;
 
 		// Resolve the section name
-		captureSectionName(fileData, sectHdr.sectionName, sectHdr.Name);
+		captureSectionName(fileData, fileSize, sectHdr.sectionName, sectHdr.Name);
 
 		// Insert the header to the list
 		sections.push_back(sectHdr);
@@ -2206,7 +2237,7 @@ int PeLib::ImageLoader::saveSectionHeaders(
 	return saveToFile(fs, fileOffset, offsetOfHeaders, sizeOfHeaders);
 }
 
-int PeLib::ImageLoader::captureImageSections(ByteBuffer & fileData, std::uint32_t loadFlags)
+int PeLib::ImageLoader::captureImageSections(const std::uint8_t * fileData, std::size_t fileSize, std::uint32_t loadFlags)
 {
 	std::uint32_t virtualAddress = 0;
 	std::uint32_t sizeOfHeaders = optionalHeader.SizeOfHeaders;
@@ -2228,7 +2259,7 @@ int PeLib::ImageLoader::captureImageSections(ByteBuffer & fileData, std::uint32_
 			sizeOfHeaders = AlignToSize(sizeOfHeaders, optionalHeader.SectionAlignment);
 
 		// Capture the file header
-		virtualAddress = captureImageSection(fileData, virtualAddress, sizeOfHeaders, 0, sizeOfHeaders, PELIB_IMAGE_SCN_MEM_READ, true);
+		virtualAddress = captureImageSection(fileData, fileSize, loadFlags, virtualAddress, sizeOfHeaders, 0, sizeOfHeaders, PELIB_IMAGE_SCN_MEM_READ, true);
 		if(virtualAddress == 0)
 			return ERROR_INVALID_FILE;
 
@@ -2243,6 +2274,8 @@ int PeLib::ImageLoader::captureImageSections(ByteBuffer & fileData, std::uint32_
 
 				// Capture all pages from the section
 				sectionEnd = captureImageSection(fileData,
+												 fileSize,
+												 loadFlags,
 												 sectionHeader.VirtualAddress,
 												 sectionHeader.VirtualSize,
 												 pointerToRawData,
@@ -2285,7 +2318,7 @@ int PeLib::ImageLoader::captureImageSections(ByteBuffer & fileData, std::uint32_
 		pages.resize((sizeOfImage + PELIB_PAGE_SIZE - 1) / PELIB_PAGE_SIZE);
 
 		// Capture the file as-is
-		virtualAddress = captureImageSection(fileData, 0, sizeOfImage, 0, sizeOfImage, PELIB_IMAGE_SCN_MEM_WRITE | PELIB_IMAGE_SCN_MEM_READ | PELIB_IMAGE_SCN_MEM_EXECUTE, true);
+		virtualAddress = captureImageSection(fileData, fileSize, loadFlags, 0, sizeOfImage, 0, sizeOfImage, PELIB_IMAGE_SCN_MEM_WRITE | PELIB_IMAGE_SCN_MEM_READ | PELIB_IMAGE_SCN_MEM_EXECUTE, true);
 		if(virtualAddress == 0)
 			return ERROR_INVALID_FILE;
 	}
@@ -2332,9 +2365,16 @@ int PeLib::ImageLoader::verifyDosHeader(
 	return (ldrError == LDR_ERROR_E_LFANEW_OUT_OF_FILE) ? ERROR_INVALID_FILE : ERROR_NONE;
 }
 
-int PeLib::ImageLoader::loadImageAsIs(ByteBuffer & fileData)
+int PeLib::ImageLoader::loadImageAsIs(const std::uint8_t * fileData, std::size_t fileSize)
 {
-	rawFileData = fileData;
+	rawFileData.assign(fileData, fileData + fileSize);
+
+	// Apply the section header fixups to the raw content
+	for(auto fixupOffset : headerFixups)
+	{
+		for(std::size_t i = fixupOffset; i < fixupOffset + sizeof(std::uint32_t) && i < rawFileData.size(); i++)
+			rawFileData[i] = 0;
+	}
 	return ERROR_NONE;
 }
 
@@ -2368,9 +2408,9 @@ std::uint32_t PeLib::ImageLoader::copyDataDirectories(
 }
 
 int PeLib::ImageLoader::captureOptionalHeader64(
-	std::uint8_t * fileBegin,
-	std::uint8_t * filePtr,
-	std::uint8_t * fileEnd)
+	const std::uint8_t * fileBegin,
+	const std::uint8_t * filePtr,
+	const std::uint8_t * fileEnd)
 {
 	PELIB_IMAGE_OPTIONAL_HEADER64 optionalHeader64{};
 	std::uint32_t sizeOfOptionalHeader = sizeof(PELIB_IMAGE_OPTIONAL_HEADER64);
@@ -2429,9 +2469,9 @@ int PeLib::ImageLoader::captureOptionalHeader64(
 }
 
 int PeLib::ImageLoader::captureOptionalHeader32(
-	std::uint8_t * fileBegin,
-	std::uint8_t * filePtr,
-	std::uint8_t * fileEnd)
+	const std::uint8_t * fileBegin,
+	const std::uint8_t * filePtr,
+	const std::uint8_t * fileEnd)
 {
 	PELIB_IMAGE_OPTIONAL_HEADER32 optionalHeader32{};
 	std::uint32_t sizeOfOptionalHeader = sizeof(PELIB_IMAGE_OPTIONAL_HEADER32);
@@ -2491,7 +2531,9 @@ int PeLib::ImageLoader::captureOptionalHeader32(
 }
 
 std::uint32_t PeLib::ImageLoader::captureImageSection(
-	ByteBuffer & fileData,
+	const std::uint8_t * fileData,
+	std::size_t fileSize,
+	std::uint32_t loadFlags,
 	std::uint32_t virtualAddress,
 	std::uint32_t virtualSize,
 	std::uint32_t pointerToRawData,
@@ -2499,10 +2541,10 @@ std::uint32_t PeLib::ImageLoader::captureImageSection(
 	std::uint32_t characteristics,
 	bool isImageHeader)
 {
-	std::uint8_t * fileBegin = fileData.data();
-	std::uint8_t * rawDataPtr;
-	std::uint8_t * rawDataEnd;
-	std::uint8_t * fileEnd = fileBegin + fileData.size();
+	const std::uint8_t * fileBegin = fileData;
+	const std::uint8_t * rawDataPtr;
+	const std::uint8_t * rawDataEnd;
+	const std::uint8_t * fileEnd = fileBegin + fileSize;
 	std::uint32_t sizeOfInitializedPages;            // The part of section with initialized pages
 	std::uint32_t sizeOfValidPages;                  // The part of section with valid pages
 	std::uint32_t sizeOfSection;                     // Total virtual size of the section
@@ -2576,8 +2618,13 @@ std::uint32_t PeLib::ImageLoader::captureImageSection(
 					if((rawDataPtr + bytesToCopy) > rawDataEnd)
 						bytesToCopy = (rawDataEnd - rawDataPtr);
 
-					// Initialize the page with valid data
-					filePage.setValidPage(rawDataPtr, bytesToCopy);
+					// Initialize the page with valid data. Full pages of data
+					// that outlive the loader are shared instead of copied.
+					if((loadFlags & IoFlagSharedData) && bytesToCopy == PELIB_PAGE_SIZE)
+						filePage.setSharedPage(rawDataPtr);
+					else
+						filePage.setValidPage(rawDataPtr, bytesToCopy);
+					applyHeaderFixups(filePage, rawDataPtr - fileBegin, bytesToCopy);
 				}
 				else
 				{
@@ -2752,14 +2799,14 @@ bool PeLib::ImageLoader::isValidMachineForCodeIntegrifyCheck(std::uint32_t Bits)
 // there are some more checks implemented by CI!HashpParsePEHeader
 // (nt!SeValidateImageHeader -> CI!CiValidateImageHeader -> ... -> CI!HashpParsePEHeader in Win7)
 // This function does the same checks like CI!HashpParsePEHeader
-bool PeLib::ImageLoader::checkForBadCodeIntegrityImages(ByteBuffer & fileData)
+bool PeLib::ImageLoader::checkForBadCodeIntegrityImages(const std::uint8_t * fileData, std::size_t fileSize)
 {
 	if(optionalHeader.DllCharacteristics & PELIB_IMAGE_DLLCHARACTERISTICS_FORCE_INTEGRITY)
 	{
 		PELIB_IMAGE_DATA_DIRECTORY & SecurityDir = optionalHeader.DataDirectory[PELIB_IMAGE_DIRECTORY_ENTRY_SECURITY];
 		std::uint32_t sizeOfNtHeaders = sizeof(std::uint32_t) + sizeof(PELIB_IMAGE_FILE_HEADER) + sizeof(PELIB_IMAGE_OPTIONAL_HEADER32);
 		std::uint32_t endOfRawData;
-		std::size_t peFileSize = fileData.size();
+		std::size_t peFileSize = fileSize;
 
 		if(dosHeader.e_lfanew < sizeof(PELIB_IMAGE_DOS_HEADER))
 			return true;
@@ -2852,7 +2899,7 @@ bool PeLib::ImageLoader::checkForBadCodeIntegrityImages(ByteBuffer & fileData)
 		// just check for the most blatantly corrupt certificates
 		if(forceIntegrityCheckCertificate)
 		{
-			std::uint8_t * certPtr = fileData.data() + SecurityDir.VirtualAddress;
+			const std::uint8_t * certPtr = fileData + SecurityDir.VirtualAddress;
 			if(SecurityDir.Size > 2 && certPtr[0] == 0 && certPtr[1] == 0)
 				return true;
 		}
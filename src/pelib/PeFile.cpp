@@ -38,6 +38,11 @@ namespace PeLib
 		return m_imageLoader.Load(fileData, loadHeadersOnly);
 	}
 
+	int PeFileT::loadPeHeaders(const std::uint8_t * fileData, std::size_t fileSize, bool loadHeadersOnly)
+	{
+		return m_imageLoader.Load(fileData, fileSize, (loadHeadersOnly ? IoFlagHeadersOnly : 0) | IoFlagSharedData);
+	}
+
 	/// returns PEFILE64 or PEFILE32
 	int PeFileT::getFileType() const
 	{
@@ -283,12 +288,13 @@ namespace PeLib
 		return richHeader().read(m_iStream, offset, size, ignoreInvalidKey);
 	}
 
-	int PeFileT::readCoffSymbolTable(ByteBuffer & fileData)
+	int PeFileT::readCoffSymbolTable(const std::uint8_t * fileData, std::size_t fileSize)
 	{
 		if(m_imageLoader.getPointerToSymbolTable() && m_imageLoader.getNumberOfSymbols())
 		{
 			return coffSymTab().read(
 				fileData,
+				fileSize,
 				m_imageLoader.getPointerToSymbolTable(),
 				m_imageLoader.getNumberOfSymbols() * PELIB_IMAGE_SIZEOF_COFF_SYMBOL);
 		}
@@ -4,9 +4,12 @@
  * @copyright (c) 2020 Avast Software, licensed under the MIT license
  */
 
+#include <atomic>
+#include <condition_variable>
 #include <fstream>
 #include <future>
 #include <chrono>
+#include <mutex>
 #include <thread>
 
 #include <llvm/ADT/Triple.h>
@@ -35,14 +38,18 @@
 #include <llvm/Support/TargetSelect.h>
 #include <llvm/Support/ToolOutputFile.h>
 #include <llvm/Target/TargetMachine.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
 
 #include "retdec/ar-extractor/archive_wrapper.h"
 #include "retdec/ar-extractor/detection.h"
 #include "retdec/config/config.h"
+#include "retdec/cpdetect/input_analysis.h"
 #include "retdec/retdec/retdec.h"
 #include "retdec/macho-extractor/break_fat.h"
 #include "retdec/unpackertool/unpackertool.h"
 #include "retdec/utils/binary_path.h"
+#include "retdec/utils/cancellation.h"
 #include "retdec/utils/filesystem.h"
 #include "retdec/utils/io/log.h"
 #include "retdec/utils/memory.h"
@@ -77,6 +84,15 @@ class ProgramOptions
 		bool cleanup = false;
 		std::set<std::string> toClean;
 
+		/// Manifest with inputs to decompile in the batch mode.
+		std::string batchFile;
+		/// Where to write batch results (empty -> stdout).
+		std::string batchResultsFile;
+		/// Number of concurrent batch jobs (0 -> number of cores).
+		unsigned batchJobs = 0;
+		/// Options are loaded for one job of the batch, not for the batch.
+		bool batchJob = false;
+
 	public:
 		ProgramOptions(
 				int argc,
@@ -519,6 +535,32 @@ void ProgramOptions::loadOption(std::list<std::string>::iterator& i)
 	{
 		params.setIsVerboseOutput(false);
 	}
+	else if (isParam(i, "", "--batch-results"))
+	{
+		batchResultsFile = getParamOrDie(i);
+	}
+	else if (isParam(i, "", "--batch"))
+	{
+		batchFile = checkFile(getParamOrDie(i), "[--batch]");
+	}
+	else if (isParam(i, "-j", "--jobs"))
+	{
+		auto val = getParamOrDie(i);
+		try
+		{
+			batchJobs = std::stoul(val);
+			if (batchJobs == 0)
+			{
+				throw std::runtime_error("");
+			}
+		}
+		catch (...)
+		{
+			throw std::runtime_error(
+				"[-j|--jobs] invalid number of jobs: " + val
+			);
+		}
+	}
 	// Input file is the only argument that does not have -x or --xyz
 	// before it. But only one input is expected.
 	else if (params.getInputFile().empty())
@@ -536,6 +578,25 @@ void ProgramOptions::loadOption(std::list<std::string>::iterator& i)
  */
 void ProgramOptions::afterLoad()
 {
+	// Inputs are loaded from the manifest, options are re-loaded for each of
+	// them when its job starts.
+	if (!batchFile.empty() && !batchJob)
+	{
+		if (!params.getInputFile().empty())
+		{
+			throw std::runtime_error(
+				"[--batch] INPUT_FILE cannot be used together with --batch"
+			);
+		}
+		if (!params.getOutputFile().empty())
+		{
+			throw std::runtime_error(
+				"[--batch] -o|--output cannot be used together with --batch"
+			);
+		}
+		return;
+	}
+
 	auto in = params.getInputFile();
 	if (params.getOutputAsmFile().empty())
 		params.setOutputAsmFile(in + ".dsm");
@@ -657,7 +718,16 @@ Backend arguments:
 	[--backend-no-compound-operators] Do not emit compound operators (like +=) instead of assignments.
 	[--backend-no-symbolic-names] Disables the conversion of constant arguments to their symbolic names.
 Decompilation process arguments:
-	[--timeout SECONDS]
+	[--timeout SECONDS] Stops the decompilation after the given number of seconds.
+	                    In the batch mode, the limit applies to each input separately.
+	[--batch MANIFEST] Decompiles all the files listed in MANIFEST (one path per line, empty lines and lines starting with '#' are ignored).
+	                   All the other arguments are applied to each of the files. Outputs are named as if the file was decompiled alone.
+	                   Each input logs into OUTPUT.log. If a log file is set in the config, a single input logs into it
+	                   and several inputs log into LOG_FILE.N, where N is the index of the input in MANIFEST (from 0).
+	[-j|--jobs N] Number of files decompiled concurrently in the batch mode (default: number of CPU cores).
+	[--batch-results FILE] Writes batch results into FILE as JSON lines (default: standard output).
+	                       Each line contains input, output, status [ok|failed|timeout|bad_alloc], exit_code, wall_time (seconds),
+	                       process_peak_rss (bytes, high-water mark of the whole process, not of the job alone, at the time the job ended), and error message.
 	[--max-memory MAX_MEMORY] Limits the maximal memory used by the given number of bytes.
 	[--no-memory-limit] Disables the default memory limit (half of system RAM).
 LLVM IR debug arguments:
@@ -790,7 +860,16 @@ void setLogsFrom(const retdec::config::Parameters& params)
 	}
 }
 
-int decompile(retdec::config::Config& config, ProgramOptions& po)
+/**
+ * Unpacker plugins are process-wide singletons -> only one input can be
+ * unpacked at a time.
+ */
+std::mutex unpackerMutex;
+
+int decompile(
+		retdec::config::Config& config,
+		ProgramOptions& po,
+		const retdec::utils::CancellationFlag* cancel)
 {
 	setLogsFrom(config.parameters);
 
@@ -927,33 +1006,58 @@ int decompile(retdec::config::Config& config, ProgramOptions& po)
 		}
 	}
 
+	// Input analysis.
+	// The input is parsed and its tools are detected only once, the results
+	// are shared by the unpacker and the decompilation.
+	//
+	auto input = retdec::cpdetect::InputAnalysis::create(
+			config.parameters.getInputFile()
+	);
+
 	// Unpacking
 	//
 
+	retdec::utils::throwIfCancelled(cancel);
 	Log::phase("Unpacking");
-	std::vector<std::string> unpackArgs;
-	unpackArgs.push_back("whatever_program_name");
-	unpackArgs.push_back(config.parameters.getInputFile());
-	unpackArgs.push_back("--output");
-	unpackArgs.push_back(config.parameters.getOutputUnpackedFile());
-	char* uargv[4] = {
-			unpackArgs[0].data(),
-			unpackArgs[1].data(),
-			unpackArgs[2].data(),
-			unpackArgs[3].data()
-	};
-	auto unpackCode = retdec::unpackertool::_main(4, uargv);
+	int unpackCode = 0;
+	if (input)
+	{
+		std::lock_guard<std::mutex> lock(unpackerMutex);
+		unpackCode = retdec::unpackertool::unpack(
+				*input,
+				config.parameters.getOutputUnpackedFile()
+		);
+	}
+	else
+	{
+		// Let the unpacker report why the input cannot be processed.
+		std::vector<std::string> unpackArgs;
+		unpackArgs.push_back("whatever_program_name");
+		unpackArgs.push_back(config.parameters.getInputFile());
+		unpackArgs.push_back("--output");
+		unpackArgs.push_back(config.parameters.getOutputUnpackedFile());
+		char* uargv[4] = {
+				unpackArgs[0].data(),
+				unpackArgs[1].data(),
+				unpackArgs[2].data(),
+				unpackArgs[3].data()
+		};
+		std::lock_guard<std::mutex> lock(unpackerMutex);
+		unpackCode = retdec::unpackertool::_main(4, uargv);
+	}
 	if (unpackCode == 0) // EXIT_CODE_OK
 	{
 		config.parameters.setInputFile(
 				config.parameters.getOutputUnpackedFile()
 		);
 		po.toClean.insert(config.parameters.getOutputUnpackedFile());
+		// The analysis was done for the packed file.
+		input.reset();
 	}
 
 	// Decompilation.
 	//
-	return retdec::decompile(config);
+	return retdec::decompile(config, nullptr, cancel, input);
 }
 
 //
@@ -975,6 +1079,346 @@ void cleanup(ProgramOptions& po)
 	}
 }
 
+//
+//==============================================================================
+// Batch decompilation.
+//==============================================================================
+//
+
+/**
+ * Result of one batch job.
+ */
+struct BatchResult
+{
+	std::string input;
+	std::string output;
+	std::string status;
+	int exitCode = EXIT_SUCCESS;
+	double wallTime = 0.0;
+	/// Peak RSS of the whole process (jobs share it), not of this job.
+	std::size_t processPeakRss = 0;
+	std::string error;
+};
+
+/**
+ * State shared by the workers running batch jobs and the watchdog that stops
+ * jobs exceeding the timeout.
+ */
+class BatchRunner
+{
+	public:
+		BatchRunner(
+				int argc,
+				char *argv[],
+				const retdec::config::Config& baseConfig,
+				const ProgramOptions& po);
+
+		int run();
+
+	private:
+		using Clock = std::chrono::steady_clock;
+
+		/// One running worker as seen by the watchdog.
+		struct Worker
+		{
+			retdec::utils::CancellationFlag cancel{false};
+			std::optional<Clock::time_point> deadline;
+		};
+
+	private:
+		void loadManifest();
+		void workerLoop(Worker& worker);
+		void watchdogLoop();
+		BatchResult runJob(std::size_t index, Worker& worker);
+		void writeResult(const BatchResult& result);
+
+	private:
+		int _argc;
+		char** _argv;
+		const retdec::config::Config& _baseConfig;
+		std::string _manifest;
+		std::string _resultsFile;
+		unsigned _jobs;
+		std::optional<std::chrono::seconds> _timeout;
+
+		std::vector<std::string> _inputs;
+		std::atomic<std::size_t> _nextInput{0};
+		std::atomic<bool> _failed{false};
+
+		/// Protects deadlines of workers and @c _finished.
+		std::mutex _watchdogMutex;
+		std::condition_variable _watchdogCv;
+		std::list<Worker> _workers;
+		bool _finished = false;
+
+		/// Protects the results stream.
+		std::mutex _resultsMutex;
+		std::ofstream _resultsFileStream;
+		std::ostream* _results = &std::cout;
+};
+
+BatchRunner::BatchRunner(
+		int argc,
+		char *argv[],
+		const retdec::config::Config& baseConfig,
+		const ProgramOptions& po)
+		: _argc(argc)
+		, _argv(argv)
+		, _baseConfig(baseConfig)
+		, _manifest(po.batchFile)
+		, _resultsFile(po.batchResultsFile)
+		, _jobs(po.batchJobs)
+{
+	if (_jobs == 0)
+	{
+		_jobs = std::max(1u, std::thread::hardware_concurrency());
+	}
+	if (po.params.isTimeout())
+	{
+		_timeout = std::chrono::seconds(po.params.getTimeout());
+	}
+}
+
+/**
+ * Decompile all the inputs from the manifest.
+ * @return @c EXIT_SUCCESS if all the inputs were successfully decompiled,
+ *         @c EXIT_FAILURE otherwise.
+ */
+int BatchRunner::run()
+{
+	loadManifest();
+
+	if (!_resultsFile.empty())
+	{
+		_resultsFileStream.open(_resultsFile);
+		if (!_resultsFileStream)
+		{
+			throw std::runtime_error(
+				"[--batch-results] failed to open file: " + _resultsFile
+			);
+		}
+		_results = &_resultsFileStream;
+	}
+
+	auto jobs = std::min<std::size_t>(_jobs, _inputs.size());
+	for (std::size_t i = 0; i < jobs; ++i)
+	{
+		_workers.emplace_back();
+	}
+
+	std::thread watchdog(&BatchRunner::watchdogLoop, this);
+	std::vector<std::thread> threads;
+	for (auto& w : _workers)
+	{
+		threads.emplace_back(&BatchRunner::workerLoop, this, std::ref(w));
+	}
+	for (auto& t : threads)
+	{
+		t.join();
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(_watchdogMutex);
+		_finished = true;
+	}
+	_watchdogCv.notify_one();
+	watchdog.join();
+
+	return _failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+void BatchRunner::loadManifest()
+{
+	std::ifstream manifest(_manifest);
+	if (!manifest)
+	{
+		throw std::runtime_error("[--batch] failed to open: " + _manifest);
+	}
+
+	std::string line;
+	while (std::getline(manifest, line))
+	{
+		line = retdec::utils::trim(line);
+		if (line.empty() || line[0] == '#')
+		{
+			continue;
+		}
+		_inputs.push_back(line);
+	}
+}
+
+void BatchRunner::workerLoop(Worker& worker)
+{
+	for (auto i = _nextInput++; i < _inputs.size(); i = _nextInput++)
+	{
+		auto result = runJob(i, worker);
+		if (result.exitCode != EXIT_SUCCESS)
+		{
+			_failed = true;
+		}
+		writeResult(result);
+	}
+}
+
+/**
+ * Raise the cancellation flag of all the jobs that run out of time.
+ */
+void BatchRunner::watchdogLoop()
+{
+	std::unique_lock<std::mutex> lock(_watchdogMutex);
+	while (!_finished)
+	{
+		auto wakeUp = Clock::time_point::max();
+		auto now = Clock::now();
+		for (auto& w : _workers)
+		{
+			if (!w.deadline)
+			{
+				continue;
+			}
+			if (*w.deadline <= now)
+			{
+				w.cancel = true;
+				w.deadline.reset();
+			}
+			else
+			{
+				wakeUp = std::min(wakeUp, *w.deadline);
+			}
+		}
+
+		if (wakeUp == Clock::time_point::max())
+		{
+			_watchdogCv.wait(lock);
+		}
+		else
+		{
+			_watchdogCv.wait_until(lock, wakeUp);
+		}
+	}
+}
+
+BatchResult BatchRunner::runJob(std::size_t index, Worker& worker)
+{
+	auto& input = _inputs[index];
+	BatchResult result;
+	result.input = input;
+	result.status = "ok";
+
+	auto start = Clock::now();
+	{
+		std::lock_guard<std::mutex> lock(_watchdogMutex);
+		worker.cancel = false;
+		if (_timeout)
+		{
+			worker.deadline = start + *_timeout;
+		}
+	}
+	_watchdogCv.notify_one();
+
+	// Options are loaded again for each input, so that all the paths derived
+	// from the input (outputs, extracted and unpacked files) are right.
+	auto config = _baseConfig;
+	config.parameters.setInputFile(input);
+	ProgramOptions po(_argc, _argv, config, config.parameters);
+	po.batchJob = true;
+
+	try
+	{
+		po.load();
+		// Jobs must not log into the same file, each of them would rewrite
+		// it. Without a log file, job logs go next to the job outputs.
+		auto logFile = config.parameters.getLogFile();
+		if (logFile.empty())
+		{
+			config.parameters.setLogFile(config.parameters.getOutputFile() + ".log");
+		}
+		else if (_inputs.size() > 1)
+		{
+			config.parameters.setLogFile(logFile + "." + std::to_string(index));
+		}
+		result.output = config.parameters.getOutputFile();
+
+		result.exitCode = decompile(config, po, &worker.cancel);
+		if (result.exitCode != EXIT_SUCCESS)
+		{
+			result.status = "failed";
+		}
+	}
+	catch (const retdec::utils::OperationCancelled&)
+	{
+		result.status = "timeout";
+		result.exitCode = EXIT_TIMEOUT;
+		result.error = "timeout after: "
+				+ std::to_string(_timeout ? _timeout->count() : 0)
+				+ " seconds";
+	}
+	catch (const std::runtime_error& e)
+	{
+		result.status = "failed";
+		result.exitCode = EXIT_FAILURE;
+		result.error = e.what();
+	}
+	catch (const std::bad_alloc&)
+	{
+		result.status = "bad_alloc";
+		result.exitCode = EXIT_BAD_ALLOC;
+		result.error = "catched std::bad_alloc";
+	}
+	catch (const std::exception& e)
+	{
+		result.status = "failed";
+		result.exitCode = EXIT_FAILURE;
+		result.error = e.what();
+	}
+	catch (...)
+	{
+		result.status = "failed";
+		result.exitCode = EXIT_FAILURE;
+		result.error = "unknown exception";
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(_watchdogMutex);
+		worker.deadline.reset();
+	}
+
+	cleanup(po);
+
+	result.wallTime = std::chrono::duration<double>(
+			Clock::now() - start).count();
+	result.processPeakRss = retdec::utils::getPeakMemoryUsage();
+	return result;
+}
+
+/**
+ * Write the result as a single JSON line.
+ */
+void BatchRunner::writeResult(const BatchResult& result)
+{
+	rapidjson::StringBuffer sb;
+	rapidjson::Writer<rapidjson::StringBuffer> writer(sb);
+	writer.StartObject();
+	writer.Key("input");
+	writer.String(result.input.c_str());
+	writer.Key("output");
+	writer.String(result.output.c_str());
+	writer.Key("status");
+	writer.String(result.status.c_str());
+	writer.Key("exit_code");
+	writer.Int(result.exitCode);
+	writer.Key("wall_time");
+	writer.Double(result.wallTime);
+	writer.Key("process_peak_rss");
+	writer.Uint64(result.processPeakRss);
+	writer.Key("error");
+	writer.String(result.error.c_str());
+	writer.EndObject();
+
+	std::lock_guard<std::mutex> lock(_resultsMutex);
+	*_results << sb.GetString() << std::endl;
+}
+
 //
 //==============================================================================
 // Main.
@@ -1005,7 +1449,9 @@ int main(int argc, char **argv)
 	}
 
 	// Parse program arguments.
+	// Batch jobs parse them again on top of the default config.
 	//
+	auto defaultConfig = config;
 	ProgramOptions po(argc, argv, config, config.parameters);
 	try
 	{
@@ -1021,6 +1467,21 @@ int main(int argc, char **argv)
 	//
 	limitMaximalMemoryIfRequested(config.parameters);
 
+	// Batch decompilation.
+	//
+	if (!po.batchFile.empty())
+	{
+		try
+		{
+			BatchRunner batch(argc, argv, defaultConfig, po);
+			return batch.run();
+		}
+		catch (const std::runtime_error& e)
+		{
+			Log::error() << Log::Error << e.what() << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
 
 	// Decompile.
 	//
@@ -1030,20 +1491,32 @@ int main(int argc, char **argv)
 		std::stringstream buffer;
 		if (config.parameters.isTimeout())
 		{
+			retdec::utils::CancellationFlag cancel{false};
 			std::packaged_task<
 					int(retdec::config::Config&,
-					ProgramOptions&)> task(decompile);
+					ProgramOptions&,
+					const retdec::utils::CancellationFlag*)> task(decompile);
 			auto future = task.get_future();
-			std::thread thr(std::move(task), std::ref(config), std::ref(po));
+			std::thread thr(
+					std::move(task),
+					std::ref(config),
+					std::ref(po),
+					&cancel
+			);
 			auto timeout = std::chrono::seconds(config.parameters.getTimeout());
-			if (future.wait_for(timeout) != std::future_status::timeout)
+			if (future.wait_for(timeout) == std::future_status::timeout)
+			{
+				// Ask the decompilation to stop and wait until it does, so
+				// that it does not use the config and outputs after cleanup.
+				cancel = true;
+			}
+			thr.join();
+			try
 			{
-				thr.join();
 				ret = future.get(); // this will propagate exception
 			}
-			else
+			catch (const retdec::utils::OperationCancelled&)
 			{
-				thr.detach(); // we leave the thread still running
 				Log::error() << "timeout after: " << config.parameters.getTimeout()
 						<< " seconds" << std::endl;
 				ret = EXIT_TIMEOUT;
@@ -1051,7 +1524,7 @@ int main(int argc, char **argv)
 		}
 		else
 		{
-			ret = decompile(config, po);
+			ret = decompile(config, po, nullptr);
 		}
 	}
 	catch (const std::runtime_error& e)
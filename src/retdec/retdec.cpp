@@ -44,12 +44,14 @@
 #include "retdec/bin2llvmir/optimizations/provider_init/provider_init.h"
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
 #include "retdec/bin2llvmir/providers/config.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 
 #include "retdec/llvmir2hll/llvmir2hll.h"
 
 #include "retdec/config/config.h"
 #include "retdec/retdec/retdec.h"
 #include "retdec/utils/memory.h"
+#include "retdec/utils/scope_exit.h"
 #include "retdec/utils/io/log.h"
 
 using namespace retdec::utils::io;
@@ -298,6 +300,16 @@ void fillFunctions(
 	}
 }
 
+LlvmModuleContextPair::~LlvmModuleContextPair()
+{
+	// Data associated with the module by bin2llvmir providers.
+	bin2llvmir::ProviderContext::removeContext(module.get());
+
+	// Order matters: module destructor uses context.
+	module.reset();
+	context.reset();
+}
+
 LlvmModuleContextPair disassemble(
 		const std::string& inputPath,
 		retdec::common::FunctionSet* fs)
@@ -348,6 +360,7 @@ llvm::PassRegistry& initializeLlvmPasses()
  * This pass just prints phase information about other, subsequent passes.
  * In pass manager, tt should be placed right before the pass which phase info
  * it is printing.
+ * It is also a point where the decompilation checks if it was cancelled.
  */
 class ModulePassPrinter : public ModulePass
 {
@@ -356,24 +369,29 @@ class ModulePassPrinter : public ModulePass
 		std::string PhaseName;
 		std::string PhaseArg;
 		std::string PassName;
+		const utils::CancellationFlag* Cancel = nullptr;
 
-		static std::string LastPhase;
+		static thread_local std::string LastPhase;
 		inline static const std::string LlvmAggregatePhaseName = "LLVM";
 
 	public:
 		ModulePassPrinter(
 				const std::string& phaseName,
-				const std::string& phaseArg)
+				const std::string& phaseArg,
+				const utils::CancellationFlag* cancel)
 				: ModulePass(ID)
 				, PhaseName(phaseName)
 				, PhaseArg(phaseArg)
 				, PassName("ModulePass Printer: " + PhaseName)
+				, Cancel(cancel)
 		{
 
 		}
 
 		bool runOnModule(Module &M) override
 		{
+			utils::throwIfCancelled(Cancel);
+
 			if (utils::startsWith(PhaseArg, "retdec"))
 			{
 				Log::phase(PhaseName);
@@ -406,7 +424,7 @@ class ModulePassPrinter : public ModulePass
 		}
 };
 char ModulePassPrinter::ID = 0;
-std::string ModulePassPrinter::LastPhase;
+thread_local std::string ModulePassPrinter::LastPhase;
 
 /**
  * Add the pass to the pass manager - no verification.
@@ -414,11 +432,13 @@ std::string ModulePassPrinter::LastPhase;
 static inline void addPass(
 		legacy::PassManagerBase& PM,
 		Pass* P,
-		const PassInfo* PI)
+		const PassInfo* PI,
+		const utils::CancellationFlag* cancel)
 {
 	PM.add(new ModulePassPrinter(
 			PI->getPassName().str(),
-			PI->getPassArgument().str()
+			PI->getPassArgument().str(),
+			cancel
 	));
 	PM.add(P);
 
@@ -460,7 +480,11 @@ void setLogsFrom(const retdec::config::Parameters& params)
 	}
 }
 
-bool decompile(retdec::config::Config& config, std::string* outString)
+bool decompile(
+		retdec::config::Config& config,
+		std::string* outString,
+		const utils::CancellationFlag* cancel,
+		const std::shared_ptr<cpdetect::InputAnalysis>& input)
 {
 	setLogsFrom(config.parameters);
 
@@ -473,6 +497,12 @@ bool decompile(retdec::config::Config& config, std::string* outString)
 	auto context = std::make_unique<llvm::LLVMContext>();
 	auto module = createLlvmModule(*context);
 
+	// Release all the data bin2llvmir providers associated with the module,
+	// even if the decompilation fails or gets cancelled.
+	SCOPE_EXIT {
+		bin2llvmir::ProviderContext::removeContext(module.get());
+	};
+
 	// Create a PassManager to hold and optimize the collection of passes we
 	// are about to build.
 	llvm::legacy::PassManager pm;
@@ -492,18 +522,25 @@ bool decompile(retdec::config::Config& config, std::string* outString)
 		if (auto* info = passRegistry.getPassInfo(p))
 		{
 			auto* pass = info->createPass();
-			addPass(pm, pass, info);
+			addPass(pm, pass, info, cancel);
 
 			if (info->getTypeInfo() == &bin2llvmir::ProviderInitialization::ID)
 			{
 				auto* p = static_cast<bin2llvmir::ProviderInitialization*>(pass);
 				p->setConfig(&config);
+				p->setInputAnalysis(input);
+			}
+			if (info->getTypeInfo() == &bin2llvmir::Decoder::ID)
+			{
+				auto* p = static_cast<bin2llvmir::Decoder*>(pass);
+				p->setCancellationFlag(cancel);
 			}
 			if (info->getTypeInfo() == &llvmir2hll::LlvmIr2Hll::ID)
 			{
 				auto* p = static_cast<llvmir2hll::LlvmIr2Hll*>(pass);
 				p->setConfig(&config);
 				p->setOutputString(outString);
+				p->setCancellationFlag(cancel);
 			}
 		}
 		else
@@ -26,6 +26,7 @@ void findPossibleVtables(
 		bool gcc)
 {
 	auto wordSz = img->getBytesPerWord();
+	auto pointers = img->getPointerMap();
 
 	for (auto& seg : img->getSegments())
 	{
@@ -38,6 +39,15 @@ void findPossibleVtables(
 		auto end = seg->getEndAddress();
 		while (addr + wordSz < end)
 		{
+			// Vtable candidate is followed by two pointers -> skip words not
+			// followed by a pointer.
+			auto next = pointers->skipToPointer(seg.get(), addr + wordSz);
+			if (next != addr + wordSz)
+			{
+				addr = next - wordSz;
+				continue;
+			}
+
 			std::uint64_t val = 0;
 			if (!img->getWord(addr, val))
 			{
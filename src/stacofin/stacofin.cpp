@@ -13,6 +13,7 @@
 #include "retdec/utils/string.h"
 #include "retdec/utils/filesystem.h"
 #include "retdec/yaracpp/yara_detector.h"
+#include "retdec/yaracpp/yara_rules_cache.h"
 
 /**
  * Set \c debug_enabled to \c true to enable this LOG macro.
@@ -501,6 +502,38 @@ std::string dumpDetectedFunctions(
 	return ret.str();
 }
 
+/**
+ * Get memory blocks of all the executable segments in the given image.
+ * Blocks point directly into the loaded image and their bases are the
+ * segments' virtual addresses, so matches are reported as addresses.
+ */
+std::vector<YaraDetector::MemoryBlock> getExecutableBlocks(
+		const retdec::loader::Image& image)
+{
+	std::vector<YaraDetector::MemoryBlock> blocks;
+	for (const auto& seg : image.getSegments())
+	{
+		auto* secSeg = seg->getSecSeg();
+		if (secSeg && !secSeg->isSomeCode())
+		{
+			continue;
+		}
+
+		auto rawData = seg->getRawData();
+		if (rawData.first == nullptr || rawData.second == 0)
+		{
+			continue;
+		}
+
+		YaraDetector::MemoryBlock block;
+		block.data = rawData.first;
+		block.size = rawData.second;
+		block.base = seg->getAddress();
+		blocks.push_back(block);
+	}
+	return blocks;
+}
+
 } // namespace anonymous
 
 //
@@ -695,6 +728,23 @@ const DetectedFunctionsPtrMap& Finder::getConfirmedDetections() const
 void Finder::search(
 	const Image& image,
 	const std::string& yaraFile)
+{
+	search(image, std::set<std::string>{yaraFile});
+}
+
+/**
+ * Search for static code in input file.
+ *
+ * Signature files are compiled only once per process (see YaraRulesCache)
+ * and only executable segments of the image are scanned. The segments are
+ * scanned in place, without copying the image.
+ *
+ * @param image input file image
+ * @param yaraFiles static code signature files
+ */
+void Finder::search(
+	const retdec::loader::Image& image,
+	const std::set<std::string>& yaraFiles)
 {
 	// Get FileFormat instance.
 	const auto* fileFormat = image.getFileFormat();
@@ -703,89 +753,90 @@ void Finder::search(
 		return;
 	}
 
-	// Start Yara detector.
-	YaraDetector detector;
-	detector.addRuleFile(yaraFile);
-	auto inputBytes = fileFormat->getLoadedBytes();
-	detector.analyze(inputBytes);
-	if (!detector.isInValidState())
+	auto blocks = getExecutableBlocks(image);
+	if (blocks.empty())
 	{
 		return;
 	}
 
-	// Iterate over detected rules.
-	for (const YaraRule &detectedRule : detector.getDetectedRules())
+	for (const auto& yaraFile : yaraFiles)
 	{
-		DetectedFunction detectedFunction;
-		detectedFunction.signaturePath = yaraFile;
+		auto rules = YaraRulesCache::getRules(yaraFile);
+		if (!rules)
+		{
+			continue;
+		}
 
-		for (const YaraMeta &ruleMeta : detectedRule.getMetas())
+		// Start Yara detector.
+		YaraDetector detector;
+		detector.addRules(rules);
+		if (!detector.isInValidState() || !detector.analyze(blocks))
 		{
-			if (ruleMeta.getId() == "name")
-			{
-				detectedFunction.names.push_back(ruleMeta.getStringValue());
-			}
-			if (ruleMeta.getId() == "size")
-			{
-				detectedFunction.size = ruleMeta.getIntValue();
-			}
-			if (ruleMeta.getId() == "refs")
-			{
-				const auto &refs = ruleMeta.getStringValue();
-				detectedFunction.setReferences(refs);
-			}
-			if (ruleMeta.getId() == "altNames")
+			continue;
+		}
+
+		// Iterate over detected rules.
+		for (const YaraRule &detectedRule : detector.getDetectedRules())
+		{
+			DetectedFunction detectedFunction;
+			detectedFunction.signaturePath = yaraFile;
+
+			for (const YaraMeta &ruleMeta : detectedRule.getMetas())
 			{
-				std::string name;
-				const auto &altNames = ruleMeta.getStringValue();
-				std::istringstream ss(altNames, std::istringstream::in);
-				while(ss >> name)
+				if (ruleMeta.getId() == "name")
+				{
+					detectedFunction.names.push_back(ruleMeta.getStringValue());
+				}
+				if (ruleMeta.getId() == "size")
 				{
-					detectedFunction.names.push_back(name);
+					detectedFunction.size = ruleMeta.getIntValue();
+				}
+				if (ruleMeta.getId() == "refs")
+				{
+					const auto &refs = ruleMeta.getStringValue();
+					detectedFunction.setReferences(refs);
+				}
+				if (ruleMeta.getId() == "altNames")
+				{
+					std::string name;
+					const auto &altNames = ruleMeta.getStringValue();
+					std::istringstream ss(altNames, std::istringstream::in);
+					while(ss >> name)
+					{
+						detectedFunction.names.push_back(name);
+					}
 				}
 			}
-		}
 
-		// Iterate over all matches.
-		for (const YaraMatch &ruleMatch : detectedRule.getMatches())
-		{
-			// This is different for every match.
-			detectedFunction.offset = ruleMatch.getOffset();
-			std::uint64_t address = 0;
-			if (!fileFormat->getAddressFromOffset(
-						address, detectedFunction.offset))
+			// Iterate over all matches.
+			for (const YaraMatch &ruleMatch : detectedRule.getMatches())
 			{
-				// Cannot get address. Maybe report error?
-				continue;
-			}
+				// This is different for every match.
+				// Blocks are based on segment addresses -> match offset is
+				// the address.
+				std::uint64_t address = ruleMatch.getOffset();
+				// Skip matches whose address is not mapped to the file.
+				std::uint64_t offset = 0;
+				if (!fileFormat->getOffsetFromAddress(offset, address))
+				{
+					continue;
+				}
+				detectedFunction.offset = offset;
 
-			// Store data.
-			detectedFunction.setAddress(address);
-			coveredCode.insert(AddressRange(
-					address,
-					address + detectedFunction.size));
+				// Store data.
+				detectedFunction.setAddress(address);
+				coveredCode.insert(AddressRange(
+						address,
+						address + detectedFunction.size));
 
-			_allDetections.emplace(detectedFunction.getAddress(), detectedFunction);
+				_allDetections.emplace(
+						detectedFunction.getAddress(),
+						detectedFunction);
+			}
 		}
 	}
 }
 
-/**
- * Search for static code in input file.
- *
- * @param image input file image
- * @param yaraFiles static code signature files
- */
-void Finder::search(
-	const retdec::loader::Image& image,
-	const std::set<std::string>& yaraFiles)
-{
-	for (const auto& f : yaraFiles)
-	{
-		search(image, f);
-	}
-}
-
 /**
  * Search for static code in input file based on information in config file.
  *
@@ -13,6 +13,7 @@
 #include "retdec/utils/memory.h"
 #include "retdec/utils/version.h"
 #include "retdec/cpdetect/cpdetect.h"
+#include "retdec/cpdetect/input_analysis.h"
 #include "retdec/fileformat/fileformat.h"
 #include "arg_handler.h"
 #include "retdec/unpacker/plugin.h"
@@ -39,49 +40,35 @@ enum ExitCode
 	EXIT_CODE_MEMORY_LIMIT_ERROR ///< There was an error when setting the memory limit.
 };
 
-bool detectPackers(const std::string& inputFile, std::vector<retdec::cpdetect::DetectResult>& detectedPackers)
+void detectPackers(retdec::cpdetect::InputAnalysis& input, std::vector<retdec::cpdetect::DetectResult>& detectedPackers)
+{
+	// The detection is run only if the owner of the analysis did not run it yet.
+	detectedPackers = input.getToolInformation().detectedTools;
+}
+
+std::shared_ptr<retdec::cpdetect::InputAnalysis> analyzeInput(const std::string& inputFile)
 {
 	using namespace retdec::cpdetect;
 	using namespace retdec::fileformat;
 
-	DetectParams detectionParams(SearchType::MOST_SIMILAR, true, false);
-
-	ToolInformation toolInfo;
 	switch (detectFileFormat(inputFile))
 	{
 		case Format::UNDETECTABLE:
 			Log::error() << "Input file '" << inputFile << "' doesn't exist!" << std::endl;
-			return false;
+			return nullptr;
 		case Format::UNKNOWN:
 			Log::error() << "Input file '" << inputFile << "' is in unknown format!" << std::endl;
-			return false;
+			return nullptr;
 		default:
 		{
-			auto fileParser = createFileFormat(inputFile);
-			if (!fileParser)
+			auto input = InputAnalysis::create(inputFile);
+			if (!input)
 			{
 				Log::error() << "Error while detecting format of file '" << inputFile << "'! Please, report this." << std::endl;
-				return false;
-			}
-
-			auto compilerDetector = std::make_unique<CompilerDetector>(
-					*(fileParser.get()),
-					detectionParams,
-					toolInfo
-			);
-			if (!compilerDetector)
-			{
-				Log::error() << "No compiler detector was found! Please, report this." << std::endl;
-				return false;
 			}
-
-			compilerDetector->getAllInformation();
-			break;
+			return input;
 		}
 	}
-
-	detectedPackers = toolInfo.detectedTools;
-	return true;
 }
 
 ExitCode unpackFile(const std::string& inputFile, const std::string& outputFile, bool brute, const std::vector<retdec::cpdetect::DetectResult>& detectedPackers)
@@ -190,12 +177,11 @@ ExitCode processArgs(ArgHandler& handler, char argc, char** argv)
 	{
 		std::string inputFile = handler.getRawInputs()[0];
 		std::string outputFile = handler["output"]->used ? handler["output"]->input : std::string{inputFile}.append("-unpacked");
-		std::vector<retdec::cpdetect::DetectResult> detectedPackers;
-
-		if (!detectPackers(inputFile, detectedPackers))
+		auto input = analyzeInput(inputFile);
+		if (!input)
 			return EXIT_CODE_PREPROCESSING_ERROR;
 
-		return unpackFile(inputFile, outputFile, brute, detectedPackers);
+		return static_cast<ExitCode>(unpack(*input, outputFile, brute));
 	}
 	// Nothing else, just print the help
 	else
@@ -204,6 +190,14 @@ ExitCode processArgs(ArgHandler& handler, char argc, char** argv)
 	return EXIT_CODE_OK;
 }
 
+int unpack(retdec::cpdetect::InputAnalysis& input, const std::string& outputFile, bool brute)
+{
+	std::vector<retdec::cpdetect::DetectResult> detectedPackers;
+	detectPackers(input, detectedPackers);
+
+	return unpackFile(input.getPath(), outputFile, brute, detectedPackers);
+}
+
 int _main(int argc, char** argv)
 {
 	ArgHandler handler("unpacker options [PACKED_FILE] [optional]");
@@ -3,6 +3,7 @@
  * @brief Implementation of @c ByteValueStorage.
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
+#include <algorithm>
 #include <cassert>
 #include <cstring>
 
@@ -272,6 +273,32 @@ bool ByteValueStorage::bitsToLittle(std::vector<unsigned char>& values) const
 	return isLittleEndian() ? true : swapEndianness(values, getByteLength());
 }
 
+/**
+ * Read exactly @a x bytes from the specified address into the provided buffer.
+ * Default implementation goes through @c getXBytes(), storages with direct
+ * access to their data should override it and avoid the allocation.
+ *
+ * @param address Address to read bytes from
+ * @param x Number of bytes to read
+ * @param res Buffer of at least @a x bytes for the result
+ *
+ * @return Status of operation (@c true if all is OK, @c false otherwise)
+ */
+bool ByteValueStorage::readBytes(
+		std::uint64_t address,
+		std::uint64_t x,
+		std::uint8_t* res) const
+{
+	std::vector<std::uint8_t> d;
+	if (!getXBytes(address, x, d) || d.size() != x)
+	{
+		return false;
+	}
+
+	std::copy(d.begin(), d.end(), res);
+	return true;
+}
+
 /**
  * Get integer (1B) located at provided address using the specified endian
  * or default file endian
@@ -398,13 +425,13 @@ bool ByteValueStorage::getWord(
  */
 bool ByteValueStorage::getFloat(std::uint64_t address, float& res) const
 {
-	std::vector<std::uint8_t> d;
-	if (!getXBytes(address, sizeof(float), d) || d.size() != sizeof(float))
+	std::uint8_t d[sizeof(float)];
+	if (!readBytes(address, sizeof(float), d))
 	{
 		return false;
 	}
 
-	memcpy(&res, d.data(), d.size());
+	memcpy(&res, d, sizeof(float));
 	return true;
 }
 
@@ -418,8 +445,8 @@ bool ByteValueStorage::getFloat(std::uint64_t address, float& res) const
  */
 bool ByteValueStorage::getDouble(std::uint64_t address, double& res) const
 {
-	std::vector<std::uint8_t> d;
-	if (!getXBytes(address, sizeof(double), d) || d.size() != sizeof(double))
+	std::uint8_t d[sizeof(double)];
+	if (!readBytes(address, sizeof(double), d))
 	{
 		return false;
 	}
@@ -440,7 +467,7 @@ bool ByteValueStorage::getDouble(std::uint64_t address, double& res) const
 	// Currently we use new kind for ARMs > version 5.
 	// To find relevant info, google: "ARM double mixed endian".
 
-	memcpy(&res, d.data(), d.size());
+	memcpy(&res, d, sizeof(double));
 	return true;
 }
 
@@ -910,9 +937,9 @@ bool ByteValueStorage::getDoubleArray(
 }
 
 /**
- * Create integer from vector of bytes
+ * Create integer from bytes
  *
- * @param data Vector of bytes
+ * @param data Bytes
  * @param value Resulted value
  * @param endian Endian - if specified it is forced, otherwise file's endian
  *               is used
@@ -924,7 +951,7 @@ bool ByteValueStorage::getDoubleArray(
  * @return @c true if conversion went OK, @c false otherwise
  */
 bool ByteValueStorage::createValueFromBytes(
-		const std::vector<std::uint8_t>& data,
+		const ByteView& data,
 		std::uint64_t& value,
 		Endianness endian,
 		std::uint64_t offset,
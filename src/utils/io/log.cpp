@@ -20,7 +20,7 @@ const Log::Action Log::SubPhase = Log::Action::SubPhase;
 const Log::Action Log::SubSubPhase = Log::Action::SubSubPhase;
 const Log::Action Log::ElapsedTime = Log::Action::ElapsedTime;
 
-Logger::Ptr Log::writers[] = {
+thread_local Logger::Ptr Log::writers[] = {
 	/*Info*/      /*default*/ nullptr,
 	/*Debug*/     /*default*/ nullptr,
 	/*Error*/     Logger::Ptr(new Logger(std::cerr)),
@@ -0,0 +1,160 @@
+/**
+* @file src/utils/mapped_file.cpp
+* @brief Read-only memory-mapped file.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <limits>
+#include <utility>
+
+#include "retdec/utils/mapped_file.h"
+#include "retdec/utils/os.h"
+
+#ifdef OS_WINDOWS
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+namespace retdec {
+namespace utils {
+
+/**
+* @brief Maps the given file into memory.
+*
+* If the file cannot be opened or mapped, the object is not valid (see
+* isValid()). An empty file is valid, but it has no data.
+*/
+MappedFile::MappedFile(const std::string &path) {
+#ifdef OS_WINDOWS
+	HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ,
+		nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE) {
+		return;
+	}
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(file, &fileSize) || static_cast<unsigned long long>(
+			fileSize.QuadPart) > std::numeric_limits<std::size_t>::max()) {
+		CloseHandle(file);
+		return;
+	}
+
+	if (fileSize.QuadPart == 0) {
+		CloseHandle(file);
+		valid = true;
+		return;
+	}
+
+	HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY,
+		0, 0, nullptr);
+	CloseHandle(file);
+	if (mapping == nullptr) {
+		return;
+	}
+
+	void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	// The view holds its own reference to the mapping.
+	CloseHandle(mapping);
+	if (view == nullptr) {
+		return;
+	}
+
+	data = static_cast<const std::uint8_t *>(view);
+	size = static_cast<std::size_t>(fileSize.QuadPart);
+	valid = true;
+#else
+	int fd = open(path.c_str(), O_RDONLY);
+	if (fd < 0) {
+		return;
+	}
+
+	struct stat st;
+	if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)
+			|| static_cast<unsigned long long>(st.st_size)
+				> std::numeric_limits<std::size_t>::max()) {
+		close(fd);
+		return;
+	}
+
+	if (st.st_size == 0) {
+		close(fd);
+		valid = true;
+		return;
+	}
+
+	void *view = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	// The mapping stays valid after the descriptor is closed.
+	close(fd);
+	if (view == MAP_FAILED) {
+		return;
+	}
+
+	data = static_cast<const std::uint8_t *>(view);
+	size = static_cast<std::size_t>(st.st_size);
+	valid = true;
+#endif
+}
+
+MappedFile::MappedFile(MappedFile &&other) noexcept:
+	data(std::exchange(other.data, nullptr)),
+	size(std::exchange(other.size, 0)),
+	valid(std::exchange(other.valid, false)) {}
+
+MappedFile &MappedFile::operator=(MappedFile &&other) noexcept {
+	if (this != &other) {
+		unmap();
+		data = std::exchange(other.data, nullptr);
+		size = std::exchange(other.size, 0);
+		valid = std::exchange(other.valid, false);
+	}
+	return *this;
+}
+
+MappedFile::~MappedFile() {
+	unmap();
+}
+
+/**
+* @brief Returns @c true if the file was successfully mapped, @c false
+*        otherwise.
+*/
+bool MappedFile::isValid() const {
+	return valid;
+}
+
+/**
+* @brief Returns the mapped content of the file.
+*
+* The returned pointer is @c nullptr if the file is empty or invalid.
+*/
+const std::uint8_t *MappedFile::getData() const {
+	return data;
+}
+
+/**
+* @brief Returns the size of the mapped file.
+*/
+std::size_t MappedFile::getSize() const {
+	return size;
+}
+
+void MappedFile::unmap() {
+	if (data == nullptr) {
+		return;
+	}
+
+#ifdef OS_WINDOWS
+	UnmapViewOfFile(data);
+#else
+	munmap(const_cast<std::uint8_t *>(data), size);
+#endif
+	data = nullptr;
+	size = 0;
+}
+
+} // namespace utils
+} // namespace retdec
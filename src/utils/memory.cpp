@@ -11,6 +11,7 @@
 
 #ifdef OS_WINDOWS
 	#include <windows.h>
+	#include <psapi.h>
 #elif defined(OS_MACOS) || defined(OS_BSD)
 	#include <sys/types.h>
 	#include <sys/sysctl.h>
@@ -43,8 +44,43 @@ bool limitSystemMemoryOnPOSIX(std::size_t limit) {
 
 #endif
 
+#ifdef OS_POSIX
+
+/**
+* @brief Implementation of @c getPeakMemoryUsage() on POSIX-compliant systems.
+*/
+std::size_t getPeakMemoryUsageOnPOSIX() {
+	struct rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) != 0) {
+		return 0;
+	}
+
+#ifdef OS_MACOS
+	// macOS reports the size in bytes.
+	return static_cast<std::size_t>(usage.ru_maxrss);
+#else
+	// Linux and *BSD report the size in kilobytes.
+	return static_cast<std::size_t>(usage.ru_maxrss) * 1024;
+#endif
+}
+
+#endif
+
 #ifdef OS_WINDOWS
 
+/**
+* @brief Implementation of @c getPeakMemoryUsage() on Windows.
+*/
+std::size_t getPeakMemoryUsageOnWindows() {
+	PROCESS_MEMORY_COUNTERS counters;
+	auto succeeded = GetProcessMemoryInfo(
+		GetCurrentProcess(),
+		&counters,
+		sizeof(counters)
+	);
+	return succeeded ? counters.PeakWorkingSetSize : 0;
+}
+
 /**
 * @brief Implementation of @c getTotalSystemMemory() on Windows.
 */
@@ -234,5 +270,19 @@ bool limitSystemMemoryToHalfOfTotalSystemMemory() {
 	return limitSystemMemory(totalSize / 2);
 }
 
+/**
+* @brief Returns the peak resident set size of the current process (in bytes).
+*
+* The value covers the whole process, i.e. all of its threads, since the
+* process was started. When the size cannot be obtained, it returns @c 0.
+*/
+std::size_t getPeakMemoryUsage() {
+#ifdef OS_WINDOWS
+	return getPeakMemoryUsageOnWindows();
+#else
+	return getPeakMemoryUsageOnPOSIX();
+#endif
+}
+
 } // namespace utils
 } // namespace retdec
@@ -0,0 +1,350 @@
+/**
+* @file src/utils/ordinal_database.cpp
+* @brief Packed database of function names of imports by ordinal.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include "retdec/utils/filesystem.h"
+#include "retdec/utils/ordinal_database.h"
+
+namespace retdec {
+namespace utils {
+
+/**
+* Layout of the database. All numbers are 32-bit words in the byte order of
+* the machine which created the database, all sections are aligned to four
+* bytes and all offsets are relative to the beginning of the file, except
+* string offsets, which are relative to the string section.
+*
+* The libraries are indexed by an open-addressing hash table with linear
+* probing. Each library owns a contiguous run of the name table covering all
+* ordinals from its lowest to its highest one, so a name is found by
+* subtracting the first ordinal.
+*/
+struct OrdinalDatabase::Header {
+	char magic[8];
+	std::uint32_t byteOrderMark;
+	std::uint32_t version;
+	std::uint32_t librariesOffset;
+	std::uint32_t librariesCount;
+	std::uint32_t slotsOffset;
+	/// Always a power of two.
+	std::uint32_t slotsCount;
+	std::uint32_t namesOffset;
+	std::uint32_t namesCount;
+	std::uint32_t stringsOffset;
+	std::uint32_t stringsSize;
+};
+
+struct OrdinalDatabase::Library {
+	/// Offset of the name (lower case, without suffix) in the string section.
+	std::uint32_t name;
+	std::uint32_t firstOrdinal;
+	std::uint32_t ordinalCount;
+	/// Index of the name of the first ordinal in the name table.
+	std::uint32_t namesBegin;
+};
+
+namespace {
+
+const char MAGIC[8] = {'R', 'D', 'O', 'R', 'D', 'D', 'B', '\0'};
+const std::uint32_t VERSION = 1;
+const std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+/// Empty hash slot or an ordinal without a name.
+const std::uint32_t NO_ENTRY = 0xffffffff;
+
+std::uint32_t hashLibraryName(std::string_view name) {
+	// FNV-1a.
+	std::uint32_t hash = 2166136261u;
+	for (unsigned char c : name) {
+		hash = (hash ^ c) * 16777619u;
+	}
+	return hash;
+}
+
+bool fitsInto(std::uint64_t offset, std::uint64_t count, std::uint64_t size,
+		std::uint64_t fileSize) {
+	return offset % sizeof(std::uint32_t) == 0
+		&& offset <= fileSize
+		&& count <= (fileSize - offset) / size;
+}
+
+template<typename T>
+void writeWords(std::ostream &out, const std::vector<T> &words) {
+	out.write(reinterpret_cast<const char *>(words.data()),
+		words.size() * sizeof(T));
+}
+
+/**
+* @brief Reads one @c .ord file, lines are "<ordinal> <name>".
+*/
+std::map<std::uint32_t, std::string> readOrdFile(const fs::path &path) {
+	std::map<std::uint32_t, std::string> ordinals;
+	std::ifstream input(path.string());
+	std::string line;
+	while (std::getline(input, line)) {
+		std::istringstream ordDecl(line);
+		int ord = -1;
+		std::string funcName;
+		ordDecl >> ord >> funcName;
+		if (ord >= 0) {
+			ordinals[ord] = funcName;
+		}
+	}
+	return ordinals;
+}
+
+} // anonymous namespace
+
+/**
+* @brief Opens the database at the given path.
+*
+* If the file cannot be mapped or it is not a valid database, the object is not
+* valid (see isValid()).
+*/
+OrdinalDatabase::OrdinalDatabase(const std::string &path) : file(path) {
+	if (checkLayout()) {
+		header = reinterpret_cast<const Header *>(file.getData());
+	}
+}
+
+OrdinalDatabase::OrdinalDatabase(OrdinalDatabase &&other) noexcept :
+		file(std::move(other.file)),
+		header(std::exchange(other.header, nullptr)) {}
+
+OrdinalDatabase &OrdinalDatabase::operator=(OrdinalDatabase &&other) noexcept {
+	if (this != &other) {
+		file = std::move(other.file);
+		header = std::exchange(other.header, nullptr);
+	}
+	return *this;
+}
+
+/**
+* @brief Was the database successfully opened?
+*/
+bool OrdinalDatabase::isValid() const {
+	return header != nullptr;
+}
+
+std::size_t OrdinalDatabase::getLibraryCount() const {
+	return header ? header->librariesCount : 0;
+}
+
+/**
+* @brief Does the database contain the given library?
+*
+* @param libName Lower-case name of the library without suffix (e.g. ".dll").
+*/
+bool OrdinalDatabase::hasLibrary(std::string_view libName) const {
+	return findLibrary(libName) != nullptr;
+}
+
+/**
+* @brief Returns name of the function exported from the given library by the
+*        given ordinal, or an empty string if it is not known.
+*
+* @param libName Lower-case name of the library without suffix (e.g. ".dll").
+* @param ordinal Ordinal of the function.
+*
+* The returned view points into the database and it is valid for as long as
+* the database lives.
+*/
+std::string_view OrdinalDatabase::getName(std::string_view libName,
+		std::uint64_t ordinal) const {
+	auto *lib = findLibrary(libName);
+	if (lib == nullptr
+			|| ordinal < lib->firstOrdinal
+			|| ordinal - lib->firstOrdinal >= lib->ordinalCount) {
+		return {};
+	}
+
+	auto *names = getWords(header->namesOffset);
+	return getString(names[lib->namesBegin + (ordinal - lib->firstOrdinal)]);
+}
+
+/**
+* @brief Checks that the mapped file is a database and that all its sections
+*        are inside the file. Libraries are checked when they are found.
+*/
+bool OrdinalDatabase::checkLayout() const {
+	if (!file.isValid() || file.getSize() < sizeof(Header)) {
+		return false;
+	}
+
+	auto *h = reinterpret_cast<const Header *>(file.getData());
+	auto size = file.getSize();
+	auto *strings = file.getData() + h->stringsOffset;
+	return std::memcmp(h->magic, MAGIC, sizeof(MAGIC)) == 0
+		&& h->byteOrderMark == BYTE_ORDER_MARK
+		&& h->version == VERSION
+		&& h->slotsCount != 0
+		&& (h->slotsCount & (h->slotsCount - 1)) == 0
+		&& h->librariesCount < h->slotsCount
+		&& fitsInto(h->librariesOffset, h->librariesCount, sizeof(Library), size)
+		&& fitsInto(h->slotsOffset, h->slotsCount, sizeof(std::uint32_t), size)
+		&& fitsInto(h->namesOffset, h->namesCount, sizeof(std::uint32_t), size)
+		&& h->stringsSize != 0
+		&& fitsInto(h->stringsOffset, h->stringsSize, 1, size)
+		// Every string has to be terminated inside the string section.
+		&& strings[h->stringsSize - 1] == '\0';
+}
+
+const OrdinalDatabase::Library *OrdinalDatabase::findLibrary(
+		std::string_view libName) const {
+	if (header == nullptr) {
+		return nullptr;
+	}
+
+	auto *slots = getWords(header->slotsOffset);
+	auto *libs = reinterpret_cast<const Library *>(
+		file.getData() + header->librariesOffset);
+	auto mask = header->slotsCount - 1;
+	auto i = hashLibraryName(libName) & mask;
+	for (std::uint32_t probes = 0; probes < header->slotsCount; ++probes) {
+		auto index = slots[i];
+		if (index == NO_ENTRY || index >= header->librariesCount) {
+			return nullptr;
+		}
+
+		auto *lib = &libs[index];
+		if (getString(lib->name) == libName) {
+			bool inside = lib->namesBegin <= header->namesCount
+				&& lib->ordinalCount <= header->namesCount - lib->namesBegin;
+			return inside ? lib : nullptr;
+		}
+
+		i = (i + 1) & mask;
+	}
+	return nullptr;
+}
+
+std::string_view OrdinalDatabase::getString(std::uint32_t offset) const {
+	if (offset >= header->stringsSize) {
+		return {};
+	}
+
+	return reinterpret_cast<const char *>(
+		file.getData() + header->stringsOffset + offset);
+}
+
+const std::uint32_t *OrdinalDatabase::getWords(std::uint32_t offset) const {
+	return reinterpret_cast<const std::uint32_t *>(file.getData() + offset);
+}
+
+/**
+* @brief Compiles all @c .ord files in the given directory into a database.
+*
+* @param ordDirectory Directory with files "<library>.ord" containing lines
+*                     "<ordinal> <name>".
+* @param database Output stream for the database. It should be binary.
+*
+* @return @c true if the database was written, @c false otherwise.
+*/
+bool OrdinalDatabase::compile(const std::string &ordDirectory,
+		std::ostream &database) {
+	std::error_code ec;
+	std::vector<fs::path> files;
+	for (fs::directory_iterator it(ordDirectory, ec), e; !ec && it != e;
+			it.increment(ec)) {
+		if (it->path().extension() == ".ord") {
+			files.push_back(it->path());
+		}
+	}
+	if (ec) {
+		return false;
+	}
+	// Make the output independent of the order of directory entries.
+	std::sort(files.begin(), files.end());
+
+	std::string strings(1, '\0');
+	std::map<std::string, std::uint32_t> stringOffsets;
+	auto addString = [&](const std::string &str) -> std::uint32_t {
+		if (str.empty()) {
+			return NO_ENTRY;
+		}
+		auto it = stringOffsets.find(str);
+		if (it != stringOffsets.end()) {
+			return it->second;
+		}
+		std::uint32_t offset = strings.size();
+		strings.append(str).push_back('\0');
+		stringOffsets.emplace(str, offset);
+		return offset;
+	};
+
+	std::vector<Library> libraries;
+	std::vector<std::string> libraryNames;
+	std::vector<std::uint32_t> names;
+	for (const auto &path : files) {
+		auto ordinals = readOrdFile(path);
+		Library lib = {};
+		libraryNames.push_back(path.stem().string());
+		lib.name = addString(libraryNames.back());
+		lib.namesBegin = names.size();
+		if (!ordinals.empty()) {
+			lib.firstOrdinal = ordinals.begin()->first;
+			lib.ordinalCount = ordinals.rbegin()->first - lib.firstOrdinal + 1;
+			names.resize(names.size() + lib.ordinalCount, NO_ENTRY);
+			for (const auto &[ord, name] : ordinals) {
+				names[lib.namesBegin + ord - lib.firstOrdinal] = addString(name);
+			}
+		}
+		libraries.push_back(lib);
+	}
+
+	std::uint32_t slotsCount = 1;
+	while (slotsCount <= libraries.size() * 2) {
+		slotsCount *= 2;
+	}
+	std::vector<std::uint32_t> slots(slotsCount, NO_ENTRY);
+	for (std::uint32_t index = 0; index < libraries.size(); ++index) {
+		auto i = hashLibraryName(libraryNames[index]) & (slotsCount - 1);
+		while (slots[i] != NO_ENTRY) {
+			i = (i + 1) & (slotsCount - 1);
+		}
+		slots[i] = index;
+	}
+
+	strings.resize((strings.size() + 3) & ~std::size_t(3), '\0');
+
+	Header header = {};
+	std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+	header.byteOrderMark = BYTE_ORDER_MARK;
+	header.version = VERSION;
+	std::uint64_t offset = sizeof(Header);
+	header.librariesOffset = offset;
+	header.librariesCount = libraries.size();
+	offset += libraries.size() * sizeof(Library);
+	header.slotsOffset = offset;
+	header.slotsCount = slotsCount;
+	offset += slots.size() * sizeof(std::uint32_t);
+	header.namesOffset = offset;
+	header.namesCount = names.size();
+	offset += names.size() * sizeof(std::uint32_t);
+	header.stringsOffset = offset;
+	header.stringsSize = strings.size();
+	offset += strings.size();
+	if (offset > std::numeric_limits<std::uint32_t>::max()) {
+		return false;
+	}
+
+	database.write(reinterpret_cast<const char *>(&header), sizeof(header));
+	writeWords(database, libraries);
+	writeWords(database, slots);
+	writeWords(database, names);
+	database.write(strings.data(), strings.size());
+	return static_cast<bool>(database.flush());
+}
+
+} // namespace utils
+} // namespace retdec
@@ -0,0 +1,80 @@
+/**
+ * @file src/yaracpp/memory_block_iterator.h
+ * @brief Iterator over memory blocks passed to libyara.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef YARACPP_MEMORY_BLOCK_ITERATOR_H
+#define YARACPP_MEMORY_BLOCK_ITERATOR_H
+
+#include <vector>
+
+#include <yara.h>
+
+#include "retdec/yaracpp/yara_detector.h"
+
+namespace retdec {
+namespace yaracpp {
+
+/**
+ * Iterator over memory blocks passed to libyara. Blocks are not copied,
+ * libyara reads them directly.
+ */
+struct MemoryBlockIterator
+{
+	const std::vector<YaraDetector::MemoryBlock>* blocks = nullptr;
+	std::size_t index = 0;
+	YR_MEMORY_BLOCK block = {};
+	YR_MEMORY_BLOCK_ITERATOR iterator = {};
+
+	MemoryBlockIterator(const std::vector<YaraDetector::MemoryBlock>& b)
+			: blocks(&b)
+	{
+		iterator.context = this;
+		iterator.first = first;
+		iterator.next = next;
+	}
+
+	MemoryBlockIterator(const MemoryBlockIterator&) = delete;
+	MemoryBlockIterator& operator=(const MemoryBlockIterator&) = delete;
+
+	static const std::uint8_t* fetchData(YR_MEMORY_BLOCK* block)
+	{
+		auto* b = static_cast<const YaraDetector::MemoryBlock*>(block->context);
+		return b->data;
+	}
+
+	static YR_MEMORY_BLOCK* first(YR_MEMORY_BLOCK_ITERATOR* iterator)
+	{
+		auto* it = static_cast<MemoryBlockIterator*>(iterator->context);
+		it->index = 0;
+		return it->current();
+	}
+
+	static YR_MEMORY_BLOCK* next(YR_MEMORY_BLOCK_ITERATOR* iterator)
+	{
+		auto* it = static_cast<MemoryBlockIterator*>(iterator->context);
+		++it->index;
+		return it->current();
+	}
+
+	YR_MEMORY_BLOCK* current()
+	{
+		if (index >= blocks->size())
+		{
+			return nullptr;
+		}
+
+		auto& b = (*blocks)[index];
+		block.size = b.size;
+		block.base = b.base;
+		block.context = const_cast<YaraDetector::MemoryBlock*>(&b);
+		block.fetch_data = fetchData;
+		return &block;
+	}
+};
+
+} // namespace yaracpp
+} // namespace retdec
+
+#endif
@@ -9,6 +9,8 @@
 #include <yara/types.h>
 
 #include "retdec/yaracpp/yara_detector.h"
+#include "retdec/yaracpp/yara_rules_cache.h"
+#include "yaracpp/memory_block_iterator.h"
 
 namespace retdec {
 namespace yaracpp {
@@ -67,6 +69,31 @@ struct Scanner<std::vector<std::uint8_t>>
 	}
 };
 
+/**
+ * Specialization for scanning several memory blocks at once. The blocks
+ * are not copied, libyara reads them directly.
+ */
+template <>
+struct Scanner<std::vector<YaraDetector::MemoryBlock>>
+{
+	static bool scan(
+			YR_RULES* rules,
+			YR_CALLBACK_FUNC callback,
+			YaraDetector::CallbackSettings& settings,
+			const std::vector<YaraDetector::MemoryBlock>& blocks)
+	{
+		MemoryBlockIterator iterator(blocks);
+
+		return yr_rules_scan_mem_blocks(
+				rules,
+				&iterator.iterator,
+				0,
+				callback,
+				&settings, 0
+		) == ERROR_SUCCESS;
+	}
+};
+
 /**
  * Interface for Scanner. Provides template type deduction and
  * always passes correct type into Scanner template.
@@ -93,10 +120,8 @@ bool scan(
  */
 YaraDetector::YaraDetector()
 {
-	stateIsValid = ((yr_initialize() == ERROR_SUCCESS)
+	stateIsValid = (YaraRulesCache::initialize()
 			&& (yr_compiler_create(&compiler) == ERROR_SUCCESS));
-	std::uint32_t max_match_data = 65536;
-	yr_set_configuration(YR_CONFIG_MAX_MATCH_DATA, &max_match_data);
 }
 
 /**
@@ -122,13 +147,7 @@ YaraDetector::~YaraDetector()
 	if (textFilesRules)
 		yr_rules_destroy(textFilesRules);
 
-	for (auto* rules : precompiledRules)
-	{
-		if (rules)
-			yr_rules_destroy(rules);
-	}
-
-	yr_finalize();
+	precompiledRules.clear();
 }
 
 /**
@@ -286,9 +305,23 @@ bool YaraDetector::addRules(const char *string)
 	const auto result = yr_compiler_add_string(compiler, string, nullptr);
 
 	needsRecompilation = (result == 0);
+	hasTextRules |= needsRecompilation;
 	return needsRecompilation;
 }
 
+/**
+ * Add already compiled rules, e.g. rules from @c YaraRulesCache
+ * @param rules Compiled rules to add. Rules are shared, not copied.
+ */
+bool YaraDetector::addRules(const std::shared_ptr<YR_RULES> &rules)
+{
+	if (!rules)
+		return false;
+
+	precompiledRules.push_back(rules);
+	return true;
+}
+
 /**
  * Add external file with text rules
  * @param pathToFile Path to rule file
@@ -302,8 +335,8 @@ bool YaraDetector::addRuleFile(
 		const std::string &nameSpace)
 {
 	// AT first, try to load the files as precompiled file
-	YR_RULES* rules = nullptr;
-	if (yr_rules_load(pathToFile.c_str(), &rules) == ERROR_SUCCESS)
+	// Precompiled rules are loaded only once per process and shared.
+	if (auto rules = YaraRulesCache::getPrecompiledRules(pathToFile))
 	{
 		precompiledRules.push_back(rules);
 	}
@@ -323,6 +356,7 @@ bool YaraDetector::addRuleFile(
 
 		files.push_back(file);
 		needsRecompilation = true;
+		hasTextRules = true;
 	}
 
 	return true;
@@ -358,11 +392,26 @@ bool YaraDetector::analyze(
  *                      store all rules (not only detected)
  * @return @c true if analysis completed without any error, otherwise @c false.
  */
-bool YaraDetector::analyze(std::vector<std::uint8_t> &bytes, bool storeAllRules)
+bool YaraDetector::analyze(const std::vector<std::uint8_t> &bytes, bool storeAllRules)
 {
 	return analyzeWithScan(bytes, storeAllRules);
 }
 
+/**
+ * Analyze input memory blocks. All the blocks are scanned in one pass
+ * and none of them is copied.
+ * @param blocks Memory blocks to analyze
+ * @param storeAllRules If this parameter is set to @c true,
+ *                      store all rules (not only detected)
+ * @return @c true if analysis completed without any error, otherwise @c false.
+ */
+bool YaraDetector::analyze(
+		const std::vector<MemoryBlock> &blocks,
+		bool storeAllRules)
+{
+	return analyzeWithScan(blocks, storeAllRules);
+}
+
 /**
  * Get detected rules
  * @return Detected rules
@@ -397,16 +446,20 @@ bool YaraDetector::analyzeWithScan(T&& value, bool storeAllRules)
 			undetectedRules
 	);
 
-	auto rules = getCompiledRules();
-	if (!(rules))
-		return false;
+	// Do not compile and scan an empty rule set if there are no text rules.
+	if (hasTextRules || precompiledRules.empty())
+	{
+		auto rules = getCompiledRules();
+		if (!(rules))
+			return false;
 
-	if (!scan(rules, yaraCallback, settings, std::forward<T>(value)))
-		return false;
+		if (!scan(rules, yaraCallback, settings, std::forward<T>(value)))
+			return false;
+	}
 
-	for (auto* rules : precompiledRules)
+	for (auto& rules : precompiledRules)
 	{
-		if (!scan(rules, yaraCallback, settings, std::forward<T>(value)))
+		if (!scan(rules.get(), yaraCallback, settings, std::forward<T>(value)))
 			return false;
 	}
 
@@ -0,0 +1,271 @@
+/**
+ * @file src/yaracpp/yara_rules_cache.cpp
+ * @brief Process-wide cache of compiled YARA rules.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include <yara.h>
+
+#include "retdec/utils/filesystem.h"
+#include "retdec/yaracpp/yara_rules_cache.h"
+
+namespace retdec {
+namespace yaracpp {
+
+namespace {
+
+/**
+ * Key of the cache: paths to all the rule files compiled into one rule set.
+ */
+using CacheKey = std::vector<std::string>;
+
+struct CacheEntry
+{
+	std::vector<fs::file_time_type> modificationTimes;
+	YaraRulesCache::Rules rules;
+	bool precompiled = false;
+};
+
+std::mutex cacheMutex;
+std::map<CacheKey, CacheEntry> cache;
+
+std::once_flag initFlag;
+bool initialized = false;
+
+/**
+ * Release the cached rules and finalize libyara. Registered by
+ * @c YaraRulesCache::initialize() to run at process exit.
+ */
+void finalize()
+{
+	YaraRulesCache::clear();
+	yr_finalize();
+}
+
+/**
+ * Wrap the given rules into a shared pointer.
+ */
+YaraRulesCache::Rules makeRules(YR_RULES* rules)
+{
+	return YaraRulesCache::Rules(rules, [](YR_RULES* r) {
+		yr_rules_destroy(r);
+	});
+}
+
+/**
+ * Compile the given text rule files into one rule set. All the files share
+ * the default namespace, so rules in one file may refer to rules in the
+ * other files.
+ * @return Compiled rules or @c nullptr on error.
+ */
+YR_RULES* compileRuleFiles(const CacheKey& pathsToFiles)
+{
+	YR_COMPILER* compiler = nullptr;
+	if (yr_compiler_create(&compiler) != ERROR_SUCCESS)
+	{
+		return nullptr;
+	}
+
+	bool ok = true;
+	for (const auto& pathToFile : pathsToFiles)
+	{
+		auto* file = std::fopen(pathToFile.c_str(), "r");
+		if (!file)
+		{
+			ok = false;
+			break;
+		}
+
+		ok = yr_compiler_add_file(
+				compiler,
+				file,
+				nullptr,
+				pathToFile.c_str()) == 0;
+		std::fclose(file);
+		if (!ok)
+		{
+			break;
+		}
+	}
+
+	YR_RULES* rules = nullptr;
+	if (ok)
+	{
+		yr_compiler_get_rules(compiler, &rules);
+	}
+
+	yr_compiler_destroy(compiler);
+	return rules;
+}
+
+/**
+ * Load (if precompiled) or compile (if text and @a compileText is set)
+ * the given rule files. Only a single file may be precompiled.
+ * @param pathsToFiles Paths to the rule files.
+ * @param compileText Compile the files if they are not precompiled.
+ * @param precompiled Set to @c true if the file was precompiled.
+ * @return Rules or @c nullptr on error.
+ */
+YaraRulesCache::Rules loadRuleFiles(
+		const CacheKey& pathsToFiles,
+		bool compileText,
+		bool& precompiled)
+{
+	if (!YaraRulesCache::initialize())
+	{
+		return nullptr;
+	}
+
+	YR_RULES* rules = nullptr;
+	precompiled = pathsToFiles.size() == 1
+			&& yr_rules_load(pathsToFiles[0].c_str(), &rules) == ERROR_SUCCESS;
+	if (!precompiled)
+	{
+		rules = compileText ? compileRuleFiles(pathsToFiles) : nullptr;
+	}
+
+	if (rules == nullptr)
+	{
+		return nullptr;
+	}
+
+	return makeRules(rules);
+}
+
+/**
+ * Get rules from the given cached rule files or load them if needed.
+ */
+YaraRulesCache::Rules getCachedRules(
+		const CacheKey& pathsToFiles,
+		bool compileText)
+{
+	if (pathsToFiles.empty())
+	{
+		return nullptr;
+	}
+
+	std::vector<fs::file_time_type> modificationTimes;
+	for (const auto& pathToFile : pathsToFiles)
+	{
+		std::error_code ec;
+		modificationTimes.push_back(fs::last_write_time(pathToFile, ec));
+		if (ec)
+		{
+			return nullptr;
+		}
+	}
+
+	std::lock_guard<std::mutex> lock(cacheMutex);
+
+	auto it = cache.find(pathsToFiles);
+	if (it != cache.end()
+			&& it->second.modificationTimes == modificationTimes)
+	{
+		if (!compileText && !it->second.precompiled)
+		{
+			return nullptr;
+		}
+		return it->second.rules;
+	}
+
+	bool precompiled = false;
+	auto rules = loadRuleFiles(pathsToFiles, compileText, precompiled);
+	if (rules)
+	{
+		cache[pathsToFiles] = CacheEntry{
+				std::move(modificationTimes),
+				rules,
+				precompiled
+		};
+	}
+	else if (it != cache.end())
+	{
+		cache.erase(it);
+	}
+	return rules;
+}
+
+} // anonymous namespace
+
+/**
+ * Initialize libyara. It is initialized only once per process, no matter
+ * how many threads call this, and finalized at process exit.
+ * @return @c true if libyara is initialized, @c false otherwise.
+ */
+bool YaraRulesCache::initialize()
+{
+	std::call_once(initFlag, []() {
+		if (yr_initialize() != ERROR_SUCCESS)
+		{
+			return;
+		}
+
+		std::uint32_t maxMatchData = 65536;
+		yr_set_configuration(YR_CONFIG_MAX_MATCH_DATA, &maxMatchData);
+
+		std::atexit(finalize);
+		initialized = true;
+	});
+
+	return initialized;
+}
+
+/**
+ * Get rules from the given rule file. The file is loaded (or compiled) only
+ * when it is requested for the first time or when it has changed since the
+ * last time it was loaded.
+ * @param pathToFile Path to precompiled or text rule file.
+ * @return Rules or @c nullptr if the file could not be loaded.
+ */
+YaraRulesCache::Rules YaraRulesCache::getRules(const std::string& pathToFile)
+{
+	return getCachedRules({pathToFile}, true);
+}
+
+/**
+ * Get rules compiled together from all the given text rule files. The files
+ * share one namespace, so they may refer to each other. The rules are
+ * compiled only when they are requested for the first time or when any of
+ * the files has changed since then.
+ * @param pathsToFiles Paths to text rule files.
+ * @return Rules or @c nullptr if any of the files could not be compiled.
+ */
+YaraRulesCache::Rules YaraRulesCache::getRules(
+		const std::vector<std::string>& pathsToFiles)
+{
+	return getCachedRules(pathsToFiles, true);
+}
+
+/**
+ * Same as @c getRules(), but only for precompiled rule files.
+ * @param pathToFile Path to rule file.
+ * @return Rules or @c nullptr if the file is not a precompiled rule file.
+ */
+YaraRulesCache::Rules YaraRulesCache::getPrecompiledRules(
+		const std::string& pathToFile)
+{
+	return getCachedRules({pathToFile}, false);
+}
+
+/**
+ * Drop all the cached rules. Rules that are still in use by someone are
+ * destroyed when their last user releases them.
+ */
+void YaraRulesCache::clear()
+{
+	std::map<CacheKey, CacheEntry> removed;
+	{
+		std::lock_guard<std::mutex> lock(cacheMutex);
+		removed.swap(cache);
+	}
+}
+
+} // namespace yaracpp
+} // namespace retdec
@@ -0,0 +1,163 @@
+/**
+ * @file src/yaracpp/yara_scanner.cpp
+ * @brief Reusable scanner of compiled YARA rules.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <yara.h>
+
+#include "retdec/yaracpp/yara_scanner.h"
+#include "yaracpp/memory_block_iterator.h"
+
+namespace retdec {
+namespace yaracpp {
+
+/**
+ * Constructor
+ * @param rules Rules to scan with. Rules are shared, not copied.
+ */
+YaraScanner::YaraScanner(const YaraRulesCache::Rules& rules) :
+		rules(rules)
+{
+	if (!YaraRulesCache::initialize()
+			|| (rules && yr_scanner_create(rules.get(), &scanner) != ERROR_SUCCESS))
+	{
+		scanner = nullptr;
+	}
+}
+
+/**
+ * Destructor
+ */
+YaraScanner::~YaraScanner()
+{
+	if (scanner)
+	{
+		yr_scanner_destroy(scanner);
+	}
+}
+
+/**
+ * Getter for state of instance
+ * @return @c true if all is OK, @c false otherwise
+ */
+bool YaraScanner::isInValidState() const
+{
+	return scanner != nullptr;
+}
+
+/**
+ * Scan memory buffer. The buffer is not copied.
+ * @param data Pointer to the buffer
+ * @param size Size of the buffer
+ * @param storeAllRules If this parameter is set to @c true,
+ *                      store all rules (not only detected)
+ * @return @c true if scan completed without any error, otherwise @c false.
+ */
+bool YaraScanner::scan(
+		const std::uint8_t *data,
+		std::size_t size,
+		bool storeAllRules)
+{
+	return doScan(storeAllRules, [&]() {
+		return yr_scanner_scan_mem(scanner, data, size);
+	});
+}
+
+/**
+ * Scan input bytes
+ * @param bytes Vector of input bytes
+ * @param storeAllRules If this parameter is set to @c true,
+ *                      store all rules (not only detected)
+ * @return @c true if scan completed without any error, otherwise @c false.
+ */
+bool YaraScanner::scan(
+		const std::vector<std::uint8_t> &bytes,
+		bool storeAllRules)
+{
+	return scan(bytes.data(), bytes.size(), storeAllRules);
+}
+
+/**
+ * Scan several memory blocks in one pass. The blocks are not copied.
+ * @param blocks Memory blocks to scan
+ * @param storeAllRules If this parameter is set to @c true,
+ *                      store all rules (not only detected)
+ * @return @c true if scan completed without any error, otherwise @c false.
+ */
+bool YaraScanner::scan(
+		const std::vector<YaraDetector::MemoryBlock> &blocks,
+		bool storeAllRules)
+{
+	return doScan(storeAllRules, [&]() {
+		MemoryBlockIterator iterator(blocks);
+		return yr_scanner_scan_mem_blocks(scanner, &iterator.iterator);
+	});
+}
+
+/**
+ * Scan input file. libyara maps the file into memory, it is not read.
+ * @param pathToFile Path to input file
+ * @param storeAllRules If this parameter is set to @c true,
+ *                      store all rules (not only detected)
+ * @return @c true if scan completed without any error, otherwise @c false.
+ */
+bool YaraScanner::scanFile(
+		const std::string &pathToFile,
+		bool storeAllRules)
+{
+	return doScan(storeAllRules, [&]() {
+		return yr_scanner_scan_file(scanner, pathToFile.c_str());
+	});
+}
+
+/**
+ * Get rules detected by the last scan
+ * @return Detected rules
+ */
+const std::vector<YaraRule>& YaraScanner::getDetectedRules() const
+{
+	return detectedRules;
+}
+
+/**
+ * Get rules not detected by the last scan (only if all rules were stored)
+ * @return Undetected rules
+ */
+const std::vector<YaraRule>& YaraScanner::getUndetectedRules() const
+{
+	return undetectedRules;
+}
+
+/**
+ * Run the given scan and collect its results
+ * @param storeAllRules If this parameter is set to @c true,
+ *                      store all rules (not only detected)
+ * @param scanFnc Function performing the scan itself
+ * @return @c true if scan completed without any error, otherwise @c false.
+ */
+template <typename ScanFnc>
+bool YaraScanner::doScan(bool storeAllRules, ScanFnc scanFnc)
+{
+	detectedRules.clear();
+	undetectedRules.clear();
+
+	if (!isInValidState())
+	{
+		return false;
+	}
+
+	YaraDetector::CallbackSettings settings(
+			storeAllRules,
+			detectedRules,
+			undetectedRules
+	);
+	yr_scanner_set_callback(scanner, YaraDetector::yaraCallback, &settings);
+	auto result = scanFnc();
+	yr_scanner_set_callback(scanner, YaraDetector::yaraCallback, nullptr);
+
+	return result == ERROR_SUCCESS;
+}
+
+} // namespace yaracpp
+} // namespace retdec
@@ -38,27 +38,85 @@ def print_arguments(yarac, install_dir, yara_patterns_dir, compile):
     print('===> compile flag       :', compile)
 
 
+BUNDLE_NAME = 'tools.yarac'
+BUNDLE_FILES_SUFFIX = '.files'
+
+
+def get_bundle_path(yara_file):
+    """ Get path to the bundle the given *.yara file is compiled into, or None
+    if it is compiled on its own.
+    Tools detection rules (tools/format/arch/*.yara) are compiled into a single
+    bundle per format and architecture, because all of them are always used
+    together.
+    """
+    parts = pathlib.Path(yara_file).parts
+    if len(parts) >= 4 and parts[-4] == 'tools':
+        return os.path.join(os.path.dirname(yara_file), BUNDLE_NAME)
+    return None
+
+
+def get_bundle_files_path(bundle):
+    """ Get path to the list of *.yara files the given bundle was compiled from.
+    """
+    return bundle + BUNDLE_FILES_SUFFIX
+
+
+def read_bundle_files(bundle):
+    """ Get names of *.yara files the given bundle was compiled from, or None
+    if they are not known (bundle installed by an older version).
+    """
+    try:
+        with open(get_bundle_files_path(bundle)) as f:
+            return set(f.read().split())
+    except OSError:
+        return None
+
+
 def copy_yara_patterns(yara_patterns_dir, install_dir):
     """ Copy *.yara files from the given source YARA patterns directory
     to the given installation directory.
     File is copied only if it is newer (timestamp) than already existing
     *.yara[c] file in the installation directory, or if such file does not
-    exist.
+    exist. Bundle is compiled from all of its files, so if any of them is newer
+    than the bundle, or if the bundle was compiled from another set of files
+    (a file was added or removed), the bundle is removed and all of its files
+    are copied.
     """
+    outdated_bundles = set()
+    bundle_files = {}
+    files = []
     for root, dirnames, filenames in os.walk(yara_patterns_dir):
         for filename in fnmatch.filter(filenames, '*.yara'):
             input = os.path.join(root, filename)
             input_suffix = os.path.relpath(input, yara_patterns_dir)
 
             output = os.path.join(install_dir, 'generic', 'yara_patterns', input_suffix)
-            output_c = str(pathlib.Path(output).with_suffix('.yarac'))
-
-            if ((not os.path.isfile(output) and not os.path.isfile(output_c))
-                    or (os.path.isfile(output) and os.path.getmtime(output) < os.path.getmtime(input))
-                    or (os.path.isfile(output_c) and os.path.getmtime(output_c) < os.path.getmtime(input))):
-                print('-- Installing:', output)
-                os.makedirs(os.path.dirname(output), exist_ok=True)
-                shutil.copy(input, output)
+            bundle = get_bundle_path(output)
+            files.append((input, output, bundle))
+
+            if bundle:
+                bundle_files.setdefault(bundle, set()).add(filename)
+                if (os.path.isfile(bundle)
+                        and os.path.getmtime(bundle) < os.path.getmtime(input)):
+                    outdated_bundles.add(bundle)
+
+    for bundle, filenames in bundle_files.items():
+        if os.path.isfile(bundle) and read_bundle_files(bundle) != filenames:
+            outdated_bundles.add(bundle)
+
+    for bundle in outdated_bundles:
+        os.remove(bundle)
+        if os.path.isfile(get_bundle_files_path(bundle)):
+            os.remove(get_bundle_files_path(bundle))
+
+    for input, output, bundle in files:
+        output_c = bundle or str(pathlib.Path(output).with_suffix('.yarac'))
+        if ((not os.path.isfile(output) and not os.path.isfile(output_c))
+                or (os.path.isfile(output) and os.path.getmtime(output) < os.path.getmtime(input))
+                or (os.path.isfile(output_c) and os.path.getmtime(output_c) < os.path.getmtime(input))):
+            print('-- Installing:', output)
+            os.makedirs(os.path.dirname(output), exist_ok=True)
+            shutil.copy(input, output)
 
 
 def compile_yara_file(input_file, yarac, install_dir, stdout_lock):
@@ -79,17 +137,55 @@ def compile_yara_file(input_file, yarac, install_dir, stdout_lock):
     os.remove(input_file)
 
 
+def compile_yara_bundle(output_file, input_files, yarac, stdout_lock):
+    """ Compile the given .yara files using the provided YARAC program into
+    a single *.yarac bundle. Rules from each file get their own namespace, so
+    rules with the same name may be in several files.
+    The bundle is always compiled from all of its files, an existing bundle is
+    overwritten. Names of the files are stored next to the bundle, so that
+    copy_yara_patterns() can find out that the set of files changed.
+    Remove the source *.yara files.
+    """
+    with stdout_lock:
+        print('-- Compiling:', output_file)
+
+    cmd = [yarac, '-w']
+    cmd += ['%s:%s' % (pathlib.Path(f).stem, f) for f in sorted(input_files)]
+    cmd.append(output_file)
+    ret = subprocess.call(cmd)
+    if ret != 0:
+        print('Error: yarac failed during compilation of bundle', output_file, file=sys.stderr)
+        sys.exit(1)
+
+    with open(get_bundle_files_path(output_file), 'w') as f:
+        for input_file in sorted(input_files):
+            print(os.path.basename(input_file), file=f)
+
+    for input_file in input_files:
+        os.remove(input_file)
+        # Files compiled on their own by older installations.
+        old_output_file = pathlib.Path(input_file).with_suffix('.yarac')
+        if old_output_file.is_file():
+            old_output_file.unlink()
+
+
 def compile_yara_files(yarac, install_dir):
     """ Compile all *.yara files in the given installation directory using the
-    provided YARAC program into *.yarac files.
+    provided YARAC program into *.yarac files or bundles.
     Remove the source *.yara files.
     """
     inputs = []
+    bundles = {}
     for root, dirnames, filenames in os.walk(install_dir):
         for filename in fnmatch.filter(filenames, '*.yara'):
-            inputs.append(os.path.join(root, filename))
-
-    if not inputs:
+            input_file = os.path.join(root, filename)
+            bundle = get_bundle_path(input_file)
+            if bundle:
+                bundles.setdefault(bundle, []).append(input_file)
+            else:
+                inputs.append(input_file)
+
+    if not inputs and not bundles:
         return
 
     stdout_lock = threading.Lock()
@@ -98,6 +194,10 @@ def compile_yara_files(yarac, install_dir):
             (input_file, yarac, install_dir, stdout_lock) for input_file in inputs
         ]
         pool.starmap(compile_yara_file, args)
+        args = [
+            (bundle, files, yarac, stdout_lock) for bundle, files in bundles.items()
+        ]
+        pool.starmap(compile_yara_bundle, args)
 
 
 def main():
@@ -4,6 +4,8 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <set>
+
 #include "retdec/bin2llvmir/analyses/reaching_definitions.h"
 #include "bin2llvmir/utils/llvmir_tests.h"
 
@@ -23,6 +25,24 @@ namespace tests {
  */
 class ReachingDefinitionsTests: public LlvmIrTests
 {
+	protected:
+		std::set<llvm::Instruction*> defsFromUse(
+				const ReachingDefinitionsAnalysis& rda,
+				const std::string& use)
+		{
+			std::set<llvm::Instruction*> ret;
+			for (auto* d : rda.defsFromUse(getInstructionByName(use)))
+			{
+				ret.insert(d->def);
+			}
+			return ret;
+		}
+
+		std::set<llvm::Instruction*> defsFromUse(const std::string& use)
+		{
+			return defsFromUse(RDA, use);
+		}
+
 	protected:
 		ReachingDefinitionsAnalysis RDA;
 };
@@ -44,6 +64,147 @@ DummyTest)
 	EXPECT_EQ( nullptr, module->getGlobalVariable("glob1") );
 }
 
+TEST_F(ReachingDefinitionsTests,
+definitionsFromBothBranchesReachUseAfterJoin)
+{
+	parseInput(R"(
+		@glob0 = global i32 0
+		define void @func1(i1 %c) {
+		entry:
+			store i32 1, i32* @glob0
+			br i1 %c, label %then, label %join
+		then:
+			store i32 2, i32* @glob0
+			br label %join
+		join:
+			%x = load i32, i32* @glob0
+			ret void
+		}
+	)");
+	auto* s0 = getNthInstruction<StoreInst>(0);
+	auto* s1 = getNthInstruction<StoreInst>(1);
+
+	RDA.runOnModule(*module);
+
+	std::set<llvm::Instruction*> exp = {s0, s1};
+	EXPECT_EQ(exp, defsFromUse("x"));
+	EXPECT_EQ(1, RDA.usesFromDef(s0).size());
+	EXPECT_EQ(1, RDA.usesFromDef(s1).size());
+}
+
+TEST_F(ReachingDefinitionsTests,
+definitionInLoopReachesUseInLoopHeaderAndKillsDefinitionBeforeLoop)
+{
+	parseInput(R"(
+		@glob0 = global i32 0
+		@glob1 = global i32 0
+		define void @func1() {
+		entry:
+			store i32 0, i32* @glob0
+			store i32 0, i32* @glob1
+			br label %loop
+		loop:
+			%x = load i32, i32* @glob0
+			%c = icmp eq i32 %x, 10
+			br i1 %c, label %exit, label %body
+		body:
+			store i32 1, i32* @glob0
+			br label %loop
+		exit:
+			%y = load i32, i32* @glob0
+			%z = load i32, i32* @glob1
+			store i32 2, i32* @glob0
+			%w = load i32, i32* @glob0
+			ret void
+		}
+	)");
+	auto* s0 = getNthInstruction<StoreInst>(0);
+	auto* s1 = getNthInstruction<StoreInst>(1);
+	auto* s2 = getNthInstruction<StoreInst>(2);
+	auto* s3 = getNthInstruction<StoreInst>(3);
+
+	RDA.runOnModule(*module);
+
+	std::set<llvm::Instruction*> exp = {s0, s2};
+	EXPECT_EQ(exp, defsFromUse("x"));
+	EXPECT_EQ(exp, defsFromUse("y"));
+	exp = {s1};
+	EXPECT_EQ(exp, defsFromUse("z"));
+	exp = {s3};
+	EXPECT_EQ(exp, defsFromUse("w"));
+}
+
+TEST_F(ReachingDefinitionsTests,
+definitionsInUnreachableBlocksDoNotReachUses)
+{
+	parseInput(R"(
+		@glob0 = global i32 0
+		define void @func1() {
+		entry:
+			store i32 1, i32* @glob0
+			br label %join
+		dead:
+			store i32 2, i32* @glob0
+			br label %join
+		join:
+			%x = load i32, i32* @glob0
+			ret void
+		}
+	)");
+	auto* s0 = getNthInstruction<StoreInst>(0);
+
+	RDA.runOnModule(*module);
+
+	std::set<llvm::Instruction*> exp = {s0};
+	EXPECT_EQ(exp, defsFromUse("x"));
+}
+
+TEST_F(ReachingDefinitionsTests,
+functionsAnalyzedInParallelHaveSameDefinitionsAsAnalyzedSequentially)
+{
+	parseInput(R"(
+		@glob0 = global i32 0
+		@glob1 = global i32 0
+		define void @func1(i1 %c) {
+		entry:
+			store i32 1, i32* @glob0
+			br i1 %c, label %then, label %join
+		then:
+			store i32 2, i32* @glob1
+			br label %join
+		join:
+			%x1 = load i32, i32* @glob0
+			%y1 = load i32, i32* @glob1
+			ret void
+		}
+		define void @func2(i1 %c) {
+		entry:
+			store i32 3, i32* @glob1
+			br label %loop
+		loop:
+			%x2 = load i32, i32* @glob1
+			store i32 4, i32* @glob1
+			br i1 %c, label %loop, label %exit
+		exit:
+			%y2 = load i32, i32* @glob0
+			ret void
+		}
+		declare void @func3()
+	)");
+	ReachingDefinitionsAnalysis parallelRda;
+
+	RDA.runOnModule(*module);
+	parallelRda.runOnModule(*module, nullptr, false, 4);
+
+	for (auto* use : {"x1", "y1", "x2", "y2"})
+	{
+		SCOPED_TRACE(use);
+		EXPECT_EQ(defsFromUse(RDA, use), defsFromUse(parallelRda, use));
+	}
+	EXPECT_EQ(2, defsFromUse(parallelRda, "x2").size());
+	EXPECT_TRUE(defsFromUse(parallelRda, "y2").empty());
+}
+
 } // namespace tests
 } // namespace bin2llvmir
 } // namespace retdec
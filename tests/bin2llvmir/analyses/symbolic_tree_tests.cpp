@@ -0,0 +1,308 @@
+/**
+* @file tests/bin2llvmir/analyses/tests/symbolic_tree_tests.cpp
+* @brief Tests for the symbolic tree construction.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <llvm/IR/InstIterator.h>
+
+#include "retdec/bin2llvmir/analyses/symbolic_tree.h"
+#include "bin2llvmir/utils/llvmir_tests.h"
+
+using namespace ::testing;
+using namespace llvm;
+
+namespace retdec {
+namespace bin2llvmir {
+namespace tests {
+
+/**
+ * Test construction of symbolic trees, mainly sharing of their nodes in
+ * @c SymbolicTreeCache.
+ */
+class SymbolicTreeTests: public LlvmIrTests
+{
+	protected:
+		/**
+		 * Simplification needs ABI.
+		 */
+		void setX86Abi()
+		{
+			auto c = config::Config::fromJsonString(R"({
+				"architecture" : {
+					"bitSize" : 32,
+					"endian" : "little",
+					"name" : "x86"
+				}
+			})");
+			config = std::make_unique<Config>(
+					Config::fromConfig(module.get(), c));
+			auto* abi = AbiProvider::addAbi(module.get(), config.get());
+			SymbolicTree::setAbi(abi);
+			SymbolicTree::setConfig(config.get());
+			RDA.runOnModule(*module, abi);
+		}
+
+		/**
+		 * Tree with levels of all its nodes.
+		 */
+		std::string describe(const SymbolicTree& tree)
+		{
+			std::string ret = tree.print();
+			for (auto* n : tree.getPreOrder())
+			{
+				ret += std::to_string(n->getLevel()) + " ";
+			}
+			return ret;
+		}
+
+	protected:
+		std::unique_ptr<Config> config;
+		ReachingDefinitionsAnalysis RDA;
+		SymbolicTreeCache cache;
+};
+
+TEST_F(SymbolicTreeTests,
+treesFromCacheAreSameAsTreesWithoutCache)
+{
+	parseInput(R"(
+		@glob0 = global i32 0
+		define void @func1(i1 %c) {
+		entry:
+			store i32 1, i32* @glob0
+			br i1 %c, label %then, label %join
+		then:
+			store i32 2, i32* @glob0
+			br label %join
+		join:
+			%a = load i32, i32* @glob0
+			%b = add i32 %a, %a
+			%d = add i32 %b, %a
+			%e = bitcast i32 %d to float
+			store float %e, float* bitcast (i32* @glob0 to float*)
+			ret void
+		}
+	)");
+	RDA.runOnModule(*module);
+
+	for (auto& i : instructions(module->getFunction("func1")))
+	{
+		SCOPED_TRACE(llvmObjToString(&i));
+		for (unsigned level : {0, 1, 3, 10})
+		{
+			auto tree = SymbolicTree::PrecomputedRda(RDA, &i, level);
+			auto cached = SymbolicTree::PrecomputedRda(cache, RDA, &i, level);
+
+			EXPECT_EQ(describe(tree), describe(cached));
+		}
+	}
+}
+
+TEST_F(SymbolicTreeTests,
+linearTreesFromCacheAreSameAsTreesWithoutCache)
+{
+	parseInput(R"(
+		@glob0 = global i32 0
+		define void @func1() {
+		entry:
+			store i32 1, i32* @glob0
+			br label %next
+		next:
+			%a = load i32, i32* @glob0
+			%b = add i32 %a, %a
+			ret void
+		}
+	)");
+
+	auto* b = getInstructionByName("b");
+	auto tree = SymbolicTree::Linear(b);
+	auto cached = SymbolicTree::Linear(cache, b);
+	auto onDemand = SymbolicTree::OnDemandRda(b);
+	auto onDemandCached = SymbolicTree::OnDemandRda(cache, b);
+
+	EXPECT_EQ(describe(tree), describe(cached));
+	EXPECT_EQ(describe(onDemand), describe(onDemandCached));
+}
+
+TEST_F(SymbolicTreeTests,
+sharedSubtreesAreExpandedOnlyOnce)
+{
+	parseInput(R"(
+		define void @func1(i32 %p) {
+			%a = add i32 %p, 1
+			%b = add i32 %a, %a
+			%c = add i32 %b, %b
+			%d = add i32 %c, %c
+			ret void
+		}
+	)");
+	RDA.runOnModule(*module);
+
+	auto tree = SymbolicTree::PrecomputedRda(
+			cache,
+			RDA,
+			getInstructionByName("d"));
+	auto size = cache.size();
+
+	EXPECT_EQ(31, tree.getPreOrder().size());
+	EXPECT_EQ(6, size);
+
+	SymbolicTree::PrecomputedRda(cache, RDA, getInstructionByName("d"));
+
+	EXPECT_EQ(size, cache.size());
+}
+
+TEST_F(SymbolicTreeTests,
+simplifiedTreesFromCacheAreSameAsTreesWithoutCache)
+{
+	parseInput(R"(
+		@glob0 = global i32 0
+		define void @func1(i1 %c) {
+		entry:
+			%a = add i32 1, 3
+			%b = add i32 %a, 2
+			store i32 %b, i32* @glob0
+			br i1 %c, label %then, label %join
+		then:
+			store i32 6, i32* @glob0
+			br label %join
+		join:
+			%x = load i32, i32* @glob0
+			%y = sub i32 %x, 0
+			%z1 = add i32 %y, %y
+			%z2 = add i32 %z1, %z1
+			%z3 = add i32 %z2, %z2
+			%z4 = add i32 %z3, %z3
+			ret void
+		}
+	)");
+	setX86Abi();
+
+	for (auto& i : instructions(module->getFunction("func1")))
+	{
+		SCOPED_TRACE(llvmObjToString(&i));
+		auto tree = SymbolicTree::PrecomputedRda(RDA, &i);
+		tree.simplifyNode();
+		// The second tree uses simplifications memoized by the first one.
+		for (int j = 0; j < 2; ++j)
+		{
+			auto cached = SymbolicTree::PrecomputedRda(cache, RDA, &i);
+			cached.simplifyNode();
+
+			EXPECT_EQ(describe(tree), describe(cached));
+		}
+	}
+}
+
+TEST_F(SymbolicTreeTests,
+modifiedTreeIsNotSimplifiedFromCache)
+{
+	parseInput(R"(
+		define void @func1() {
+			%a = add i32 1, 3
+			%b = add i32 %a, %a
+			%c = add i32 %b, %b
+			%d = add i32 %c, %c
+			%e = add i32 %d, %d
+			ret void
+		}
+	)");
+	setX86Abi();
+	auto* e = getInstructionByName("e");
+	auto simplified = SymbolicTree::PrecomputedRda(cache, RDA, e);
+	simplified.simplifyNode();
+
+	auto tree = SymbolicTree::PrecomputedRda(cache, RDA, e);
+	tree.ops[0].ops[0].ops[0].ops[0].ops[0].value = ConstantInt::get(
+			e->getType(),
+			2);
+	tree.simplifyNode();
+
+	auto* res1 = dyn_cast<ConstantInt>(simplified.value);
+	auto* res2 = dyn_cast<ConstantInt>(tree.value);
+	ASSERT_NE(nullptr, res1);
+	ASSERT_NE(nullptr, res2);
+	EXPECT_EQ(64, res1->getSExtValue());
+	EXPECT_EQ(65, res2->getSExtValue());
+}
+
+TEST_F(SymbolicTreeTests,
+invalidatedInstructionIsExpandedAgain)
+{
+	parseInput(R"(
+		define void @func1(i32 %p, i32 %q) {
+			%a = add i32 %p, 1
+			%b = add i32 %a, 2
+			ret void
+		}
+	)");
+	RDA.runOnModule(*module);
+	auto* a = getInstructionByName("a");
+	auto* b = getInstructionByName("b");
+	SymbolicTree::PrecomputedRda(cache, RDA, b);
+
+	auto* q = &*std::next(module->getFunction("func1")->arg_begin());
+	a->replaceUsesOfWith(a->getOperand(0), q);
+	cache.invalidate(a);
+	auto tree = SymbolicTree::PrecomputedRda(cache, RDA, b);
+
+	EXPECT_EQ(
+		describe(SymbolicTree::PrecomputedRda(RDA, b)),
+		describe(tree));
+	EXPECT_EQ(q, tree.ops[0].ops[0].value);
+}
+
+TEST_F(SymbolicTreeTests,
+replacedAndDeletedValuesAreInvalidated)
+{
+	parseInput(R"(
+		define void @func1(i32 %p) {
+			%a = add i32 %p, 1
+			%b = add i32 %a, 2
+			ret void
+		}
+	)");
+	RDA.runOnModule(*module);
+	auto* a = getInstructionByName("a");
+	auto* b = getInstructionByName("b");
+	SymbolicTree::PrecomputedRda(cache, RDA, b);
+
+	a->replaceAllUsesWith(ConstantInt::get(a->getType(), 7));
+	a->eraseFromParent();
+	auto tree = SymbolicTree::PrecomputedRda(cache, RDA, b);
+
+	EXPECT_EQ(
+		describe(SymbolicTree::PrecomputedRda(RDA, b)),
+		describe(tree));
+	EXPECT_TRUE(tree.ops[0].isNullary());
+
+	b->eraseFromParent();
+
+	EXPECT_EQ(0, cache.size());
+}
+
+TEST_F(SymbolicTreeTests,
+changedConfigurationClearsCache)
+{
+	parseInput(R"(
+		define void @func1(i32 %p) {
+			%a = alloca i32
+			store i32 %p, i32* %a
+			%b = load i32, i32* %a
+			ret void
+		}
+	)");
+	RDA.runOnModule(*module);
+	auto* b = getInstructionByName("b");
+
+	auto tracked = SymbolicTree::PrecomputedRda(cache, RDA, b);
+	SymbolicTree::setTrackThroughAllocaLoads(false);
+	auto notTracked = SymbolicTree::PrecomputedRda(cache, RDA, b);
+
+	EXPECT_EQ(1, tracked.ops.size());
+	EXPECT_TRUE(notTracked.isNullary());
+}
+
+} // namespace tests
+} // namespace bin2llvmir
+} // namespace retdec
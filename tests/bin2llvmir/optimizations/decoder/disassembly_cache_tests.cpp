@@ -0,0 +1,185 @@
+/**
+* @file tests/bin2llvmir/optimizations/decoder/disassembly_cache_tests.cpp
+* @brief Tests for the @c DisassemblyCache class.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <sstream>
+#include <vector>
+
+#include "retdec/bin2llvmir/optimizations/decoder/disassembly_cache.h"
+#include "bin2llvmir/utils/llvmir_tests.h"
+
+using namespace ::testing;
+using namespace llvm;
+
+namespace retdec {
+namespace bin2llvmir {
+namespace tests {
+
+/**
+ * @brief Tests for the @c DisassemblyCache class.
+ */
+class DisassemblyCacheTests: public LlvmIrTests
+{
+	protected:
+		void SetUp() override
+		{
+			c2l = capstone2llvmir::Capstone2LlvmIrTranslator::createArm(
+					module.get());
+			ASSERT_NE(nullptr, c2l);
+			cache.setTranslator(c2l.get());
+		}
+
+		/// Disassemble @a n bytes of @c code at @a address in @a mode.
+		cs_insn* disassemble(
+				std::uint64_t address,
+				cs_mode mode,
+				std::size_t n = 4)
+		{
+			const std::uint8_t* bytes = code.data() + (address - base);
+			std::size_t size = n;
+			return cache.disassemble(bytes, size, address, mode);
+		}
+
+		std::string stats()
+		{
+			std::stringstream ss;
+			ss << cache;
+			return ss.str();
+		}
+
+	protected:
+		const std::uint64_t base = 0x1000;
+		/// mov r0, r1; mov r1, r2 in ARM mode
+		const std::vector<std::uint8_t> code = {
+			0x01, 0x00, 0xa0, 0xe1,
+			0x02, 0x10, 0xa0, 0xe1
+		};
+
+		std::unique_ptr<capstone2llvmir::Capstone2LlvmIrTranslator> c2l;
+		DisassemblyCache cache;
+};
+
+TEST_F(DisassemblyCacheTests, disassembleUpdatesParametersToPointAfterInstruction)
+{
+	const std::uint8_t* bytes = code.data();
+	std::size_t size = code.size();
+	std::uint64_t address = base;
+
+	cs_insn* insn = cache.disassemble(bytes, size, address, CS_MODE_ARM);
+
+	ASSERT_NE(nullptr, insn);
+	EXPECT_EQ(base, insn->address);
+	EXPECT_EQ(4, insn->size);
+	EXPECT_EQ(code.data() + 4, bytes);
+	EXPECT_EQ(code.size() - 4, size);
+	EXPECT_EQ(base + 4, address);
+}
+
+TEST_F(DisassemblyCacheTests, sameAddressAndModeIsDisassembledOnlyOnce)
+{
+	cs_insn* first = disassemble(base, CS_MODE_ARM);
+	cs_insn* second = disassemble(base, CS_MODE_ARM);
+
+	ASSERT_NE(nullptr, first);
+	EXPECT_EQ(first, second);
+	EXPECT_EQ(
+			"disassembly cache: hits = 1, misses = 1, hit rate = 50 %",
+			stats());
+}
+
+TEST_F(DisassemblyCacheTests, sameAddressInOtherModeIsDisassembledAgain)
+{
+	cs_insn* arm = disassemble(base, CS_MODE_ARM);
+	cs_insn* thumb = disassemble(base, CS_MODE_THUMB);
+
+	ASSERT_NE(nullptr, arm);
+	ASSERT_NE(nullptr, thumb);
+	EXPECT_NE(arm, thumb);
+	EXPECT_EQ(4, arm->size);
+	EXPECT_EQ(2, thumb->size);
+	EXPECT_EQ(thumb, disassemble(base, CS_MODE_THUMB));
+	EXPECT_EQ(arm, disassemble(base, CS_MODE_ARM));
+	EXPECT_EQ(
+			"disassembly cache: hits = 2, misses = 2, hit rate = 50 %",
+			stats());
+	// Disassembly in other mode does not change mode of the translator.
+	EXPECT_EQ(CS_MODE_ARM, c2l->getBasicMode());
+}
+
+TEST_F(DisassemblyCacheTests, otherAddressIsDisassembledAgain)
+{
+	cs_insn* first = disassemble(base, CS_MODE_ARM);
+	cs_insn* second = disassemble(base + 4, CS_MODE_ARM);
+
+	ASSERT_NE(nullptr, first);
+	ASSERT_NE(nullptr, second);
+	EXPECT_NE(first, second);
+	EXPECT_EQ(base + 4, second->address);
+	EXPECT_EQ(
+			"disassembly cache: hits = 0, misses = 2, hit rate = 0 %",
+			stats());
+}
+
+TEST_F(DisassemblyCacheTests, failedDisassemblyIsRemembered)
+{
+	EXPECT_EQ(nullptr, disassemble(base, CS_MODE_ARM, 2));
+	EXPECT_EQ(nullptr, disassemble(base, CS_MODE_ARM, 2));
+	EXPECT_EQ(nullptr, disassemble(base, CS_MODE_ARM, 1));
+	EXPECT_EQ(
+			"disassembly cache: hits = 2, misses = 1, hit rate = 66 %",
+			stats());
+
+	// More bytes may be enough for the disassembly.
+	EXPECT_NE(nullptr, disassemble(base, CS_MODE_ARM, 4));
+	EXPECT_EQ(
+			"disassembly cache: hits = 2, misses = 2, hit rate = 50 %",
+			stats());
+}
+
+TEST_F(DisassemblyCacheTests, instructionWhichDoesNotFitIntoBytesIsNotReturned)
+{
+	ASSERT_NE(nullptr, disassemble(base, CS_MODE_ARM, 4));
+
+	EXPECT_EQ(nullptr, disassemble(base, CS_MODE_ARM, 2));
+	EXPECT_EQ(
+			"disassembly cache: hits = 1, misses = 1, hit rate = 50 %",
+			stats());
+}
+
+TEST_F(DisassemblyCacheTests, releaseInvalidatesInstructionsInRangeInAllModes)
+{
+	disassemble(base, CS_MODE_ARM);
+	disassemble(base, CS_MODE_THUMB);
+	disassemble(base + 4, CS_MODE_ARM);
+
+	cache.release(base, base + 4);
+
+	ASSERT_NE(nullptr, disassemble(base, CS_MODE_ARM));
+	ASSERT_NE(nullptr, disassemble(base, CS_MODE_THUMB));
+	ASSERT_NE(nullptr, disassemble(base + 4, CS_MODE_ARM));
+	EXPECT_EQ(
+			"disassembly cache: hits = 1, misses = 5, hit rate = 16 %",
+			stats());
+}
+
+TEST_F(DisassemblyCacheTests, clearInvalidatesAllInstructionsAndStatistics)
+{
+	disassemble(base, CS_MODE_ARM);
+	disassemble(base, CS_MODE_ARM);
+
+	cache.clear();
+
+	EXPECT_EQ(
+			"disassembly cache: hits = 0, misses = 0, hit rate = 0 %",
+			stats());
+	ASSERT_NE(nullptr, disassemble(base, CS_MODE_ARM));
+	EXPECT_EQ(
+			"disassembly cache: hits = 0, misses = 1, hit rate = 0 %",
+			stats());
+}
+
+} // namespace tests
+} // namespace bin2llvmir
+} // namespace retdec
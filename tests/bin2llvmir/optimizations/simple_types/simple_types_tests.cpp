@@ -0,0 +1,240 @@
+/**
+* @file tests/bin2llvmir/optimizations/simple_types/simple_types_tests.cpp
+* @brief Tests for the @c SimpleTypesAnalysis equivalence sets.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include "bin2llvmir/utils/llvmir_tests.h"
+#include "retdec/bin2llvmir/optimizations/simple_types/simple_types.h"
+
+using namespace ::testing;
+using namespace llvm;
+
+namespace retdec {
+namespace bin2llvmir {
+namespace tests {
+
+/**
+ * @brief Tests for the @c EqSetUnionFind class.
+ */
+class EqSetUnionFindTests: public LlvmIrTests
+{
+	protected:
+		void parseGlobals()
+		{
+			parseInput(R"(
+				@g1 = global i32 0
+				@g2 = global i16 0
+				@g3 = global float 0.0
+				@g4 = global i8 0
+			)");
+		}
+
+		std::size_t insert(
+				const std::string& name,
+				eSourcePriority p = eSourcePriority::PRIORITY_NONE)
+		{
+			return eqClasses.insert(getValueByName(name), p, module.get());
+		}
+
+		std::vector<Value*> getValues(const EqSet& eq)
+		{
+			std::vector<Value*> ret;
+			for (auto& ve : eq.valSet)
+			{
+				ret.push_back(ve.value);
+			}
+			return ret;
+		}
+
+	protected:
+		EqSetUnionFind eqClasses;
+		EqSetContainer eqSets;
+};
+
+TEST_F(EqSetUnionFindTests, unknownValueHasNoId)
+{
+	parseGlobals();
+
+	EXPECT_EQ(EqSetUnionFind::npos, eqClasses.getId(getValueByName("g1")));
+}
+
+TEST_F(EqSetUnionFindTests, valuesAreNumberedDensely)
+{
+	parseGlobals();
+
+	EXPECT_EQ(0, insert("g1"));
+	EXPECT_EQ(1, insert("g2"));
+	EXPECT_EQ(0, eqClasses.getId(getValueByName("g1")));
+	EXPECT_EQ(1, eqClasses.getId(getValueByName("g2")));
+}
+
+TEST_F(EqSetUnionFindTests, unitedValuesAreInOneSet)
+{
+	parseGlobals();
+	auto g1 = insert("g1");
+	auto g2 = insert("g2");
+	insert("g3");
+
+	eqClasses.unite(g1, g2, module.get());
+	eqClasses.createEqSets(eqSets);
+
+	// Set with a single value and no types is not created.
+	ASSERT_EQ(1, eqSets.eqSets.size());
+	auto& eq = eqSets.eqSets.front();
+	std::vector<Value*> exp = {getValueByName("g1"), getValueByName("g2")};
+	EXPECT_EQ(exp, getValues(eq));
+	EXPECT_EQ(&eq, eqClasses.getEqSet(getValueByName("g1")));
+	EXPECT_EQ(&eq, eqClasses.getEqSet(getValueByName("g2")));
+	EXPECT_EQ(nullptr, eqClasses.getEqSet(getValueByName("g3")));
+	EXPECT_EQ(Type::getInt32Ty(context), eq.masterType.type);
+	EXPECT_EQ(eSourcePriority::PRIORITY_NONE, eq.masterType.priority);
+}
+
+TEST_F(EqSetUnionFindTests, unitingValuesFromTwoSetsUnitesWholeSets)
+{
+	parseGlobals();
+	auto g1 = insert("g1");
+	auto g2 = insert("g2");
+	auto g3 = insert("g3");
+	auto g4 = insert("g4");
+	eqClasses.unite(g1, g2, module.get());
+	eqClasses.unite(g3, g4, module.get());
+
+	eqClasses.unite(g2, g4, module.get());
+	eqClasses.createEqSets(eqSets);
+
+	ASSERT_EQ(1, eqSets.eqSets.size());
+	auto& eq = eqSets.eqSets.front();
+	std::vector<Value*> exp = {
+			getValueByName("g1"),
+			getValueByName("g2"),
+			getValueByName("g3"),
+			getValueByName("g4")};
+	EXPECT_EQ(exp, getValues(eq));
+	EXPECT_EQ(g1, eqClasses.find(g4));
+	EXPECT_EQ(Type::getFloatTy(context), eq.masterType.type);
+	EXPECT_EQ(eSourcePriority::PRIORITY_NONE, eq.masterType.priority);
+}
+
+TEST_F(EqSetUnionFindTests, typeWithHigherPriorityWinsWhenSetsAreUnited)
+{
+	parseGlobals();
+	auto g3 = insert("g3");
+	auto g1 = insert("g1", eSourcePriority::PRIORITY_DEBUG);
+
+	eqClasses.unite(g3, g1, module.get());
+	eqClasses.createEqSets(eqSets);
+
+	ASSERT_EQ(1, eqSets.eqSets.size());
+	auto& eq = eqSets.eqSets.front();
+	EXPECT_EQ(Type::getInt32Ty(context), eq.masterType.type);
+	EXPECT_EQ(eSourcePriority::PRIORITY_DEBUG, eq.masterType.priority);
+}
+
+TEST_F(EqSetUnionFindTests, typeWithHigherPriorityWinsRegardlessOfUnionOrder)
+{
+	parseGlobals();
+	auto g1 = insert("g1", eSourcePriority::PRIORITY_DEBUG);
+	auto g3 = insert("g3");
+
+	eqClasses.unite(g3, g1, module.get());
+	eqClasses.createEqSets(eqSets);
+
+	ASSERT_EQ(1, eqSets.eqSets.size());
+	auto& eq = eqSets.eqSets.front();
+	EXPECT_EQ(Type::getInt32Ty(context), eq.masterType.type);
+	EXPECT_EQ(eSourcePriority::PRIORITY_DEBUG, eq.masterType.priority);
+}
+
+TEST_F(EqSetUnionFindTests, addedTypesAreMergedIntoMasterType)
+{
+	parseGlobals();
+	auto g1 = insert("g1");
+	auto g2 = insert("g2");
+	eqClasses.insert(
+			g1,
+			TypeEntry(Type::getFloatTy(context), eSourcePriority::PRIORITY_LTI),
+			module.get());
+	eqClasses.insert(
+			g2,
+			TypeEntry(Type::getDoubleTy(context), eSourcePriority::PRIORITY_LTI),
+			module.get());
+
+	eqClasses.unite(g1, g2, module.get());
+	eqClasses.createEqSets(eqSets);
+
+	ASSERT_EQ(1, eqSets.eqSets.size());
+	auto& eq = eqSets.eqSets.front();
+	EXPECT_EQ(2, eq.typeSet.size());
+	EXPECT_EQ(Type::getDoubleTy(context), eq.masterType.type);
+	EXPECT_EQ(eSourcePriority::PRIORITY_LTI, eq.masterType.priority);
+}
+
+TEST_F(EqSetUnionFindTests, singleValueWithTwoTypesIsSet)
+{
+	parseGlobals();
+	auto g1 = insert("g1");
+	eqClasses.insert(
+			g1,
+			TypeEntry(Type::getFloatTy(context), eSourcePriority::PRIORITY_LTI),
+			module.get());
+	eqClasses.insert(
+			g1,
+			TypeEntry(Type::getInt16Ty(context), eSourcePriority::PRIORITY_NONE),
+			module.get());
+
+	eqClasses.createEqSets(eqSets);
+
+	ASSERT_EQ(1, eqSets.eqSets.size());
+	auto& eq = eqSets.eqSets.front();
+	std::vector<Value*> exp = {getValueByName("g1")};
+	EXPECT_EQ(exp, getValues(eq));
+	EXPECT_EQ(Type::getFloatTy(context), eq.masterType.type);
+	EXPECT_EQ(eSourcePriority::PRIORITY_LTI, eq.masterType.priority);
+}
+
+/**
+ * @brief Tests for the @c ValueEntry class.
+ */
+class ValueEntryTests: public LlvmIrTests
+{
+
+};
+
+TEST_F(ValueEntryTests, getSourcePriorityOfGlobalFromDebug)
+{
+	parseInput(R"(
+		@gv = global i32 0
+	)");
+	auto config = Config::empty(module.get());
+	auto cgv = retdec::common::Object(
+			"gv",
+			retdec::common::Storage::inMemory(0x1234));
+	cgv.setIsFromDebug(true);
+	config.getConfig().globals.insert(cgv);
+
+	EXPECT_EQ(
+			eSourcePriority::PRIORITY_DEBUG,
+			ValueEntry::getSourcePriority(&config, getValueByName("gv")));
+}
+
+TEST_F(ValueEntryTests, getSourcePriorityOfGlobalNotFromDebug)
+{
+	parseInput(R"(
+		@gv = global i32 0
+	)");
+	auto config = Config::empty(module.get());
+	auto cgv = retdec::common::Object(
+			"gv",
+			retdec::common::Storage::inMemory(0x1234));
+	config.getConfig().globals.insert(cgv);
+
+	EXPECT_EQ(
+			eSourcePriority::PRIORITY_NONE,
+			ValueEntry::getSourcePriority(&config, getValueByName("gv")));
+}
+
+} // namespace tests
+} // namespace bin2llvmir
+} // namespace retdec
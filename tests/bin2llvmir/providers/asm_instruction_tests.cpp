@@ -1706,6 +1706,116 @@ TEST_F(AsmInstructionTests, getInstructionFirstReturnsNullptrIfItDoesNotContainI
 	EXPECT_EQ(nullptr, ai.getInstructionFirst<llvm::CallInst>());
 }
 
+//
+// getCapstoneInsn(), getTemporaryCapstoneInsn(), getByteSize(), getDsm()
+//
+
+/**
+ * push ebp
+ * mov ebp, esp
+ */
+const std::uint8_t x86Bytes[] = {0x55, 0x89, 0xe5};
+
+TEST_F(AsmInstructionTests, instructionsAreDisassembledFromInstructionTable)
+{
+	parseInput(R"(
+		define void @fnc() {
+			store volatile i64 1234, i64* @llvm2asm
+			store volatile i64 1235, i64* @llvm2asm
+			ret void
+		}
+		@llvm2asm = global i64 0
+	)");
+	auto* mapGv = getGlobalByName("llvm2asm");
+	AsmInstruction::setLlvmToAsmGlobalVariable(module.get(), mapGv);
+	auto& table = AsmInstruction::getInstructionTable(module.get());
+	table.setArchitecture(CS_ARCH_X86);
+	table.add(1234, x86Bytes, 1, CS_MODE_32);
+	table.add(1235, x86Bytes + 1, 2, CS_MODE_32);
+	auto ai1 = AsmInstruction(module.get(), 1234);
+	auto ai2 = AsmInstruction(module.get(), 1235);
+
+	EXPECT_EQ(2, table.size());
+	EXPECT_EQ(1, ai1.getByteSize());
+	EXPECT_EQ(1237, ai2.getEndAddress());
+	EXPECT_EQ("push ebp", ai1.getDsm());
+	EXPECT_EQ("mov ebp, esp", ai2.getDsm());
+	auto* insn = ai2.getCapstoneInsn();
+	ASSERT_NE(nullptr, insn);
+	EXPECT_EQ(X86_INS_MOV, insn->id);
+	EXPECT_EQ(1235, insn->address);
+	EXPECT_EQ(2, insn->detail->x86.op_count);
+	EXPECT_EQ(insn, ai2.getCapstoneInsn());
+	auto* tmp = ai1.getTemporaryCapstoneInsn();
+	ASSERT_NE(nullptr, tmp);
+	EXPECT_EQ(X86_INS_PUSH, tmp->id);
+}
+
+TEST_F(AsmInstructionTests, instructionWithoutRecordHasNoCapstoneInsn)
+{
+	parseInput(R"(
+		define void @fnc() {
+			store volatile i64 1234, i64* @llvm2asm
+			ret void
+		}
+		@llvm2asm = global i64 0
+	)");
+	auto* mapGv = getGlobalByName("llvm2asm");
+	AsmInstruction::setLlvmToAsmGlobalVariable(module.get(), mapGv);
+	auto ai = AsmInstruction(module.get(), 1234);
+
+	EXPECT_EQ(nullptr, ai.getCapstoneInsn());
+	EXPECT_EQ(0, ai.getByteSize());
+
+	auto& table = AsmInstruction::getInstructionTable(module.get());
+	table.setArchitecture(CS_ARCH_X86);
+	table.add(1235, x86Bytes + 1, 2, CS_MODE_32);
+
+	EXPECT_EQ(nullptr, ai.getCapstoneInsn());
+	EXPECT_EQ(nullptr, ai.getTemporaryCapstoneInsn());
+}
+
+TEST_F(AsmInstructionTests, clearedInstructionTableHasNoInstructions)
+{
+	AsmInstructionTable table;
+	table.setArchitecture(CS_ARCH_X86);
+	table.add(1234, x86Bytes, 1, CS_MODE_32);
+	ASSERT_NE(nullptr, table.getCapstoneInsn(1234));
+
+	table.clear();
+
+	EXPECT_EQ(0, table.size());
+	EXPECT_EQ(nullptr, table.get(1234));
+	EXPECT_EQ(nullptr, table.getCapstoneInsn(1234));
+}
+
+/**
+ * mov r0, r1
+ */
+const std::uint8_t thumbBytes[] = {0x08, 0x46};
+
+TEST_F(AsmInstructionTests, instructionFromItBlockKeepsItsConditionCode)
+{
+	AsmInstructionTable table;
+	table.setArchitecture(CS_ARCH_ARM);
+	table.add(0x1000, thumbBytes, 2, CS_MODE_THUMB);
+	auto* insn = table.getCapstoneInsn(0x1000);
+	ASSERT_NE(nullptr, insn);
+	ASSERT_EQ(ARM_CC_AL, insn->detail->arm.cc);
+
+	// The same instruction as it is decoded in an IT block.
+	cs_insn decoded = *insn;
+	cs_detail detail = *insn->detail;
+	detail.arm.cc = ARM_CC_EQ;
+	decoded.detail = &detail;
+	table.add(0x1000, thumbBytes, 2, CS_MODE_THUMB, &decoded);
+
+	auto* kept = table.getCapstoneInsn(0x1000);
+	ASSERT_NE(nullptr, kept);
+	EXPECT_EQ(ARM_CC_EQ, kept->detail->arm.cc);
+	EXPECT_EQ(kept, table.getTemporaryCapstoneInsn(0x1000));
+}
+
 } // namespace tests
 } // namespace bin2llvmir
 } // namespace retdec
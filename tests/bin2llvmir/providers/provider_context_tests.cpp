@@ -0,0 +1,115 @@
+/**
+* @file tests/bin2llvmir/providers/provider_context_tests.cpp
+* @brief Tests for the @c ProviderContext.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <thread>
+#include <vector>
+
+#include "retdec/bin2llvmir/providers/config.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
+#include "bin2llvmir/utils/llvmir_tests.h"
+
+using namespace ::testing;
+using namespace llvm;
+
+namespace retdec {
+namespace bin2llvmir {
+namespace tests {
+
+/**
+ * @brief Tests for the @c ProviderContext.
+ */
+class ProviderContextTests: public LlvmIrTests
+{
+
+};
+
+TEST_F(ProviderContextTests, getContextReturnsNullptrForUnknownModule)
+{
+	EXPECT_EQ(nullptr, ProviderContext::getContext(module.get()));
+}
+
+TEST_F(ProviderContextTests, createContextCreatesContextOnlyOnce)
+{
+	auto& c1 = ProviderContext::createContext(module.get());
+	auto& c2 = ProviderContext::createContext(module.get());
+
+	EXPECT_EQ(&c1, &c2);
+	EXPECT_EQ(&c1, ProviderContext::getContext(module.get()));
+}
+
+TEST_F(ProviderContextTests, contextsOfDifferentModulesAreIndependent)
+{
+	auto other = std::make_unique<Module>("other", context);
+	retdec::config::Config c1;
+	retdec::config::Config c2;
+
+	auto* r1 = ConfigProvider::addConfig(module.get(), c1);
+	auto* r2 = ConfigProvider::addConfig(other.get(), c2);
+
+	EXPECT_NE(r1, r2);
+	EXPECT_EQ(&c1, &r1->getConfig());
+	EXPECT_EQ(&c2, &r2->getConfig());
+}
+
+TEST_F(ProviderContextTests, removeContextRemovesOnlyDataOfGivenModule)
+{
+	auto other = std::make_unique<Module>("other", context);
+	retdec::config::Config c1;
+	retdec::config::Config c2;
+	ConfigProvider::addConfig(module.get(), c1);
+	auto* r2 = ConfigProvider::addConfig(other.get(), c2);
+
+	ProviderContext::removeContext(module.get());
+
+	EXPECT_EQ(nullptr, ProviderContext::getContext(module.get()));
+	EXPECT_EQ(nullptr, ConfigProvider::getConfig(module.get()));
+	EXPECT_EQ(r2, ConfigProvider::getConfig(other.get()));
+}
+
+TEST_F(ProviderContextTests, modulesCanBeProcessedInParallel)
+{
+	const std::size_t n = 8;
+	std::vector<std::unique_ptr<LLVMContext>> contexts;
+	std::vector<std::unique_ptr<Module>> modules;
+	std::vector<retdec::config::Config> configs(n);
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		contexts.push_back(std::make_unique<LLVMContext>());
+		modules.push_back(std::make_unique<Module>("m", *contexts.back()));
+	}
+
+	std::vector<int> ok(n, 0);
+	std::vector<std::thread> threads;
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		threads.emplace_back([&, i]()
+		{
+			bool res = true;
+			for (unsigned j = 0; j < 100; ++j)
+			{
+				auto* c = ConfigProvider::addConfig(modules[i].get(), configs[i]);
+				res &= ConfigProvider::getConfig(modules[i].get()) == c;
+				res &= &c->getConfig() == &configs[i];
+				ProviderContext::removeContext(modules[i].get());
+				res &= ConfigProvider::getConfig(modules[i].get()) == nullptr;
+			}
+			ok[i] = res;
+		});
+	}
+	for (auto& t : threads)
+	{
+		t.join();
+	}
+
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		EXPECT_TRUE(ok[i]);
+	}
+}
+
+} // namespace tests
+} // namespace bin2llvmir
+} // namespace retdec
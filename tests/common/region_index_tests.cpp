@@ -0,0 +1,139 @@
+/**
+* @file tests/common/region_index_tests.cpp
+* @brief Tests for the @c region_index module.
+* @copyright (c) 2019 Avast Software, licensed under the MIT license
+*/
+
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "retdec/common/region_index.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace common {
+namespace tests {
+
+/**
+ * @brief Tests for the @c RegionIndex class.
+ */
+class RegionIndexTests: public Test
+{
+	public:
+		using Index = RegionIndex<int>;
+
+		static bool noneIsBetter(const Index::Region&, const Index::Region&)
+		{
+			return false;
+		}
+
+		static bool laterStartIsBetter(
+				const Index::Region& a,
+				const Index::Region& b)
+		{
+			return a.start > b.start
+					|| (a.start == b.start && a.end - a.start < b.end - b.start);
+		}
+};
+
+TEST_F(RegionIndexTests, EmptyIndexFindsNothing)
+{
+	Index index({}, noneIsBetter);
+
+	EXPECT_EQ(nullptr, index.find(0));
+	EXPECT_EQ(nullptr, index.find(0x1000));
+}
+
+TEST_F(RegionIndexTests, FindsDisjointRegions)
+{
+	int a = 0, b = 1;
+	Index index({{0x1000, 0x2000, &a}, {0x3000, 0x4000, &b}}, noneIsBetter);
+
+	EXPECT_EQ(nullptr, index.find(0xfff));
+	EXPECT_EQ(&a, index.find(0x1000));
+	EXPECT_EQ(&a, index.find(0x1fff));
+	EXPECT_EQ(nullptr, index.find(0x2000));
+	EXPECT_EQ(&b, index.find(0x3000));
+	EXPECT_EQ(&b, index.find(0x3fff));
+	EXPECT_EQ(nullptr, index.find(0x4000));
+	EXPECT_EQ(2, index.getNumberOfRegions());
+}
+
+TEST_F(RegionIndexTests, FirstRegionWinsIfNoneIsBetter)
+{
+	int a = 0, b = 1;
+	Index index({{0x1000, 0x3000, &a}, {0x2000, 0x4000, &b}}, noneIsBetter);
+
+	EXPECT_EQ(&a, index.find(0x1500));
+	EXPECT_EQ(&a, index.find(0x2500));
+	EXPECT_EQ(&b, index.find(0x3500));
+}
+
+TEST_F(RegionIndexTests, BetterRegionWins)
+{
+	int a = 0, b = 1, c = 2;
+	Index index(
+			{{0x1000, 0x5000, &a}, {0x2000, 0x3000, &b}, {0x2000, 0x2800, &c}},
+			laterStartIsBetter);
+
+	EXPECT_EQ(&a, index.find(0x1500));
+	EXPECT_EQ(&c, index.find(0x2000));
+	EXPECT_EQ(&b, index.find(0x2800));
+	EXPECT_EQ(&a, index.find(0x3000));
+}
+
+TEST_F(RegionIndexTests, EmptyRegionsAreNeverFound)
+{
+	int a = 0;
+	Index index({{0x1000, 0x1000, &a}}, noneIsBetter);
+
+	EXPECT_EQ(nullptr, index.find(0x1000));
+}
+
+TEST_F(RegionIndexTests, RegionEndIsSaturated)
+{
+	EXPECT_EQ(0x30, Index::regionEnd(0x10, 0x20));
+	EXPECT_EQ(UINT64_MAX, Index::regionEnd(UINT64_MAX - 1, 0x20));
+}
+
+TEST_F(RegionIndexTests, GivesSameResultsAsLinearSearch)
+{
+	std::mt19937 gen(42);
+	std::uniform_int_distribution<std::uint64_t> pos(0, 200);
+	std::uniform_int_distribution<std::uint64_t> len(0, 40);
+
+	for (int round = 0; round < 50; ++round)
+	{
+		std::vector<int> values(20);
+		std::vector<Index::Region> regions;
+		for (auto& v : values)
+		{
+			auto start = pos(gen);
+			regions.push_back({start, start + len(gen), &v});
+		}
+
+		Index index(regions, laterStartIsBetter);
+
+		for (std::uint64_t addr = 0; addr < 260; ++addr)
+		{
+			const int* expected = nullptr;
+			const Index::Region* actual = nullptr;
+			for (const auto& r : regions)
+			{
+				if (r.start <= addr && addr < r.end
+						&& (!actual || laterStartIsBetter(r, *actual)))
+				{
+					actual = &r;
+					expected = r.value;
+				}
+			}
+			ASSERT_EQ(expected, index.find(addr)) << "address " << addr;
+		}
+	}
+}
+
+} // namespace tests
+} // namespace common
+} // namespace retdec
@@ -0,0 +1,187 @@
+/**
+ * @file tests/cpdetect/literal_index_tests.cpp
+ * @brief Tests for the @c literal_index module.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/cpdetect/literal_index.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace cpdetect {
+namespace tests {
+
+/**
+ * Tests for the @c LiteralIndex class.
+ */
+class LiteralIndexTests : public Test
+{
+	protected:
+		using Offsets = std::vector<std::size_t>;
+
+		LiteralIndex index;
+};
+
+TEST_F(LiteralIndexTests, NewIndexIsNotBuilt)
+{
+	EXPECT_FALSE(index.isBuilt());
+	EXPECT_FALSE(index.isRegistered("UPX!"));
+	EXPECT_TRUE(index.getOffsets("UPX!").empty());
+}
+
+TEST_F(LiteralIndexTests, AddedLiteralIsRegistered)
+{
+	index.addLiteral("UPX!");
+
+	EXPECT_TRUE(index.isRegistered("UPX!"));
+	EXPECT_FALSE(index.isRegistered("UPX"));
+	EXPECT_FALSE(index.isBuilt());
+}
+
+TEST_F(LiteralIndexTests, EmptyLiteralIsIgnored)
+{
+	index.addLiteral("");
+
+	EXPECT_FALSE(index.isRegistered(""));
+}
+
+TEST_F(LiteralIndexTests, OffsetsAreNotAvailableBeforeBuild)
+{
+	index.addLiteral("abc");
+
+	EXPECT_TRUE(index.getOffsets("abc").empty());
+	EXPECT_EQ(std::string::npos, index.findFirst("abc", 0, 3));
+}
+
+TEST_F(LiteralIndexTests, BuildFindsAllOccurrences)
+{
+	index.addLiteral("abc");
+	index.build("xabcxxabcabc");
+
+	EXPECT_TRUE(index.isBuilt());
+	EXPECT_EQ(Offsets({1, 6, 9}), index.getOffsets("abc"));
+}
+
+TEST_F(LiteralIndexTests, BuildFindsOccurrencesAtStartAndEndOfText)
+{
+	index.addLiteral("UPX!");
+	index.build("UPX!abcUPX!");
+
+	EXPECT_EQ(Offsets({0, 7}), index.getOffsets("UPX!"));
+}
+
+TEST_F(LiteralIndexTests, BuildFindsLiteralWhichIsWholeText)
+{
+	index.addLiteral("UPX!");
+	index.build("UPX!");
+
+	EXPECT_EQ(Offsets({0}), index.getOffsets("UPX!"));
+}
+
+TEST_F(LiteralIndexTests, BuildFindsOverlappingOccurrencesOfOneLiteral)
+{
+	index.addLiteral("aa");
+	index.addLiteral("abab");
+	index.build("aaaa ababab");
+
+	EXPECT_EQ(Offsets({0, 1, 2}), index.getOffsets("aa"));
+	EXPECT_EQ(Offsets({5, 7}), index.getOffsets("abab"));
+}
+
+TEST_F(LiteralIndexTests, BuildFindsLiteralsWhichAreContainedInOtherLiterals)
+{
+	index.addLiteral("he");
+	index.addLiteral("she");
+	index.addLiteral("his");
+	index.addLiteral("hers");
+	index.build("ushers");
+
+	EXPECT_EQ(Offsets({2}), index.getOffsets("he"));
+	EXPECT_EQ(Offsets({1}), index.getOffsets("she"));
+	EXPECT_EQ(Offsets({2}), index.getOffsets("hers"));
+	EXPECT_TRUE(index.getOffsets("his").empty());
+}
+
+TEST_F(LiteralIndexTests, BuildFindsLiteralsWithAnyBytes)
+{
+	const std::string literal("\x00\xff\x80", 3);
+	const std::string text("\xff\x00\xff\x80\x00", 5);
+	index.addLiteral(literal);
+	index.build(text);
+
+	EXPECT_EQ(Offsets({1}), index.getOffsets(literal));
+}
+
+TEST_F(LiteralIndexTests, NotRegisteredLiteralHasNoOffsets)
+{
+	index.addLiteral("abc");
+	index.build("abcdef");
+
+	EXPECT_FALSE(index.isRegistered("def"));
+	EXPECT_TRUE(index.getOffsets("def").empty());
+	EXPECT_EQ(std::string::npos, index.findFirst("def", 0, 6));
+}
+
+TEST_F(LiteralIndexTests, AddLiteralAfterBuildRequiresNewBuild)
+{
+	index.addLiteral("abc");
+	index.build("abcdef");
+	index.addLiteral("def");
+
+	EXPECT_FALSE(index.isBuilt());
+
+	index.build("abcdef");
+
+	EXPECT_EQ(Offsets({0}), index.getOffsets("abc"));
+	EXPECT_EQ(Offsets({3}), index.getOffsets("def"));
+}
+
+TEST_F(LiteralIndexTests, RebuildForgetsOccurrencesInPreviousText)
+{
+	index.addLiteral("abc");
+	index.build("abcabc");
+	index.build("xxabc");
+
+	EXPECT_EQ(Offsets({2}), index.getOffsets("abc"));
+}
+
+TEST_F(LiteralIndexTests, FindFirstReturnsFirstOccurrenceInArea)
+{
+	index.addLiteral("UPX!");
+	index.build("UPX!abcUPX!");
+
+	EXPECT_EQ(0, index.findFirst("UPX!", 0, 11));
+	EXPECT_EQ(7, index.findFirst("UPX!", 1, 11));
+	EXPECT_EQ(7, index.findFirst("UPX!", 7, 11));
+	EXPECT_EQ(0, index.findFirst("UPX!", 0, 4));
+}
+
+TEST_F(LiteralIndexTests, FindFirstIgnoresOccurrencesReachingOutOfArea)
+{
+	index.addLiteral("UPX!");
+	index.build("UPX!abcUPX!");
+
+	EXPECT_EQ(std::string::npos, index.findFirst("UPX!", 0, 3));
+	EXPECT_EQ(std::string::npos, index.findFirst("UPX!", 1, 10));
+	EXPECT_EQ(std::string::npos, index.findFirst("UPX!", 8, 11));
+	EXPECT_EQ(std::string::npos, index.findFirst("UPX!", 12, 20));
+}
+
+TEST_F(LiteralIndexTests, FindFirstInAreaShorterThanLiteralFindsNothing)
+{
+	index.addLiteral("UPX!");
+	index.build("UPX!");
+
+	EXPECT_EQ(std::string::npos, index.findFirst("UPX!", 0, 2));
+	EXPECT_EQ(std::string::npos, index.findFirst("UPX!", 0, 0));
+}
+
+} // namespace tests
+} // namespace cpdetect
+} // namespace retdec
@@ -0,0 +1,336 @@
+/**
+ * @file tests/cpdetect/search_tests.cpp
+ * @brief Tests for the @c search module.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/cpdetect/search.h"
+#include "retdec/fileformat/file_format/raw_data/raw_data_format.h"
+#include "retdec/utils/string.h"
+
+using namespace ::testing;
+using namespace retdec::fileformat;
+using namespace retdec::utils;
+
+namespace retdec {
+namespace cpdetect {
+namespace tests {
+
+/**
+ * Tests for plain-string searches of the @c Search class.
+ *
+ * Searches of strings registered by @c Search::registerStrings() are
+ * answered from the index of literals, searches of other strings read the
+ * file content. Both must give the same results as the direct search
+ * (@c std::string::find() and @c hasSubstringInArea()).
+ */
+class SearchStringTests : public Test
+{
+	protected:
+		const std::string text = std::string("UPX!aaaa ababab\0UPX0UPX!", 24);
+		/// strings searched for, the empty one is never registered
+		const std::vector<std::string> strings = {
+			"UPX!",
+			"UPX0",
+			"aa",
+			"abab",
+			std::string("b\0U", 3),
+			"missing",
+			""
+		};
+
+		std::unique_ptr<RawDataFormat> parser;
+		std::unique_ptr<Search> search;
+
+	public:
+		void createSearch(const std::string &data)
+		{
+			inputstream << data;
+			parser = std::make_unique<RawDataFormat>(inputstream);
+			search = std::make_unique<Search>(*parser);
+		}
+
+		void expectFindStringIsSameAsDirectSearch()
+		{
+			for (const auto &str : strings)
+			{
+				for (std::size_t start = 0; start <= text.size() + 2; ++start)
+				{
+					EXPECT_EQ(text.find(str, start), search->findString(str, start))
+							<< "'" << str << "' from " << start;
+				}
+			}
+		}
+
+		void expectHasStringIsSameAsDirectSearch()
+		{
+			for (const auto &str : strings)
+			{
+				EXPECT_EQ(contains(text, str), search->hasString(str))
+						<< "'" << str << "'";
+				EXPECT_EQ(
+						hasSubstringInArea(text, str, 0, std::string::npos),
+						search->hasString(str, 0, std::string::npos))
+						<< "'" << str << "' in empty area";
+
+				for (std::size_t start = 0; start <= text.size(); ++start)
+				{
+					for (std::size_t stop = 0; stop <= text.size() + 2; ++stop)
+					{
+						EXPECT_EQ(
+								hasSubstringInArea(text, str, start, stop),
+								search->hasString(str, start, stop))
+								<< "'" << str << "' in <" << start << ", "
+								<< stop << ">";
+					}
+				}
+			}
+		}
+
+	private:
+		std::stringstream inputstream;
+};
+
+TEST_F(SearchStringTests, FindStringFindsRegisteredStringAtFileStartAndEnd)
+{
+	createSearch("UPX!abcUPX!");
+	search->registerStrings({"UPX!"});
+
+	EXPECT_EQ(0, search->findString("UPX!", 0));
+	EXPECT_EQ(7, search->findString("UPX!", 1));
+	EXPECT_EQ(7, search->findString("UPX!", 7));
+	EXPECT_EQ(std::string::npos, search->findString("UPX!", 8));
+	EXPECT_EQ(std::string::npos, search->findString("UPX!", 11));
+	EXPECT_EQ(std::string::npos, search->findString("UPX!", 100));
+}
+
+TEST_F(SearchStringTests, FindStringFindsOverlappingOccurrences)
+{
+	createSearch("aaaaa");
+	search->registerStrings({"aaa", "aa"});
+
+	EXPECT_EQ(0, search->findString("aaa", 0));
+	EXPECT_EQ(1, search->findString("aaa", 1));
+	EXPECT_EQ(2, search->findString("aaa", 2));
+	EXPECT_EQ(std::string::npos, search->findString("aaa", 3));
+	EXPECT_EQ(3, search->findString("aa", 3));
+}
+
+TEST_F(SearchStringTests, FindStringFindsNotRegisteredString)
+{
+	createSearch("UPX!abcUPX!");
+	search->registerStrings({"abc"});
+
+	EXPECT_EQ(0, search->findString("UPX!", 0));
+	EXPECT_EQ(7, search->findString("UPX!", 1));
+	EXPECT_EQ(std::string::npos, search->findString("UPX!", 8));
+	EXPECT_EQ(5, search->findString("bc", 0));
+}
+
+TEST_F(SearchStringTests, HasStringFindsRegisteredStringInAreaAtFileStartAndEnd)
+{
+	createSearch("UPX!abcUPX!");
+	search->registerStrings({"UPX!"});
+
+	EXPECT_TRUE(search->hasString("UPX!"));
+	EXPECT_TRUE(search->hasString("UPX!", 0, 3));
+	EXPECT_FALSE(search->hasString("UPX!", 0, 2));
+	EXPECT_TRUE(search->hasString("UPX!", 7, 10));
+	EXPECT_TRUE(search->hasString("UPX!", 7, 100));
+	EXPECT_FALSE(search->hasString("UPX!", 1, 9));
+	EXPECT_FALSE(search->hasString("UPX!", 8, 10));
+}
+
+TEST_F(SearchStringTests, HasStringInEmptyAreaAtFileStartFindsNothing)
+{
+	createSearch("UPX!abcUPX!");
+	search->registerStrings({"UPX!"});
+
+	// Stop offset of empty area at offset 0 overflows.
+	EXPECT_FALSE(search->hasString("UPX!", 0, std::string::npos));
+	EXPECT_FALSE(search->hasString("UPX!", 5, 4));
+}
+
+TEST_F(SearchStringTests, FindStringOfRegisteredStringIsSameAsDirectSearch)
+{
+	createSearch(text);
+	search->registerStrings(strings);
+
+	expectFindStringIsSameAsDirectSearch();
+}
+
+TEST_F(SearchStringTests, FindStringOfNotRegisteredStringIsSameAsDirectSearch)
+{
+	createSearch(text);
+
+	expectFindStringIsSameAsDirectSearch();
+}
+
+TEST_F(SearchStringTests, HasStringOfRegisteredStringIsSameAsDirectSearch)
+{
+	createSearch(text);
+	search->registerStrings(strings);
+
+	expectHasStringIsSameAsDirectSearch();
+}
+
+TEST_F(SearchStringTests, HasStringOfNotRegisteredStringIsSameAsDirectSearch)
+{
+	createSearch(text);
+
+	expectHasStringIsSameAsDirectSearch();
+}
+
+/**
+ * Tests for the similarity pre-check of the @c Search class.
+ *
+ * @c Search::mayBeSimilar() may only reject patterns whose similarity found
+ * by @c Search::areaSimilarity() is surely lower than the given ratio.
+ */
+class SearchSimilarityTests : public Test
+{
+	protected:
+		/// nibbles "558BEC83EC105356"
+		const std::string text = "\x55\x8B\xEC\x83\xEC\x10\x53\x56";
+
+		std::unique_ptr<RawDataFormat> parser;
+		std::unique_ptr<Search> search;
+
+	public:
+		void createSearch(const std::string &data)
+		{
+			inputstream << data;
+			parser = std::make_unique<RawDataFormat>(inputstream);
+			search = std::make_unique<Search>(*parser);
+		}
+
+		bool isSimilar(
+				const std::string &pattern,
+				std::size_t startOffset,
+				std::size_t stopOffset,
+				double minRatio)
+		{
+			Similarity sim;
+			return search->areaSimilarity(pattern, sim, startOffset, stopOffset)
+					&& sim.ratio >= minRatio;
+		}
+
+	private:
+		std::stringstream inputstream;
+};
+
+TEST_F(SearchSimilarityTests, MayBeSimilarAcceptsExactMatch)
+{
+	createSearch(text);
+
+	EXPECT_TRUE(search->mayBeSimilar("558BEC", 0, 2, 1.0));
+	EXPECT_TRUE(search->mayBeSimilar("EC8", 0, 7, 1.0));
+	EXPECT_TRUE(search->mayBeSimilar("558BEC83EC105356", 0, 7, 1.0));
+}
+
+TEST_F(SearchSimilarityTests, MayBeSimilarAcceptsPatternWithExactlyMinimalRatio)
+{
+	createSearch(text);
+
+	// One different nibble out of six.
+	ASSERT_TRUE(isSimilar("558BEE", 0, 2, 5.0 / 6));
+	EXPECT_TRUE(search->mayBeSimilar("558BEE", 0, 2, 5.0 / 6));
+	EXPECT_FALSE(isSimilar("558BEE", 0, 2, 5.0 / 6 + 0.01));
+	EXPECT_FALSE(search->mayBeSimilar("558BEE", 0, 2, 5.0 / 6 + 0.01));
+}
+
+TEST_F(SearchSimilarityTests, MayBeSimilarDoesNotCountWildcards)
+{
+	createSearch(text);
+
+	// Two different nibbles out of five, wildcards are not counted.
+	ASSERT_TRUE(isSimilar("5?8BFF", 0, 2, 0.6));
+	EXPECT_TRUE(search->mayBeSimilar("5?8BFF", 0, 2, 0.6));
+	EXPECT_FALSE(search->mayBeSimilar("5?8BFF", 0, 2, 0.61));
+	EXPECT_TRUE(search->mayBeSimilar("55--EC", 0, 2, 1.0));
+	EXPECT_TRUE(search->mayBeSimilar("?-?-83", 0, 3, 1.0));
+}
+
+TEST_F(SearchSimilarityTests, MayBeSimilarRejectsPatternWithoutImportantNibbles)
+{
+	createSearch(text);
+
+	EXPECT_FALSE(isSimilar("", 0, 7, 0.5));
+	EXPECT_FALSE(search->mayBeSimilar("", 0, 7, 0.5));
+	EXPECT_FALSE(isSimilar("--??", 0, 7, 0.5));
+	EXPECT_FALSE(search->mayBeSimilar("--??", 0, 7, 0.5));
+}
+
+TEST_F(SearchSimilarityTests, MayBeSimilarRejectsPatternLongerThanArea)
+{
+	createSearch(text);
+
+	EXPECT_FALSE(search->mayBeSimilar("558BEC83EC1053560", 0, 7, 0.5));
+	EXPECT_FALSE(search->mayBeSimilar("558BEC", 0, 1, 0.5));
+	EXPECT_FALSE(search->mayBeSimilar("558BEC", 2, 1, 0.5));
+}
+
+TEST_F(SearchSimilarityTests, MayBeSimilarNeverRejectsPatternAcceptedByAreaSimilarity)
+{
+	createSearch(text);
+	const std::vector<std::string> patterns = {
+		"558BEC",
+		"8BEC83",
+		"558BEE",
+		"FF8BEC",
+		"55--EC",
+		"5?8BFF",
+		"?-?-83",
+		"EC10",
+		"C",
+		"FFFF",
+		"53565",
+		"558BEC83EC105356",
+		"558BEC83EC105357",
+		"558BEC83EC1053560",
+		"--??",
+		""
+	};
+	const std::vector<double> ratios = {
+		0.0, 0.2, 0.25, 0.5, 0.6, 2.0 / 3, 0.75, 0.8, 5.0 / 6, 1.0
+	};
+
+	for (const auto &pattern : patterns)
+	{
+		for (std::size_t start = 0; start <= text.size(); ++start)
+		{
+			for (std::size_t stop = start; stop <= text.size() + 1; ++stop)
+			{
+				// Similarity found by the full comparison is the boundary.
+				Similarity sim;
+				auto boundaries = ratios;
+				if (search->areaSimilarity(pattern, sim, start, stop))
+				{
+					boundaries.push_back(sim.ratio);
+				}
+
+				for (const auto ratio : boundaries)
+				{
+					if (isSimilar(pattern, start, stop, ratio))
+					{
+						EXPECT_TRUE(
+								search->mayBeSimilar(pattern, start, stop, ratio))
+								<< "'" << pattern << "' in <" << start << ", "
+								<< stop << "> with ratio " << ratio;
+					}
+				}
+			}
+		}
+	}
+}
+
+} // namespace tests
+} // namespace cpdetect
+} // namespace retdec
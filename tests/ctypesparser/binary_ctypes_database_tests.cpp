@@ -0,0 +1,367 @@
+/**
+* @file tests/ctypesparser/binary_ctypes_database_tests.cpp
+* @brief Tests for the @c binary_ctypes_database module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <fstream>
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include "retdec/ctypes/ctypes.h"
+#include "retdec/ctypesparser/binary_ctypes_compiler.h"
+#include "retdec/ctypesparser/binary_ctypes_database.h"
+#include "retdec/ctypesparser/json_ctypes_parser.h"
+#include "retdec/utils/filesystem.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace ctypesparser {
+namespace tests {
+
+const std::string TYPES_JSON = R"(
+	{
+		"functions": {
+			"strlen": {
+				"decl": "size_t strlen(const char *s);",
+				"header": "string.h",
+				"name": "strlen",
+				"params": [
+					{ "name": "s", "type": "cptr", "annotations": "_In_" }
+				],
+				"ret_type": "size_t"
+			},
+			"printf": {
+				"decl": "int printf(const char *format, ...);",
+				"header": "stdio.h",
+				"name": "printf",
+				"params": [
+					{ "name": "format", "type": "cptr" }
+				],
+				"ret_type": "int",
+				"vararg": true,
+				"call_conv": "cdecl"
+			},
+			"walk": {
+				"decl": "void walk(struct node *n, callback cb, union value v, enum color c, long m[][4]);",
+				"header": "walk.h",
+				"name": "walk",
+				"params": [
+					{ "name": "n", "type": "nodeptr" },
+					{ "name": "cb", "type": "callback" },
+					{ "name": "v", "type": "value" },
+					{ "name": "c", "type": "color" },
+					{ "name": "m", "type": "matrix" }
+				],
+				"ret_type": "void"
+			}
+		},
+		"types": {
+			"int": { "name": "int", "type": "integral_type" },
+			"long": { "name": "long", "type": "integral_type" },
+			"char": { "name": "char", "type": "integral_type", "bit_width": 8 },
+			"double": { "name": "double", "type": "floating_point_type" },
+			"void": { "type": "void" },
+			"constchar": { "modified_type": "char", "type": "qualifier" },
+			"cptr": { "pointed_type": "constchar", "type": "pointer" },
+			"ulong": { "name": "unsigned long", "type": "integral_type" },
+			"size_t": { "name": "size_t", "type": "typedef", "typedefed_type": "ulong" },
+			"node": {
+				"name": "node",
+				"type": "structure",
+				"members": [
+					{ "name": "next", "type": "nodeptr" },
+					{ "name": "data", "type": "double" }
+				]
+			},
+			"nodeptr": { "pointed_type": "node", "type": "pointer" },
+			"fn": {
+				"type": "function",
+				"ret_type": "int",
+				"params": [ { "type": "nodeptr" } ]
+			},
+			"callback": { "pointed_type": "fn", "type": "pointer" },
+			"value": {
+				"name": "value",
+				"type": "union",
+				"members": [
+					{ "name": "i", "type": "int" },
+					{ "name": "d", "type": "double" }
+				]
+			},
+			"color": {
+				"name": "color",
+				"type": "enum",
+				"items": [
+					{ "name": "RED", "value": 0 },
+					{ "name": "BLUE", "value": -5 }
+				]
+			},
+			"matrix": {
+				"type": "array",
+				"element_type": "long",
+				"dimensions": [ "", 4 ]
+			},
+			"unused": { "pointed_type": "missing", "type": "pointer" }
+		}
+	}
+)";
+
+/**
+* @brief Tests for the @c binary_ctypes_database module.
+*/
+class BinaryCTypesDatabaseTests: public Test
+{
+	protected:
+		virtual void TearDown() override
+		{
+			std::error_code ec;
+			fs::remove(path, ec);
+		}
+
+		void compile(const std::string &json)
+		{
+			path = (fs::temp_directory_path() / ("retdec-ctypes-"
+				+ std::to_string(reinterpret_cast<std::uintptr_t>(this))
+				+ ".ltidb")).string();
+			std::istringstream input(json);
+			std::ofstream output(path, std::ios::binary);
+			compileJsonCTypes(input, output);
+		}
+
+		std::shared_ptr<ctypes::Function> parseJsonFunction(const std::string &name)
+		{
+			std::istringstream input(TYPES_JSON);
+			jsonModule = JSONCTypesParser(32).parse(input, typeWidths, callConv);
+			return jsonModule->getFunctionWithName(name);
+		}
+
+		std::shared_ptr<ctypes::Function> loadFunction(const std::string &name)
+		{
+			database = std::make_unique<BinaryCTypesDatabase>(32);
+			EXPECT_TRUE(database->load(path, context, typeWidths, callConv));
+			return database->getFunction(name);
+		}
+
+	protected:
+		std::string path;
+		CTypesParser::TypeWidths typeWidths = {{"long", 64}, {"*", 64}, {"double", 64}};
+		ctypes::CallConvention callConv = ctypes::CallConvention("stdcall");
+		std::shared_ptr<ctypes::Context> context = std::make_shared<ctypes::Context>();
+		std::unique_ptr<ctypes::Module> jsonModule;
+		std::unique_ptr<BinaryCTypesDatabase> database;
+};
+
+/**
+* @brief Textual description of a type, follows named types only once.
+*/
+std::string describe(const std::shared_ptr<ctypes::Type> &type, unsigned depth = 0)
+{
+	std::ostringstream out;
+	out << type->getName();
+	// Bit width of arrays is not set.
+	if (!type->isArray())
+	{
+		out << "/" << type->getBitWidth();
+	}
+	if (depth > 3)
+	{
+		return out.str();
+	}
+
+	if (auto p = std::dynamic_pointer_cast<ctypes::PointerType>(type))
+	{
+		out << "*(" << describe(p->getPointedType(), depth + 1) << ")";
+	}
+	else if (auto t = std::dynamic_pointer_cast<ctypes::TypedefedType>(type))
+	{
+		out << "=(" << describe(t->getAliasedType(), depth + 1) << ")";
+	}
+	else if (auto a = std::dynamic_pointer_cast<ctypes::ArrayType>(type))
+	{
+		out << "[" << describe(a->getElementType(), depth + 1);
+		for (auto d : a->getDimensions())
+		{
+			out << "," << d;
+		}
+		out << "]";
+	}
+	else if (auto c = std::dynamic_pointer_cast<ctypes::CompositeType>(type))
+	{
+		out << "{";
+		for (auto i = c->member_begin(), e = c->member_end(); i != e; ++i)
+		{
+			out << i->getName() << ":" << describe(i->getType(), depth + 1) << ";";
+		}
+		out << "}";
+	}
+	else if (auto en = std::dynamic_pointer_cast<ctypes::EnumType>(type))
+	{
+		for (auto i = en->value_begin(), e = en->value_end(); i != e; ++i)
+		{
+			out << "," << i->getName() << "=" << i->getValue();
+		}
+	}
+	else if (auto f = std::dynamic_pointer_cast<ctypes::FunctionType>(type))
+	{
+		out << "(" << describe(f->getReturnType(), depth + 1);
+		for (auto i = f->parameter_begin(), e = f->parameter_end(); i != e; ++i)
+		{
+			out << "," << describe(*i, depth + 1);
+		}
+		out << ")" << std::string(f->getCallConvention()) << f->isVarArg();
+	}
+	return out.str();
+}
+
+std::string describe(const std::shared_ptr<ctypes::Function> &function)
+{
+	std::ostringstream out;
+	out << function->getName() << " " << describe(function->getType())
+		<< " " << std::string(function->getDeclaration())
+		<< " " << std::string(function->getHeaderFile().getPath());
+	for (auto i = function->parameter_begin(), e = function->parameter_end(); i != e; ++i)
+	{
+		out << " " << i->getName() << ":" << describe(i->getType())
+			<< (i->isIn() ? ":in" : "");
+	}
+	return out.str();
+}
+
+TEST_F(BinaryCTypesDatabaseTests,
+FunctionsFromDatabaseAreSameAsFunctionsParsedFromJson)
+{
+	compile(TYPES_JSON);
+
+	for (auto name : {"strlen", "printf", "walk"})
+	{
+		SCOPED_TRACE(name);
+		auto fromJson = parseJsonFunction(name);
+		auto fromDatabase = loadFunction(name);
+
+		ASSERT_NE(nullptr, fromJson);
+		ASSERT_NE(nullptr, fromDatabase);
+		EXPECT_EQ(describe(fromJson), describe(fromDatabase));
+	}
+}
+
+TEST_F(BinaryCTypesDatabaseTests,
+FunctionsAreCreatedOnlyWhenRequested)
+{
+	compile(TYPES_JSON);
+	BinaryCTypesDatabase db(32);
+
+	ASSERT_TRUE(db.load(path, context, typeWidths, callConv));
+	EXPECT_EQ(3, db.getFunctionCount());
+	EXPECT_TRUE(db.hasFunction("walk"));
+	EXPECT_EQ(nullptr, context->getFunctionWithName("walk"));
+
+	auto walk = db.getFunction("walk");
+
+	EXPECT_EQ(walk, context->getFunctionWithName("walk"));
+	EXPECT_EQ(walk, db.getFunction("walk"));
+	EXPECT_EQ(nullptr, context->getFunctionWithName("strlen"));
+	EXPECT_EQ(nullptr, context->getNamedType("size_t"));
+}
+
+TEST_F(BinaryCTypesDatabaseTests,
+UnknownFunctionIsNotFound)
+{
+	compile(TYPES_JSON);
+	BinaryCTypesDatabase db;
+
+	ASSERT_TRUE(db.load(path, context));
+	EXPECT_FALSE(db.hasFunction("strlen2"));
+	EXPECT_FALSE(db.hasFunction(""));
+	EXPECT_EQ(nullptr, db.getFunction("malloc"));
+}
+
+TEST_F(BinaryCTypesDatabaseTests,
+ManyFunctionsCanBeFound)
+{
+	std::ostringstream json;
+	json << R"({"types": {"int": {"name": "int", "type": "integral_type"}}, "functions": {)";
+	for (int i = 0; i < 5000; ++i)
+	{
+		json << (i ? "," : "") << "\"f" << i << R"(": {"decl": "", "header": "", "params": [], "ret_type": "int"})";
+	}
+	json << "}}";
+	compile(json.str());
+	BinaryCTypesDatabase db;
+
+	ASSERT_TRUE(db.load(path, context));
+	EXPECT_EQ(5000, db.getFunctionCount());
+	for (int i = 0; i < 5000; ++i)
+	{
+		ASSERT_TRUE(db.hasFunction("f" + std::to_string(i))) << i;
+		ASSERT_FALSE(db.hasFunction("g" + std::to_string(i))) << i;
+	}
+	EXPECT_EQ("f1234", db.getFunction("f1234")->getName());
+}
+
+TEST_F(BinaryCTypesDatabaseTests,
+EmptyDatabaseHasNoFunctions)
+{
+	compile(R"({"functions": {}, "types": {}})");
+	BinaryCTypesDatabase db;
+
+	ASSERT_TRUE(db.load(path, context));
+	EXPECT_EQ(0, db.getFunctionCount());
+	EXPECT_EQ(nullptr, db.getFunction("f"));
+}
+
+TEST_F(BinaryCTypesDatabaseTests,
+FileWhichIsNotDatabaseIsNotLoaded)
+{
+	compile(TYPES_JSON);
+	{
+		std::ofstream output(path, std::ios::binary);
+		output << TYPES_JSON;
+	}
+	BinaryCTypesDatabase db;
+
+	EXPECT_FALSE(db.load(path, context));
+	EXPECT_FALSE(db.isLoaded());
+	EXPECT_FALSE(db.load("/this/file/does/not/exist", context));
+}
+
+TEST_F(BinaryCTypesDatabaseTests,
+CompilingInvalidJsonThrowsException)
+{
+	std::istringstream json(R"({"functions": {}})");
+	std::ostringstream output;
+
+	ASSERT_THROW(compileJsonCTypes(json, output), CTypesParseError);
+}
+
+TEST_F(BinaryCTypesDatabaseTests,
+CompilingFunctionWithUndefinedTypeThrowsException)
+{
+	std::istringstream json(R"(
+		{
+			"functions": {
+				"f": {"decl": "", "header": "", "params": [], "ret_type": "missing"}
+			},
+			"types": {}
+		}
+	)");
+	std::ostringstream output;
+
+	ASSERT_THROW(compileJsonCTypes(json, output), CTypesParseError);
+}
+
+TEST_F(BinaryCTypesDatabaseTests,
+DatabasePathReplacesJsonExtension)
+{
+	EXPECT_EQ(
+		"support/types/cstdlib.ltidb",
+		BinaryCTypesDatabase::getDatabasePath("support/types/cstdlib.json")
+	);
+	EXPECT_EQ("types.ltidb", BinaryCTypesDatabase::getDatabasePath("types"));
+}
+
+} // namespace tests
+} // namespace ctypesparser
+} // namespace retdec
@@ -0,0 +1,100 @@
+/**
+* @file tests/fileformat/blob_stream_tests.cpp
+* @brief Tests for the @c blob_stream module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/fileformat/types/dotnet_headers/blob_stream.h"
+
+using namespace ::testing;
+using namespace retdec::utils;
+
+namespace retdec {
+namespace fileformat {
+namespace tests {
+
+/**
+ * Tests for the @c BlobStream class.
+ */
+class BlobStreamTests : public Test
+{
+	protected:
+		using Bytes = std::vector<std::uint8_t>;
+
+		static BlobStream createStream(const Bytes& data)
+		{
+			return BlobStream(data, 0, data.size());
+		}
+};
+
+TEST_F(BlobStreamTests, ElementWithOneByteLengthIsFound)
+{
+	auto stream = createStream({0x00, 0x03, 0x06, 0x08, 0x1C, 0x42});
+
+	EXPECT_EQ(Bytes({0x06, 0x08, 0x1C}), stream.getElementView(1).toVector());
+	EXPECT_EQ(Bytes({0x06, 0x08, 0x1C}), stream.getElement(1));
+	EXPECT_TRUE(stream.getElementView(0).empty());
+}
+
+TEST_F(BlobStreamTests, ElementWithTwoByteLengthIsFound)
+{
+	Bytes data = {0x80, 0x81};
+	Bytes element(0x81, 0x42);
+	data.insert(data.end(), element.begin(), element.end());
+	auto stream = createStream(data);
+
+	EXPECT_EQ(element, stream.getElementView(0).toVector());
+	EXPECT_EQ(element, stream.getElement(0));
+}
+
+TEST_F(BlobStreamTests, ElementWithFourByteLengthIsFound)
+{
+	Bytes data = {0xC0, 0x00, 0x40, 0x01};
+	Bytes element(0x4001, 0x42);
+	data.insert(data.end(), element.begin(), element.end());
+	auto stream = createStream(data);
+
+	EXPECT_EQ(element, stream.getElementView(0).toVector());
+	EXPECT_EQ(element, stream.getElement(0));
+}
+
+TEST_F(BlobStreamTests, ElementOutOfStreamIsEmpty)
+{
+	auto stream = createStream({0x04, 0x06, 0x08, 0x80});
+
+	// Element longer than the rest of the stream.
+	EXPECT_TRUE(stream.getElementView(0).empty());
+	// Length of element does not fit into the stream.
+	EXPECT_TRUE(stream.getElementView(3).empty());
+	// Offset out of the stream.
+	EXPECT_TRUE(stream.getElementView(4).empty());
+	EXPECT_TRUE(stream.getElement(4).empty());
+}
+
+TEST_F(BlobStreamTests, ElementViewIsNotCopiedOnDecoding)
+{
+	auto stream = createStream({0x04, 0x20, 0x01, 0x01, 0x08});
+
+	auto signature = stream.getElementView(0);
+	auto element = stream.getElementView(0);
+	ASSERT_EQ(4, signature.size());
+
+	// Decoded bytes are skipped, the view still points into the stream.
+	signature.removePrefix(2);
+	EXPECT_EQ(element.data() + 2, signature.data());
+	EXPECT_EQ(Bytes({0x01, 0x08}), signature.toVector());
+
+	// Skipping more bytes than remain empties the view.
+	signature.removePrefix(3);
+	EXPECT_TRUE(signature.empty());
+	EXPECT_EQ(element.end(), signature.begin());
+}
+
+} // namespace tests
+} // namespace fileformat
+} // namespace retdec
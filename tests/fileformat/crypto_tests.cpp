@@ -0,0 +1,81 @@
+/**
+* @file tests/fileformat/crypto_tests.cpp
+* @brief Tests for the @c crypto module.
+* @copyright (c) 2020 Avast Software, licensed under the MIT license
+*/
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/fileformat/utils/crypto.h"
+#include "retdec/fileformat/utils/other.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace fileformat {
+namespace tests {
+
+class CryptoTests : public Test
+{
+	protected:
+		const std::string text = "abc";
+		const unsigned char *data = reinterpret_cast<const unsigned char*>(text.data());
+};
+
+TEST_F(CryptoTests, MultiDigestComputesKnownDigests)
+{
+	MultiDigest digest(data, text.size(), MultiDigest::DEFAULT | MultiDigest::SHA1);
+
+	EXPECT_EQ("352441c2", digest.getCrc32());
+	EXPECT_EQ("900150983cd24fb0d6963f7d28e17f72", digest.getMd5());
+	EXPECT_EQ("a9993e364706816aba3e25717850c26c9cd0d89d", digest.getSha1());
+	EXPECT_EQ("ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad", digest.getSha256());
+}
+
+TEST_F(CryptoTests, MultiDigestIsSameAsSingleDigests)
+{
+	MultiDigest digest(data, text.size(), MultiDigest::DEFAULT | MultiDigest::SHA1);
+
+	EXPECT_EQ(getCrc32(data, text.size()), digest.getCrc32());
+	EXPECT_EQ(getMd5(data, text.size()), digest.getMd5());
+	EXPECT_EQ(getSha1(data, text.size()), digest.getSha1());
+	EXPECT_EQ(getSha256(data, text.size()), digest.getSha256());
+}
+
+TEST_F(CryptoTests, MultiDigestOfDataAddedInPartsIsSameAsOfWholeData)
+{
+	std::vector<unsigned char> bytes(0x25000);
+	for (std::size_t i = 0; i < bytes.size(); ++i)
+	{
+		bytes[i] = static_cast<unsigned char>(i * 7 + i / 256);
+	}
+
+	MultiDigest whole(bytes.data(), bytes.size(), MultiDigest::DEFAULT | MultiDigest::ENTROPY);
+	MultiDigest parts(MultiDigest::DEFAULT | MultiDigest::ENTROPY);
+	parts.add(bytes.data(), 0x100);
+	parts.add(bytes.data() + 0x100, bytes.size() - 0x100);
+
+	EXPECT_EQ(whole.getCrc32(), parts.getCrc32());
+	EXPECT_EQ(whole.getMd5(), parts.getMd5());
+	EXPECT_EQ(whole.getSha256(), parts.getSha256());
+	EXPECT_DOUBLE_EQ(whole.getEntropy(), parts.getEntropy());
+	EXPECT_DOUBLE_EQ(computeDataEntropy(bytes.data(), bytes.size()), whole.getEntropy());
+}
+
+TEST_F(CryptoTests, MultiDigestComputesOnlySelectedDigests)
+{
+	MultiDigest digest(data, text.size(), MultiDigest::MD5 | MultiDigest::ENTROPY);
+
+	EXPECT_TRUE(digest.getCrc32().empty());
+	EXPECT_FALSE(digest.getMd5().empty());
+	EXPECT_TRUE(digest.getSha256().empty());
+	EXPECT_DOUBLE_EQ(std::log2(3.0), digest.getEntropy());
+}
+
+} // namespace tests
+} // namespace fileformat
+} // namespace retdec
@@ -4,11 +4,13 @@
 * @copyright (c) 2019 Avast Software, licensed under the MIT license
 */
 
+#include <fstream>
 #include <string>
 
 #include <gtest/gtest.h>
 
 #include "retdec/fileformat/file_format/pe/pe_format.h"
+#include "retdec/utils/filesystem.h"
 #include "fileformat/fileformat_tests.h"
 
 using namespace ::testing;
@@ -204,6 +206,99 @@ TEST_F(PeFormatTests_data, DataInterpretationDefault)
 	EXPECT_EQ(0x105d0040103805c7, res);
 }
 
+/**
+ * Tests for the @c pe_format module - using file path constructor.
+ */
+class PeFormatTests_file : public Test
+{
+	private:
+		std::string path;
+	protected:
+		std::unique_ptr<PeFormat> parser;
+	public:
+		PeFormatTests_file()
+		{
+			path = (fs::temp_directory_path() / ("retdec-pe-format-"
+				+ std::to_string(reinterpret_cast<std::uintptr_t>(this)))).string();
+			std::ofstream file(path, std::ios::binary);
+			file.write(reinterpret_cast<const char*>(peBytes.data()), peBytes.size());
+			file.close();
+			parser = std::make_unique<PeFormat>(path, "");
+		}
+
+		~PeFormatTests_file()
+		{
+			parser.reset();
+			std::error_code ec;
+			fs::remove(path, ec);
+		}
+};
+
+TEST_F(PeFormatTests_file, CorrectParsing)
+{
+	EXPECT_EQ(true, parser->isInValidState());
+	ASSERT_EQ(1, parser->getNumberOfSections());
+	EXPECT_EQ(0x401000, parser->getSection(0)->getAddress());
+	EXPECT_EQ(0x200, parser->getSection(0)->getOffset());
+}
+
+TEST_F(PeFormatTests_file, BytesAreSameAsFileContent)
+{
+	auto bytes = parser->getBytes();
+	EXPECT_EQ(peBytes, bytes.toVector());
+	EXPECT_EQ(peBytes.size(), parser->getFileLength());
+}
+
+TEST_F(PeFormatTests_file, DataInterpretationDefault)
+{
+	std::uint64_t res;
+	EXPECT_EQ(true, parser->get4Byte(0x401000, res));
+	EXPECT_EQ(0x103805c7, res);
+	EXPECT_EQ(true, parser->get8Byte(0x401000, res));
+	EXPECT_EQ(0x105d0040103805c7, res);
+}
+
+TEST(PeFormatTests, DeferredPartsAreSameAsEagerlyLoadedOnes)
+{
+	PeFormat lazy(peBytes.data(), peBytes.size());
+	PeFormat eager(peBytes.data(), peBytes.size(), LoadFlags::LOAD_ALL);
+
+	EXPECT_EQ(eager.getAnomalies(), lazy.getAnomalies());
+	EXPECT_EQ(eager.getRichHeader() == nullptr, lazy.getRichHeader() == nullptr);
+	EXPECT_EQ(eager.getResourceTable() == nullptr, lazy.getResourceTable() == nullptr);
+	EXPECT_EQ(eager.getCertificateTable() == nullptr, lazy.getCertificateTable() == nullptr);
+	EXPECT_EQ(eager.isDotNet(), lazy.isDotNet());
+	EXPECT_EQ(eager.getVisualBasicInfo()->hasProjectName(), lazy.getVisualBasicInfo()->hasProjectName());
+	// Repeated access does not load the part again.
+	EXPECT_EQ(eager.getAnomalies(), lazy.getAnomalies());
+}
+
+TEST(PeImageLoaderTests, SharedFileDataAreCopiedOnlyOnWrite)
+{
+	auto data = peBytes;
+	// Let the raw data of the only section span a whole page.
+	data[0x138 + 16] = 0x00;
+	data[0x138 + 17] = 0x10;
+	data.resize(0x1200, 0xcc);
+
+	PeLib::ImageLoader loader;
+	ASSERT_EQ(PeLib::ERROR_NONE, loader.Load(data.data(), data.size(), PeLib::IoFlagSharedData));
+
+	std::uint8_t value = 0;
+	loader.readImage(&value, 0x1fff, 1);
+	EXPECT_EQ(0xcc, value);
+	loader.readImage(&value, 0x1000, 1);
+	EXPECT_EQ(0xc7, value);
+
+	std::uint8_t newValue = 0x90;
+	loader.writeImage(&newValue, 0x1000, 1);
+	loader.readImage(&value, 0x1000, 1);
+	EXPECT_EQ(0x90, value);
+	loader.readImage(&value, 0x1fff, 1);
+	EXPECT_EQ(0xcc, value);
+	EXPECT_EQ(0xc7, data[0x200]);
+}
+
 } // namespace tests
 } // namespace fileformat
 } // namespace retdec
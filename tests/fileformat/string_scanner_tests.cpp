@@ -0,0 +1,133 @@
+/**
+* @file tests/fileformat/string_scanner_tests.cpp
+* @brief Tests for the @c string_scanner module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/fileformat/types/strings/string_scanner.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace fileformat {
+namespace tests {
+
+class StringScannerTests : public Test
+{
+	protected:
+		using Found = std::tuple<std::size_t, std::size_t, StringType>;
+
+		std::vector<Found> scan(const std::vector<std::uint8_t> &data, CharacterEndianness endian)
+		{
+			std::vector<Found> result;
+			scanStrings(data.data(), data.size(), endian, 4,
+				[&](std::size_t offset, std::size_t length, StringType type) {
+					result.emplace_back(offset, length, type);
+				}
+			);
+			std::sort(result.begin(), result.end());
+			return result;
+		}
+
+		/// Reference implementation which walks the data byte by byte
+		std::vector<Found> scanByCharacters(std::vector<std::uint8_t> data, CharacterEndianness endian)
+		{
+			std::vector<Found> result;
+			const auto size = data.size();
+			// Character at the end may not read its padding from outside of data.
+			data.push_back(0xff);
+
+			for (std::size_t charSize : {1, 2})
+			{
+				auto type = charSize == 1 ? StringType::Ascii : StringType::Wide;
+				for (auto begin = data.cbegin(), end = data.cbegin() + size, itr = begin; itr != end;)
+				{
+					auto stringBeginItr = makeCharacterIterator(itr, begin, end, charSize);
+					if (stringBeginItr.pointsToValidCharacter(endian)
+							&& (endian == CharacterEndianness::Little || itr + 1 != end))
+					{
+						auto stringDataEndItr = makeCharacterIterator(end, begin, end, charSize);
+						auto stringEndItr = stringBeginItr + 1;
+						while (stringEndItr != stringDataEndItr && stringEndItr.pointsToValidCharacter(endian)
+								&& (endian == CharacterEndianness::Little || stringEndItr.getUnderlyingIterator() + 1 != end))
+							++stringEndItr;
+
+						auto length = static_cast<std::size_t>(stringEndItr - stringBeginItr);
+						if (length >= 4)
+							result.emplace_back(itr - begin, length, type);
+
+						itr = stringEndItr.getUnderlyingIterator();
+					}
+					else
+						++itr;
+				}
+			}
+
+			std::sort(result.begin(), result.end());
+			return result;
+		}
+};
+
+TEST_F(StringScannerTests, FindsAsciiAndWideStrings)
+{
+	std::string text = std::string("\x01\x02hello\x00", 8) + std::string("w\0i\0d\0e\0\x01", 9) + "abc";
+	std::vector<std::uint8_t> data(text.begin(), text.end());
+
+	auto found = scan(data, CharacterEndianness::Little);
+
+	ASSERT_EQ(2, found.size());
+	EXPECT_EQ(Found(2, 5, StringType::Ascii), found[0]);
+	EXPECT_EQ(Found(6, 5, StringType::Wide), found[1]);
+}
+
+TEST_F(StringScannerTests, StringOverBlockBoundaryIsFoundOnce)
+{
+	std::vector<std::uint8_t> data(200, 0xff);
+	for (std::size_t i = 60; i < 140; ++i)
+	{
+		data[i] = 'a';
+	}
+	for (std::size_t i = 150; i < 190; i += 2)
+	{
+		data[i] = 'b';
+		data[i + 1] = 0;
+	}
+
+	auto found = scan(data, CharacterEndianness::Little);
+
+	ASSERT_EQ(2, found.size());
+	EXPECT_EQ(Found(60, 80, StringType::Ascii), found[0]);
+	EXPECT_EQ(Found(150, 20, StringType::Wide), found[1]);
+}
+
+TEST_F(StringScannerTests, ResultsAreSameAsCharacterByCharacterScanning)
+{
+	std::mt19937 generator(42);
+	// Mostly printable characters and zeros, so that there are many strings
+	const std::string alphabet = std::string("ab ~\x7f\x1f\xff", 7) + std::string(4, '\0');
+	std::uniform_int_distribution<std::size_t> choice(0, alphabet.size() - 1);
+
+	for (std::size_t size : {1, 15, 16, 63, 64, 65, 127, 1000, 4099})
+	{
+		std::vector<std::uint8_t> data(size);
+		for (auto &byte : data)
+		{
+			byte = alphabet[choice(generator)];
+		}
+
+		EXPECT_EQ(scanByCharacters(data, CharacterEndianness::Little), scan(data, CharacterEndianness::Little)) << size;
+		EXPECT_EQ(scanByCharacters(data, CharacterEndianness::Big), scan(data, CharacterEndianness::Big)) << size;
+	}
+}
+
+} // namespace tests
+} // namespace fileformat
+} // namespace retdec
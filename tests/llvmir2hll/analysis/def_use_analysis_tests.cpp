@@ -0,0 +1,390 @@
+/**
+* @file tests/llvmir2hll/analysis/def_use_analysis_tests.cpp
+* @brief Tests for the @c def_use_analysis module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <gtest/gtest.h>
+
+#include "retdec/llvmir2hll/analysis/def_use_analysis.h"
+#include "llvmir2hll/analysis/tests_with_value_analysis.h"
+#include "retdec/llvmir2hll/analysis/value_analysis.h"
+#include "retdec/llvmir2hll/ir/add_op_expr.h"
+#include "retdec/llvmir2hll/ir/assign_stmt.h"
+#include "retdec/llvmir2hll/ir/const_bool.h"
+#include "retdec/llvmir2hll/ir/const_int.h"
+#include "retdec/llvmir2hll/ir/if_stmt.h"
+#include "retdec/llvmir2hll/ir/int_type.h"
+#include "retdec/llvmir2hll/ir/lt_op_expr.h"
+#include "retdec/llvmir2hll/ir/return_stmt.h"
+#include "llvmir2hll/ir/tests_with_module.h"
+#include "retdec/llvmir2hll/ir/variable.h"
+#include "retdec/llvmir2hll/ir/while_loop_stmt.h"
+#include "retdec/llvmir2hll/support/types.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace llvmir2hll {
+namespace tests {
+
+/**
+* @brief Tests for the @c def_use_analysis module.
+*/
+class DefUseAnalysisTests: public TestsWithModule {
+protected:
+	const DefUseChains::DefUseChain::value_type *findDefUseChain(
+		ShPtr<DefUseChains> ducs, ShPtr<Statement> stmt,
+		ShPtr<Variable> var);
+	StmtSet getDefUseChain(ShPtr<DefUseChains> ducs, ShPtr<Statement> stmt,
+		ShPtr<Variable> var);
+};
+
+/**
+* @brief Returns the def-use chain of the definition of @a var in @a stmt, the
+*        null pointer if there is no such chain.
+*/
+const DefUseChains::DefUseChain::value_type *DefUseAnalysisTests::findDefUseChain(
+		ShPtr<DefUseChains> ducs, ShPtr<Statement> stmt, ShPtr<Variable> var) {
+	for (const auto &du : ducs->du) {
+		if (du.first.first == stmt && du.first.second == var) {
+			return &du;
+		}
+	}
+	return nullptr;
+}
+
+/**
+* @brief Returns the uses in the def-use chain of the definition of @a var in
+*        @a stmt.
+*
+* If there is no such chain, the test fails.
+*/
+StmtSet DefUseAnalysisTests::getDefUseChain(ShPtr<DefUseChains> ducs,
+		ShPtr<Statement> stmt, ShPtr<Variable> var) {
+	auto du = findDefUseChain(ducs, stmt, var);
+	if (!du) {
+		ADD_FAILURE() << "there is no def-use chain for `" << stmt << "`";
+		return StmtSet();
+	}
+	return du->second;
+}
+
+//
+// Loops.
+//
+
+TEST_F(DefUseAnalysisTests,
+DefinitionsBeforeAndInsideLoopReachAllUsesInAndAfterLoop) {
+	// Set-up the module.
+	//
+	// def test():
+	//    a = 1
+	//    while a < 10:
+	//        a = a + 1
+	//    return a
+	//
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32)));
+	testFunc->addLocalVar(varA);
+	ShPtr<ReturnStmt> returnA(ReturnStmt::create(varA));
+	ShPtr<AssignStmt> assignAPlus1(AssignStmt::create(varA,
+		AddOpExpr::create(varA, ConstInt::create(1, 32))));
+	ShPtr<WhileLoopStmt> whileLoop(WhileLoopStmt::create(
+		LtOpExpr::create(varA, ConstInt::create(10, 32)), assignAPlus1,
+		returnA));
+	ShPtr<AssignStmt> assignA1(AssignStmt::create(varA,
+		ConstInt::create(1, 32), whileLoop));
+	testFunc->setBody(assignA1);
+
+	INSTANTIATE_ALIAS_ANALYSIS_AND_VALUE_ANALYSIS(module);
+	ShPtr<DefUseAnalysis> dua(DefUseAnalysis::create(module, va));
+	ShPtr<DefUseChains> ducs(dua->getDefUseChains(testFunc));
+
+	StmtSet refUses{whileLoop, assignAPlus1, returnA};
+	EXPECT_EQ(refUses, getDefUseChain(ducs, assignA1, varA));
+	// The use of a in `a = a + 1` is reached from the previous iteration.
+	EXPECT_EQ(refUses, getDefUseChain(ducs, assignAPlus1, varA));
+}
+
+TEST_F(DefUseAnalysisTests,
+DefinitionBeforeLoopDoesNotReachUsesAfterRedefinitionInLoopBody) {
+	// Set-up the module.
+	//
+	// def test():
+	//    a = 1
+	//    while a < 10:
+	//        a = 2
+	//        b = a
+	//    return b
+	//
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32)));
+	testFunc->addLocalVar(varA);
+	ShPtr<Variable> varB(Variable::create("b", IntType::create(32)));
+	testFunc->addLocalVar(varB);
+	ShPtr<ReturnStmt> returnB(ReturnStmt::create(varB));
+	ShPtr<AssignStmt> assignBA(AssignStmt::create(varB, varA));
+	ShPtr<AssignStmt> assignA2(AssignStmt::create(varA,
+		ConstInt::create(2, 32), assignBA));
+	ShPtr<WhileLoopStmt> whileLoop(WhileLoopStmt::create(
+		LtOpExpr::create(varA, ConstInt::create(10, 32)), assignA2,
+		returnB));
+	ShPtr<AssignStmt> assignA1(AssignStmt::create(varA,
+		ConstInt::create(1, 32), whileLoop));
+	testFunc->setBody(assignA1);
+
+	INSTANTIATE_ALIAS_ANALYSIS_AND_VALUE_ANALYSIS(module);
+	ShPtr<DefUseAnalysis> dua(DefUseAnalysis::create(module, va));
+	ShPtr<DefUseChains> ducs(dua->getDefUseChains(testFunc));
+
+	StmtSet refA1Uses{whileLoop};
+	EXPECT_EQ(refA1Uses, getDefUseChain(ducs, assignA1, varA));
+	StmtSet refA2Uses{assignBA, whileLoop};
+	EXPECT_EQ(refA2Uses, getDefUseChain(ducs, assignA2, varA));
+	StmtSet refBUses{returnB};
+	EXPECT_EQ(refBUses, getDefUseChain(ducs, assignBA, varB));
+}
+
+//
+// Multiple definitions of a single variable.
+//
+
+TEST_F(DefUseAnalysisTests,
+EachDefinitionInOneNodeReachesOnlyUsesBeforeNextDefinition) {
+	// Set-up the module.
+	//
+	// def test():
+	//    a = 1
+	//    b = a
+	//    a = 2
+	//    return a + b
+	//
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32)));
+	testFunc->addLocalVar(varA);
+	ShPtr<Variable> varB(Variable::create("b", IntType::create(32)));
+	testFunc->addLocalVar(varB);
+	ShPtr<ReturnStmt> returnAB(ReturnStmt::create(
+		AddOpExpr::create(varA, varB)));
+	ShPtr<AssignStmt> assignA2(AssignStmt::create(varA,
+		ConstInt::create(2, 32), returnAB));
+	ShPtr<AssignStmt> assignBA(AssignStmt::create(varB, varA, assignA2));
+	ShPtr<AssignStmt> assignA1(AssignStmt::create(varA,
+		ConstInt::create(1, 32), assignBA));
+	testFunc->setBody(assignA1);
+
+	INSTANTIATE_ALIAS_ANALYSIS_AND_VALUE_ANALYSIS(module);
+	ShPtr<DefUseAnalysis> dua(DefUseAnalysis::create(module, va));
+	ShPtr<DefUseChains> ducs(dua->getDefUseChains(testFunc));
+
+	StmtSet refA1Uses{assignBA};
+	EXPECT_EQ(refA1Uses, getDefUseChain(ducs, assignA1, varA));
+	StmtSet refA2Uses{returnAB};
+	EXPECT_EQ(refA2Uses, getDefUseChain(ducs, assignA2, varA));
+	StmtSet refBUses{returnAB};
+	EXPECT_EQ(refBUses, getDefUseChain(ducs, assignBA, varB));
+}
+
+TEST_F(DefUseAnalysisTests,
+RedefinitionReadingVariableIsUseOfPreviousDefinition) {
+	// Set-up the module.
+	//
+	// def test():
+	//    a = 1
+	//    a = a + 1
+	//    return a
+	//
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32)));
+	testFunc->addLocalVar(varA);
+	ShPtr<ReturnStmt> returnA(ReturnStmt::create(varA));
+	ShPtr<AssignStmt> assignAPlus1(AssignStmt::create(varA,
+		AddOpExpr::create(varA, ConstInt::create(1, 32)), returnA));
+	ShPtr<AssignStmt> assignA1(AssignStmt::create(varA,
+		ConstInt::create(1, 32), assignAPlus1));
+	testFunc->setBody(assignA1);
+
+	INSTANTIATE_ALIAS_ANALYSIS_AND_VALUE_ANALYSIS(module);
+	ShPtr<DefUseAnalysis> dua(DefUseAnalysis::create(module, va));
+	ShPtr<DefUseChains> ducs(dua->getDefUseChains(testFunc));
+
+	StmtSet refA1Uses{assignAPlus1};
+	EXPECT_EQ(refA1Uses, getDefUseChain(ducs, assignA1, varA));
+	StmtSet refAPlus1Uses{returnA};
+	EXPECT_EQ(refAPlus1Uses, getDefUseChain(ducs, assignAPlus1, varA));
+}
+
+TEST_F(DefUseAnalysisTests,
+DefinitionsInBothClausesOfIfReachUseAfterIf) {
+	// Set-up the module.
+	//
+	// c
+	//
+	// def test():
+	//    if c:
+	//        a = 1
+	//    else:
+	//        a = 2
+	//    return a
+	//
+	ShPtr<Variable> varC(Variable::create("c", IntType::create(32)));
+	module->addGlobalVar(varC);
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32)));
+	testFunc->addLocalVar(varA);
+	ShPtr<ReturnStmt> returnA(ReturnStmt::create(varA));
+	ShPtr<AssignStmt> assignA1(AssignStmt::create(varA,
+		ConstInt::create(1, 32)));
+	ShPtr<AssignStmt> assignA2(AssignStmt::create(varA,
+		ConstInt::create(2, 32)));
+	ShPtr<IfStmt> ifStmt(IfStmt::create(varC, assignA1, returnA));
+	ifStmt->setElseClause(assignA2);
+	testFunc->setBody(ifStmt);
+
+	INSTANTIATE_ALIAS_ANALYSIS_AND_VALUE_ANALYSIS(module);
+	ShPtr<DefUseAnalysis> dua(DefUseAnalysis::create(module, va));
+	ShPtr<DefUseChains> ducs(dua->getDefUseChains(testFunc));
+
+	StmtSet refUses{returnA};
+	EXPECT_EQ(refUses, getDefUseChain(ducs, assignA1, varA));
+	EXPECT_EQ(refUses, getDefUseChain(ducs, assignA2, varA));
+}
+
+TEST_F(DefUseAnalysisTests,
+DefinitionRedefinedOnlyInIfReachesUseAfterIf) {
+	// Set-up the module.
+	//
+	// c
+	//
+	// def test():
+	//    a = 1
+	//    if c:
+	//        a = 2
+	//    return a
+	//
+	ShPtr<Variable> varC(Variable::create("c", IntType::create(32)));
+	module->addGlobalVar(varC);
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32)));
+	testFunc->addLocalVar(varA);
+	ShPtr<ReturnStmt> returnA(ReturnStmt::create(varA));
+	ShPtr<AssignStmt> assignA2(AssignStmt::create(varA,
+		ConstInt::create(2, 32)));
+	ShPtr<IfStmt> ifStmt(IfStmt::create(varC, assignA2, returnA));
+	ShPtr<AssignStmt> assignA1(AssignStmt::create(varA,
+		ConstInt::create(1, 32), ifStmt));
+	testFunc->setBody(assignA1);
+
+	INSTANTIATE_ALIAS_ANALYSIS_AND_VALUE_ANALYSIS(module);
+	ShPtr<DefUseAnalysis> dua(DefUseAnalysis::create(module, va));
+	ShPtr<DefUseChains> ducs(dua->getDefUseChains(testFunc));
+
+	StmtSet refUses{returnA};
+	EXPECT_EQ(refUses, getDefUseChain(ducs, assignA1, varA));
+	EXPECT_EQ(refUses, getDefUseChain(ducs, assignA2, varA));
+}
+
+TEST_F(DefUseAnalysisTests,
+DefinitionRedefinedInBothClausesOfIfReachesNoUse) {
+	// Set-up the module.
+	//
+	// c
+	//
+	// def test():
+	//    a = 1
+	//    if c:
+	//        a = 2
+	//    else:
+	//        a = 3
+	//    return a
+	//
+	ShPtr<Variable> varC(Variable::create("c", IntType::create(32)));
+	module->addGlobalVar(varC);
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32)));
+	testFunc->addLocalVar(varA);
+	ShPtr<ReturnStmt> returnA(ReturnStmt::create(varA));
+	ShPtr<AssignStmt> assignA2(AssignStmt::create(varA,
+		ConstInt::create(2, 32)));
+	ShPtr<AssignStmt> assignA3(AssignStmt::create(varA,
+		ConstInt::create(3, 32)));
+	ShPtr<IfStmt> ifStmt(IfStmt::create(varC, assignA2, returnA));
+	ifStmt->setElseClause(assignA3);
+	ShPtr<AssignStmt> assignA1(AssignStmt::create(varA,
+		ConstInt::create(1, 32), ifStmt));
+	testFunc->setBody(assignA1);
+
+	INSTANTIATE_ALIAS_ANALYSIS_AND_VALUE_ANALYSIS(module);
+	ShPtr<DefUseAnalysis> dua(DefUseAnalysis::create(module, va));
+	ShPtr<DefUseChains> ducs(dua->getDefUseChains(testFunc));
+
+	EXPECT_EQ(StmtSet(), getDefUseChain(ducs, assignA1, varA));
+	StmtSet refUses{returnA};
+	EXPECT_EQ(refUses, getDefUseChain(ducs, assignA2, varA));
+	EXPECT_EQ(refUses, getDefUseChain(ducs, assignA3, varA));
+}
+
+//
+// Unreachable statements.
+//
+
+TEST_F(DefUseAnalysisTests,
+StatementsAfterReturnAreNotInDefUseChains) {
+	// Set-up the module.
+	//
+	// def test():
+	//    a = 1
+	//    return a
+	//    a = 2
+	//    b = a
+	//
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32)));
+	testFunc->addLocalVar(varA);
+	ShPtr<Variable> varB(Variable::create("b", IntType::create(32)));
+	testFunc->addLocalVar(varB);
+	ShPtr<AssignStmt> assignBA(AssignStmt::create(varB, varA));
+	ShPtr<AssignStmt> assignA2(AssignStmt::create(varA,
+		ConstInt::create(2, 32), assignBA));
+	ShPtr<ReturnStmt> returnA(ReturnStmt::create(varA, assignA2));
+	ShPtr<AssignStmt> assignA1(AssignStmt::create(varA,
+		ConstInt::create(1, 32), returnA));
+	testFunc->setBody(assignA1);
+
+	INSTANTIATE_ALIAS_ANALYSIS_AND_VALUE_ANALYSIS(module);
+	ShPtr<DefUseAnalysis> dua(DefUseAnalysis::create(module, va));
+	ShPtr<DefUseChains> ducs(dua->getDefUseChains(testFunc));
+
+	StmtSet refUses{returnA};
+	EXPECT_EQ(refUses, getDefUseChain(ducs, assignA1, varA));
+	EXPECT_FALSE(findDefUseChain(ducs, assignA2, varA));
+	EXPECT_FALSE(findDefUseChain(ducs, assignBA, varB));
+	EXPECT_EQ(1, ducs->uses.size());
+}
+
+TEST_F(DefUseAnalysisTests,
+StatementsAfterInfiniteLoopAreNotInDefUseChains) {
+	// Set-up the module.
+	//
+	// def test():
+	//    a = 1
+	//    while True:
+	//        a = a + 1
+	//    return a
+	//
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32)));
+	testFunc->addLocalVar(varA);
+	ShPtr<ReturnStmt> returnA(ReturnStmt::create(varA));
+	ShPtr<AssignStmt> assignAPlus1(AssignStmt::create(varA,
+		AddOpExpr::create(varA, ConstInt::create(1, 32))));
+	ShPtr<WhileLoopStmt> whileLoop(WhileLoopStmt::create(
+		ConstBool::create(true), assignAPlus1, returnA));
+	ShPtr<AssignStmt> assignA1(AssignStmt::create(varA,
+		ConstInt::create(1, 32), whileLoop));
+	testFunc->setBody(assignA1);
+
+	INSTANTIATE_ALIAS_ANALYSIS_AND_VALUE_ANALYSIS(module);
+	ShPtr<DefUseAnalysis> dua(DefUseAnalysis::create(module, va));
+	ShPtr<DefUseChains> ducs(dua->getDefUseChains(testFunc));
+
+	StmtSet refUses{assignAPlus1};
+	EXPECT_EQ(refUses, getDefUseChain(ducs, assignA1, varA));
+	EXPECT_EQ(refUses, getDefUseChain(ducs, assignAPlus1, varA));
+}
+
+} // namespace tests
+} // namespace llvmir2hll
+} // namespace retdec
@@ -916,6 +916,21 @@ GetSelectedButNotFoundFuncsReturnsCorrectValue) {
 	ASSERT_EQ(SELECTED_BUT_NOT_FOUND_FUNCS, module->getSelectedButNotFoundFuncs());
 }
 
+//
+// getNextDumpNumber()
+//
+
+TEST_F(ModuleTests,
+GetNextDumpNumberReturnsNumbersSeparatelyForEachModule) {
+	auto otherModule = std::make_shared<Module>(&llvmModule,
+		llvmModule.getModuleIdentifier(), semanticsMock, configMock);
+
+	ASSERT_EQ(0, module->getNextDumpNumber());
+	ASSERT_EQ(1, module->getNextDumpNumber());
+	ASSERT_EQ(0, otherModule->getNextDumpNumber());
+	ASSERT_EQ(2, module->getNextDumpNumber());
+}
+
 } // namespace tests
 } // namespace llvmir2hll
 } // namespace retdec
@@ -11,6 +11,7 @@
 
 using namespace ::testing;
 using namespace std::string_literals;
+using namespace std::string_view_literals;
 
 namespace retdec {
 namespace llvmir2hll {
@@ -103,7 +104,7 @@ TEST_F(CompoundSemanticsTests,
 GetCHeaderFileForFuncReturnsAnswerIfThereIsSingleSemanticsWhichKnowsTheAnswer) {
 	INSTANTIATE_SEMANTICS_MOCK(semantics);
 	ON_CALL(*semanticsMock, getCHeaderFileForFunc("printf"))
-		.WillByDefault(Return("stdio.h"s));
+		.WillByDefault(Return("stdio.h"sv));
 	compoundSemantics->appendSemantics(semantics);
 
 	std::optional<std::string> answer(compoundSemantics->getCHeaderFileForFunc("printf"));
@@ -120,7 +121,7 @@ GetCHeaderFileForFuncReturnsAnswerIfSecondSemanticsAddedByAppendKnowsTheAnswer)
 
 	INSTANTIATE_SEMANTICS_MOCK(semantics2);
 	ON_CALL(*semantics2Mock, getCHeaderFileForFunc("printf"))
-		.WillByDefault(Return("stdio.h"s));
+		.WillByDefault(Return("stdio.h"sv));
 	compoundSemantics->appendSemantics(semantics2);
 
 	std::optional<std::string> answer(compoundSemantics->getCHeaderFileForFunc("printf"));
@@ -132,7 +133,7 @@ TEST_F(CompoundSemanticsTests,
 GetCHeaderFileForFuncReturnsAnswerIfSecondSemanticsAddedByPrependKnowsTheAnswer) {
 	INSTANTIATE_SEMANTICS_MOCK(semantics1);
 	ON_CALL(*semantics1Mock, getCHeaderFileForFunc("printf"))
-		.WillByDefault(Return("stdio.h"s));
+		.WillByDefault(Return("stdio.h"sv));
 	compoundSemantics->prependSemantics(semantics1);
 
 	INSTANTIATE_SEMANTICS_MOCK(semantics2);
@@ -213,7 +214,7 @@ TEST_F(CompoundSemanticsTests,
 GetNameOfVarStoringResultReturnsAnswerIfThereIsSingleSemanticsWhichKnowsTheAnswer) {
 	INSTANTIATE_SEMANTICS_MOCK(semantics);
 	ON_CALL(*semanticsMock, getNameOfVarStoringResult("getchar"))
-		.WillByDefault(Return("c"s));
+		.WillByDefault(Return("c"sv));
 	compoundSemantics->appendSemantics(semantics);
 
 	std::optional<std::string> answer(compoundSemantics->getNameOfVarStoringResult("getchar"));
@@ -230,7 +231,7 @@ GetNameOfVarStoringResultReturnsAnswerIfSecondSemanticsAddedByAppendKnowsTheAnsw
 
 	INSTANTIATE_SEMANTICS_MOCK(semantics2);
 	ON_CALL(*semantics2Mock, getNameOfVarStoringResult("getchar"))
-		.WillByDefault(Return("c"s));
+		.WillByDefault(Return("c"sv));
 	compoundSemantics->appendSemantics(semantics2);
 
 	std::optional<std::string> answer(compoundSemantics->getNameOfVarStoringResult("getchar"));
@@ -242,7 +243,7 @@ TEST_F(CompoundSemanticsTests,
 GetNameOfVarStoringResultReturnsAnswerIfSecondSemanticsAddedByPrependKnowsTheAnswer) {
 	INSTANTIATE_SEMANTICS_MOCK(semantics1);
 	ON_CALL(*semantics1Mock, getNameOfVarStoringResult("getchar"))
-		.WillByDefault(Return("c"s));
+		.WillByDefault(Return("c"sv));
 	compoundSemantics->prependSemantics(semantics1);
 
 	INSTANTIATE_SEMANTICS_MOCK(semantics2);
@@ -268,7 +269,7 @@ TEST_F(CompoundSemanticsTests,
 GetNameOfParamReturnsAnswerIfThereIsSingleSemanticsWhichKnowsTheAnswer) {
 	INSTANTIATE_SEMANTICS_MOCK(semantics);
 	ON_CALL(*semanticsMock, getNameOfParam("fopen", 1))
-		.WillByDefault(Return("file_path"s));
+		.WillByDefault(Return("file_path"sv));
 	compoundSemantics->appendSemantics(semantics);
 
 	std::optional<std::string> answer(compoundSemantics->getNameOfParam("fopen", 1));
@@ -285,7 +286,7 @@ GetNameOfParamReturnsAnswerIfSecondSemanticsAddedByAppendKnowsTheAnswer) {
 
 	INSTANTIATE_SEMANTICS_MOCK(semantics2);
 	ON_CALL(*semantics2Mock, getNameOfParam("fopen", 1))
-		.WillByDefault(Return("file_path"s));
+		.WillByDefault(Return("file_path"sv));
 	compoundSemantics->appendSemantics(semantics2);
 
 	std::optional<std::string> answer(compoundSemantics->getNameOfParam("fopen", 1));
@@ -297,7 +298,7 @@ TEST_F(CompoundSemanticsTests,
 GetNameOfParamReturnsAnswerIfSecondSemanticsAddedByPrependKnowsTheAnswer) {
 	INSTANTIATE_SEMANTICS_MOCK(semantics1);
 	ON_CALL(*semantics1Mock, getNameOfParam("fopen", 1))
-		.WillByDefault(Return("file_path"s));
+		.WillByDefault(Return("file_path"sv));
 	compoundSemantics->prependSemantics(semantics1);
 
 	INSTANTIATE_SEMANTICS_MOCK(semantics2);
@@ -325,31 +326,31 @@ GetSymbolicNamesForParamReturnsAnswerIfThereIsSingleSemanticsWhichKnowsTheAnswer
 	IntStringMap refMap;
 	refMap[1] = "LOCK_SH";
 	ON_CALL(*semanticsMock, getSymbolicNamesForParam("flock", 2))
-		.WillByDefault(Return(refMap));
+		.WillByDefault(Return(&refMap));
 	compoundSemantics->appendSemantics(semantics);
 
-	std::optional<IntStringMap> answer(compoundSemantics->getSymbolicNamesForParam("flock", 2));
+	const IntStringMap *answer(compoundSemantics->getSymbolicNamesForParam("flock", 2));
 	ASSERT_TRUE(answer);
-	EXPECT_EQ(refMap, answer.value());
+	EXPECT_EQ(refMap, *answer);
 }
 
 TEST_F(CompoundSemanticsTests,
 GetSymbolicNamesForParamReturnsAnswerIfSecondSemanticsAddedByAppendKnowsTheAnswer) {
 	INSTANTIATE_SEMANTICS_MOCK(semantics1);
 	ON_CALL(*semantics1Mock, getSymbolicNamesForParam("flock", 2))
-		.WillByDefault(Return(std::nullopt));
+		.WillByDefault(Return(nullptr));
 	compoundSemantics->appendSemantics(semantics1);
 
 	INSTANTIATE_SEMANTICS_MOCK(semantics2);
 	IntStringMap refMap;
 	refMap[1] = "LOCK_SH";
 	ON_CALL(*semantics2Mock, getSymbolicNamesForParam("flock", 2))
-		.WillByDefault(Return(refMap));
+		.WillByDefault(Return(&refMap));
 	compoundSemantics->appendSemantics(semantics2);
 
-	std::optional<IntStringMap> answer(compoundSemantics->getSymbolicNamesForParam("flock", 2));
+	const IntStringMap *answer(compoundSemantics->getSymbolicNamesForParam("flock", 2));
 	ASSERT_TRUE(answer);
-	EXPECT_EQ(refMap, answer.value());
+	EXPECT_EQ(refMap, *answer);
 }
 
 TEST_F(CompoundSemanticsTests,
@@ -358,17 +359,17 @@ GetSymbolicNamesForParamReturnsAnswerIfSecondSemanticsAddedByPrependKnowsTheAnsw
 	IntStringMap refMap;
 	refMap[1] = "LOCK_SH";
 	ON_CALL(*semantics1Mock, getSymbolicNamesForParam("flock", 2))
-		.WillByDefault(Return(refMap));
+		.WillByDefault(Return(&refMap));
 	compoundSemantics->prependSemantics(semantics1);
 
 	INSTANTIATE_SEMANTICS_MOCK(semantics2);
 	ON_CALL(*semantics2Mock, getSymbolicNamesForParam("flock", 2))
-		.WillByDefault(Return(std::nullopt));
+		.WillByDefault(Return(nullptr));
 	compoundSemantics->prependSemantics(semantics2);
 
-	std::optional<IntStringMap> answer(compoundSemantics->getSymbolicNamesForParam("flock", 2));
+	const IntStringMap *answer(compoundSemantics->getSymbolicNamesForParam("flock", 2));
 	ASSERT_TRUE(answer);
-	EXPECT_EQ(refMap, answer.value());
+	EXPECT_EQ(refMap, *answer);
 }
 
 } // namespace tests
@@ -102,7 +102,7 @@ GetNameOfParamForUnknownFunctionsReturnsNoAnswer) {
 TEST_F(GCCGeneralSemanticsTests,
 GetSymbolicNamesForParamForKnownFunctionsReturnsCorrectAnswer) {
 	// flock
-	std::optional<IntStringMap> flockSymbolicNames(semantics->getSymbolicNamesForParam("flock", 2));
+	const IntStringMap *flockSymbolicNames(semantics->getSymbolicNamesForParam("flock", 2));
 	ASSERT_TRUE(flockSymbolicNames) << "no information for `flock`";
 
 	IntStringMap refMap;
@@ -110,13 +110,60 @@ GetSymbolicNamesForParamForKnownFunctionsReturnsCorrectAnswer) {
 	refMap[2] = "LOCK_EX";
 	refMap[4] = "LOCK_NB";
 	refMap[8] = "LOCK_UN";
-	EXPECT_EQ(refMap, flockSymbolicNames.value());
+	EXPECT_EQ(refMap, *flockSymbolicNames);
+}
+
+TEST_F(GCCGeneralSemanticsTests,
+GetSymbolicNamesForParamReturnsFacilityWhenFacilityAndLevelHaveSameValue) {
+	// syslog
+	const IntStringMap *syslogSymbolicNames(semantics->getSymbolicNamesForParam("syslog", 1));
+	ASSERT_TRUE(syslogSymbolicNames) << "no information for `syslog`";
+	EXPECT_EQ("LOG_KERN", syslogSymbolicNames->at(0));
+	EXPECT_EQ("LOG_ERR", syslogSymbolicNames->at(3));
+	EXPECT_EQ("LOG_USER", syslogSymbolicNames->at(8));
+}
+
+TEST_F(GCCGeneralSemanticsTests,
+GetSymbolicNamesForParamReturnsModesForLioListioAndOpenFlagsForAioFsync) {
+	const IntStringMap *lioListioSymbolicNames(semantics->getSymbolicNamesForParam("lio_listio", 1));
+	ASSERT_TRUE(lioListioSymbolicNames) << "no information for `lio_listio`";
+	IntStringMap refMap;
+	refMap[0] = "LIO_WAIT";
+	refMap[1] = "LIO_NOWAIT";
+	EXPECT_EQ(refMap, *lioListioSymbolicNames);
+
+	const IntStringMap *aioFsyncSymbolicNames(semantics->getSymbolicNamesForParam("aio_fsync", 1));
+	ASSERT_TRUE(aioFsyncSymbolicNames) << "no information for `aio_fsync`";
+	EXPECT_EQ("O_SYNC", aioFsyncSymbolicNames->at(04010000));
+}
+
+TEST_F(GCCGeneralSemanticsTests,
+GetSymbolicNamesForParamReturnsNoAnswerForParamWithoutSymbolicNames) {
+	// shutdown (the first parameter is a socket)
+	EXPECT_FALSE(semantics->getSymbolicNamesForParam("shutdown", 1));
+	EXPECT_TRUE(semantics->getSymbolicNamesForParam("shutdown", 2));
+}
+
+TEST_F(GCCGeneralSemanticsTests,
+GetSymbolicNamesForParamReturnsWhoForFirstParamOfGetrusage) {
+	const IntStringMap *whoSymbolicNames(
+		semantics->getSymbolicNamesForParam("getrusage", 1));
+	ASSERT_TRUE(whoSymbolicNames);
+	EXPECT_EQ("RUSAGE_CHILDREN", whoSymbolicNames->at(-1));
+	EXPECT_FALSE(semantics->getSymbolicNamesForParam("getrusage", 3));
+}
+
+TEST_F(GCCGeneralSemanticsTests,
+GetSymbolicNamesForParamReturnsTheSameMapForRepeatedQueries) {
+	const IntStringMap *flockSymbolicNames(semantics->getSymbolicNamesForParam("flock", 2));
+	ASSERT_TRUE(flockSymbolicNames) << "no information for `flock`";
+	EXPECT_EQ(flockSymbolicNames, semantics->getSymbolicNamesForParam("flock", 2));
 }
 
 TEST_F(GCCGeneralSemanticsTests,
 GetSymbolicNamesForParamForUnknownFunctionsReturnsNoAnswer) {
 	// foo
-	std::optional<IntStringMap> fooSymbolicNames(semantics->getSymbolicNamesForParam("foo", 1));
+	const IntStringMap *fooSymbolicNames(semantics->getSymbolicNamesForParam("foo", 1));
 	EXPECT_FALSE(fooSymbolicNames);
 }
 
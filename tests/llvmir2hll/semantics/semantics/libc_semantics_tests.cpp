@@ -161,7 +161,7 @@ GetNameOfParamForUnknownFunctionsReturnsNoAnswer) {
 TEST_F(LibcSemanticsTests,
 GetSymbolicNamesForParamForKnownFunctionsReturnsCorrectAnswer) {
 	// fseek
-	std::optional<IntStringMap> fseekSymbolicNames(semantics->getSymbolicNamesForParam("fseek", 3));
+	const IntStringMap *fseekSymbolicNames(semantics->getSymbolicNamesForParam("fseek", 3));
 	ASSERT_TRUE(fseekSymbolicNames) << "no information for `fseek`";
 
 	IntStringMap refMap;
@@ -169,13 +169,13 @@ GetSymbolicNamesForParamForKnownFunctionsReturnsCorrectAnswer) {
 	refMap[1] = "SEEK_CUR";
 	refMap[2] = "SEEK_END";
 
-	EXPECT_EQ(refMap, fseekSymbolicNames.value());
+	EXPECT_EQ(refMap, *fseekSymbolicNames);
 }
 
 TEST_F(LibcSemanticsTests,
 GetSymbolicNamesForParamForUnknownFunctionsReturnsNoAnswer) {
 	// foo
-	std::optional<IntStringMap> fooSymbolicNames(semantics->getSymbolicNamesForParam("foo", 1));
+	const IntStringMap *fooSymbolicNames(semantics->getSymbolicNamesForParam("foo", 1));
 	EXPECT_FALSE(fooSymbolicNames);
 }
 
@@ -127,6 +127,39 @@ GetNameOfParamForKnownFunctionsReturnsCorrectAnswer) {
 	EXPECT_EQ("uStyle", openFileParam3Name.value());
 }
 
+TEST_F(WinAPISemanticsTests,
+GetNameOfParamForFunctionsFromFirstAndLastTableReturnsCorrectAnswer) {
+	// _hread
+	std::optional<std::string_view> hreadParam1Name(semantics->getNameOfParam("_hread", 1));
+	ASSERT_TRUE(hreadParam1Name) << "no name of the first parameter of `_hread`";
+	EXPECT_EQ("hFile", hreadParam1Name.value());
+
+	// ZombifyActCtx
+	std::optional<std::string_view> zombifyActCtxParam1Name(semantics->getNameOfParam("ZombifyActCtx", 1));
+	ASSERT_TRUE(zombifyActCtxParam1Name) << "no name of the first parameter of `ZombifyActCtx`";
+	EXPECT_EQ("hActCtx", zombifyActCtxParam1Name.value());
+
+	// ZombifyActCtx (nonexisting parameter)
+	EXPECT_FALSE(semantics->getNameOfParam("ZombifyActCtx", 2));
+}
+
+TEST_F(WinAPISemanticsTests,
+GetNameOfParamForFunctionsStartingWithLowerCaseOrFromSplitTableReturnsCorrectAnswer) {
+	// keybd_event
+	std::optional<std::string_view> keybdEventParam2Name(semantics->getNameOfParam("keybd_event", 2));
+	ASSERT_TRUE(keybdEventParam2Name) << "no name of the second parameter of `keybd_event`";
+	EXPECT_EQ("bScan", keybdEventParam2Name.value());
+
+	// GetNamedPipeClientComputerNameA
+	std::optional<std::string_view> getNamedPipeParam1Name(semantics->getNameOfParam("GetNamedPipeClientComputerNameA", 1));
+	ASSERT_TRUE(getNamedPipeParam1Name) << "no name of the first parameter of `GetNamedPipeClientComputerNameA`";
+	EXPECT_EQ("Pipe", getNamedPipeParam1Name.value());
+
+	// Names which cannot be in any table
+	EXPECT_FALSE(semantics->getNameOfParam("", 1));
+	EXPECT_FALSE(semantics->getNameOfParam("1foo", 1));
+}
+
 TEST_F(WinAPISemanticsTests,
 GetNameOfParamForUnknownFunctionsReturnsNoAnswer) {
 	// foo
@@ -141,7 +174,7 @@ GetNameOfParamForUnknownFunctionsReturnsNoAnswer) {
 TEST_F(WinAPISemanticsTests,
 GetSymbolicNamesForParamForKnownFunctionsReturnsCorrectAnswer) {
 	// regOpenKey
-	std::optional<IntStringMap> regOpenKeySymbolicNames(semantics->getSymbolicNamesForParam("RegOpenKey", 1));
+	const IntStringMap *regOpenKeySymbolicNames(semantics->getSymbolicNamesForParam("RegOpenKey", 1));
 	ASSERT_TRUE(regOpenKeySymbolicNames) << "no information for `RegOpenKey`";
 
 	IntStringMap refMap;
@@ -152,13 +185,24 @@ GetSymbolicNamesForParamForKnownFunctionsReturnsCorrectAnswer) {
 	refMap[-2147483644] = "HKEY_PERFORMANCE_DATA";
 	refMap[-2147483643] = "HKEY_CURRENT_CONFIG";
 	refMap[-2147483642] = "HKEY_DYN_DATA";
-	EXPECT_EQ(refMap, regOpenKeySymbolicNames.value());
+	EXPECT_EQ(refMap, *regOpenKeySymbolicNames);
+}
+
+TEST_F(WinAPISemanticsTests,
+GetSymbolicNamesForParamReturnsHkeysForAnsiAndWideRegOpenKey) {
+	const IntStringMap *regOpenKeyASymbolicNames(semantics->getSymbolicNamesForParam("RegOpenKeyA", 1));
+	ASSERT_TRUE(regOpenKeyASymbolicNames) << "no information for `RegOpenKeyA`";
+	EXPECT_EQ("HKEY_LOCAL_MACHINE", regOpenKeyASymbolicNames->at(-2147483646));
+
+	const IntStringMap *regOpenKeyWSymbolicNames(semantics->getSymbolicNamesForParam("RegOpenKeyW", 1));
+	ASSERT_TRUE(regOpenKeyWSymbolicNames) << "no information for `RegOpenKeyW`";
+	EXPECT_EQ("HKEY_LOCAL_MACHINE", regOpenKeyWSymbolicNames->at(-2147483646));
 }
 
 TEST_F(WinAPISemanticsTests,
 GetSymbolicNamesForParamForUnknownFunctionsReturnsNoAnswer) {
 	// foo
-	std::optional<IntStringMap> fooSymbolicNames(semantics->getSymbolicNamesForParam("foo", 1));
+	const IntStringMap *fooSymbolicNames(semantics->getSymbolicNamesForParam("foo", 1));
 	EXPECT_FALSE(fooSymbolicNames);
 }
 
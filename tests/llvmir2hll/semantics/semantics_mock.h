@@ -25,15 +25,15 @@ public:
 	MOCK_CONST_METHOD0(getId, std::string ());
 	MOCK_CONST_METHOD0(getMainFuncName, std::optional<std::string> ());
 	MOCK_CONST_METHOD1(getCHeaderFileForFunc,
-		std::optional<std::string> (const std::string &));
+		std::optional<std::string_view> (const std::string &));
 	MOCK_CONST_METHOD1(funcNeverReturns,
 		std::optional<bool> (const std::string &));
 	MOCK_CONST_METHOD1(getNameOfVarStoringResult,
-		std::optional<std::string> (const std::string &));
+		std::optional<std::string_view> (const std::string &));
 	MOCK_CONST_METHOD2(getNameOfParam,
-		std::optional<std::string> (const std::string &, unsigned));
+		std::optional<std::string_view> (const std::string &, unsigned));
 	MOCK_CONST_METHOD2(getSymbolicNamesForParam,
-		std::optional<IntStringMap> (const std::string &, unsigned));
+		const IntStringMap *(const std::string &, unsigned));
 };
 
 } // namespace tests
@@ -33,6 +33,7 @@
 
 using namespace ::testing;
 using namespace std::string_literals;
+using namespace std::string_view_literals;
 
 namespace retdec {
 namespace llvmir2hll {
@@ -568,7 +569,7 @@ void ReadableVarRenamerTests::scenarioVarStoringTheResultOfKnownFuncIsRenamedCor
 	// Setup the renamer.
 	INSTANTIATE_VAR_NAME_GEN_AND_VAR_RENAMER(ReadableVarRenamer, true);
 	ON_CALL(*semanticsMock, getNameOfVarStoringResult(func->getName()))
-		.WillByDefault(Return(std::string(refVarName)));
+		.WillByDefault(Return(std::string_view(refVarName)));
 
 	// Do the renaming.
 	varRenamer->renameVars(module);
@@ -746,9 +747,9 @@ VariablesPassedAsArgumentsToWellKnownFunctionAreGivenSpecialNames) {
 	// Setup the renamer.
 	INSTANTIATE_VAR_NAME_GEN_AND_VAR_RENAMER(ReadableVarRenamer, true);
 	ON_CALL(*semanticsMock, getNameOfParam("fopen", 1))
-		.WillByDefault(Return("file_path"s));
+		.WillByDefault(Return("file_path"sv));
 	ON_CALL(*semanticsMock, getNameOfParam("fopen", 2))
-		.WillByDefault(Return("mode"s));
+		.WillByDefault(Return("mode"sv));
 
 	// Do the renaming.
 	varRenamer->renameVars(module);
@@ -793,7 +794,7 @@ DereferenceAndAddressAndCastsAreIgnoredWhenNamingArgumentsOfWellKnownFunctions)
 	// Setup the renamer.
 	INSTANTIATE_VAR_NAME_GEN_AND_VAR_RENAMER(ReadableVarRenamer, true);
 	ON_CALL(*semanticsMock, getNameOfParam("isdigit", 1))
-		.WillByDefault(Return("c"s));
+		.WillByDefault(Return("c"sv));
 
 	// Do the renaming.
 	varRenamer->renameVars(module);
@@ -835,7 +836,7 @@ VariablePassedAsArgumentToWellKnownFunctionIsNotRenamedWhenItIsFunction) {
 	ON_CALL(*semanticsMock, getNameOfParam("fopen", 1))
 		.WillByDefault(Return(std::nullopt));
 	ON_CALL(*semanticsMock, getNameOfParam("fopen", 2))
-		.WillByDefault(Return("mode"s));
+		.WillByDefault(Return("mode"sv));
 
 	// Do the renaming.
 	varRenamer->renameVars(module);
@@ -876,7 +877,7 @@ GlobalVarPassedAsArgOfWellKnownFunctionIsNotGivenSpecialName) {
 	// Setup the renamer.
 	INSTANTIATE_VAR_NAME_GEN_AND_VAR_RENAMER(ReadableVarRenamer, true);
 	ON_CALL(*semanticsMock, getNameOfParam(putcharFunc->getName(), 1))
-		.WillByDefault(Return("c"s));
+		.WillByDefault(Return("c"sv));
 
 	// Do the renaming.
 	varRenamer->renameVars(module);
@@ -1008,9 +1009,9 @@ VarStoringTheResultOfKnownFuncIsRenamedBeforeVarPassedAsArgument) {
 	std::string expectedVarXNameAfterRename("c");
 	INSTANTIATE_VAR_NAME_GEN_AND_VAR_RENAMER(ReadableVarRenamer, true);
 	ON_CALL(*semanticsMock, getNameOfVarStoringResult(getcharFunc->getName()))
-		.WillByDefault(Return(expectedVarXNameAfterRename));
+		.WillByDefault(Return(std::string_view(expectedVarXNameAfterRename)));
 	ON_CALL(*semanticsMock, getNameOfParam(putcharFunc->getName(), 1))
-		.WillByDefault(Return("d"s));
+		.WillByDefault(Return("d"sv));
 
 	// Do the renaming.
 	varRenamer->renameVars(module);
@@ -0,0 +1,355 @@
+/**
+ * @file tests/loader/pointer_map_tests.cpp
+ * @brief Tests for the @c pointer_map module.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <list>
+#include <map>
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include "retdec/fileformat/file_format/raw_data/raw_data_format.h"
+#include "retdec/fileformat/types/sec_seg/section.h"
+#include "retdec/loader/loader/image.h"
+#include "retdec/loader/loader/pointer_map.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace loader {
+namespace tests {
+
+/**
+ * Image whose segments are added directly by the tests.
+ */
+class TestImage : public Image
+{
+public:
+	using Image::Image;
+	using Image::insertSegment;
+	using Image::sortSegments;
+
+	virtual bool load() override
+	{
+		return true;
+	}
+};
+
+class PointerMapTests : public Test
+{
+public:
+	PointerMapTests() : format(makeFormat()), image(format)
+	{
+	}
+
+	static std::shared_ptr<fileformat::RawDataFormat> makeFormat()
+	{
+		std::stringstream emptySs;
+		return std::make_shared<fileformat::RawDataFormat>(emptySs);
+	}
+
+	/**
+	 * Add data segment with @a data on @a address. The segment data are
+	 * zero-padded up to @a size.
+	 */
+	const Segment* addSegment(std::uint64_t address, std::uint64_t size, const std::vector<std::uint8_t>& data)
+	{
+		secSegs.emplace_back();
+		secSegs.back().setType(fileformat::SecSeg::Type::DATA);
+		segData.push_back(data);
+
+		auto& bytes = segData.back();
+		llvm::StringRef dataRef = llvm::StringRef(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+		auto* seg = image.insertSegment(std::make_unique<Segment>(
+				&secSegs.back(), address, size, std::make_unique<SegmentDataSource>(dataRef)));
+		image.sortSegments();
+		return seg;
+	}
+
+	/**
+	 * Little endian 32-bit words.
+	 */
+	static std::vector<std::uint8_t> words(const std::vector<std::uint32_t>& values)
+	{
+		std::vector<std::uint8_t> res;
+		for (auto val : values)
+		{
+			for (std::size_t i = 0; i < 4; ++i)
+				res.push_back((val >> (8 * i)) & 0xFF);
+		}
+		return res;
+	}
+
+	/**
+	 * @a count zero words with @a pointers on the given slots.
+	 */
+	static std::vector<std::uint8_t> wordsWithPointers(std::size_t count, const std::map<std::size_t, std::uint32_t>& pointers)
+	{
+		std::vector<std::uint32_t> values(count, 0);
+		for (const auto& p : pointers)
+			values[p.first] = p.second;
+		return words(values);
+	}
+
+	std::shared_ptr<fileformat::RawDataFormat> format;
+	TestImage image;
+	std::list<fileformat::Section> secSegs;
+	std::list<std::vector<std::uint8_t>> segData;
+};
+
+TEST_F(PointerMapTests,
+IsPointerFindsPointersIntoSegments) {
+	addSegment(0x1000, 0x18, words({0x1008, 0x5, 0x2004, 0x1000, 0x3000, 0x2010}));
+	addSegment(0x2000, 0x10, words({0x100c, 0x0, 0x0, 0x2000}));
+
+	std::uint64_t ptr = 0;
+	EXPECT_TRUE(image.isPointer(0x1000, &ptr));
+	EXPECT_EQ(0x1008, ptr);
+	EXPECT_FALSE(image.isPointer(0x1004));
+	EXPECT_TRUE(image.isPointer(0x1008, &ptr));
+	EXPECT_EQ(0x2004, ptr);
+	EXPECT_TRUE(image.isPointer(0x100c, &ptr));
+	EXPECT_EQ(0x1000, ptr);
+	EXPECT_FALSE(image.isPointer(0x1010));
+	EXPECT_FALSE(image.isPointer(0x1014));
+	EXPECT_TRUE(image.isPointer(0x2000, &ptr));
+	EXPECT_EQ(0x100c, ptr);
+	EXPECT_TRUE(image.isPointer(0x200c, &ptr));
+	EXPECT_EQ(0x2000, ptr);
+	EXPECT_FALSE(image.isPointer(0x3000));
+	EXPECT_EQ(5, image.getPointerMap()->getNumberOfPointers());
+}
+
+TEST_F(PointerMapTests,
+LookupAnswersAlignedSlotsOfMappedSegment) {
+	auto* seg = addSegment(0x1000, 0x8, words({0x1004, 0x5}));
+	auto map = image.getPointerMap();
+
+	bool isPointer = false;
+	std::uint64_t ptr = 0;
+	EXPECT_TRUE(map->lookup(seg, 0x1000, isPointer, &ptr));
+	EXPECT_TRUE(isPointer);
+	EXPECT_EQ(0x1004, ptr);
+	EXPECT_TRUE(map->lookup(seg, 0x1004, isPointer, &ptr));
+	EXPECT_FALSE(isPointer);
+
+	// Not mapped slots.
+	EXPECT_FALSE(map->lookup(seg, 0x1002, isPointer));
+	EXPECT_FALSE(map->lookup(seg, 0x1008, isPointer));
+	EXPECT_FALSE(map->lookup(seg, 0xffc, isPointer));
+	EXPECT_FALSE(map->lookup(nullptr, 0x1000, isPointer));
+}
+
+TEST_F(PointerMapTests,
+TargetsAreFoundInAllBitBlocks) {
+	std::map<std::size_t, std::uint32_t> pointers = {
+		{0, 0x1010},
+		{1, 0x1000},
+		{63, 0x1020},
+		{64, 0x1030},
+		{127, 0x1040},
+		{130, 0x1050},
+		{199, 0x1060}
+	};
+	auto* seg = addSegment(0x1000, 200 * 4, wordsWithPointers(200, pointers));
+	auto map = image.getPointerMap();
+
+	EXPECT_EQ(pointers.size(), map->getNumberOfPointers());
+	for (std::size_t slot = 0; slot < 200; ++slot)
+	{
+		bool isPointer = false;
+		std::uint64_t ptr = 0;
+		ASSERT_TRUE(map->lookup(seg, 0x1000 + 4 * slot, isPointer, &ptr));
+
+		auto it = pointers.find(slot);
+		EXPECT_EQ(it != pointers.end(), isPointer) << "slot " << slot;
+		if (it != pointers.end())
+		{
+			EXPECT_EQ(it->second, ptr) << "slot " << slot;
+		}
+	}
+}
+
+TEST_F(PointerMapTests,
+SkipToPointerSkipsSlotsWithoutPointers) {
+	auto* seg = addSegment(0x1000, 200 * 4, wordsWithPointers(200, {{0, 0x1000}, {63, 0x1000}, {130, 0x1000}, {197, 0x1000}}));
+	auto map = image.getPointerMap();
+
+	EXPECT_EQ(0x1000, map->skipToPointer(seg, 0x1000));
+	EXPECT_EQ(0x1000 + 4 * 63, map->skipToPointer(seg, 0x1004));
+	EXPECT_EQ(0x1000 + 4 * 63, map->skipToPointer(seg, 0x1000 + 4 * 63));
+	EXPECT_EQ(0x1000 + 4 * 130, map->skipToPointer(seg, 0x1000 + 4 * 64));
+	EXPECT_EQ(0x1000 + 4 * 197, map->skipToPointer(seg, 0x1000 + 4 * 131));
+}
+
+TEST_F(PointerMapTests,
+SkipToPointerStopsAtEndOfSegment) {
+	auto* seg = addSegment(0x1000, 200 * 4, wordsWithPointers(200, {{197, 0x1000}}));
+	auto map = image.getPointerMap();
+
+	EXPECT_EQ(0x1000 + 4 * 200, map->skipToPointer(seg, 0x1000 + 4 * 198));
+	EXPECT_EQ(0x1000 + 4 * 200, map->skipToPointer(seg, 0x1000 + 4 * 199));
+	// Address after the last slot is not mapped.
+	EXPECT_EQ(0x1000 + 4 * 200, map->skipToPointer(seg, 0x1000 + 4 * 200));
+}
+
+TEST_F(PointerMapTests,
+SkipToPointerStopsAtLastWholeSlotOfUnalignedSegment) {
+	// Last two bytes do not make a whole word.
+	auto* seg = addSegment(0x1000, 0x22, std::vector<std::uint8_t>(0x22, 0));
+	auto map = image.getPointerMap();
+
+	EXPECT_EQ(0, map->getNumberOfPointers());
+	EXPECT_EQ(0x1020, map->skipToPointer(seg, 0x1000));
+	EXPECT_EQ(0x1020, map->skipToPointer(seg, 0x101c));
+	EXPECT_EQ(0x1020, map->skipToPointer(seg, 0x1020));
+	EXPECT_EQ(0x1021, map->skipToPointer(seg, 0x1021));
+	// Unaligned addresses are not mapped.
+	EXPECT_EQ(0x1002, map->skipToPointer(seg, 0x1002));
+}
+
+TEST_F(PointerMapTests,
+SlotsAfterRawDataOfSegmentAreZeroed) {
+	// Raw data end in the middle of the third slot, its missing bytes are
+	// zeroes.
+	auto data = words({0x0, 0x1000, 0x1004});
+	data.resize(10);
+	auto* seg = addSegment(0x1000, 0x20, data);
+	auto map = image.getPointerMap();
+
+	bool isPointer = false;
+	std::uint64_t ptr = 0;
+	EXPECT_TRUE(map->lookup(seg, 0x1004, isPointer, &ptr));
+	EXPECT_TRUE(isPointer);
+	EXPECT_EQ(0x1000, ptr);
+	EXPECT_TRUE(map->lookup(seg, 0x1008, isPointer, &ptr));
+	EXPECT_TRUE(isPointer);
+	EXPECT_EQ(0x1004, ptr);
+	EXPECT_TRUE(map->lookup(seg, 0x101c, isPointer));
+	EXPECT_FALSE(isPointer);
+	EXPECT_EQ(0x1020, map->skipToPointer(seg, 0x100c));
+}
+
+TEST_F(PointerMapTests,
+OverlappingSegmentsAreNotMapped) {
+	auto* seg1 = addSegment(0x1000, 0x10, words({0x1004, 0x0, 0x0, 0x0}));
+	auto* seg2 = addSegment(0x1008, 0x10, words({0x0, 0x0, 0x1008, 0x0}));
+	auto* seg3 = addSegment(0x2000, 0x8, words({0x2004, 0x0}));
+	auto map = image.getPointerMap();
+
+	bool isPointer = false;
+	EXPECT_FALSE(map->lookup(seg1, 0x1000, isPointer));
+	EXPECT_FALSE(map->lookup(seg2, 0x1008, isPointer));
+	EXPECT_EQ(0x1000, map->skipToPointer(seg1, 0x1000));
+	EXPECT_EQ(0x1008, map->skipToPointer(seg2, 0x1008));
+	EXPECT_TRUE(map->lookup(seg3, 0x2000, isPointer));
+	EXPECT_TRUE(isPointer);
+	EXPECT_EQ(1, map->getNumberOfPointers());
+}
+
+TEST_F(PointerMapTests,
+IsPointerReadsImageWhenMapDoesNotKnowAnswer) {
+	addSegment(0x1000, 0x10, words({0x1004, 0x0, 0x0, 0x0}));
+	addSegment(0x1008, 0x10, words({0x0, 0x0, 0x1008, 0x0}));
+
+	std::uint64_t ptr = 0;
+	EXPECT_TRUE(image.isPointer(0x1000, &ptr));
+	EXPECT_EQ(0x1004, ptr);
+	EXPECT_FALSE(image.isPointer(0x1004));
+	EXPECT_TRUE(image.isPointer(0x1010, &ptr));
+	EXPECT_EQ(0x1008, ptr);
+}
+
+TEST_F(PointerMapTests,
+IsPointerReadsImageOnUnalignedAddress) {
+	// Word on 0x1002 is 0x1000, aligned words are not pointers.
+	addSegment(0x1000, 0x8, {0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00});
+
+	bool isPointer = true;
+	EXPECT_FALSE(image.getPointerMap()->lookup(image.getSegmentFromAddress(0x1002), 0x1002, isPointer));
+
+	std::uint64_t ptr = 0;
+	EXPECT_FALSE(image.isPointer(0x1000));
+	EXPECT_TRUE(image.isPointer(0x1002, &ptr));
+	EXPECT_EQ(0x1000, ptr);
+}
+
+TEST_F(PointerMapTests,
+BigEndianWordsAreSwapped) {
+	format->setEndianness(retdec::utils::Endianness::BIG);
+	addSegment(0x1000, 0x8, {0x00, 0x00, 0x10, 0x04, 0x04, 0x10, 0x00, 0x00});
+
+	std::uint64_t ptr = 0;
+	EXPECT_TRUE(image.isPointer(0x1000, &ptr));
+	EXPECT_EQ(0x1004, ptr);
+	EXPECT_FALSE(image.isPointer(0x1004));
+}
+
+TEST_F(PointerMapTests,
+SetXBytesInvalidatesMap) {
+	addSegment(0x1000, 0x8, words({0x5, 0x0}));
+	auto oldMap = image.getPointerMap();
+	EXPECT_FALSE(image.isPointer(0x1000));
+
+	ASSERT_TRUE(image.setXBytes(0x1000, words({0x1004})));
+
+	std::uint64_t ptr = 0;
+	EXPECT_TRUE(image.isPointer(0x1000, &ptr));
+	EXPECT_EQ(0x1004, ptr);
+	EXPECT_NE(oldMap, image.getPointerMap());
+	EXPECT_EQ(0, oldMap->getNumberOfPointers());
+	EXPECT_EQ(1, image.getPointerMap()->getNumberOfPointers());
+}
+
+TEST_F(PointerMapTests,
+AddingSegmentInvalidatesMap) {
+	addSegment(0x1000, 0x8, words({0x2000, 0x0}));
+	EXPECT_FALSE(image.isPointer(0x1000));
+
+	addSegment(0x2000, 0x8, words({0x0, 0x0}));
+
+	EXPECT_TRUE(image.isPointer(0x1000));
+}
+
+TEST_F(PointerMapTests,
+SettingSegmentBytesInvalidatesMap) {
+	addSegment(0x1000, 0x8, words({0x5, 0x0}));
+	EXPECT_FALSE(image.isPointer(0x1000));
+
+	ASSERT_TRUE(image.getSegmentFromAddress(0x1000)->setBytes(words({0x1004}), 0));
+
+	EXPECT_TRUE(image.isPointer(0x1000));
+}
+
+TEST_F(PointerMapTests,
+ResizingSegmentInvalidatesMapAndSegmentIndex) {
+	addSegment(0x1000, 0x8, words({0x2000, 0x0}));
+	addSegment(0x1ff0, 0x10, {});
+	EXPECT_FALSE(image.isPointer(0x1000));
+	EXPECT_EQ(nullptr, image.getSegmentFromAddress(0x2000));
+
+	image.getSegmentFromAddress(0x1ff0)->resize(0x20);
+
+	EXPECT_TRUE(image.isPointer(0x1000));
+	EXPECT_NE(nullptr, image.getSegmentFromAddress(0x2000));
+}
+
+TEST_F(PointerMapTests,
+ShrinkingSegmentInvalidatesMapAndSegmentIndex) {
+	addSegment(0x1000, 0x8, words({0x2004, 0x0}));
+	addSegment(0x2000, 0x10, {});
+	EXPECT_TRUE(image.isPointer(0x1000));
+	EXPECT_NE(nullptr, image.getSegmentFromAddress(0x2004));
+
+	image.getSegmentFromAddress(0x2000)->shrink(0x2008, 0x8);
+
+	EXPECT_FALSE(image.isPointer(0x1000));
+	EXPECT_EQ(nullptr, image.getSegmentFromAddress(0x2004));
+	EXPECT_NE(nullptr, image.getSegmentFromAddress(0x2008));
+}
+
+} // namespace tests
+} // namespace loader
+} // namespace retdec
@@ -211,6 +211,53 @@ GetBytesOutOfBoundsWithGreaterMemorySizeWorks) {
 	EXPECT_EQ(expected, loaded);
 }
 
+TEST_F(SegmentTests,
+GetBytesIntoBufferWorks) {
+	std::vector<std::uint8_t> mockFileData = { 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16 };
+
+	Segment seg(nullptr, 0x1000, mockFileData.size(), makeDataSource(mockFileData));
+
+	std::uint8_t loaded[4] = {};
+
+	EXPECT_TRUE(seg.getBytes(loaded, 2, 4));
+	EXPECT_EQ(std::vector<std::uint8_t>({ 0x12, 0x13, 0x14, 0x15 }), std::vector<std::uint8_t>(loaded, loaded + 4));
+}
+
+TEST_F(SegmentTests,
+GetBytesIntoBufferPartiallyOutOfBoundsFails) {
+	std::vector<std::uint8_t> mockFileData = { 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16 };
+
+	Segment seg(nullptr, 0x1000, mockFileData.size(), makeDataSource(mockFileData));
+
+	std::uint8_t loaded[5] = {};
+
+	EXPECT_FALSE(seg.getBytes(loaded, 5, 5));
+	EXPECT_FALSE(seg.getBytes(loaded, 50, 5));
+}
+
+TEST_F(SegmentTests,
+GetBytesIntoBufferWithGreaterMemorySizeFillsZeroes) {
+	std::vector<std::uint8_t> mockFileData = { 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16 };
+
+	Segment seg(nullptr, 0x1000, 0x100, makeDataSource(mockFileData));
+
+	std::uint8_t loaded[5] = { 0xff, 0xff, 0xff, 0xff, 0xff };
+
+	EXPECT_TRUE(seg.getBytes(loaded, 4, 5));
+	EXPECT_EQ(std::vector<std::uint8_t>({ 0x14, 0x15, 0x16, 0x00, 0x00 }), std::vector<std::uint8_t>(loaded, loaded + 5));
+}
+
+TEST_F(SegmentTests,
+GetRawBytesWorks) {
+	std::vector<std::uint8_t> mockFileData = { 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16 };
+
+	Segment seg(nullptr, 0x1000, 0x100, makeDataSource(mockFileData));
+
+	EXPECT_EQ(mockFileData.data() + 2, seg.getRawBytes(2, 5));
+	EXPECT_EQ(nullptr, seg.getRawBytes(2, 6));
+	EXPECT_EQ(nullptr, seg.getRawBytes(0x50, 1));
+}
+
 TEST_F(SegmentTests,
 SetBytesWorks) {
 	std::vector<std::uint8_t> mockFileData = { 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16 };
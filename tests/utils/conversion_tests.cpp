@@ -233,6 +233,18 @@ byteSwap32Success) {
 	EXPECT_EQ(0x12345678, byteSwap32(0x78563412));
 }
 
+//
+// byteSwap()
+//
+
+TEST_F(ConversionTests,
+byteSwapSuccess) {
+	EXPECT_EQ(0x12, byteSwap<std::uint8_t>(0x12));
+	EXPECT_EQ(0x3412, byteSwap<std::uint16_t>(0x1234));
+	EXPECT_EQ(0x78563412u, byteSwap<std::uint32_t>(0x12345678));
+	EXPECT_EQ(0xefcdab8967452301ull, byteSwap<std::uint64_t>(0x0123456789abcdefull));
+}
+
 //
 // byteSwap16()
 //
@@ -0,0 +1,92 @@
+/**
+* @file tests/utils/mapped_file_tests.cpp
+* @brief Tests for the @c mapped_file module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/utils/filesystem.h"
+#include "retdec/utils/mapped_file.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace utils {
+namespace tests {
+
+/**
+* @brief Tests for the @c mapped_file module.
+*/
+class MappedFileTests: public Test {
+protected:
+	virtual void TearDown() override {
+		std::error_code ec;
+		fs::remove(path, ec);
+	}
+
+	void createFile(const std::vector<std::uint8_t> &content) {
+		path = (fs::temp_directory_path() / ("retdec-mapped-file-"
+			+ std::to_string(reinterpret_cast<std::uintptr_t>(this)))).string();
+		std::ofstream file(path, std::ios::binary);
+		file.write(reinterpret_cast<const char *>(content.data()),
+			content.size());
+	}
+
+protected:
+	std::string path;
+};
+
+TEST_F(MappedFileTests,
+ContentOfMappedFileIsSameAsContentOfFile) {
+	std::vector<std::uint8_t> content = {0x4d, 0x5a, 0x00, 0xff, 0x10};
+	createFile(content);
+
+	MappedFile file(path);
+
+	ASSERT_TRUE(file.isValid());
+	ASSERT_EQ(content.size(), file.getSize());
+	EXPECT_EQ(content, std::vector<std::uint8_t>(file.begin(), file.end()));
+}
+
+TEST_F(MappedFileTests,
+EmptyFileIsValidButHasNoData) {
+	createFile({});
+
+	MappedFile file(path);
+
+	EXPECT_TRUE(file.isValid());
+	EXPECT_EQ(nullptr, file.getData());
+	EXPECT_EQ(0, file.getSize());
+}
+
+TEST_F(MappedFileTests,
+NonexistingFileIsNotValid) {
+	MappedFile file("/this/file/does/not/exist");
+
+	EXPECT_FALSE(file.isValid());
+	EXPECT_EQ(nullptr, file.getData());
+	EXPECT_EQ(0, file.getSize());
+}
+
+TEST_F(MappedFileTests,
+MovedFromFileIsNotValidAndMovedToFileOwnsMapping) {
+	std::vector<std::uint8_t> content = {0x01, 0x02, 0x03};
+	createFile(content);
+	MappedFile original(path);
+
+	MappedFile moved(std::move(original));
+
+	EXPECT_FALSE(original.isValid());
+	EXPECT_EQ(nullptr, original.getData());
+	ASSERT_TRUE(moved.isValid());
+	EXPECT_EQ(content, std::vector<std::uint8_t>(moved.begin(), moved.end()));
+}
+
+} // namespace tests
+} // namespace utils
+} // namespace retdec
@@ -73,6 +73,21 @@ LimitSystemMemoryToHalfOfTotalSystemMemoryReturnsTrue) {
 	ASSERT_TRUE(limitSystemMemoryToHalfOfTotalSystemMemory());
 }
 
+TEST_F(MemoryTests,
+GetPeakMemoryUsageReturnsNonZeroSize) {
+	auto size = getPeakMemoryUsage();
+
+	ASSERT_GT(size, 0);
+}
+
+TEST_F(MemoryTests,
+GetPeakMemoryUsageDoesNotDecrease) {
+	auto before = getPeakMemoryUsage();
+	auto after = getPeakMemoryUsage();
+
+	ASSERT_LE(before, after);
+}
+
 } // namespace tests
 } // namespace utils
 } // namespace retdec
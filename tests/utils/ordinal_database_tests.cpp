@@ -0,0 +1,165 @@
+/**
+* @file tests/utils/ordinal_database_tests.cpp
+* @brief Tests for the @c ordinal_database module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <fstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "retdec/utils/filesystem.h"
+#include "retdec/utils/ordinal_database.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace utils {
+namespace tests {
+
+/**
+* @brief Tests for the @c ordinal_database module.
+*/
+class OrdinalDatabaseTests: public Test {
+protected:
+	virtual void SetUp() override {
+		auto id = std::to_string(reinterpret_cast<std::uintptr_t>(this));
+		dir = fs::temp_directory_path() / ("retdec-ordinals-" + id);
+		fs::create_directories(dir);
+		path = (fs::temp_directory_path() / ("retdec-ordinals-" + id
+			+ ".orddb")).string();
+	}
+
+	virtual void TearDown() override {
+		std::error_code ec;
+		fs::remove_all(dir, ec);
+		fs::remove(path, ec);
+	}
+
+	void createOrdFile(const std::string &name, const std::string &content) {
+		std::ofstream file((dir / name).string());
+		file << content;
+	}
+
+	void compile() {
+		std::ofstream output(path, std::ios::binary);
+		ASSERT_TRUE(OrdinalDatabase::compile(dir.string(), output));
+	}
+
+protected:
+	fs::path dir;
+	std::string path;
+};
+
+TEST_F(OrdinalDatabaseTests,
+NamesAreFoundByLibraryAndOrdinal) {
+	createOrdFile("kernel32.ord", "1 AcquireSRWLockExclusive\n3 ActivateActCtx\n");
+	createOrdFile("ws2_32.ord", "23 socket\n3 closesocket\n115 WSAStartup");
+	compile();
+
+	OrdinalDatabase db(path);
+
+	ASSERT_TRUE(db.isValid());
+	EXPECT_EQ(2, db.getLibraryCount());
+	EXPECT_EQ("AcquireSRWLockExclusive", db.getName("kernel32", 1));
+	EXPECT_EQ("ActivateActCtx", db.getName("kernel32", 3));
+	EXPECT_EQ("socket", db.getName("ws2_32", 23));
+	EXPECT_EQ("closesocket", db.getName("ws2_32", 3));
+	EXPECT_EQ("WSAStartup", db.getName("ws2_32", 115));
+}
+
+TEST_F(OrdinalDatabaseTests,
+UnknownLibrariesAndOrdinalsHaveNoName) {
+	createOrdFile("kernel32.ord", "1 AcquireSRWLockExclusive\n3 ActivateActCtx\n");
+	compile();
+
+	OrdinalDatabase db(path);
+
+	ASSERT_TRUE(db.isValid());
+	EXPECT_TRUE(db.hasLibrary("kernel32"));
+	EXPECT_FALSE(db.hasLibrary("user32"));
+	EXPECT_EQ("", db.getName("user32", 1));
+	EXPECT_EQ("", db.getName("kernel32", 0));
+	EXPECT_EQ("", db.getName("kernel32", 2));
+	EXPECT_EQ("", db.getName("kernel32", 4));
+	EXPECT_EQ("", db.getName("kernel32", 0x100000001));
+}
+
+TEST_F(OrdinalDatabaseTests,
+InvalidLinesAndOtherFilesAreIgnored) {
+	createOrdFile("msvcrt.ord", "# comment\n\n-1 negative\n7 _exit\n7 exit\n");
+	createOrdFile("readme.txt", "1 nothing\n");
+	compile();
+
+	OrdinalDatabase db(path);
+
+	ASSERT_TRUE(db.isValid());
+	EXPECT_EQ(1, db.getLibraryCount());
+	EXPECT_EQ("exit", db.getName("msvcrt", 7));
+	EXPECT_FALSE(db.hasLibrary("readme"));
+}
+
+TEST_F(OrdinalDatabaseTests,
+ManyLibrariesCanBeFound) {
+	for (int i = 0; i < 300; ++i) {
+		createOrdFile("lib" + std::to_string(i) + ".ord",
+			std::to_string(i) + " f" + std::to_string(i) + "\n");
+	}
+	compile();
+
+	OrdinalDatabase db(path);
+
+	ASSERT_TRUE(db.isValid());
+	EXPECT_EQ(300, db.getLibraryCount());
+	for (int i = 0; i < 300; ++i) {
+		EXPECT_EQ("f" + std::to_string(i),
+			db.getName("lib" + std::to_string(i), i));
+	}
+}
+
+TEST_F(OrdinalDatabaseTests,
+DatabaseOfEmptyDirectoryIsValidAndEmpty) {
+	compile();
+
+	OrdinalDatabase db(path);
+
+	EXPECT_TRUE(db.isValid());
+	EXPECT_EQ(0, db.getLibraryCount());
+	EXPECT_EQ("", db.getName("kernel32", 1));
+}
+
+TEST_F(OrdinalDatabaseTests,
+FileWhichIsNotDatabaseIsNotValid) {
+	createOrdFile("kernel32.ord", "1 AcquireSRWLockExclusive\n");
+	OrdinalDatabase notDatabase((dir / "kernel32.ord").string());
+	OrdinalDatabase missing("/this/file/does/not/exist");
+
+	EXPECT_FALSE(notDatabase.isValid());
+	EXPECT_FALSE(missing.isValid());
+	EXPECT_EQ("", missing.getName("kernel32", 1));
+}
+
+TEST_F(OrdinalDatabaseTests,
+CompilingNonexistingDirectoryFails) {
+	std::ofstream output(path, std::ios::binary);
+
+	EXPECT_FALSE(OrdinalDatabase::compile("/this/dir/does/not/exist", output));
+}
+
+TEST_F(OrdinalDatabaseTests,
+MovedToDatabaseOwnsMapping) {
+	createOrdFile("kernel32.ord", "1 AcquireSRWLockExclusive\n");
+	compile();
+	OrdinalDatabase original(path);
+
+	OrdinalDatabase moved(std::move(original));
+
+	EXPECT_FALSE(original.isValid());
+	ASSERT_TRUE(moved.isValid());
+	EXPECT_EQ("AcquireSRWLockExclusive", moved.getName("kernel32", 1));
+}
+
+} // namespace tests
+} // namespace utils
+} // namespace retdec